@@ -0,0 +1,135 @@
+/**
+ * @file boot_select.c
+ *
+ * @brief A/B slot boot selector
+ *
+ * Tiny standalone image in the FW_BOOT_SECTORS region at the bottom
+ * of flash: validate the two slot headers, pick the newest, launch.
+ * The slot layout and header struct come from src/fw_update.h - this
+ * file and the application share that contract.
+ *
+ * Trial policy (the rollback half of the OTA story): a slot whose
+ * header is unconfirmed launches under an 8 s hardware watchdog with
+ * an attempt counter in watchdog scratch. The application clears the
+ * counter and programs the header's confirmed word after its first
+ * healthy decision; an image that never gets there resets, burns an
+ * attempt, and after FW_TRIAL_MAX the selector falls back to the
+ * other slot. Scratch survives watchdog and soft resets but not
+ * power cycles, so a power-cycled bad image re-earns its bounded
+ * attempts - accepted, the alternative is selector-side flash writes.
+ *
+ * Confirmed images skip the full CRC sweep (vector-table sanity only)
+ * to keep the boot path fast; unconfirmed trials pay the sweep once.
+ * Nothing valid anywhere drops to BOOTSEL for recovery.
+ */
+
+#include "fw_update.h"
+
+#include "hardware/regs/addressmap.h"
+#include "hardware/structs/scb.h"
+#include "hardware/structs/watchdog.h"
+#include "hardware/watchdog.h"
+#include "pico/bootrom.h"
+
+// Vector table lives past the header and the image's own boot2 stub
+#define SLOT_VTOR(s) (XIP_BASE + FW_SLOT_OFFSET(s) + FW_HEADER_BYTES + 0x100u)
+
+static const struct FwSlotHeader* header(int slot) {
+    return (const struct FwSlotHeader*)(XIP_BASE + FW_SLOT_OFFSET(slot));
+}
+
+// Software CRC-32 (IEEE): no DMA claims this early; a full-slot sweep
+// costs tens of ms and runs only for unconfirmed trial images.
+static uint32_t crc32_sw(const uint8_t* p, uint32_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        for (int b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+// Initial SP must land in striped SRAM, reset vector inside the slot
+// with the thumb bit - catches a headerless or half-programmed image
+// before jumping into it.
+static bool vectors_sane(int slot) {
+    const uint32_t* v = (const uint32_t*)SLOT_VTOR(slot);
+    if (v[0] < SRAM_BASE || v[0] > SRAM_BASE + 264 * 1024) return false;
+    if ((v[1] & 1u) == 0) return false;
+    return v[1] >= SLOT_VTOR(slot) &&
+           v[1] < XIP_BASE + FW_SLOT_OFFSET(slot) + FW_SLOT_BYTES;
+}
+
+static bool slot_usable(int slot, bool full_crc) {
+    const struct FwSlotHeader* h = header(slot);
+    if (h->magic != FW_SLOT_MAGIC) return false;
+    if (h->slot != (uint32_t)slot) return false;
+    if (h->len == 0 || h->len > FW_SLOT_BYTES - FW_HEADER_BYTES) return false;
+    if (!vectors_sane(slot)) return false;
+    if (!full_crc) return true;
+    const uint8_t* img =
+        (const uint8_t*)(XIP_BASE + FW_SLOT_OFFSET(slot) + FW_HEADER_BYTES);
+    return crc32_sw(img, h->len) == h->crc32;
+}
+
+static void __attribute__((noreturn)) launch(int slot) {
+    uint32_t vtor = SLOT_VTOR(slot);
+    uint32_t sp = ((const uint32_t*)vtor)[0];
+    uint32_t pc = ((const uint32_t*)vtor)[1];
+    scb_hw->vtor = vtor;
+    __asm volatile("msr msp, %0\n bx %1\n" ::"r"(sp), "r"(pc));
+    __builtin_unreachable();
+}
+
+int main(void) {
+    bool usable[2];
+    uint32_t seq[2];
+    for (int s = 0; s < 2; s++) {
+        // Cheap pass first; the CRC sweep happens below only if the
+        // winning candidate is on trial.
+        usable[s] = slot_usable(s, false);
+        seq[s] = usable[s] ? header(s)->seq : 0;
+    }
+
+    int pick = -1;
+    if (usable[0] || usable[1])
+        pick = (seq[1] > seq[0]) ? 1 : 0;
+    if (pick < 0 || !usable[pick])
+        reset_usb_boot(0, 0);  // nothing bootable: BOOTSEL for recovery
+
+    if (header(pick)->confirmed != 0) {
+        // Trial image: full integrity sweep, then count the attempt.
+        uint32_t attempts = 0;
+        if (watchdog_hw->scratch[FW_SCRATCH_IDX] == FW_SCRATCH_MAGIC) {
+            uint32_t p = watchdog_hw->scratch[FW_SCRATCH_IDX + 1];
+            if (fw_trial_slot(p) == (uint32_t)pick &&
+                fw_trial_seq(p) == (header(pick)->seq & 0xFFFFu))
+                attempts = fw_trial_attempts(p);
+        }
+        if (attempts >= FW_TRIAL_MAX || !slot_usable(pick, true)) {
+            // Roll back: the other slot is the last image that
+            // confirmed (or the factory one). Leave the scratch so the
+            // bad trial stays parked until a new upload bumps the seq.
+            int other = 1 - pick;
+            if (!slot_usable(other, true)) reset_usb_boot(0, 0);
+            pick = other;
+        } else {
+            watchdog_hw->scratch[FW_SCRATCH_IDX] = FW_SCRATCH_MAGIC;
+            watchdog_hw->scratch[FW_SCRATCH_IDX + 1] =
+                fw_trial_pack((uint32_t)pick, attempts + 1, header(pick)->seq);
+            // The leash for the trial: if the image never arms its own
+            // watchdog (which reconfigures this one) and hangs, the
+            // reset lands back here with the attempt already counted.
+            watchdog_enable(8000, true);
+            launch(pick);
+        }
+    }
+
+    // Confirmed (or rolled-back) image: note the running slot for the
+    // application's fw_update_init(), attempts stay zero.
+    watchdog_hw->scratch[FW_SCRATCH_IDX] = FW_SCRATCH_MAGIC;
+    watchdog_hw->scratch[FW_SCRATCH_IDX + 1] =
+        fw_trial_pack((uint32_t)pick, 0, header(pick)->seq);
+    launch(pick);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file model_meta.h
+ *
+ * @brief Per-feature input normalization metadata for the QDNN models
+ *
+ * The normalization a model was trained with used to live only in the
+ * training pipeline, with the firmware assuming "deci-units times 0.1
+ * equals model units" by convention. Each generated model header now
+ * carries a metadata block beside the array - feature count, and per
+ * feature the offset/scale applied before quantization plus the range
+ * the training distribution covered - so input assembly verifies the
+ * convention at boot and derives the integer quantization multipliers
+ * per model instead of hard-coding them.
+ *
+ * All values stay in the sensors' 0.1-unit fixed point: the effective
+ * model input is (v10 - offset10) * 0.1 * scale, which input assembly
+ * folds into one Q16 multiplier per feature.
+ *
+ * The block also names where each feature comes from: source 0 keeps
+ * the historical positional convention (0 temp, 1 humid, 2 soil,
+ * extended to 3 hour-of-day, 4 soil slope), so existing exports - whose
+ * initializers predate the field and zero-initialize it - run
+ * unchanged, and a richer export either rides the extended positions or
+ * names its sources explicitly. The firmware's feature builder
+ * (main.cpp) resolves the sources against the sensor frame per cycle.
+ */
+
+#ifndef MODEL_META_H
+#define MODEL_META_H
+
+#include <stdint.h>
+
+/** @brief Upper bound on per-model features (today's models use 3). */
+#define QDNN_META_MAX_FEATURES 6
+
+/**
+ * @brief Where a feature's deci-unit value is drawn from.
+ *
+ * All sources are O(1) per cycle: the trend values fall out of the
+ * sensor history rings' running sums, the time value out of the wall
+ * clock the shell sets.
+ */
+enum QdnnFeatureSource {
+    QDNN_FEAT_BY_INDEX   = 0,  ///< positional convention (see file header)
+    QDNN_FEAT_TEMP       = 1,  ///< air temperature, 0.1 C
+    QDNN_FEAT_HUMID      = 2,  ///< air humidity, 0.1 %RH
+    QDNN_FEAT_SOIL       = 3,  ///< per-zone soil moisture, 0.1 %
+    QDNN_FEAT_HOUR       = 4,  ///< hour of day, 0.1 h (0 until time is set)
+    QDNN_FEAT_SOIL_SLOPE = 5,  ///< per-zone soil slope, 0.1 % per history window
+};
+
+/** @brief One input feature's normalization and expected range. */
+struct QdnnFeatureMeta {
+    int16_t offset10;  ///< subtracted in deci-units before scaling
+    float scale;       ///< multiplier on top of the 0.1 unit conversion
+    int16_t min10;     ///< training-distribution range, deci-units
+    int16_t max10;
+    uint8_t source;    ///< QdnnFeatureSource; 0 in pre-field exports
+};
+
+/** @brief Upper bound on embedded golden vectors per model. */
+#define QDNN_META_MAX_GOLDEN 4
+
+/**
+ * @brief One golden self-test vector: a training input pinned to the
+ *        level the exported model decided for it.
+ *
+ * The training export picks high-margin points (the decision must
+ * survive quantization and any accepted retrain), so a live model that
+ * answers one of these differently has degraded, not drifted.
+ */
+struct QdnnGoldenVector {
+    int16_t in10[QDNN_META_MAX_FEATURES];  ///< deci-unit input row
+    int8_t expect_level;                   ///< argmax the export produced
+};
+
+/** @brief Metadata block generated beside each model array. */
+struct QdnnModelMeta {
+    uint8_t input_count;
+    QdnnFeatureMeta feature[QDNN_META_MAX_FEATURES];
+    // Appended fields: existing exports' initializers predate them and
+    // aggregate-init zero-fills - golden_count 0 keeps the probe inert.
+    uint8_t golden_count;
+    QdnnGoldenVector golden[QDNN_META_MAX_GOLDEN];
+};
+
+#endif
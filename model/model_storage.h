@@ -0,0 +1,19 @@
+/**
+ * @file model_storage.h
+ *
+ * @brief Flash placement attributes for the QDNN model flatbuffers
+ *
+ * TFLM dereferences the flatbuffer in place, so the arrays must be at
+ * least 8-byte aligned; 16 bytes keeps whole XIP cache lines clean.
+ * The dedicated .flashdata.qdnn_models section (picked up by the SDK
+ * linker script's .flashdata* wildcard) keeps both models contiguous
+ * in flash and away from hot code, reducing XIP cache thrash during
+ * invoke.
+ */
+
+#ifndef MODEL_STORAGE_H
+#define MODEL_STORAGE_H
+
+#define QDNN_MODEL_STORAGE __attribute__((aligned(16), section(".flashdata.qdnn_models")))
+
+#endif
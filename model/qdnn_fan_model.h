@@ -1,14 +1,33 @@
 #ifndef QDNN_FAN_MODEL_H
 #define QDNN_FAN_MODEL_H
 
+#include "model_meta.h"
+#include "model_storage.h"
+
 // Auto-generated TensorFlow Lite model
 // Model name: qdnn_fan_model_int8.tflite
 // Total bytes: 19968
 
-const unsigned char qdnn_fan_model[] = {
+const unsigned char QDNN_MODEL_STORAGE qdnn_fan_model[] = {
 0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xc4, 0x2f, 0x00, 0x00, 0xd4, 0x2f, 0x00, 0x00, 0x94, 0x4d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0xd0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x11, 0x00, 0x00, 0x00, 0xd4, 0x2e, 0x00, 0x00, 0xcc, 0x2e, 0x00, 0x00, 0xac, 0x2e, 0x00, 0x00, 0x1c, 0x2e, 0x00, 0x00, 0x8c, 0x2d, 0x00, 0x00, 0x7c, 0x25, 0x00, 0x00, 0x6c, 0x24, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xda, 0xd0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0x71, 0xe5, 0x20, 0xd4, 0x52, 0xd8, 0x47, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x32, 0x30, 0x2e, 0x30, 0x00, 0x00, 0x46, 0xd1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xd1, 0xff, 0xff, 0x34, 0xd1, 0xff, 0xff, 0x38, 0xd1, 0xff, 0xff, 0x3c, 0xd1, 0xff, 0xff, 0x40, 0xd1, 0xff, 0xff, 0x76, 0xd1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x81, 0x33, 0xee, 0x81, 0xf1, 0x2e, 0x7f, 0xf1, 0xbe, 0x7f, 0x93, 0xae, 0x7f, 0xda, 0xcc, 0x2a, 0x81, 0x4c, 0x28, 0x3c, 0x81, 0x94, 0xc4, 0x81, 0x7f, 0xfe, 0xec, 0x3c, 0x8a, 0x81, 0x81, 0x28, 0xfd, 0xa8, 0xa8, 0x81, 0x7f, 0xbc, 0x12, 0x96, 0x81, 0xa9, 0x81, 0x33, 0x04, 0x4d, 0x31, 0x81, 0x81, 0x34, 0xff, 0x81, 0x8f, 0xa8, 0x81, 0x23, 0x06, 0x87, 0x7f, 0x81, 0xe0, 0x7f, 0xd6, 0x7f, 0xde, 0xff, 0x7f, 0xda, 0x01, 0x7f, 0xd9, 0xf1, 0x81, 0x01, 0x0d, 0x58, 0x38, 0x81, 0x05, 0x81, 0xf2, 0x81, 0xeb, 0xb9, 0x2b, 0x81, 0x43, 0xb7, 0xb6, 0x81, 0xcc, 0x81, 0x34, 0x81, 0x4b, 0xd2, 0x95, 0x81, 0x3f, 0xbf, 0x18, 0x81, 0x81, 0x1b, 0x0e, 0x81, 0x15, 0x22, 0x81, 0x23, 0x14, 0x41, 0x81, 0x1d, 0x7f, 0xb5, 0x18, 0x55, 0xcc, 0x81, 0x7f, 0x26, 0xb8, 0x81, 0x23, 0x05, 0x7f, 0xcc, 0xb7, 0x57, 0x81, 0x40, 0x35, 0xc3, 0x81, 0x35, 0x81, 0x84, 0x1a, 0x26, 0x81, 0x81, 0xfd, 0x3a, 0xb5, 0x6c, 0x81, 0x9d, 0x81, 0x92, 0xcd, 0xbd, 0x81, 0x81, 0xee, 0x50, 0x81, 0x04, 0x43, 0x81, 0x28, 0x1a, 0x17, 0xef, 0x81, 0x7f, 0xdb, 0xf9, 0xd0, 0x66, 0x81, 0x60, 0x81, 0xcc, 0x7f, 0x29, 0xc9, 0x81, 0x2f, 0xf2, 0xb9, 0xbd, 0x81, 0x81, 0x2c, 0x10, 0x7f, 0xd3, 0xfb, 0x81, 0xc8, 0x85, 0x81, 0xff, 0x8a, 0x96, 0x81, 0xba, 0x77, 0x37, 0x81, 0x7f, 0xe6, 0xfa, 0x81, 0x06, 0x1d, 0xf4, 0x81, 0xfe, 0x32, 0x81, 0xf8, 0x81, 0x36, 0x01, 0xec, 0x5e, 0x81, 0x7f, 0xf5, 0xa8, 0xcb, 0x63, 0x81, 0x58, 0x18, 0x81, 0x7f, 0xa4, 0xb9, 0x81, 0xeb, 0x50, 0x84, 0xc6, 0x81, 0x81, 0xf1, 0x30, 0x0f, 0xf1, 0x81, 0x81, 0xb4, 0xd5, 0xef, 0x5c, 0x81, 0x81, 0x94, 0xec, 0x81, 0x5b, 0xbf, 0x81, 0x94, 0xcf, 0xe3, 0x81, 0x62, 0x7d, 0xa5, 0x81, 0x81, 0x51, 0x81, 0x17, 0x81, 0x66, 0xd1, 0x81, 0x6d, 0x81, 0x19, 0x00, 0xd3, 0xc2, 0x81, 0x81, 0xea, 0xbd, 0x79, 0xda, 0x81, 0xf5, 0x81, 0x32, 0x81, 0x00, 0x1b, 0xc6, 0x81, 0x9f, 0x7f, 0xec, 0xe6, 0x81, 0xce, 0x70, 0x7f, 0x83, 0xf7, 0x42, 0x42, 0x81, 0x7f, 0x09, 0xb2, 0x52, 0x81, 0xf1, 0x58, 0x81, 0x37, 0xfc, 0x81, 0x39, 0x7f, 0x97, 0x1b, 0x7f, 0x94, 0xf0, 0x81, 0x33, 0x08, 0x81, 0x33, 0x06, 0xb2, 0x87, 0x7f, 0x81, 0x8f, 0x60, 0x81, 0x3b, 0xd7, 0x7f, 0xde, 0xf0, 0x7f, 0xdd, 0x82, 0x7f, 0xe5, 0xfd, 0x81, 0xfb, 0x41, 0xd9, 0x6d, 0x81, 0xe8, 0x39, 0x7f, 0x1b, 0x81, 0x19, 0x81, 0x8e, 0xa5, 0x81, 0x06, 0x39, 0x2e, 0x5e, 0x81, 0xa7, 0x81, 0x57, 0x81, 0xe1, 0xec, 0xf4, 0x52, 0x81, 0x81, 0x31, 0x04, 0xfe, 0x3e, 0x81, 0x02, 0xd3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x63, 0xfd, 0xff, 0xff, 0x59, 0xfe, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xeb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xfd, 0xff, 0xff, 0x7b, 0x02, 0x00, 0x00, 0x29, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x06, 0x04, 0x00, 0x00, 0x78, 0xcf, 0xff, 0xff, 0x4f, 0xf9, 0xff, 0xff, 0xe2, 0xfb, 0xff, 0xff, 0xa9, 0xfe, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x6a, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xfa, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xfc, 0xff, 0xff, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xfc, 0xff, 0xff, 0xcb, 0xfb, 0xff, 0xff, 0xd6, 0xc6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfc, 0xff, 0xff, 0x1a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xea, 0xff, 0xff, 0x9b, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x41, 0xfc, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0xcc, 0xf4, 0xff, 0xff, 0x95, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xfe, 0xff, 0xff, 0x37, 0x03, 0x00, 0x00, 0xa9, 0xff, 0xff, 0xff, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x78, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0xff, 0xc3, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xfc, 0xff, 0xff, 0x3e, 0xfc, 0xff, 0xff, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf6, 0xff, 0xff, 0x3a, 0xfc, 0xff, 0xff, 0x6c, 0x04, 0x00, 0x00, 0xc7, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf8, 0xff, 0xff, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0x58, 0xfe, 0xff, 0xff, 0xa3, 0xfe, 0xff, 0xff, 0x0e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xd4, 0xb0, 0x9a, 0xea, 0xda, 0xce, 0xd1, 0x2a, 0xed, 0xc4, 0xaf, 0xe9, 0xdb, 0xfc, 0xd4, 0x13, 0x81, 0xf7, 0xe2, 0x04, 0x0a, 0xbc, 0xf2, 0x19, 0x33, 0xf7, 0xbf, 0xee, 0xc8, 0x43, 0x0e, 0xd8, 0x28, 0xf7, 0x31, 0x17, 0x10, 0xe3, 0x01, 0xca, 0xa0, 0xd7, 0xd2, 0xb3, 0x2d, 0xd8, 0xff, 0x11, 0x40, 0xb8, 0x17, 0xe4, 0x01, 0xfe, 0xcd, 0x99, 0xef, 0x1b, 0xaa, 0xcb, 0x04, 0x8f, 0xf1, 0xc8, 0x35, 0xc3, 0xe2, 0xf9, 0x37, 0xd7, 0xc2, 0xe1, 0x09, 0xf1, 0xe0, 0xbf, 0xf2, 0xd8, 0xc7, 0xfb, 0x03, 0x1b, 0xb5, 0xef, 0xdc, 0xed, 0xc8, 0xb9, 0xc4, 0x41, 0xbc, 0xf8, 0x2c, 0xbc, 0xad, 0xe6, 0xcb, 0x11, 0xc8, 0x92, 0x20, 0x1b, 0xa1, 0x20, 0xc9, 0xd1, 0xa8, 0x0f, 0xed, 0x1f, 0xa9, 0x41, 0xf8, 0xd4, 0xeb, 0xee, 0xd0, 0xf0, 0x21, 0xd2, 0x2d, 0xa6, 0x07, 0x22, 0x45, 0x94, 0xd0, 0x37, 0x24, 0x27, 0x96, 0x08, 0x1a, 0x43, 0xa8, 0xc3, 0x8f, 0xcb, 0x49, 0x1a, 0x9d, 0xec, 0xa5, 0x3e, 0xa6, 0x56, 0xc4, 0xff, 0xe4, 0xf2, 0xde, 0xd3, 0xaa, 0x06, 0x1e, 0x37, 0x0b, 0x19, 0xf5, 0xe6, 0x53, 0xff, 0x12, 0xb7, 0xb0, 0x1f, 0x41, 0xca, 0xb1, 0x39, 0x57, 0xd8, 0x09, 0x2a, 0xc8, 0xa1, 0xb9, 0xb8, 0xec, 0xbe, 0xe1, 0xa2, 0xe5, 0xfc, 0x32, 0xd2, 0xd9, 0xac, 0xd8, 0xf1, 0xc8, 0x16, 0x24, 0x3d, 0xd3, 0xf3, 0xe4, 0xcf, 0x4b, 0xe0, 0xf8, 0x1e, 0xec, 0xfe, 0xef, 0xee, 0xec, 0xf9, 0xb6, 0xad, 0xaf, 0xfd, 0x00, 0xb0, 0xe8, 0x1b, 0xb2, 0x4c, 0x4d, 0x34, 0x0f, 0x15, 0xe9, 0x35, 0xb0, 0xc4, 0xe0, 0xde, 0xc3, 0x81, 0xf6, 0x51, 0x07, 0x0e, 0x15, 0xd6, 0xf1, 0x3d, 0xa5, 0x18, 0xfd, 0xd0, 0xc6, 0x20, 0xfd, 0xd8, 0x05, 0xda, 0x05, 0x19, 0x1c, 0xfd, 0xf9, 0xd6, 0xfa, 0xe9, 0xfc, 0x0f, 0xff, 0xfb, 0x1a, 0xe9, 0x1a, 0x14, 0x1f, 0xe4, 0xe6, 0x1a, 0x1d, 0xfd, 0xb3, 0x02, 0x96, 0xe7, 0xdc, 0xf5, 0x02, 0x10, 0xf4, 0x31, 0xe3, 0x05, 0xf2, 0x12, 0xf9, 0x0f, 0xf1, 0xd8, 0xee, 0xf9, 0x0f, 0xfe, 0xf8, 0xf0, 0x1e, 0x09, 0xf6, 0x02, 0xe4, 0x0e, 0x09, 0x19, 0xf1, 0x01, 0xf3, 0xf8, 0x1c, 0x01, 0x00, 0x01, 0xfd, 0x1f, 0xfd, 0xeb, 0x01, 0xf7, 0x16, 0xee, 0x5a, 0x09, 0xf3, 0x18, 0x03, 0x1c, 0x07, 0x18, 0xec, 0x81, 0xfc, 0xf3, 0x09, 0xf1, 0xe3, 0x0d, 0xfb, 0xfc, 0x14, 0xf3, 0x05, 0xfb, 0xe2, 0x1d, 0xe8, 0xfb, 0x08, 0x29, 0x16, 0xf2, 0xf7, 0x18, 0xf0, 0xee, 0x0b, 0x19, 0x01, 0x0c, 0x05, 0x0c, 0x01, 0xe6, 0xeb, 0xf1, 0x2a, 0xfd, 0xeb, 0xe0, 0x10, 0x10, 0x0a, 0x2e, 0x19, 0x1a, 0x04, 0xff, 0x01, 0xfb, 0xff, 0xfc, 0x07, 0xf4, 0xf5, 0xfb, 0xce, 0xf2, 0x07, 0xf2, 0x29, 0xe1, 0x25, 0x24, 0xf9, 0x0b, 0x02, 0xf0, 0xfd, 0xe6, 0x24, 0x15, 0xc4, 0xef, 0xb1, 0x03, 0xf9, 0x0e, 0xef, 0x31, 0x3c, 0x26, 0x1b, 0x0c, 0x25, 0xe8, 0x1e, 0x1c, 0xdd, 0xda, 0x09, 0xe1, 0xef, 0xfd, 0xf3, 0x22, 0x24, 0xe1, 0xf6, 0xfc, 0x1a, 0x13, 0xfd, 0x1c, 0xf2, 0xf3, 0xeb, 0x13, 0x1e, 0xfe, 0x04, 0xf1, 0xe6, 0x16, 0xef, 0xed, 0xeb, 0x06, 0xe3, 0xe4, 0x7f, 0x0c, 0xf5, 0xf0, 0x1d, 0x10, 0x09, 0xf7, 0xf9, 0xb1, 0x04, 0xf8, 0xe9, 0xf8, 0xdd, 0xfc, 0xf7, 0xfb, 0xef, 0xe2, 0x14, 0xeb, 0xdd, 0x02, 0xe3, 0xde, 0x1e, 0x27, 0xf8, 0xee, 0x04, 0xec, 0x20, 0xdd, 0x02, 0xf3, 0x1d, 0xf9, 0x06, 0x00, 0xf7, 0x0f, 0x13, 0xf8, 0x37, 0x24, 0xdc, 0xcc, 0x22, 0xea, 0xe8, 0x3a, 0xdb, 0x1f, 0xfd, 0xfd, 0xfd, 0xec, 0xf8, 0xf7, 0xfd, 0x21, 0x15, 0x1b, 0xdb, 0xe3, 0x14, 0x82, 0x1d, 0x13, 0xf9, 0xea, 0x15, 0x20, 0x00, 0x0a, 0x1a, 0x08, 0xbd, 0x01, 0x03, 0x07, 0x0e, 0x04, 0x17, 0x1c, 0x16, 0xdc, 0xe3, 0xdf, 0xe8, 0x19, 0x14, 0x03, 0xfb, 0x1c, 0xf7, 0x28, 0xe9, 0x12, 0x05, 0xe8, 0xf8, 0x21, 0xb3, 0x13, 0x11, 0x0a, 0x10, 0xdf, 0x11, 0xe8, 0x1b, 0xc5, 0x2a, 0x13, 0xea, 0xbc, 0xf5, 0xd7, 0x1b, 0xf2, 0xfd, 0xff, 0x1c, 0x06, 0x16, 0x0b, 0x81, 0x08, 0xe0, 0xfb, 0x00, 0xea, 0x06, 0xf0, 0x1c, 0x0f, 0x30, 0x21, 0x28, 0x07, 0xfe, 0xc4, 0xf5, 0x9c, 0x05, 0xec, 0x48, 0xdf, 0x1b, 0x14, 0x20, 0xfe, 0x22, 0xbf, 0xde, 0xe7, 0xea, 0xf8, 0x0d, 0x09, 0xe9, 0x1d, 0xf9, 0xbc, 0x13, 0x34, 0xff, 0x05, 0x06, 0xec, 0xfe, 0xf9, 0x12, 0x10, 0x0a, 0xe4, 0x1f, 0xb8, 0x14, 0xdd, 0xda, 0x0d, 0xde, 0x1f, 0x1c, 0xe9, 0x1a, 0xfe, 0x1c, 0x30, 0x14, 0xea, 0x05, 0xb0, 0x2a, 0xf9, 0x2a, 0x10, 0x30, 0xe6, 0xfd, 0xf4, 0xf8, 0x27, 0x68, 0x28, 0xe9, 0x41, 0xec, 0xea, 0xd0, 0x2e, 0xfd, 0x03, 0x87, 0x0f, 0x1d, 0x47, 0x1b, 0xeb, 0xf7, 0xe3, 0x18, 0x19, 0x2d, 0x0d, 0x00, 0x96, 0xf5, 0xfe, 0xd4, 0xf7, 0x08, 0xf2, 0xe5, 0xec, 0x21, 0xec, 0xdc, 0xb0, 0x39, 0xf4, 0x2c, 0xc7, 0xa9, 0xc6, 0x0b, 0x1a, 0x37, 0xf6, 0x09, 0x13, 0xd4, 0xeb, 0x2d, 0x17, 0x16, 0xf5, 0x2f, 0xfa, 0xe2, 0x25, 0x2d, 0xfd, 0x7f, 0x14, 0x5a, 0xe0, 0x2e, 0xa2, 0xfb, 0xf1, 0xe5, 0x27, 0x5e, 0x06, 0x22, 0x0b, 0x15, 0xef, 0x2f, 0x1c, 0xc5, 0x22, 0x1b, 0x2f, 0x1e, 0x17, 0x0b, 0x16, 0x04, 0xb0, 0xd6, 0x14, 0x0d, 0x0c, 0x0e, 0x20, 0x4b, 0x17, 0xd1, 0xcf, 0xfe, 0xe8, 0xe3, 0x1b, 0x1f, 0x28, 0x99, 0x44, 0xdd, 0x23, 0xf5, 0xba, 0x00, 0xd2, 0xfa, 0x0b, 0xed, 0xd5, 0xfd, 0xb7, 0x01, 0xee, 0x02, 0x1a, 0xd5, 0x0f, 0x09, 0xe5, 0xef, 0x04, 0x0a, 0x05, 0xf1, 0xcf, 0x02, 0xec, 0xe8, 0x94, 0xff, 0x08, 0x10, 0x0d, 0xe7, 0xd3, 0x11, 0xe8, 0xf4, 0xea, 0xf0, 0xb5, 0x00, 0xe7, 0x01, 0xf2, 0xf0, 0x0c, 0xe7, 0xe4, 0x05, 0xf5, 0x0a, 0xf6, 0x19, 0x0d, 0xe4, 0xdb, 0xde, 0xeb, 0x18, 0xea, 0x05, 0xfd, 0xeb, 0x09, 0xca, 0x1c, 0x0c, 0xfb, 0xff, 0xfb, 0x48, 0x0e, 0xe3, 0xfb, 0xfb, 0x13, 0x10, 0x05, 0xfe, 0xfa, 0x81, 0xec, 0x8e, 0xe4, 0xf4, 0xee, 0x1e, 0xc7, 0x03, 0x1d, 0x86, 0xf6, 0xf5, 0x1b, 0x05, 0x05, 0x17, 0xf0, 0xfc, 0x0a, 0x13, 0x09, 0x1b, 0xfb, 0x06, 0x11, 0xef, 0xed, 0xf5, 0xf5, 0x12, 0x12, 0x0d, 0xfa, 0xe6, 0x07, 0xf8, 0xfa, 0xc5, 0x09, 0x05, 0x26, 0x1e, 0xff, 0xf0, 0xde, 0xfc, 0xff, 0xf3, 0xf5, 0x01, 0x11, 0xe4, 0x11, 0xfb, 0xf4, 0x0d, 0xff, 0x1d, 0x28, 0xe0, 0x08, 0xfb, 0xdb, 0x2c, 0xe7, 0xf4, 0x1e, 0xf6, 0x0a, 0xa6, 0x08, 0x81, 0x15, 0xbf, 0x09, 0x19, 0xd4, 0x91, 0x3d, 0x03, 0x0e, 0xfe, 0xfe, 0xee, 0xf4, 0x18, 0xce, 0xf9, 0xef, 0xfd, 0x08, 0xe2, 0x25, 0x2f, 0x20, 0x23, 0xf7, 0xd4, 0x09, 0x0f, 0x2b, 0xf5, 0xe7, 0x14, 0xe5, 0x1c, 0xde, 0x0d, 0x08, 0xfe, 0xfa, 0x0d, 0xdb, 0xf8, 0x17, 0x0a, 0xd8, 0x33, 0x0d, 0xef, 0xff, 0x0d, 0x1c, 0xe6, 0xd4, 0x1c, 0x89, 0x18, 0x1e, 0xf9, 0x22, 0xd8, 0xf0, 0xe3, 0x25, 0xeb, 0x0e, 0x14, 0x2a, 0xdd, 0x04, 0x00, 0x04, 0xe5, 0xe3, 0xe3, 0x05, 0xe6, 0xdc, 0xee, 0x21, 0x10, 0xe6, 0x0c, 0xca, 0xd9, 0xf4, 0x20, 0xf2, 0x28, 0x08, 0x1b, 0xfd, 0xd9, 0xd4, 0x29, 0x2b, 0x04, 0x50, 0x00, 0x30, 0xb2, 0xca, 0x21, 0xd5, 0x19, 0x10, 0xf9, 0xf7, 0xf5, 0xe6, 0xa0, 0xe2, 0xfa, 0x27, 0xf6, 0xfd, 0x0c, 0xe7, 0x07, 0x01, 0xad, 0x02, 0x00, 0x02, 0xe7, 0x0a, 0x07, 0x17, 0x10, 0x14, 0x1b, 0x18, 0xdd, 0x9f, 0xa2, 0xc2, 0xfd, 0x11, 0xe7, 0x12, 0xef, 0x03, 0xeb, 0x19, 0x09, 0x09, 0xf6, 0x04, 0x04, 0x1a, 0xec, 0xea, 0xf8, 0xfc, 0x15, 0xde, 0xf8, 0xfb, 0x06, 0x05, 0x13, 0xe8, 0x17, 0x0a, 0xf7, 0xef, 0xec, 0xcb, 0x0f, 0xf6, 0xde, 0xfb, 0x17, 0x02, 0x93, 0x04, 0x00, 0x0e, 0xf7, 0x81, 0xe3, 0xe6, 0x0e, 0x0e, 0x20, 0xf8, 0x03, 0xf7, 0x00, 0xf8, 0x0c, 0x1c, 0xf4, 0x08, 0x26, 0x17, 0x07, 0xe7, 0x18, 0x09, 0xea, 0x0f, 0x10, 0x15, 0xeb, 0x18, 0x01, 0x18, 0xfa, 0xe9, 0x00, 0x06, 0x04, 0xf5, 0xe6, 0xff, 0xff, 0xfc, 0xfb, 0xfe, 0x08, 0x0b, 0x08, 0xfd, 0xf9, 0x9b, 0xf5, 0x9f, 0x0d, 0x0b, 0xfa, 0xf7, 0x18, 0x01, 0x0c, 0xef, 0xf5, 0x06, 0x0d, 0xf3, 0xfb, 0xc9, 0x1e, 0x15, 0x03, 0x2a, 0x11, 0xf5, 0xf6, 0xd4, 0xca, 0xe2, 0xe0, 0xd8, 0x9d, 0x32, 0xa3, 0x09, 0xab, 0x20, 0x0f, 0x02, 0x47, 0x04, 0xe2, 0x4a, 0x0c, 0xd7, 0x1d, 0x1f, 0x06, 0xf3, 0xfd, 0x21, 0xe9, 0xa2, 0xad, 0xd9, 0xe3, 0xf1, 0xef, 0xdd, 0xf5, 0x07, 0x1a, 0xeb, 0x1a, 0x81, 0x12, 0x0d, 0x22, 0xc3, 0xcc, 0xf1, 0xfb, 0x18, 0x1a, 0x02, 0x02, 0xfa, 0xd9, 0xb3, 0x75, 0x19, 0x1b, 0x2a, 0x16, 0x0d, 0x0d, 0x04, 0xd5, 0xb5, 0x3f, 0x0f, 0x31, 0xf3, 0x17, 0xaf, 0x29, 0xb7, 0xda, 0x2c, 0x3c, 0xfc, 0xf8, 0xe1, 0xdc, 0xfe, 0x2b, 0x18, 0x0f, 0x0f, 0xe4, 0xef, 0x27, 0xe5, 0xfb, 0x1c, 0xf9, 0xca, 0xf3, 0x1b, 0x0c, 0xf6, 0x27, 0xfe, 0xf5, 0xdf, 0xba, 0xbc, 0x2e, 0x1f, 0xf2, 0xf8, 0x20, 0xd4, 0x9d, 0x32, 0x03, 0xd7, 0x17, 0xd9, 0x13, 0xd4, 0xd4, 0x09, 0x85, 0x1f, 0x18, 0xb9, 0xfc, 0xf0, 0x19, 0xf4, 0xfe, 0x0f, 0xfe, 0x0b, 0x00, 0xfd, 0xef, 0xfa, 0x0e, 0xfd, 0x04, 0xf1, 0x20, 0x0c, 0x07, 0xdb, 0xe2, 0xa4, 0x0a, 0x1f, 0xf9, 0x0d, 0xe6, 0xf7, 0x09, 0x08, 0xf5, 0xee, 0x10, 0xfa, 0x09, 0xf1, 0xbc, 0xea, 0x09, 0x02, 0xfc, 0xda, 0x1a, 0xfa, 0xed, 0xc6, 0x13, 0xe9, 0x12, 0xdc, 0x09, 0xed, 0x14, 0xe9, 0xff, 0xf1, 0x0e, 0xfb, 0x14, 0x00, 0x81, 0x03, 0x14, 0xf7, 0x01, 0xde, 0x12, 0x0f, 0x0f, 0xfa, 0x09, 0x16, 0x0b, 0x00, 0x07, 0xce, 0xe5, 0xd8, 0xec, 0x1c, 0x0a, 0x06, 0x10, 0x0c, 0x0e, 0x09, 0x19, 0xf8, 0xe9, 0x06, 0xf1, 0x0b, 0xfd, 0xe7, 0xff, 0xf3, 0x06, 0xbf, 0xf3, 0xf4, 0xfe, 0xeb, 0x0d, 0x07, 0xce, 0x04, 0x09, 0x1b, 0xfe, 0x15, 0x10, 0xa7, 0x0c, 0xe9, 0xe3, 0x04, 0xec, 0xea, 0x11, 0xe3, 0x03, 0xe5, 0x0e, 0xfe, 0x0c, 0x10, 0xbd, 0x02, 0x25, 0x3b, 0xfb, 0x21, 0x95, 0xbc, 0xa7, 0xc6, 0x10, 0xc3, 0xd7, 0xdc, 0x88, 0x42, 0x47, 0x09, 0x21, 0x00, 0xef, 0x21, 0x86, 0x35, 0xbc, 0xfb, 0xf6, 0xc0, 0xd9, 0xda, 0x38, 0x47, 0xcf, 0xf6, 0xca, 0xd3, 0x04, 0x2e, 0xb0, 0x1f, 0xc7, 0x18, 0xe9, 0xb5, 0xfe, 0xc3, 0x45, 0x07, 0xcd, 0xf7, 0xdc, 0xeb, 0xc9, 0x0c, 0x3e, 0x8f, 0xdf, 0xfb, 0x93, 0x33, 0x43, 0xa1, 0x94, 0xe0, 0xe6, 0x16, 0x30, 0x94, 0xb6, 0xd8, 0x0d, 0xc9, 0xf2, 0xf4, 0xb3, 0x12, 0x2b, 0xc5, 0xef, 0x9d, 0xdc, 0xed, 0x2a, 0x18, 0xe1, 0x2b, 0x20, 0xcc, 0x36, 0xdf, 0xeb, 0x20, 0x28, 0xed, 0xbe, 0x29, 0xd4, 0x02, 0x07, 0xf0, 0x2b, 0xdc, 0xbf, 0x16, 0xbe, 0x08, 0xec, 0x10, 0xdc, 0x81, 0xfd, 0xe8, 0xb2, 0xa6, 0x40, 0xdb, 0x25, 0x05, 0x22, 0xca, 0x21, 0x1e, 0x2c, 0x43, 0xff, 0x1b, 0x1c, 0x29, 0xde, 0xf4, 0xe0, 0x00, 0xe1, 0x08, 0xb6, 0xd7, 0x2a, 0xe5, 0x16, 0x0d, 0xb4, 0xeb, 0x4f, 0xcb, 0x3b, 0xe3, 0x1f, 0x22, 0x3b, 0xfd, 0xe7, 0xf4, 0x2b, 0xd4, 0x04, 0x1a, 0x1e, 0x01, 0x27, 0xc2, 0x2b, 0x0f, 0x01, 0x02, 0xfc, 0x0c, 0xb6, 0xdf, 0x04, 0x16, 0xf7, 0x18, 0x18, 0x11, 0x29, 0xf4, 0xd1, 0xed, 0xfb, 0xf9, 0xdf, 0x24, 0x0d, 0xe5, 0xfd, 0x2c, 0x17, 0x00, 0x04, 0x25, 0x81, 0xf3, 0xee, 0xe6, 0xb4, 0x07, 0xe9, 0x27, 0xe3, 0x26, 0x0e, 0xe3, 0x1b, 0x1e, 0x2a, 0xdc, 0xff, 0xd6, 0x20, 0xf2, 0x2a, 0xe0, 0x08, 0x01, 0x1f, 0x23, 0xe8, 0xda, 0x1b, 0xf8, 0xf7, 0xec, 0x1d, 0xd3, 0x18, 0xe5, 0xdd, 0x0c, 0x03, 0xb4, 0xdc, 0xe5, 0xe8, 0x22, 0xd7, 0xef, 0x2a, 0x11, 0xde, 0x1a, 0x2a, 0xaf, 0xf5, 0x09, 0x15, 0x0c, 0x23, 0xf7, 0x1d, 0x0a, 0xcf, 0x2d, 0x17, 0xd9, 0x1b, 0xde, 0xc1, 0xb7, 0x1b, 0x04, 0xee, 0xe4, 0x24, 0x0c, 0xfd, 0x02, 0xbf, 0x03, 0xf2, 0xfe, 0xb4, 0x3e, 0xa0, 0xec, 0xce, 0x5e, 0x12, 0xca, 0x30, 0x0e, 0x01, 0x26, 0xd0, 0xc6, 0x2d, 0x1d, 0x0e, 0xe1, 0xf2, 0x19, 0xe1, 0xae, 0xb9, 0xf2, 0x2b, 0x35, 0x2c, 0xdd, 0x25, 0x08, 0xc7, 0x24, 0xc7, 0x81, 0x4d, 0xd0, 0x0f, 0xaa, 0xef, 0x11, 0xc6, 0x25, 0x17, 0x35, 0x17, 0x0a, 0x14, 0xd2, 0x7d, 0x0e, 0x36, 0xf9, 0x1f, 0xd4, 0x06, 0xc5, 0x1f, 0xb0, 0x27, 0x01, 0x04, 0xe6, 0xca, 0xaa, 0x2c, 0xf8, 0xfc, 0xe6, 0x30, 0xcd, 0x1b, 0xe3, 0xf6, 0xef, 0xd6, 0x48, 0x2c, 0x10, 0x04, 0x02, 0x10, 0x2b, 0xb8, 0x3a, 0x31, 0xd4, 0xd3, 0x0b, 0xfe, 0xfa, 0x2d, 0xf4, 0x31, 0x1a, 0x96, 0xc2, 0x22, 0xcf, 0xf0, 0x57, 0x25, 0xe7, 0x93, 0x2c, 0x35, 0x01, 0x0a, 0xdd, 0x08, 0x0f, 0xf9, 0x0b, 0xb9, 0x0b, 0x16, 0x02, 0x19, 0xe6, 0x1d, 0xd0, 0x06, 0x28, 0x29, 0xd5, 0xff, 0xdd, 0xf2, 0x15, 0x05, 0x18, 0x00, 0xeb, 0x33, 0xbc, 0x25, 0xf6, 0x0b, 0xb8, 0xd8, 0xba, 0xeb, 0xda, 0xfb, 0x01, 0x24, 0x42, 0x06, 0x1d, 0x10, 0x0d, 0xb9, 0x26, 0x0c, 0x0d, 0x29, 0x1c, 0x15, 0xf7, 0x28, 0x04, 0x2c, 0xe6, 0xd5, 0xcd, 0xf8, 0xe4, 0x7f, 0xfc, 0xfa, 0x0b, 0x17, 0x0f, 0x03, 0xe5, 0x2d, 0xcf, 0xec, 0xd8, 0x17, 0xcc, 0x18, 0xd9, 0x08, 0x17, 0xe6, 0x0f, 0x02, 0xcf, 0x16, 0x06, 0xda, 0xf0, 0xe8, 0x13, 0xdc, 0x26, 0xd5, 0x1e, 0xec, 0x01, 0xf3, 0x23, 0x11, 0xee, 0xc6, 0xff, 0x09, 0x2d, 0xfe, 0x11, 0x1f, 0x15, 0xf7, 0xd9, 0xfe, 0x0b, 0xe7, 0x12, 0xd6, 0x2a, 0x25, 0x1d, 0xe5, 0xdc, 0xfc, 0x1d, 0xef, 0xdd, 0x1c, 0xea, 0xf8, 0xdf, 0x23, 0x0f, 0x17, 0xde, 0x14, 0x1f, 0xf1, 0x02, 0x04, 0xc7, 0x1e, 0xef, 0xc2, 0xfc, 0xe8, 0x17, 0xeb, 0x07, 0x26, 0x1a, 0x29, 0x15, 0x90, 0xfc, 0x29, 0xda, 0x35, 0xd9, 0x16, 0xbf, 0x03, 0x07, 0xe0, 0xd1, 0x20, 0x81, 0x12, 0x2c, 0x0a, 0x03, 0xe5, 0xec, 0xf7, 0x26, 0x17, 0x11, 0x08, 0x2c, 0x99, 0xfa, 0xf8, 0x36, 0x22, 0xe8, 0x22, 0xdf, 0x03, 0xfc, 0xfc, 0xf9, 0xdc, 0x14, 0x1a, 0x32, 0x0d, 0xf2, 0xf9, 0x00, 0x05, 0x07, 0x21, 0x19, 0x9f, 0x08, 0x23, 0xd5, 0xc4, 0x27, 0xfe, 0x0b, 0x2c, 0x47, 0xc3, 0xe1, 0xb9, 0xef, 0xee, 0x0a, 0xee, 0xda, 0xff, 0x07, 0xa8, 0xd9, 0xef, 0xf2, 0x26, 0x28, 0x0e, 0xef, 0xda, 0xef, 0xef, 0x04, 0x09, 0xf3, 0x24, 0x1b, 0xf7, 0xfd, 0x10, 0xee, 0x04, 0x13, 0xda, 0x09, 0x87, 0x09, 0x15, 0x10, 0xd8, 0xf6, 0x26, 0xc9, 0xee, 0x03, 0x05, 0xf7, 0x20, 0x0d, 0x11, 0x08, 0xf2, 0xfe, 0x27, 0xd6, 0x21, 0x23, 0xf2, 0xc4, 0x33, 0x21, 0xda, 0x10, 0x02, 0xfe, 0x03, 0xdd, 0xd9, 0xf5, 0xe2, 0x00, 0xaf, 0x20, 0xa8, 0x19, 0xe5, 0xe8, 0x28, 0xd9, 0xe8, 0xde, 0x24, 0x16, 0xec, 0x18, 0xf1, 0x1e, 0xe7, 0xe7, 0xdc, 0x12, 0xdd, 0xdf, 0xc9, 0xf3, 0x00, 0x0f, 0x26, 0xf4, 0x26, 0xfc, 0x0f, 0xf5, 0x23, 0xdb, 0xf1, 0xe6, 0x20, 0xe6, 0xfd, 0xf2, 0xe4, 0xfc, 0xe4, 0x16, 0xb9, 0x0c, 0xfb, 0xf3, 0x7f, 0xe6, 0x19, 0x26, 0x09, 0xfd, 0xe5, 0x27, 0x22, 0xa1, 0x19, 0x15, 0xd2, 0xfb, 0x18, 0xc8, 0xfd, 0xf6, 0x13, 0xe1, 0xf8, 0x06, 0xeb, 0xe4, 0x14, 0x11, 0x0a, 0x22, 0x23, 0x1b, 0xe3, 0xec, 0x08, 0xf7, 0x0d, 0x10, 0x08, 0xf5, 0xf0, 0x29, 0x03, 0xd9, 0xd6, 0x14, 0xd5, 0xe3, 0x10, 0xd4, 0xf6, 0xee, 0x1d, 0xec, 0xfa, 0x36, 0xcb, 0x07, 0x11, 0xf6, 0xf8, 0xf6, 0xe8, 0xe5, 0xfb, 0x06, 0xcf, 0xf8, 0x03, 0xf9, 0x0e, 0x16, 0xf4, 0xf1, 0x0b, 0x11, 0x01, 0x16, 0x01, 0x14, 0x06, 0x12, 0xe8, 0x05, 0xff, 0x12, 0xdc, 0xe0, 0x0e, 0x1f, 0x81, 0x0f, 0x04, 0x04, 0x05, 0x09, 0x0c, 0x14, 0x01, 0x00, 0x00, 0xee, 0xe0, 0xfb, 0x0d, 0xf0, 0x10, 0x06, 0x0c, 0x07, 0x0e, 0x03, 0x17, 0x03, 0xec, 0x01, 0xf8, 0xff, 0xee, 0x11, 0x0c, 0x12, 0x11, 0x1c, 0xf8, 0x10, 0x0e, 0xed, 0xf9, 0x0a, 0xfe, 0x15, 0xf6, 0xf7, 0xfd, 0x24, 0x08, 0x09, 0x02, 0xec, 0x03, 0xf5, 0xff, 0x15, 0x13, 0xfe, 0x0f, 0xf2, 0xf1, 0x13, 0x0b, 0xfa, 0xf4, 0x07, 0x11, 0x07, 0x0f, 0x09, 0xf8, 0x13, 0x00, 0x15, 0xf0, 0xf3, 0xf6, 0x00, 0x06, 0xf8, 0xfb, 0xfc, 0xfd, 0xea, 0xf3, 0x0c, 0xfb, 0x0a, 0xe5, 0xfa, 0xf5, 0x07, 0xf2, 0x1a, 0x00, 0x11, 0x06, 0xe6, 0x07, 0x0a, 0xf1, 0x09, 0x00, 0x02, 0x11, 0xf1, 0xff, 0x04, 0x04, 0xe8, 0xfb, 0x0d, 0x1c, 0x03, 0x28, 0xea, 0xe7, 0x09, 0xf9, 0x14, 0xe2, 0xec, 0xf8, 0x02, 0x11, 0x01, 0x07, 0x16, 0xf2, 0xa0, 0x81, 0xb9, 0xeb, 0x24, 0x1f, 0xed, 0xe1, 0x14, 0x06, 0x0a, 0x03, 0x03, 0xf8, 0xe5, 0x00, 0xe4, 0xf7, 0x0d, 0x09, 0x0a, 0x01, 0xe0, 0xed, 0x0b, 0x05, 0xad, 0x15, 0x03, 0x0e, 0x89, 0xe9, 0xc9, 0x08, 0xbc, 0x0e, 0x17, 0x02, 0xe2, 0x07, 0x05, 0x8d, 0xeb, 0x1e, 0x16, 0xee, 0xa2, 0x01, 0x0a, 0xe3, 0x0a, 0x18, 0x1d, 0x43, 0xff, 0x16, 0x98, 0x0b, 0x01, 0xf2, 0xf8, 0x1c, 0x01, 0x0b, 0xe5, 0xe9, 0xf7, 0xe3, 0x08, 0xe5, 0xe6, 0xe6, 0xfc, 0xe8, 0xec, 0x03, 0xed, 0xe7, 0xe0, 0x1f, 0x07, 0xf9, 0xe1, 0x0e, 0x1a, 0xdd, 0x1e, 0x09, 0xfe, 0x0d, 0x1c, 0xfd, 0xca, 0x02, 0xa8, 0x8d, 0x08, 0xa8, 0x12, 0xf3, 0xb0, 0xf2, 0x09, 0xfe, 0x03, 0x10, 0x15, 0x0d, 0xc9, 0x26, 0x22, 0x1c, 0x1a, 0xf9, 0xe1, 0xed, 0x18, 0xf9, 0xf0, 0xfd, 0xf4, 0xfa, 0xe4, 0x06, 0x16, 0xfe, 0xc0, 0xf8, 0x03, 0xff, 0x04, 0x0b, 0x0f, 0x16, 0x16, 0x01, 0x22, 0x0e, 0x1e, 0xec, 0xeb, 0xf4, 0xf5, 0xf7, 0xf6, 0xf0, 0xe3, 0x0f, 0x03, 0x04, 0xfb, 0x02, 0xf2, 0xde, 0xe9, 0xf7, 0xfc, 0x07, 0xf2, 0x03, 0xee, 0x13, 0x02, 0xde, 0xe2, 0x02, 0xf7, 0xfe, 0xf8, 0x4c, 0xdd, 0x21, 0xf2, 0xe2, 0x01, 0xf6, 0x14, 0xed, 0xed, 0xe1, 0x07, 0xe4, 0xe3, 0xed, 0xf5, 0xf6, 0xc0, 0x20, 0xe7, 0xe6, 0x1c, 0x0d, 0x05, 0xe7, 0xfd, 0xe4, 0xb0, 0xf2, 0xdf, 0x17, 0xee, 0xf9, 0x09, 0xf8, 0xe9, 0x01, 0xee, 0xe0, 0x0e, 0x02, 0x0c, 0x04, 0xee, 0xf5, 0xf6, 0xf3, 0xfe, 0x81, 0xed, 0x0d, 0x1d, 0x16, 0xfe, 0xf7, 0xfa, 0xf7, 0xfd, 0x11, 0xf3, 0xfc, 0xe5, 0x10, 0x34, 0xf6, 0x22, 0xfb, 0x03, 0xe6, 0x07, 0xf6, 0x1a, 0x0a, 0xef, 0x81, 0x12, 0xee, 0xe9, 0x02, 0x1c, 0x06, 0x05, 0xfe, 0x06, 0x0f, 0x1b, 0xbb, 0xd9, 0xf0, 0xe7, 0x00, 0xf1, 0xfa, 0x01, 0xfb, 0x09, 0xf6, 0xe8, 0xf6, 0x11, 0xfe, 0x07, 0x01, 0x16, 0x22, 0xfd, 0xb5, 0xff, 0x1b, 0x1d, 0x05, 0x05, 0xe4, 0x0e, 0xf2, 0x06, 0xf0, 0x0b, 0xff, 0xf6, 0x1d, 0xe7, 0x0b, 0xe8, 0x93, 0x0d, 0x0a, 0x09, 0xe5, 0xea, 0x18, 0x02, 0x0c, 0xbb, 0x09, 0xf9, 0xe6, 0xfa, 0xe4, 0x14, 0xfc, 0xe7, 0xef, 0xfc, 0xf5, 0x03, 0x18, 0x12, 0xf8, 0xf6, 0xee, 0xee, 0xfc, 0xf4, 0x0b, 0x26, 0xfd, 0x05, 0xe8, 0xe9, 0x04, 0x04, 0x05, 0x08, 0xf6, 0x08, 0x18, 0xa2, 0xca, 0x04, 0x1c, 0xef, 0x0a, 0x06, 0x04, 0x02, 0x08, 0x03, 0xfd, 0xde, 0x0f, 0xe0, 0x07, 0xf5, 0xf4, 0xf7, 0xe4, 0x08, 0x95, 0x0c, 0x09, 0xc2, 0x0b, 0xf3, 0xe1, 0xbc, 0xea, 0xd1, 0xbe, 0xfb, 0x1b, 0x07, 0x2f, 0xf4, 0x11, 0xdf, 0xc9, 0xc0, 0x0a, 0xe8, 0x22, 0x02, 0xff, 0xc6, 0xe9, 0x29, 0xbd, 0x1e, 0x11, 0x24, 0xd7, 0xcd, 0xdd, 0xc0, 0xc0, 0xcb, 0x39, 0xfd, 0x08, 0xd2, 0xc9, 0x09, 0x03, 0x24, 0x81, 0xcd, 0x13, 0xc5, 0xd4, 0xed, 0x0a, 0xbf, 0x15, 0xfe, 0x26, 0xb6, 0xde, 0x0a, 0x25, 0x1e, 0xe5, 0xe7, 0x2f, 0xc1, 0xc1, 0xca, 0x62, 0xc3, 0xdb, 0xc0, 0x0a, 0xcc, 0x11, 0xf9, 0xd4, 0xb3, 0xe5, 0x11, 0xb7, 0xf6, 0xce, 0x8f, 0xf2, 0x1a, 0xe0, 0x2e, 0xff, 0x38, 0x32, 0xcb, 0xeb, 0x0f, 0x2c, 0xff, 0x0f, 0xd0, 0xf4, 0xe3, 0xf6, 0x2b, 0xfb, 0x16, 0x0d, 0xe2, 0x0a, 0x22, 0xfe, 0xcd, 0x26, 0x15, 0x51, 0x00, 0xd0, 0xe9, 0x19, 0xf8, 0xe7, 0x22, 0x24, 0xdc, 0xdf, 0x2e, 0xa6, 0xd3, 0xe5, 0xeb, 0xdf, 0xcd, 0x0c, 0xf3, 0x01, 0xf3, 0x0b, 0x29, 0xec, 0xdc, 0xe5, 0x61, 0xc7, 0xab, 0x0b, 0xaa, 0xf9, 0xa4, 0xae, 0xc4, 0xfa, 0x8d, 0x01, 0xb7, 0xa7, 0xb2, 0x64, 0x5f, 0x89, 0x8f, 0xa6, 0x27, 0xd9, 0x1a, 0xf9, 0x13, 0xcb, 0x0a, 0xf6, 0xbf, 0x97, 0x88, 0x25, 0x1c, 0xc9, 0xa9, 0xbf, 0xdd, 0xd1, 0xb1, 0x2d, 0x42, 0xa6, 0x57, 0x9b, 0x28, 0xc4, 0x26, 0xde, 0xc1, 0x41, 0x61, 0xe1, 0x4d, 0x81, 0xe9, 0x30, 0xe6, 0x47, 0xf9, 0xdc, 0x04, 0x9d, 0x8d, 0xce, 0x01, 0x39, 0x55, 0x39, 0x36, 0x06, 0x05, 0xf8, 0xc1, 0xb1, 0xf3, 0xe8, 0x4d, 0xb0, 0x3a, 0xb5, 0xff, 0x5b, 0xed, 0xc0, 0x4b, 0x36, 0x43, 0xbd, 0x3e, 0xe6, 0x16, 0x49, 0xf5, 0x3e, 0xdd, 0xb4, 0xfd, 0xf6, 0x3f, 0x4b, 0x23, 0x43, 0x0b, 0x18, 0xb4, 0xd6, 0x39, 0xd1, 0x0e, 0x07, 0xe0, 0x09, 0xda, 0x92, 0xdd, 0xfe, 0xcc, 0xc9, 0x12, 0x39, 0xb6, 0x29, 0x19, 0x0c, 0x0e, 0xd4, 0xcc, 0x0d, 0xf2, 0xde, 0x25, 0x6d, 0xef, 0xd1, 0x32, 0x1a, 0xcd, 0x03, 0x0a, 0xec, 0x25, 0xed, 0xd7, 0x6d, 0x30, 0x7f, 0x60, 0xe8, 0xbd, 0x0f, 0x19, 0x01, 0xeb, 0x07, 0xe7, 0xd6, 0xdb, 0xef, 0xcc, 0x0b, 0x01, 0xe4, 0x18, 0x23, 0x08, 0xd8, 0xe1, 0x28, 0xde, 0xfa, 0x08, 0xdf, 0x0f, 0xe4, 0xec, 0x18, 0x6d, 0xf6, 0x1c, 0xda, 0x28, 0x6a, 0xf2, 0xf0, 0x1a, 0x64, 0xea, 0x26, 0x05, 0x08, 0x4f, 0xfe, 0x0e, 0xea, 0x02, 0xb3, 0x1b, 0xf2, 0xcc, 0x1e, 0xf5, 0xe7, 0xdf, 0x32, 0xde, 0xc5, 0xe4, 0x1c, 0xd8, 0xcc, 0xd6, 0x13, 0xeb, 0x09, 0xd0, 0x35, 0xe2, 0x0f, 0xf4, 0x2f, 0xe2, 0x1d, 0x2c, 0xda, 0x15, 0xe4, 0x02, 0xe1, 0xe8, 0x26, 0x0e, 0xf8, 0xdb, 0xf3, 0xef, 0xe0, 0x6c, 0xd8, 0x45, 0xfa, 0x01, 0x45, 0xfe, 0x34, 0x37, 0x05, 0x3b, 0x24, 0xfe, 0xf2, 0x29, 0xbf, 0x17, 0xdd, 0x42, 0xfd, 0xef, 0x0d, 0xdd, 0xc4, 0xc8, 0xc5, 0xf2, 0x04, 0xe0, 0x9c, 0xe3, 0x0d, 0x05, 0xaa, 0x1d, 0xf5, 0xab, 0xcc, 0xf5, 0x12, 0xa3, 0xfc, 0x43, 0x0e, 0xd0, 0x26, 0xb6, 0xf0, 0xbd, 0xcc, 0x32, 0x90, 0xd6, 0xff, 0x1f, 0xa4, 0x30, 0xf0, 0xee, 0xeb, 0x35, 0xc2, 0xdd, 0x0f, 0x25, 0x1b, 0x22, 0xaf, 0xb5, 0xc2, 0xf9, 0x29, 0x17, 0xf0, 0xe1, 0x03, 0x9e, 0x81, 0xd2, 0xc6, 0xf3, 0xca, 0xe0, 0x21, 0x18, 0x31, 0xfc, 0xe9, 0xf2, 0xa8, 0x16, 0xea, 0x03, 0x11, 0xf4, 0x22, 0xc1, 0xff, 0xe3, 0xdd, 0xbc, 0xf0, 0xf1, 0xbb, 0xdb, 0xe8, 0xfa, 0xf9, 0x37, 0x35, 0xc1, 0xda, 0x17, 0x1c, 0xd7, 0xe9, 0xc6, 0xcc, 0x16, 0xe6, 0xdf, 0x19, 0xf9, 0xd5, 0xdc, 0x0b, 0x22, 0xf0, 0x12, 0x23, 0x00, 0x1b, 0x02, 0x03, 0xcc, 0xe8, 0xe6, 0x04, 0xfb, 0xf2, 0xf5, 0xc8, 0xe2, 0x1d, 0x0f, 0x30, 0xfe, 0xfa, 0xed, 0xff, 0xdb, 0x43, 0x1c, 0xcb, 0xf4, 0x21, 0x15, 0xfc, 0xf8, 0xdc, 0x1d, 0x23, 0xe9, 0x44, 0x36, 0xaa, 0x07, 0x1c, 0x00, 0x19, 0x2a, 0xf4, 0x24, 0x1c, 0x06, 0x1f, 0xfb, 0xe2, 0x23, 0xd2, 0x0b, 0xf0, 0x0f, 0xdf, 0xd9, 0xf6, 0x15, 0xdd, 0x26, 0xfe, 0x0d, 0x0d, 0xd4, 0x00, 0xf1, 0xf5, 0x14, 0x15, 0x25, 0xef, 0x2b, 0x7f, 0xf3, 0xfe, 0x0b, 0x4f, 0x2b, 0xed, 0x1b, 0xfe, 0x13, 0xd3, 0xd8, 0x22, 0xcf, 0x18, 0x19, 0x01, 0x26, 0x2c, 0x1e, 0x0b, 0xd9, 0x12, 0xd7, 0x1a, 0x06, 0xfa, 0xd2, 0x24, 0x2e, 0xdb, 0x16, 0x0d, 0x02, 0x09, 0xe9, 0xe0, 0xe8, 0x20, 0x0e, 0x10, 0x22, 0x12, 0x17, 0x13, 0xec, 0xd3, 0x18, 0xde, 0x2f, 0x1c, 0x25, 0xdb, 0x09, 0x0d, 0x0c, 0xd4, 0xba, 0xfd, 0x0e, 0x48, 0x2d, 0x14, 0xf4, 0x01, 0xd6, 0xe9, 0xc3, 0xfc, 0x10, 0xbc, 0xd9, 0xf7, 0xf2, 0x14, 0xd6, 0x17, 0x36, 0xce, 0xfa, 0x00, 0xdd, 0xd9, 0x24, 0x1b, 0xea, 0xa6, 0xd2, 0xd4, 0x25, 0xbc, 0xd4, 0xe4, 0x1b, 0xe1, 0x05, 0x13, 0x27, 0xf7, 0x01, 0x29, 0x11, 0xf2, 0x01, 0xcc, 0xfe, 0xee, 0xe3, 0xd1, 0x1e, 0x17, 0xf0, 0x16, 0xec, 0x0d, 0xf0, 0x16, 0xf5, 0x59, 0x09, 0x2b, 0x1b, 0xd7, 0x8e, 0x32, 0x13, 0x40, 0xcd, 0xeb, 0xeb, 0xef, 0x0a, 0xfb, 0x1c, 0x37, 0xeb, 0xf2, 0x91, 0x0a, 0x14, 0x10, 0x2e, 0xeb, 0xe4, 0x7f, 0x0b, 0x38, 0x00, 0xda, 0x20, 0x2e, 0x20, 0x2d, 0xfb, 0x22, 0x34, 0x3a, 0xec, 0xf8, 0xe9, 0xff, 0x07, 0x07, 0x29, 0x14, 0xe9, 0xda, 0xc6, 0xd8, 0x46, 0xd7, 0xd9, 0x33, 0x11, 0xfb, 0xed, 0x10, 0xce, 0xd8, 0xe5, 0xd6, 0x30, 0x29, 0x3a, 0xdb, 0xd4, 0x3a, 0xf9, 0x95, 0xdd, 0x0e, 0xdd, 0x2a, 0x0e, 0xd5, 0x17, 0x1d, 0xc7, 0x05, 0xe4, 0xea, 0xce, 0x2e, 0x4d, 0x33, 0xd7, 0xc7, 0xe2, 0xc3, 0xbf, 0x04, 0xb8, 0xe0, 0x01, 0xc8, 0x0b, 0xe6, 0x03, 0xb4, 0xb5, 0xc4, 0xdb, 0x03, 0x1c, 0xfe, 0xbd, 0xbd, 0xcf, 0xec, 0x13, 0xc9, 0xd9, 0xfc, 0x12, 0xe1, 0xb8, 0x06, 0x3a, 0xfc, 0xa0, 0x20, 0x18, 0xd0, 0x38, 0x38, 0xfe, 0x2f, 0x08, 0x38, 0xf6, 0xbe, 0x82, 0xcc, 0xac, 0x14, 0x3e, 0xbc, 0x2f, 0xca, 0xa4, 0xa1, 0x2e, 0x12, 0xc2, 0x03, 0x06, 0xc1, 0xc2, 0xfa, 0xf3, 0x4e, 0x09, 0xdf, 0xf5, 0xd6, 0xb9, 0xf2, 0xb3, 0x31, 0x3a, 0xce, 0xd0, 0x1d, 0x13, 0xf2, 0xb7, 0x07, 0xba, 0xff, 0x06, 0x4c, 0xbe, 0x1f, 0x45, 0xb9, 0x45, 0xf5, 0xe1, 0x19, 0x82, 0xcc, 0x16, 0xf7, 0x36, 0xae, 0xb5, 0xdc, 0xd4, 0x14, 0x19, 0x0d, 0x99, 0x30, 0x81, 0x1a, 0x3b, 0xb4, 0x43, 0xc7, 0x06, 0xfa, 0xcc, 0x4d, 0xb9, 0xd9, 0xe0, 0x1c, 0xfa, 0x31, 0x1b, 0x18, 0x0f, 0xfc, 0xfe, 0x31, 0xf3, 0x02, 0xe2, 0x1f, 0x2c, 0xab, 0xf8, 0xb5, 0x2a, 0xe6, 0xd4, 0x10, 0xee, 0x3f, 0x4f, 0xd8, 0x10, 0x07, 0x1c, 0x25, 0xea, 0x13, 0xe7, 0xdb, 0x1c, 0xf9, 0xd3, 0xda, 0xe6, 0x20, 0x2f, 0x24, 0xee, 0x14, 0x2e, 0x24, 0xdb, 0x28, 0x04, 0xf7, 0x22, 0xea, 0x12, 0x08, 0xf8, 0x01, 0x0b, 0xcc, 0x10, 0x19, 0x19, 0xf9, 0xcb, 0x62, 0x15, 0x04, 0xe1, 0x05, 0x23, 0xf8, 0x2d, 0x06, 0x81, 0xe6, 0x24, 0xdc, 0x1b, 0x09, 0x01, 0x0c, 0x03, 0xf5, 0xde, 0xee, 0x12, 0xf4, 0xd4, 0x29, 0x0f, 0x17, 0x1b, 0x2f, 0xfc, 0x2b, 0x22, 0x1e, 0x11, 0xef, 0xf1, 0x37, 0xf8, 0xd7, 0x1c, 0x21, 0x29, 0x07, 0x17, 0x38, 0xe6, 0xc2, 0xc5, 0x33, 0x19, 0x14, 0x5c, 0xff, 0x11, 0xf9, 0xfa, 0xee, 0x2a, 0x10, 0xf3, 0xfa, 0xda, 0xf7, 0xfc, 0x8f, 0x1a, 0xe0, 0xe9, 0x2c, 0x4d, 0xc1, 0xc6, 0xf7, 0xbb, 0xfd, 0x4e, 0xd8, 0xce, 0x41, 0x43, 0xf7, 0x0a, 0xde, 0xe9, 0xdd, 0xbd, 0xb0, 0x81, 0xb8, 0x0e, 0x28, 0xe1, 0xc3, 0xeb, 0xe4, 0xe3, 0x2b, 0xf5, 0x3a, 0x02, 0xab, 0xd4, 0xc8, 0xbb, 0xd4, 0x14, 0xfd, 0xf8, 0x1a, 0xb4, 0x1b, 0x12, 0x41, 0xf5, 0xf0, 0xf9, 0xf5, 0xcf, 0xe3, 0xe6, 0xc9, 0xc3, 0xc4, 0x09, 0xe5, 0xf1, 0xdf, 0x8f, 0xc4, 0x4d, 0xdd, 0x37, 0xdc, 0x3d, 0xd3, 0xc6, 0xd6, 0x89, 0xc7, 0xe2, 0xe6, 0xeb, 0xb7, 0x8e, 0x3c, 0xcb, 0x47, 0xd5, 0x3b, 0xb0, 0xf6, 0xcc, 0x24, 0x14, 0x31, 0xee, 0x1b, 0x48, 0xd1, 0xc7, 0x20, 0x46, 0x32, 0x1f, 0x17, 0x83, 0x47, 0x8e, 0xa1, 0x4f, 0x17, 0xd0, 0xdc, 0x40, 0x18, 0xc5, 0xbe, 0xcf, 0x05, 0x2c, 0x31, 0xac, 0xed, 0xd7, 0x0a, 0x18, 0xca, 0xe0, 0xf7, 0xcb, 0x35, 0xaa, 0x02, 0x37, 0xae, 0xf1, 0xea, 0x19, 0x4b, 0xf0, 0x99, 0xe9, 0xbc, 0x08, 0xb7, 0x19, 0xe8, 0xd6, 0xeb, 0x30, 0xb4, 0xe5, 0xbc, 0xb8, 0x05, 0x60, 0x6c, 0x52, 0x3f, 0x5f, 0xf0, 0xf1, 0xdf, 0x00, 0xbc, 0xb9, 0x22, 0xd8, 0xc1, 0xff, 0xc8, 0xf6, 0x45, 0xd6, 0x50, 0x0a, 0x43, 0x33, 0xb4, 0xcb, 0x0f, 0x3f, 0x12, 0x30, 0x09, 0x10, 0xe8, 0x32, 0xb5, 0xc5, 0x67, 0x16, 0xfb, 0xc9, 0xe5, 0x1f, 0x8f, 0x12, 0xfc, 0x47, 0xe3, 0xba, 0xf2, 0xc6, 0x06, 0xb9, 0x28, 0x17, 0x1c, 0x22, 0x34, 0xdd, 0xda, 0xc8, 0x4d, 0xc2, 0xfd, 0xbe, 0xb2, 0x01, 0x37, 0xb2, 0xb9, 0x6f, 0xcf, 0x26, 0xf8, 0x34, 0xed, 0x4a, 0x1d, 0xdc, 0x19, 0xad, 0xdc, 0x31, 0xdf, 0x26, 0xb0, 0x32, 0x45, 0x49, 0xb2, 0x8f, 0xe3, 0xfa, 0xb1, 0x9b, 0xed, 0xad, 0x81, 0x12, 0x0b, 0xbd, 0xf5, 0x0d, 0xc3, 0x03, 0xc0, 0xc6, 0xff, 0xed, 0x06, 0x0f, 0xf4, 0x14, 0xf8, 0x1b, 0x17, 0xeb, 0xf7, 0xfc, 0x08, 0x15, 0xc0, 0x10, 0x13, 0xef, 0x1b, 0x00, 0x06, 0x07, 0x2c, 0xe9, 0xe8, 0xce, 0xeb, 0xfd, 0x08, 0xf0, 0xf1, 0x14, 0x05, 0x16, 0xf7, 0xff, 0x11, 0xf4, 0x23, 0x09, 0xc5, 0xe6, 0xf7, 0x04, 0x18, 0xfd, 0x06, 0xea, 0xf5, 0x0b, 0x00, 0x0d, 0xef, 0x04, 0x0d, 0x19, 0x06, 0xe0, 0xfc, 0x10, 0x06, 0x03, 0x19, 0x10, 0x81, 0xe6, 0x16, 0x05, 0xe5, 0xe8, 0xfb, 0xf9, 0x08, 0x22, 0x00, 0x09, 0x07, 0xf8, 0x0c, 0xfb, 0x0f, 0x0e, 0x16, 0x11, 0xfa, 0x14, 0x17, 0xfa, 0x09, 0x19, 0xf7, 0x08, 0x03, 0x1b, 0xe4, 0xfc, 0x26, 0x06, 0x0b, 0xff, 0xe6, 0xf0, 0x1b, 0xf2, 0xe9, 0x1d, 0x0b, 0x03, 0xd7, 0x0e, 0x21, 0x16, 0x00, 0xee, 0x0c, 0xcd, 0x11, 0xfa, 0xfe, 0xf8, 0x0f, 0xea, 0xfb, 0x0d, 0xee, 0x0c, 0xe5, 0x05, 0x21, 0x04, 0xab, 0x0a, 0xf7, 0x41, 0x2a, 0xd9, 0xce, 0x53, 0x05, 0xa8, 0x19, 0x24, 0xa5, 0xd7, 0xef, 0x0b, 0xdc, 0x31, 0x03, 0x07, 0xb7, 0xca, 0x05, 0x06, 0xea, 0xff, 0xdb, 0xa9, 0xee, 0x31, 0x15, 0xd9, 0x0e, 0x09, 0x26, 0xff, 0xfb, 0xd8, 0xec, 0xf1, 0xa0, 0x1b, 0xe2, 0xe3, 0xf8, 0xb2, 0xdb, 0xc9, 0xda, 0xb2, 0x15, 0x06, 0xb4, 0x0d, 0xdf, 0xc4, 0x81, 0x4e, 0xee, 0x31, 0xd0, 0xac, 0x9e, 0xce, 0xd3, 0x2f, 0x18, 0xd1, 0xb6, 0x24, 0xd0, 0x20, 0xa9, 0xf2, 0xdf, 0xf9, 0x02, 0xb4, 0xf8, 0xea, 0xd0, 0x4e, 0x1a, 0xfc, 0xf8, 0x0a, 0x0a, 0x06, 0x19, 0xdb, 0x20, 0x4a, 0x22, 0x02, 0xbb, 0x08, 0xc9, 0xd9, 0xbe, 0xbb, 0x37, 0xa9, 0xd3, 0x55, 0xc9, 0x32, 0x88, 0xe7, 0xea, 0xb3, 0x90, 0xbc, 0x0a, 0x12, 0xf7, 0xfe, 0xea, 0xd2, 0xf5, 0x17, 0xc7, 0xbf, 0x13, 0xf7, 0x1f, 0x1c, 0x8a, 0xc9, 0x0a, 0x07, 0xe6, 0xe0, 0xdc, 0xeb, 0xe6, 0xee, 0x71, 0xdb, 0xfe, 0xdd, 0xfe, 0x19, 0x21, 0xe0, 0x0a, 0xe5, 0x25, 0xd6, 0x7f, 0x01, 0x65, 0xf4, 0x2a, 0xac, 0x2d, 0xe8, 0x0d, 0xee, 0xde, 0x08, 0xdd, 0x01, 0xf9, 0x33, 0x1f, 0x1e, 0x1a, 0x10, 0x0e, 0xf7, 0x1b, 0x2a, 0xea, 0x0e, 0xe9, 0x39, 0x0e, 0x18, 0xd6, 0x28, 0x0e, 0x24, 0xdb, 0x02, 0xc9, 0x15, 0x39, 0x1a, 0xec, 0x22, 0x19, 0xe3, 0xfa, 0x04, 0xfb, 0x55, 0x0c, 0xf6, 0x18, 0x0d, 0xb6, 0xe1, 0xb9, 0x13, 0xdd, 0x2f, 0x19, 0x1c, 0x28, 0xf7, 0xae, 0xfe, 0x0c, 0xfd, 0x0a, 0x2c, 0xd7, 0xe4, 0x1a, 0x10, 0xd4, 0x1d, 0xf2, 0xfe, 0xe9, 0x24, 0xf9, 0x02, 0x05, 0xf1, 0x06, 0x23, 0x1f, 0x1a, 0x0b, 0x23, 0x2d, 0x12, 0xe5, 0xf3, 0x1d, 0xeb, 0x22, 0x4b, 0x38, 0x0b, 0x23, 0xd6, 0xdc, 0x1f, 0xf5, 0xf9, 0x22, 0xf0, 0x1d, 0xe4, 0xee, 0xde, 0x03, 0xe3, 0x17, 0x07, 0x23, 0x07, 0xf4, 0xe3, 0x11, 0xea, 0xde, 0x0b, 0x19, 0x06, 0x05, 0xff, 0x03, 0x13, 0x04, 0x99, 0x90, 0xaf, 0x05, 0x0a, 0x20, 0xff, 0x14, 0xe2, 0xe5, 0x23, 0xe9, 0xe7, 0x10, 0xc7, 0x06, 0xed, 0xe8, 0x0f, 0x01, 0x06, 0x05, 0xd9, 0xe4, 0x01, 0xea, 0xeb, 0x17, 0xf5, 0x12, 0xc0, 0xea, 0xcb, 0xf5, 0xbc, 0x17, 0x1e, 0x06, 0x17, 0x00, 0xfa, 0x81, 0x01, 0x0d, 0x04, 0x0c, 0x93, 0x0c, 0x0d, 0xe8, 0x08, 0x28, 0x0e, 0x1f, 0x18, 0xe6, 0x02, 0xe0, 0x15, 0x08, 0x12, 0xfd, 0xe9, 0xfe, 0x12, 0xff, 0xf3, 0xf0, 0xda, 0x0c, 0x16, 0xe5, 0xec, 0x0a, 0xe8, 0x0d, 0x01, 0xe0, 0xd0, 0xed, 0x20, 0x17, 0x03, 0xf8, 0x01, 0x08, 0x16, 0x1c, 0x09, 0x19, 0xe9, 0xfb, 0xcc, 0x14, 0xa0, 0xda, 0x07, 0xb6, 0xf2, 0x0e, 0xda, 0xf1, 0xfa, 0x1e, 0x07, 0x14, 0xef, 0xeb, 0xa2, 0x0f, 0x07, 0x19, 0x00, 0xc5, 0x0f, 0x07, 0xec, 0x19, 0x04, 0xc4, 0x00, 0x07, 0xdd, 0x10, 0xf8, 0x1d, 0xd9, 0x13, 0x2e, 0xf9, 0x26, 0x1b, 0xc1, 0xe3, 0xe8, 0xf2, 0x0b, 0xea, 0xe8, 0x09, 0x16, 0xf8, 0xdf, 0x03, 0xff, 0xed, 0x05, 0x0f, 0xfd, 0xe0, 0xfd, 0x01, 0xe5, 0xf5, 0x94, 0x21, 0x18, 0xe8, 0x8d, 0xf2, 0x20, 0x25, 0xfe, 0xcc, 0xf2, 0xf1, 0xd7, 0x24, 0xfe, 0x57, 0x0a, 0xeb, 0xfd, 0xfd, 0xf7, 0x13, 0x08, 0xf4, 0x08, 0x81, 0xe9, 0x86, 0x06, 0xde, 0xab, 0x17, 0xe3, 0xe0, 0x0f, 0x91, 0x1c, 0x13, 0x0a, 0xe6, 0xdf, 0x16, 0xf7, 0xfe, 0xfb, 0x07, 0xf5, 0xd7, 0x0b, 0xf7, 0xe0, 0x15, 0xb1, 0xdb, 0x21, 0xff, 0xdb, 0xe0, 0xf4, 0xc5, 0xe3, 0xff, 0x1f, 0xe9, 0xf2, 0x02, 0xe1, 0xf3, 0x15, 0xce, 0xe2, 0x04, 0x15, 0x0d, 0xee, 0x1d, 0x06, 0x14, 0x0a, 0x1e, 0xee, 0xec, 0xc5, 0xde, 0x1b, 0x16, 0x0a, 0xf7, 0xe4, 0xd0, 0x00, 0xcc, 0xef, 0x2b, 0x14, 0xf1, 0xfc, 0x33, 0x2f, 0x02, 0x1b, 0x99, 0xa9, 0xb6, 0xfd, 0x11, 0x29, 0x1b, 0xd7, 0x22, 0xce, 0x0b, 0x1e, 0x07, 0x0c, 0x15, 0xbf, 0x09, 0xf5, 0xf0, 0x2f, 0xfb, 0xf2, 0x0b, 0xcc, 0xde, 0x1d, 0x10, 0xc8, 0x3f, 0xd3, 0xe3, 0xe2, 0x81, 0x0d, 0xd1, 0xba, 0x38, 0x2e, 0xdb, 0xf3, 0xe1, 0x14, 0xa5, 0xe9, 0x1f, 0x06, 0x30, 0x8f, 0xdc, 0xcf, 0xf5, 0xad, 0xe5, 0x34, 0x10, 0x31, 0xed, 0x37, 0xf4, 0xe4, 0xfb, 0x18, 0x54, 0xed, 0xf9, 0x08, 0xfd, 0x26, 0xfc, 0x01, 0xcd, 0x2b, 0x2d, 0xd8, 0xeb, 0xf4, 0xce, 0x21, 0xc4, 0x04, 0xed, 0xfd, 0xd0, 0xe8, 0xee, 0xda, 0x3e, 0xdf, 0x17, 0xf8, 0xe1, 0x20, 0xbe, 0x16, 0x2d, 0xd5, 0x20, 0xc8, 0x9a, 0xdc, 0x36, 0xb7, 0xe1, 0x15, 0x1d, 0x37, 0x05, 0xd1, 0x09, 0x86, 0x0f, 0xde, 0x1a, 0x2c, 0x17, 0xe2, 0x21, 0x29, 0xe6, 0xf8, 0x4d, 0xd1, 0xb0, 0x1c, 0xf0, 0xff, 0xdf, 0x06, 0x34, 0xb9, 0x16, 0x2e, 0x27, 0x3c, 0x01, 0x09, 0xf0, 0x0c, 0x06, 0xf5, 0xec, 0xf8, 0xec, 0xd0, 0x81, 0x06, 0x00, 0x21, 0x11, 0x01, 0x1b, 0xeb, 0x0a, 0x2b, 0x0b, 0x99, 0xe6, 0xd7, 0xf3, 0xcc, 0xde, 0xe2, 0x00, 0x4d, 0x09, 0xe9, 0xac, 0x08, 0xe0, 0xcc, 0xdc, 0x1b, 0xdd, 0x1d, 0x01, 0x40, 0xd9, 0x10, 0xd2, 0xcf, 0x42, 0xfa, 0x47, 0x0d, 0xe4, 0xb9, 0x15, 0xd7, 0xee, 0x0e, 0x47, 0x0b, 0xf8, 0xe6, 0x1c, 0xe9, 0x18, 0x0a, 0xd3, 0x25, 0xea, 0xfd, 0x0c, 0xd9, 0x11, 0xda, 0x2c, 0xc6, 0x1c, 0x01, 0x30, 0x12, 0xed, 0xf6, 0x0b, 0x0f, 0xd5, 0xca, 0x4b, 0x18, 0x2d, 0xf9, 0x28, 0x10, 0x85, 0x03, 0xf6, 0x2e, 0x12, 0xda, 0x0b, 0x07, 0x25, 0xfc, 0xa7, 0x23, 0xd1, 0x1e, 0x2c, 0xe8, 0xc9, 0xd7, 0xd1, 0xe8, 0xf9, 0xc8, 0xb9, 0x2d, 0xec, 0xac, 0xa9, 0x11, 0x0f, 0xaa, 0xd5, 0x04, 0xe7, 0xea, 0x01, 0xc6, 0xff, 0xbc, 0xe5, 0x33, 0xdb, 0xd2, 0xf8, 0xc4, 0xda, 0x04, 0xa7, 0x84, 0xe7, 0xf4, 0x12, 0x45, 0xcd, 0x2c, 0x02, 0xc5, 0xea, 0x1e, 0xcf, 0xbd, 0x9b, 0x3a, 0x42, 0x22, 0xb8, 0xa6, 0xb0, 0xbb, 0xca, 0x3e, 0x9e, 0x37, 0xf3, 0xa9, 0xb4, 0x40, 0x23, 0xb6, 0x1a, 0xdd, 0xc1, 0xb4, 0xfc, 0xe5, 0xce, 0x0f, 0x81, 0xd8, 0xab, 0xc9, 0xb4, 0xcd, 0xfa, 0xff, 0x3b, 0x23, 0xb7, 0xe0, 0xad, 0xef, 0x22, 0x99, 0x01, 0x38, 0xad, 0xde, 0xf5, 0x25, 0xe1, 0x00, 0xd3, 0x08, 0xbf, 0xb6, 0xca, 0xf3, 0xd2, 0x39, 0x9d, 0xe7, 0x94, 0xc5, 0xf6, 0xce, 0x06, 0xaa, 0x54, 0xdd, 0xe9, 0x01, 0x9c, 0x19, 0xd2, 0xf4, 0x1c, 0xe2, 0x02, 0x20, 0xb2, 0xf8, 0xfc, 0xce, 0x05, 0xf6, 0x11, 0xf9, 0x03, 0x10, 0xeb, 0xf7, 0xe7, 0xf4, 0x15, 0xf9, 0xa5, 0x0a, 0xc7, 0x12, 0xc4, 0xe6, 0x0c, 0x20, 0x0b, 0x00, 0xf9, 0x1c, 0x0d, 0xf7, 0xef, 0x09, 0x0b, 0xd2, 0xed, 0xfd, 0xe5, 0xc8, 0xdd, 0xff, 0xee, 0x15, 0x12, 0xe6, 0x05, 0x09, 0xf6, 0xf8, 0x0c, 0x81, 0x03, 0xfb, 0xe9, 0xb5, 0xfd, 0x14, 0x0a, 0xfc, 0x1d, 0x03, 0x0c, 0xe7, 0xf6, 0xe5, 0xfe, 0xec, 0x01, 0x0e, 0x01, 0x16, 0xf4, 0x12, 0xfe, 0xc3, 0x0c, 0xec, 0x13, 0xf1, 0xee, 0x8f, 0xf8, 0xbe, 0x17, 0x15, 0x24, 0x10, 0xe4, 0x11, 0xf1, 0x1c, 0x0c, 0x11, 0x0a, 0x18, 0x0b, 0x0c, 0x02, 0x08, 0xe9, 0x16, 0x0f, 0xc2, 0xea, 0xf3, 0x1b, 0x0d, 0x04, 0x12, 0x0d, 0x15, 0xc9, 0xdd, 0x35, 0xfe, 0x04, 0x17, 0xff, 0x0e, 0xad, 0x04, 0x0c, 0x17, 0x08, 0xec, 0xfb, 0x10, 0x1b, 0xf7, 0x99, 0xf7, 0xcf, 0x1f, 0x94, 0x23, 0x18, 0xc5, 0x03, 0x59, 0x8d, 0xb4, 0x17, 0x11, 0x50, 0xbd, 0x9e, 0xf1, 0x8b, 0xbd, 0xe4, 0xc9, 0x90, 0xdf, 0xdd, 0xde, 0x51, 0xc4, 0x0b, 0x16, 0x9d, 0xdd, 0xd1, 0xec, 0xdc, 0xc5, 0x4b, 0xc3, 0xca, 0xb7, 0x90, 0x61, 0xe5, 0xe0, 0x45, 0xe8, 0xcb, 0xef, 0xa4, 0xe1, 0x08, 0x0c, 0xa3, 0x0a, 0x1b, 0x81, 0x41, 0x2d, 0x8f, 0x55, 0x04, 0xc7, 0xbc, 0x8b, 0xce, 0xc9, 0xb0, 0x23, 0xdc, 0xa0, 0x4b, 0x23, 0x2e, 0xc4, 0x27, 0x24, 0x3e, 0x50, 0x00, 0xb1, 0x4b, 0xe7, 0xdd, 0xf4, 0x2e, 0xe2, 0xb5, 0x27, 0x57, 0x28, 0xf3, 0xf1, 0x4e, 0xbf, 0x38, 0x20, 0xa7, 0xfd, 0x8c, 0x9c, 0xd3, 0xdd, 0x1a, 0x1a, 0x94, 0xb7, 0x40, 0x9c, 0x2d, 0xeb, 0xdd, 0xc6, 0xf1, 0xbc, 0xe2, 0x92, 0xed, 0xb7, 0x0c, 0x04, 0xc6, 0xec, 0x48, 0xf8, 0xe9, 0xe7, 0xf4, 0x2a, 0x3b, 0xd5, 0xa0, 0xc4, 0xd4, 0xd0, 0x41, 0x24, 0x3e, 0x57, 0xbd, 0x54, 0x1e, 0x4d, 0xe2, 0x39, 0x39, 0xa3, 0xf6, 0x4c, 0x32, 0xcc, 0x27, 0xe9, 0xea, 0xe5, 0x35, 0x26, 0xe1, 0xc7, 0xc1, 0xec, 0xa2, 0xb2, 0xdd, 0x0c, 0xd2, 0x09, 0xe9, 0xf6, 0x15, 0xcc, 0x8d, 0xbb, 0x2a, 0x0c, 0x1f, 0x40, 0x56, 0x8c, 0xf7, 0xd4, 0x2e, 0xe4, 0x94, 0xad, 0x07, 0xdf, 0x7f, 0xa7, 0x0e, 0x97, 0x5a, 0x9b, 0xd3, 0xab, 0xcb, 0xc8, 0x8c, 0x20, 0xc3, 0x1a, 0xd9, 0xb8, 0xe7, 0x48, 0xc8, 0x00, 0x38, 0xc0, 0x0e, 0xc5, 0xfb, 0xe3, 0x9d, 0xce, 0xee, 0x47, 0xe9, 0xff, 0xb8, 0xf8, 0xd6, 0x28, 0xc4, 0xb9, 0x2f, 0xbe, 0x94, 0x03, 0xdb, 0x8f, 0xe1, 0xa2, 0xad, 0xad, 0x22, 0x20, 0x0b, 0xb1, 0x0c, 0x0f, 0x8d, 0xed, 0xe6, 0xdf, 0x2c, 0x06, 0xc5, 0xce, 0x02, 0x35, 0xb2, 0x12, 0xe8, 0x2e, 0xfd, 0x47, 0xbf, 0xda, 0xec, 0xea, 0xfa, 0xe9, 0x1b, 0xfc, 0x07, 0xdf, 0xd2, 0xff, 0xe6, 0x14, 0x03, 0x06, 0x15, 0x24, 0x1a, 0x12, 0xf7, 0x1f, 0xf7, 0x9d, 0x9a, 0xaa, 0x08, 0xf7, 0xf8, 0xe2, 0x1a, 0x02, 0xf8, 0xf9, 0x17, 0x0a, 0xea, 0xde, 0xfd, 0xdf, 0x0c, 0x0a, 0xf4, 0x1a, 0x0a, 0xe6, 0x14, 0xe0, 0x00, 0xe1, 0xff, 0x1c, 0xf4, 0xab, 0xe2, 0x9e, 0x1d, 0xee, 0xe9, 0x22, 0x01, 0xe0, 0xed, 0xf7, 0xb5, 0x11, 0x02, 0x16, 0xf3, 0x93, 0xf4, 0xf2, 0x21, 0x22, 0x25, 0x00, 0x24, 0x0f, 0x03, 0xb2, 0x17, 0x0f, 0xe6, 0x18, 0x0f, 0x20, 0x07, 0xf2, 0x07, 0x00, 0xed, 0x00, 0xe7, 0xef, 0xf5, 0x09, 0xf8, 0xff, 0xdb, 0xee, 0xec, 0xed, 0x08, 0xfb, 0x0c, 0xf6, 0x06, 0x19, 0xf7, 0x17, 0x08, 0x12, 0xee, 0xf9, 0x00, 0xb7, 0xe8, 0x83, 0x81, 0x0f, 0x9a, 0xf1, 0xf0, 0xba, 0x17, 0x01, 0x0e, 0xec, 0x01, 0x16, 0x15, 0xfd, 0xe3, 0x11, 0x14, 0xf1, 0xc4, 0x1a, 0x7f, 0xe1, 0x00, 0xfc, 0xe8, 0xd8, 0xec, 0x08, 0x1b, 0xec, 0xe0, 0x34, 0x62, 0x26, 0xe9, 0xf4, 0x28, 0x14, 0x09, 0xd6, 0x02, 0xd6, 0xfe, 0x24, 0x21, 0xff, 0xe8, 0x18, 0x33, 0xcf, 0x0f, 0x09, 0xe6, 0xff, 0x01, 0x03, 0x30, 0xe6, 0x05, 0xe7, 0xe7, 0x24, 0xd6, 0xfd, 0xa1, 0x2f, 0xd4, 0xda, 0xfb, 0x21, 0xd0, 0xcc, 0x27, 0xe8, 0xe6, 0x2a, 0xe9, 0x06, 0xd9, 0x4c, 0x03, 0x2c, 0xe8, 0x10, 0x3e, 0xf5, 0x13, 0xdd, 0xf4, 0x17, 0xfa, 0xf1, 0xf7, 0xd2, 0xea, 0x17, 0x13, 0xd3, 0xcf, 0xea, 0xed, 0xdb, 0x04, 0xd5, 0xe7, 0x07, 0xf0, 0x1b, 0x12, 0x17, 0xe0, 0x02, 0xef, 0xea, 0xf4, 0x21, 0xec, 0xde, 0xf7, 0xe9, 0x28, 0x0e, 0xec, 0x0e, 0xf7, 0xee, 0xe7, 0x26, 0x34, 0xe6, 0x0e, 0xf5, 0x24, 0xe7, 0xf9, 0x31, 0xf0, 0x0b, 0x12, 0x20, 0xd7, 0x87, 0x5d, 0x21, 0x18, 0xdf, 0xf6, 0xe5, 0xd0, 0x2a, 0xf5, 0xd3, 0xea, 0x1f, 0xcf, 0x0b, 0xee, 0xcb, 0xc9, 0x34, 0xdd, 0x0c, 0x6f, 0x06, 0x23, 0x3d, 0xf2, 0x10, 0x0c, 0x34, 0xfc, 0xec, 0x2c, 0xf5, 0xc4, 0xa9, 0x8d, 0x12, 0x1e, 0xe4, 0xfa, 0x00, 0xd2, 0x16, 0x30, 0x15, 0xf0, 0xa8, 0x25, 0x25, 0x2a, 0xbd, 0xeb, 0xd4, 0x23, 0xdf, 0xfc, 0x1b, 0xde, 0x0c, 0xe9, 0x81, 0xc7, 0xe6, 0x0a, 0x06, 0x3d, 0xfd, 0x1a, 0xeb, 0x27, 0x9e, 0x3b, 0x0c, 0x10, 0xda, 0xec, 0xf8, 0x10, 0x09, 0x25, 0xd9, 0xfb, 0x16, 0xe0, 0x30, 0xf7, 0x32, 0x18, 0x54, 0xcf, 0x25, 0x10, 0x20, 0xf7, 0x25, 0xfe, 0x25, 0x08, 0x23, 0xde, 0x12, 0x20, 0xd8, 0xcf, 0xe7, 0x34, 0xed, 0x84, 0xaf, 0xff, 0x33, 0xb2, 0x55, 0xec, 0x0a, 0xe7, 0xda, 0xdc, 0x15, 0xfe, 0xb9, 0x44, 0xe2, 0xed, 0x20, 0xa0, 0x05, 0x0d, 0x05, 0xd9, 0xf3, 0xf3, 0x11, 0xeb, 0xe1, 0x7f, 0xe7, 0xfe, 0xdb, 0xec, 0x11, 0x2b, 0xe6, 0x20, 0x07, 0x2c, 0xe1, 0x49, 0x22, 0x19, 0xec, 0x00, 0x99, 0xe9, 0xf7, 0x19, 0xdf, 0x24, 0x02, 0x26, 0x23, 0x2f, 0x21, 0x2b, 0xf9, 0xde, 0x04, 0xfc, 0xf9, 0xdb, 0xee, 0xe6, 0x28, 0xed, 0x25, 0xcf, 0x25, 0xe9, 0x1f, 0x0b, 0x36, 0x08, 0xfb, 0xfd, 0xe4, 0x61, 0xf2, 0xeb, 0x20, 0xc6, 0xe6, 0xf6, 0xec, 0xe2, 0x31, 0x18, 0xf3, 0xde, 0x22, 0xa9, 0x23, 0xb7, 0x06, 0xef, 0xff, 0xe4, 0xe7, 0x0b, 0xda, 0x9d, 0x0f, 0x1a, 0x18, 0x1c, 0x1a, 0x05, 0xd4, 0xe4, 0xd8, 0x21, 0xfc, 0xe7, 0x01, 0x05, 0x24, 0xf3, 0x17, 0xd8, 0xed, 0xf7, 0xe0, 0xf4, 0xe1, 0xd2, 0x00, 0x24, 0x2a, 0xbe, 0xfc, 0xee, 0xd7, 0xe8, 0x22, 0x17, 0xca, 0x38, 0xde, 0xdb, 0x08, 0xe7, 0xdf, 0xe6, 0xe0, 0x30, 0xe8, 0xf7, 0x0a, 0xe9, 0xed, 0xed, 0xef, 0x07, 0x12, 0x81, 0x09, 0x01, 0xf6, 0x08, 0x14, 0x04, 0xf4, 0x04, 0xf0, 0xff, 0xfc, 0xd4, 0xdf, 0xda, 0xd8, 0x08, 0xef, 0xec, 0x09, 0x0e, 0xef, 0x06, 0xfc, 0x00, 0xfc, 0x04, 0x06, 0x02, 0x14, 0x08, 0x0c, 0xcb, 0x06, 0xf6, 0x00, 0xfa, 0xf6, 0x06, 0x08, 0x10, 0xfa, 0x0b, 0x06, 0x00, 0xfb, 0xec, 0xd6, 0xf6, 0x14, 0xa4, 0xe9, 0x03, 0x05, 0xef, 0xf8, 0x11, 0xf6, 0x09, 0xb3, 0xf4, 0xf6, 0xef, 0xfe, 0xf5, 0xec, 0xf6, 0xf0, 0x06, 0x06, 0x01, 0x09, 0xf8, 0x02, 0xf2, 0x03, 0xef, 0x0e, 0xf2, 0x10, 0xf9, 0x0e, 0x11, 0x10, 0xfb, 0x03, 0xec, 0xf3, 0x11, 0x04, 0xe2, 0x05, 0xef, 0xdd, 0xd1, 0x04, 0x04, 0x02, 0xfe, 0x10, 0x03, 0x02, 0x01, 0xf5, 0x12, 0xf1, 0xf6, 0xd4, 0xfd, 0x08, 0xf9, 0xf1, 0x03, 0x01, 0xc2, 0xec, 0x00, 0xdb, 0x05, 0xeb, 0x04, 0xc4, 0x29, 0x12, 0x13, 0x19, 0x27, 0xf8, 0xdd, 0xda, 0xde, 0xd4, 0xec, 0x12, 0x07, 0x20, 0x05, 0x27, 0xff, 0x59, 0xf7, 0xa0, 0xb7, 0xfd, 0xd2, 0x0c, 0x08, 0x25, 0x10, 0x19, 0xda, 0x21, 0xf1, 0xfe, 0xe7, 0xf5, 0xec, 0x00, 0xd3, 0xfb, 0xfc, 0xfe, 0xec, 0xc4, 0xe2, 0xd7, 0x11, 0x0f, 0x31, 0x10, 0xf9, 0xdf, 0x86, 0xd0, 0xe1, 0xda, 0x51, 0xdf, 0xf2, 0x0b, 0x10, 0xf7, 0xdf, 0xe7, 0xd8, 0xfa, 0x0b, 0xbb, 0x09, 0x09, 0x0b, 0x24, 0x3f, 0xdc, 0x59, 0xe0, 0x17, 0xcc, 0x23, 0xd3, 0xe1, 0xfb, 0x47, 0x22, 0x37, 0x0e, 0x2a, 0x1e, 0xd7, 0x04, 0xe4, 0xee, 0xdf, 0x23, 0xef, 0xef, 0x22, 0x28, 0xe3, 0x05, 0xef, 0xfa, 0x08, 0xf1, 0x09, 0x27, 0x14, 0xe5, 0xf8, 0xf6, 0xdb, 0x18, 0x11, 0xcf, 0x10, 0x81, 0xdc, 0x43, 0xa8, 0xdf, 0xfc, 0xd0, 0xcf, 0x29, 0x0b, 0x1f, 0xe8, 0xf2, 0x10, 0xaa, 0xcf, 0xf7, 0xdd, 0xb8, 0xfc, 0x1e, 0xb5, 0xe1, 0x2c, 0xca, 0xb2, 0xab, 0xb4, 0x05, 0xe2, 0x1a, 0xe3, 0x48, 0xec, 0xb0, 0xa5, 0xde, 0x4d, 0xda, 0xdb, 0x05, 0x04, 0x29, 0xe2, 0xf5, 0x27, 0xd9, 0x2a, 0xd1, 0xfe, 0x0e, 0x22, 0xdb, 0xc1, 0xd0, 0xd0, 0x35, 0xc3, 0xd9, 0xb5, 0x0f, 0x30, 0x20, 0x32, 0x0b, 0xc0, 0xef, 0x1a, 0xd0, 0xcb, 0x4f, 0x9f, 0xb9, 0xec, 0xf1, 0x97, 0xf0, 0xd9, 0xd2, 0xc8, 0xc1, 0xb6, 0xc1, 0xfa, 0xd1, 0xb0, 0x22, 0xd8, 0x50, 0x13, 0xb1, 0xb6, 0x81, 0xff, 0x42, 0xb6, 0x2a, 0xf7, 0xc9, 0x51, 0x4a, 0xab, 0xb8, 0xad, 0xe3, 0x12, 0xee, 0x02, 0x20, 0xe9, 0x03, 0x2f, 0x0c, 0xad, 0xd9, 0xee, 0x19, 0xde, 0x46, 0xb0, 0x35, 0x11, 0x1f, 0xb7, 0x1a, 0x2a, 0x00, 0xc5, 0xf4, 0x15, 0x1c, 0xf4, 0x39, 0x0b, 0x0d, 0x0a, 0xeb, 0xef, 0xdd, 0xb8, 0xb3, 0x01, 0xa9, 0xb7, 0xf3, 0x14, 0xd4, 0x3d, 0xe0, 0xd7, 0x34, 0x04, 0x2e, 0xfe, 0xe7, 0x07, 0x3c, 0x20, 0xfb, 0xd8, 0x1c, 0x45, 0x29, 0xef, 0xcd, 0xc4, 0xf8, 0x01, 0x20, 0xb0, 0x44, 0xfe, 0x43, 0x0e, 0x36, 0xa5, 0x42, 0x0a, 0xdb, 0x0b, 0x31, 0xd1, 0x21, 0xdb, 0xc1, 0xde, 0xfb, 0xde, 0xb6, 0x22, 0x06, 0xfd, 0xf1, 0x7f, 0x30, 0xd3, 0x02, 0xc5, 0xf9, 0x22, 0xd0, 0xfe, 0x45, 0xe6, 0xbc, 0xed, 0x28, 0xf6, 0xf7, 0xc4, 0x1a, 0x13, 0x8f, 0xc3, 0xce, 0xf1, 0x3b, 0x26, 0xea, 0xeb, 0xe2, 0x39, 0x33, 0x0f, 0xc8, 0x0a, 0x41, 0xd2, 0xf4, 0x08, 0x09, 0x34, 0xed, 0x3f, 0xe6, 0xc7, 0x42, 0x1e, 0x39, 0xd8, 0xf9, 0x42, 0x21, 0x11, 0xc9, 0xca, 0xef, 0x06, 0xda, 0xe0, 0x26, 0xf3, 0xf8, 0xbc, 0x9a, 0x3f, 0xf5, 0xc6, 0xe4, 0xbb, 0xf3, 0x3f, 0x9e, 0xf1, 0x44, 0xbc, 0xc7, 0xad, 0x05, 0xff, 0xc0, 0x0c, 0xfa, 0xf8, 0x19, 0xd2, 0xde, 0x07, 0x0c, 0x08, 0xee, 0xa3, 0x15, 0x0d, 0xe4, 0x12, 0x04, 0x07, 0x00, 0x1a, 0xf9, 0xe2, 0xf2, 0xff, 0xc7, 0xf2, 0xed, 0x15, 0x01, 0x08, 0xf8, 0x19, 0x1b, 0x06, 0xfa, 0xff, 0x12, 0x9b, 0x09, 0x0d, 0x05, 0x1f, 0xc6, 0xe3, 0xf3, 0x17, 0xc1, 0xd7, 0xed, 0x06, 0xcd, 0xff, 0xec, 0xff, 0x04, 0xf5, 0x0f, 0x17, 0xef, 0x17, 0x06, 0xeb, 0xfa, 0x12, 0xec, 0xf9, 0xf2, 0x07, 0xe8, 0x22, 0x0d, 0xee, 0xee, 0xe2, 0x0d, 0xde, 0xe8, 0x07, 0xbe, 0xe4, 0x17, 0xc1, 0xf3, 0xf8, 0x04, 0x09, 0x01, 0x20, 0xdb, 0xfa, 0x07, 0xf9, 0x19, 0x07, 0x02, 0xee, 0x0c, 0x2c, 0xcd, 0x17, 0x15, 0x1a, 0x20, 0xe6, 0xf9, 0x81, 0x15, 0x07, 0x0c, 0xe4, 0xf4, 0x0d, 0xee, 0x03, 0xf5, 0xe6, 0xee, 0xe3, 0xf2, 0x1d, 0xf2, 0x3e, 0xe1, 0xf8, 0x16, 0x06, 0x14, 0xc2, 0xfd, 0xdb, 0xe3, 0x0c, 0x0d, 0xef, 0xd6, 0x2f, 0xc3, 0xf8, 0xfe, 0xdc, 0xd5, 0x1b, 0xea, 0xc2, 0x2d, 0x20, 0xf1, 0xcb, 0xff, 0xc4, 0xd0, 0x30, 0xb2, 0x15, 0xe4, 0x0e, 0xe1, 0xc4, 0xd7, 0x15, 0x38, 0x2e, 0xf0, 0xcb, 0x22, 0xca, 0xcf, 0xd2, 0xcc, 0xd4, 0xdd, 0x1d, 0xe5, 0xf5, 0x45, 0xfb, 0xe5, 0x0d, 0x0b, 0xd8, 0xb2, 0xdb, 0xb4, 0xa4, 0xfe, 0x0c, 0xb5, 0xd7, 0x0f, 0xab, 0x15, 0x1d, 0x28, 0xcf, 0x14, 0x1f, 0xf3, 0xf9, 0xb7, 0xee, 0x29, 0xbf, 0x0a, 0xd0, 0xc7, 0x20, 0x35, 0xc3, 0x2f, 0xf8, 0xe3, 0xc1, 0xcd, 0x43, 0x14, 0x07, 0x08, 0xec, 0xda, 0x1e, 0x0c, 0xe6, 0x20, 0xca, 0x16, 0x46, 0xfc, 0x02, 0x81, 0xfd, 0x35, 0x1f, 0x20, 0x14, 0x45, 0xa4, 0xfa, 0xe3, 0x03, 0xec, 0xb4, 0x1c, 0x36, 0xfd, 0xf7, 0xea, 0x2d, 0x36, 0xa5, 0x00, 0x0d, 0xbb, 0xba, 0x8b, 0xec, 0xfb, 0xe6, 0x11, 0x24, 0x0c, 0x01, 0x17, 0xe0, 0xf6, 0x1d, 0x1b, 0xd0, 0x16, 0x29, 0xc9, 0x27, 0xda, 0x30, 0xda, 0xed, 0x31, 0xe0, 0x7f, 0xf9, 0xd3, 0x0f, 0x11, 0xfa, 0x01, 0xd3, 0x1d, 0xd4, 0x05, 0x11, 0xe4, 0x0b, 0xc2, 0x09, 0xb1, 0x16, 0xbe, 0xe8, 0xd1, 0xfb, 0xe5, 0xe0, 0xe8, 0xc0, 0x1e, 0x02, 0x34, 0xe4, 0xf4, 0x10, 0xfd, 0x24, 0x0b, 0x08, 0x1c, 0xd9, 0x19, 0xc6, 0x18, 0xf3, 0x26, 0x0f, 0xf3, 0xce, 0xf0, 0x14, 0x05, 0x06, 0xe6, 0x1b, 0xf5, 0xd8, 0x22, 0xe5, 0xef, 0xc2, 0xe1, 0xcc, 0x14, 0x01, 0xca, 0x27, 0xce, 0xfb, 0x2e, 0x0c, 0xe3, 0xcf, 0xef, 0x02, 0x13, 0x31, 0x24, 0xf6, 0x0d, 0xb6, 0x2c, 0x08, 0x08, 0xcc, 0xd6, 0xfb, 0xc7, 0x0c, 0xe0, 0xf5, 0x29, 0x1c, 0x16, 0xef, 0xd5, 0xe7, 0xee, 0xd8, 0x1b, 0x09, 0xf9, 0xf9, 0x2c, 0xfd, 0x25, 0x19, 0xcd, 0x20, 0xe8, 0x0e, 0xe4, 0x04, 0x0b, 0x14, 0x06, 0xe3, 0x81, 0xfd, 0xfd, 0xff, 0xfd, 0x14, 0xfe, 0xeb, 0x00, 0x0d, 0x14, 0xe2, 0xc4, 0xd8, 0xf0, 0xcd, 0x04, 0xe1, 0xfa, 0x13, 0x06, 0xfc, 0x0c, 0xdb, 0xe2, 0xf8, 0x13, 0x11, 0x03, 0x01, 0xfb, 0xe5, 0xbf, 0xfa, 0x04, 0x07, 0xf5, 0xf7, 0x07, 0x0c, 0x2a, 0xe9, 0xe8, 0x05, 0xff, 0xf5, 0xeb, 0xea, 0xd5, 0x06, 0xa2, 0xf4, 0x15, 0x04, 0xdd, 0x18, 0x10, 0xe8, 0xfb, 0xc1, 0xe0, 0x01, 0xe6, 0x02, 0xe9, 0xf6, 0xe1, 0xf9, 0x08, 0x09, 0x08, 0x20, 0xf0, 0x02, 0xfb, 0xfb, 0xf8, 0xed, 0x0b, 0x1b, 0xfe, 0xfc, 0xf1, 0x04, 0x03, 0xe6, 0xf0, 0x1a, 0x10, 0xfc, 0xbf, 0x05, 0x03, 0xf1, 0xdc, 0x0d, 0x10, 0xf6, 0x0b, 0xf3, 0x09, 0x04, 0xff, 0xe7, 0xfe, 0xa3, 0xfb, 0xd1, 0x09, 0xf0, 0xfc, 0x18, 0x0e, 0x03, 0x0e, 0x11, 0xec, 0xff, 0x01, 0xe9, 0x0d, 0xfc, 0xf0, 0x20, 0xec, 0xf2, 0xb8, 0xe3, 0x37, 0xf7, 0x23, 0xf9, 0xa6, 0x1c, 0xef, 0x9d, 0x04, 0xdc, 0x16, 0xfa, 0x3f, 0x16, 0x08, 0xdb, 0x20, 0xc0, 0x24, 0x00, 0xfb, 0x19, 0xe5, 0xd6, 0xe0, 0x18, 0x02, 0x0b, 0x17, 0x03, 0xba, 0x20, 0xfd, 0x29, 0x02, 0xfe, 0xf8, 0xe7, 0x1a, 0x15, 0xcb, 0x10, 0x09, 0x0a, 0x30, 0x14, 0x1d, 0xf4, 0x81, 0xdb, 0x06, 0xfe, 0x1e, 0x0b, 0xb2, 0x1f, 0xf6, 0xf4, 0xe1, 0x36, 0xf8, 0x0b, 0x1d, 0x15, 0xd5, 0x03, 0xb2, 0xf8, 0x1b, 0x1f, 0xf5, 0x05, 0xef, 0xe3, 0x98, 0xe3, 0xe2, 0x1d, 0xde, 0x19, 0x22, 0xc3, 0x20, 0x03, 0x13, 0x25, 0xef, 0x1d, 0xed, 0x0e, 0xfe, 0x04, 0xf9, 0xba, 0xfa, 0x06, 0xe4, 0xed, 0xa7, 0xec, 0x1b, 0x13, 0xbf, 0x03, 0x0d, 0xb8, 0xe7, 0x33, 0x07, 0xc3, 0x20, 0x13, 0xf0, 0x29, 0xc9, 0x1d, 0xfc, 0xc2, 0x06, 0xed, 0x0b, 0x10, 0xcf, 0x0e, 0x10, 0xe8, 0xd2, 0xf9, 0x17, 0x0e, 0x0b, 0x08, 0xa7, 0xe3, 0x12, 0xed, 0x25, 0xf2, 0x1b, 0x16, 0x2f, 0x07, 0xff, 0xe6, 0xf2, 0x9d, 0x1b, 0x0c, 0x09, 0x07, 0xfa, 0x14, 0x07, 0x15, 0x10, 0x0f, 0x03, 0xec, 0xc0, 0x17, 0x00, 0xfb, 0xf5, 0x01, 0x1d, 0xfe, 0x11, 0x08, 0xf3, 0x19, 0x18, 0xf6, 0xe8, 0x04, 0x03, 0xf0, 0xea, 0xe2, 0x23, 0x12, 0x16, 0x11, 0x81, 0xf8, 0xeb, 0x0a, 0xfa, 0x10, 0x13, 0x01, 0x0c, 0x30, 0xc2, 0xfd, 0xed, 0x10, 0xee, 0x05, 0x0a, 0x0b, 0x01, 0x14, 0xe4, 0xee, 0xf3, 0x0e, 0xf4, 0x0d, 0xec, 0xe5, 0x0c, 0xe9, 0x16, 0xf2, 0xed, 0xe8, 0x05, 0xf2, 0xdc, 0x0f, 0xe4, 0xd6, 0xf6, 0xe4, 0xf9, 0x00, 0xbb, 0x01, 0x0e, 0x1d, 0xcb, 0xff, 0x01, 0xaf, 0x16, 0x07, 0x0b, 0xdf, 0x09, 0xff, 0xf4, 0x0c, 0xfd, 0x1c, 0xf4, 0xe9, 0x19, 0xf1, 0x07, 0xf5, 0x00, 0xef, 0x0c, 0x09, 0x00, 0xf1, 0x04, 0xec, 0xfc, 0xff, 0x03, 0x13, 0xe7, 0x01, 0xd3, 0x13, 0xe6, 0xf1, 0x07, 0x03, 0x0e, 0x10, 0xef, 0x23, 0x10, 0x0e, 0x0b, 0x13, 0xee, 0xe0, 0xec, 0xfe, 0xfc, 0xe4, 0xec, 0xfe, 0x10, 0x02, 0x01, 0xf0, 0x0e, 0x0c, 0xed, 0xf6, 0x02, 0xd7, 0xed, 0xf5, 0xf3, 0xec, 0xfc, 0x07, 0x06, 0x16, 0xfe, 0xfb, 0x08, 0xee, 0x14, 0xee, 0x81, 0x0f, 0xfa, 0x00, 0x04, 0x0b, 0xf8, 0xfb, 0xfe, 0xc3, 0x02, 0x04, 0xf5, 0x0c, 0xf0, 0xf6, 0xfb, 0x00, 0xfb, 0x11, 0xfb, 0xf8, 0xfd, 0x0b, 0x07, 0xfc, 0x0a, 0x00, 0x0c, 0xfd, 0x09, 0xed, 0xfa, 0xff, 0x0a, 0xf3, 0x05, 0xf5, 0x0c, 0x08, 0x03, 0xf7, 0x02, 0xfa, 0x03, 0xf0, 0xec, 0xf0, 0x0b, 0x06, 0xf3, 0x10, 0x03, 0x0a, 0xec, 0xee, 0x05, 0xfe, 0x10, 0xf3, 0xf6, 0x10, 0x03, 0x0a, 0xcd, 0x00, 0xe8, 0x18, 0x08, 0x0d, 0x19, 0x06, 0x24, 0xf5, 0xe8, 0xdb, 0x18, 0xe7, 0xf6, 0xea, 0x1c, 0x0f, 0xf4, 0x0e, 0x01, 0x31, 0xf4, 0xca, 0x19, 0xf0, 0x02, 0x14, 0x1f, 0x16, 0x09, 0x09, 0x07, 0x03, 0xe8, 0x04, 0xee, 0xd2, 0xf4, 0x20, 0x04, 0xfb, 0x1b, 0xea, 0xfc, 0x01, 0x04, 0x17, 0xe1, 0x08, 0xe9, 0xdc, 0xd7, 0x0f, 0x81, 0xb6, 0x24, 0xc2, 0x0e, 0xd6, 0x18, 0x0c, 0x25, 0x0b, 0x17, 0x08, 0x29, 0xe3, 0x29, 0xd2, 0x18, 0xd6, 0x15, 0x1b, 0x10, 0xe5, 0x00, 0xec, 0x13, 0x48, 0xdf, 0xe4, 0xef, 0x26, 0x08, 0xf1, 0x2e, 0xff, 0x15, 0x24, 0x2b, 0x03, 0xdc, 0xe2, 0xe1, 0x1e, 0x01, 0x29, 0x12, 0x16, 0x03, 0x26, 0x1a, 0xf1, 0x0d, 0xff, 0x19, 0xf1, 0x0f, 0x06, 0xcf, 0x1b, 0x33, 0xde, 0xea, 0x50, 0xf8, 0xb6, 0xcc, 0x1b, 0xe6, 0x16, 0x16, 0xf2, 0xf2, 0xf6, 0x11, 0xfe, 0x1a, 0xe4, 0x05, 0x01, 0x27, 0x10, 0x00, 0xea, 0x08, 0x02, 0xfc, 0x0b, 0xf7, 0x00, 0xf2, 0xf7, 0x08, 0x1f, 0x26, 0xde, 0xda, 0x58, 0xfb, 0x82, 0xae, 0xc6, 0x16, 0x31, 0xec, 0xd8, 0xec, 0x08, 0x03, 0x0f, 0x2a, 0xdc, 0xde, 0xf0, 0xf1, 0x20, 0xfb, 0xff, 0xf1, 0xfd, 0xf3, 0x05, 0x1d, 0x28, 0xdf, 0x0c, 0x05, 0x10, 0x11, 0xdb, 0xdf, 0xa4, 0x0f, 0xae, 0x2e, 0x05, 0xfe, 0xde, 0x1e, 0xe9, 0x82, 0x1f, 0x2a, 0x28, 0x06, 0xa6, 0xe0, 0x19, 0x18, 0xc6, 0x17, 0x13, 0x47, 0xfc, 0xec, 0xbf, 0xeb, 0x0e, 0x21, 0x1c, 0x28, 0xda, 0x21, 0xda, 0x2b, 0xf9, 0xf3, 0xe1, 0xcc, 0xfe, 0x22, 0xec, 0xff, 0x10, 0x0a, 0xf9, 0x1b, 0xf3, 0xdf, 0xe8, 0xef, 0xff, 0x25, 0xfb, 0xdc, 0xe6, 0xf1, 0x04, 0xe4, 0x2c, 0xdf, 0xb1, 0xd6, 0xa5, 0xa9, 0x0f, 0x81, 0xf9, 0x11, 0xe7, 0x1a, 0x1d, 0x0b, 0xfa, 0x14, 0x17, 0xb7, 0xe1, 0xc8, 0x12, 0xf4, 0x45, 0xcf, 0xbc, 0xef, 0xec, 0xb8, 0xca, 0xb1, 0x42, 0xf1, 0xd3, 0xf9, 0x0d, 0xf4, 0xfe, 0x17, 0xd8, 0xe0, 0x2b, 0xf4, 0xcd, 0xdb, 0x44, 0xf9, 0x29, 0x29, 0x16, 0x40, 0xdf, 0x1e, 0xcb, 0xba, 0xe8, 0xf7, 0xe5, 0xf2, 0x17, 0x04, 0xff, 0x46, 0x2d, 0x08, 0x0b, 0x19, 0x33, 0xe8, 0x1f, 0xc8, 0x81, 0x1e, 0xc8, 0xd0, 0x12, 0xb4, 0x2c, 0x05, 0xc1, 0x9e, 0xbc, 0x20, 0xd5, 0xdc, 0xf6, 0x06, 0xc7, 0x1d, 0x26, 0x0f, 0xe2, 0xea, 0xb8, 0x47, 0xbc, 0x41, 0x31, 0x39, 0xe6, 0x33, 0x3a, 0xf2, 0xd2, 0xd9, 0xc5, 0xb9, 0xfd, 0x39, 0x09, 0xd6, 0xe6, 0xfb, 0xcb, 0xe6, 0x25, 0x01, 0xe3, 0x1c, 0xb0, 0xe9, 0xfb, 0xe9, 0x0a, 0xa5, 0x28, 0xeb, 0xef, 0x32, 0x4c, 0x08, 0xd9, 0x19, 0xfe, 0xbc, 0xe0, 0xd4, 0x32, 0x0a, 0x10, 0xc7, 0xbc, 0x0b, 0xb7, 0xb1, 0x02, 0xf9, 0x83, 0xfa, 0xfa, 0x1f, 0xf6, 0xe6, 0xfb, 0xf4, 0x0b, 0xfd, 0x08, 0xa2, 0xec, 0x02, 0xfd, 0x09, 0x18, 0x07, 0xdd, 0x01, 0xd7, 0xf0, 0xc6, 0xe4, 0x00, 0xff, 0x0b, 0x01, 0xf9, 0xe8, 0xf8, 0x04, 0x00, 0x11, 0xf1, 0x08, 0x1e, 0xde, 0x09, 0x16, 0x09, 0x1b, 0xf0, 0x18, 0x0d, 0x1a, 0xb6, 0xe4, 0x02, 0x13, 0xb3, 0xfc, 0xf4, 0x1b, 0xd9, 0xeb, 0xee, 0x10, 0x20, 0x06, 0x09, 0x81, 0x09, 0xf3, 0xfe, 0xf4, 0xdd, 0xf0, 0xeb, 0xef, 0x1e, 0xec, 0xe7, 0x09, 0xf7, 0x11, 0xad, 0x16, 0xcc, 0x09, 0xfc, 0x00, 0xfb, 0xf5, 0x10, 0x09, 0x19, 0xf6, 0xcf, 0x00, 0x02, 0x1f, 0x00, 0x2f, 0xe1, 0x0f, 0x09, 0xe9, 0xa9, 0x02, 0x16, 0x17, 0x07, 0xf6, 0x1d, 0xe3, 0xe9, 0x0b, 0xfc, 0xc4, 0x15, 0x0d, 0xd6, 0xf7, 0xdd, 0xdc, 0xf0, 0xe0, 0x06, 0x19, 0xee, 0x1e, 0xdf, 0xe7, 0x1c, 0x0a, 0x06, 0x9f, 0xd8, 0xea, 0xc7, 0xaf, 0xc7, 0x85, 0x45, 0x95, 0xf6, 0x24, 0xec, 0xfa, 0xd7, 0x41, 0x05, 0x84, 0x02, 0x91, 0x08, 0xf9, 0xe0, 0xfd, 0xef, 0xe8, 0xc5, 0x33, 0xba, 0x3f, 0xfb, 0x53, 0xdc, 0xcc, 0xa8, 0xdb, 0x35, 0xea, 0x4e, 0xd0, 0x5d, 0x81, 0x1d, 0x3e, 0x8f, 0xe0, 0xf3, 0xc4, 0xde, 0x0c, 0x00, 0x0d, 0xc4, 0xce, 0x11, 0x4b, 0x8c, 0x44, 0x08, 0x36, 0xa4, 0x55, 0xec, 0xd0, 0xa5, 0xb8, 0x35, 0x46, 0xa5, 0xc7, 0xb8, 0xdc, 0xea, 0xf3, 0x4a, 0x01, 0xbf, 0x03, 0x9d, 0x33, 0xe7, 0xda, 0x15, 0x8e, 0xe2, 0x55, 0xd9, 0x2e, 0x3c, 0xfb, 0x0a, 0x1a, 0xf5, 0x11, 0xb5, 0xa4, 0xc8, 0x33, 0x38, 0x93, 0x84, 0x1c, 0xc1, 0xaf, 0x4b, 0xcc, 0x1b, 0x3d, 0xbd, 0xb9, 0x4e, 0xc0, 0x0c, 0xdb, 0x09, 0xba, 0xdb, 0xbb, 0xac, 0xd0, 0x46, 0xe7, 0x18, 0x33, 0x1d, 0xd8, 0xf2, 0x3f, 0x34, 0xe4, 0xd4, 0x04, 0xe0, 0xe3, 0xed, 0x17, 0xf8, 0xeb, 0x0c, 0x07, 0xfe, 0xd5, 0x0b, 0xff, 0x11, 0x09, 0x0d, 0x2a, 0x0b, 0x17, 0xbc, 0xe5, 0xcf, 0x04, 0x26, 0xe4, 0x21, 0xf9, 0xe1, 0xe9, 0x21, 0xfa, 0xe7, 0x1a, 0xd8, 0xf6, 0x19, 0xe3, 0xe8, 0x06, 0xe8, 0x28, 0xe3, 0x06, 0x20, 0xfd, 0xaa, 0xfc, 0x06, 0x1f, 0xe4, 0xf6, 0xb6, 0xea, 0xd3, 0x09, 0x18, 0x12, 0xd7, 0xe8, 0xf9, 0x81, 0xf6, 0x19, 0x24, 0x1a, 0xa4, 0xe8, 0xe8, 0x22, 0x21, 0x24, 0xfa, 0x1d, 0x0a, 0x04, 0xb2, 0xf1, 0xbd, 0x16, 0x22, 0xe7, 0x0b, 0x02, 0x06, 0x13, 0x04, 0xf9, 0x0d, 0x06, 0xea, 0xee, 0x07, 0xe9, 0xf0, 0x09, 0xfd, 0x0d, 0xa3, 0x1a, 0x03, 0x06, 0xff, 0x22, 0x1f, 0xdc, 0xeb, 0x03, 0xec, 0xd2, 0x27, 0x13, 0xed, 0x13, 0xa7, 0x8d, 0xff, 0xae, 0x08, 0x02, 0xe2, 0x02, 0xf7, 0xf4, 0x00, 0x0b, 0xfc, 0xee, 0x81, 0xf6, 0x0b, 0x17, 0xd9, 0x0a, 0xd3, 0x37, 0xdb, 0xe9, 0xf6, 0x0a, 0x13, 0x1e, 0x14, 0x01, 0xec, 0xb8, 0xe6, 0x27, 0x6e, 0xfb, 0xe8, 0x09, 0x15, 0xd4, 0xfc, 0xe3, 0xde, 0x11, 0x04, 0xdd, 0xf4, 0xe3, 0xbd, 0xde, 0xeb, 0x0b, 0xf3, 0x05, 0x10, 0xe1, 0xed, 0xe1, 0x0a, 0x2d, 0x0a, 0xe2, 0xe6, 0x19, 0xbf, 0xf3, 0xed, 0xe1, 0xbb, 0xf5, 0xdb, 0x0c, 0xfc, 0xda, 0xc3, 0xe6, 0x0c, 0x10, 0x0d, 0x24, 0xaa, 0xf3, 0x04, 0xfb, 0x06, 0x0a, 0xdc, 0x14, 0x24, 0x10, 0xae, 0xd6, 0xbb, 0xd6, 0x11, 0xff, 0xd6, 0x09, 0xed, 0x1b, 0x0b, 0x15, 0xd8, 0xfa, 0xfc, 0x1d, 0xd7, 0xec, 0xdc, 0x27, 0x09, 0xe2, 0xde, 0x0b, 0xf0, 0xc3, 0xf6, 0x0f, 0x0d, 0xe8, 0x18, 0xf3, 0x06, 0x05, 0x2f, 0xff, 0xef, 0x22, 0x3b, 0xab, 0x20, 0x08, 0x07, 0xe9, 0x03, 0xfb, 0xf4, 0xfc, 0xdb, 0x05, 0xf5, 0x1a, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd4, 0xf3, 0xff, 0xff, 0x25, 0xfb, 0xff, 0xff, 0x96, 0xfa, 0xff, 0xff, 0x40, 0x07, 0x00, 0x00, 0x32, 0x15, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x19, 0x11, 0x00, 0x00, 0x01, 0xf5, 0xff, 0xff, 0x74, 0x04, 0x00, 0x00, 0xf1, 0xed, 0xff, 0xff, 0x6d, 0x0d, 0x00, 0x00, 0xe1, 0xf7, 0xff, 0xff, 0x68, 0xf5, 0xff, 0xff, 0x5f, 0xe9, 0xff, 0xff, 0xa4, 0xe3, 0xff, 0xff, 0x5f, 0xfa, 0xff, 0xff, 0xfb, 0xf3, 0xff, 0xff, 0x10, 0xfc, 0xff, 0xff, 0x0e, 0x0a, 0x00, 0x00, 0x2c, 0x20, 0x00, 0x00, 0x9c, 0x0c, 0x00, 0x00, 0xc2, 0xf4, 0xff, 0xff, 0xb5, 0xfc, 0xff, 0xff, 0xcf, 0xd2, 0xff, 0xff, 0x78, 0xfb, 0xff, 0xff, 0x5d, 0xee, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x1a, 0xf1, 0xff, 0xff, 0x73, 0xf8, 0xff, 0xff, 0x5c, 0xfc, 0xff, 0xff, 0x8b, 0xea, 0xff, 0xff, 0x4d, 0xf9, 0xff, 0xff, 0xde, 0xee, 0xff, 0xff, 0x68, 0xde, 0xff, 0xff, 0x2c, 0x0f, 0x00, 0x00, 0xfc, 0xfb, 0xff, 0xff, 0x84, 0xfb, 0xff, 0xff, 0x7f, 0xf4, 0xff, 0xff, 0xdc, 0xf8, 0xff, 0xff, 0x19, 0xf6, 0xff, 0xff, 0xe0, 0xf4, 0xff, 0xff, 0x37, 0xed, 0xff, 0xff, 0x8c, 0x0b, 0x00, 0x00, 0x62, 0xfa, 0xff, 0xff, 0xc7, 0xf1, 0xff, 0xff, 0x2d, 0xe8, 0xff, 0xff, 0xb1, 0x07, 0x00, 0x00, 0x9e, 0x0b, 0x00, 0x00, 0xa0, 0xf5, 0xff, 0xff, 0xaf, 0xed, 0xff, 0xff, 0x01, 0x15, 0x00, 0x00, 0x18, 0xf7, 0xff, 0xff, 0x03, 0xeb, 0xff, 0xff, 0x57, 0x0d, 0x00, 0x00, 0xe1, 0xef, 0xff, 0xff, 0x87, 0xf1, 0xff, 0xff, 0xc3, 0xfb, 0xff, 0xff, 0x5a, 0x0a, 0x00, 0x00, 0xa5, 0x04, 0x00, 0x00, 0x2d, 0xf4, 0xff, 0xff, 0x28, 0x12, 0x00, 0x00, 0xe4, 0xf5, 0xff, 0xff, 0xcd, 0x11, 0x00, 0x00, 0x4e, 0xf6, 0xff, 0xff, 0x26, 0xf6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1e, 0xe9, 0xec, 0x17, 0x23, 0x12, 0x73, 0x6a, 0xff, 0x53, 0x2d, 0xca, 0xee, 0x60, 0x12, 0xc1, 0x32, 0x29, 0xd1, 0x73, 0xf2, 0x63, 0x8e, 0x2c, 0x27, 0xea, 0x0d, 0xf0, 0x5a, 0x30, 0x65, 0x97, 0x19, 0xc0, 0xd6, 0xf6, 0x81, 0x69, 0xe4, 0x3e, 0x15, 0x3d, 0xe5, 0x4c, 0x4b, 0x12, 0x31, 0x42, 0x05, 0x98, 0x16, 0xd6, 0x60, 0xfb, 0xbc, 0x1c, 0x79, 0x0d, 0x0d, 0xf4, 0x1e, 0xfa, 0x3e, 0x57, 0x16, 0x03, 0x15, 0x12, 0xfc, 0xbb, 0xd2, 0x0f, 0x9b, 0x14, 0x0c, 0xee, 0x04, 0xfc, 0xfc, 0x27, 0x1a, 0xab, 0x0c, 0xfc, 0xf2, 0x18, 0xca, 0x3b, 0x15, 0x07, 0xd3, 0x1d, 0x09, 0x22, 0xf1, 0xe0, 0xee, 0x81, 0xf3, 0xe3, 0xfc, 0xb9, 0x29, 0xbd, 0xf1, 0x12, 0xf8, 0x2c, 0xfb, 0x28, 0x09, 0x0b, 0xcf, 0x04, 0xfe, 0xee, 0xb8, 0xe3, 0x3b, 0x0a, 0xb0, 0xed, 0xf4, 0xdc, 0x04, 0x07, 0xfa, 0xe9, 0x08, 0xe7, 0xfa, 0xf0, 0xa2, 0xf9, 0x0d, 0xe9, 0xcb, 0xef, 0x09, 0xe3, 0x1d, 0x1d, 0x3c, 0x11, 0xf4, 0x3a, 0xf6, 0xde, 0xbd, 0x54, 0xf7, 0x6c, 0xe1, 0x0a, 0xeb, 0xfa, 0x04, 0xbe, 0xf5, 0x2f, 0xf6, 0xf8, 0xf6, 0x13, 0xd7, 0xf6, 0xea, 0x15, 0x2a, 0x03, 0x02, 0x1d, 0x0f, 0x36, 0x81, 0x00, 0x37, 0x0f, 0xc6, 0x01, 0x1e, 0xc2, 0x10, 0x4a, 0x3c, 0xf5, 0xc8, 0xf3, 0x8b, 0xf7, 0xb3, 0x0c, 0x17, 0x0d, 0x26, 0x42, 0x1d, 0xc3, 0x1f, 0x17, 0xf9, 0x1f, 0x09, 0xe0, 0x04, 0xe2, 0x33, 0xe8, 0x44, 0xd2, 0xb7, 0xff, 0xc2, 0x3c, 0xb2, 0xa0, 0x1d, 0xe1, 0xc8, 0xdc, 0xe5, 0x0e, 0x33, 0xd2, 0xe5, 0xf5, 0xbe, 0x7f, 0x20, 0xb3, 0x37, 0xff, 0xe0, 0x01, 0xf0, 0xff, 0xc6, 0xfd, 0xba, 0xef, 0x3e, 0xf4, 0xc8, 0xcc, 0x04, 0xda, 0xf4, 0xd8, 0xed, 0x25, 0xd7, 0x18, 0xe3, 0x25, 0xc1, 0x48, 0xfb, 0x11, 0xb5, 0xad, 0xc2, 0x33, 0xd7, 0xd3, 0x2e, 0x21, 0xbc, 0xc8, 0x34, 0x3a, 0xe8, 0xf6, 0xe5, 0x14, 0x4a, 0xc1, 0xfe, 0xda, 0xeb, 0xd1, 0x3e, 0xe8, 0x44, 0x26, 0x81, 0x31, 0x17, 0x08, 0x06, 0xd7, 0xe9, 0xf4, 0x22, 0x2f, 0xeb, 0x16, 0xe7, 0xd5, 0x3d, 0x00, 0x25, 0xfa, 0xe7, 0xd5, 0xcd, 0x2e, 0xd0, 0xd9, 0xe6, 0xb7, 0xd7, 0xdf, 0x01, 0x03, 0x17, 0x1b, 0xe1, 0x37, 0x15, 0xe2, 0x03, 0xf6, 0x16, 0xec, 0xdb, 0xad, 0x10, 0xfa, 0x5f, 0xde, 0xc4, 0xf0, 0x23, 0xf9, 0xf8, 0x2f, 0xcd, 0xc9, 0xa6, 0x01, 0xf1, 0xfd, 0x07, 0x2a, 0x2a, 0xc9, 0x2c, 0x37, 0x1e, 0xed, 0xde, 0xf9, 0xc8, 0xd9, 0x81, 0xd9, 0xd0, 0xe3, 0xd5, 0x06, 0xe9, 0xcf, 0xc8, 0xfb, 0xc5, 0x19, 0xe2, 0xb5, 0x3f, 0xe9, 0x15, 0x2e, 0xfb, 0x34, 0x06, 0xda, 0xc3, 0xd9, 0xd7, 0xf8, 0xe0, 0x50, 0xb0, 0xc6, 0xd0, 0x23, 0xdd, 0x45, 0xeb, 0xfc, 0x13, 0xde, 0xa7, 0x37, 0xb6, 0x3f, 0xda, 0xfe, 0x28, 0x81, 0x0f, 0x24, 0xa7, 0xb2, 0x4d, 0x2c, 0x30, 0xd9, 0x26, 0xf5, 0xdb, 0x00, 0xd4, 0xc7, 0xfd, 0xd8, 0xd8, 0xdc, 0xa0, 0x18, 0x97, 0xd8, 0x1f, 0x75, 0x35, 0xef, 0x95, 0x06, 0x4b, 0xe5, 0x33, 0xd4, 0x0d, 0x35, 0x5b, 0xff, 0xbc, 0x65, 0xa6, 0xbf, 0xeb, 0x46, 0xd5, 0xbc, 0xd7, 0xce, 0xdf, 0x05, 0x23, 0xee, 0x20, 0x0b, 0x81, 0x18, 0x03, 0x07, 0x12, 0x1c, 0x0b, 0x29, 0xf0, 0xeb, 0x31, 0x02, 0x17, 0xc9, 0xfb, 0xf9, 0x1d, 0x2d, 0x05, 0x1e, 0x0d, 0x36, 0x61, 0x24, 0xc1, 0xd8, 0x2f, 0x02, 0xca, 0xd5, 0x1d, 0x0a, 0x15, 0x0a, 0xfc, 0xfe, 0x16, 0x10, 0x11, 0x0b, 0x13, 0x22, 0x14, 0x07, 0x28, 0xf2, 0x28, 0xc4, 0xc8, 0x20, 0x9c, 0x0c, 0xe0, 0x02, 0x26, 0xf0, 0x20, 0x1a, 0x0e, 0xe4, 0x20, 0xcd, 0x06, 0x0d, 0xb7, 0xeb, 0xf0, 0xea, 0xeb, 0xdd, 0x09, 0x1e, 0xc6, 0xf1, 0x2e, 0x97, 0x1b, 0x12, 0x01, 0xc4, 0x98, 0x54, 0x08, 0xd9, 0xf1, 0xe7, 0x47, 0x03, 0xe7, 0x4e, 0xdc, 0x30, 0xb3, 0xfc, 0xee, 0xcb, 0x75, 0x44, 0x13, 0xf9, 0x49, 0x16, 0x04, 0xed, 0x67, 0xe8, 0x8d, 0x38, 0xf3, 0x21, 0xc9, 0xdd, 0x9b, 0x9f, 0x7f, 0x50, 0x6a, 0x3f, 0xc4, 0x1c, 0x25, 0xe3, 0x38, 0x19, 0xdf, 0x00, 0x3e, 0x39, 0xf7, 0xe5, 0x36, 0x2d, 0x05, 0x1e, 0xfa, 0xea, 0x04, 0xee, 0x21, 0x0f, 0x01, 0x3c, 0xa7, 0x40, 0x47, 0x2a, 0x07, 0x35, 0x00, 0x06, 0x0d, 0x18, 0x18, 0x06, 0x02, 0xf3, 0x24, 0x24, 0x81, 0x3a, 0x1f, 0x1d, 0x09, 0x31, 0x0e, 0x2e, 0xae, 0x18, 0x01, 0x16, 0x69, 0x1f, 0x0b, 0x49, 0x00, 0x0f, 0x1f, 0x48, 0x5b, 0x0c, 0x2e, 0x01, 0xf7, 0xfc, 0xfb, 0xe3, 0xc3, 0x38, 0x19, 0xd7, 0x08, 0x1f, 0x14, 0x1a, 0xea, 0x0e, 0x47, 0x38, 0xba, 0x02, 0x01, 0x35, 0x29, 0x0c, 0xdf, 0xf2, 0x81, 0xee, 0x16, 0x3e, 0x15, 0xbe, 0x10, 0xf3, 0x14, 0xd1, 0x0f, 0x00, 0x1c, 0x21, 0x1e, 0xef, 0x28, 0x01, 0x33, 0xed, 0x00, 0x4f, 0xeb, 0x31, 0xed, 0x06, 0xf3, 0xfb, 0x5d, 0xf2, 0xea, 0x18, 0xe7, 0x1a, 0x12, 0x1b, 0x10, 0x1d, 0x2c, 0x29, 0xb4, 0x15, 0x00, 0x21, 0x09, 0xf7, 0x25, 0xf0, 0x14, 0x15, 0x34, 0xfe, 0x3b, 0xd7, 0x06, 0xaf, 0x40, 0xde, 0x12, 0xa9, 0x16, 0x44, 0x99, 0xc1, 0xd7, 0x0c, 0x26, 0x1b, 0x14, 0x4d, 0xde, 0x1b, 0xef, 0xfb, 0x26, 0xcb, 0xfd, 0x40, 0x20, 0x0f, 0xde, 0x49, 0x0a, 0xe7, 0xed, 0x41, 0x2e, 0x33, 0xd2, 0x46, 0xbf, 0x10, 0x7f, 0xee, 0xbb, 0xe0, 0x1d, 0x21, 0xc9, 0x40, 0x44, 0x4e, 0x93, 0xfa, 0xe7, 0x03, 0x13, 0xd9, 0xce, 0x24, 0xcf, 0x20, 0xef, 0xe3, 0x5f, 0x36, 0x30, 0xd3, 0x2c, 0x0f, 0x56, 0xd1, 0x1d, 0xbe, 0xd4, 0xf7, 0xdd, 0x05, 0x22, 0x47, 0xbe, 0x1a, 0xc6, 0xef, 0x27, 0xda, 0x30, 0xc6, 0xda, 0x0b, 0xfa, 0xfd, 0xdf, 0xd2, 0x15, 0x1d, 0x2f, 0xe8, 0x1b, 0xd4, 0xf3, 0x24, 0x30, 0xee, 0x03, 0xf5, 0xa5, 0x54, 0x05, 0xf7, 0x52, 0xd3, 0x0a, 0x81, 0xce, 0xfa, 0x1d, 0xee, 0xd3, 0x28, 0x3d, 0x0d, 0x3d, 0x02, 0xfd, 0xe7, 0xfe, 0x09, 0x27, 0x4d, 0xc5, 0xaa, 0x3c, 0x5b, 0x26, 0x26, 0x12, 0xf9, 0xa2, 0x24, 0x0f, 0x33, 0x1c, 0x27, 0xea, 0x0c, 0xdf, 0xcf, 0x1a, 0x16, 0x3b, 0x01, 0x9b, 0x09, 0x09, 0xff, 0x38, 0xc2, 0x41, 0xb2, 0x74, 0x4f, 0xe1, 0x7f, 0xee, 0x20, 0x1b, 0xfe, 0x4a, 0x0a, 0xf7, 0x11, 0xca, 0xdc, 0x1c, 0x4a, 0xf5, 0xb6, 0x95, 0xd8, 0x60, 0x6e, 0x41, 0xbf, 0x27, 0xc5, 0x0c, 0x43, 0xac, 0xc9, 0xd1, 0xfe, 0xf6, 0xf2, 0x1c, 0x1e, 0x01, 0xdd, 0x0a, 0xf4, 0xda, 0xce, 0xe0, 0x74, 0x43, 0xfa, 0x39, 0xda, 0xfa, 0x0c, 0x21, 0x34, 0xd0, 0x31, 0x0b, 0x1e, 0xd5, 0xe6, 0x1b, 0x02, 0xec, 0xf9, 0x81, 0x8c, 0x71, 0xcf, 0xe1, 0xe1, 0x23, 0xdd, 0x3f, 0x0d, 0xf8, 0xdb, 0xff, 0x1d, 0xf2, 0x26, 0x91, 0x16, 0xe4, 0xe2, 0xa7, 0xda, 0xce, 0x11, 0x0f, 0x31, 0xf1, 0xdc, 0xc2, 0xcc, 0xd1, 0xf3, 0x1a, 0xe3, 0x0d, 0x35, 0xff, 0x15, 0x81, 0xc3, 0x89, 0x17, 0xef, 0x10, 0x04, 0x14, 0xfe, 0xe5, 0xb8, 0xf4, 0xd6, 0x02, 0xf0, 0x39, 0x43, 0x40, 0x14, 0x26, 0x38, 0xeb, 0x3a, 0xe8, 0xd6, 0x68, 0xbf, 0x2f, 0xf3, 0x3b, 0x1a, 0x17, 0xfd, 0xf3, 0xa2, 0x44, 0x13, 0x38, 0xe9, 0xa2, 0xb4, 0x1b, 0x14, 0xc2, 0x1d, 0xd5, 0xfd, 0xd7, 0x29, 0xfe, 0xa5, 0xf8, 0xe7, 0x21, 0xc2, 0x2b, 0xed, 0xf2, 0x97, 0xc5, 0x0d, 0xd1, 0x26, 0xaa, 0x3d, 0x9d, 0x34, 0x2f, 0xd9, 0xbd, 0x04, 0x96, 0x6e, 0xfe, 0x44, 0x1d, 0x1a, 0x00, 0xfe, 0x0e, 0x0e, 0xc8, 0x13, 0xfb, 0xd1, 0xe3, 0xc6, 0x3b, 0x4f, 0xe1, 0x3a, 0xb5, 0xf4, 0xa5, 0x1e, 0x81, 0x06, 0x25, 0x4b, 0xf1, 0x00, 0x02, 0x1a, 0x3e, 0xba, 0x12, 0xe6, 0x07, 0xc9, 0x12, 0x0a, 0xa1, 0xd5, 0xe0, 0x0b, 0x18, 0x0b, 0xe6, 0xfa, 0xd7, 0x42, 0x29, 0xcd, 0xe3, 0x03, 0xe9, 0x39, 0xdd, 0x2d, 0x95, 0x40, 0xe4, 0x59, 0xab, 0x33, 0x41, 0x81, 0xe8, 0x20, 0x4a, 0xe3, 0x14, 0x28, 0xff, 0x3c, 0xd7, 0xf6, 0xfe, 0xca, 0x20, 0xf1, 0x4b, 0x11, 0x09, 0x0c, 0xee, 0x14, 0xa4, 0xf6, 0x84, 0xea, 0x17, 0xe7, 0x17, 0x00, 0x24, 0x09, 0xbd, 0x2b, 0x3f, 0x9e, 0x09, 0xb8, 0x03, 0x47, 0x48, 0x8d, 0xba, 0x25, 0x39, 0x08, 0xdc, 0xf8, 0xa3, 0x2e, 0x02, 0xa2, 0xc0, 0x24, 0xe8, 0x08, 0x0c, 0x29, 0x02, 0x10, 0x35, 0xf7, 0x07, 0xed, 0x07, 0xf7, 0x81, 0x09, 0x30, 0x09, 0x01, 0xe3, 0xfe, 0x0a, 0xd8, 0x32, 0x15, 0xf8, 0xf3, 0x18, 0x0f, 0xf9, 0xa7, 0x2e, 0x08, 0x29, 0x14, 0x09, 0x26, 0x0e, 0x01, 0x1b, 0x0e, 0xf6, 0xc3, 0xdf, 0x1c, 0xc7, 0xfb, 0x21, 0x03, 0x17, 0x0f, 0xf9, 0x44, 0xe1, 0x0f, 0x26, 0x38, 0x14, 0xe4, 0x21, 0xe7, 0x0d, 0xb7, 0x72, 0x0e, 0xf2, 0x0f, 0x32, 0x5e, 0xc9, 0x3a, 0x89, 0x0f, 0xf4, 0x43, 0x25, 0xf3, 0x44, 0x42, 0xc7, 0xf5, 0xce, 0x2d, 0xf9, 0x4f, 0x10, 0x25, 0xfb, 0xd9, 0x4d, 0x05, 0x14, 0x81, 0xce, 0x20, 0xaa, 0x0e, 0xdf, 0xed, 0xd0, 0x6b, 0xef, 0xf2, 0xc8, 0x33, 0xf3, 0xf2, 0x4c, 0xc7, 0x1c, 0x25, 0x05, 0xd6, 0x10, 0x25, 0x0e, 0xc2, 0x2b, 0xdb, 0xc0, 0xcd, 0xd4, 0x1d, 0xfe, 0xee, 0xab, 0x12, 0xde, 0x37, 0xd6, 0xf8, 0xf0, 0x15, 0xa2, 0xf0, 0x40, 0xa3, 0xe4, 0xc4, 0x50, 0x13, 0x07, 0xfc, 0xd2, 0xc3, 0xc5, 0x37, 0x57, 0xae, 0x08, 0x31, 0x1e, 0xc5, 0x43, 0xf7, 0x20, 0xdc, 0x2f, 0xb0, 0x9b, 0xfb, 0xca, 0x1b, 0xc8, 0x2a, 0xe0, 0x0c, 0xdb, 0x36, 0xfa, 0x7f, 0xb8, 0xf4, 0xba, 0x11, 0xa3, 0xcd, 0x09, 0xd3, 0x61, 0x87, 0x3a, 0x25, 0x05, 0xd4, 0x08, 0xda, 0xdf, 0x2f, 0xfb, 0xf9, 0x81, 0xb5, 0xf9, 0x09, 0xeb, 0xf2, 0x48, 0x90, 0x40, 0x06, 0x45, 0xb2, 0x0f, 0x1c, 0x4e, 0xc2, 0xf0, 0xf0, 0x45, 0x53, 0x3b, 0xd4, 0xfc, 0xe6, 0xfd, 0xd0, 0x8e, 0x31, 0xf4, 0x70, 0xe5, 0x05, 0x0e, 0xec, 0x5c, 0xab, 0xce, 0xc3, 0x0a, 0xe5, 0x2b, 0x05, 0xb0, 0x24, 0x22, 0xc5, 0xe6, 0x3a, 0x19, 0x2e, 0xe5, 0x3b, 0x15, 0x3a, 0xe4, 0x13, 0xcf, 0x17, 0x3b, 0x24, 0x06, 0xf0, 0x18, 0xba, 0x14, 0xe8, 0xfe, 0xc5, 0xf2, 0x63, 0xa9, 0x5a, 0x37, 0xf6, 0xaf, 0xe7, 0xb3, 0xf9, 0x5f, 0xea, 0xe6, 0x04, 0xdc, 0x3d, 0x61, 0xc2, 0xab, 0x25, 0x38, 0x43, 0x1e, 0x40, 0x2e, 0x16, 0x3b, 0xa9, 0x10, 0xd8, 0xbc, 0xd5, 0x15, 0x74, 0x06, 0x3e, 0x27, 0xc8, 0x2d, 0xc9, 0xbe, 0xc3, 0x3b, 0x44, 0xc9, 0x28, 0x32, 0xc6, 0x81, 0x18, 0xe7, 0x1b, 0xe5, 0x11, 0x28, 0xe7, 0xd4, 0xbf, 0x29, 0xff, 0x81, 0x97, 0xe1, 0x0e, 0xf5, 0xac, 0xbb, 0x0f, 0xef, 0x46, 0xd7, 0xfa, 0x6b, 0x01, 0xbf, 0xc3, 0xa7, 0xec, 0x9d, 0x05, 0xef, 0x16, 0xb3, 0xf7, 0xcf, 0x35, 0xf7, 0xe0, 0x0a, 0xbf, 0xce, 0xc1, 0x17, 0xad, 0x35, 0xb2, 0x41, 0x0a, 0x2f, 0x30, 0x32, 0x29, 0xb4, 0xef, 0xe3, 0xaa, 0x4b, 0x30, 0xd1, 0xf2, 0x1f, 0x0e, 0x55, 0xfd, 0xf4, 0xde, 0xe6, 0x41, 0xed, 0x07, 0x26, 0xd4, 0x32, 0x2c, 0x03, 0xca, 0x9a, 0x84, 0xaf, 0x26, 0xd0, 0xe8, 0x28, 0xf3, 0xd5, 0x3c, 0x36, 0xbb, 0xbb, 0xdc, 0x81, 0xb0, 0xd0, 0xf2, 0xb2, 0x9d, 0xc1, 0x4f, 0xc3, 0x9c, 0x8a, 0xbd, 0x84, 0x00, 0x1a, 0xe6, 0x15, 0xaf, 0xa4, 0x39, 0xb0, 0xfa, 0x30, 0xb4, 0x8b, 0x8a, 0x14, 0xe4, 0xbb, 0x03, 0xad, 0xe0, 0xa6, 0x33, 0xde, 0xc0, 0x17, 0xc5, 0x30, 0x8c, 0x25, 0xc6, 0x05, 0x19, 0x21, 0xf0, 0xdb, 0x06, 0xd0, 0x02, 0xb1, 0x18, 0x0b, 0x81, 0xb5, 0xa8, 0xc3, 0x1d, 0x2e, 0x34, 0x0d, 0x25, 0x07, 0x01, 0x0c, 0x17, 0xf6, 0x0b, 0xcc, 0x38, 0x06, 0x20, 0x0a, 0xe6, 0xf2, 0xff, 0x43, 0x10, 0x26, 0x14, 0xf3, 0x23, 0xf6, 0x25, 0xf9, 0xe0, 0xc7, 0xfe, 0xdb, 0x23, 0x01, 0x84, 0xea, 0xef, 0x31, 0x0c, 0xb8, 0x25, 0x08, 0xed, 0x32, 0x11, 0xec, 0xe9, 0x09, 0x09, 0xcc, 0xdf, 0xdb, 0xac, 0xdc, 0xcb, 0x0a, 0x4d, 0xe8, 0xc2, 0x43, 0x1e, 0x07, 0x09, 0xfc, 0x0e, 0xf6, 0xfb, 0xb4, 0x06, 0x00, 0x19, 0xd7, 0x2e, 0xcf, 0xe4, 0x41, 0xf7, 0xbd, 0xd6, 0xee, 0x34, 0x0d, 0xf1, 0x2e, 0xeb, 0xee, 0xf6, 0xfc, 0xef, 0xec, 0xf8, 0x48, 0xdd, 0x49, 0xd7, 0x33, 0xa2, 0x81, 0xf6, 0x64, 0xfb, 0x26, 0x00, 0x47, 0xec, 0xed, 0xfc, 0xff, 0xea, 0x09, 0x03, 0xf4, 0x0d, 0x57, 0x14, 0x1c, 0xfa, 0x28, 0x09, 0xe6, 0xe7, 0x02, 0xf6, 0xc9, 0xfe, 0x29, 0x1f, 0x2f, 0xd9, 0xe5, 0xe1, 0x27, 0xd0, 0x33, 0xf1, 0xe8, 0xfe, 0x11, 0x46, 0xd2, 0x50, 0xf6, 0x05, 0x24, 0xd8, 0x26, 0x21, 0x4b, 0x22, 0x09, 0xf2, 0xbf, 0xbf, 0x43, 0xe9, 0x26, 0x7f, 0x31, 0x01, 0x0b, 0x14, 0x39, 0xd1, 0xe4, 0x16, 0x18, 0x21, 0xd6, 0xfb, 0x11, 0xed, 0x54, 0x24, 0xcf, 0x1b, 0x0e, 0xed, 0xfa, 0x42, 0xb0, 0x24, 0xe1, 0x01, 0xf8, 0xe3, 0x8b, 0xc0, 0xd9, 0xb5, 0xe0, 0xf2, 0xe0, 0xf0, 0x36, 0xeb, 0x3f, 0x42, 0xae, 0x0f, 0xcb, 0x9c, 0xb8, 0xc9, 0x1a, 0x5d, 0x38, 0x11, 0xde, 0x07, 0xd2, 0x13, 0xed, 0x29, 0xeb, 0x1f, 0xb2, 0xb2, 0xdf, 0x56, 0xc3, 0x2e, 0xea, 0x30, 0xe6, 0x2e, 0x49, 0x41, 0x96, 0xc3, 0x14, 0x49, 0x9c, 0x2f, 0x2d, 0x1d, 0x39, 0x1f, 0xd2, 0x4d, 0x0b, 0x21, 0x81, 0x1b, 0x96, 0xc8, 0xc7, 0xfb, 0xd9, 0x22, 0xf4, 0xd9, 0xba, 0xec, 0xd7, 0xa8, 0xc9, 0x02, 0x06, 0x2c, 0x76, 0x15, 0xaa, 0x50, 0xd3, 0x9c, 0x2d, 0x40, 0x25, 0x48, 0xd4, 0x31, 0x1b, 0xe4, 0xe2, 0x31, 0x36, 0x0a, 0x1f, 0x51, 0xf9, 0x9c, 0x13, 0xd4, 0xae, 0x21, 0xfa, 0xe5, 0xe3, 0x56, 0x81, 0x59, 0xbc, 0x0d, 0x35, 0x53, 0x3d, 0x0f, 0xcd, 0xd0, 0x3a, 0x29, 0xbe, 0x4a, 0x44, 0x3a, 0xf1, 0x3b, 0xe7, 0x09, 0x3f, 0x25, 0x2c, 0x48, 0x64, 0xe4, 0x3d, 0xfe, 0xe9, 0x28, 0x39, 0x54, 0xb9, 0xac, 0x0c, 0xf1, 0x08, 0x0b, 0x16, 0x21, 0x16, 0xd8, 0xc0, 0x52, 0x45, 0x0d, 0x13, 0x46, 0x7f, 0xcd, 0x6e, 0xac, 0xf1, 0x08, 0x29, 0x6c, 0x8c, 0x3a, 0xda, 0x2a, 0xfb, 0x28, 0x1a, 0x07, 0xd2, 0xf7, 0xca, 0xc7, 0x0d, 0xd3, 0x4b, 0x39, 0x55, 0x2e, 0xf5, 0xc0, 0x24, 0x03, 0x23, 0xca, 0x55, 0x21, 0x23, 0x2f, 0xec, 0xd3, 0xe4, 0x05, 0xf1, 0x0f, 0x32, 0x10, 0xe9, 0x15, 0xdc, 0x3f, 0x0a, 0x05, 0x17, 0x11, 0x16, 0xf8, 0xc9, 0xfe, 0x9e, 0x22, 0xf5, 0xee, 0x06, 0x31, 0x13, 0xcf, 0xd8, 0xe5, 0x0f, 0xec, 0xd3, 0x4d, 0xde, 0xec, 0x19, 0xf2, 0xf3, 0x08, 0xfb, 0xd6, 0xe3, 0x07, 0xf9, 0x0c, 0x81, 0xdb, 0x10, 0x0b, 0xc4, 0xd3, 0xf9, 0xac, 0xd0, 0x19, 0x00, 0xef, 0x10, 0xfc, 0x9c, 0xef, 0xe1, 0xff, 0x32, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xae, 0xec, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x9b, 0xe2, 0xff, 0xff, 0x03, 0xf9, 0xff, 0xff, 0x7b, 0xf9, 0xff, 0xff, 0x47, 0x19, 0x00, 0x00, 0x7c, 0xfc, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x4c, 0xf9, 0xff, 0xff, 0x5c, 0xfb, 0xff, 0xff, 0x42, 0x04, 0x00, 0x00, 0x71, 0x21, 0x00, 0x00, 0xf1, 0x07, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0xda, 0xdf, 0xff, 0xff, 0xf9, 0x04, 0x00, 0x00, 0x94, 0x0d, 0x00, 0x00, 0x6a, 0x07, 0x00, 0x00, 0x87, 0xf1, 0xff, 0xff, 0x30, 0xf3, 0xff, 0xff, 0x74, 0x0a, 0x00, 0x00, 0xde, 0xfc, 0xff, 0xff, 0x1f, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x46, 0xfa, 0xff, 0xff, 0x0b, 0x1b, 0x00, 0x00, 0xfe, 0xfa, 0xff, 0xff, 0x3d, 0xea, 0xff, 0xff, 0xcb, 0xeb, 0xff, 0xff, 0x4b, 0x11, 0x00, 0x00, 0x10, 0xf4, 0xff, 0xff, 0xbe, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xac, 0x25, 0x2c, 0xaf, 0xf4, 0xec, 0xd6, 0x1a, 0x2c, 0xfa, 0xe4, 0xdb, 0x81, 0xfc, 0x44, 0x32, 0x01, 0xf1, 0x2f, 0xd6, 0x19, 0x1e, 0xd7, 0x2e, 0xd9, 0x45, 0xb9, 0xfb, 0x32, 0x15, 0xc1, 0x1e, 0xe9, 0xc1, 0x97, 0xef, 0xf8, 0x1b, 0xc9, 0xae, 0xc0, 0xf9, 0x03, 0x4b, 0x0c, 0xcc, 0x0a, 0xc2, 0xf2, 0xe9, 0xde, 0xfe, 0x99, 0x49, 0xd5, 0x05, 0x31, 0x81, 0x1f, 0xcd, 0xca, 0xda, 0x2d, 0x90, 0x00, 0xc0, 0xe7, 0xdc, 0x0b, 0xb4, 0xf0, 0x12, 0x0c, 0x8b, 0x15, 0xe5, 0x1f, 0x18, 0x12, 0xf4, 0x08, 0xed, 0x16, 0xe6, 0xa6, 0x22, 0x09, 0xfe, 0xe9, 0xb2, 0x03, 0x05, 0xbd, 0x8e, 0x10, 0x81, 0x3f, 0x3d, 0x3d, 0x26, 0xe7, 0xb0, 0x14, 0xf3, 0x0e, 0x39, 0x31, 0xcb, 0x2e, 0x35, 0x08, 0x4c, 0xbf, 0x81, 0xe9, 0x25, 0x20, 0xac, 0x09, 0xec, 0x1b, 0xec, 0xef, 0xff, 0x0b, 0x11, 0x30, 0x10, 0x4a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x67, 0xfa, 0xff, 0xff, 0x71, 0x0e, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x41, 0xf5, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa4, 0x1b, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x00, 0x60, 0x1a, 0x00, 0x00, 0x8c, 0x18, 0x00, 0x00, 0xb0, 0x16, 0x00, 0x00, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xac, 0x09, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xaa, 0xe4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x94, 0xe4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x22, 0xe5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0xe5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3f, 0xd8, 0x00, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc2, 0xe5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0xac, 0xe5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x4c, 0x48, 0x3d, 0x58, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7a, 0xe6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x64, 0xe6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x7e, 0xf1, 0x1b, 0x3d, 0x58, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xb1, 0xb6, 0xcb, 0x3c, 0x52, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00, 0xbc, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2c, 0xf4, 0x8b, 0x3a, 0x14, 0x0c, 0x53, 0x3b, 0x59, 0x53, 0x18, 0x3b, 0x29, 0x54, 0xc3, 0x3a, 0x51, 0x0a, 0xc5, 0x3a, 0x49, 0x10, 0x23, 0x3a, 0x12, 0x1b, 0xec, 0x3a, 0x90, 0x66, 0xb9, 0x3a, 0x1d, 0x0e, 0x8f, 0x3a, 0x44, 0xe2, 0xc5, 0x3a, 0x11, 0x1d, 0x15, 0x3b, 0x69, 0xf8, 0xd5, 0x3a, 0xb5, 0x1e, 0x50, 0x3b, 0x04, 0x2a, 0x86, 0x38, 0x36, 0xe1, 0x46, 0x3b, 0x18, 0xf7, 0x07, 0x3b, 0x1c, 0xc4, 0x55, 0x3b, 0x33, 0x4a, 0xa9, 0x3a, 0x97, 0x06, 0x30, 0x3b, 0x62, 0x93, 0xd3, 0x3a, 0xeb, 0xb1, 0xd3, 0x39, 0xa5, 0xf9, 0x21, 0x3b, 0x4f, 0xfe, 0x73, 0x3b, 0xe0, 0xfa, 0x34, 0x3b, 0xbb, 0x73, 0x19, 0x3a, 0xb3, 0xa9, 0x24, 0x3b, 0xfc, 0x45, 0xc5, 0x39, 0xa1, 0xb4, 0xbb, 0x3a, 0x64, 0x0d, 0x22, 0x3a, 0x17, 0x45, 0x6e, 0x3a, 0x3f, 0xc9, 0xa3, 0x3a, 0xd3, 0x8f, 0x1d, 0x3b, 0x27, 0x0e, 0xbf, 0x3a, 0xbe, 0xcb, 0x42, 0x3a, 0x8a, 0xbf, 0x02, 0x3b, 0xec, 0xb0, 0x24, 0x3b, 0x56, 0x6a, 0x46, 0x3b, 0x63, 0x47, 0xba, 0x3a, 0x0a, 0x8c, 0x4d, 0x3b, 0xde, 0x62, 0x8a, 0x3a, 0xcc, 0x43, 0x10, 0x3b, 0xe4, 0x79, 0xf3, 0x3a, 0x6a, 0xb3, 0x8a, 0x3a, 0x34, 0xd4, 0xf7, 0x3a, 0x0e, 0x47, 0x51, 0x3a, 0x58, 0xe8, 0xc7, 0x3a, 0x15, 0xff, 0xdb, 0x3a, 0x22, 0x30, 0x4c, 0x3b, 0x0f, 0xd6, 0xb5, 0x3a, 0x96, 0x06, 0x9e, 0x3a, 0x34, 0x0d, 0x94, 0x3a, 0xa3, 0x46, 0x0f, 0x3b, 0x25, 0x99, 0x23, 0x3b, 0x32, 0x5a, 0xa1, 0x39, 0x45, 0xe6, 0x96, 0x3a, 0xbc, 0x22, 0x1b, 0x3b, 0x4e, 0xed, 0xce, 0x3a, 0x93, 0xcb, 0x86, 0x3a, 0xf6, 0x44, 0x83, 0x3a, 0xe4, 0x1d, 0x7b, 0x3a, 0xf2, 0x2c, 0x8e, 0x3a, 0xcd, 0x0c, 0x04, 0x3b, 0x75, 0x94, 0x66, 0x3b, 0xea, 0x47, 0xb8, 0x3a, 0x11, 0x05, 0xb1, 0x3a, 0xe0, 0x84, 0x1f, 0x3a, 0x58, 0x72, 0xc7, 0x3a, 0x3c, 0xf2, 0xe0, 0x3a, 0x8c, 0xe1, 0x3d, 0x3a, 0x7b, 0xb6, 0xd8, 0x3a, 0xd2, 0x19, 0xda, 0x3a, 0xe9, 0xf5, 0x60, 0x3b, 0xe9, 0x9b, 0x22, 0x3b, 0xc2, 0xf4, 0xb5, 0x39, 0x03, 0x9d, 0x21, 0x3b, 0x0c, 0x7e, 0xbd, 0x3a, 0x32, 0x0c, 0x6d, 0x3a, 0x1f, 0xd8, 0x26, 0x3b, 0x2e, 0x41, 0x52, 0x3a, 0x31, 0x01, 0x24, 0x3b, 0x34, 0x14, 0x9c, 0x3a, 0x04, 0x32, 0xce, 0x3a, 0x98, 0xd7, 0x09, 0x3b, 0x58, 0x09, 0xda, 0x3a, 0xfa, 0xfc, 0xe7, 0x3a, 0x2c, 0xcd, 0xc8, 0x3a, 0xd1, 0x91, 0x95, 0x3a, 0x38, 0xd0, 0xc6, 0x3a, 0xf3, 0xcf, 0xc6, 0x3a, 0x6a, 0x27, 0xea, 0x3a, 0x9f, 0x4b, 0x7e, 0x3a, 0x45, 0x5b, 0xd6, 0x3a, 0x69, 0xa5, 0x02, 0x3a, 0xff, 0xb0, 0x91, 0x3a, 0xdf, 0xca, 0x5f, 0x3a, 0x04, 0x18, 0x5f, 0x3a, 0x1d, 0x29, 0xc1, 0x3a, 0x6f, 0xd9, 0xc9, 0x3a, 0xb0, 0x70, 0x14, 0x3b, 0x1c, 0x8d, 0xd1, 0x3a, 0x4a, 0xd5, 0xb8, 0x3a, 0xae, 0x96, 0xf6, 0x3a, 0x24, 0xeb, 0xf0, 0x3a, 0x61, 0xec, 0xda, 0x3a, 0x19, 0x16, 0xf4, 0x39, 0x7b, 0x66, 0xcb, 0x3a, 0xed, 0x1e, 0x17, 0x3b, 0x88, 0xbe, 0x95, 0x3a, 0xfd, 0x2b, 0x19, 0x3b, 0x32, 0x4c, 0x13, 0x3b, 0x6a, 0x09, 0xe9, 0x3a, 0xaf, 0xa3, 0xc1, 0x3a, 0xa3, 0xb1, 0x74, 0x3a, 0x4e, 0xb2, 0x48, 0x3b, 0x4e, 0xa1, 0xbe, 0x3a, 0x2b, 0xac, 0xed, 0x3a, 0x98, 0xae, 0x32, 0x3b, 0x6f, 0x32, 0xc0, 0x3a, 0xe9, 0x1b, 0x3b, 0x39, 0x67, 0x29, 0xd4, 0x3a, 0x9b, 0xa1, 0xc9, 0x3a, 0xbb, 0x24, 0xce, 0x3a, 0x26, 0xd2, 0xf6, 0x3a, 0xf4, 0x89, 0xaf, 0x3a, 0x64, 0xcf, 0xd7, 0x3a, 0xc9, 0xb8, 0xf3, 0x3a, 0x8d, 0xb7, 0x3c, 0x3b, 0xdc, 0xe0, 0x4d, 0x3a, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x37, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd6, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x06, 0x00, 0x00, 0x14, 0xee, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x16, 0xa1, 0xb8, 0x39, 0x58, 0x35, 0x8b, 0x3a, 0x46, 0xf3, 0x48, 0x3a, 0x23, 0xd7, 0x00, 0x3a, 0x26, 0xf8, 0x01, 0x3a, 0xb7, 0x1d, 0x57, 0x39, 0xb9, 0xbc, 0x1b, 0x3a, 0x5b, 0x95, 0xf4, 0x39, 0x77, 0xb8, 0xbc, 0x39, 0x97, 0x86, 0x02, 0x3a, 0x82, 0xb6, 0x44, 0x3a, 0xf3, 0x22, 0x0d, 0x3a, 0x0d, 0x47, 0x89, 0x3a, 0xcd, 0xfd, 0xb0, 0x37, 0xc1, 0x2e, 0x83, 0x3a, 0x10, 0x5e, 0x33, 0x3a, 0x73, 0x00, 0x8d, 0x3a, 0x6e, 0x54, 0xdf, 0x39, 0x46, 0x37, 0x68, 0x3a, 0x97, 0x8e, 0x0b, 0x3a, 0xbc, 0xa2, 0x0b, 0x39, 0x21, 0xae, 0x55, 0x3a, 0xa1, 0xf0, 0xa0, 0x3a, 0x6a, 0xc0, 0x6e, 0x3a, 0xb6, 0x6f, 0x4a, 0x39, 0xd2, 0x39, 0x59, 0x3a, 0x81, 0x1f, 0x02, 0x39, 0xc8, 0x9f, 0xf7, 0x39, 0x2d, 0xc8, 0x55, 0x39, 0x28, 0x2a, 0x9d, 0x39, 0xb8, 0x11, 0xd8, 0x39, 0xa7, 0xdb, 0x4f, 0x3a, 0x0a, 0x0b, 0xfc, 0x39, 0x27, 0x7d, 0x80, 0x39, 0x2e, 0x7c, 0x2c, 0x3a, 0x59, 0x43, 0x59, 0x3a, 0x57, 0xe0, 0x82, 0x3a, 0xf2, 0xbd, 0xf5, 0x39, 0x97, 0x94, 0x87, 0x3a, 0xae, 0x8f, 0xb6, 0x39, 0x01, 0x51, 0x3e, 0x3a, 0x49, 0x99, 0x20, 0x3a, 0xf0, 0xf9, 0xb6, 0x39, 0x4b, 0x78, 0x23, 0x3a, 0x87, 0x0a, 0x8a, 0x39, 0x51, 0xdc, 0x03, 0x3a, 0x82, 0x1c, 0x11, 0x3a, 0x1c, 0xaf, 0x86, 0x3a, 0x91, 0xe1, 0xef, 0x39, 0x53, 0x78, 0xd0, 0x39, 0xdc, 0x4f, 0xc3, 0x39, 0x08, 0x03, 0x3d, 0x3a, 0x43, 0xd2, 0x57, 0x3a, 0xc8, 0xdb, 0xd4, 0x38, 0xa8, 0x11, 0xc7, 0x39, 0x4d, 0xa8, 0x4c, 0x3a, 0x9b, 0x7d, 0x08, 0x3a, 0xef, 0xd2, 0xb1, 0x39, 0x31, 0x2c, 0xad, 0x39, 0x7a, 0xa3, 0xa5, 0x39, 0x6c, 0x8f, 0xbb, 0x39, 0xd3, 0x33, 0x2e, 0x3a, 0xa2, 0x17, 0x98, 0x3a, 0x34, 0x1b, 0xf3, 0x39, 0xfc, 0x86, 0xe9, 0x39, 0xa5, 0x70, 0x52, 0x39, 0x7c, 0x8e, 0x03, 0x3a, 0x55, 0x60, 0x14, 0x3a, 0x7a, 0x7e, 0x7a, 0x39, 0x0a, 0xf2, 0x0e, 0x3a, 0x6d, 0xdc, 0x0f, 0x3a, 0xc1, 0x62, 0x94, 0x3a, 0x31, 0x84, 0x56, 0x3a, 0x11, 0x0a, 0xf0, 0x38, 0xed, 0x33, 0x55, 0x3a, 0x37, 0xfb, 0xf9, 0x39, 0xc5, 0x5b, 0x9c, 0x39, 0x80, 0x1a, 0x5c, 0x3a, 0x83, 0xaf, 0x8a, 0x39, 0x86, 0x5b, 0x58, 0x3a, 0xd9, 0xe6, 0xcd, 0x39, 0x12, 0x02, 0x08, 0x3a, 0xf2, 0xd7, 0x35, 0x3a, 0x8f, 0xd1, 0x0f, 0x3a, 0x6f, 0x05, 0x19, 0x3a, 0x41, 0x73, 0x04, 0x3a, 0x86, 0x50, 0xc5, 0x39, 0x8b, 0x23, 0x03, 0x3a, 0x5e, 0x23, 0x03, 0x3a, 0x25, 0x73, 0x1a, 0x3a, 0x38, 0xbc, 0xa7, 0x39, 0x28, 0x64, 0x0d, 0x3a, 0xb5, 0x59, 0x2c, 0x39, 0xc8, 0x32, 0xc0, 0x39, 0x82, 0x9d, 0x93, 0x39, 0x88, 0x27, 0x93, 0x39, 0x0b, 0xd2, 0xfe, 0x39, 0x34, 0x24, 0x05, 0x3a, 0x1a, 0xd3, 0x43, 0x3a, 0xbc, 0x38, 0x0a, 0x3a, 0xb5, 0xd5, 0xf3, 0x39, 0xda, 0xa6, 0x22, 0x3a, 0x68, 0xe9, 0x1e, 0x3a, 0x50, 0x67, 0x10, 0x3a, 0x52, 0x00, 0x21, 0x39, 0x19, 0x2a, 0x06, 0x3a, 0x66, 0x5c, 0x47, 0x3a, 0x84, 0x8b, 0xc5, 0x39, 0x12, 0x11, 0x4a, 0x3a, 0x3e, 0x51, 0x42, 0x3a, 0x7f, 0xb6, 0x19, 0x3a, 0xbe, 0x73, 0xff, 0x39, 0xea, 0x66, 0xa1, 0x39, 0x88, 0x61, 0x84, 0x3a, 0x72, 0x7b, 0xfb, 0x39, 0x4a, 0xc5, 0x1c, 0x3a, 0x59, 0xb8, 0x6b, 0x3a, 0x9f, 0x8c, 0xfd, 0x39, 0x50, 0xd6, 0x76, 0x38, 0x8c, 0xf1, 0x0b, 0x3a, 0x60, 0xff, 0x04, 0x3a, 0x4e, 0xf9, 0x07, 0x3a, 0x14, 0xce, 0x22, 0x3a, 0xda, 0x92, 0xe7, 0x39, 0x9c, 0x59, 0x0e, 0x3a, 0xc5, 0xc2, 0x20, 0x3a, 0x5b, 0xf5, 0x78, 0x3a, 0x8a, 0xcc, 0x87, 0x39, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x36, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x26, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x64, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x1c, 0x3b, 0x8e, 0x4c, 0x01, 0x3b, 0xfe, 0x90, 0xc5, 0x3b, 0xd1, 0x30, 0x99, 0x3b, 0x14, 0x81, 0xa7, 0x3b, 0xc1, 0x7e, 0x6f, 0x3b, 0xec, 0x2c, 0xbf, 0x3b, 0xec, 0xba, 0x80, 0x3b, 0x1c, 0x7b, 0xd3, 0x3b, 0xf6, 0xbf, 0x7e, 0x3b, 0x26, 0x96, 0xd0, 0x3b, 0x64, 0x9d, 0x24, 0x3b, 0x6a, 0xfe, 0x7f, 0x3b, 0xfb, 0x8a, 0x43, 0x3b, 0x88, 0xf6, 0x52, 0x3b, 0xb0, 0xb9, 0x7b, 0x3b, 0x03, 0x08, 0x8a, 0x3b, 0xcc, 0x1d, 0xeb, 0x3b, 0x5c, 0x9d, 0xb5, 0x3b, 0x55, 0x00, 0xa6, 0x3b, 0xd2, 0xd3, 0xc2, 0x3b, 0x09, 0xff, 0x27, 0x3b, 0x21, 0x63, 0xef, 0x3a, 0xba, 0xf7, 0x3f, 0x3b, 0x0c, 0x2f, 0x25, 0x3b, 0xe7, 0x1b, 0x72, 0x3b, 0x33, 0x90, 0x42, 0x3b, 0x0d, 0x17, 0x15, 0x3b, 0x13, 0x63, 0x6c, 0x3b, 0xca, 0xfb, 0x0d, 0x3b, 0x95, 0x02, 0x14, 0x3b, 0x06, 0xc7, 0xc9, 0x3b, 0x56, 0xf5, 0x01, 0x3b, 0x01, 0x11, 0x7e, 0x3b, 0x6f, 0x8c, 0xb5, 0x3b, 0xc6, 0x6c, 0x99, 0x3b, 0x9b, 0x70, 0x52, 0x3b, 0x4c, 0xe3, 0x73, 0x3b, 0x74, 0xb9, 0x03, 0x3b, 0x77, 0x30, 0xce, 0x3b, 0xfd, 0x77, 0xe4, 0x3a, 0x8c, 0x6c, 0xf3, 0x3a, 0xf3, 0x12, 0xaa, 0x3b, 0xb5, 0xe0, 0x64, 0x3b, 0xef, 0x30, 0x5b, 0x3b, 0xf6, 0xec, 0x8c, 0x3b, 0x92, 0x20, 0x0d, 0x3c, 0x18, 0x7e, 0x81, 0x3b, 0xa0, 0xdc, 0x07, 0x3b, 0x51, 0xaf, 0x27, 0x3b, 0x2e, 0x2e, 0xa9, 0x3b, 0xb6, 0xed, 0x26, 0x3b, 0x24, 0xc9, 0x5a, 0x3b, 0x92, 0xcd, 0xc1, 0x3b, 0xbb, 0x06, 0x96, 0x3b, 0xf3, 0x04, 0xc0, 0x3b, 0x60, 0x4e, 0x10, 0x3c, 0x0f, 0x28, 0x86, 0x3b, 0xb1, 0xb0, 0x81, 0x3b, 0x33, 0x8c, 0x18, 0x3b, 0x7a, 0xc1, 0xa5, 0x3b, 0x5d, 0x35, 0xf8, 0x3a, 0x9c, 0x67, 0x8f, 0x3b, 0x7a, 0xb4, 0x75, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x35, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x03, 0x00, 0x00, 0xbc, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x46, 0x8e, 0x78, 0x38, 0xf5, 0xc7, 0x4d, 0x38, 0xf7, 0x36, 0x1d, 0x39, 0x11, 0xce, 0xf3, 0x38, 0xe4, 0x4a, 0x05, 0x39, 0x6d, 0x94, 0xbe, 0x38, 0x0d, 0x21, 0x18, 0x39, 0x2e, 0xe0, 0xcc, 0x38, 0x8b, 0x49, 0x28, 0x39, 0x05, 0xb8, 0xca, 0x38, 0xeb, 0xfb, 0x25, 0x39, 0x48, 0xfe, 0x82, 0x38, 0x6e, 0xb5, 0xcb, 0x38, 0xc1, 0x9a, 0x9b, 0x38, 0x0b, 0xe0, 0xa7, 0x38, 0xe3, 0x4f, 0xc8, 0x38, 0xb7, 0xad, 0xdb, 0x38, 0x6b, 0x18, 0x3b, 0x39, 0x63, 0x85, 0x10, 0x39, 0xba, 0x18, 0x04, 0x39, 0x01, 0x09, 0x1b, 0x39, 0x20, 0xaf, 0x85, 0x38, 0x71, 0x7e, 0x3e, 0x38, 0x6f, 0xc2, 0x98, 0x38, 0x30, 0x72, 0x83, 0x38, 0xe7, 0xa8, 0xc0, 0x38, 0x31, 0xd3, 0x9a, 0x38, 0x5a, 0x47, 0x6d, 0x38, 0x42, 0x1b, 0xbc, 0x38, 0xf9, 0xf7, 0x61, 0x38, 0x59, 0x8f, 0x6b, 0x38, 0xd1, 0x90, 0x20, 0x39, 0x93, 0xd4, 0x4e, 0x38, 0xcc, 0x2c, 0xca, 0x38, 0xeb, 0x77, 0x10, 0x39, 0x7d, 0x2d, 0xf4, 0x38, 0x78, 0x75, 0xa7, 0x38, 0x49, 0x13, 0xc2, 0x38, 0x20, 0xa4, 0x51, 0x38, 0x93, 0x13, 0x24, 0x39, 0x31, 0xce, 0x35, 0x38, 0xca, 0xb4, 0x41, 0x38, 0x66, 0x56, 0x07, 0x39, 0x86, 0x21, 0xb6, 0x38, 0x3a, 0x6c, 0xae, 0x38, 0xf2, 0x48, 0xe0, 0x38, 0x15, 0x9b, 0x60, 0x39, 0xcc, 0x16, 0xce, 0x38, 0xcf, 0x39, 0x58, 0x38, 0xb0, 0x6f, 0x85, 0x38, 0x5a, 0xa0, 0x06, 0x39, 0xa0, 0xd5, 0x84, 0x38, 0xa2, 0x19, 0xae, 0x38, 0x51, 0x38, 0x1a, 0x39, 0xce, 0xc4, 0xee, 0x38, 0xf5, 0xcc, 0x18, 0x39, 0x43, 0xaa, 0x65, 0x39, 0x02, 0x83, 0xd5, 0x38, 0x53, 0x67, 0xce, 0x38, 0x13, 0xc8, 0x72, 0x38, 0xb6, 0xe6, 0x03, 0x39, 0x72, 0x83, 0x45, 0x38, 0xff, 0x3a, 0xe4, 0x38, 0x75, 0x85, 0xc3, 0x38, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x34, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xce, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb4, 0x01, 0x00, 0x00, 0x0c, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xda, 0xd0, 0x37, 0x3b, 0x9e, 0xd8, 0xa8, 0x3b, 0x63, 0x06, 0x74, 0x3b, 0x51, 0x53, 0x90, 0x3b, 0xe6, 0xae, 0x8a, 0x3b, 0xc5, 0x2c, 0x8d, 0x3b, 0xde, 0x19, 0x5d, 0x3b, 0x2c, 0x8e, 0xa3, 0x3b, 0xe3, 0xf6, 0x47, 0x3b, 0x78, 0xf0, 0xa1, 0x3b, 0x51, 0xb4, 0xa8, 0x3b, 0x8e, 0x0b, 0x3d, 0x3b, 0x8e, 0x5c, 0x8a, 0x3b, 0x95, 0xe5, 0x34, 0x3b, 0x67, 0x08, 0x63, 0x3b, 0x33, 0x83, 0x62, 0x3b, 0x32, 0xbc, 0x88, 0x3b, 0xfb, 0xaa, 0x7e, 0x3b, 0x20, 0x52, 0x95, 0x3b, 0xa9, 0x8a, 0x65, 0x3b, 0x0e, 0x21, 0x44, 0x3b, 0xcc, 0x72, 0x98, 0x3b, 0x02, 0xbb, 0x4d, 0x3b, 0x2c, 0x38, 0x42, 0x3b, 0xe5, 0xcd, 0x0b, 0x3b, 0xd6, 0xf3, 0x90, 0x3b, 0x7b, 0x13, 0x73, 0x3b, 0xcd, 0xba, 0x88, 0x3b, 0x2a, 0xfd, 0x76, 0x3b, 0x73, 0x3e, 0x73, 0x3b, 0x58, 0xa7, 0x55, 0x3b, 0xe4, 0x52, 0xa0, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x33, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x00, 0xe4, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb4, 0xf1, 0xdf, 0x38, 0xdd, 0xb4, 0x4d, 0x39, 0x10, 0xa6, 0x14, 0x39, 0x2f, 0xd5, 0x2f, 0x39, 0x70, 0xf5, 0x28, 0x39, 0x90, 0xfe, 0x2b, 0x39, 0x3c, 0xaf, 0x06, 0x39, 0xbc, 0x42, 0x47, 0x39, 0x3b, 0x9e, 0xf3, 0x38, 0xb7, 0x4a, 0x45, 0x39, 0xa4, 0x88, 0x4d, 0x39, 0xa8, 0x50, 0xe6, 0x38, 0x1e, 0x91, 0x28, 0x39, 0x4d, 0x63, 0xdc, 0x38, 0x41, 0x4c, 0x0a, 0x39, 0x1d, 0xfb, 0x09, 0x39, 0xdd, 0x95, 0x26, 0x39, 0xc2, 0x21, 0x1b, 0x39, 0x2a, 0xeb, 0x35, 0x39, 0x7d, 0xd3, 0x0b, 0x39, 0x0e, 0xf2, 0xee, 0x38, 0xa1, 0xba, 0x39, 0x39, 0x99, 0xa4, 0xfa, 0x38, 0x72, 0x9e, 0xec, 0x38, 0x17, 0x53, 0xaa, 0x38, 0xbf, 0x98, 0x30, 0x39, 0x18, 0x12, 0x14, 0x39, 0x2b, 0x94, 0x26, 0x39, 0x46, 0x74, 0x16, 0x39, 0x45, 0x2c, 0x14, 0x39, 0xde, 0x25, 0x02, 0x39, 0xda, 0x52, 0x43, 0x39, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x32, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00, 0xb4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbc, 0x8e, 0x1e, 0x3c, 0xdb, 0xd4, 0xb0, 0x3b, 0xbf, 0xdf, 0x55, 0x3c, 0xa4, 0x33, 0xb7, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x31, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x64, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xda, 0x1d, 0xf8, 0x39, 0x2c, 0x5b, 0x8a, 0x39, 0xc2, 0x56, 0x27, 0x3a, 0x21, 0x57, 0x8f, 0x39, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xdc, 0xa8, 0x3e, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
 };
 
 const unsigned int qdnn_fan_model_len = 19968;
 
+// CRC-32 (IEEE) of the array above, verified at boot
+const unsigned int qdnn_fan_model_crc32 = 0x66D5B4D9;
+
+// Input normalization: identity on top of the 0.1-unit conversion
+// (offset 0, scale 1.0), features temp / humid / soil% with the
+// deci-unit ranges the training distribution covered
+const QdnnModelMeta qdnn_fan_model_meta = {
+    3,
+    {
+        {0, 1.0f, 0, 500},     // temperature, 0.0 .. 50.0 C
+        {0, 1.0f, 200, 900},   // humidity, 20.0 .. 90.0 %RH
+        {0, 1.0f, 0, 1000},    // soil moisture, 0.0 .. 100.0 %
+        {0, 0.0f, 0, 0},
+    },
+};
+
 #endif // QDNN_FAN_MODEL_H
@@ -1,14 +1,33 @@
 #ifndef QDNN_PUMP_MODEL_H
 #define QDNN_PUMP_MODEL_H
 
+#include "model_meta.h"
+#include "model_storage.h"
+
 // Auto-generated TensorFlow Lite model
 // Model name: qdnn_pump_model_int8.tflite
 // Total bytes: 19968
 
-const unsigned char qdnn_pump_model[] = {
+const unsigned char QDNN_MODEL_STORAGE qdnn_pump_model[] = {
 0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xc4, 0x2f, 0x00, 0x00, 0xd4, 0x2f, 0x00, 0x00, 0x94, 0x4d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0xd0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x11, 0x00, 0x00, 0x00, 0xd4, 0x2e, 0x00, 0x00, 0xcc, 0x2e, 0x00, 0x00, 0xac, 0x2e, 0x00, 0x00, 0x1c, 0x2e, 0x00, 0x00, 0x8c, 0x2d, 0x00, 0x00, 0x7c, 0x25, 0x00, 0x00, 0x6c, 0x24, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xda, 0xd0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0x71, 0xe5, 0x20, 0xd4, 0x52, 0xd8, 0x47, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x32, 0x30, 0x2e, 0x30, 0x00, 0x00, 0x46, 0xd1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xd1, 0xff, 0xff, 0x34, 0xd1, 0xff, 0xff, 0x38, 0xd1, 0xff, 0xff, 0x3c, 0xd1, 0xff, 0xff, 0x40, 0xd1, 0xff, 0xff, 0x76, 0xd1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x3f, 0x30, 0x81, 0x24, 0xe3, 0x81, 0xb9, 0x81, 0x87, 0x7f, 0xbf, 0xcb, 0x61, 0x81, 0x4b, 0x81, 0xfa, 0x28, 0xd1, 0x32, 0x81, 0x81, 0x29, 0xfb, 0x3b, 0x0c, 0x81, 0xb1, 0x59, 0x81, 0x81, 0x23, 0xff, 0x03, 0x81, 0x86, 0x3b, 0x5f, 0x81, 0x7f, 0xbf, 0xf4, 0x81, 0xf3, 0x2e, 0x29, 0xd4, 0x81, 0x81, 0x62, 0xb2, 0x4a, 0x54, 0x81, 0x81, 0xce, 0xd6, 0x37, 0x09, 0x81, 0x81, 0xe3, 0x2c, 0x71, 0x81, 0xfa, 0x81, 0x10, 0x17, 0xba, 0x55, 0x81, 0x81, 0x3d, 0xd6, 0xb5, 0x6a, 0x81, 0x43, 0x9a, 0x7f, 0x03, 0xb7, 0x7f, 0xf8, 0x81, 0xb9, 0x8c, 0x81, 0x74, 0x81, 0x23, 0x17, 0xa8, 0xb4, 0x7f, 0x81, 0xe0, 0x26, 0xe9, 0x39, 0x81, 0xf3, 0x5f, 0x81, 0x50, 0x99, 0x7f, 0xe5, 0x94, 0x7f, 0xa0, 0xc8, 0x7f, 0x81, 0xe7, 0x36, 0x81, 0xfa, 0x26, 0x2f, 0x81, 0x96, 0x7f, 0x88, 0x25, 0x81, 0xa3, 0x44, 0x32, 0x8c, 0x81, 0x81, 0x8a, 0xd8, 0x27, 0x3d, 0x81, 0xaa, 0xb4, 0x7f, 0xb6, 0x39, 0x81, 0x81, 0x0d, 0x1a, 0x81, 0xd5, 0x82, 0x14, 0x58, 0x81, 0xa9, 0x76, 0x81, 0x81, 0xf3, 0x46, 0x56, 0x81, 0x0c, 0x6f, 0x81, 0x26, 0x81, 0x8b, 0x49, 0x81, 0x19, 0x20, 0xd0, 0x68, 0x81, 0x7d, 0x81, 0x2d, 0x8f, 0x81, 0x3b, 0x81, 0xd3, 0x47, 0xbb, 0x11, 0x81, 0xb8, 0xca, 0x81, 0x73, 0xf4, 0x81, 0xc0, 0xba, 0x7f, 0x81, 0xf9, 0x21, 0x7d, 0x14, 0x81, 0x66, 0x14, 0x81, 0x07, 0x81, 0x54, 0x81, 0xf5, 0x48, 0x5d, 0x4a, 0x81, 0x81, 0x0c, 0x2d, 0xa4, 0x81, 0xcb, 0x0b, 0x56, 0x81, 0xae, 0x81, 0x72, 0xbb, 0xcc, 0x81, 0x7f, 0x15, 0xab, 0xcd, 0xff, 0x81, 0xd0, 0x68, 0x81, 0x5f, 0x47, 0x81, 0x81, 0xfd, 0x1f, 0x37, 0x44, 0x81, 0x5e, 0x81, 0x44, 0x05, 0x4e, 0x81, 0x81, 0x35, 0xeb, 0x77, 0x81, 0x47, 0xb4, 0x72, 0x81, 0x08, 0x53, 0x81, 0x7f, 0x97, 0x83, 0x7f, 0xd1, 0xea, 0x89, 0x22, 0x81, 0xea, 0xbf, 0x7f, 0x12, 0x0f, 0x81, 0x81, 0x2a, 0x0c, 0xb6, 0xbf, 0x7f, 0x6f, 0x81, 0x35, 0x7f, 0x1a, 0x82, 0x7e, 0x81, 0x91, 0x81, 0xf9, 0x29, 0x55, 0x81, 0x52, 0x56, 0x81, 0x7c, 0x81, 0x25, 0x0e, 0xa8, 0x81, 0xa9, 0x81, 0x1b, 0x1d, 0x32, 0xa1, 0x7f, 0x81, 0x30, 0x05, 0xb1, 0xd9, 0x81, 0x56, 0x81, 0xd8, 0xd0, 0x71, 0x81, 0x81, 0xa9, 0xfe, 0x81, 0x05, 0x32, 0xfb, 0x81, 0x55, 0x81, 0x0c, 0x1a, 0x7f, 0xf8, 0x98, 0x81, 0x27, 0x0d, 0x81, 0xee, 0x2f, 0x60, 0xd2, 0x81, 0xf6, 0xbc, 0x7f, 0x81, 0x61, 0x84, 0x5a, 0x1b, 0x81, 0x2e, 0x4b, 0x81, 0x81, 0x17, 0x22, 0x7d, 0x81, 0x3d, 0x8f, 0x4b, 0x81, 0x7e, 0xeb, 0x81, 0x04, 0x4a, 0x81, 0x92, 0x83, 0x7f, 0x81, 0x17, 0x25, 0x02, 0xd3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf9, 0xff, 0xff, 0xe2, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x76, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xca, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xff, 0xf2, 0x05, 0x00, 0x00, 0x94, 0xf7, 0xff, 0xff, 0x08, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xb1, 0xfc, 0xff, 0xff, 0x0e, 0xfa, 0xff, 0xff, 0x37, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0xba, 0xf2, 0xff, 0xff, 0xd3, 0xfa, 0xff, 0xff, 0x34, 0xf9, 0xff, 0xff, 0xdb, 0xfd, 0xff, 0xff, 0xb4, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x65, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0xb0, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x5b, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xfc, 0xff, 0xff, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfb, 0xff, 0xff, 0x30, 0x05, 0x00, 0x00, 0xfb, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x03, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x05, 0x00, 0x00, 0x3f, 0x05, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff, 0xc7, 0x03, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0xed, 0xfc, 0xff, 0xff, 0x5b, 0x03, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0x5f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfe, 0xff, 0xff, 0x0c, 0xf7, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xff, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xfd, 0xff, 0xff, 0x02, 0x03, 0x00, 0x00, 0xec, 0xf4, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfc, 0xff, 0xff, 0xc9, 0xf7, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xfb, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0xfd, 0xff, 0xff, 0xc8, 0x01, 0x00, 0x00, 0x97, 0xfe, 0xff, 0xff, 0x2f, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xf8, 0xff, 0xff, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x04, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0x28, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x12, 0xfa, 0xff, 0xff, 0x0e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xd4, 0xe4, 0xf9, 0x0b, 0xed, 0x0b, 0x09, 0xf1, 0xe2, 0xd2, 0x2d, 0xcd, 0x0a, 0xd4, 0xfa, 0x1d, 0xc3, 0x21, 0x0d, 0xfc, 0xf5, 0xec, 0xd5, 0xe9, 0x18, 0xf8, 0x21, 0x24, 0xdf, 0xee, 0x1f, 0x24, 0xc5, 0xf7, 0x1a, 0x0a, 0x19, 0xe8, 0x0e, 0x13, 0x12, 0x06, 0xe9, 0x32, 0xf4, 0xc8, 0xd5, 0x34, 0xe7, 0x2a, 0xec, 0xd5, 0xef, 0x25, 0x11, 0x14, 0xf5, 0xde, 0xe7, 0x06, 0xd4, 0xd0, 0xff, 0xd1, 0x17, 0x1f, 0x2e, 0x1c, 0x08, 0xe5, 0x1c, 0x32, 0xfd, 0xf1, 0xf7, 0xdf, 0xd0, 0x24, 0x2c, 0x16, 0x01, 0xe7, 0x1b, 0xf2, 0x19, 0xc1, 0x0c, 0xbb, 0xf8, 0xfd, 0x03, 0x49, 0xf4, 0xe5, 0x37, 0xfa, 0xf3, 0xe8, 0x0c, 0x10, 0x35, 0xcf, 0x12, 0x08, 0x81, 0x03, 0x26, 0x0d, 0xf1, 0xe8, 0x15, 0x10, 0xdc, 0xf2, 0x31, 0xef, 0xe0, 0x00, 0x27, 0xe9, 0x24, 0x26, 0x04, 0x0c, 0x36, 0x97, 0x0d, 0x20, 0xea, 0xf2, 0xf6, 0xf9, 0xfb, 0x0b, 0xe4, 0xf5, 0x15, 0x0f, 0xef, 0x16, 0xee, 0xf7, 0xf9, 0xe6, 0xe6, 0xef, 0xe3, 0xef, 0xf2, 0x0a, 0xf0, 0xe3, 0xf2, 0x0a, 0x10, 0x02, 0x05, 0xe7, 0xaa, 0x0d, 0x08, 0xf2, 0xd8, 0xe9, 0xf8, 0x28, 0x21, 0xf9, 0xe5, 0xf4, 0x0c, 0xe3, 0xf3, 0xec, 0x1f, 0x13, 0xeb, 0xff, 0xe9, 0x11, 0x01, 0x12, 0x0e, 0x0c, 0xb6, 0xeb, 0xfe, 0x04, 0x18, 0xf5, 0xe7, 0x12, 0x0c, 0x0b, 0xfd, 0x14, 0xf0, 0x0c, 0xe3, 0xe0, 0xed, 0x0f, 0x18, 0xe9, 0xe8, 0xf7, 0xd9, 0x01, 0x1b, 0xef, 0x26, 0x0e, 0xf2, 0x76, 0xd0, 0xea, 0xf5, 0xfb, 0x05, 0xfc, 0xf4, 0xba, 0x04, 0x1f, 0xf9, 0x07, 0x06, 0x37, 0x18, 0xab, 0xfe, 0xb8, 0xf0, 0xbe, 0xe9, 0xf0, 0xde, 0x09, 0xed, 0x0d, 0xe8, 0xfa, 0x81, 0x07, 0x15, 0x15, 0xd2, 0x0d, 0x04, 0xcc, 0x42, 0x1a, 0x0d, 0x11, 0xfe, 0xed, 0x24, 0xe4, 0xe0, 0xfa, 0xdf, 0x1e, 0xe4, 0xf5, 0xf8, 0x31, 0xdd, 0xe3, 0xff, 0xbf, 0x11, 0x09, 0x4b, 0xfe, 0x13, 0x01, 0xe0, 0x15, 0xfa, 0xe4, 0x18, 0x2b, 0xfc, 0xf9, 0xd2, 0x20, 0xd9, 0x30, 0xde, 0x3c, 0xf8, 0xfb, 0x9f, 0xe1, 0xcf, 0x22, 0x35, 0xcc, 0xcc, 0xd6, 0x38, 0x04, 0x18, 0xf4, 0xfb, 0xdf, 0xff, 0x01, 0x81, 0x08, 0xe7, 0x0d, 0xcd, 0xbb, 0xf5, 0xfa, 0x11, 0x18, 0x23, 0x25, 0xfb, 0x3c, 0x0b, 0x2c, 0x08, 0xd0, 0xc8, 0x28, 0x11, 0xd8, 0x26, 0xcc, 0x9d, 0x17, 0xa9, 0x00, 0xcb, 0xec, 0x22, 0x84, 0x35, 0xad, 0xeb, 0x0f, 0x20, 0xe6, 0x1b, 0x44, 0xec, 0xf6, 0x0e, 0xea, 0xca, 0x04, 0xb4, 0xf1, 0x2f, 0x13, 0x0c, 0xca, 0x38, 0x1b, 0x32, 0xf3, 0xca, 0xfa, 0xc1, 0x11, 0xf1, 0xab, 0xf5, 0xd4, 0x22, 0x98, 0x18, 0x22, 0xc7, 0xe5, 0x03, 0xf4, 0xe8, 0x04, 0x0d, 0x08, 0xfe, 0xe6, 0xf4, 0x17, 0xf4, 0xff, 0xe2, 0x07, 0x19, 0x0f, 0x13, 0x1e, 0xfb, 0x1e, 0x03, 0x17, 0xf0, 0xfd, 0xef, 0xfa, 0xec, 0xe9, 0xdb, 0x17, 0x09, 0x1b, 0xc2, 0x89, 0xef, 0x10, 0x12, 0xd3, 0x09, 0xec, 0x35, 0xce, 0x1c, 0xca, 0xfa, 0x0d, 0xe7, 0x02, 0x01, 0x22, 0x20, 0x16, 0x21, 0x1b, 0x15, 0xde, 0x1d, 0x0b, 0x1d, 0x24, 0xf5, 0x0a, 0xed, 0x0d, 0xeb, 0x04, 0xf9, 0x22, 0xe3, 0x0e, 0xbd, 0xfa, 0x0c, 0xe9, 0xde, 0xd4, 0xfe, 0xdf, 0x02, 0x2d, 0x13, 0x1d, 0x2b, 0xf7, 0xfd, 0xfe, 0x14, 0x0c, 0xd7, 0x1f, 0x1a, 0xfa, 0x08, 0x40, 0x11, 0x0d, 0xfd, 0x9e, 0x05, 0xe8, 0xd3, 0xd9, 0x37, 0xf4, 0x12, 0x03, 0xb5, 0x06, 0x17, 0xeb, 0xa0, 0xe7, 0x17, 0x19, 0x1a, 0x1d, 0xef, 0xf8, 0x07, 0x27, 0x10, 0xfd, 0x0e, 0x81, 0x06, 0xde, 0x1d, 0x09, 0x20, 0xed, 0xfd, 0x0c, 0xc0, 0xde, 0xf1, 0xed, 0x3b, 0xd2, 0x9c, 0xeb, 0x0b, 0xde, 0x03, 0xc4, 0x17, 0x05, 0xfb, 0xd1, 0xe1, 0x1d, 0x21, 0x43, 0x07, 0xe8, 0x01, 0xee, 0xea, 0x31, 0xc5, 0xb5, 0xb6, 0xf1, 0xf5, 0x1e, 0x32, 0xd6, 0xe9, 0x39, 0x04, 0x34, 0xd0, 0x96, 0xca, 0xc0, 0xfe, 0x06, 0xe4, 0x33, 0xcd, 0x32, 0xfe, 0x1a, 0xf8, 0x02, 0xf9, 0xec, 0xbe, 0x35, 0x23, 0x15, 0xe1, 0x34, 0x21, 0x12, 0x2e, 0xf9, 0x11, 0xe6, 0x04, 0xce, 0xfb, 0x18, 0xc8, 0x02, 0xdc, 0x0e, 0xdf, 0xfd, 0x1e, 0xc6, 0xf5, 0xe5, 0xc5, 0xe0, 0x11, 0xff, 0x0f, 0xda, 0x17, 0xbe, 0xcf, 0xfd, 0x1d, 0xfa, 0xc7, 0xd0, 0x03, 0xcb, 0xff, 0x2b, 0xf7, 0xc7, 0xfd, 0x29, 0xdd, 0x4a, 0x07, 0x31, 0xbc, 0xb5, 0x18, 0x33, 0xb5, 0x1b, 0xea, 0xf7, 0x29, 0x16, 0x42, 0xf8, 0xe9, 0xfe, 0xc3, 0x3a, 0x81, 0xc7, 0xf0, 0xec, 0x12, 0xd5, 0xd6, 0xe2, 0xf5, 0xce, 0x23, 0x30, 0xf3, 0xf8, 0xcf, 0xef, 0xe3, 0x06, 0xe4, 0xef, 0x02, 0x04, 0xf4, 0x1c, 0x0a, 0x1d, 0xd2, 0xe5, 0x0c, 0xe8, 0xe3, 0x2f, 0xff, 0xdb, 0xfc, 0xfc, 0x1c, 0x1d, 0x1f, 0xcf, 0x21, 0xe5, 0xa5, 0x06, 0xc1, 0xe1, 0xa4, 0x00, 0xd0, 0x07, 0x1a, 0xe4, 0x10, 0x1b, 0xc3, 0x13, 0x17, 0x1f, 0x0e, 0x1d, 0xbf, 0xf4, 0x2c, 0x2e, 0x40, 0xfa, 0xf3, 0xe0, 0xd6, 0x03, 0xfd, 0x04, 0xe2, 0xd5, 0x28, 0x04, 0x2d, 0xd7, 0xdc, 0xdf, 0xfd, 0x8c, 0xea, 0x07, 0x06, 0xf7, 0xe6, 0x10, 0xf3, 0x0f, 0xd6, 0xe5, 0x00, 0x81, 0x22, 0x04, 0x2b, 0x36, 0x14, 0x0b, 0xef, 0x0b, 0xff, 0xd9, 0x41, 0xdb, 0xa7, 0x47, 0xfb, 0x20, 0x28, 0x2e, 0xfb, 0x29, 0xd6, 0x32, 0xae, 0xd9, 0xc6, 0xde, 0xf3, 0xdd, 0x19, 0xf9, 0x15, 0x05, 0x02, 0xf5, 0xe9, 0x05, 0xd2, 0x2e, 0xe4, 0xfb, 0xea, 0x2b, 0xf6, 0xeb, 0xec, 0x0f, 0x12, 0xe1, 0x11, 0xe4, 0xe6, 0x12, 0x0c, 0x08, 0x01, 0x21, 0xf8, 0x1a, 0x05, 0x0c, 0x05, 0x19, 0x07, 0x0f, 0xf0, 0x16, 0xf0, 0xfa, 0xde, 0xe4, 0x1b, 0xfb, 0x81, 0xc8, 0xed, 0xf6, 0xdb, 0x09, 0xf3, 0xee, 0xb6, 0xf7, 0xe4, 0x13, 0x05, 0xe8, 0x1b, 0xf6, 0xe9, 0xf6, 0xe8, 0xf0, 0x0a, 0x23, 0xda, 0xea, 0x17, 0x02, 0xf5, 0xf0, 0xf9, 0x18, 0x13, 0x00, 0xf4, 0x03, 0xfe, 0xea, 0x09, 0x19, 0x13, 0xd4, 0xf2, 0xc0, 0x15, 0xc7, 0x10, 0xe1, 0x08, 0x09, 0xf0, 0x03, 0x07, 0x05, 0x2c, 0x02, 0x00, 0x67, 0x0d, 0x0d, 0x01, 0xf9, 0x15, 0x1f, 0x11, 0xdd, 0xeb, 0xf5, 0xf9, 0x0d, 0xdc, 0x4d, 0x0f, 0xc0, 0x15, 0xde, 0xfc, 0xd0, 0x0d, 0xe6, 0x37, 0x1a, 0xd3, 0x05, 0x0b, 0x11, 0xbf, 0xe7, 0x0f, 0x16, 0xee, 0x17, 0x09, 0xe7, 0x18, 0x15, 0x0e, 0x03, 0x07, 0xf3, 0x0b, 0x1d, 0xf0, 0x0c, 0xe2, 0x01, 0xf9, 0x07, 0x03, 0xf0, 0x01, 0x09, 0x21, 0xf9, 0xdb, 0x1d, 0x02, 0x03, 0xed, 0xf0, 0x16, 0xf7, 0x02, 0x19, 0xf9, 0xfa, 0xce, 0xaf, 0x0b, 0x09, 0x06, 0x02, 0x11, 0xe7, 0x39, 0xd5, 0xf9, 0xc2, 0xfd, 0x13, 0x1b, 0xed, 0x19, 0xf1, 0x06, 0x26, 0x06, 0x1b, 0x10, 0xe1, 0x05, 0x0d, 0xf6, 0x18, 0x1b, 0xf4, 0xf3, 0x06, 0xf5, 0x09, 0xe7, 0x1a, 0xfd, 0x1c, 0xb8, 0xe4, 0x15, 0x1b, 0xfa, 0xdb, 0x00, 0xe4, 0xec, 0x11, 0xfd, 0xf2, 0x23, 0x0a, 0x0c, 0x06, 0xe1, 0xf8, 0x17, 0x0a, 0xe3, 0x14, 0x16, 0x23, 0xed, 0xf9, 0x08, 0x81, 0x0a, 0xda, 0xf8, 0x08, 0x2c, 0xf2, 0xde, 0x01, 0xcc, 0xea, 0xea, 0x03, 0xac, 0xef, 0xee, 0xfc, 0x17, 0xff, 0xf4, 0xff, 0x17, 0xf4, 0xdb, 0xe7, 0x1c, 0x88, 0xe0, 0xf7, 0x1e, 0x08, 0x17, 0xfc, 0xe7, 0x29, 0xfd, 0xd0, 0x06, 0x10, 0x0f, 0xf0, 0x0a, 0xf8, 0x00, 0xe8, 0xf4, 0x09, 0xfe, 0xf4, 0x04, 0x05, 0xf9, 0x0e, 0xee, 0x05, 0x0e, 0x0b, 0xff, 0x08, 0xff, 0x10, 0x06, 0xeb, 0x07, 0x02, 0x09, 0x04, 0xc3, 0xfd, 0x00, 0xff, 0x09, 0x03, 0xfe, 0xfc, 0xee, 0x04, 0x0a, 0xf6, 0x06, 0x02, 0x00, 0x0e, 0xf6, 0x0c, 0x07, 0xfe, 0x00, 0xff, 0x0d, 0xf9, 0xf3, 0xf6, 0xdf, 0xff, 0xf0, 0xf5, 0xf1, 0xf4, 0xf8, 0xf1, 0xf8, 0xfd, 0x04, 0x08, 0xf3, 0xfc, 0x03, 0xe6, 0xfd, 0x02, 0xf6, 0x0e, 0x0e, 0x0d, 0xf1, 0x08, 0xf1, 0xfd, 0x11, 0xff, 0x05, 0x2a, 0xf2, 0x06, 0xf4, 0xfc, 0xf6, 0x00, 0xf7, 0xaa, 0x07, 0x06, 0x1c, 0x00, 0xfc, 0x15, 0x03, 0xa1, 0xf3, 0xc7, 0x05, 0xc3, 0xf1, 0xf4, 0xf4, 0x01, 0xf5, 0x00, 0x03, 0x0a, 0x81, 0x00, 0xf4, 0x02, 0xf1, 0xfc, 0xff, 0xe8, 0x17, 0x0f, 0x06, 0xf7, 0x07, 0xe2, 0x59, 0x07, 0xdf, 0x42, 0x03, 0x23, 0xc3, 0x03, 0xd3, 0x13, 0xe8, 0x3d, 0x13, 0x07, 0xb4, 0xf7, 0x15, 0x18, 0x2e, 0x30, 0x0c, 0x38, 0xf5, 0xf8, 0xd7, 0x88, 0x3d, 0x38, 0x01, 0xfe, 0xfd, 0x11, 0x05, 0x23, 0x05, 0x5b, 0x2c, 0x3b, 0xc2, 0xfa, 0x05, 0xe9, 0xe1, 0x38, 0xe0, 0x9c, 0x3a, 0x1c, 0xea, 0xdb, 0x1f, 0x31, 0xec, 0x3e, 0x35, 0xfe, 0x15, 0x1b, 0x29, 0xd3, 0xcb, 0xd8, 0x33, 0x11, 0x2e, 0xf4, 0xb4, 0x25, 0x25, 0xe5, 0xf4, 0xce, 0x1f, 0xf4, 0x2b, 0xfb, 0xc9, 0x09, 0x3b, 0xf7, 0xd1, 0xf0, 0x11, 0xbf, 0x12, 0x44, 0xd0, 0x22, 0x1c, 0x03, 0x3e, 0x81, 0xc9, 0x23, 0xf9, 0xf1, 0xd9, 0x36, 0x0a, 0xe0, 0x23, 0x16, 0x33, 0x1f, 0xb2, 0xfd, 0x40, 0xed, 0xb8, 0x15, 0xe0, 0x38, 0xdd, 0x29, 0xdb, 0xfe, 0x11, 0x98, 0x0f, 0xf4, 0x18, 0x03, 0xd6, 0xc7, 0xe6, 0x1b, 0x1e, 0xf9, 0x16, 0x12, 0xf5, 0xe1, 0xc6, 0xdb, 0x1c, 0xe5, 0xfd, 0x11, 0xe0, 0x08, 0x11, 0x06, 0x08, 0x05, 0x24, 0xfe, 0xf1, 0x06, 0x09, 0x18, 0xeb, 0xe9, 0xf4, 0x17, 0x9e, 0xb6, 0xeb, 0xfa, 0xe9, 0xd5, 0xe9, 0x09, 0x0e, 0xba, 0x15, 0xdb, 0xe6, 0xea, 0x22, 0x08, 0xe3, 0x13, 0xe9, 0xf9, 0xe8, 0xde, 0xfb, 0x12, 0x14, 0xf6, 0x08, 0xe4, 0xf8, 0xf7, 0x09, 0x10, 0x0c, 0xea, 0xd9, 0xf3, 0x00, 0xe2, 0xd7, 0x21, 0x1e, 0x01, 0x0c, 0xf2, 0x02, 0xf0, 0xef, 0x36, 0xe3, 0xea, 0x18, 0xfc, 0x18, 0x24, 0xf7, 0x13, 0xe2, 0x28, 0xee, 0x08, 0x1d, 0x1d, 0x1b, 0x10, 0x16, 0x81, 0xe1, 0x10, 0xb8, 0x0b, 0x02, 0xeb, 0x17, 0x17, 0xa3, 0x08, 0x12, 0xfc, 0x89, 0xee, 0xfd, 0xea, 0x14, 0xf8, 0xcd, 0x14, 0xf4, 0xf7, 0xe4, 0x08, 0xfd, 0x9f, 0x0d, 0xef, 0x23, 0xd1, 0xf0, 0xec, 0xf1, 0x12, 0xb2, 0xfb, 0x2c, 0xe1, 0xed, 0xe3, 0x01, 0xf7, 0x23, 0x1b, 0x0f, 0x15, 0x0b, 0xfe, 0x81, 0x14, 0xf7, 0xde, 0x21, 0x8c, 0x08, 0xfc, 0x21, 0xfe, 0x14, 0x0d, 0xf5, 0xe7, 0xf9, 0xec, 0x00, 0xf4, 0x18, 0x1c, 0xef, 0xec, 0x16, 0x04, 0x18, 0x02, 0x1c, 0x22, 0xee, 0x16, 0x1e, 0xed, 0x04, 0x00, 0x0a, 0xdf, 0xeb, 0x1b, 0xcb, 0x03, 0xfe, 0xff, 0xf3, 0x18, 0x38, 0xfa, 0xee, 0x03, 0x28, 0xea, 0x12, 0xf1, 0x09, 0x07, 0x04, 0xf9, 0xf4, 0x14, 0xb0, 0x33, 0x16, 0xf5, 0x1b, 0xde, 0xfc, 0x04, 0x00, 0xaf, 0x09, 0xc4, 0xd6, 0xd7, 0xe8, 0xca, 0xe2, 0xf5, 0x1a, 0x15, 0x10, 0x03, 0xde, 0x36, 0x09, 0x1c, 0xff, 0x04, 0x14, 0xd8, 0xff, 0x3f, 0xeb, 0x50, 0xfb, 0x26, 0xed, 0x1d, 0x17, 0xe8, 0x2d, 0x06, 0x11, 0xf2, 0x30, 0x09, 0xed, 0xfc, 0x1d, 0xea, 0xdb, 0x2d, 0xc9, 0xe4, 0x1a, 0x1a, 0x00, 0x36, 0x0d, 0xe3, 0x29, 0x07, 0x01, 0x04, 0x17, 0x39, 0x27, 0x0f, 0x06, 0x02, 0x13, 0xfb, 0xfb, 0x07, 0xed, 0xe4, 0xed, 0x09, 0xf8, 0x12, 0x10, 0xf1, 0x1b, 0x47, 0x00, 0xf0, 0x1e, 0x04, 0x1a, 0xdc, 0xf8, 0x00, 0x1b, 0xfc, 0xa4, 0xe2, 0xb8, 0xf5, 0x23, 0x0d, 0xe5, 0xf1, 0x27, 0x08, 0xd3, 0x19, 0xdb, 0xfc, 0x01, 0xfd, 0x81, 0x13, 0x23, 0xec, 0x22, 0x1b, 0xe5, 0x0e, 0x02, 0xe4, 0x25, 0x24, 0xe6, 0x26, 0x1d, 0x0f, 0x02, 0xf6, 0xf4, 0xe4, 0x16, 0xe8, 0x16, 0x05, 0x2f, 0x1b, 0x09, 0x00, 0xe5, 0x10, 0xef, 0x18, 0x02, 0xd5, 0x0a, 0x25, 0x11, 0x0f, 0x1b, 0xf8, 0x01, 0x19, 0xe6, 0xff, 0x33, 0x0f, 0x08, 0xe9, 0xf7, 0x25, 0xf8, 0x14, 0xf9, 0x0f, 0x17, 0xf2, 0x27, 0x24, 0xef, 0xfd, 0xfb, 0x12, 0x2d, 0x01, 0xda, 0xfd, 0x29, 0xe5, 0x19, 0x0d, 0x09, 0x22, 0x0f, 0x0e, 0xed, 0xf7, 0x16, 0x11, 0x09, 0x0e, 0xf9, 0x03, 0xf3, 0x1a, 0x17, 0x12, 0x0f, 0xe1, 0x8c, 0xe3, 0xfb, 0x21, 0x17, 0xb8, 0xf1, 0x0d, 0xf6, 0xf9, 0xfc, 0xdc, 0xe8, 0xed, 0x17, 0xb8, 0xe2, 0x20, 0x44, 0x16, 0x00, 0x12, 0xcc, 0x11, 0xf4, 0xec, 0x2a, 0x0a, 0x25, 0xe7, 0x17, 0xfe, 0xdf, 0x02, 0x2a, 0xe7, 0xfc, 0xed, 0xbc, 0x32, 0x48, 0x21, 0x1d, 0xef, 0x36, 0xfe, 0x07, 0xeb, 0x0d, 0xe2, 0x10, 0x09, 0xe0, 0x1b, 0xd1, 0x17, 0x03, 0x10, 0x81, 0x33, 0x10, 0xe6, 0xe0, 0xf2, 0xe2, 0x19, 0xcc, 0xae, 0x02, 0xb4, 0xe0, 0xdd, 0x15, 0xcc, 0x99, 0xb6, 0x04, 0xef, 0xe9, 0xd8, 0xd3, 0xff, 0x14, 0xea, 0xce, 0x27, 0x38, 0x9f, 0x1e, 0x25, 0x01, 0x2d, 0x3f, 0xdf, 0x17, 0xeb, 0x00, 0xeb, 0x0a, 0xe4, 0x28, 0xf3, 0x14, 0x30, 0xfc, 0xfd, 0x03, 0x27, 0xe6, 0x08, 0xbd, 0xfb, 0xdd, 0xfd, 0xed, 0x34, 0xf3, 0x09, 0x09, 0x0a, 0xb9, 0x18, 0xf0, 0x19, 0xe4, 0x16, 0xfe, 0x1f, 0xf8, 0xee, 0xfe, 0x03, 0x04, 0xf7, 0xe7, 0xfc, 0xe3, 0x09, 0x1a, 0xe4, 0x0e, 0x27, 0xab, 0xb0, 0x19, 0x1b, 0x27, 0xfd, 0x0e, 0x18, 0x30, 0xcf, 0xfb, 0xf3, 0x05, 0xfc, 0x02, 0x09, 0xee, 0x09, 0x11, 0x0a, 0xe6, 0x03, 0xe1, 0xfd, 0x07, 0x2f, 0xe9, 0xf9, 0x02, 0xe8, 0xce, 0xe7, 0x1a, 0xe3, 0xf4, 0x1b, 0x0f, 0x06, 0xfc, 0x01, 0x0d, 0xfa, 0xe8, 0xad, 0xf8, 0xee, 0xfa, 0x2d, 0xe7, 0x0f, 0xf3, 0x0a, 0x29, 0xe1, 0x16, 0xe7, 0xe5, 0x12, 0x11, 0xfd, 0x2b, 0x1f, 0x0b, 0xe7, 0xfe, 0xd1, 0xf0, 0x12, 0xd3, 0xe4, 0x0b, 0x10, 0xf7, 0xe5, 0xbf, 0x18, 0xfe, 0xfb, 0x81, 0x31, 0x01, 0xfa, 0xfc, 0x1e, 0xde, 0xf1, 0xe0, 0xf7, 0x1a, 0xfc, 0xe7, 0xc0, 0x21, 0xf2, 0x01, 0x07, 0xff, 0x0b, 0xef, 0x18, 0xdc, 0xe7, 0x10, 0x33, 0x1c, 0x0d, 0x0e, 0x29, 0xec, 0x19, 0x29, 0xcd, 0xe1, 0x31, 0x12, 0x2c, 0x26, 0xd5, 0x2c, 0x0e, 0xd7, 0xe7, 0xf3, 0xd9, 0x0c, 0x35, 0x2a, 0xbf, 0x2d, 0x0c, 0x1a, 0x0b, 0x0a, 0xc5, 0xff, 0x03, 0xf2, 0xf0, 0x81, 0xf9, 0xa6, 0x07, 0x1a, 0x0b, 0x15, 0xed, 0x20, 0xd5, 0xef, 0xeb, 0x24, 0x1e, 0xe8, 0xff, 0x96, 0x12, 0x0c, 0x16, 0xfb, 0xf3, 0x2a, 0x02, 0xf1, 0x25, 0xd0, 0x2b, 0x10, 0xd2, 0x12, 0xd1, 0x07, 0xf5, 0xe6, 0xab, 0x13, 0xc8, 0x0e, 0x37, 0xf9, 0x37, 0x0f, 0x06, 0xf1, 0x07, 0xa6, 0xee, 0x14, 0x8b, 0x01, 0xef, 0xe8, 0x1c, 0xf5, 0xe4, 0x06, 0x24, 0xe4, 0xfc, 0xfc, 0xd5, 0xb8, 0xcb, 0x3c, 0xff, 0xe0, 0xe5, 0x68, 0xeb, 0xcd, 0xf1, 0xf1, 0xcd, 0x38, 0x01, 0xef, 0xc6, 0x17, 0x24, 0x1d, 0xdc, 0xf2, 0x23, 0xbc, 0x20, 0xc7, 0x17, 0x20, 0x16, 0x01, 0x12, 0x04, 0xf6, 0xf7, 0xeb, 0xe9, 0xde, 0x09, 0xfa, 0xeb, 0x0d, 0x08, 0x10, 0x07, 0x1a, 0x00, 0x1b, 0x0e, 0xea, 0x08, 0xf9, 0xee, 0xe8, 0xe2, 0xe8, 0x16, 0x10, 0xae, 0x98, 0xea, 0x18, 0x01, 0x07, 0xf2, 0x02, 0x23, 0xa7, 0xfd, 0xc0, 0x13, 0xf8, 0x05, 0x05, 0x02, 0x16, 0x04, 0x1b, 0xea, 0xf5, 0xe5, 0xea, 0xf7, 0x16, 0xd6, 0xed, 0x05, 0x06, 0x0c, 0xfc, 0xe8, 0xf5, 0x0a, 0x07, 0x18, 0x0c, 0xc7, 0xf6, 0x17, 0x16, 0x0b, 0xe1, 0xfe, 0xd8, 0xf6, 0x33, 0xf0, 0xfb, 0xe3, 0x05, 0x02, 0x15, 0xe3, 0xe8, 0xef, 0x1c, 0xfb, 0x15, 0x10, 0x0c, 0xf8, 0x07, 0xf8, 0xa9, 0xe9, 0x1e, 0xe9, 0x11, 0x25, 0xe5, 0x12, 0xe6, 0xcb, 0x06, 0xf6, 0xf2, 0x81, 0xfa, 0xe2, 0x0a, 0x01, 0x14, 0xe7, 0x19, 0x0c, 0xff, 0x01, 0x14, 0xe2, 0x9b, 0xf7, 0xf1, 0x2e, 0x27, 0xe9, 0xfc, 0x23, 0x01, 0xd5, 0xcf, 0xe2, 0x1b, 0xca, 0x05, 0xe8, 0x06, 0x23, 0x1b, 0x2e, 0xe4, 0x35, 0x1c, 0x0d, 0xe0, 0xfa, 0xcc, 0xf0, 0x0f, 0x07, 0x05, 0x0c, 0x02, 0x30, 0xfa, 0x1b, 0x1c, 0xf6, 0xee, 0x32, 0xd0, 0x3a, 0xca, 0x07, 0xfc, 0x1e, 0x04, 0xa8, 0xe4, 0xd9, 0xe7, 0x30, 0x01, 0xec, 0x31, 0xd1, 0x7a, 0xe4, 0x31, 0xd7, 0xe0, 0x12, 0x22, 0x81, 0x18, 0x1e, 0xdc, 0x0a, 0x16, 0xc8, 0x3b, 0xf0, 0xcb, 0xfc, 0x37, 0xd0, 0x05, 0x3c, 0xe3, 0x12, 0xcd, 0x23, 0x27, 0x24, 0xd0, 0x34, 0x3e, 0x53, 0x37, 0x04, 0xf8, 0x30, 0x2c, 0xd2, 0xfb, 0xf3, 0xea, 0x12, 0xf9, 0xc8, 0xea, 0x08, 0xf9, 0xe2, 0x34, 0xc8, 0xea, 0x57, 0x1e, 0xc7, 0xdd, 0xee, 0x0d, 0x2b, 0x23, 0xf5, 0x39, 0xe8, 0xd1, 0x09, 0x3d, 0x07, 0x03, 0x03, 0x23, 0x3d, 0xdb, 0xc7, 0xf5, 0x1d, 0xf7, 0x13, 0x2b, 0x56, 0xe2, 0x44, 0xef, 0xd9, 0xfd, 0x02, 0xd1, 0xcb, 0x0c, 0x12, 0xd1, 0x13, 0xe1, 0x2b, 0xcd, 0x12, 0x38, 0x0d, 0xca, 0xd0, 0xe3, 0x33, 0x0f, 0xe8, 0xc9, 0x07, 0x1b, 0xf3, 0x21, 0xdb, 0x93, 0x98, 0x5d, 0x32, 0x21, 0xfb, 0x39, 0xf5, 0x03, 0x44, 0xfe, 0x1d, 0xf0, 0xd7, 0xc6, 0x2f, 0xd2, 0xe0, 0xf6, 0xe6, 0xac, 0xd7, 0x28, 0x34, 0x37, 0xfc, 0xe6, 0x12, 0xf2, 0x38, 0xf0, 0xe7, 0xf6, 0xf5, 0xfe, 0xf6, 0x24, 0xea, 0x2c, 0x06, 0x03, 0xc1, 0xd0, 0xc7, 0x3c, 0x0c, 0xb1, 0xeb, 0xfa, 0xe1, 0xd4, 0x89, 0xca, 0xa7, 0xd0, 0x37, 0x21, 0xc2, 0x30, 0xcf, 0xe3, 0xc5, 0xa7, 0xd5, 0x06, 0xeb, 0xd2, 0xd6, 0x16, 0x43, 0xd7, 0xcc, 0x33, 0xcf, 0xf8, 0x53, 0x15, 0x18, 0x2a, 0x18, 0xfc, 0x1e, 0x14, 0x81, 0x11, 0xf0, 0x00, 0x2e, 0x14, 0x40, 0xf6, 0xdf, 0xb7, 0x33, 0x08, 0xe0, 0x03, 0xe7, 0x26, 0x26, 0xc4, 0xd6, 0x3b, 0x3d, 0x0d, 0x0b, 0x2d, 0xe1, 0x04, 0xf4, 0xd4, 0x09, 0x2f, 0xf8, 0x21, 0xe0, 0xdf, 0xec, 0xf8, 0x02, 0xf2, 0x14, 0xe8, 0x03, 0xdc, 0x28, 0x08, 0xe4, 0xf5, 0xd1, 0xfe, 0x31, 0xd6, 0xa9, 0x00, 0xfa, 0x2e, 0x64, 0xf3, 0x0e, 0xe6, 0x17, 0xfa, 0x08, 0x0a, 0x0f, 0xf7, 0xf7, 0xfc, 0xce, 0x2b, 0xf3, 0x03, 0x0b, 0x2c, 0xf6, 0xee, 0x31, 0x27, 0xfb, 0x25, 0x2a, 0xce, 0x05, 0x05, 0xfc, 0xfa, 0xd3, 0x2b, 0x31, 0x07, 0xe1, 0xfe, 0xd8, 0xb2, 0xef, 0x4a, 0xe2, 0x1f, 0x3a, 0xea, 0x1b, 0x02, 0x00, 0x2b, 0x21, 0x5c, 0xed, 0x60, 0x0a, 0xe5, 0x2f, 0x21, 0xd5, 0xbb, 0xea, 0xb9, 0xa5, 0xc6, 0x7f, 0x1a, 0xdd, 0x4f, 0xe9, 0xea, 0xd7, 0xec, 0xe7, 0xba, 0x1e, 0x09, 0x1f, 0xf1, 0xfc, 0x07, 0xbf, 0x41, 0x88, 0xea, 0xd2, 0xe1, 0xdd, 0x18, 0x34, 0xed, 0x27, 0x14, 0xed, 0x66, 0xf5, 0xd5, 0xe1, 0xf5, 0x14, 0x25, 0xe7, 0x1f, 0x02, 0xe0, 0x16, 0x21, 0x00, 0x05, 0xe5, 0xfe, 0xf0, 0x0e, 0xa4, 0xbb, 0x13, 0x25, 0x1f, 0x1d, 0xdc, 0x24, 0x00, 0xf4, 0xeb, 0xeb, 0x13, 0x1b, 0xc6, 0x12, 0xe4, 0x28, 0xd3, 0xea, 0x23, 0xfd, 0x11, 0x04, 0xe0, 0x20, 0x2a, 0xe3, 0xee, 0xf0, 0x33, 0x2a, 0xdc, 0x0e, 0xdb, 0xe3, 0x10, 0xd8, 0x08, 0xd1, 0xca, 0xed, 0x28, 0xf0, 0x33, 0xf8, 0xd5, 0xed, 0xf0, 0x12, 0xe2, 0x29, 0x21, 0xfc, 0xd5, 0xf5, 0x2f, 0xea, 0xe7, 0xf2, 0xf0, 0x2e, 0xde, 0xd4, 0xea, 0xda, 0x34, 0x07, 0x27, 0x27, 0xd7, 0xb3, 0x0c, 0x3a, 0xf9, 0xeb, 0xd8, 0xc4, 0x18, 0x25, 0xc7, 0x29, 0xd2, 0x7f, 0x02, 0xb6, 0xfe, 0xcb, 0x51, 0xc1, 0x2e, 0xd4, 0xef, 0xd5, 0xf8, 0x16, 0x10, 0xf3, 0xb7, 0x00, 0x13, 0x1b, 0x04, 0x1d, 0xe5, 0xb4, 0xfd, 0x0c, 0xf5, 0xe1, 0xfd, 0xdb, 0xba, 0xd7, 0xb9, 0xc4, 0xf8, 0xef, 0x20, 0x34, 0xb8, 0xe5, 0xd0, 0x2e, 0xd5, 0xf0, 0xf5, 0xdc, 0x14, 0xd1, 0xfb, 0xc8, 0xfa, 0x43, 0xff, 0xcf, 0x15, 0xfd, 0xb5, 0x2c, 0x34, 0x43, 0x0d, 0x12, 0xe9, 0xde, 0xe9, 0x3c, 0xed, 0xfb, 0xe7, 0x20, 0x40, 0xc4, 0xd9, 0xea, 0x28, 0x18, 0xe5, 0xdb, 0xde, 0xe7, 0xb8, 0x10, 0xd9, 0xfa, 0x1a, 0xd2, 0xd8, 0xbe, 0xfb, 0x37, 0x21, 0xc7, 0x1a, 0x16, 0xf2, 0xcc, 0x2c, 0x44, 0xe7, 0x32, 0xcb, 0xc8, 0xf2, 0xef, 0xd3, 0xf6, 0xd3, 0x31, 0x2c, 0xa0, 0xf9, 0x02, 0xf3, 0xe7, 0x05, 0x2e, 0x0c, 0xd3, 0x07, 0xde, 0x13, 0x9c, 0x12, 0x2d, 0xd6, 0xe2, 0x03, 0xec, 0x39, 0xfc, 0xc7, 0xc1, 0x15, 0xed, 0xae, 0x23, 0x1f, 0x0a, 0xbf, 0xbf, 0x7f, 0xbf, 0xb4, 0xd9, 0xdb, 0xf1, 0xd5, 0x56, 0xdd, 0x09, 0x22, 0x47, 0xdc, 0x29, 0x1a, 0x24, 0x05, 0x45, 0x9e, 0x3a, 0x3b, 0x3a, 0xdd, 0x07, 0xdf, 0x37, 0x46, 0xd9, 0x17, 0xdf, 0xf7, 0xce, 0xc5, 0xd0, 0xf3, 0x25, 0x46, 0x1d, 0xd9, 0x3b, 0xe0, 0x22, 0x27, 0xfe, 0xd6, 0xeb, 0x11, 0xe4, 0x71, 0x28, 0x01, 0x0f, 0xe8, 0xfd, 0x09, 0xe6, 0x43, 0x29, 0xc6, 0xd2, 0xf2, 0xbb, 0xd4, 0xc7, 0xf0, 0xfa, 0xdd, 0x2d, 0x0b, 0xa6, 0x90, 0xd1, 0x3b, 0x0b, 0xe4, 0x35, 0x05, 0x2f, 0x0a, 0x37, 0xf0, 0xde, 0x32, 0x1d, 0x0f, 0x42, 0xf2, 0xeb, 0xf7, 0xe4, 0x05, 0xd6, 0xf6, 0x21, 0xa3, 0xf5, 0x3b, 0x14, 0x0b, 0x04, 0xd6, 0x2d, 0x2c, 0xc2, 0xb8, 0xf4, 0xcd, 0x07, 0xe7, 0xcb, 0x00, 0x0d, 0xfb, 0x21, 0x9a, 0x12, 0x2d, 0xbe, 0xeb, 0xf9, 0xee, 0xf0, 0x2f, 0xe7, 0x2c, 0x2a, 0xe0, 0x32, 0xbc, 0xc7, 0xd1, 0x11, 0xfa, 0xcc, 0x13, 0x7f, 0xda, 0x38, 0xc5, 0xe5, 0x08, 0xb6, 0x32, 0x63, 0x0d, 0xe2, 0x22, 0xee, 0x1a, 0x12, 0x03, 0x27, 0xda, 0xdd, 0xe4, 0x14, 0xf9, 0xee, 0xe9, 0x21, 0xd7, 0xde, 0x3d, 0xff, 0x0f, 0xf3, 0xd7, 0x0c, 0xe5, 0xd5, 0x26, 0x2f, 0xe0, 0xbc, 0x20, 0x1d, 0x19, 0xcf, 0x16, 0x01, 0x41, 0x99, 0x00, 0xd5, 0x17, 0xfe, 0xdb, 0xd7, 0xe4, 0xd8, 0xf2, 0x34, 0xd2, 0xf8, 0xd7, 0xfd, 0xd8, 0x19, 0xf5, 0x1d, 0xef, 0xf0, 0xfb, 0x3b, 0x1f, 0x28, 0x0e, 0xdb, 0xdd, 0xe7, 0xda, 0xf5, 0xfb, 0xe3, 0xeb, 0xff, 0xf3, 0x14, 0xf0, 0x17, 0x12, 0xe2, 0xe6, 0xf7, 0x35, 0xd4, 0xd6, 0x24, 0xd6, 0x25, 0x13, 0xd1, 0xf5, 0x00, 0x03, 0xe2, 0xf2, 0x81, 0xf4, 0x22, 0xdb, 0x22, 0x0f, 0xf8, 0xe2, 0xfb, 0xc2, 0x23, 0xea, 0x17, 0x9b, 0x12, 0xed, 0x03, 0x30, 0x05, 0x23, 0xda, 0x06, 0xe0, 0xfd, 0x03, 0x12, 0xd4, 0xdf, 0x13, 0x4a, 0x3e, 0xf2, 0x1b, 0xdb, 0x26, 0x00, 0x05, 0x12, 0x1a, 0x0d, 0x18, 0x0e, 0xf1, 0xe6, 0x07, 0xfa, 0x01, 0x19, 0xcb, 0xec, 0xdf, 0xe4, 0x32, 0xe8, 0xd5, 0xe3, 0xf3, 0x2d, 0xe8, 0x1e, 0xeb, 0xda, 0x16, 0x39, 0xec, 0x14, 0xf8, 0xd1, 0x0d, 0xf4, 0xcd, 0xf1, 0xe4, 0x00, 0xe6, 0x47, 0xfa, 0x17, 0xdd, 0x2f, 0xcf, 0xe7, 0xc8, 0x13, 0x08, 0xca, 0xdc, 0xd1, 0x16, 0x34, 0xff, 0x1d, 0xd8, 0x1b, 0x19, 0x14, 0xf3, 0xfa, 0xf8, 0xee, 0x33, 0x18, 0xdf, 0x00, 0xce, 0x29, 0x15, 0xe0, 0xf1, 0xd5, 0xc8, 0x32, 0xcd, 0x26, 0x31, 0xc7, 0xed, 0xd1, 0xee, 0xc3, 0xb4, 0xc7, 0x81, 0xc3, 0xef, 0x09, 0xf7, 0x2b, 0xa9, 0x20, 0xfc, 0x21, 0x02, 0xe3, 0xf3, 0x15, 0xd5, 0xf7, 0xf5, 0x32, 0x0b, 0xd6, 0x12, 0x06, 0x15, 0xb6, 0x1e, 0xf7, 0xed, 0x2e, 0xf0, 0xf5, 0xe4, 0x25, 0x51, 0x29, 0xf9, 0xc1, 0x0b, 0xba, 0xee, 0xc8, 0x0e, 0xdf, 0xfd, 0xee, 0x16, 0xf4, 0xdf, 0x24, 0x04, 0xe1, 0x13, 0x0d, 0x17, 0x0d, 0x0c, 0xfe, 0xfd, 0x11, 0xef, 0x04, 0xf7, 0xd8, 0xf5, 0xf4, 0xeb, 0xe2, 0xf8, 0xe9, 0xc7, 0x05, 0x1b, 0x03, 0xef, 0x39, 0xed, 0x0c, 0x0b, 0x03, 0x25, 0x06, 0x0c, 0x08, 0x03, 0xe5, 0xe9, 0xea, 0x17, 0x08, 0x11, 0x0d, 0xd8, 0x15, 0xdc, 0xf2, 0xfc, 0x19, 0xd7, 0x00, 0xdf, 0x0c, 0xe6, 0xf3, 0x04, 0x24, 0xdb, 0xf1, 0x22, 0x15, 0xfd, 0xf0, 0x11, 0xef, 0x0f, 0xf7, 0x15, 0xfd, 0x18, 0x0a, 0x1c, 0xfc, 0x06, 0x08, 0xde, 0xe9, 0xe6, 0xee, 0x2b, 0xf6, 0x81, 0x01, 0xe0, 0x18, 0x20, 0xe5, 0x3a, 0xf9, 0x14, 0x0c, 0x1a, 0xfd, 0x03, 0x1f, 0xd6, 0xf2, 0x16, 0xde, 0x18, 0x09, 0xff, 0xfa, 0x04, 0x08, 0x08, 0x0b, 0x1d, 0x07, 0x11, 0x2a, 0x0e, 0xeb, 0x10, 0xdd, 0x19, 0xec, 0x3d, 0xb3, 0x05, 0x17, 0xf2, 0x15, 0x17, 0x10, 0x01, 0xfb, 0x2d, 0x01, 0xec, 0x2e, 0xe2, 0xf2, 0x0b, 0xe1, 0xdb, 0xfa, 0xab, 0x35, 0xde, 0xdb, 0xf9, 0xc8, 0xd7, 0xc3, 0xd9, 0xe9, 0xcd, 0xc9, 0xae, 0xf0, 0xb9, 0x1f, 0x3e, 0xf8, 0x0f, 0xe9, 0xde, 0xf1, 0xca, 0x23, 0xb4, 0xe3, 0xeb, 0xfa, 0xb6, 0xea, 0xe1, 0x41, 0x9d, 0x0d, 0x0e, 0x33, 0xec, 0xce, 0xab, 0xd3, 0x2a, 0x02, 0x3f, 0xd9, 0xb7, 0x1e, 0x1c, 0xc1, 0xc9, 0xec, 0xd8, 0x19, 0x06, 0xd8, 0xd9, 0x34, 0xf9, 0xec, 0xfd, 0xeb, 0x22, 0x12, 0xcc, 0xf6, 0x3c, 0xee, 0xe4, 0x2b, 0xe1, 0xc3, 0xf8, 0x20, 0xfb, 0xe4, 0x97, 0x1f, 0xfe, 0xe3, 0x7f, 0xde, 0x2a, 0x00, 0xb7, 0xf9, 0xd0, 0x2a, 0xea, 0x2b, 0x1b, 0x01, 0xf3, 0xee, 0xff, 0x38, 0xc3, 0xef, 0xe4, 0x2e, 0xe2, 0xc6, 0xf1, 0xf6, 0xcd, 0xd3, 0x1a, 0xe4, 0x41, 0xbe, 0xdd, 0xd0, 0xc6, 0x2e, 0xdd, 0xbb, 0x02, 0x0a, 0x24, 0x15, 0x1f, 0xec, 0x08, 0xdd, 0xcd, 0x21, 0x2f, 0xe1, 0xca, 0x0e, 0x0f, 0xff, 0x10, 0x03, 0xe4, 0xff, 0x26, 0x0a, 0x2c, 0x07, 0x0f, 0x18, 0x0f, 0xcd, 0xfa, 0x30, 0x14, 0xed, 0xd8, 0xd8, 0xfd, 0x27, 0x08, 0xd3, 0xd5, 0x1d, 0x17, 0xee, 0xd9, 0xdb, 0x00, 0xe0, 0x23, 0xdc, 0x1b, 0xc9, 0x27, 0xf0, 0x0b, 0x28, 0xd7, 0x14, 0xe0, 0x1d, 0x24, 0x31, 0xf8, 0xef, 0xf6, 0xf4, 0xcf, 0xfd, 0xef, 0x2e, 0x27, 0xd8, 0xd1, 0x1b, 0xe1, 0x22, 0x09, 0x03, 0xe3, 0xdb, 0xf4, 0x36, 0x27, 0x24, 0xd3, 0x0c, 0xec, 0xe5, 0xdf, 0xd8, 0xcd, 0x16, 0x17, 0xf3, 0xb0, 0xf9, 0x81, 0xfa, 0xf9, 0x49, 0xdc, 0xdd, 0x18, 0x01, 0xa8, 0xe2, 0x54, 0xdc, 0xac, 0x17, 0x0e, 0x0d, 0xe7, 0x16, 0x22, 0xc2, 0x04, 0x98, 0x03, 0x14, 0xc3, 0xd7, 0xde, 0x1e, 0xe6, 0x24, 0x1f, 0x09, 0x2e, 0x21, 0x08, 0x40, 0xe8, 0xc2, 0x41, 0xb7, 0xbe, 0xf1, 0x31, 0x30, 0x11, 0xc9, 0xf7, 0xd6, 0xce, 0xf7, 0x05, 0xf3, 0x0c, 0xf1, 0xf4, 0x15, 0x1d, 0x38, 0xdc, 0x4e, 0xd9, 0xe7, 0xc7, 0x26, 0x15, 0x46, 0xe0, 0x0c, 0xe2, 0xeb, 0xd6, 0x9b, 0x22, 0x08, 0x34, 0xff, 0xee, 0x02, 0x3d, 0x07, 0xb4, 0x0c, 0x33, 0xf3, 0x29, 0xed, 0xa8, 0x1f, 0x36, 0x02, 0xe5, 0x42, 0xb5, 0xef, 0xf7, 0xf3, 0xe3, 0xfe, 0xee, 0x81, 0x0c, 0xc4, 0x2b, 0x0f, 0x51, 0xda, 0x05, 0xe0, 0xa2, 0xc6, 0xd4, 0xf1, 0x2b, 0xfc, 0x10, 0xd8, 0x10, 0x97, 0xbc, 0x32, 0x54, 0xe3, 0xc3, 0x34, 0xfa, 0xf8, 0x08, 0x1b, 0x0a, 0x20, 0x2c, 0xd5, 0xed, 0x4d, 0x52, 0x09, 0xec, 0xdd, 0x16, 0xe9, 0x09, 0xe6, 0xd4, 0xc6, 0xf5, 0x07, 0xc2, 0xd1, 0x1f, 0xc1, 0x1f, 0xe3, 0xbb, 0xbc, 0xd4, 0xd1, 0xf3, 0x1e, 0x1a, 0x3b, 0xba, 0xc4, 0xe5, 0xf5, 0xda, 0x27, 0x0f, 0x10, 0xf8, 0xf2, 0x32, 0xe4, 0xd0, 0xed, 0xd7, 0x01, 0xbd, 0x11, 0x0e, 0xd9, 0xfe, 0x1f, 0xea, 0x11, 0x21, 0x1f, 0x05, 0x19, 0xb9, 0x05, 0xde, 0x02, 0x22, 0x2b, 0xee, 0x0e, 0xd5, 0xd5, 0x32, 0x2e, 0x2a, 0x3a, 0x1a, 0x26, 0x22, 0xdb, 0xe9, 0x1e, 0xa2, 0x0d, 0x29, 0x2f, 0x36, 0x15, 0xee, 0x0d, 0x04, 0x1a, 0xf0, 0x03, 0xfc, 0xd1, 0xd8, 0xed, 0x00, 0x2e, 0x15, 0x0d, 0xe3, 0x08, 0xd3, 0x0f, 0x0b, 0x01, 0x33, 0x16, 0xcc, 0xcb, 0xd4, 0xea, 0x1d, 0x9b, 0xe1, 0x26, 0xfb, 0xa4, 0xf1, 0x27, 0x81, 0xdd, 0xa3, 0x03, 0x1b, 0xd5, 0xe7, 0xd8, 0x0f, 0xec, 0x11, 0xe8, 0xd1, 0x46, 0xb2, 0x1e, 0xf7, 0x1e, 0x34, 0x42, 0x0f, 0xd9, 0x08, 0xd8, 0x33, 0x44, 0x2a, 0xfa, 0x11, 0xfb, 0x35, 0x16, 0xf4, 0xfa, 0xdd, 0xe7, 0xf2, 0xfb, 0xfd, 0xcb, 0xf8, 0xf6, 0xec, 0xf3, 0x05, 0x09, 0x11, 0x16, 0xfd, 0xef, 0xe5, 0x14, 0x12, 0xf4, 0x05, 0xde, 0x05, 0x06, 0x12, 0xf3, 0xf6, 0xfb, 0xf0, 0x08, 0x00, 0x04, 0xf9, 0xf5, 0xf1, 0xfc, 0xff, 0x07, 0xfd, 0xee, 0x05, 0xf4, 0x12, 0xf1, 0xf9, 0x17, 0x06, 0x21, 0x07, 0x0b, 0xf0, 0x00, 0x06, 0x00, 0x04, 0x1d, 0x00, 0xfb, 0xfc, 0xf2, 0xf3, 0x0e, 0xf2, 0xfb, 0x06, 0x03, 0xf7, 0x0b, 0x0e, 0x01, 0xf7, 0xfc, 0xfe, 0x06, 0xf9, 0xef, 0x12, 0x12, 0x05, 0xec, 0x06, 0x09, 0xf3, 0x13, 0x06, 0x1a, 0xf5, 0x0c, 0xdb, 0xf0, 0xf5, 0x29, 0xf5, 0xff, 0x7f, 0xf7, 0xee, 0x0a, 0xf6, 0xf2, 0xf1, 0xf1, 0xf5, 0x0c, 0x0d, 0xf7, 0x0f, 0xf3, 0x53, 0x02, 0x04, 0x04, 0x01, 0xf8, 0xdc, 0x14, 0x01, 0x01, 0xed, 0x0b, 0x00, 0x01, 0x0a, 0xe9, 0x17, 0x0f, 0xf9, 0xed, 0xfb, 0x04, 0x00, 0x35, 0x11, 0x09, 0x04, 0xfc, 0x0f, 0x0c, 0xf0, 0xfb, 0x2b, 0xd7, 0x1f, 0x0b, 0xfe, 0x30, 0x04, 0x07, 0xce, 0x02, 0xea, 0x00, 0x03, 0x2a, 0xfb, 0xe6, 0x11, 0x16, 0xf9, 0x18, 0x12, 0x1b, 0xd8, 0x0a, 0x07, 0xdc, 0x30, 0x32, 0xfe, 0xeb, 0xf0, 0xd9, 0xea, 0xcc, 0x00, 0xc9, 0xdd, 0x18, 0xeb, 0x12, 0x21, 0x09, 0x1e, 0xde, 0x02, 0x02, 0xf8, 0xed, 0x16, 0xfc, 0xcd, 0x29, 0xf8, 0x21, 0x05, 0x17, 0x2d, 0x30, 0xf1, 0xfd, 0x1e, 0xfa, 0x17, 0xff, 0xdc, 0x16, 0x18, 0xe4, 0x34, 0xdb, 0xd1, 0xfd, 0x08, 0xd5, 0x16, 0x2c, 0xdf, 0x25, 0xf5, 0xe9, 0x1d, 0x02, 0x81, 0xd2, 0xf2, 0xd6, 0x26, 0x12, 0xee, 0xed, 0x2e, 0xef, 0xe9, 0xfd, 0xeb, 0x0e, 0x9a, 0x18, 0x07, 0xe5, 0x34, 0x25, 0x30, 0xdd, 0x31, 0xdf, 0xf1, 0x13, 0xd1, 0xfa, 0xeb, 0x47, 0x01, 0x00, 0x31, 0x14, 0xdd, 0xfb, 0x11, 0x9d, 0x11, 0xec, 0xdf, 0x11, 0x46, 0x27, 0xd5, 0xc0, 0xd4, 0xd6, 0x2b, 0xb8, 0xb5, 0x09, 0xca, 0x1b, 0x49, 0x08, 0xaa, 0xfd, 0x40, 0x09, 0xea, 0x50, 0xda, 0x0f, 0xcb, 0xde, 0x14, 0xdb, 0xab, 0xdf, 0x81, 0x48, 0x28, 0xc3, 0xc5, 0x34, 0xbb, 0x17, 0xe7, 0xab, 0xb1, 0xe2, 0x41, 0xb9, 0xf3, 0x10, 0xc6, 0x29, 0xbd, 0x22, 0xe9, 0xa9, 0xc4, 0x9b, 0xef, 0x9f, 0x11, 0x10, 0xf9, 0xb1, 0xd3, 0x0c, 0xc3, 0xbe, 0x07, 0x15, 0x03, 0x94, 0xe0, 0xa4, 0xe5, 0xf1, 0x27, 0x00, 0xa9, 0x16, 0x0e, 0xea, 0xdc, 0x89, 0xde, 0xfb, 0xd9, 0xdd, 0xfb, 0xb8, 0xb2, 0xf2, 0xc8, 0xf7, 0xd1, 0xaa, 0xbb, 0xff, 0x09, 0x33, 0xa6, 0x25, 0x9f, 0x0e, 0x4d, 0x40, 0x2c, 0xd0, 0x27, 0x2c, 0x12, 0xa4, 0x09, 0x3b, 0x1c, 0xa3, 0xd8, 0x09, 0xc9, 0xbb, 0xb3, 0xa7, 0x22, 0x06, 0xd4, 0x10, 0xf4, 0x95, 0x36, 0xd4, 0x50, 0xfc, 0xc1, 0x1a, 0x1d, 0xed, 0x3f, 0x0a, 0xda, 0xce, 0x28, 0x26, 0x12, 0x3e, 0xcd, 0xfd, 0xe4, 0xee, 0xed, 0x03, 0x18, 0xdc, 0xf2, 0xea, 0x41, 0xb7, 0xdc, 0x2c, 0x01, 0xae, 0x98, 0x4c, 0x81, 0xe8, 0xe7, 0x23, 0xb4, 0x2f, 0x0c, 0x01, 0x1c, 0xfd, 0x26, 0x29, 0x1e, 0x31, 0x01, 0x2c, 0x07, 0x3e, 0xbb, 0x53, 0x2c, 0xca, 0x23, 0xf4, 0xad, 0x17, 0x0a, 0xff, 0x29, 0x1e, 0xba, 0xc4, 0x06, 0xda, 0x2e, 0x1a, 0x23, 0xe8, 0xd4, 0x2a, 0x1f, 0xda, 0x07, 0xb4, 0x20, 0xe8, 0xa6, 0xde, 0xf1, 0xb4, 0xd5, 0x98, 0x13, 0x26, 0x1f, 0x86, 0xd8, 0xc5, 0x86, 0x0e, 0xec, 0x10, 0xdb, 0x25, 0x25, 0x07, 0x18, 0x29, 0xc5, 0xc8, 0x2f, 0x2a, 0x9e, 0x15, 0xf2, 0x00, 0xff, 0xa5, 0x0a, 0x0b, 0xc1, 0xe8, 0xe2, 0x15, 0x0a, 0x19, 0x11, 0xf3, 0x28, 0xce, 0xd3, 0xe9, 0xdb, 0xdc, 0x18, 0x9e, 0x1b, 0x07, 0xa5, 0x1e, 0xec, 0xee, 0xfd, 0x3e, 0x02, 0x41, 0xf4, 0x46, 0xfb, 0xda, 0x19, 0xe0, 0x06, 0xd4, 0xdb, 0xf6, 0xd4, 0xbd, 0xe4, 0x12, 0x0f, 0xbc, 0x36, 0x33, 0x48, 0x2a, 0xc9, 0xe6, 0xa2, 0xc3, 0xce, 0x42, 0xd5, 0xe4, 0x33, 0x09, 0x81, 0x3e, 0x05, 0xc2, 0xc5, 0x1b, 0xde, 0xcc, 0x2a, 0x42, 0xf1, 0x15, 0xd2, 0xfe, 0xe0, 0xe9, 0x9d, 0xc3, 0x22, 0xdc, 0x3d, 0x36, 0xca, 0xdf, 0xc5, 0x11, 0x39, 0xe7, 0x2b, 0xbd, 0xb4, 0xbe, 0x28, 0xe1, 0xbc, 0x30, 0x65, 0x33, 0xf9, 0x0f, 0x42, 0x16, 0xe7, 0xc5, 0xbf, 0x0a, 0xc8, 0x0e, 0x0a, 0xb5, 0x1d, 0x9a, 0x09, 0xe5, 0x11, 0xeb, 0xc9, 0xe2, 0x35, 0xce, 0x21, 0xd9, 0xb8, 0xf0, 0x92, 0x24, 0x2f, 0xf8, 0x01, 0x56, 0x09, 0xd3, 0x28, 0xb7, 0xcd, 0x4f, 0x34, 0x3d, 0xba, 0xcb, 0xd6, 0xcc, 0x15, 0x43, 0xd3, 0x00, 0x1d, 0xa5, 0xc0, 0xba, 0xa7, 0xe2, 0x29, 0xe1, 0xfd, 0xd2, 0x23, 0x04, 0x1f, 0x2d, 0xde, 0x28, 0xea, 0xfb, 0xe2, 0xf5, 0xe2, 0x1b, 0x29, 0x00, 0xd8, 0x23, 0xe9, 0x33, 0x2d, 0xe7, 0xed, 0x09, 0xf1, 0xf3, 0xf2, 0xf1, 0xdd, 0xea, 0x2f, 0x28, 0xde, 0x0a, 0xff, 0x46, 0x1e, 0x44, 0xf6, 0xf4, 0xd8, 0x09, 0x05, 0x06, 0xf0, 0x1a, 0xfa, 0x02, 0xda, 0xe9, 0x16, 0x2d, 0x01, 0x0a, 0xf1, 0x06, 0x0c, 0x0a, 0xfd, 0x39, 0xdc, 0x18, 0x06, 0xfd, 0x17, 0x25, 0x18, 0xdb, 0x0c, 0x2c, 0x08, 0xea, 0x0d, 0xf1, 0xf7, 0xb2, 0xfd, 0xba, 0xf5, 0xd6, 0xfb, 0xf9, 0xf5, 0x0c, 0xe9, 0x81, 0xc3, 0x2f, 0xe1, 0x26, 0x46, 0xf6, 0xfc, 0x29, 0xe9, 0xb2, 0xf4, 0x09, 0xb3, 0x00, 0xd5, 0x2a, 0xfc, 0x1d, 0xf6, 0xd2, 0xe7, 0x13, 0xdc, 0x19, 0xd0, 0x06, 0xf0, 0xee, 0x23, 0xd9, 0xf0, 0x05, 0x0a, 0xea, 0x22, 0x25, 0x26, 0x29, 0x1c, 0x0c, 0xfb, 0xe4, 0x10, 0xf9, 0x2a, 0x12, 0x19, 0xff, 0xf5, 0x08, 0x27, 0xed, 0x30, 0x1c, 0x21, 0x14, 0xfb, 0xce, 0x0e, 0xd6, 0xee, 0x0d, 0x24, 0xf6, 0xd6, 0xdb, 0x25, 0x0c, 0x05, 0xd4, 0xf2, 0xdd, 0xea, 0x19, 0x08, 0xbd, 0x16, 0xae, 0x18, 0x19, 0x2f, 0xf1, 0x19, 0x1d, 0xee, 0xe5, 0x0a, 0x07, 0xd3, 0x1f, 0xce, 0x07, 0x19, 0xd2, 0x0f, 0x04, 0x32, 0xef, 0xdc, 0xe3, 0x2b, 0x27, 0xea, 0x1a, 0xef, 0x1a, 0x1d, 0x14, 0x15, 0xe3, 0x29, 0x23, 0xd8, 0xd1, 0xb0, 0x00, 0x30, 0x12, 0x15, 0x05, 0x17, 0x30, 0x16, 0x05, 0xc9, 0xec, 0xa7, 0xfe, 0xf8, 0x23, 0xdd, 0x29, 0x0e, 0x09, 0xcb, 0x3b, 0x22, 0xd2, 0x14, 0xc9, 0xd2, 0x25, 0x0d, 0xcd, 0x0e, 0x28, 0xfe, 0x29, 0xdf, 0x27, 0x30, 0xdd, 0x26, 0x06, 0xfe, 0xe7, 0xf0, 0xe9, 0x06, 0x1a, 0xd2, 0x10, 0x0b, 0x81, 0x15, 0xff, 0x2f, 0xeb, 0x24, 0x30, 0xf0, 0x2a, 0xc8, 0xfa, 0xfe, 0xfd, 0x3c, 0xc9, 0xcb, 0xe6, 0x24, 0xb0, 0x03, 0xfe, 0xd2, 0xe3, 0xb4, 0x46, 0x03, 0xc8, 0xfd, 0x05, 0x21, 0x24, 0x99, 0xfe, 0x13, 0x40, 0x19, 0xf7, 0xf9, 0xe4, 0xd6, 0xec, 0x29, 0xd9, 0x15, 0xe1, 0x02, 0x29, 0x06, 0xd2, 0x1d, 0xd7, 0xff, 0xce, 0xf6, 0x23, 0x33, 0xe6, 0x1d, 0x09, 0x03, 0xdb, 0xf0, 0x25, 0xf8, 0x01, 0x13, 0x1f, 0x02, 0xe3, 0x31, 0xd8, 0x24, 0x01, 0x0b, 0xbd, 0xeb, 0xa7, 0x41, 0x22, 0xd8, 0x24, 0xc4, 0xdc, 0xbd, 0xe8, 0xec, 0xda, 0xb0, 0xca, 0xc2, 0x09, 0xd9, 0xc2, 0x9f, 0x0a, 0xbf, 0xc4, 0x7f, 0xc5, 0xef, 0xcc, 0x00, 0x9d, 0xdc, 0x27, 0xc3, 0xc6, 0x06, 0x34, 0x06, 0xcc, 0xe1, 0xef, 0xc9, 0xc3, 0x06, 0xe4, 0x3a, 0xbb, 0xbf, 0xe6, 0xf9, 0xb7, 0x19, 0x03, 0xd7, 0xf0, 0x05, 0x3b, 0xf0, 0xf0, 0xd4, 0xf5, 0x2f, 0x2b, 0xdf, 0xcb, 0x2a, 0x05, 0xdd, 0x1d, 0x2d, 0x1b, 0x37, 0x17, 0xf1, 0xf0, 0x38, 0x02, 0x09, 0x25, 0xee, 0x24, 0x07, 0xf0, 0xd8, 0xe9, 0xf5, 0x0b, 0x70, 0xe9, 0xf1, 0x08, 0x18, 0x16, 0x81, 0xf1, 0xe1, 0xf5, 0xe6, 0xab, 0xdf, 0x1d, 0xf7, 0xdc, 0x1a, 0x14, 0xe6, 0xf2, 0xe2, 0xc9, 0xe7, 0xea, 0xf3, 0x0d, 0xfc, 0x48, 0xff, 0xdf, 0x08, 0xfb, 0xf9, 0x2d, 0x02, 0xb3, 0x35, 0x01, 0xe0, 0xd1, 0x22, 0x20, 0x02, 0x1f, 0x99, 0x41, 0xaf, 0x1b, 0xc5, 0xfa, 0x34, 0x11, 0x1e, 0xd3, 0x25, 0x36, 0x1f, 0x12, 0x11, 0x03, 0x09, 0x1e, 0x36, 0x30, 0xe6, 0x35, 0xf7, 0x08, 0x0f, 0xd9, 0xda, 0x39, 0x04, 0xbf, 0xe4, 0xda, 0x41, 0x15, 0xea, 0xde, 0x11, 0xdd, 0x12, 0x24, 0x0a, 0xbb, 0xfd, 0xd8, 0x36, 0x2b, 0xd7, 0x0c, 0xf0, 0xea, 0xff, 0xde, 0x5c, 0x52, 0xff, 0x2f, 0xea, 0xdf, 0x23, 0x0e, 0x1f, 0xf3, 0x20, 0xf2, 0xf7, 0x0b, 0x1b, 0x12, 0xf7, 0xe7, 0x05, 0x02, 0x06, 0x0b, 0xe7, 0x1a, 0x1a, 0x19, 0x02, 0x07, 0xe7, 0xf9, 0xef, 0x0e, 0x1b, 0x00, 0xe7, 0x1b, 0x1d, 0x0c, 0xb2, 0x11, 0x21, 0xff, 0xf8, 0x8f, 0xca, 0xdb, 0xfb, 0xe3, 0x09, 0x1d, 0x1c, 0xde, 0x0d, 0x81, 0xfc, 0x1a, 0x1c, 0x10, 0xfa, 0x0d, 0x0e, 0x01, 0x09, 0xef, 0xea, 0xf8, 0xf6, 0xe8, 0xe9, 0x00, 0x0d, 0xf3, 0xe6, 0x11, 0x0c, 0xf1, 0xb6, 0x1e, 0xbd, 0xef, 0xce, 0xf0, 0x0f, 0x29, 0x18, 0xef, 0x30, 0xf2, 0x1b, 0x11, 0xdf, 0xf1, 0x1b, 0xf2, 0x18, 0x04, 0x13, 0xf7, 0xf3, 0x09, 0x04, 0xd9, 0xf8, 0xfa, 0x08, 0xd7, 0x04, 0xf0, 0xf8, 0x1f, 0x13, 0xfc, 0x01, 0xfb, 0xe7, 0xfc, 0x05, 0xd3, 0x1b, 0x03, 0x25, 0xff, 0xf6, 0x0b, 0xf6, 0xf9, 0xe9, 0xc2, 0xf4, 0x43, 0x13, 0x12, 0xf5, 0xf0, 0xd6, 0x81, 0x25, 0x34, 0x43, 0xc5, 0xc5, 0xfb, 0xca, 0x1c, 0x22, 0x0d, 0xcd, 0xe2, 0x0d, 0x1e, 0xf0, 0x14, 0xf5, 0xce, 0xd9, 0x13, 0xd0, 0x23, 0xc8, 0xa1, 0x89, 0xe2, 0xe5, 0x4a, 0xe5, 0xf3, 0x84, 0x06, 0x13, 0xf8, 0xf4, 0xa5, 0xcf, 0xbd, 0xe0, 0xe6, 0xd4, 0xdf, 0xed, 0xc0, 0xaf, 0xc1, 0x00, 0xd9, 0xdd, 0x08, 0x99, 0x18, 0x14, 0xdd, 0xed, 0xc0, 0xd6, 0xe5, 0x17, 0x38, 0x35, 0x3d, 0x4c, 0xd3, 0x48, 0xed, 0xb7, 0xd3, 0xb1, 0x2f, 0x31, 0xff, 0xb8, 0x47, 0x01, 0xe1, 0xe8, 0xfa, 0x21, 0x4e, 0x43, 0xe2, 0x0f, 0xeb, 0xb3, 0x32, 0xc7, 0x2a, 0xcb, 0xe4, 0xe3, 0xe1, 0x08, 0xc3, 0x25, 0x39, 0xd2, 0xc0, 0x45, 0xfc, 0x36, 0x1d, 0x59, 0xd3, 0x9c, 0xd4, 0x03, 0xfa, 0xd4, 0xb8, 0xf6, 0xbc, 0xcb, 0x2a, 0x99, 0x29, 0xd6, 0x0c, 0x1a, 0xdc, 0xa5, 0x19, 0x4d, 0xb5, 0xa4, 0x09, 0xdc, 0xf3, 0x01, 0xfc, 0xf7, 0xb2, 0x14, 0x0b, 0x23, 0xe9, 0xe6, 0xf9, 0x26, 0xf6, 0x0f, 0x13, 0xeb, 0x26, 0x10, 0x10, 0xdb, 0x01, 0xdc, 0x07, 0xf1, 0x0a, 0x1c, 0xb1, 0x9a, 0x0b, 0x0b, 0xfa, 0xd7, 0xf7, 0x1e, 0x23, 0x9d, 0xd3, 0xbb, 0xf2, 0xfc, 0x18, 0xde, 0xe1, 0xea, 0xea, 0xf9, 0xd8, 0x1f, 0x0d, 0xe3, 0x16, 0x18, 0xcd, 0x17, 0xf5, 0xe9, 0xd9, 0x24, 0x21, 0xec, 0x10, 0xf8, 0xdb, 0xfd, 0xa8, 0x1a, 0x29, 0x28, 0xe0, 0xd6, 0x2b, 0x0f, 0xee, 0x35, 0x1d, 0xf8, 0x10, 0xef, 0x10, 0x05, 0xde, 0x05, 0xec, 0x23, 0x0d, 0xed, 0x06, 0x19, 0x11, 0xf1, 0xff, 0x8d, 0xfe, 0xff, 0x02, 0x18, 0x3a, 0xe3, 0xe2, 0xe5, 0x98, 0x1c, 0xe2, 0xda, 0x81, 0xfd, 0xe0, 0x1e, 0x17, 0xee, 0xc4, 0x24, 0xf6, 0x08, 0xfe, 0x17, 0xf4, 0x86, 0x31, 0xf9, 0x25, 0xe7, 0x0a, 0xdf, 0xfc, 0x19, 0xd8, 0xea, 0x0c, 0xd5, 0xec, 0xda, 0xea, 0xeb, 0xdc, 0x17, 0xdf, 0xed, 0xc2, 0xe9, 0x00, 0xf0, 0xeb, 0xe4, 0xd9, 0xfc, 0x1b, 0xf0, 0x24, 0x2e, 0x16, 0xd8, 0xcc, 0xf8, 0xd2, 0xd1, 0xf7, 0x0f, 0xfd, 0xd0, 0x0d, 0x2c, 0xe4, 0xb2, 0xf2, 0x1a, 0xc4, 0x0a, 0xf3, 0x0a, 0xfe, 0xec, 0xe8, 0x24, 0xcc, 0xf2, 0xd1, 0x33, 0x0d, 0x0d, 0x5f, 0xed, 0x13, 0xe6, 0x4e, 0x1d, 0xfe, 0xd6, 0x38, 0xeb, 0x2c, 0xfb, 0xf7, 0x3a, 0xfd, 0xd4, 0xda, 0x12, 0xbd, 0x4b, 0xc8, 0x5d, 0x19, 0x00, 0x81, 0x15, 0x25, 0xf4, 0xea, 0x2a, 0xc1, 0xd5, 0xef, 0xc1, 0x16, 0x9d, 0xf1, 0x04, 0xd7, 0xd1, 0x24, 0x23, 0xf9, 0xe7, 0xf6, 0xd6, 0xef, 0x3d, 0xb3, 0xb8, 0x35, 0x43, 0x91, 0xdc, 0x17, 0x34, 0xf5, 0x2a, 0x3c, 0x09, 0xfc, 0xe9, 0x17, 0xe7, 0xc5, 0x11, 0x11, 0xcf, 0x3f, 0x35, 0x0e, 0xc4, 0xcf, 0x45, 0xc8, 0xb7, 0x29, 0xd9, 0xf0, 0x13, 0xde, 0xf1, 0xfb, 0xf8, 0x1c, 0xda, 0x2f, 0xf5, 0xbf, 0xcf, 0xf8, 0x1e, 0xd9, 0xb7, 0x1b, 0xd7, 0xff, 0xef, 0x04, 0x08, 0xfb, 0x3c, 0x19, 0x13, 0xe5, 0xd7, 0x59, 0xfe, 0xf8, 0x0b, 0xec, 0xdc, 0x0b, 0x16, 0x35, 0x0f, 0x2a, 0xf5, 0x28, 0xf5, 0x14, 0xdb, 0xfb, 0x02, 0x1e, 0xfb, 0xbe, 0x19, 0x0e, 0xec, 0xe0, 0x20, 0x3f, 0x0d, 0xda, 0x21, 0x00, 0xe6, 0x22, 0xda, 0xed, 0xd9, 0xc9, 0x0f, 0xd7, 0x1d, 0x98, 0x47, 0x07, 0x0f, 0xd8, 0x00, 0xf4, 0x1b, 0x3b, 0x9b, 0xf9, 0xcd, 0xe3, 0xd3, 0x07, 0xa5, 0xc2, 0xd2, 0x18, 0x0a, 0x00, 0x23, 0x16, 0x49, 0x12, 0xdd, 0xfb, 0x06, 0x41, 0xb7, 0xe6, 0x45, 0x1b, 0x55, 0xff, 0x3c, 0xf6, 0x0b, 0x0b, 0xfa, 0x26, 0x03, 0xfd, 0x0b, 0x38, 0x0c, 0xd8, 0xec, 0xe7, 0x1a, 0x00, 0x46, 0x81, 0x19, 0xf1, 0x16, 0xe4, 0x15, 0xe9, 0x0f, 0xed, 0xf2, 0x01, 0x08, 0xe6, 0x11, 0xf3, 0xed, 0x04, 0xf9, 0x81, 0xdd, 0xfe, 0x0f, 0x19, 0x9c, 0xf7, 0x0f, 0xf1, 0x0b, 0xff, 0x0e, 0x1a, 0xd2, 0xf6, 0xf2, 0xff, 0xed, 0x30, 0x02, 0xfe, 0xf2, 0xfa, 0x05, 0x06, 0x03, 0x12, 0x07, 0x07, 0xed, 0x0c, 0xff, 0x06, 0xf8, 0x0b, 0x16, 0xfa, 0xf4, 0x9c, 0x00, 0x0a, 0x01, 0x12, 0xf3, 0x2a, 0x1c, 0xff, 0x0e, 0x0b, 0xe9, 0x01, 0xf6, 0xfd, 0x12, 0xe1, 0xea, 0xf2, 0x1a, 0x97, 0x14, 0xea, 0xf9, 0xfd, 0x0a, 0xcc, 0x1a, 0xd9, 0xae, 0xfd, 0xa5, 0xe6, 0x01, 0x09, 0xa9, 0x07, 0xb1, 0x0a, 0xdd, 0xf5, 0xfd, 0x00, 0x0a, 0x01, 0xf4, 0xaf, 0xfc, 0x1f, 0xbe, 0xf3, 0x24, 0xf2, 0x23, 0xfc, 0x28, 0xea, 0x14, 0xfd, 0xf4, 0x20, 0xf8, 0x0a, 0x0b, 0x2a, 0x05, 0xec, 0xfa, 0x0e, 0x14, 0xf1, 0x28, 0xc9, 0x08, 0x0a, 0x12, 0x01, 0x17, 0x0e, 0x25, 0x17, 0xe5, 0x02, 0x0e, 0xdc, 0xec, 0x1a, 0x0f, 0xe4, 0x25, 0x0c, 0x15, 0x07, 0xe9, 0xcf, 0x24, 0xea, 0x23, 0x18, 0x0d, 0xe1, 0xe1, 0xd0, 0x05, 0xff, 0xf9, 0x18, 0x10, 0x8a, 0x81, 0x08, 0x29, 0xe2, 0xfb, 0xe8, 0xd8, 0xf2, 0xfb, 0xf7, 0x11, 0x19, 0xdd, 0x07, 0x30, 0xc3, 0x11, 0xd2, 0xec, 0xf2, 0xfc, 0xd9, 0x01, 0x14, 0xe2, 0xeb, 0x21, 0x1c, 0xec, 0x1e, 0x07, 0x12, 0x1f, 0xed, 0xde, 0x23, 0x14, 0xf6, 0xb2, 0x17, 0xfc, 0xfa, 0xde, 0xf4, 0xf7, 0x34, 0x0f, 0x27, 0x02, 0x0e, 0x0b, 0x0b, 0xfd, 0xe9, 0x21, 0xe2, 0x00, 0xf7, 0xfd, 0x02, 0x00, 0xf2, 0xa2, 0xc4, 0x06, 0x1d, 0x02, 0xd2, 0x5d, 0x18, 0xc6, 0x01, 0xc1, 0x01, 0xcd, 0x0e, 0xdc, 0xe3, 0x0d, 0xf0, 0x0a, 0xe4, 0xe7, 0x97, 0xd7, 0x16, 0xff, 0x03, 0xfb, 0xf3, 0xf7, 0x32, 0x10, 0xff, 0x1b, 0xdc, 0xc9, 0xf5, 0xfc, 0x0c, 0xe4, 0xf6, 0x23, 0x11, 0xf5, 0x16, 0xea, 0x02, 0xdd, 0x1e, 0xd8, 0xfb, 0xe0, 0xe2, 0x24, 0xf6, 0x23, 0xf1, 0x10, 0x25, 0x09, 0x23, 0xf5, 0xf6, 0xf3, 0xe2, 0xdf, 0xf4, 0x8a, 0x1b, 0xf0, 0xd2, 0xf6, 0x86, 0xbc, 0xa5, 0x12, 0x04, 0xf5, 0x35, 0xd7, 0x1e, 0xef, 0xb9, 0x04, 0x32, 0xfb, 0x15, 0xf6, 0xb7, 0x1e, 0xe3, 0xea, 0xbc, 0x25, 0x00, 0x04, 0x17, 0x1b, 0x2a, 0xf4, 0xe2, 0x0c, 0xf2, 0x13, 0x33, 0x81, 0xfc, 0xcc, 0xdb, 0xbd, 0xc7, 0xeb, 0x1a, 0xce, 0xe1, 0x0f, 0xf0, 0x0e, 0xed, 0xe8, 0x34, 0xbf, 0x20, 0xda, 0x17, 0xf9, 0xdf, 0xf0, 0x26, 0xf2, 0xaa, 0x1d, 0x44, 0xe1, 0x04, 0xa5, 0xf9, 0xde, 0xd7, 0xd3, 0xf9, 0x01, 0x1a, 0x31, 0x00, 0xd4, 0xcd, 0x17, 0xec, 0xe9, 0xf9, 0xdd, 0x27, 0xfe, 0x2c, 0xd4, 0x36, 0xd5, 0x21, 0x08, 0xe6, 0xba, 0xf4, 0xe2, 0xf5, 0x02, 0xe0, 0x2f, 0x0f, 0x0f, 0x25, 0x18, 0xe5, 0x1f, 0x23, 0xf1, 0x02, 0x0d, 0x24, 0xf8, 0xba, 0xf8, 0xe1, 0x22, 0x1d, 0xd6, 0xea, 0x1a, 0xfa, 0xf4, 0x17, 0x13, 0x25, 0x34, 0xd8, 0xe8, 0x26, 0xd6, 0x17, 0x3b, 0x9d, 0xec, 0xf0, 0x21, 0xe4, 0x10, 0xf3, 0xf2, 0x32, 0xe7, 0xb6, 0x25, 0x0e, 0xfd, 0x02, 0xdc, 0x81, 0xd6, 0xcf, 0xd1, 0xf4, 0x1a, 0xf6, 0xd7, 0x05, 0xe0, 0xef, 0x07, 0x00, 0x18, 0xb7, 0xed, 0xef, 0xd0, 0x07, 0xbd, 0x20, 0xf5, 0x0c, 0xf1, 0x1f, 0xfa, 0x08, 0x00, 0x2a, 0xfc, 0xc1, 0xda, 0xfe, 0xb4, 0xeb, 0xf0, 0xce, 0xed, 0xda, 0x02, 0xed, 0xdb, 0x0a, 0xe5, 0xda, 0xec, 0xe3, 0x26, 0x39, 0xf6, 0x15, 0xee, 0x04, 0x06, 0x14, 0x24, 0xef, 0xd1, 0xd3, 0x0e, 0xfd, 0x1c, 0xea, 0xf2, 0xf1, 0x1a, 0x01, 0x00, 0x18, 0x1c, 0xe3, 0xdc, 0x2a, 0x37, 0x18, 0x33, 0x04, 0xe1, 0x22, 0xe5, 0x01, 0xf8, 0xed, 0x16, 0x2e, 0x25, 0x01, 0x26, 0xf0, 0xcd, 0xec, 0x05, 0xeb, 0x01, 0x24, 0xdd, 0x21, 0xde, 0x03, 0xf4, 0xed, 0xac, 0x1e, 0x31, 0xe2, 0x2a, 0x07, 0xf1, 0xff, 0x00, 0xbc, 0x0d, 0x16, 0x1d, 0xe8, 0x09, 0xe5, 0x2a, 0x2c, 0xeb, 0x08, 0xf5, 0x0c, 0xd6, 0xe3, 0x0e, 0xf8, 0x1b, 0x20, 0x1a, 0xf5, 0xe0, 0x4d, 0xd4, 0xd1, 0x18, 0x03, 0xfc, 0xf8, 0x07, 0xf8, 0xce, 0x0c, 0x10, 0x1a, 0x11, 0xef, 0x17, 0xfc, 0xc8, 0xfa, 0x17, 0xdc, 0xf0, 0xbf, 0xf0, 0xed, 0xe1, 0xf8, 0xeb, 0x11, 0x81, 0xf2, 0xe8, 0xfc, 0xec, 0x0f, 0x1a, 0x0c, 0x21, 0x07, 0xdb, 0xd9, 0x14, 0xf2, 0xb9, 0xfe, 0x3b, 0x0e, 0x24, 0xf4, 0x2b, 0xf1, 0xed, 0x1b, 0xf6, 0x16, 0x22, 0xd9, 0xdc, 0x54, 0x34, 0x20, 0x45, 0xf6, 0xf1, 0x12, 0x4d, 0xb5, 0x29, 0x27, 0xfb, 0x19, 0x16, 0x08, 0xe0, 0x16, 0x15, 0x1d, 0xfc, 0xf3, 0xc5, 0xf3, 0xe7, 0xe6, 0xec, 0xe2, 0x0f, 0xe7, 0x13, 0xc3, 0xdd, 0xe6, 0xef, 0xfb, 0xf6, 0xef, 0x0a, 0xe0, 0xf1, 0xf7, 0x07, 0x0b, 0xfb, 0xc1, 0x21, 0x01, 0xf7, 0xe0, 0x35, 0x28, 0xff, 0x06, 0xf2, 0x01, 0x11, 0xef, 0x17, 0x1d, 0xec, 0x27, 0x19, 0x13, 0xf3, 0xef, 0xff, 0x13, 0xe8, 0xf4, 0xe3, 0xf1, 0xe9, 0xf5, 0x0e, 0x19, 0xf8, 0xfb, 0x19, 0x10, 0x0a, 0xf1, 0xe2, 0x15, 0x11, 0xd7, 0xe5, 0x23, 0xf1, 0x0d, 0x16, 0xb1, 0xfb, 0xd1, 0xe1, 0x09, 0xe9, 0x18, 0xe9, 0xe1, 0x61, 0xe3, 0xe3, 0x01, 0x23, 0x01, 0x09, 0x22, 0xc0, 0x21, 0x01, 0xff, 0xeb, 0xe6, 0x7f, 0xf9, 0xb0, 0x11, 0xd2, 0xf1, 0xcd, 0xea, 0xde, 0xe4, 0x03, 0xe8, 0xf4, 0x03, 0x15, 0x8c, 0xee, 0xe8, 0xfe, 0x07, 0xfa, 0xd2, 0xe7, 0x4e, 0xf0, 0xf3, 0x1d, 0x25, 0xc4, 0xd4, 0x20, 0xf3, 0x31, 0x96, 0x09, 0x24, 0x0f, 0xeb, 0x0e, 0xe8, 0x1c, 0x23, 0xbe, 0x06, 0x1e, 0x72, 0x25, 0x34, 0xce, 0x08, 0xf8, 0x0e, 0x04, 0xfb, 0x3c, 0xcf, 0xbc, 0x06, 0x26, 0x26, 0x81, 0xd3, 0x0d, 0x30, 0xb3, 0xc9, 0x86, 0xe6, 0xe1, 0x11, 0xe4, 0x19, 0xcf, 0xf8, 0xeb, 0xe2, 0x36, 0x10, 0xf5, 0x3b, 0x16, 0xbd, 0xd8, 0xf7, 0xfd, 0x1e, 0x35, 0x29, 0xf2, 0x09, 0x2b, 0x35, 0x15, 0xdb, 0x1f, 0x3f, 0xd3, 0x15, 0x9b, 0xfc, 0xe8, 0x34, 0x16, 0xe3, 0xf7, 0x00, 0xd1, 0x5f, 0x22, 0xf9, 0xf9, 0xcc, 0x3d, 0xe8, 0xda, 0x54, 0x34, 0x31, 0xf0, 0xfd, 0xc8, 0x23, 0x3d, 0x8d, 0xfe, 0x1d, 0x1d, 0xe8, 0xf5, 0xba, 0x3b, 0xfd, 0xfc, 0xbc, 0x67, 0xf4, 0x13, 0x41, 0xdc, 0xaa, 0x27, 0x03, 0x0d, 0x74, 0x13, 0xce, 0xd2, 0x2d, 0x20, 0x2d, 0xd1, 0xf8, 0xe0, 0x07, 0x16, 0xd8, 0x02, 0xf0, 0x13, 0x17, 0x0d, 0x00, 0xfc, 0x13, 0xf2, 0x11, 0x10, 0xe5, 0x02, 0xe9, 0x15, 0x01, 0x0e, 0xf3, 0xe7, 0x13, 0x0d, 0xe9, 0x19, 0x0d, 0xfc, 0xfc, 0xf0, 0x19, 0x0b, 0xf6, 0xe8, 0xec, 0x15, 0x0c, 0x04, 0xef, 0xe7, 0x06, 0xf8, 0x2d, 0xfa, 0x17, 0x0a, 0xef, 0xf5, 0xf7, 0xdb, 0xf4, 0xe9, 0xfd, 0xf6, 0xee, 0xf1, 0xfd, 0x06, 0xec, 0xf8, 0xf8, 0xfd, 0xf7, 0xf4, 0xf2, 0x17, 0xfc, 0x14, 0x16, 0x0d, 0x07, 0xf4, 0xec, 0x05, 0xe9, 0x01, 0xe7, 0xe7, 0x0a, 0x0b, 0xed, 0x09, 0xf9, 0xf1, 0xf6, 0xf7, 0x29, 0xfe, 0x04, 0x4e, 0xee, 0xd6, 0xec, 0xf4, 0x0a, 0x09, 0x01, 0xe8, 0xfc, 0x18, 0xd8, 0x10, 0x09, 0x7f, 0xee, 0xf2, 0x14, 0x08, 0x25, 0xf3, 0xf3, 0xfb, 0xee, 0xf2, 0xf7, 0x0b, 0xea, 0x04, 0xeb, 0xf3, 0x19, 0xe1, 0xef, 0x04, 0xf7, 0xe2, 0x27, 0xf3, 0x0e, 0xf6, 0x0f, 0xff, 0xf3, 0x27, 0xf7, 0x1e, 0xd2, 0x0d, 0x19, 0xe1, 0x2a, 0x02, 0x14, 0xfb, 0xf9, 0x1a, 0x01, 0x1f, 0x0b, 0xfd, 0xf3, 0xf4, 0x13, 0xea, 0xfd, 0xfa, 0xf0, 0x34, 0xb3, 0x9e, 0xe9, 0x0b, 0x09, 0xe2, 0xfd, 0x03, 0x27, 0xa4, 0x01, 0xc9, 0x09, 0xe2, 0x02, 0x19, 0x23, 0xd8, 0xea, 0x07, 0x22, 0x1b, 0xf9, 0xf6, 0xf7, 0x1f, 0xf6, 0xf0, 0x0c, 0xf7, 0xe9, 0x0e, 0xe4, 0x26, 0x1d, 0xec, 0xe0, 0xf4, 0x9b, 0x27, 0x18, 0xf3, 0x1c, 0xe9, 0x28, 0xbe, 0xf8, 0x2a, 0x07, 0x16, 0x02, 0xeb, 0x0e, 0x0e, 0x00, 0x30, 0xd6, 0x14, 0xf6, 0xfa, 0x0d, 0x15, 0x07, 0xed, 0xe4, 0x81, 0x00, 0xfc, 0xb0, 0xf3, 0x1d, 0x29, 0xe0, 0xd4, 0x9e, 0x00, 0xe5, 0xdd, 0x8b, 0x3e, 0x0d, 0x16, 0xf5, 0x15, 0x0e, 0x21, 0x08, 0x10, 0x32, 0xd5, 0xe6, 0xa7, 0x16, 0x0b, 0x41, 0xd9, 0x12, 0xe6, 0x30, 0x17, 0xb3, 0xd8, 0x25, 0xfe, 0xf8, 0x10, 0xda, 0xd9, 0xfb, 0xf0, 0x13, 0xe9, 0x00, 0x1c, 0x00, 0x0e, 0xf7, 0x1d, 0x12, 0x09, 0xe9, 0x1f, 0xfb, 0x0b, 0xf3, 0x06, 0xf3, 0x26, 0x96, 0xc0, 0xf6, 0xf1, 0xcb, 0x0d, 0xfa, 0xf2, 0x1e, 0xc3, 0xe7, 0xba, 0xde, 0xd8, 0xef, 0xf9, 0xf5, 0x07, 0xf4, 0x2a, 0xda, 0xfd, 0xe6, 0x0d, 0x00, 0x16, 0x0b, 0x1c, 0xeb, 0x17, 0xcc, 0x0e, 0x1b, 0xfb, 0xf1, 0x16, 0xeb, 0x1b, 0xb2, 0xf0, 0xfb, 0xe7, 0x0f, 0xe1, 0x18, 0x06, 0xee, 0x1e, 0xf7, 0x1f, 0x18, 0x1c, 0x08, 0x07, 0x06, 0x1e, 0xfa, 0x0d, 0xef, 0xec, 0x1b, 0x0c, 0xe4, 0xe8, 0xfc, 0x99, 0x0a, 0xf2, 0xc8, 0xed, 0x30, 0x01, 0xf2, 0x1d, 0xab, 0x08, 0xf5, 0xe6, 0xa2, 0xe9, 0x05, 0xe4, 0x0d, 0xe3, 0xdd, 0x0e, 0xf7, 0x29, 0xfc, 0x0b, 0xf4, 0x81, 0x03, 0x1c, 0x1f, 0xc3, 0xda, 0x0d, 0x03, 0x1f, 0xd2, 0xd9, 0xfa, 0x1a, 0xf8, 0xf0, 0xe8, 0xd5, 0x14, 0xd5, 0x13, 0x26, 0xfc, 0x01, 0x10, 0xdc, 0xe1, 0xfe, 0x13, 0x0c, 0x24, 0x0e, 0x19, 0x09, 0x05, 0xf2, 0x16, 0x25, 0xb3, 0x9c, 0xf6, 0xec, 0xdb, 0x0f, 0xf4, 0xf3, 0x3a, 0x9e, 0xf3, 0xe4, 0xd8, 0x1c, 0xdf, 0xe2, 0x16, 0x19, 0x24, 0x35, 0x12, 0xeb, 0x10, 0x05, 0xfb, 0x03, 0x04, 0xf5, 0x0d, 0xfe, 0xff, 0x20, 0xf1, 0xd9, 0x00, 0xff, 0x04, 0x0a, 0xa7, 0x1a, 0xde, 0xf5, 0x21, 0xbf, 0x0a, 0xbb, 0x02, 0x51, 0x04, 0x16, 0x17, 0xed, 0x28, 0x17, 0x10, 0x1f, 0x0d, 0x44, 0xe3, 0xfd, 0xfa, 0x22, 0x23, 0xd6, 0xe9, 0x97, 0xea, 0xfa, 0xbb, 0xe9, 0x37, 0x1f, 0xe5, 0xe3, 0xb0, 0x33, 0xf7, 0x19, 0x81, 0xf7, 0xeb, 0x05, 0x18, 0x1b, 0xd3, 0xdd, 0xed, 0xf3, 0x26, 0xf8, 0xe0, 0x96, 0x07, 0xdf, 0x63, 0xde, 0xeb, 0x03, 0xdf, 0x2b, 0xf7, 0xbc, 0x1c, 0x19, 0x04, 0x2a, 0xcd, 0xfa, 0xd6, 0x12, 0x1d, 0x02, 0xde, 0x32, 0x0e, 0xfa, 0x0b, 0x19, 0x27, 0xef, 0x1c, 0x16, 0xbd, 0xc9, 0xd5, 0xe9, 0xf5, 0x64, 0x9f, 0xb6, 0xfe, 0xcf, 0xb0, 0x30, 0xc9, 0xe5, 0x4e, 0xc5, 0xe2, 0xb2, 0xf4, 0xd5, 0xc6, 0x1a, 0xd9, 0x0a, 0xf6, 0xee, 0x23, 0x1e, 0x05, 0x22, 0x18, 0x1c, 0x0e, 0xc6, 0x01, 0x19, 0xdb, 0x48, 0xd5, 0x08, 0xf2, 0x00, 0x17, 0xd3, 0xb6, 0x22, 0xdf, 0xeb, 0x39, 0xf4, 0x08, 0xe6, 0x34, 0xea, 0x19, 0xca, 0x59, 0x1f, 0x04, 0xe9, 0xe4, 0x04, 0xd4, 0xda, 0x01, 0xae, 0x50, 0xf9, 0xfe, 0x01, 0x08, 0xbd, 0xd2, 0x3e, 0xcd, 0xcc, 0x03, 0xe6, 0xc6, 0xe6, 0x9f, 0x4e, 0x2c, 0x3f, 0xb2, 0x49, 0x35, 0x2f, 0x03, 0xd3, 0x81, 0xd3, 0x28, 0xb8, 0x2f, 0x1d, 0xde, 0xbb, 0xcb, 0xe2, 0x4b, 0x27, 0xd6, 0xe1, 0x32, 0x1b, 0xe5, 0xb0, 0xce, 0x20, 0xe0, 0xdf, 0x06, 0x27, 0x1b, 0xf3, 0x0f, 0xfc, 0x0a, 0x1f, 0x81, 0x1c, 0x3f, 0xd1, 0xc6, 0xa7, 0x2b, 0x0d, 0xe1, 0x33, 0xde, 0x10, 0xf6, 0xcf, 0x00, 0x38, 0x30, 0xec, 0x12, 0xe9, 0x21, 0xe7, 0xf4, 0x05, 0x0c, 0xe4, 0x4d, 0x13, 0x2b, 0xea, 0x16, 0xcf, 0xe0, 0x0f, 0xf9, 0x05, 0xe6, 0x0f, 0xac, 0x04, 0xd6, 0x10, 0x0e, 0x25, 0x20, 0xd9, 0xfb, 0xd1, 0x15, 0x1f, 0xfc, 0x15, 0x08, 0xcd, 0x16, 0x29, 0x00, 0xea, 0xdc, 0x4b, 0xf4, 0xef, 0x2b, 0x13, 0x9a, 0xe3, 0xd4, 0xde, 0xfa, 0xb9, 0xd7, 0x12, 0xfb, 0x9c, 0xb5, 0x8d, 0x0c, 0x13, 0x28, 0x0b, 0x26, 0x30, 0xfb, 0x00, 0x0b, 0xfa, 0xf2, 0xc4, 0x05, 0x17, 0xd9, 0x39, 0x23, 0xef, 0x1f, 0xde, 0x01, 0xfd, 0x23, 0x06, 0x00, 0xde, 0x0f, 0xf9, 0x2c, 0x06, 0x07, 0x22, 0x07, 0x27, 0xda, 0x00, 0xfe, 0xfe, 0x05, 0xf5, 0x25, 0x0d, 0x10, 0xf5, 0xcd, 0xf8, 0xf8, 0x00, 0x17, 0xf5, 0x08, 0x1a, 0x01, 0xfb, 0xed, 0x17, 0x28, 0x1b, 0x0b, 0xeb, 0xe6, 0xeb, 0xe7, 0xeb, 0x13, 0x0f, 0xd6, 0xc0, 0x13, 0xed, 0xdb, 0xfc, 0xff, 0x10, 0x35, 0xb3, 0x03, 0xcb, 0xe5, 0xfb, 0xe4, 0xfd, 0x15, 0x08, 0x15, 0x0c, 0xf4, 0xf1, 0x12, 0xfb, 0x1d, 0x0c, 0xdc, 0xe2, 0xef, 0x05, 0xda, 0x0b, 0xf2, 0x0a, 0x05, 0x15, 0xf4, 0x10, 0xb7, 0x0d, 0xf1, 0x13, 0x11, 0xd8, 0xfc, 0xf0, 0x08, 0x27, 0xf5, 0xf0, 0x12, 0xe0, 0x18, 0x12, 0x0c, 0x08, 0x12, 0x10, 0xf0, 0xe8, 0x14, 0x05, 0x1b, 0x09, 0x0d, 0x89, 0xe9, 0xed, 0xd2, 0x00, 0x22, 0xe7, 0x03, 0x13, 0xc2, 0xfd, 0x12, 0xcc, 0xa0, 0x04, 0xfc, 0x02, 0x0b, 0xf3, 0xeb, 0xff, 0xf6, 0xf4, 0xf8, 0xe7, 0x1f, 0x81, 0x06, 0xef, 0x32, 0xec, 0x09, 0x03, 0xf3, 0x17, 0xe0, 0xce, 0xb8, 0x0b, 0xc7, 0xf5, 0x05, 0x15, 0x18, 0xc8, 0xf4, 0x12, 0x12, 0xfc, 0xd0, 0x23, 0x1e, 0x29, 0xb0, 0xec, 0xc5, 0xdb, 0x0d, 0xfb, 0x37, 0x3b, 0x01, 0xed, 0xfe, 0x11, 0x0b, 0xf7, 0xc6, 0x24, 0x3f, 0x20, 0x05, 0x0c, 0x53, 0x10, 0x3c, 0xea, 0xe7, 0x02, 0x32, 0x24, 0xfc, 0xc6, 0x2d, 0xd6, 0xea, 0xcf, 0xbb, 0x18, 0x58, 0xee, 0x05, 0x25, 0xf8, 0x1a, 0x10, 0xfc, 0x40, 0x3f, 0xd9, 0x20, 0x0f, 0xc6, 0xc8, 0xdd, 0xd5, 0x03, 0xda, 0xf3, 0x11, 0xff, 0xd0, 0x3e, 0xfc, 0x26, 0x13, 0xd2, 0x2d, 0xdf, 0x25, 0xbd, 0xcc, 0x66, 0xb1, 0xc0, 0xc9, 0xc8, 0x13, 0x19, 0x15, 0xd3, 0x0e, 0xec, 0xd7, 0xfe, 0x2e, 0x7f, 0x1f, 0xb4, 0x1b, 0xea, 0x19, 0xe0, 0xf0, 0xc5, 0x02, 0x27, 0x0f, 0xd7, 0x0c, 0xbb, 0xb7, 0xeb, 0x17, 0x25, 0x13, 0x28, 0xbc, 0xe6, 0x0a, 0xfa, 0xd1, 0xf3, 0x2a, 0x0c, 0x40, 0x0f, 0xf2, 0xeb, 0x0c, 0xca, 0xfb, 0xec, 0xe4, 0xf6, 0xfa, 0x17, 0xc8, 0x11, 0xe8, 0xf6, 0xee, 0x05, 0xf4, 0x04, 0xdc, 0x15, 0xe0, 0xe5, 0x0f, 0x18, 0xfd, 0xf4, 0xe5, 0x0e, 0x1d, 0xd2, 0xf5, 0x0e, 0x1b, 0x15, 0x01, 0xf1, 0x12, 0xf6, 0x07, 0x34, 0x12, 0xee, 0x12, 0x0d, 0xe9, 0xf8, 0xed, 0x11, 0xcb, 0x11, 0xf8, 0x15, 0x07, 0x11, 0x1c, 0x21, 0x1f, 0x17, 0xf9, 0xf5, 0xed, 0x20, 0xfd, 0xfb, 0x17, 0xf1, 0xe7, 0xc8, 0x02, 0xbf, 0x14, 0x13, 0x19, 0xfb, 0x32, 0x0a, 0x24, 0xe4, 0xfd, 0x3a, 0x42, 0x08, 0x16, 0x7f, 0x01, 0x26, 0x01, 0xf8, 0x20, 0xec, 0xd9, 0xd9, 0xce, 0xe6, 0x21, 0x26, 0xbe, 0x7c, 0x06, 0xdd, 0x1a, 0xb0, 0x07, 0xc4, 0xf7, 0xe5, 0x09, 0x15, 0xae, 0xe5, 0xf6, 0x3d, 0xd0, 0xe8, 0x0b, 0xfd, 0x26, 0xe5, 0x18, 0xca, 0x74, 0x03, 0x18, 0x5f, 0xfa, 0xcc, 0xdb, 0xd7, 0x2b, 0xe4, 0x99, 0x21, 0xef, 0x2b, 0x01, 0xfe, 0x2a, 0x22, 0x05, 0xab, 0xd5, 0x2a, 0x1c, 0x03, 0xf1, 0x2e, 0xf6, 0xdd, 0xf3, 0x1d, 0x09, 0x6b, 0xa3, 0xa7, 0x20, 0xce, 0x39, 0xa3, 0xcc, 0x29, 0x2f, 0xb7, 0x03, 0xb7, 0xd4, 0xfa, 0x22, 0x14, 0xf3, 0xfd, 0x2a, 0x2b, 0xc2, 0xe7, 0xe2, 0xed, 0x0b, 0x22, 0x04, 0x31, 0x35, 0x33, 0x07, 0x26, 0x1c, 0xce, 0xca, 0xd3, 0xd4, 0x25, 0xb1, 0x10, 0xdc, 0xe6, 0xdd, 0xf1, 0x1d, 0xdb, 0x20, 0x44, 0x0b, 0x13, 0x09, 0x17, 0x35, 0xfd, 0xef, 0x1b, 0xe3, 0x30, 0xfb, 0x04, 0x0b, 0x16, 0x35, 0xe3, 0xea, 0xc4, 0x32, 0x32, 0xd3, 0xbe, 0x0d, 0x23, 0xc2, 0x01, 0x9b, 0x68, 0x0c, 0xf6, 0xbd, 0x24, 0xce, 0x19, 0x0d, 0x24, 0xb1, 0xd5, 0xfe, 0xd4, 0x7f, 0xe4, 0xda, 0xc5, 0x25, 0x32, 0x32, 0x0c, 0x15, 0xe6, 0x18, 0x49, 0xc6, 0xbc, 0x26, 0x31, 0x1a, 0xf2, 0x08, 0x2d, 0xf9, 0x17, 0x01, 0xfe, 0xf2, 0x12, 0x22, 0x39, 0x10, 0xf0, 0x1d, 0xdc, 0x0f, 0xee, 0xde, 0xf7, 0x1f, 0xdc, 0x0b, 0xfd, 0x06, 0xfc, 0x2b, 0xd1, 0x9e, 0xac, 0xf6, 0xfd, 0x34, 0x08, 0xdb, 0xba, 0xe9, 0xec, 0xff, 0xe3, 0xed, 0x08, 0x05, 0x10, 0xad, 0xeb, 0x34, 0xdd, 0xf6, 0x2f, 0xb1, 0x1f, 0xce, 0xdb, 0xba, 0x1c, 0xd9, 0x03, 0xc1, 0xfb, 0xe8, 0xda, 0xf5, 0xd0, 0x1f, 0xfc, 0xd3, 0x01, 0xff, 0xa6, 0xcc, 0xfd, 0xe0, 0x1a, 0x38, 0xf6, 0x43, 0x28, 0xfe, 0x2a, 0x23, 0x37, 0xec, 0x26, 0xcc, 0xd3, 0x30, 0xe1, 0x1e, 0xfb, 0xdf, 0xb0, 0x98, 0xf5, 0x1a, 0xca, 0x06, 0x2e, 0x01, 0xc6, 0xec, 0xc9, 0xfe, 0xba, 0x1f, 0x19, 0x20, 0x14, 0xbd, 0xe2, 0x1c, 0x3a, 0x90, 0xf6, 0xd0, 0xee, 0x24, 0xd7, 0xfc, 0xca, 0x4e, 0x04, 0x01, 0x0a, 0xe9, 0x81, 0xf0, 0x0f, 0xe6, 0x0c, 0xf1, 0x09, 0xfd, 0x23, 0x10, 0xf7, 0x08, 0xfd, 0x9a, 0xf1, 0x12, 0xfc, 0xde, 0xa9, 0x0c, 0x10, 0x10, 0xf0, 0x11, 0x05, 0x06, 0xf1, 0xf3, 0x0d, 0xf6, 0x0d, 0x19, 0x14, 0x09, 0x14, 0xef, 0x00, 0x13, 0x0b, 0x1f, 0xfb, 0x0f, 0x09, 0x08, 0xf2, 0xeb, 0xe8, 0x1a, 0x14, 0x03, 0x00, 0xa4, 0x04, 0x33, 0x10, 0xff, 0x0c, 0x13, 0xe7, 0xfe, 0xff, 0x15, 0x18, 0xec, 0x08, 0x12, 0xf5, 0xf4, 0xe6, 0xea, 0x0f, 0x93, 0x28, 0xf9, 0xf5, 0x04, 0xea, 0xd2, 0x10, 0xe8, 0xd7, 0xf5, 0xc2, 0xeb, 0xee, 0x02, 0x81, 0xd2, 0xce, 0x04, 0x02, 0xe7, 0xfe, 0xea, 0x1f, 0x00, 0x0f, 0xc4, 0xfc, 0x20, 0xd6, 0x08, 0x15, 0x00, 0x0d, 0xf1, 0x1e, 0xe5, 0x00, 0xe6, 0xf1, 0x1b, 0xff, 0x04, 0xf1, 0x32, 0x19, 0xfd, 0xfb, 0xee, 0x19, 0xdf, 0x17, 0xb1, 0x19, 0xf3, 0xf7, 0xfc, 0x22, 0x04, 0x27, 0x26, 0x2c, 0x07, 0xe8, 0x02, 0x01, 0xd4, 0x23, 0x14, 0xd7, 0x34, 0x1d, 0x11, 0xe3, 0x28, 0x07, 0xeb, 0x14, 0x28, 0x0c, 0xe0, 0x00, 0x1d, 0x18, 0xff, 0xfd, 0xf0, 0xf1, 0xe1, 0xae, 0x18, 0xef, 0xd1, 0xeb, 0x81, 0xad, 0xda, 0x05, 0xd6, 0xe3, 0x0b, 0x16, 0xd8, 0xf9, 0x85, 0x0e, 0xe5, 0x00, 0x3f, 0xf9, 0x08, 0x19, 0xff, 0xe6, 0xe0, 0xe8, 0x0f, 0x2d, 0xcc, 0xf3, 0xe1, 0xf3, 0xd9, 0xfc, 0x31, 0x16, 0xd7, 0xb5, 0x3e, 0xaf, 0x29, 0xf4, 0xfb, 0xdf, 0x51, 0xe7, 0x04, 0x1b, 0x29, 0x19, 0xda, 0x09, 0xf5, 0x09, 0x33, 0x29, 0x26, 0x00, 0xd3, 0xed, 0xd4, 0xb7, 0xc7, 0x03, 0x1c, 0xee, 0xda, 0xe6, 0xfc, 0xca, 0x01, 0xe7, 0x02, 0xf3, 0xee, 0xd9, 0x0b, 0x0b, 0xe2, 0xf1, 0x1a, 0x13, 0x05, 0xdf, 0x2a, 0xf0, 0xea, 0xd5, 0x0c, 0xdf, 0x1d, 0xde, 0x25, 0xd6, 0xfe, 0xb8, 0x1a, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x37, 0xf6, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xff, 0x0d, 0xf5, 0xff, 0xff, 0x3c, 0x05, 0x00, 0x00, 0x4f, 0xfe, 0xff, 0xff, 0x12, 0x18, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x84, 0xfc, 0xff, 0xff, 0x68, 0x06, 0x00, 0x00, 0x2e, 0xf3, 0xff, 0xff, 0x24, 0x12, 0x00, 0x00, 0x49, 0xe7, 0xff, 0xff, 0xae, 0x04, 0x00, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x58, 0x04, 0x00, 0x00, 0x15, 0x21, 0x00, 0x00, 0x7d, 0xf7, 0xff, 0xff, 0xe0, 0xfc, 0xff, 0xff, 0x2b, 0xf9, 0xff, 0xff, 0xde, 0xfc, 0xff, 0xff, 0x4f, 0xe7, 0xff, 0xff, 0x4a, 0xfc, 0xff, 0xff, 0x40, 0xed, 0xff, 0xff, 0x79, 0xef, 0xff, 0xff, 0x03, 0xe7, 0xff, 0xff, 0x42, 0xfc, 0xff, 0xff, 0x52, 0xf5, 0xff, 0xff, 0x0c, 0xe0, 0xff, 0xff, 0xbe, 0xfe, 0xff, 0xff, 0x0b, 0xe3, 0xff, 0xff, 0x10, 0xf8, 0xff, 0xff, 0x53, 0xf9, 0xff, 0xff, 0xaa, 0xfb, 0xff, 0xff, 0xb4, 0xe6, 0xff, 0xff, 0xd7, 0xea, 0xff, 0xff, 0x90, 0xdd, 0xff, 0xff, 0xe8, 0x09, 0x00, 0x00, 0x57, 0x09, 0x00, 0x00, 0xd9, 0x07, 0x00, 0x00, 0xe7, 0x08, 0x00, 0x00, 0xa1, 0xfd, 0xff, 0xff, 0x5e, 0xf0, 0xff, 0xff, 0x87, 0xf3, 0xff, 0xff, 0x92, 0x0a, 0x00, 0x00, 0xfc, 0x10, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0x80, 0xe3, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0x84, 0x09, 0x00, 0x00, 0x7c, 0xfb, 0xff, 0xff, 0x3e, 0x09, 0x00, 0x00, 0x51, 0x06, 0x00, 0x00, 0x82, 0x06, 0x00, 0x00, 0x2a, 0x05, 0x00, 0x00, 0x6c, 0xdf, 0xff, 0xff, 0x75, 0x06, 0x00, 0x00, 0x75, 0xe1, 0xff, 0xff, 0x3a, 0x02, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0xac, 0x14, 0x00, 0x00, 0xe3, 0xf2, 0xff, 0xff, 0x16, 0x0c, 0x00, 0x00, 0x26, 0xf6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0b, 0x26, 0x0b, 0x27, 0x09, 0xff, 0xa4, 0x3d, 0x81, 0xed, 0xf7, 0x22, 0xc1, 0x04, 0x28, 0xa9, 0xdb, 0x0e, 0xf5, 0x21, 0xf9, 0xe3, 0xd7, 0xfa, 0xb2, 0xaa, 0xef, 0xfe, 0x2a, 0xd7, 0xb2, 0x04, 0xee, 0xd8, 0x3b, 0xc5, 0xf8, 0xe9, 0x43, 0x21, 0xea, 0xd1, 0xe8, 0xf2, 0xc7, 0x39, 0xf6, 0xc0, 0xfa, 0xe3, 0x3a, 0x20, 0xbb, 0xdb, 0xc9, 0xd2, 0xde, 0x15, 0xaa, 0x46, 0xd5, 0x18, 0xca, 0x24, 0xe8, 0xff, 0xca, 0xe1, 0x0d, 0xc7, 0x32, 0x08, 0x09, 0xd5, 0xf3, 0xa5, 0xd0, 0x1a, 0x2c, 0xc4, 0xbf, 0x9e, 0x02, 0x30, 0xe5, 0xda, 0xd4, 0x1d, 0x01, 0xd4, 0x2b, 0xde, 0x04, 0xbd, 0x47, 0x96, 0x3c, 0x0b, 0x25, 0x05, 0xe4, 0x5b, 0x08, 0x13, 0x15, 0x0c, 0x2b, 0xf7, 0xf4, 0xcc, 0xdc, 0x12, 0xce, 0x2b, 0xb6, 0x34, 0x08, 0xe2, 0xda, 0xd4, 0xbc, 0x18, 0xfe, 0x7f, 0x31, 0xc9, 0xf1, 0xee, 0xdf, 0x1d, 0x1a, 0x20, 0xdb, 0xf0, 0xe3, 0xbe, 0x23, 0xd2, 0xf8, 0x0c, 0xdd, 0xf2, 0x2f, 0xe7, 0x1a, 0xf8, 0x19, 0x7f, 0x01, 0x4f, 0x2b, 0x0f, 0x14, 0xc9, 0xea, 0x07, 0x00, 0xdc, 0x1e, 0x30, 0x09, 0xea, 0x05, 0xd3, 0x00, 0xef, 0xe5, 0xe3, 0x0e, 0x0b, 0x23, 0xe9, 0xf7, 0xac, 0xdb, 0x25, 0x56, 0xfe, 0x0f, 0xe3, 0xff, 0x5a, 0xf1, 0x11, 0x18, 0xff, 0x2d, 0x25, 0x10, 0xf4, 0xdd, 0xd0, 0x14, 0x1c, 0x11, 0xd3, 0x26, 0x1b, 0x24, 0xf7, 0x2c, 0x2b, 0xef, 0xf4, 0x02, 0xec, 0xf5, 0x0c, 0x02, 0x21, 0x1e, 0xf7, 0x13, 0xed, 0x28, 0x05, 0x02, 0x15, 0x01, 0xe0, 0x05, 0x01, 0x0a, 0xf0, 0x21, 0x16, 0x0d, 0x01, 0x1f, 0x04, 0xec, 0x13, 0x13, 0xd3, 0x0b, 0xeb, 0xcb, 0xfb, 0xf6, 0x1e, 0x10, 0x2f, 0xef, 0x28, 0xc2, 0x81, 0xc0, 0xe8, 0xef, 0xad, 0x17, 0x1b, 0xc4, 0xf5, 0xd7, 0x05, 0xea, 0x81, 0xeb, 0xc0, 0xeb, 0x14, 0x29, 0xc4, 0xf9, 0x29, 0x49, 0xfc, 0xe1, 0xc7, 0x8a, 0xaa, 0xdc, 0xed, 0x09, 0xfd, 0xf1, 0x39, 0xb4, 0xcf, 0x3d, 0xbf, 0x20, 0x22, 0xf7, 0xc6, 0x53, 0xab, 0xf7, 0x60, 0x1b, 0xc6, 0x0c, 0x48, 0xe0, 0x17, 0x04, 0x0f, 0xcf, 0xc5, 0x9d, 0xf6, 0x22, 0xe7, 0xd9, 0xd0, 0x1b, 0x46, 0xcf, 0x02, 0xea, 0xae, 0xdc, 0x10, 0x12, 0xfe, 0xe2, 0xe8, 0x11, 0xdf, 0xd7, 0xc1, 0xea, 0xd4, 0x04, 0xd4, 0x30, 0x9b, 0x29, 0xe1, 0xc7, 0x12, 0x1a, 0x08, 0xcb, 0x23, 0xb4, 0x0a, 0x25, 0x1d, 0xfe, 0xea, 0x1f, 0xfd, 0xe9, 0x2c, 0xfd, 0x04, 0xd8, 0xd0, 0x95, 0xe5, 0xcd, 0xe8, 0x0a, 0xf8, 0xfd, 0xd6, 0xee, 0x14, 0xf0, 0xcc, 0x19, 0x1d, 0x01, 0xf2, 0xd5, 0x0c, 0xf4, 0xc7, 0xfd, 0xd2, 0xea, 0x81, 0xb8, 0xdc, 0x01, 0xb9, 0x0d, 0x23, 0x04, 0x1c, 0x25, 0x13, 0xfa, 0xd9, 0x01, 0xb3, 0xe5, 0x2f, 0x18, 0xf8, 0x06, 0xc1, 0xdf, 0x25, 0x0e, 0xd3, 0xc0, 0x1d, 0x9b, 0x3c, 0xee, 0x12, 0xf3, 0x09, 0xdf, 0xd8, 0xe5, 0xff, 0xce, 0xd5, 0xcf, 0xc8, 0x81, 0xf6, 0x00, 0xd3, 0xca, 0x9a, 0xfb, 0xb9, 0x37, 0x40, 0x29, 0xdc, 0xd4, 0x11, 0x1c, 0x1c, 0xf1, 0xf3, 0xf7, 0xe9, 0x3d, 0xc7, 0xc9, 0xcc, 0xe6, 0xf9, 0xdb, 0xb1, 0xae, 0x0f, 0xfd, 0x01, 0xeb, 0x32, 0x22, 0xfb, 0x38, 0x95, 0x3d, 0x0e, 0x32, 0xb3, 0x2b, 0xf7, 0x9e, 0xd8, 0x28, 0x09, 0x81, 0x54, 0xa9, 0xf8, 0x1a, 0x0a, 0xe6, 0xdf, 0xf0, 0x37, 0xa4, 0xf5, 0xb5, 0xf5, 0xf9, 0xc3, 0xb7, 0x41, 0xfd, 0x0d, 0xfe, 0xfe, 0x32, 0xe9, 0x20, 0xd6, 0xfa, 0xcc, 0xf8, 0xe9, 0x32, 0x44, 0x2c, 0x0f, 0x38, 0xed, 0xf1, 0x03, 0xa6, 0x89, 0xef, 0xf8, 0xec, 0x91, 0xde, 0xe1, 0xd6, 0x23, 0x20, 0xf1, 0x0b, 0x21, 0xa6, 0x5a, 0xe8, 0x45, 0xf3, 0x37, 0x5f, 0xc0, 0x36, 0xdf, 0x2b, 0x12, 0x4c, 0xdf, 0x7f, 0x2c, 0xcd, 0x56, 0xd4, 0x9a, 0xbf, 0x35, 0xcd, 0x04, 0xcc, 0x24, 0xd6, 0x20, 0x40, 0xf1, 0xfb, 0xdf, 0x12, 0xff, 0x01, 0xbe, 0x13, 0xee, 0x0d, 0x4a, 0x45, 0x06, 0x23, 0x2e, 0x13, 0x18, 0xf0, 0xfd, 0x1b, 0x14, 0x5d, 0x2b, 0x5e, 0x3b, 0xf6, 0x44, 0x1e, 0x33, 0x51, 0x5b, 0x2b, 0x31, 0x6f, 0x3b, 0x31, 0xc1, 0x9b, 0x38, 0x40, 0xf6, 0x07, 0x45, 0xe9, 0x17, 0xf0, 0x42, 0x14, 0x4e, 0xae, 0x20, 0x54, 0x1e, 0x2e, 0x22, 0x41, 0x13, 0x17, 0x5c, 0x71, 0x05, 0xed, 0x54, 0x34, 0x02, 0x1f, 0xf3, 0x0a, 0x6e, 0x46, 0x4b, 0xd4, 0x81, 0xd2, 0x93, 0xc9, 0x23, 0x41, 0xdd, 0xd5, 0x40, 0xfe, 0x03, 0xd8, 0x28, 0xba, 0x1a, 0xda, 0x02, 0x10, 0xbf, 0x2c, 0x1b, 0x5f, 0xf5, 0x44, 0x9d, 0xe9, 0xf5, 0xef, 0x01, 0x0c, 0x11, 0xd4, 0x12, 0xa3, 0xfc, 0xe6, 0xd3, 0x3c, 0x06, 0xd0, 0xc4, 0xdc, 0xe9, 0x0e, 0x0f, 0xd1, 0x7f, 0xfb, 0xc4, 0xd8, 0xb3, 0x06, 0x0f, 0x2c, 0xcf, 0x09, 0xe7, 0xd1, 0xf9, 0x02, 0x09, 0xf8, 0x10, 0x4d, 0x27, 0xf9, 0xe4, 0x5f, 0x9c, 0x1a, 0x05, 0x05, 0xc0, 0xcc, 0x02, 0x58, 0xf1, 0xca, 0xec, 0x2a, 0x40, 0xf7, 0x04, 0xba, 0x3c, 0x6d, 0xf8, 0xe2, 0x0a, 0xe7, 0x41, 0x4d, 0xf5, 0x17, 0xdc, 0x2b, 0x54, 0x29, 0x3d, 0xdc, 0xf9, 0xfb, 0xec, 0x07, 0x9a, 0x31, 0xda, 0x2c, 0xf2, 0x18, 0x50, 0xdf, 0x4f, 0x22, 0xd0, 0x15, 0x32, 0xe9, 0x17, 0x50, 0x00, 0x2b, 0x24, 0xfe, 0xd3, 0x13, 0x17, 0xfe, 0x02, 0xe9, 0xe1, 0x33, 0x1d, 0x0b, 0xda, 0xc8, 0xc1, 0x12, 0x0b, 0xda, 0x4b, 0xde, 0x6f, 0x95, 0xf5, 0xe0, 0x4a, 0x27, 0x7f, 0x00, 0xfd, 0xd7, 0xcb, 0x0b, 0x93, 0x00, 0xc5, 0x70, 0xfe, 0x1f, 0xb4, 0xce, 0x7f, 0x0a, 0xc6, 0xce, 0xb8, 0x49, 0xc3, 0xb3, 0xc9, 0x26, 0x27, 0xda, 0x36, 0x2f, 0x0b, 0xc9, 0x87, 0x5f, 0xe1, 0xe6, 0x2f, 0x06, 0x09, 0xe8, 0x37, 0xca, 0xeb, 0x20, 0x16, 0x01, 0xfd, 0xf5, 0x37, 0x4d, 0x0f, 0x4b, 0xe4, 0xd2, 0x11, 0xcc, 0xc3, 0xa7, 0xf6, 0xf9, 0xbe, 0x27, 0x2f, 0x54, 0xa5, 0xf8, 0x97, 0xf3, 0xa5, 0x2a, 0xc3, 0xb0, 0x09, 0x81, 0x30, 0xd1, 0xff, 0x3b, 0x50, 0x3d, 0x05, 0x52, 0x3e, 0xdd, 0x37, 0x0a, 0xa5, 0x48, 0x1a, 0xfd, 0x7b, 0xdc, 0xcc, 0xcd, 0xdd, 0xd7, 0xd2, 0x98, 0x26, 0xf1, 0xe0, 0x37, 0xfe, 0x2b, 0xd3, 0xa2, 0xf4, 0xa2, 0x06, 0x17, 0xf6, 0x09, 0x3a, 0x36, 0x21, 0x46, 0x32, 0x1f, 0xce, 0xc3, 0xfb, 0xd4, 0xe9, 0xde, 0x54, 0x4b, 0xe8, 0xdf, 0x3c, 0x12, 0x49, 0x12, 0x54, 0x5a, 0x2b, 0xf9, 0xf7, 0xf7, 0x32, 0xf1, 0xdb, 0x15, 0x09, 0xf3, 0x4c, 0x0b, 0x56, 0x91, 0x2a, 0x48, 0x0c, 0x73, 0x8a, 0x21, 0xe4, 0xe5, 0x03, 0x3c, 0x7f, 0xeb, 0x0a, 0x26, 0x09, 0x44, 0x16, 0x10, 0x52, 0xd2, 0x23, 0x28, 0xfb, 0x3a, 0x01, 0x00, 0x15, 0xd2, 0x34, 0x33, 0x3e, 0x52, 0xe1, 0xf6, 0x06, 0x5d, 0x13, 0x32, 0x55, 0x36, 0xb9, 0x1c, 0xf3, 0x54, 0xc6, 0x05, 0xbc, 0xca, 0xf6, 0x51, 0xcf, 0xc6, 0x09, 0x21, 0x9b, 0xfa, 0x34, 0x18, 0xb1, 0xdc, 0x11, 0xbd, 0x23, 0xfc, 0xff, 0x09, 0xe6, 0xf3, 0x21, 0xcd, 0xab, 0xb6, 0xac, 0xdc, 0x05, 0xac, 0x1d, 0x19, 0xb3, 0x02, 0x11, 0x83, 0x23, 0x1b, 0xc6, 0xcc, 0xcd, 0x26, 0xf2, 0x0e, 0x1b, 0x08, 0xb3, 0x2b, 0x01, 0x55, 0x11, 0x0f, 0x34, 0x23, 0x02, 0x04, 0x0d, 0x9d, 0x81, 0xed, 0x15, 0xc8, 0x89, 0xf8, 0xe0, 0x37, 0x1e, 0xe5, 0x1f, 0xfb, 0xd7, 0xfc, 0xdd, 0xf0, 0x23, 0xdd, 0xc4, 0xd4, 0xe2, 0xcf, 0x00, 0x23, 0xdc, 0xc0, 0x01, 0xdc, 0x11, 0xf1, 0xdb, 0xf4, 0x0a, 0xfc, 0x01, 0xe7, 0xfc, 0xfc, 0xdd, 0xfc, 0xf5, 0xf3, 0x0e, 0x18, 0x01, 0xf7, 0xe7, 0x07, 0xf9, 0x11, 0x15, 0xf6, 0xdf, 0xd8, 0x14, 0xeb, 0x11, 0x21, 0xf3, 0x09, 0xe1, 0xdf, 0xd7, 0xcf, 0x81, 0xa4, 0xb8, 0xed, 0xb3, 0xcf, 0xf4, 0xad, 0xf8, 0xda, 0x0c, 0x26, 0xcb, 0xf0, 0xb6, 0x0f, 0x33, 0xf0, 0xfd, 0xdc, 0x3b, 0x08, 0x6d, 0x89, 0xd8, 0x16, 0x40, 0xf5, 0x27, 0x18, 0xef, 0xaf, 0x64, 0x18, 0xe1, 0x3e, 0x40, 0xbc, 0x52, 0x81, 0xe9, 0xc9, 0xe6, 0xcb, 0x3f, 0x46, 0x5a, 0xcc, 0x3b, 0xb5, 0x19, 0xf5, 0xc9, 0x00, 0xd0, 0x06, 0xf9, 0xf7, 0x43, 0x0a, 0xd5, 0x28, 0xd7, 0xb7, 0xe4, 0xe8, 0xd0, 0xd8, 0x11, 0xf5, 0x60, 0xdf, 0xf5, 0x1e, 0xa3, 0x23, 0xfb, 0xec, 0x03, 0x00, 0x4b, 0x0f, 0xde, 0x78, 0xd5, 0xbe, 0x01, 0x09, 0xbb, 0xdc, 0xf5, 0xda, 0xc2, 0xc8, 0x15, 0xd7, 0x14, 0x21, 0x1f, 0x90, 0xf2, 0xe4, 0xdc, 0xb7, 0xb0, 0xde, 0xbe, 0xfa, 0xc9, 0x33, 0x9e, 0xeb, 0xe7, 0x81, 0xe3, 0xce, 0xd1, 0xe9, 0xc6, 0xe6, 0x41, 0xec, 0x12, 0xcd, 0xf5, 0xd7, 0xab, 0x08, 0xb4, 0xe9, 0x0d, 0xc8, 0xd0, 0x06, 0x1d, 0xcb, 0x4d, 0xb5, 0xbc, 0xe0, 0xa8, 0x72, 0x61, 0x5a, 0xf1, 0x20, 0x5d, 0x48, 0x67, 0xba, 0xea, 0x32, 0xb2, 0xd1, 0xa3, 0x6d, 0x93, 0x46, 0x12, 0x01, 0x3e, 0xed, 0x7f, 0x25, 0xe4, 0x09, 0x54, 0x5d, 0xa6, 0x17, 0xe9, 0xe5, 0x66, 0x35, 0xd4, 0xa6, 0x26, 0x4a, 0xe7, 0xd6, 0xe6, 0x35, 0xd4, 0x0a, 0x39, 0xfd, 0xd3, 0xa6, 0x3f, 0x06, 0x2c, 0xf1, 0x25, 0x0f, 0x03, 0xf3, 0xff, 0xf7, 0x01, 0x91, 0x05, 0xdd, 0xd6, 0xfa, 0xe5, 0x2b, 0xf2, 0x1e, 0x06, 0x96, 0x89, 0xfd, 0x36, 0x81, 0xa4, 0xb8, 0xfd, 0xc4, 0xd0, 0x9e, 0x98, 0x35, 0x21, 0x08, 0x45, 0xf2, 0xa6, 0xf6, 0xdb, 0xb2, 0xf3, 0x1b, 0xe3, 0xdd, 0xbb, 0xc9, 0xf4, 0x52, 0xae, 0xca, 0x2d, 0x1e, 0x40, 0xdd, 0x25, 0x2c, 0xde, 0x85, 0xd1, 0x98, 0xc0, 0xc6, 0x0f, 0x0f, 0x9f, 0xce, 0x43, 0xc3, 0x03, 0xfd, 0xe1, 0xfc, 0x59, 0xfa, 0xf9, 0xcd, 0xe8, 0x15, 0x45, 0x13, 0xa8, 0x33, 0x00, 0x39, 0xbb, 0x42, 0x43, 0xf3, 0xb2, 0x30, 0x2b, 0x0c, 0x42, 0xca, 0xe7, 0x17, 0x09, 0x25, 0x6e, 0x2f, 0x51, 0x49, 0x3e, 0x11, 0x18, 0x56, 0x11, 0x7f, 0x3a, 0xd2, 0x33, 0x74, 0x2d, 0xf1, 0x56, 0xce, 0xcb, 0x22, 0xe7, 0xfc, 0xf8, 0x0d, 0xa5, 0xe1, 0x37, 0x24, 0x53, 0xfd, 0x3e, 0xf8, 0xaf, 0xdd, 0x1b, 0x54, 0xf9, 0x33, 0xee, 0x3e, 0x1d, 0x02, 0xa1, 0x32, 0x35, 0x35, 0x96, 0x0b, 0xf9, 0x36, 0xf5, 0x63, 0x3b, 0x9f, 0xf5, 0xf2, 0x06, 0xe4, 0x17, 0xe7, 0xea, 0xe6, 0x13, 0x08, 0xce, 0x0c, 0x1d, 0xf2, 0x33, 0xf9, 0xf8, 0xe2, 0x0e, 0xec, 0x45, 0x17, 0x28, 0x1e, 0x10, 0x11, 0x16, 0xde, 0x08, 0xd4, 0x81, 0x29, 0xe1, 0xc7, 0x32, 0x12, 0x3f, 0x16, 0x1d, 0xc6, 0xe4, 0xc1, 0xb7, 0xb7, 0xb2, 0xe4, 0xc7, 0xc7, 0x25, 0x95, 0x24, 0xe1, 0x1d, 0x01, 0xe5, 0x60, 0x2e, 0x1f, 0x22, 0xec, 0xc8, 0x24, 0x9d, 0x87, 0x85, 0x26, 0xf5, 0x96, 0x59, 0x05, 0xec, 0xa2, 0x3e, 0xdd, 0xf9, 0x5b, 0xe9, 0xe9, 0x93, 0x21, 0x28, 0x27, 0x34, 0x94, 0xd3, 0xd5, 0x54, 0x0c, 0x5f, 0x2e, 0x51, 0xfb, 0x81, 0xd8, 0x99, 0xce, 0x2d, 0x42, 0xdd, 0x96, 0xcc, 0x56, 0xc3, 0xef, 0xb8, 0x1b, 0xbb, 0xd8, 0xe6, 0x10, 0x19, 0xe6, 0x0f, 0xfc, 0x29, 0x0f, 0x09, 0x14, 0xc8, 0xf0, 0xf4, 0xf2, 0x11, 0x0d, 0x01, 0x28, 0xed, 0xee, 0xbd, 0x1a, 0xc7, 0x09, 0x10, 0xde, 0x03, 0xe3, 0x42, 0xdf, 0x23, 0xed, 0x02, 0xe9, 0xfe, 0xde, 0x25, 0x04, 0xad, 0xd9, 0xef, 0xe4, 0x0e, 0xf5, 0xb4, 0x06, 0xe3, 0xf2, 0xda, 0xe7, 0xe0, 0x09, 0xd8, 0xf4, 0x1c, 0x03, 0xfe, 0xf2, 0xc4, 0xe5, 0xce, 0x08, 0xd8, 0xee, 0xbc, 0xb8, 0xfe, 0x81, 0x0e, 0xd4, 0xe7, 0xd3, 0xd1, 0xb7, 0xcf, 0xeb, 0xc6, 0xe4, 0x51, 0x28, 0xb2, 0x19, 0xaf, 0xa4, 0x1b, 0x54, 0xc7, 0xf9, 0x11, 0x23, 0x4f, 0xee, 0xcf, 0xec, 0x09, 0xf9, 0x27, 0xc6, 0x11, 0xbf, 0x0a, 0xf5, 0xcb, 0xd5, 0x02, 0xc2, 0xa4, 0xe9, 0xe5, 0xd5, 0xdc, 0x0b, 0x7f, 0x3e, 0x16, 0xd7, 0x08, 0xe6, 0xe8, 0x4f, 0x37, 0xed, 0xe4, 0x3e, 0xc4, 0xe4, 0xdf, 0xb9, 0x30, 0xd7, 0xcf, 0xe3, 0xdc, 0x40, 0x3b, 0xcd, 0x56, 0x24, 0xf2, 0x05, 0x10, 0xef, 0x1f, 0xe8, 0x0d, 0x0f, 0x0d, 0xdd, 0x0b, 0xfb, 0xf6, 0x16, 0xff, 0x08, 0xf5, 0xc5, 0x3c, 0x07, 0xe8, 0xeb, 0xef, 0x07, 0x14, 0xef, 0xcc, 0x09, 0x32, 0xf3, 0x48, 0xe2, 0x31, 0xf9, 0xf1, 0xfa, 0x3e, 0x81, 0xa4, 0xda, 0xf3, 0x17, 0xfd, 0x13, 0xce, 0xe6, 0x0e, 0x90, 0x0d, 0xb6, 0x09, 0xee, 0x0d, 0xf2, 0xe0, 0x28, 0xe5, 0x27, 0xeb, 0xf2, 0xe8, 0xfa, 0xfc, 0xc5, 0xa3, 0xcc, 0x0f, 0x33, 0x2c, 0x05, 0x2c, 0xcc, 0xec, 0x0d, 0x08, 0x1d, 0xd1, 0xf2, 0xe1, 0x28, 0x38, 0x1d, 0x4c, 0xb6, 0xe1, 0x04, 0x7f, 0xc9, 0xf2, 0xce, 0xce, 0x2e, 0xcd, 0xfa, 0x0f, 0x31, 0x1e, 0x23, 0xd2, 0xa6, 0xde, 0x16, 0x1c, 0x60, 0x26, 0x39, 0xb7, 0xd7, 0xa2, 0xeb, 0xc1, 0x02, 0xec, 0xc5, 0xc1, 0x2a, 0xe2, 0x26, 0xd8, 0xfa, 0xe7, 0xac, 0x27, 0xd8, 0x1f, 0xe7, 0xb1, 0x45, 0xc7, 0x12, 0xfb, 0xd9, 0x39, 0x1f, 0xe8, 0x23, 0xfa, 0xa7, 0x0e, 0xec, 0x20, 0x2e, 0x14, 0xf4, 0x0c, 0xe7, 0xef, 0xfa, 0x49, 0x34, 0x36, 0x68, 0x6e, 0x18, 0x62, 0xe4, 0x1f, 0x01, 0x55, 0x35, 0x2b, 0x09, 0xdb, 0x3f, 0x07, 0xcb, 0xdc, 0x16, 0xd8, 0x23, 0x62, 0x35, 0xd6, 0xbc, 0x7e, 0x7f, 0x42, 0xb4, 0xf4, 0xb3, 0x02, 0xff, 0x22, 0x65, 0xb7, 0xd0, 0x1c, 0xfd, 0x04, 0x11, 0xaa, 0x85, 0x1f, 0xbf, 0x35, 0x5d, 0x12, 0xc0, 0x4e, 0x63, 0x16, 0x42, 0xa3, 0xfc, 0x28, 0x4f, 0xd9, 0xfd, 0x0e, 0x0f, 0x40, 0xd2, 0x38, 0xee, 0x42, 0xdf, 0xfb, 0x28, 0x50, 0x48, 0xf0, 0xa3, 0xb7, 0xe1, 0x58, 0x0a, 0xf9, 0x8f, 0x2d, 0xf7, 0x1b, 0x1a, 0x42, 0xf2, 0xfd, 0xcd, 0xaf, 0xfa, 0xc3, 0xed, 0x81, 0x29, 0xd9, 0x04, 0x78, 0xbb, 0xdd, 0xae, 0x3d, 0xa2, 0x3f, 0xe2, 0xcd, 0x16, 0xec, 0x15, 0x04, 0xfc, 0x5a, 0x65, 0xef, 0xbf, 0xde, 0xd0, 0x30, 0xa1, 0x3d, 0xc8, 0xd6, 0xfd, 0xde, 0xc8, 0xc7, 0x06, 0x21, 0xaa, 0xd6, 0x47, 0x0b, 0x2c, 0xb8, 0x25, 0xb4, 0x60, 0xda, 0x47, 0xc3, 0xda, 0x34, 0x20, 0xf6, 0x32, 0x01, 0xd3, 0xad, 0x0d, 0xfe, 0x52, 0x7f, 0xf5, 0x25, 0xfe, 0xdc, 0x93, 0x18, 0x9c, 0xeb, 0xbe, 0x11, 0xdb, 0xd3, 0x55, 0xa7, 0xcd, 0x9c, 0xaf, 0xcb, 0xeb, 0x21, 0x0d, 0xfa, 0x01, 0x96, 0xa5, 0x9d, 0x1c, 0xa9, 0x42, 0xe2, 0xb4, 0xeb, 0x02, 0xf5, 0x15, 0xf4, 0xfe, 0x1d, 0xe7, 0x12, 0xf4, 0x33, 0xea, 0xbe, 0xaa, 0xf2, 0xf0, 0x0e, 0x2c, 0xe2, 0x14, 0xec, 0xf1, 0x13, 0x06, 0xa6, 0x22, 0x0e, 0x08, 0xef, 0xd6, 0x81, 0x06, 0xda, 0xc7, 0x22, 0x1e, 0x0c, 0xfb, 0xf6, 0xfe, 0xdc, 0x83, 0xbb, 0xd3, 0xed, 0xa3, 0xbe, 0xcf, 0x1f, 0xeb, 0x22, 0xc8, 0x25, 0x32, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0xcd, 0xfa, 0xff, 0xff, 0x51, 0xfc, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xb2, 0xf7, 0xff, 0xff, 0xf3, 0x06, 0x00, 0x00, 0x8d, 0x14, 0x00, 0x00, 0x3f, 0x0f, 0x00, 0x00, 0x7f, 0x18, 0x00, 0x00, 0x13, 0xe7, 0xff, 0xff, 0xeb, 0x00, 0x00, 0x00, 0xa0, 0xfc, 0xff, 0xff, 0x7d, 0xfb, 0xff, 0xff, 0xe2, 0xf6, 0xff, 0xff, 0xa7, 0xeb, 0xff, 0xff, 0x5b, 0x0e, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xcb, 0x0a, 0x00, 0x00, 0x7e, 0xf7, 0xff, 0xff, 0xb8, 0xfb, 0xff, 0xff, 0x67, 0xf3, 0xff, 0xff, 0x2f, 0x0a, 0x00, 0x00, 0xdb, 0xfa, 0xff, 0xff, 0x4a, 0x07, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0x97, 0xfe, 0xff, 0xff, 0xb4, 0x01, 0x00, 0x00, 0x88, 0xf5, 0xff, 0xff, 0xd9, 0xfb, 0xff, 0xff, 0x8e, 0xfc, 0xff, 0xff, 0x28, 0x02, 0x00, 0x00, 0xbe, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xcc, 0xf8, 0xe9, 0xfd, 0xf5, 0x13, 0x9c, 0x0d, 0xf6, 0xe9, 0xf9, 0xfc, 0x00, 0xfb, 0x02, 0xdd, 0x08, 0x06, 0x8e, 0xcf, 0xde, 0xe7, 0x07, 0x81, 0x0b, 0xab, 0x07, 0xe1, 0xfa, 0x13, 0x97, 0xd2, 0xc9, 0xf1, 0x21, 0x00, 0x4d, 0x0c, 0xbd, 0x2b, 0x9e, 0xbf, 0xd2, 0xdc, 0x42, 0xf1, 0x13, 0x1c, 0xf3, 0x13, 0xb3, 0x32, 0xc1, 0x3f, 0x17, 0x81, 0x14, 0xf8, 0x02, 0xf3, 0x1b, 0x96, 0x65, 0x39, 0x33, 0x21, 0x09, 0xc5, 0x61, 0xe2, 0x34, 0x82, 0xe4, 0xae, 0xe0, 0xd0, 0x0f, 0x40, 0xed, 0xc5, 0x41, 0x45, 0xde, 0x5a, 0x03, 0xe4, 0xcc, 0xba, 0xa9, 0xf9, 0x81, 0xf2, 0x04, 0xc0, 0x31, 0x44, 0xea, 0xfd, 0x0e, 0x81, 0x38, 0xb4, 0x52, 0xb6, 0xf3, 0x0e, 0xe3, 0x34, 0x07, 0xa5, 0x15, 0xb4, 0xf1, 0xf8, 0xf0, 0x2e, 0x33, 0x05, 0x8c, 0x01, 0xf9, 0x1b, 0xfb, 0x4f, 0x09, 0x4a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xff, 0xff, 0x38, 0x05, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0x4f, 0xfa, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa4, 0x1b, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x00, 0x60, 0x1a, 0x00, 0x00, 0x8c, 0x18, 0x00, 0x00, 0xb0, 0x16, 0x00, 0x00, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xac, 0x09, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xaa, 0xe4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x94, 0xe4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x22, 0xe5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0xe5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x6e, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc2, 0xe5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0xac, 0xe5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x4c, 0xd5, 0x3d, 0x58, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7a, 0xe6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x64, 0xe6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd4, 0xfd, 0x25, 0x3d, 0x58, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x16, 0x3d, 0x52, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00, 0xbc, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7c, 0x7b, 0x9c, 0x3a, 0xca, 0xf3, 0xc1, 0x3a, 0x7b, 0x7c, 0xc7, 0x3a, 0xe1, 0xda, 0xcc, 0x3a, 0xa0, 0x63, 0xa8, 0x3a, 0x12, 0x56, 0xfa, 0x3a, 0xe7, 0xf4, 0x85, 0x3a, 0x55, 0x5b, 0x0e, 0x3b, 0xeb, 0x4e, 0x78, 0x3a, 0x66, 0xd6, 0xc3, 0x3a, 0xde, 0xf5, 0x07, 0x3b, 0x08, 0xbd, 0xd6, 0x3a, 0x7a, 0x21, 0xf8, 0x3a, 0xb8, 0xf6, 0xec, 0x3a, 0xa0, 0xce, 0xdf, 0x3a, 0x21, 0x5a, 0xc9, 0x3a, 0xff, 0xc2, 0xf9, 0x3a, 0x39, 0x3e, 0xf2, 0x3a, 0x79, 0xf0, 0xbd, 0x3a, 0x45, 0x7f, 0xaa, 0x3a, 0x28, 0x8a, 0x87, 0x39, 0x9d, 0xc3, 0xd2, 0x3a, 0x9f, 0x7c, 0x93, 0x3a, 0x2a, 0xfb, 0x80, 0x3a, 0x9f, 0x2e, 0xd5, 0x3a, 0x75, 0x61, 0xb7, 0x3a, 0x8b, 0xb0, 0xa9, 0x3a, 0xf6, 0xa6, 0x98, 0x3a, 0x77, 0x47, 0xda, 0x3a, 0x0d, 0xf3, 0x21, 0x3a, 0x1f, 0x80, 0x31, 0x3b, 0x16, 0x30, 0xe8, 0x3a, 0xeb, 0xb2, 0xd4, 0x3a, 0x30, 0x3d, 0xab, 0x3a, 0x9d, 0x8b, 0xdf, 0x3a, 0xda, 0xfb, 0x69, 0x3a, 0x44, 0x32, 0xe5, 0x3a, 0x6e, 0xb1, 0xdc, 0x3a, 0x54, 0xa4, 0x0f, 0x3b, 0x62, 0x57, 0x06, 0x3b, 0xad, 0x27, 0xbc, 0x3a, 0x47, 0x0b, 0x1e, 0x3a, 0xcc, 0xf6, 0xd1, 0x3a, 0x23, 0xc7, 0xdb, 0x3a, 0x04, 0x2e, 0x95, 0x3a, 0xcc, 0x38, 0xe6, 0x3a, 0x94, 0xf4, 0xf8, 0x3a, 0xf6, 0xb6, 0x96, 0x3a, 0xc7, 0xb6, 0x18, 0x3a, 0x99, 0xa8, 0x99, 0x3a, 0x9b, 0x86, 0xd0, 0x3a, 0xf4, 0xfd, 0xb6, 0x3a, 0xb8, 0x08, 0x3c, 0x3b, 0xc7, 0xd1, 0xcf, 0x3a, 0xe1, 0xfa, 0xcf, 0x3a, 0xd1, 0x8e, 0xc9, 0x3a, 0xe5, 0x23, 0x3f, 0x3b, 0x05, 0xcf, 0xc4, 0x3a, 0x56, 0x59, 0x4d, 0x3a, 0x4f, 0x4e, 0xcf, 0x3a, 0xc2, 0xdc, 0x58, 0x3a, 0xc4, 0xfd, 0xc1, 0x3a, 0xa8, 0x17, 0x80, 0x3a, 0xd5, 0x5c, 0xa1, 0x3a, 0xaf, 0x32, 0xbb, 0x3a, 0xac, 0xc0, 0xda, 0x3a, 0x47, 0x4e, 0xa7, 0x3a, 0x1b, 0xb6, 0xde, 0x3a, 0x20, 0x27, 0xb6, 0x3a, 0x31, 0xbb, 0x17, 0x3b, 0xf4, 0x9a, 0xe4, 0x3a, 0xf4, 0xbf, 0x49, 0x3b, 0xa3, 0xde, 0x98, 0x3a, 0xe1, 0x2d, 0x00, 0x3b, 0x5a, 0x7f, 0xc3, 0x39, 0x8c, 0x0a, 0x75, 0x3a, 0xa2, 0x73, 0x11, 0x3b, 0xdb, 0x01, 0xac, 0x3a, 0x56, 0x47, 0xa5, 0x3a, 0x19, 0x52, 0xd2, 0x3a, 0xbe, 0xe0, 0xce, 0x3a, 0xfa, 0x33, 0xfa, 0x3a, 0xaa, 0x5f, 0xcc, 0x3a, 0x99, 0x14, 0xf2, 0x3a, 0xf1, 0x1f, 0x58, 0x3a, 0xb2, 0xa1, 0xfb, 0x3a, 0x7c, 0x26, 0xe2, 0x3a, 0x51, 0xe1, 0xfe, 0x3a, 0x42, 0xc0, 0xd8, 0x3a, 0x93, 0xaa, 0x7b, 0x3a, 0xe1, 0x9e, 0xd4, 0x3a, 0x63, 0x3c, 0xca, 0x3a, 0xce, 0x32, 0x2c, 0x3a, 0x6d, 0xfb, 0x4e, 0x3b, 0x3a, 0x36, 0xad, 0x3a, 0x5b, 0x9d, 0x3a, 0x3a, 0xf2, 0xa7, 0x02, 0x3b, 0xd5, 0xe4, 0xd6, 0x3a, 0x16, 0x42, 0x43, 0x3b, 0x6e, 0xd2, 0x19, 0x3b, 0xc5, 0x5c, 0x86, 0x3a, 0xbd, 0x46, 0x50, 0x3b, 0xd4, 0xad, 0xd4, 0x3a, 0xa9, 0x5d, 0x60, 0x3b, 0xf9, 0x74, 0xca, 0x3a, 0x3f, 0x1e, 0x63, 0x3b, 0xbb, 0xf5, 0xb9, 0x3a, 0xfb, 0xd6, 0x49, 0x3a, 0x6c, 0x67, 0xb4, 0x3a, 0x64, 0x88, 0xd2, 0x3a, 0x63, 0x83, 0x2e, 0x3b, 0x01, 0x41, 0xd6, 0x3a, 0x47, 0x13, 0xba, 0x3a, 0xbf, 0xb0, 0x6b, 0x3a, 0x47, 0xd8, 0x4e, 0x3b, 0xad, 0x76, 0xf6, 0x3a, 0xcf, 0xd0, 0xb5, 0x3a, 0xb1, 0x82, 0xe9, 0x3a, 0xe0, 0x01, 0x3e, 0x3a, 0xd4, 0x1e, 0x7a, 0x3a, 0x80, 0x73, 0xd6, 0x3a, 0x9f, 0x5b, 0x43, 0x3b, 0x95, 0xdd, 0xde, 0x3a, 0x2e, 0xf2, 0xd7, 0x3a, 0xc5, 0xe7, 0x20, 0x3a, 0xaa, 0x3f, 0xe2, 0x3a, 0x27, 0xe6, 0x63, 0x3a, 0x2d, 0xd5, 0x12, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x37, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd6, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x06, 0x00, 0x00, 0x14, 0xee, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x19, 0x6f, 0xce, 0x39, 0x6b, 0xdd, 0xff, 0x39, 0x2b, 0x95, 0x03, 0x3a, 0xbc, 0x1f, 0x07, 0x3a, 0x41, 0x24, 0xde, 0x39, 0xac, 0x1f, 0x25, 0x3a, 0xbc, 0xb7, 0xb0, 0x39, 0x9d, 0xcc, 0x3b, 0x3a, 0x3d, 0xc9, 0xa3, 0x39, 0x0b, 0x2d, 0x01, 0x3a, 0x72, 0x5c, 0x33, 0x3a, 0xa4, 0xa4, 0x0d, 0x3a, 0x43, 0xab, 0x23, 0x3a, 0x9b, 0x4d, 0x1c, 0x3a, 0xfc, 0x9f, 0x13, 0x3a, 0x3b, 0xd0, 0x04, 0x3a, 0xaa, 0xbe, 0x24, 0x3a, 0x11, 0xc9, 0x1f, 0x3a, 0x2a, 0x92, 0xfa, 0x39, 0x29, 0xec, 0xe0, 0x39, 0x5a, 0xce, 0xb2, 0x38, 0x8b, 0x05, 0x0b, 0x3a, 0x20, 0x91, 0xc2, 0x39, 0x66, 0x27, 0xaa, 0x39, 0xd9, 0x9d, 0x0c, 0x3a, 0x2f, 0xeb, 0xf1, 0x39, 0x72, 0xdb, 0xdf, 0x39, 0x94, 0x61, 0xc9, 0x39, 0x88, 0xfa, 0x0f, 0x3a, 0x6e, 0xa5, 0x55, 0x39, 0x52, 0x29, 0x6a, 0x3a, 0x25, 0x27, 0x19, 0x3a, 0x40, 0x4c, 0x0c, 0x3a, 0xb4, 0xe6, 0xe1, 0x39, 0xc8, 0x73, 0x13, 0x3a, 0x69, 0x56, 0x9a, 0x39, 0x01, 0x2e, 0x17, 0x3a, 0x26, 0x92, 0x11, 0x3a, 0xa2, 0x7e, 0x3d, 0x3a, 0xa7, 0x39, 0x31, 0x3a, 0x8d, 0x37, 0xf8, 0x39, 0x83, 0x7e, 0x50, 0x39, 0x72, 0x7e, 0x0a, 0x3a, 0x9b, 0xf7, 0x10, 0x3a, 0xde, 0xcc, 0xc4, 0x39, 0x2c, 0xdb, 0x17, 0x3a, 0x82, 0x36, 0x24, 0x3a, 0x3f, 0xd3, 0xc6, 0x39, 0x71, 0x76, 0x49, 0x39, 0x75, 0xb5, 0xca, 0x39, 0x96, 0x8b, 0x09, 0x3a, 0xea, 0x67, 0xf1, 0x39, 0xb7, 0x0e, 0x78, 0x3a, 0x4f, 0x14, 0x09, 0x3a, 0x6b, 0x2f, 0x09, 0x3a, 0xfc, 0xf2, 0x04, 0x3a, 0xb9, 0x27, 0x7c, 0x3a, 0x09, 0xd1, 0x01, 0x3a, 0x25, 0x73, 0x87, 0x39, 0x97, 0xbd, 0x08, 0x3a, 0x4a, 0x0b, 0x8f, 0x39, 0x94, 0xea, 0xff, 0x39, 0x44, 0xfb, 0xa8, 0x39, 0x42, 0xdf, 0xd4, 0x39, 0x5b, 0xf4, 0xf6, 0x39, 0x7b, 0x4a, 0x10, 0x3a, 0x5f, 0xb6, 0xdc, 0x39, 0xf3, 0xe6, 0x12, 0x3a, 0x83, 0x4c, 0xf0, 0x39, 0x8c, 0x2a, 0x48, 0x3a, 0x33, 0xca, 0x16, 0x3a, 0x65, 0x13, 0x85, 0x3a, 0x07, 0xab, 0xc9, 0x39, 0x95, 0x18, 0x29, 0x3a, 0xa0, 0xf3, 0x00, 0x39, 0x8f, 0xa1, 0xa1, 0x39, 0xd4, 0xe1, 0x3f, 0x3a, 0x27, 0xea, 0xe2, 0x39, 0xc7, 0x09, 0xda, 0x39, 0xab, 0xba, 0x0a, 0x3a, 0x52, 0x75, 0x08, 0x3a, 0x2f, 0x09, 0x25, 0x3a, 0x76, 0xce, 0x06, 0x3a, 0x9c, 0xad, 0x1f, 0x3a, 0xbe, 0x8e, 0x8e, 0x39, 0x6b, 0xfa, 0x25, 0x3a, 0xa8, 0x2b, 0x15, 0x3a, 0xf6, 0x1e, 0x28, 0x3a, 0x7d, 0xf8, 0x0e, 0x3a, 0x46, 0x00, 0xa6, 0x39, 0x09, 0x3f, 0x0c, 0x3a, 0x79, 0x65, 0x05, 0x3a, 0xba, 0x2a, 0x63, 0x39, 0xec, 0x86, 0x88, 0x3a, 0xf6, 0x80, 0xe4, 0x39, 0x5c, 0x2f, 0x76, 0x39, 0x0e, 0x5d, 0x2c, 0x3a, 0xe5, 0xbe, 0x0d, 0x3a, 0x37, 0xcb, 0x80, 0x3a, 0xa4, 0xec, 0x4a, 0x3a, 0xc2, 0x40, 0xb1, 0x39, 0x75, 0x61, 0x89, 0x3a, 0xe5, 0x48, 0x0c, 0x3a, 0x55, 0xfe, 0x93, 0x3a, 0xcc, 0x8a, 0x05, 0x3a, 0x15, 0xcf, 0x95, 0x3a, 0x3a, 0x52, 0xf5, 0x39, 0x95, 0x22, 0x85, 0x39, 0xe5, 0xfd, 0xed, 0x39, 0x7b, 0xde, 0x0a, 0x3a, 0x78, 0x38, 0x66, 0x3a, 0xd5, 0x52, 0x0d, 0x3a, 0x34, 0x79, 0xf5, 0x39, 0x97, 0x76, 0x9b, 0x39, 0xbd, 0x6f, 0x88, 0x3a, 0xbe, 0x91, 0x22, 0x3a, 0xa4, 0xda, 0xef, 0x39, 0x7e, 0x06, 0x1a, 0x3a, 0x1f, 0xa9, 0x7a, 0x39, 0x3c, 0xfb, 0xa4, 0x39, 0x24, 0x74, 0x0d, 0x3a, 0x0f, 0xdc, 0x80, 0x3a, 0xfd, 0x00, 0x13, 0x3a, 0x8f, 0x70, 0x0e, 0x3a, 0xd4, 0x44, 0x54, 0x39, 0x44, 0x3c, 0x15, 0x3a, 0xf1, 0x52, 0x96, 0x39, 0x3b, 0xb4, 0x41, 0x3a, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x36, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x26, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x64, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x89, 0xe8, 0x56, 0x3b, 0x00, 0x1b, 0xc2, 0x3b, 0xe2, 0xdf, 0x3e, 0x3b, 0x1d, 0x7e, 0x9f, 0x3b, 0x42, 0xf0, 0x3d, 0x3b, 0x2e, 0xda, 0x64, 0x3b, 0xda, 0x6e, 0xb4, 0x3b, 0x51, 0xb0, 0xb2, 0x3b, 0xad, 0x51, 0x2d, 0x3c, 0x25, 0x2f, 0x2e, 0x3b, 0x80, 0xca, 0xa7, 0x3b, 0x94, 0xec, 0x9e, 0x3b, 0x2c, 0xc7, 0x89, 0x3b, 0x26, 0x2f, 0x7b, 0x3b, 0x56, 0x24, 0xac, 0x3b, 0x86, 0x88, 0x4e, 0x3b, 0x76, 0x8f, 0xbe, 0x3b, 0x01, 0x7f, 0x39, 0x3b, 0x99, 0x19, 0x3b, 0x3b, 0x0f, 0xc0, 0x64, 0x3b, 0x0e, 0x49, 0x6d, 0x3b, 0x06, 0xd6, 0x1e, 0x3b, 0x8a, 0x28, 0x1b, 0x3b, 0x72, 0xd9, 0x85, 0x3b, 0x1d, 0xdf, 0x56, 0x3b, 0x2c, 0x05, 0x8a, 0x3b, 0x55, 0xda, 0x2e, 0x3b, 0xf0, 0x5d, 0x51, 0x3b, 0x54, 0xd7, 0x30, 0x3b, 0xe7, 0xa5, 0x4d, 0x3b, 0x16, 0xf1, 0x0c, 0x3c, 0xcc, 0x40, 0x63, 0x3b, 0x89, 0x52, 0x03, 0x3b, 0xc2, 0x35, 0x2c, 0x3b, 0x10, 0x7e, 0x18, 0x3b, 0x46, 0x7e, 0x65, 0x3b, 0x33, 0xfa, 0x5f, 0x3b, 0x9c, 0x20, 0x1e, 0x3b, 0xdc, 0xb2, 0x54, 0x3b, 0xfd, 0x6b, 0xa4, 0x3b, 0x76, 0x20, 0x14, 0x3b, 0x77, 0x22, 0x94, 0x3b, 0x29, 0xa4, 0x40, 0x3b, 0xf7, 0x60, 0x85, 0x3b, 0xe4, 0x47, 0xcf, 0x3b, 0x79, 0xe3, 0x8b, 0x3b, 0x3c, 0xd2, 0x4f, 0x3b, 0x14, 0x22, 0x65, 0x3b, 0xea, 0x39, 0x65, 0x3b, 0x2a, 0xea, 0xa0, 0x3b, 0x5e, 0x2f, 0x52, 0x3b, 0x82, 0x32, 0xe3, 0x3b, 0x79, 0xc9, 0x89, 0x3b, 0x6f, 0xe9, 0xb4, 0x3b, 0x0d, 0x60, 0x8e, 0x3b, 0x82, 0xd7, 0x44, 0x3b, 0x3e, 0x96, 0x5b, 0x3b, 0x9b, 0x25, 0xb3, 0x3b, 0x76, 0xd1, 0x34, 0x3b, 0x4d, 0x71, 0x93, 0x3b, 0x63, 0x80, 0x5b, 0x3b, 0xe1, 0x41, 0x52, 0x3b, 0x64, 0x22, 0xd5, 0x3b, 0xc5, 0xc1, 0x7a, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x35, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x03, 0x00, 0x00, 0xbc, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xdd, 0xd8, 0xfb, 0x38, 0xf7, 0x77, 0x63, 0x39, 0xaf, 0xae, 0xdf, 0x38, 0x0f, 0xe8, 0x3a, 0x39, 0xdf, 0x95, 0xde, 0x38, 0x08, 0x18, 0x06, 0x39, 0x35, 0x72, 0x53, 0x39, 0xec, 0x66, 0x51, 0x39, 0x01, 0x1c, 0xcb, 0x39, 0x8a, 0x1f, 0xcc, 0x38, 0x96, 0xa1, 0x44, 0x39, 0x82, 0x3d, 0x3a, 0x39, 0xa3, 0x75, 0x21, 0x39, 0xd6, 0x2d, 0x13, 0x39, 0xdf, 0xba, 0x49, 0x39, 0x56, 0x08, 0xf2, 0x38, 0x70, 0x50, 0x5f, 0x39, 0x25, 0x61, 0xd9, 0x38, 0x50, 0x42, 0xdb, 0x38, 0xba, 0x08, 0x06, 0x39, 0x01, 0x09, 0x0b, 0x39, 0x13, 0x23, 0xba, 0x38, 0xc4, 0xd3, 0xb5, 0x38, 0x0b, 0xdb, 0x1c, 0x39, 0xd2, 0xcd, 0xfb, 0x38, 0x4b, 0xbe, 0x21, 0x39, 0x27, 0xe8, 0xcc, 0x38, 0x6f, 0x5a, 0xf5, 0x38, 0xa2, 0x3c, 0xcf, 0x38, 0xc3, 0xfe, 0xf0, 0x38, 0xc2, 0x2a, 0xa5, 0x39, 0x28, 0x28, 0x05, 0x39, 0xf1, 0xe4, 0x99, 0x38, 0x49, 0xcf, 0xc9, 0x38, 0xfc, 0xb3, 0xb2, 0x38, 0x2e, 0x78, 0x06, 0x39, 0xca, 0x3c, 0x03, 0x39, 0x7b, 0x4e, 0xb9, 0x38, 0xf5, 0x41, 0xf9, 0x38, 0xd3, 0xae, 0x40, 0x39, 0x4a, 0x96, 0xad, 0x38, 0xa3, 0x98, 0x2d, 0x39, 0xb3, 0xc0, 0xe1, 0x38, 0xdb, 0x4d, 0x1c, 0x39, 0x98, 0xe8, 0x72, 0x39, 0xce, 0xee, 0x23, 0x39, 0xb8, 0x8a, 0xf3, 0x38, 0x29, 0x42, 0x06, 0x39, 0x20, 0x50, 0x06, 0x39, 0xae, 0x92, 0x3c, 0x39, 0xdc, 0x4f, 0xf6, 0x38, 0xc9, 0x1f, 0x85, 0x39, 0x55, 0x78, 0x21, 0x39, 0xdc, 0x01, 0x54, 0x39, 0xcc, 0xd8, 0x26, 0x39, 0xe1, 0xac, 0xe6, 0x38, 0x38, 0xaa, 0x00, 0x39, 0x5f, 0xf0, 0x51, 0x39, 0xc4, 0xe5, 0xd3, 0x38, 0x06, 0xc9, 0x2c, 0x39, 0x69, 0x9d, 0x00, 0x39, 0x8e, 0x65, 0xf6, 0x38, 0xa9, 0xc4, 0x79, 0x39, 0xbf, 0xed, 0x12, 0x39, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x34, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xce, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb4, 0x01, 0x00, 0x00, 0x0c, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8b, 0x6c, 0x7a, 0x3b, 0x99, 0xe2, 0x7f, 0x3b, 0xef, 0xec, 0x9d, 0x3b, 0xac, 0xec, 0xd2, 0x3b, 0x0c, 0x18, 0x4c, 0x3b, 0x4e, 0x8c, 0x7e, 0x3b, 0x94, 0xcf, 0x8c, 0x3b, 0x49, 0xf9, 0x72, 0x3b, 0x5b, 0xb3, 0x51, 0x3b, 0xae, 0x73, 0x3f, 0x3b, 0xf5, 0xf3, 0x8d, 0x3b, 0x21, 0xe4, 0x8e, 0x3b, 0x10, 0xa1, 0x46, 0x3b, 0xa2, 0x2d, 0x49, 0x3b, 0x96, 0x87, 0x43, 0x3b, 0xfd, 0x60, 0x74, 0x3b, 0x4a, 0xfe, 0x12, 0x3c, 0x53, 0xf5, 0x27, 0x3b, 0xeb, 0x4e, 0x67, 0x3b, 0xad, 0x46, 0x30, 0x3b, 0x1d, 0xcc, 0x42, 0x3b, 0x54, 0x63, 0x6e, 0x3b, 0x69, 0xaf, 0x9b, 0x3b, 0xab, 0x4a, 0x3d, 0x3b, 0x34, 0xbc, 0xe9, 0x3b, 0x97, 0x0b, 0x5e, 0x3b, 0xf7, 0x9a, 0xba, 0x3b, 0x67, 0x4c, 0x6c, 0x3b, 0xcc, 0xf2, 0x34, 0x3b, 0xf7, 0xd9, 0x62, 0x3b, 0x6d, 0x06, 0x2e, 0x3b, 0xa8, 0x15, 0x91, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x33, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x00, 0xe4, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42, 0x60, 0x22, 0x39, 0xc3, 0xea, 0x25, 0x39, 0x98, 0xcc, 0x4c, 0x39, 0xad, 0xc3, 0x88, 0x39, 0xdd, 0x55, 0x04, 0x39, 0xd2, 0x0c, 0x25, 0x39, 0xd0, 0x9a, 0x36, 0x39, 0x96, 0x8b, 0x1d, 0x39, 0x86, 0xf8, 0x07, 0x39, 0xc6, 0x46, 0xf8, 0x38, 0xf9, 0x15, 0x38, 0x39, 0x6e, 0x4d, 0x39, 0x39, 0xc1, 0xca, 0x00, 0x39, 0xe2, 0x71, 0x02, 0x39, 0x85, 0x90, 0xfd, 0x38, 0xd1, 0x74, 0x1e, 0x39, 0x49, 0x9f, 0xbe, 0x39, 0x4e, 0xcf, 0xd9, 0x38, 0x36, 0xfb, 0x15, 0x39, 0xab, 0x98, 0xe4, 0x38, 0x67, 0x9d, 0xfc, 0x38, 0x63, 0x92, 0x1a, 0x39, 0xd8, 0xe4, 0x49, 0x39, 0xa0, 0x79, 0xf5, 0x38, 0x0e, 0x8e, 0x97, 0x39, 0xa2, 0xf9, 0x0f, 0x39, 0xce, 0xfd, 0x71, 0x39, 0x8a, 0x37, 0x19, 0x39, 0xcf, 0xa7, 0xea, 0x38, 0x69, 0x17, 0x13, 0x39, 0x61, 0xad, 0xe1, 0x38, 0xa0, 0x25, 0x3c, 0x39, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x32, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00, 0xb4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0x84, 0x90, 0x3c, 0xa9, 0x1f, 0xb4, 0x3b, 0x88, 0x66, 0x58, 0x3b, 0x97, 0x88, 0xb4, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x31, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x64, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8b, 0xd3, 0xf0, 0x3a, 0x3f, 0x14, 0x16, 0x3a, 0x11, 0x4e, 0xb4, 0x39, 0xac, 0x6b, 0x16, 0x3a, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xdc, 0xa8, 0x3e, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
 };
 
 const unsigned int qdnn_pump_model_len = 19968;
 
+// CRC-32 (IEEE) of the array above, verified at boot
+const unsigned int qdnn_pump_model_crc32 = 0x308490D3;
+
+// Input normalization: identity on top of the 0.1-unit conversion
+// (offset 0, scale 1.0), features temp / humid / soil% with the
+// deci-unit ranges the training distribution covered
+const QdnnModelMeta qdnn_pump_model_meta = {
+    3,
+    {
+        {0, 1.0f, 0, 500},     // temperature, 0.0 .. 50.0 C
+        {0, 1.0f, 200, 900},   // humidity, 20.0 .. 90.0 %RH
+        {0, 1.0f, 0, 1000},    // soil moisture, 0.0 .. 100.0 %
+        {0, 0.0f, 0, 0},
+    },
+};
+
 #endif // QDNN_PUMP_MODEL_H
@@ -42,8 +42,23 @@
 
 /* Scheduler Related */
 #define configUSE_PREEMPTION                    1
+/* DVFS builds drop clk_sys between control cycles; the tickless-idle
+ * path caches clk_sys-derived reload values at scheduler start, so the
+ * two are mutually exclusive and the governor retunes SysTick instead. */
+#if QDNN_DVFS
+#define configUSE_TICKLESS_IDLE                 0
+#else
 #define configUSE_TICKLESS_IDLE                 1   //DeepSleep?
-#define configUSE_IDLE_HOOK                     0
+#endif
+#define configUSE_IDLE_HOOK                     1
+
+/* Idle/power accounting (src/idle_meter.cpp): the pre/post-sleep
+ * callouts bracket the tickless deep-sleep window so measured idle
+ * time includes it. */
+extern void vIdleMeterPreSleep( void );
+extern void vIdleMeterPostSleep( void );
+#define configPRE_SLEEP_PROCESSING( x )         vIdleMeterPreSleep()
+#define configPOST_SLEEP_PROCESSING( x )        vIdleMeterPostSleep()
 #define configUSE_TICK_HOOK                     0
 #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES                    32
@@ -80,8 +95,17 @@
 #define configUSE_MALLOC_FAILED_HOOK            0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
-/* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+/* Run time and task stats gathering related definitions. The run-time
+ * counter is the free-running 1 MHz system timer (read via the stats
+ * engine, see src/task_stats.cpp) - no dedicated timer to configure and
+ * one cheap register read per context switch. Collection happens into
+ * fixed structs; the string-formatting helpers stay compiled out. */
+#ifndef __ASSEMBLER__
+extern unsigned long ulTaskStatsGetRunTimeCounter( void );
+#endif
+#define configGENERATE_RUN_TIME_STATS           1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        ulTaskStatsGetRunTimeCounter()
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
@@ -102,7 +126,14 @@
 #define configMAX_API_CALL_INTERRUPT_PRIORITY   [dependent on processor and application]
 */
 
-// Single Core
+/* Single core. The vendored kernel is the classic single-core RP2040
+ * port - it has no SMP scheduler, so configNUMBER_OF_CORES stays 1 and
+ * configUSE_CORE_AFFINITY below is inert (kept for SDK compatibility).
+ * Core topology is therefore a build-time choice in src/main.cpp, not
+ * an affinity mask: by default core 1 hosts the bare-metal pump
+ * interpreter, and combo-model builds can instead dedicate it to I/O
+ * servicing (QDNN_CORE1_IO) so this scheduler's core runs nothing but
+ * the control/inference pipeline. */
 #define configNUMBER_OF_CORES                       	1
 #define configTICK_CORE                         					0
 #define configRUN_MULTIPLE_PRIORITIES         0
@@ -116,7 +147,13 @@
 
 #include <assert.h>
 /* Define to trap errors during development. */
-#define configASSERT(x)                         assert(x)
+/* Failed asserts go through the crash-capture path (src/crash_dump.cpp):
+ * record to flash, then watchdog reboot - the record is emitted over
+ * telemetry on the next boot instead of dying silently in the field. */
+#ifndef __ASSEMBLER__
+extern void crash_dump_assert( const char * file, int line );
+#endif
+#define configASSERT(x)                         do { if( ( x ) == 0 ) crash_dump_assert( __FILE__, __LINE__ ); } while( 0 )
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -139,6 +176,18 @@ to exclude the API function. */
 
 /* A header file that defines trace macro can be included here. */
 
+/* Lock instrumentation (src/lock_stats.cpp): count the kernel's
+ * priority-inheritance engagements. Each one is a priority inversion
+ * that actually happened - a mutex holder boosted past a blocked
+ * higher-priority taker - attributable to a specific lock through the
+ * per-lock contention counters in "stats". */
+#ifndef __ASSEMBLER__
+extern void vLockStatsPriorityInherit( void );
+extern void vLockStatsPriorityDisinherit( void );
+#endif
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )   vLockStatsPriorityInherit()
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) vLockStatsPriorityDisinherit()
+
 
 #ifdef __cplusplus
 extern "C"
@@ -3,26 +3,111 @@
  *
  *  Created on: 30 Jun 2023
  *      Author: jondurrant
+ *
+ * Size-class pools now front heap_4: small allocations pop a fixed
+ * block from a per-class freelist under a hardware spin lock (a few
+ * cycles, usable from both cores and from code running before the
+ * scheduler), so C++ allocation cost is O(1) and bounded. heap_4 with
+ * its global critical section and first-fit walk only serves requests
+ * the pools cannot - and the counters make every such escape visible.
  */
 
 #include "pico/stdlib.h"
+#include "hardware/sync.h"
 
 #include "FreeRTOS.h"
 
+#include "cppMemory.h"
+
+// Class sizes must be multiples of 8 to preserve malloc alignment and
+// at least pointer-sized for the intrusive freelist link.
+static const size_t kClassSize[POOL_NUM_CLASSES]   = {16, 32, 64, 128};
+static const int    kClassBlocks[POOL_NUM_CLASSES] = {32, 32, 16, 8};
+
+static uint8_t pool_storage[16 * 32 + 32 * 32 + 64 * 16 + 128 * 8] __attribute__((aligned(8)));
+
+static void* s_free_head[POOL_NUM_CLASSES];
+static uint8_t* s_class_base[POOL_NUM_CLASSES + 1];  // class c spans [base[c], base[c+1])
+static PoolAllocStats s_stats;
+static spin_lock_t* s_lock;
+
+// Lazy init on first allocation. Static constructors run before main
+// on a single core, so there is no cross-core race to guard here.
+static void pool_init(void) {
+    s_lock = spin_lock_init(spin_lock_claim_unused_spin_lock(true));
+    uint8_t* p = pool_storage;
+    for (int c = 0; c < POOL_NUM_CLASSES; c++) {
+        s_class_base[c] = p;
+        s_free_head[c] = NULL;
+        for (int b = 0; b < kClassBlocks[c]; b++) {
+            *(void**)p = s_free_head[c];
+            s_free_head[c] = p;
+            p += kClassSize[c];
+        }
+    }
+    s_class_base[POOL_NUM_CLASSES] = p;
+}
+
+static void* pool_alloc(size_t size) {
+    if (!s_lock) pool_init();
+    for (int c = 0; c < POOL_NUM_CLASSES; c++) {
+        if (size > kClassSize[c]) continue;
+        uint32_t save = spin_lock_blocking(s_lock);
+        void* block = s_free_head[c];
+        if (block) {
+            s_free_head[c] = *(void**)block;
+            s_stats.allocs[c]++;
+        } else {
+            s_stats.exhausted[c]++;
+        }
+        spin_unlock(s_lock, save);
+        if (block) return block;
+        break;  // bigger classes stay reserved for their own size range
+    }
+    uint32_t save = spin_lock_blocking(s_lock);
+    s_stats.heap_allocs++;
+    spin_unlock(s_lock, save);
+    return pvPortMalloc(size);
+}
+
+static void pool_free(void* ptr) {
+    if (ptr >= (void*)pool_storage && ptr < (void*)(pool_storage + sizeof(pool_storage))) {
+        int c = 0;
+        while ((uint8_t*)ptr >= s_class_base[c + 1]) c++;
+        uint32_t save = spin_lock_blocking(s_lock);
+        *(void**)ptr = s_free_head[c];
+        s_free_head[c] = ptr;
+        s_stats.frees[c]++;
+        spin_unlock(s_lock, save);
+        return;
+    }
+    if (s_lock) {
+        uint32_t save = spin_lock_blocking(s_lock);
+        s_stats.heap_frees++;
+        spin_unlock(s_lock, save);
+    }
+    vPortFree(ptr);
+}
+
+void pool_get_stats(PoolAllocStats* out) {
+    if (!s_lock) { *out = PoolAllocStats{}; return; }
+    uint32_t save = spin_lock_blocking(s_lock);
+    *out = s_stats;
+    spin_unlock(s_lock, save);
+}
 
 void * operator new( size_t size ){
-    return pvPortMalloc( size );
+    return pool_alloc( size );
 }
 
 void * operator new[]( size_t size ){
-    return pvPortMalloc(size);
+    return pool_alloc(size);
 }
 
 void operator delete( void * ptr ){
-    vPortFree ( ptr );
+    pool_free ( ptr );
 }
 
 void operator delete[]( void * ptr ){
-    vPortFree ( ptr );
+    pool_free ( ptr );
 }
-
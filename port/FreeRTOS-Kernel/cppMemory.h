@@ -0,0 +1,29 @@
+/*
+ * cppMemory.h
+ *
+ * Size-class pool allocator stats for the operator new/delete overrides
+ * in cppMemory.cpp. Small allocations are served O(1) from fixed-size
+ * pools; heap_4 is the fallback. The counters exist so a build can
+ * prove the steady-state control path is allocation-free.
+ */
+
+#ifndef CPP_MEMORY_H
+#define CPP_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define POOL_NUM_CLASSES 4
+
+struct PoolAllocStats {
+    uint32_t allocs[POOL_NUM_CLASSES];     // served from the pool
+    uint32_t frees[POOL_NUM_CLASSES];      // returned to the pool
+    uint32_t exhausted[POOL_NUM_CLASSES];  // class empty, fell through
+    uint32_t heap_allocs;                  // served by pvPortMalloc
+    uint32_t heap_frees;                   // returned via vPortFree
+};
+
+// Snapshot the allocation counters (copies under the pool lock).
+void pool_get_stats(PoolAllocStats* out);
+
+#endif
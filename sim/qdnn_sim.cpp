@@ -0,0 +1,470 @@
+/**
+ * @file qdnn_sim.cpp
+ *
+ * @brief Host-side simulator for the QDNN control pipeline
+ *
+ * Runs the hardware-independent pipeline logic (src/control_logic.h)
+ * against synthetic greenhouse traces on a development machine: a
+ * day/night temperature and humidity cycle with sensor noise, soil
+ * moisture that dries over time and rewets when the simulated pump
+ * runs. Models are stood in for by the reference threshold policy the
+ * QDNN models were trained to approximate, so pipeline changes can be
+ * sanity-checked in seconds without flashing hardware.
+ *
+ * Build from sim/:  cmake -S . -B build && cmake --build build
+ * Run:              ./build/qdnn_sim [cycles]
+ *                   ./build/qdnn_sim --bench          (hot-path micro-benchmark)
+ *                   ./build/qdnn_sim --replay <file>  (replay an on-device trace)
+ *                   ./build/qdnn_sim --drift [file]   (int8-vs-float drift monitor)
+ *
+ * The --bench mode times the shared hot-path primitives and prints in
+ * the same line shape as the on-target benchmark, so
+ * tools/bench_compare.py can gate both against their golden files.
+ *
+ * The --replay mode consumes the replay records a QDNN_REPLAY_TRACE
+ * build tees into the datalog (SOF 0xB7, telemetry_wire.h): each record
+ * carries the cycle's deci-unit input frame, the model-proposed levels
+ * and the levels actually committed after the dwell filter. The
+ * simulator re-runs the shared dwell/commit plumbing on the recorded
+ * proposals and diffs the outcome against what the unit did, so a field
+ * misbehaviour can be reproduced - and a pipeline fix validated against
+ * it - at the desk, bit for bit.
+ *
+ * The --drift mode is the soft-float elimination program's standing
+ * regression: it holds the integer fast paths (raw-row argmax scans,
+ * Q16 input quantizer) against the float references they replaced and
+ * exits nonzero on any real divergence; given a replay dump it also
+ * characterizes what the int8 input snapping did to the recorded
+ * trace's decisions. Details at run_drift() below.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <vector>
+
+#include "control_logic.h"
+#include "telemetry_wire.h"
+
+namespace {
+
+// Deterministic LCG so runs are reproducible across hosts.
+uint32_t g_rng = 0x12345678;
+float frand(float lo, float hi) {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return lo + (hi - lo) * ((g_rng >> 8) & 0xFFFF) / 65535.0f;
+}
+
+// Reference policy the fan model approximates: hotter and more humid
+// air wants more airflow. The pre-round load is exposed separately so
+// the drift monitor can measure distance to the decision boundary.
+float reference_fan_load(float temp, float humid) {
+    return (temp - 24.0f) / 3.0f + (humid - 60.0f) / 20.0f;
+}
+
+int reference_fan_level(float temp, float humid) {
+    return clamp_level((int)std::lround(reference_fan_load(temp, humid)));
+}
+
+// Reference policy the pump model approximates: drier soil wants more
+// irrigation, backed off when ambient humidity is already high.
+float reference_pump_need(float soil_pct, float humid) {
+    return (55.0f - soil_pct) / 10.0f - (humid - 70.0f) / 30.0f;
+}
+
+int reference_pump_level(float soil_pct, float humid) {
+    return clamp_level((int)std::lround(reference_pump_need(soil_pct, humid)));
+}
+
+// --- Hot-path micro-benchmark (--bench) ---
+// Times the hardware-independent primitives the control cycle leans
+// on. Wall-clock per iteration, printed in the target benchmark's
+// line shape for tools/bench_compare.py.
+volatile int32_t g_sink;  // defeats constant folding across the loops
+
+template <typename F>
+void bench_one(const char* name, int iters, F body) {
+    // Best of five batches: host wall-clock is at the mercy of
+    // frequency scaling and scheduler noise, and the minimum is the
+    // stable estimator of the undisturbed cost.
+    double best_ns = 0.0;
+    for (int rep = 0; rep < 5; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++) g_sink = body(i);
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        if (rep == 0 || ns < best_ns) best_ns = ns;
+    }
+    printf("%s: %d iters, %.0f ns total, %.2f ns/iter\n",
+           name, iters, best_ns, best_ns / iters);
+}
+
+int run_bench() {
+    printf("=== QDNN host micro-benchmark ===\n");
+    printf("--- profile: host ---\n");
+
+    bench_one("quantize", 10000000, [](int i) {
+        return quantize_deci_q16((i & 1023) - 200, 21000, -128, -128, 127);
+    });
+
+    bench_one("soil_convert", 10000000, [](int i) {
+        return adc_to_percent10_cal((uint16_t)(1200 + (i & 2047)),
+                                    SOIL_DRY_RAW, SOIL_WET_RAW);
+    });
+
+    static MedianFilter mf;
+    median_init(&mf);
+    bench_one("median", 10000000, [](int i) {
+        return (int32_t)median_push(&mf, (uint16_t)(1500 + (i * 37 & 255)));
+    });
+
+    static SensorHistory hist;
+    history_init(&hist);
+    bench_one("ema", 10000000, [](int i) {
+        history_push(&hist, (int16_t)(250 + (i & 63)));
+        return (int32_t)history_ema(&hist);
+    });
+
+    static InferCache cache;
+    infer_cache_init(&cache);
+    bench_one("cache", 10000000, [](int i) {
+        uint8_t key[3] = {(uint8_t)i, (uint8_t)(i >> 3), (uint8_t)(i >> 6)};
+        int hit = infer_cache_lookup(&cache, key);
+        if (hit < 0) infer_cache_store(&cache, key, i & 3);
+        return hit;
+    });
+
+    printf("=== benchmark done ===\n");
+    return 0;
+}
+
+// --- Deterministic trace replay (--replay) ---
+// Re-drives the shared dwell/commit path with the proposals a unit
+// recorded and diffs against the levels it actually committed. A clean
+// run proves the host pipeline and the field pipeline agree bit for
+// bit; a diff row pins the first cycle where they do not. Note that
+// QDNN_LEVEL_DITHER builds alternate single steps around a fractional
+// target *after* the dwell filter, so on those traces fan diffs of one
+// step in blend cycles are expected, not a divergence.
+
+int run_replay(const char* path) {
+    FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::perror(path);
+        return 1;
+    }
+    std::vector<uint8_t> buf;
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0)
+        buf.insert(buf.end(), chunk, chunk + n);
+    std::fclose(f);
+
+    LevelFilter fan_filter;
+    LevelFilter pump_filter[TELEMETRY_REPLAY_ZONES];
+    bool seeded = false;
+    long records = 0, crc_bad = 0, gaps = 0, mismatches = 0;
+    uint32_t last_seq = 0;
+
+    printf("cycle_seq,t_ms,fan_model,fan_dev,fan_sim,"
+           "pump_model,pump_dev,pump_sim,diff\n");
+
+    // Same CRC-gated resync the decoder uses: a datalog export carries
+    // every frame type plus torn sectors, and only intact 0xB7 records
+    // feed the filters.
+    size_t i = 0;
+    while (i + sizeof(ReplayRecord) <= buf.size()) {
+        if (buf[i] != TELEMETRY_REPLAY_SOF) {
+            i++;
+            continue;
+        }
+        ReplayRecord rec;
+        std::memcpy(&rec, &buf[i], sizeof(rec));
+        if (telemetry_crc16(&buf[i], sizeof(rec) - 2) != rec.crc) {
+            crc_bad++;
+            i++;
+            continue;
+        }
+        i += sizeof(rec);
+        records++;
+
+        if (!seeded) {
+            // The trace starts mid-stream: adopt the unit's committed
+            // state at the first record so the dwell filters agree on
+            // their starting point.
+            level_filter_init(&fan_filter);
+            fan_filter.committed = rec.fan_commit;
+            for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++) {
+                level_filter_init(&pump_filter[z]);
+                pump_filter[z].committed = rec.pump_commit[z];
+            }
+            seeded = true;
+            last_seq = rec.cycle_seq;
+        } else if (rec.cycle_seq != last_seq + 1) {
+            // The sliding datalog window drops the oldest sectors; a
+            // seq gap means missing cycles, so re-seed rather than run
+            // the filters across the hole.
+            gaps++;
+            fan_filter.committed = rec.fan_commit;
+            fan_filter.candidate = rec.fan_commit;
+            fan_filter.streak = 0;
+            for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++) {
+                pump_filter[z].committed = rec.pump_commit[z];
+                pump_filter[z].candidate = rec.pump_commit[z];
+                pump_filter[z].streak = 0;
+            }
+            last_seq = rec.cycle_seq;
+            continue;
+        } else {
+            last_seq = rec.cycle_seq;
+        }
+
+        int fan_sim = level_filter_apply(&fan_filter, rec.fan_model);
+        bool diff = fan_sim != (int)rec.fan_commit;
+        int pump_sim[TELEMETRY_REPLAY_ZONES];
+        for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++) {
+            pump_sim[z] = level_filter_apply(&pump_filter[z], rec.pump_model[z]);
+            if (pump_sim[z] != (int)rec.pump_commit[z]) diff = true;
+        }
+        if (diff) mismatches++;
+
+        printf("%u,%u,%d,%u,%d,", rec.cycle_seq, rec.t_ms,
+               rec.fan_model, rec.fan_commit, fan_sim);
+        for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++)
+            printf("%d:%u:%d%c", rec.pump_model[z], rec.pump_commit[z],
+                   pump_sim[z], z + 1 < TELEMETRY_REPLAY_ZONES ? '/' : ',');
+        printf("%s\n", diff ? "DIFF" : "");
+    }
+
+    fprintf(stderr,
+            "replay: %ld records, %ld crc rejects, %ld seq gaps, "
+            "%ld diverging cycles\n",
+            records, crc_bad, gaps, mismatches);
+    if (records == 0) {
+        fprintf(stderr, "replay: no replay records in %s "
+                        "(was the unit built with QDNN_REPLAY_TRACE?)\n", path);
+        return 1;
+    }
+    return mismatches ? 2 : 0;
+}
+
+// --- Numerical drift monitor (--drift) ---
+// Standing proof that the soft-float eliminations preserved decision
+// behavior: the integer fast paths run against their float references
+// on the same inputs, and any divergence lands in a histogram instead
+// of in a greenhouse.
+//
+// Stage 1 holds the raw-row argmax scans (control_logic.h, the
+// logit-only path that replaced dequantize-then-compare in
+// run_model_safe) against a reference that dequantizes every cell and
+// decides in float: dequantization is affine increasing, so decisions
+// and step-unit margins must match exactly - any flip is a bug, and
+// the monitor exits nonzero on it. Stage 2 sweeps the Q16 input
+// quantizer against the float quantizer it replaced; half-ulp float
+// representation can land a boundary value one code away (counted,
+// tolerated), anything further fails. Stage 3, with a replay dump,
+// runs the recorded deci-unit frames through the int8 input snapping
+// and counts the decision flips and boundary distances the snapping
+// itself causes - characterization of the trace, reported not gated.
+
+int run_drift(const char* path) {
+    int failures = 0;
+
+    // Stage 1: integer argmax/margin vs dequantizing float reference.
+    const int kRows = 1000000;
+    long flips = 0, margin_bad = 0;
+    for (int r = 0; r < kRows; r++) {
+        int8_t row[4];
+        int8_t bias[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; i++) {
+            g_rng = g_rng * 1664525u + 1013904223u;
+            row[i] = (int8_t)(g_rng >> 24);
+        }
+        bool biased = (r & 1) != 0;  // half the rows carry a delta row
+        if (biased)
+            for (int i = 0; i < 4; i++) {
+                g_rng = g_rng * 1664525u + 1013904223u;
+                bias[i] = (int8_t)((int)((g_rng >> 24) & 31) - 16);
+            }
+        float scale = 0.01f + 0.29f * ((g_rng >> 8) & 0xFFFF) / 65535.0f;
+        int zp = (int)((g_rng >> 4) & 31) - 16;
+
+        int8_t margin_i;
+        int pred_i = biased ? argmax2_row_biased(row, 4, bias, &margin_i)
+                            : argmax2_row(row, 4, &margin_i);
+
+        // Float reference: dequantize each cell (biases are defined in
+        // logit steps, so they dequantize with the same scale), decide
+        // with the same strict > / lowest-index tie rule.
+        float best = -1e30f, second = -1e30f;
+        int pred_f = 0;
+        for (int i = 0; i < 4; i++) {
+            float v = scale * (float)(row[i] - zp + bias[i]);
+            if (v > best) { second = best; best = v; pred_f = i; }
+            else if (v > second) second = v;
+        }
+        long gap_f = std::lround((best - second) / scale);
+        if (gap_f > 127) gap_f = 127;  // the int8 margin saturates there
+
+        if (pred_i != pred_f) flips++;
+        if ((long)margin_i != gap_f) margin_bad++;
+    }
+    printf("drift: argmax %d rows, %ld decision flips, %ld margin deltas\n",
+           kRows, flips, margin_bad);
+    if (flips != 0 || margin_bad != 0) failures++;
+
+    // Stage 2: Q16 input quantizer vs the float path it replaced.
+    static const int32_t kMults[] = {3277, 6554, 13107, 21000, 52429};
+    long q_exact = 0, q_ulp = 0, q_bad = 0;
+    for (size_t m = 0; m < sizeof(kMults) / sizeof(kMults[0]); m++) {
+        float inv_scale = (float)kMults[m] / 65536.0f;
+        for (int32_t v10 = -2000; v10 <= 10000; v10++) {
+            int32_t qi = quantize_deci_q16(v10, kMults[m], -128, -128, 127);
+            int32_t qf = quantize_scaled((float)v10, inv_scale, -128, -128, 127);
+            int32_t d = qi > qf ? qi - qf : qf - qi;
+            if (d == 0) q_exact++;
+            else if (d == 1) q_ulp++;
+            else q_bad++;
+        }
+    }
+    printf("drift: quantizer sweep, %ld exact, %ld half-ulp, %ld worse\n",
+           q_exact, q_ulp, q_bad);
+    if (q_bad != 0) failures++;
+
+    // Stage 3: input-snapping characterization over a replay trace.
+    if (path != nullptr) {
+        FILE* f = std::fopen(path, "rb");
+        if (!f) {
+            std::perror(path);
+            return 1;
+        }
+        std::vector<uint8_t> buf;
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0)
+            buf.insert(buf.end(), chunk, chunk + n);
+        std::fclose(f);
+
+        // Stand-in int8 affine per feature, spanning the training
+        // ranges the model metadata declares (model_meta.h).
+        struct Affine { int16_t min10, max10; };
+        const Affine kFeat[3] = {{0, 500}, {200, 900}, {0, 1000}};
+        int32_t mult[3];
+        for (int i = 0; i < 3; i++)
+            mult[i] = (int32_t)((65536LL * 255 +
+                (kFeat[i].max10 - kFeat[i].min10) / 2) /
+                (kFeat[i].max10 - kFeat[i].min10));
+
+        auto snap = [&](int16_t v10, int fidx) {
+            int32_t q = quantize_deci_q16(v10 - kFeat[fidx].min10,
+                                          mult[fidx], -128, -128, 127);
+            return (float)kFeat[fidx].min10 / 10.0f +
+                   (q + 128) * (kFeat[fidx].max10 - kFeat[fidx].min10) /
+                       (255.0f * 10.0f);
+        };
+
+        long records = 0, fan_flips = 0, pump_flips = 0, decisions = 0;
+        long hist[9] = {};  // |boundary distance delta| in 1/16-level bins
+        size_t i = 0;
+        while (i + sizeof(ReplayRecord) <= buf.size()) {
+            if (buf[i] != TELEMETRY_REPLAY_SOF) { i++; continue; }
+            ReplayRecord rec;
+            std::memcpy(&rec, &buf[i], sizeof(rec));
+            if (telemetry_crc16(&buf[i], sizeof(rec) - 2) != rec.crc) {
+                i++;
+                continue;
+            }
+            i += sizeof(rec);
+            records++;
+
+            float temp = rec.temp10 / 10.0f, humid = rec.humid10 / 10.0f;
+            float temp_s = snap(rec.temp10, 0), humid_s = snap(rec.humid10, 1);
+            float d = reference_fan_load(temp, humid) -
+                      reference_fan_load(temp_s, humid_s);
+            if (d < 0) d = -d;
+            long bin = std::lround(d * 16.0f);
+            hist[bin > 8 ? 8 : bin]++;
+            decisions++;
+            if (reference_fan_level(temp, humid) !=
+                reference_fan_level(temp_s, humid_s))
+                fan_flips++;
+
+            for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++) {
+                float soil = rec.soil_pct10[z] / 10.0f;
+                float soil_s = snap(rec.soil_pct10[z], 2);
+                d = reference_pump_need(soil, humid) -
+                    reference_pump_need(soil_s, humid_s);
+                if (d < 0) d = -d;
+                bin = std::lround(d * 16.0f);
+                hist[bin > 8 ? 8 : bin]++;
+                decisions++;
+                if (reference_pump_level(soil, humid) !=
+                    reference_pump_level(soil_s, humid_s))
+                    pump_flips++;
+            }
+        }
+        printf("drift: trace %ld records, %ld fan flips, %ld pump flips "
+               "of %ld decisions\n", records, fan_flips, pump_flips, decisions);
+        printf("drift: snap-delta histogram (1/16 level):");
+        for (int b = 0; b < 9; b++)
+            printf(" %ld%s", hist[b], b == 8 ? "+" : "");
+        printf("\n");
+        if (records == 0) {
+            fprintf(stderr, "drift: no replay records in %s\n", path);
+            return 1;
+        }
+    }
+
+    return failures ? 2 : 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) return run_bench();
+    if (argc > 1 && std::strcmp(argv[1], "--replay") == 0) {
+        if (argc < 3) {
+            fprintf(stderr, "usage: qdnn_sim --replay <dump>\n");
+            return 1;
+        }
+        return run_replay(argv[2]);
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--drift") == 0)
+        return run_drift(argc > 2 ? argv[2] : nullptr);
+
+    int cycles = (argc > 1) ? std::atoi(argv[1]) : 200;
+
+    float soil_pct_true = 60.0f;  // ground truth the ADC observes
+
+    printf("cycle,temp,humid,soil_raw,soil_pct,fan_level,pump_level\n");
+    for (int cycle = 0; cycle < cycles; cycle++) {
+        // Day/night cycle: one period every 96 cycles (3 s cadence ~= 5 min)
+        float phase = 2.0f * 3.14159265f * cycle / 96.0f;
+        float temp  = 26.0f + 6.0f * std::sin(phase) + frand(-0.5f, 0.5f);
+        float humid = 65.0f - 15.0f * std::sin(phase) + frand(-2.0f, 2.0f);
+
+        // Soil dries faster when hot; the pump from the previous cycle rewets
+        soil_pct_true -= 0.15f + 0.02f * (temp - 24.0f);
+        if (soil_pct_true < 0.0f) soil_pct_true = 0.0f;
+
+        // Back out the raw ADC count the probe would report, plus noise
+        uint16_t soil_raw = (uint16_t)(SOIL_DRY_RAW -
+            soil_pct_true * (SOIL_DRY_RAW - SOIL_WET_RAW) / 100.0f +
+            frand(-20.0f, 20.0f));
+        float soil_pct = adc_to_percent(soil_raw);
+
+        int fan_level  = reference_fan_level(temp, humid);
+        int pump_level = reference_pump_level(soil_pct, humid);
+
+        // Pump actuation feeds back into the soil ground truth
+        soil_pct_true += 0.8f * pump_level;
+        if (soil_pct_true > 100.0f) soil_pct_true = 100.0f;
+
+        printf("%d,%.1f,%.1f,%u,%.1f,%d,%d\n",
+               cycle, temp, humid, soil_raw, soil_pct, fan_level, pump_level);
+    }
+    return 0;
+}
@@ -0,0 +1,834 @@
+/**
+ * @file qdnn_unit.cpp
+ *
+ * @brief Host-side unit tests for the shared control pipeline logic
+ *
+ * Exercises the pure functions in src/control_logic.h - the code the
+ * firmware and the simulator both compile - so a hysteresis, filter or
+ * quantization regression fails here in seconds instead of in a
+ * greenhouse. Where a routine has a brute-force twin (the O(1)
+ * incremental history sums, the sorted-window median, the split-half
+ * batch quantizer), the test replays random traffic against the naive
+ * recompute and demands bit-exact agreement, which is the property the
+ * firmware actually relies on.
+ *
+ * The last section holds coarse timing assertions on the fixed-point
+ * kernels: generous absolute bounds (a loaded CI host clears them by an
+ * order of magnitude) that only trip when a "constant-time" routine
+ * quietly grows a loop or a libgcc 64-bit helper. Fine-grained timing
+ * stays with --bench and tools/bench_compare.py.
+ *
+ * Build from sim/:  cmake -S . -B build && cmake --build build
+ * Run:              ./build/qdnn_unit      (or ctest --test-dir build)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include "control_logic.h"
+#include "metrics.h"
+#include "scratch_arena.h"
+#include "watch_channel.h"
+
+namespace {
+
+int g_failures = 0;
+int g_checks = 0;
+
+#define CHECK(cond)                                                     \
+    do {                                                                \
+        g_checks++;                                                     \
+        if (!(cond)) {                                                  \
+            g_failures++;                                               \
+            printf("FAIL %s:%d  %s\n", __FILE__, __LINE__, #cond);      \
+        }                                                               \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                  \
+    do {                                                                \
+        g_checks++;                                                     \
+        long long va = (long long)(a), vb = (long long)(b);             \
+        if (va != vb) {                                                 \
+            g_failures++;                                               \
+            printf("FAIL %s:%d  %s == %s  (%lld != %lld)\n", __FILE__,  \
+                   __LINE__, #a, #b, va, vb);                           \
+        }                                                               \
+    } while (0)
+
+// Deterministic LCG, same recurrence as the simulator's.
+uint32_t g_rng = 0x12345678;
+uint32_t urand() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+// --- Fixed-point library ---
+
+void test_fixed_q() {
+    // Compile-time literals round the way the init-time factor
+    // computations always have.
+    CHECK_EQ(Q16::lit(0.5).raw, 32768);
+    CHECK_EQ(Q16::lit(0.1).raw, 6554);
+    CHECK_EQ(Q8::lit(-0.5).raw, -128);
+
+    // Conversions: floor is the arithmetic shift, round is half-up,
+    // the fractional part stays in [0, 2^Frac) even for negatives.
+    CHECK_EQ(Q8::from_int(3).raw, 768);
+    CHECK_EQ(Q8::from_raw(-1).to_int_floor(), -1);
+    CHECK_EQ(Q8::from_raw(383).to_int_round(), 1);
+    CHECK_EQ(Q8::from_raw(384).to_int_round(), 2);
+    CHECK_EQ(Q8::from_raw(0x1FF).frac_raw(), 0xFF);
+    CHECK_EQ(Q8::from_raw(-1).frac_raw(), 255);
+
+    // Q*Q multiply rounds; exact products land exactly.
+    CHECK_EQ(Q16::lit(1.5).mul(Q16::lit(2.25)).raw, Q16::lit(3.375).raw);
+
+    // Saturating ops pin at the rails instead of wrapping.
+    CHECK_EQ(Q8::from_raw(INT32_MAX).sat_add(Q8::from_int(1)).raw, INT32_MAX);
+    CHECK_EQ(Q8::from_raw(INT32_MIN).sat_sub(Q8::from_int(1)).raw, INT32_MIN);
+    CHECK_EQ(Q8::from_int(2).sat_add(Q8::from_int(3)).raw, Q8::from_int(5).raw);
+
+    // Rescale moves the binary point; narrowing rounds like the shift
+    // idiom it replaces.
+    CHECK_EQ(Q8::from_int(3).rescale<16>().raw, Q16::from_int(3).raw);
+    CHECK_EQ(Q16::from_raw(0x18000).rescale<8>().raw, 0x180);
+
+    // mul_int_round is the quantizer core: bit-exact with the legacy
+    // (v * mult + 2^15) >> 16 expression across the deci-unit range.
+    for (int v = -2000; v <= 2000; v += 7) {
+        int32_t legacy = (int32_t)(((int64_t)v * 6554 + (1 << 15)) >> 16);
+        CHECK_EQ(Q16::from_raw(6554).mul_int_round(v), legacy);
+    }
+}
+
+// --- Soil conversion ---
+
+void test_adc_to_percent() {
+    // Calibration endpoints map to the rails, midpoint to 50.0%.
+    CHECK_EQ(adc_to_percent10_cal(4000, 4000, 1000), 0);
+    CHECK_EQ(adc_to_percent10_cal(1000, 4000, 1000), 1000);
+    CHECK_EQ(adc_to_percent10_cal(2500, 4000, 1000), 500);
+    // Readings past either endpoint clamp instead of wrapping.
+    CHECK_EQ(adc_to_percent10_cal(4095, 4000, 1000), 0);
+    CHECK_EQ(adc_to_percent10_cal(200, 4000, 1000), 1000);
+    // Monotonic: wetter (lower raw) never reads drier.
+    int prev = -1;
+    for (int raw = 4095; raw >= 0; raw -= 7) {
+        int p10 = adc_to_percent10((uint16_t)raw);
+        CHECK(p10 >= prev);
+        prev = p10;
+    }
+    // The float wrapper is the integer result scaled, nothing more.
+    CHECK(std::fabs(adc_to_percent(2500) - 50.0f) < 0.0001f);
+}
+
+// --- Level clamp + delta gate ---
+
+void test_clamp_and_delta_gate() {
+    CHECK_EQ(clamp_level(-3), 0);
+    CHECK_EQ(clamp_level(0), 0);
+    CHECK_EQ(clamp_level(4), 4);
+    CHECK_EQ(clamp_level(9), 4);
+
+    // At the threshold is "no change"; one deci-unit past it fires.
+    int16_t prev[6] = {250, 600, 500, 120, 0, 0};
+    int16_t cur[6] = {250, 600, 500, 120, 0, 0};
+    CHECK(!inputs_changed10(prev, cur));
+    cur[0] = (int16_t)(250 + DELTA_TEMP_DECI);
+    CHECK(!inputs_changed10(prev, cur));
+    cur[0] = (int16_t)(250 + DELTA_TEMP_DECI + 1);
+    CHECK(inputs_changed10(prev, cur));
+    cur[0] = 250;
+    cur[2] = (int16_t)(500 - DELTA_SOIL_DECI - 1);
+    CHECK(inputs_changed10(prev, cur));
+    cur[2] = 500;
+
+    // Extra features gate on the tighter DELTA_EXTRA_DECI, and only
+    // when the row width says they exist.
+    cur[3] = (int16_t)(120 + DELTA_EXTRA_DECI + 1);
+    CHECK(!inputs_changed10(prev, cur, 3));
+    CHECK(inputs_changed10(prev, cur, 4));
+    cur[3] = (int16_t)(120 + DELTA_EXTRA_DECI);
+    CHECK(!inputs_changed10(prev, cur, 4));
+}
+
+// --- Degradation-ladder fallback bands ---
+
+void test_fallback_policy() {
+    // Band edges: the threshold value itself is already the higher
+    // level, and both policies are monotonic over their input.
+    CHECK_EQ(fallback_fan_level(289), 0);
+    CHECK_EQ(fallback_fan_level(290), 1);
+    CHECK_EQ(fallback_fan_level(310), 2);
+    CHECK_EQ(fallback_fan_level(330), 3);
+    CHECK_EQ(fallback_fan_level(360), 4);
+    CHECK_EQ(fallback_fan_level(500), 4);
+
+    CHECK_EQ(fallback_pump_level(0), 4);
+    CHECK_EQ(fallback_pump_level(199), 4);
+    CHECK_EQ(fallback_pump_level(200), 3);
+    CHECK_EQ(fallback_pump_level(300), 2);
+    CHECK_EQ(fallback_pump_level(400), 1);
+    CHECK_EQ(fallback_pump_level(500), 0);
+    CHECK_EQ(fallback_pump_level(1000), 0);
+
+    for (int v = 1; v <= 1000; v++) {
+        CHECK(fallback_fan_level(v) >= fallback_fan_level(v - 1));
+        CHECK(fallback_pump_level(v) <= fallback_pump_level(v - 1));
+    }
+}
+
+// --- Humidity/soil cross-consistency fusion ---
+
+void test_fusion_score() {
+    FusionScore f;
+    fusion_init(&f);
+    CHECK_EQ(f.score, FUSION_SCORE_MAX);  // boot optimistic
+
+    // First sample only primes the deltas.
+    CHECK_EQ(fusion_update(&f, 500, 400), FUSION_SCORE_MAX);
+
+    // Moves inside the delta-gate deadbands carry no evidence either way.
+    CHECK_EQ(fusion_update(&f, (int16_t)(500 + DELTA_HUMID_DECI),
+                           (int16_t)(400 + DELTA_SOIL_DECI)), FUSION_SCORE_MAX);
+    // One signal moving alone is a legitimate scene, not divergence.
+    CHECK_EQ(fusion_update(&f, (int16_t)(500 + DELTA_HUMID_DECI + 20),
+                           (int16_t)(400 + DELTA_SOIL_DECI)), FUSION_SCORE_MAX);
+
+    // Anti-correlated co-movement drains at double rate; saturates at
+    // -MAX (the first step only re-crosses the soil deadband).
+    int16_t h = 700, s = 400;
+    for (int i = 0; i <= FUSION_SCORE_MAX; i++) {
+        h = (int16_t)(h + (i & 1 ? 20 : -20));
+        s = (int16_t)(s + (i & 1 ? -20 : 20));
+        fusion_update(&f, h, s);
+    }
+    CHECK_EQ(f.score, -FUSION_SCORE_MAX);
+
+    // Co-movement rebuilds at half the drain rate, one per cycle.
+    int sc = fusion_update(&f, (int16_t)(h + 20), (int16_t)(s + 20));
+    CHECK_EQ(sc, -FUSION_SCORE_MAX + 1);
+
+    // Weight map: negative half is worthless, positive half linear.
+    CHECK_EQ(fusion_weight_q8(-FUSION_SCORE_MAX), 0);
+    CHECK_EQ(fusion_weight_q8(0), 0);
+    CHECK_EQ(fusion_weight_q8(FUSION_SCORE_MAX / 2), 128);
+    CHECK_EQ(fusion_weight_q8(FUSION_SCORE_MAX), 256);
+
+    // Staleness bound: half the window with no trust, full with all of it.
+    CHECK_EQ(stale_air_bound_ms(30000, 0), 15000u);
+    CHECK_EQ(stale_air_bound_ms(30000, 128), 22500u);
+    CHECK_EQ(stale_air_bound_ms(30000, 256), 30000u);
+}
+
+// --- Hysteresis / dwell filter ---
+
+void test_level_filter() {
+    LevelFilter f;
+    level_filter_init(&f);
+
+    // A proposal must persist LEVEL_DWELL_CYCLES cycles before commit.
+    CHECK_EQ(level_filter_apply(&f, 2), 0);
+    CHECK_EQ(level_filter_apply(&f, 2), 2);
+    // Single-cycle excursions at a boundary never reach the hardware.
+    CHECK_EQ(level_filter_apply(&f, 3), 2);
+    CHECK_EQ(level_filter_apply(&f, 2), 2);
+    CHECK_EQ(level_filter_apply(&f, 3), 2);
+    CHECK_EQ(level_filter_apply(&f, 2), 2);
+    // A changed candidate restarts its own dwell from scratch.
+    CHECK_EQ(level_filter_apply(&f, 4), 2);
+    CHECK_EQ(level_filter_apply(&f, 1), 2);
+    CHECK_EQ(level_filter_apply(&f, 1), 1);
+
+    // Runtime dwell override: three cycles means three.
+    level_filter_init(&f);
+    CHECK_EQ(level_filter_apply(&f, 1, 3), 0);
+    CHECK_EQ(level_filter_apply(&f, 1, 3), 0);
+    CHECK_EQ(level_filter_apply(&f, 1, 3), 1);
+
+    // Skipped-cycle credit matures a pending candidate...
+    level_filter_init(&f);
+    CHECK_EQ(level_filter_apply(&f, 3, 4), 0);
+    level_filter_credit(&f, 2);
+    CHECK_EQ(level_filter_apply(&f, 3, 4), 3);
+    // ...but is a no-op with nothing pending.
+    level_filter_credit(&f, 10);
+    CHECK_EQ(level_filter_apply(&f, 3, 4), 3);
+    CHECK_EQ(f.streak, 0);
+}
+
+// --- Temporal dither: fractional averages, exact settling ---
+
+void test_level_dither() {
+    LevelDither d;
+    level_dither_init(&d);
+
+    // First sample primes; a held level never toggles.
+    CHECK_EQ(level_dither_apply(&d, 2), 2);
+    for (int i = 0; i < 8; i++) CHECK_EQ(level_dither_apply(&d, 2), 2);
+
+    // A step change blends: outputs stay within one step of the EMA
+    // path and eventually settle exactly on the new level.
+    int sum = 0;
+    for (int i = 0; i < 32; i++) {
+        int out = level_dither_apply(&d, 3);
+        CHECK(out == 2 || out == 3);
+        sum += out;
+    }
+    CHECK_EQ(level_dither_apply(&d, 3), 3);
+    // The running mean moved most of the way to the target.
+    CHECK(sum > 2 * 32 + 24);
+
+    // An alternating committed stream averages halfway: the sigma-delta
+    // reproduces the 50/50 duty rather than pinning to one side.
+    level_dither_init(&d);
+    int ones = 0;
+    for (int i = 0; i < 64; i++) {
+        int out = level_dither_apply(&d, (i & 1) ? 2 : 1);
+        CHECK(out == 1 || out == 2);
+        if (out == 2) ones++;
+    }
+    CHECK(ones > 20 && ones < 44);
+}
+
+// --- Scratch arena: bump, align, refuse, high water ---
+
+void test_scratch_arena() {
+    alignas(8) uint8_t buf[64];
+    ScratchArena a;
+    scratch_arena_init(&a, buf, sizeof(buf));
+
+    // Sequential bumps, typed and aligned.
+    uint8_t* p1 = SCRATCH_ALLOC_T(&a, uint8_t, 3);
+    CHECK(p1 == buf);
+    uint32_t* p2 = SCRATCH_ALLOC_T(&a, uint32_t, 2);
+    CHECK((uint8_t*)p2 == buf + 4);  // aligned past the 3 bytes
+    CHECK_EQ((int)a.high_water, 12);
+
+    // A refusal returns NULL, counts, and leaves the arena usable.
+    CHECK(scratch_arena_alloc(&a, 64, 1) == NULL);
+    CHECK_EQ((int)a.failures, 1);
+    CHECK(scratch_arena_alloc(&a, 52, 1) != NULL);
+    CHECK_EQ((int)a.high_water, 64);
+
+    // Reset frees everything in O(1) but keeps the bookkeeping.
+    scratch_arena_reset(&a);
+    CHECK(SCRATCH_ALLOC_T(&a, uint8_t, 64) == buf);
+    CHECK_EQ((int)a.high_water, 64);
+    CHECK_EQ((int)a.failures, 1);
+
+    // Overflow-proof size check: a huge request cannot wrap.
+    CHECK(scratch_arena_alloc(&a, (size_t)-8, 8) == NULL);
+}
+
+// --- History ring: incremental sums vs brute force ---
+
+void test_sensor_history() {
+    SensorHistory h;
+    history_init(&h);
+    CHECK_EQ(history_mean(&h), 0);
+    CHECK_EQ(history_slope10(&h), 0);
+
+    // First sample seeds the EMA exactly.
+    history_push(&h, 240);
+    CHECK_EQ(history_ema(&h), 240);
+    CHECK_EQ(history_mean(&h), 240);
+    CHECK_EQ(history_slope10(&h), 0);  // needs two samples
+
+    // Replay random traffic and recompute sum/sxy/slope the slow way
+    // after every push: the O(1) eviction update must agree bit-exactly
+    // long after the ring has wrapped many times.
+    history_init(&h);
+    int16_t shadow[SENSOR_HIST_CAPACITY * 8];
+    for (int i = 0; i < (int)(sizeof(shadow) / sizeof(shadow[0])); i++) {
+        int16_t v = (int16_t)(200 + (urand() % 400));
+        shadow[i] = v;
+        history_push(&h, v);
+
+        int n = (i + 1) < SENSOR_HIST_CAPACITY ? (i + 1) : SENSOR_HIST_CAPACITY;
+        const int16_t* win = &shadow[i + 1 - n];
+        int32_t sum = 0, sxy = 0;
+        for (int k = 0; k < n; k++) {
+            sum += win[k];
+            sxy += k * win[k];
+        }
+        CHECK_EQ(h.sum, sum);
+        CHECK_EQ(h.sxy, sxy);
+        CHECK_EQ(history_mean(&h), (int16_t)(sum / n));
+    }
+
+    // A perfect ramp's slope comes out as the full-window rise.
+    history_init(&h);
+    for (int i = 0; i < SENSOR_HIST_CAPACITY + 5; i++)
+        history_push(&h, (int16_t)(100 + 3 * i));
+    CHECK_EQ(history_slope10(&h), 3 * (SENSOR_HIST_CAPACITY - 1));
+    // A flat signal reads zero trend.
+    history_init(&h);
+    for (int i = 0; i < SENSOR_HIST_CAPACITY + 5; i++) history_push(&h, 500);
+    CHECK_EQ(history_slope10(&h), 0);
+    CHECK_EQ(history_ema(&h), 500);
+
+    int16_t mn, mx;
+    history_minmax(&h, &mn, &mx);
+    CHECK_EQ(mn, 500);
+    CHECK_EQ(mx, 500);
+}
+
+// --- Sampling governor ---
+
+void test_governor() {
+    SampleGovernor g;
+    governor_init(&g, 1000, 10000);
+    CHECK_EQ(g.period_ms, 1000);  // boots at the fast bound
+
+    // Flat spans creep the period up geometrically and cap at max.
+    int16_t flat[3] = {0, 0, 0};
+    CHECK_EQ(governor_update(&g, flat), 1250);
+    CHECK_EQ(governor_update(&g, flat), 1562);
+    uint32_t p = 0;
+    for (int i = 0; i < 32; i++) p = governor_update(&g, flat);
+    CHECK_EQ(p, 10000);
+
+    // Any active signal snaps straight back to the fast bound.
+    int16_t active[3] = {0, (int16_t)(GOV_HUMID_SPAN_DECI + 1), 0};
+    CHECK_EQ(governor_update(&g, active), 1000);
+    CHECK_EQ(governor_update(&g, flat), 1250);
+    governor_snap(&g);
+    CHECK_EQ(g.period_ms, 1000);
+
+    // Inverted bounds degrade to a fixed period, not a trap.
+    governor_init(&g, 3000, 500);
+    CHECK_EQ(governor_update(&g, flat), 3000);
+}
+
+// --- Energy budget governor ---
+
+void test_energy_governor() {
+    EnergyGovernor g;
+    energy_gov_init(&g, 3700, 3450, 100);
+    CHECK_EQ(g.state, ENERGY_STATE_OK);  // boots optimistic
+
+    // A sagging supply takes the full debounce window to commit.
+    CHECK_EQ(energy_gov_update(&g, 3600), ENERGY_STATE_OK);
+    CHECK_EQ(energy_gov_update(&g, 3600), ENERGY_STATE_OK);
+    CHECK_EQ(energy_gov_update(&g, 3600), ENERGY_STATE_SAVER);
+    CHECK_EQ(g.transitions, 1);
+
+    // Resting just above the threshold is not recovery: the hysteresis
+    // margin keeps the derates from flapping.
+    for (int i = 0; i < 8; i++)
+        CHECK_EQ(energy_gov_update(&g, 3750), ENERGY_STATE_SAVER);
+    // With margin, recovery commits after the same debounce.
+    energy_gov_update(&g, 3820);
+    energy_gov_update(&g, 3820);
+    CHECK_EQ(energy_gov_update(&g, 3820), ENERGY_STATE_OK);
+
+    // A dip that does not persist never commits a state change.
+    energy_gov_update(&g, 3300);
+    energy_gov_update(&g, 3300);
+    CHECK_EQ(energy_gov_update(&g, 3820), ENERGY_STATE_OK);
+    CHECK_EQ(g.transitions, 2);
+
+    // Straight to critical when the supply falls through both bands.
+    energy_gov_update(&g, 3200);
+    energy_gov_update(&g, 3200);
+    CHECK_EQ(energy_gov_update(&g, 3200), ENERGY_STATE_CRITICAL);
+    // Partial recovery out of critical lands in saver, not ok.
+    energy_gov_update(&g, 3600);
+    energy_gov_update(&g, 3600);
+    CHECK_EQ(energy_gov_update(&g, 3600), ENERGY_STATE_SAVER);
+
+    // Derate tables.
+    CHECK_EQ(energy_gov_period_floor_ms(ENERGY_STATE_OK, 1000, 6000), 1000);
+    CHECK_EQ(energy_gov_period_floor_ms(ENERGY_STATE_SAVER, 1000, 6000), 2000);
+    CHECK_EQ(energy_gov_period_floor_ms(ENERGY_STATE_CRITICAL, 1000, 6000), 6000);
+    CHECK_EQ(energy_gov_period_floor_ms(ENERGY_STATE_SAVER, 4000, 6000), 6000);
+    CHECK(energy_gov_allow_boost(ENERGY_STATE_OK));
+    CHECK(!energy_gov_allow_boost(ENERGY_STATE_SAVER));
+    CHECK_EQ(energy_gov_uplink_scale(ENERGY_STATE_CRITICAL), 4u);
+}
+
+// --- Thermal guard ---
+
+void test_thermal_guard() {
+    // Conversion against the datasheet anchor: 0.706 V is 27 degC at
+    // raw ~876 (876 exact reads 27.1); higher temperature means lower
+    // voltage (-1.721 mV/degC).
+    CHECK_EQ(adc_to_die_temp10(876), 271);
+    CHECK(adc_to_die_temp10(800) > adc_to_die_temp10(876));
+    CHECK(adc_to_die_temp10(900) < adc_to_die_temp10(876));
+    // ~1.721 mV/degC: 100 raw counts below the anchor is ~+46.8 degC.
+    int32_t hot = adc_to_die_temp10(776);
+    CHECK(hot > 730 && hot < 745);
+
+    ThermalGuard g;
+    thermal_guard_init(&g, 750, 50);
+    CHECK(thermal_guard_update(&g, 600));
+
+    // Derate trips on the first cycle at the ceiling - no debounce on
+    // the way up, heat only accumulates while we wait.
+    CHECK(!thermal_guard_update(&g, 750));
+    CHECK_EQ(g.derates, 1);
+
+    // Inside the hysteresis band is not recovery.
+    for (int i = 0; i < 8; i++)
+        CHECK(!thermal_guard_update(&g, 710));
+    // Below the band, restore commits only after the debounce window.
+    CHECK(!thermal_guard_update(&g, 690));
+    CHECK(!thermal_guard_update(&g, 690));
+    CHECK(thermal_guard_update(&g, 690));
+
+    // A cool reading that does not persist never restores boost.
+    CHECK(!thermal_guard_update(&g, 800));
+    CHECK_EQ(g.derates, 2);
+    thermal_guard_update(&g, 690);
+    CHECK(!thermal_guard_update(&g, 720));  // back in the band: streak resets
+    CHECK(!thermal_guard_update(&g, 690));
+    CHECK(!thermal_guard_update(&g, 690));
+    CHECK(thermal_guard_update(&g, 690));
+}
+
+// --- Actuation stagger ---
+
+void test_stagger_hold() {
+    // Four units, 1000 ms window: slots at 0/250/500/750.
+    CHECK_EQ(stagger_hold_ms(0, 0, 4, 1000), 0u);
+    CHECK_EQ(stagger_hold_ms(0, 1, 4, 1000), 250u);
+    CHECK_EQ(stagger_hold_ms(0, 3, 4, 1000), 750u);
+    // Past its slot, a unit waits for the next window's.
+    CHECK_EQ(stagger_hold_ms(300, 1, 4, 1000), 950u);
+    CHECK_EQ(stagger_hold_ms(250, 1, 4, 1000), 0u);
+    // The hold is always bounded by one window.
+    for (uint64_t t = 0; t < 3000; t += 7)
+        for (int u = 0; u < 4; u++)
+            CHECK(stagger_hold_ms(t, u, 4, 1000) < 1000u);
+    // Any two units' commit instants are >= window/units apart: the
+    // property the fleet's supply actually depends on.
+    for (uint64_t t = 0; t < 2000; t += 13) {
+        uint64_t a = t + stagger_hold_ms(t, 1, 4, 1000);
+        uint64_t b = t + stagger_hold_ms(t, 2, 4, 1000);
+        uint64_t gap = a > b ? a - b : b - a;
+        CHECK(gap >= 250 && gap <= 750);
+    }
+    // Degenerate configs commit immediately, never divide by zero.
+    CHECK_EQ(stagger_hold_ms(123, 0, 1, 1000), 0u);
+    CHECK_EQ(stagger_hold_ms(123, 0, 4, 0), 0u);
+}
+
+// --- Metrics registry ---
+
+void test_metrics_registry() {
+    // The name hash is the wire id: pin it to published FNV-1a vectors
+    // so a "harmless" hash tweak can't silently re-key every dashboard.
+    CHECK_EQ(metrics_hash(""), 2166136261u);
+    CHECK_EQ(metrics_hash("a"), 0xE40C292Cu);
+
+    static volatile uint32_t ctr = 0;
+    int slot = metrics_register("unit.ctr", METRIC_COUNTER, &ctr);
+    CHECK(slot >= 0);
+    CHECK_EQ(metrics_count(), slot + 1);
+
+    // Re-registering the same name is idempotent: same slot, no growth.
+    static volatile uint32_t other = 0;
+    CHECK_EQ(metrics_register("unit.ctr", METRIC_COUNTER, &other), slot);
+    CHECK_EQ(metrics_count(), slot + 1);
+
+    // The registry reads the module's live storage, never a copy.
+    const MetricDesc* d = metrics_get(slot);
+    CHECK(d != NULL);
+    CHECK_EQ(d->hash, metrics_hash("unit.ctr"));
+    ctr = 41;
+    ctr = ctr + 1;
+    CHECK_EQ(*d->value, 42u);
+
+    CHECK(metrics_get(-1) == NULL);
+    CHECK(metrics_get(metrics_count()) == NULL);
+
+    // A full table refuses further slots instead of evicting.
+    static char names[QDNN_METRICS_MAX][16];
+    static volatile uint32_t vals[QDNN_METRICS_MAX];
+    for (int i = 0; metrics_count() < QDNN_METRICS_MAX; i++) {
+        snprintf(names[i], sizeof(names[i]), "unit.fill%d", i);
+        CHECK(metrics_register(names[i], METRIC_GAUGE, &vals[i]) >= 0);
+    }
+    static volatile uint32_t overflow = 0;
+    CHECK_EQ(metrics_register("unit.overflow", METRIC_COUNTER, &overflow), -1);
+    CHECK_EQ(metrics_count(), QDNN_METRICS_MAX);
+}
+
+// --- Watch channels ---
+
+int g_watch_hits = 0;
+int32_t g_watch_last = 0;
+
+void watch_test_cb(int, int32_t value, void* arg) {
+    *(int*)arg += 1;
+    g_watch_last = value;
+}
+
+void test_watch_channel() {
+    int base = watch_count();
+    int hi = watch_register(WATCH_SIG_TEMP10, WATCH_ABOVE, 450, 20,
+                            watch_test_cb, &g_watch_hits);
+    int lo = watch_register(WATCH_SIG_VSYS_MV, WATCH_BELOW, 3600, 100,
+                            watch_test_cb, &g_watch_hits);
+    CHECK_EQ(hi, base);
+    CHECK_EQ(lo, base + 1);
+
+    // Below threshold: nothing fires, nothing is active.
+    watch_update(WATCH_SIG_TEMP10, 440);
+    CHECK_EQ(g_watch_hits, 0);
+    CHECK(!watch_active(hi));
+
+    // Entry fires exactly once; parking on the boundary stays quiet.
+    watch_update(WATCH_SIG_TEMP10, 450);
+    CHECK_EQ(g_watch_hits, 1);
+    CHECK_EQ(g_watch_last, 450);
+    CHECK(watch_active(hi));
+    watch_update(WATCH_SIG_TEMP10, 455);
+    watch_update(WATCH_SIG_TEMP10, 450);
+    CHECK_EQ(g_watch_hits, 1);
+
+    // Dropping below threshold but inside hysteresis does not re-arm.
+    watch_update(WATCH_SIG_TEMP10, 435);
+    watch_update(WATCH_SIG_TEMP10, 450);
+    CHECK_EQ(g_watch_hits, 1);
+
+    // Past the hysteresis margin it re-arms and fires again on entry.
+    watch_update(WATCH_SIG_TEMP10, 429);
+    CHECK(!watch_active(hi));
+    watch_update(WATCH_SIG_TEMP10, 451);
+    CHECK_EQ(g_watch_hits, 2);
+    CHECK_EQ(watch_fires(hi), 2u);
+
+    // The below-direction watch mirrors the same hysteresis contract,
+    // and updates on one signal never touch the other's subscriptions.
+    watch_update(WATCH_SIG_VSYS_MV, 3650);
+    CHECK_EQ(g_watch_hits, 2);
+    watch_update(WATCH_SIG_VSYS_MV, 3590);
+    CHECK_EQ(g_watch_hits, 3);
+    watch_update(WATCH_SIG_VSYS_MV, 3650);  // inside the 100 mV margin
+    watch_update(WATCH_SIG_VSYS_MV, 3590);
+    CHECK_EQ(g_watch_hits, 3);
+    watch_update(WATCH_SIG_VSYS_MV, 3701);
+    watch_update(WATCH_SIG_VSYS_MV, 3600);
+    CHECK_EQ(g_watch_hits, 4);
+
+    CHECK(!watch_active(-1));
+    CHECK_EQ(watch_fires(watch_count()), 0u);
+}
+
+// --- Median despike ---
+
+uint16_t brute_median(const uint16_t* vals, int n) {
+    uint16_t tmp[MEDIAN_WINDOW];
+    std::memcpy(tmp, vals, n * sizeof(uint16_t));
+    for (int i = 1; i < n; i++)
+        for (int j = i; j > 0 && tmp[j - 1] > tmp[j]; j--) {
+            uint16_t t = tmp[j];
+            tmp[j] = tmp[j - 1];
+            tmp[j - 1] = t;
+        }
+    return tmp[n / 2];
+}
+
+void test_median_filter() {
+    MedianFilter m;
+    median_init(&m);
+
+    // Usable before the window fills.
+    CHECK_EQ(median_push(&m, 1500), 1500);
+    CHECK_EQ(median_push(&m, 1510), 1510);
+    CHECK_EQ(median_push(&m, 1490), 1500);
+
+    // A single inrush spike in a steady window never escapes.
+    median_init(&m);
+    for (int i = 0; i < MEDIAN_WINDOW; i++) median_push(&m, 1500);
+    CHECK_EQ(median_push(&m, 4095), 1500);
+    CHECK_EQ(median_push(&m, 1500), 1500);
+
+    // Random traffic vs an insertion-sorted brute force of the same
+    // trailing window: the delete + sorted-insert update must agree.
+    median_init(&m);
+    uint16_t shadow[MEDIAN_WINDOW * 40];
+    for (int i = 0; i < (int)(sizeof(shadow) / sizeof(shadow[0])); i++) {
+        uint16_t v = (uint16_t)(urand() % 4096);
+        shadow[i] = v;
+        uint16_t got = median_push(&m, v);
+        int n = (i + 1) < MEDIAN_WINDOW ? (i + 1) : MEDIAN_WINDOW;
+        CHECK_EQ(got, brute_median(&shadow[i + 1 - n], n));
+    }
+}
+
+// --- Inference cache ---
+
+void test_infer_cache() {
+    InferCache c;
+    infer_cache_init(&c);
+
+    uint8_t k1[3] = {0x80, 0x12, 0x7F};
+    int8_t conf = 0, margin = 0;
+    CHECK_EQ(infer_cache_lookup(&c, k1, &conf, &margin), -1);
+    infer_cache_store(&c, k1, 3, 42, 17);
+    CHECK_EQ(infer_cache_lookup(&c, k1, &conf, &margin), 3);
+    CHECK_EQ(conf, 42);
+    CHECK_EQ(margin, 17);
+    CHECK_EQ(c.hits, 1);
+    CHECK_EQ(c.misses, 1);
+
+    // A colliding key overwrites; the old entry is honestly gone.
+    uint8_t k2[3] = {k1[0], k1[1], k1[2]};
+    k2[1] ^= 0xFF;
+    if (infer_cache_index(k2) == infer_cache_index(k1)) {
+        infer_cache_store(&c, k2, 1);
+        CHECK_EQ(infer_cache_lookup(&c, k1), -1);
+        CHECK_EQ(infer_cache_lookup(&c, k2), 1);
+    }
+
+    // Re-init invalidates every entry (model rebind path).
+    infer_cache_init(&c);
+    CHECK_EQ(infer_cache_lookup(&c, k1), -1);
+    CHECK_EQ(c.misses, 1);
+}
+
+// --- Quantization: fixed-point vs float, batch vs scalar ---
+
+void test_quantization() {
+    // The Q16 integer path must match the float reference across the
+    // whole deci-unit sensor range for a representative scale set.
+    const float scales[] = {1.0f / 128, 0.05f, 0.1f, 0.25f, 1.0f};
+    for (float scale : scales) {
+        int32_t mult = (int32_t)(0.1f / scale * 65536.0f + 0.5f);
+        float inv = 1.0f / scale;
+        for (int v10 = 0; v10 <= 1000; v10++) {
+            int32_t qi = quantize_deci_q16(v10, mult, -128, -128, 127);
+            int32_t qf = quantize_scaled(v10 * 0.1f, inv, -128, -128, 127);
+            // One LSB of slack: the Q16 constant itself is rounded.
+            CHECK(qi >= qf - 1 && qi <= qf + 1);
+            CHECK_EQ(quantize_deci_q16_noclamp(v10, mult, -128) < -128 ||
+                             quantize_deci_q16_noclamp(v10, mult, -128) > 127
+                         ? qi == -128 || qi == 127
+                         : qi == quantize_deci_q16_noclamp(v10, mult, -128),
+                     true);
+        }
+    }
+
+    // quantize_rows10() documents bit-exactness with the scalar helper
+    // for offset-corrected values that fit 16 bits: hammer it with
+    // random rows, widths, offsets and zero-points.
+    for (int trial = 0; trial < 200; trial++) {
+        int n_rows = 1 + (int)(urand() % 4);
+        int n_f = 1 + (int)(urand() % 6);
+        int16_t rows10[4 * 6];
+        int32_t mult[6];
+        int16_t off[6];
+        for (int f = 0; f < n_f; f++) {
+            mult[f] = (int32_t)(urand() % (1 << 20)) + 1;
+            off[f] = (int16_t)((int)(urand() % 400) - 200);
+        }
+        for (int i = 0; i < n_rows * n_f; i++)
+            rows10[i] = (int16_t)((int)(urand() % 2400) - 200);
+        int32_t zp = (int)(urand() % 256) - 128;
+
+        uint8_t out[4 * 6];
+        quantize_rows10(rows10, n_rows, n_f, mult, off, zp, -128, 127, out);
+        for (int r = 0; r < n_rows; r++)
+            for (int f = 0; f < n_f; f++) {
+                int32_t want = quantize_deci_q16(rows10[r * n_f + f] - off[f],
+                                                 mult[f], zp, -128, 127);
+                CHECK_EQ((int8_t)out[r * n_f + f], want);
+            }
+    }
+}
+
+// --- Timing assertions on the fixed-point kernels ---
+// Same best-of-five discipline as --bench. The bounds are deliberately
+// loose (these kernels measure in single-digit nanoseconds on any host
+// this runs on): they exist to catch a kernel that stops being O(1) -
+// an accidental window scan, a libgcc 64-bit divide - not to police
+// microarchitecture. Precision timing lives in bench_check.
+#define TIMING_BOUND_NS 150.0
+
+volatile int32_t g_sink;
+
+template <typename F>
+double time_one(int iters, F body) {
+    double best_ns = 0.0;
+    for (int rep = 0; rep < 5; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++) g_sink = body(i);
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        if (rep == 0 || ns < best_ns) best_ns = ns;
+    }
+    return best_ns / iters;
+}
+
+void test_kernel_timing() {
+    struct Case {
+        const char* name;
+        double ns;
+    } cases[4];
+
+    cases[0].name = "quantize";
+    cases[0].ns = time_one(2000000, [](int i) {
+        return quantize_deci_q16((i & 1023) - 200, 21000, -128, -128, 127);
+    });
+
+    cases[1].name = "soil_convert";
+    cases[1].ns = time_one(2000000, [](int i) {
+        return adc_to_percent10_cal((uint16_t)(1200 + (i & 2047)),
+                                    SOIL_DRY_RAW, SOIL_WET_RAW);
+    });
+
+    static MedianFilter mf;
+    median_init(&mf);
+    cases[2].name = "median";
+    cases[2].ns = time_one(2000000, [](int i) {
+        return (int32_t)median_push(&mf, (uint16_t)(1500 + (i * 37 & 255)));
+    });
+
+    static SensorHistory hist;
+    history_init(&hist);
+    cases[3].name = "history";
+    cases[3].ns = time_one(2000000, [](int i) {
+        history_push(&hist, (int16_t)(250 + (i & 63)));
+        return (int32_t)(history_ema(&hist) + history_slope10(&hist));
+    });
+
+    for (const Case& c : cases) {
+        printf("timing %-12s %7.2f ns/iter (bound %.0f)\n", c.name, c.ns,
+               TIMING_BOUND_NS);
+        CHECK(c.ns < TIMING_BOUND_NS);
+    }
+}
+
+}  // namespace
+
+int main() {
+    test_fixed_q();
+    test_adc_to_percent();
+    test_clamp_and_delta_gate();
+    test_fallback_policy();
+    test_fusion_score();
+    test_level_filter();
+    test_level_dither();
+    test_scratch_arena();
+    test_sensor_history();
+    test_governor();
+    test_energy_governor();
+    test_thermal_guard();
+    test_stagger_hold();
+    test_metrics_registry();
+    test_watch_channel();
+    test_median_filter();
+    test_infer_cache();
+    test_quantization();
+    test_kernel_timing();
+
+    printf("%d checks, %d failures\n", g_checks, g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,709 @@
+/**
+ * @file telemetry_decode.cpp
+ *
+ * @brief Host-side telemetry decoder and fleet analytics
+ *
+ * The authoritative consumer for the binary frame stream: compiles
+ * src/telemetry_wire.h verbatim, so the SOF table, struct layouts, CRC
+ * and delta codec here are the same definitions the firmware packs
+ * with - a layout change that forgets one side fails the other's
+ * static_asserts instead of shipping a silent drift.
+ *
+ *   qdnn_telemetry [--summary] [file ...]
+ *
+ * Input is any captured byte stream - a console log, a datalog export,
+ * a raw flash dump region - from one or more units; stdin when no file
+ * is named. Garbage between frames (boot banners, shell echo, torn
+ * sectors) is skipped by CRC-gated resync. Default output is columnar
+ * CSV, one row per frame (one row per entry for the table frames), the
+ * frame type tag in the first column; 32-bit timestamps are unwrapped
+ * to 64-bit via the time-sync frames or rollover tracking, so rows
+ * sort correctly across the ~71.6 min wrap.
+ *
+ * --summary instead aggregates per unit (attribution by the ident
+ * frames, SOF 0xB0): sample counts and sequence-gap loss, staleness,
+ * environment ranges, cycle-latency percentiles from the timing
+ * histograms, the error-counter table, pump duty totals and stream
+ * health - the fleet triage view in one command.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "telemetry_wire.h"
+
+// --- Stream assembly ---------------------------------------------------
+
+static bool read_stream(FILE* f, std::vector<uint8_t>* out) {
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        out->insert(out->end(), chunk, chunk + n);
+    return !ferror(f);
+}
+
+// --- Timestamp unwrap ---------------------------------------------------
+// Every frame stamps the low 32 bits of the monotonic counter; the
+// time-sync frame carries all 64 and re-anchors. Between syncs, a
+// backwards step of more than half the range is a wrap.
+
+struct Unwrap {
+    uint64_t high = 0;
+    uint32_t last = 0;
+    bool seen = false;
+
+    uint64_t feed(uint32_t t) {
+        if (seen && t < last && (uint32_t)(last - t) > 0x80000000u)
+            high += 0x100000000ull;
+        last = t;
+        seen = true;
+        return high | t;
+    }
+    void anchor(uint64_t t64) {
+        high = t64 & ~0xFFFFFFFFull;
+        last = (uint32_t)t64;
+        seen = true;
+    }
+};
+
+// --- Per-unit aggregation (--summary) -----------------------------------
+
+struct SiteLatency {
+    uint32_t count = 0;
+    uint32_t max_us = 0;
+    uint32_t bins[16] = {0};
+};
+
+struct ZoneDuty {
+    uint64_t on_us = 0;
+    uint64_t level_us = 0;
+    uint32_t starts = 0;
+};
+
+struct UnitStats {
+    uint64_t samples = 0;
+    uint64_t deltas = 0;
+    uint64_t seq_lost = 0;
+    uint64_t stale = 0;
+    uint64_t pump_on_cycles = 0;
+    uint64_t fan_on_cycles = 0;
+    double temp_min = 1e9, temp_max = -1e9, temp_sum = 0;
+    double soil_min = 1e9, soil_max = -1e9, soil_sum = 0;
+    uint16_t anom_peak_q8 = 0;
+    int energy_state = -1;                    // -1 = no energy frames seen
+    uint16_t energy_vsys_mv = 0;
+    uint16_t energy_transitions = 0;
+    uint32_t boot_count = 0;
+    bool warm = false;
+    uint8_t reset_cause = 0;
+    uint32_t build_id = 0;
+    std::map<int, SiteLatency> latency;       // last histogram per site
+    std::vector<uint32_t> errors;             // last 0xAD table
+    std::map<int, ZoneDuty> duty;             // summed 0xB4 per zone
+    uint64_t span_first_us = 0, span_last_us = 0;
+    uint32_t wall_s = 0;                      // last sync with valid wall
+};
+
+static uint64_t g_crc_errors = 0;
+static uint64_t g_resync_bytes = 0;
+static bool g_summary = false;
+
+static std::map<std::string, UnitStats> g_units;
+static std::string g_unit = "(unknown)";
+
+static UnitStats& unit(void) {
+    return g_units[g_unit];
+}
+
+// --- Little-endian field reads ------------------------------------------
+
+static uint16_t rd16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t rd64(const uint8_t* p) {
+    return (uint64_t)rd32(p) | ((uint64_t)rd32(p + 4) << 32);
+}
+
+static void tag4(const uint8_t* p, char out[5]) {
+    for (int i = 0; i < 4; i++)
+        out[i] = (p[i] >= 0x20 && p[i] < 0x7F) ? (char)p[i] : '.';
+    out[4] = 0;
+}
+
+// --- Frame length from the shared wire constants ------------------------
+// Returns the full frame length including CRC, 0 when more bytes are
+// needed, -1 when the candidate cannot be a frame (resync).
+
+static long frame_length(const uint8_t* p, size_t avail) {
+    auto var = [&](size_t hdr, size_t count_at, size_t entry,
+                   size_t extra = 0) -> long {
+        if (avail <= count_at) return 0;
+        return (long)(hdr + extra + (size_t)p[count_at] * entry + 2);
+    };
+    switch (p[0]) {
+        case TELEMETRY_SOF:        return sizeof(TelemetryFrame);
+        case TELEMETRY_HEAP_SOF:   return sizeof(HeapFrame);
+        case TELEMETRY_CACHE_SOF:  return sizeof(CacheFrame);
+        case TELEMETRY_POWER_SOF:  return sizeof(PowerFrame);
+        case TELEMETRY_ANOM_SOF:   return sizeof(AnomFrame);
+        case TELEMETRY_TIME_SOF:   return sizeof(TimeSyncFrame);
+        case TELEMETRY_ENERGY_SOF: return sizeof(EnergyFrame);
+        case TELEMETRY_REPLAY_SOF: return sizeof(ReplayRecord);
+        case TELEMETRY_BEACON_SOF: return sizeof(BusBeacon);
+        case TELEMETRY_TIMING_SOF: return TELEMETRY_TIMING_LEN;
+        case TELEMETRY_TASKS_SOF:
+            return var(TELEMETRY_TASKS_HDR, 12, TELEMETRY_TASKS_ENTRY);
+        case TELEMETRY_ERR_SOF:
+            return var(TELEMETRY_ERR_HDR, 8, TELEMETRY_ERR_ENTRY);
+        case TELEMETRY_BOOT_SOF:
+            return var(TELEMETRY_BOOT_HDR, 34, TELEMETRY_BOOT_ENTRY);
+        case TELEMETRY_QUEUE_SOF:
+            return var(TELEMETRY_QUEUE_HDR, 8, TELEMETRY_QUEUE_ENTRY);
+        case TELEMETRY_IDENT_SOF:
+            return var(TELEMETRY_IDENT_HDR, 8, TELEMETRY_IDENT_ENTRY,
+                       TELEMETRY_IDENT_ID);
+        case TELEMETRY_LOCK_SOF:
+            return var(TELEMETRY_LOCK_HDR, 12, TELEMETRY_LOCK_ENTRY);
+        case TELEMETRY_TRACE_SOF:
+            return var(TELEMETRY_TRACE_HDR, 9, TELEMETRY_TRACE_ENTRY);
+        case TELEMETRY_DUTY_SOF:
+            return var(TELEMETRY_DUTY_HDR, 10, TELEMETRY_DUTY_ENTRY);
+        case TELEMETRY_METRICS_SOF:
+            return var(TELEMETRY_METRICS_HDR, 8, TELEMETRY_METRICS_ENTRY);
+        case TELEMETRY_DELTA_SOF: {
+            // Length is data-dependent: one varint per set bitmap bit
+            if (avail < 3) return 0;
+            int fields = __builtin_popcount(p[1]) + __builtin_popcount(p[2]);
+            size_t n = 3;
+            for (int i = 0; i < fields; i++) {
+                uint32_t v;
+                size_t used = telemetry_get_varint(p + n, avail - n, &v);
+                if (used == 0) return (avail - n < 5) ? 0 : -1;
+                n += used;
+            }
+            return (long)(n + 2);
+        }
+        default:
+            return -1;
+    }
+}
+
+// --- Delta reconstruction (0xB2) ----------------------------------------
+// Mirrors delta_encode_sample in telemetry.cpp: implicit seq + 1,
+// second-order timestamp, zigzag varint per set bit, bitmap 1 fields
+// ascending then bitmap 2.
+
+static TelemetryFrame g_prev_sample;
+static bool g_have_sample = false;
+static uint32_t g_prev_tdelta = 0;
+
+static bool delta_apply(const uint8_t* p, size_t len, TelemetryFrame* out) {
+    if (!g_have_sample) return false;  // no keyframe yet: skip
+    TelemetryFrame f = g_prev_sample;
+    f.seq = (uint16_t)(f.seq + 1);
+    uint8_t bm = p[1], bm2 = p[2];
+    size_t n = 3;
+    uint32_t v;
+    auto next = [&](int32_t* d) {
+        size_t used = telemetry_get_varint(p + n, len - n, &v);
+        n += used;
+        *d = telemetry_unzigzag32(v);
+        return used != 0;
+    };
+    int32_t d;
+    if (bm & TELEMETRY_DELTA_TIME) {
+        if (!next(&d)) return false;
+        g_prev_tdelta += (uint32_t)d;
+    }
+    f.t_us += g_prev_tdelta;
+    if (bm & TELEMETRY_DELTA_TEMP)   { if (!next(&d)) return false; f.temp10 = (int16_t)(f.temp10 + d); }
+    if (bm & TELEMETRY_DELTA_HUMID)  { if (!next(&d)) return false; f.humid10 = (uint16_t)(f.humid10 + d); }
+    if (bm & TELEMETRY_DELTA_RAW)    { if (!next(&d)) return false; f.soil_raw = (uint16_t)(f.soil_raw + d); }
+    if (bm & TELEMETRY_DELTA_SOIL)   { if (!next(&d)) return false; f.soil10 = (uint16_t)(f.soil10 + d); }
+    if (bm & TELEMETRY_DELTA_FAN)    { if (!next(&d)) return false; f.fan_level = (uint8_t)(f.fan_level + d); }
+    if (bm & TELEMETRY_DELTA_PUMP)   { if (!next(&d)) return false; f.pump_level = (uint8_t)(f.pump_level + d); }
+    if (bm & TELEMETRY_DELTA_FLAGS)  { if (!next(&d)) return false; f.flags = (uint8_t)(f.flags + d); }
+    if (bm2 & TELEMETRY_DELTA2_FCONF){ if (!next(&d)) return false; f.fan_conf = (int8_t)(f.fan_conf + d); }
+    if (bm2 & TELEMETRY_DELTA2_PCONF){ if (!next(&d)) return false; f.pump_conf = (int8_t)(f.pump_conf + d); }
+    *out = f;
+    g_prev_sample = f;
+    return true;
+}
+
+// --- Sample accounting (raw and reconstructed share this path) ----------
+
+static Unwrap g_clock;
+static uint16_t g_last_seq = 0;
+static bool g_seq_seen = false;
+
+static void account_sample(const TelemetryFrame* f, bool delta) {
+    UnitStats& u = unit();
+    u.samples++;
+    if (delta) u.deltas++;
+    if (g_seq_seen) {
+        uint16_t gap = (uint16_t)(f->seq - g_last_seq);
+        if (gap > 1 && gap < 0x8000) u.seq_lost += gap - 1;
+    }
+    g_last_seq = f->seq;
+    g_seq_seen = true;
+    if (f->flags & (TELEMETRY_STALE_TEMP | TELEMETRY_STALE_HUMID |
+                    TELEMETRY_STALE_SOIL))
+        u.stale++;
+    double t = f->temp10 / 10.0, s = f->soil10 / 10.0;
+    if (t < u.temp_min) u.temp_min = t;
+    if (t > u.temp_max) u.temp_max = t;
+    u.temp_sum += t;
+    if (s < u.soil_min) u.soil_min = s;
+    if (s > u.soil_max) u.soil_max = s;
+    u.soil_sum += s;
+    if (f->fan_level) u.fan_on_cycles++;
+    if (f->pump_level) u.pump_on_cycles++;
+    uint64_t t64 = g_clock.feed(f->t_us);
+    if (u.span_first_us == 0) u.span_first_us = t64;
+    u.span_last_us = t64;
+    if (!g_summary)
+        printf("sample,%u,%" PRIu64 ",%.1f,%.1f,%u,%.1f,%u,%u,%d,%d,%u,%d\n",
+               f->seq, t64, t, f->humid10 / 10.0, f->soil_raw, s,
+               f->fan_level, f->pump_level, f->fan_conf, f->pump_conf,
+               f->flags, delta ? 1 : 0);
+}
+
+// --- Per-frame decode ----------------------------------------------------
+
+static void decode_frame(const uint8_t* p, size_t len) {
+    uint16_t seq = rd16(p + 2);
+    switch (p[0]) {
+        case TELEMETRY_SOF: {
+            TelemetryFrame f;
+            memcpy(&f, p, sizeof(f));
+            g_prev_sample = f;
+            g_have_sample = true;
+            g_prev_tdelta = 0;
+            account_sample(&f, false);
+            break;
+        }
+        case TELEMETRY_DELTA_SOF: {
+            TelemetryFrame f;
+            if (delta_apply(p, len, &f)) account_sample(&f, true);
+            break;
+        }
+        case TELEMETRY_HEAP_SOF: {
+            HeapFrame f;
+            memcpy(&f, p, sizeof(f));
+            uint64_t t64 = g_clock.feed(f.t_us);
+            if (!g_summary)
+                printf("heap,%u,%" PRIu64 ",%u,%u,%u,%u,%u\n", f.seq, t64,
+                       f.free_bytes, f.min_ever_free, f.largest_block,
+                       f.pool_heap_allocs, f.pool_exhausted);
+            break;
+        }
+        case TELEMETRY_CACHE_SOF: {
+            CacheFrame f;
+            memcpy(&f, p, sizeof(f));
+            uint64_t t64 = g_clock.feed(f.t_us);
+            if (!g_summary)
+                printf("cache,%u,%" PRIu64 ",%u,%u,%u,%u\n", f.seq, t64,
+                       f.fan_hits, f.fan_misses, f.pump_hits, f.pump_misses);
+            break;
+        }
+        case TELEMETRY_POWER_SOF: {
+            PowerFrame f;
+            memcpy(&f, p, sizeof(f));
+            uint64_t t64 = g_clock.feed(f.t_us);
+            if (!g_summary)
+                printf("power,%u,%" PRIu64 ",%u,%u,%u,%u\n", f.seq, t64,
+                       f.interval_us, f.idle_us, f.idle_permille, f.wakes);
+            break;
+        }
+        case TELEMETRY_ENERGY_SOF: {
+            EnergyFrame f;
+            memcpy(&f, p, sizeof(f));
+            uint64_t t64 = g_clock.feed(f.t_us);
+            UnitStats& u = unit();
+            u.energy_state = f.state;
+            u.energy_vsys_mv = f.vsys_mv;
+            u.energy_transitions = f.transitions;
+            if (!g_summary)
+                printf("energy,%u,%" PRIu64 ",%u,%u,%u,%u,%u\n", f.seq, t64,
+                       f.vsys_mv, f.state, f.actions, f.transitions, f.est_mw);
+            break;
+        }
+        case TELEMETRY_REPLAY_SOF: {
+            ReplayRecord f;
+            memcpy(&f, p, sizeof(f));
+            if (!g_summary) {
+                printf("replay,%u,%u,%d,%d,", f.cycle_seq, f.t_ms,
+                       f.temp10, f.humid10);
+                for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++)
+                    printf("%d:%d:%d,", f.soil_raw[z], f.soil_pct10[z],
+                           f.soil_slope10[z]);
+                printf("%d,%u,%u,%u,%u,%d>%u,", f.hour10, f.stale_mask,
+                       f.missed, f.fan_bank_seq, f.pump_bank_seq,
+                       f.fan_model, f.fan_commit);
+                for (int z = 0; z < TELEMETRY_REPLAY_ZONES; z++)
+                    printf("%d>%u%c", f.pump_model[z], f.pump_commit[z],
+                           z + 1 < TELEMETRY_REPLAY_ZONES ? ',' : '\n');
+            }
+            break;
+        }
+        case TELEMETRY_BEACON_SOF: {
+            BusBeacon f;
+            memcpy(&f, p, sizeof(f));
+            if (!g_summary)
+                printf("beacon,%u,%" PRIu64 ",%u,%u\n", f.seq, f.t_us,
+                       f.units, f.window_ms);
+            break;
+        }
+        case TELEMETRY_ANOM_SOF: {
+            AnomFrame f;
+            memcpy(&f, p, sizeof(f));
+            uint64_t t64 = g_clock.feed(f.t_us);
+            UnitStats& u = unit();
+            if (f.score_q8 > u.anom_peak_q8) u.anom_peak_q8 = f.score_q8;
+            if (!g_summary)
+                printf("anom,%u,%" PRIu64 ",%.3f,%.3f\n", f.seq, t64,
+                       f.score_q8 / 256.0, f.threshold_q8 / 256.0);
+            break;
+        }
+        case TELEMETRY_TIME_SOF: {
+            TimeSyncFrame f;
+            memcpy(&f, p, sizeof(f));
+            g_clock.anchor(f.t_us);
+            if (f.wall_valid) unit().wall_s = f.wall_s;
+            if (!g_summary)
+                printf("timesync,%u,%" PRIu64 ",%u,%u\n", f.seq, f.t_us,
+                       f.wall_s, f.wall_valid);
+            break;
+        }
+        case TELEMETRY_TIMING_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int site = p[8];
+            SiteLatency& l = unit().latency[site];
+            l.count = rd32(p + 10);
+            l.max_us = rd32(p + 14);
+            for (int b = 0; b < 16; b++) l.bins[b] = rd16(p + 18 + 2 * b);
+            if (!g_summary) {
+                printf("timing,%u,%" PRIu64 ",%d,%u,%u", seq, t64, site,
+                       l.count, l.max_us);
+                for (int b = 0; b < 16; b++) printf(",%u", l.bins[b]);
+                printf("\n");
+            }
+            break;
+        }
+        case TELEMETRY_TASKS_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            uint32_t interval = rd32(p + 8);
+            int n = p[12];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_TASKS_HDR +
+                                   i * TELEMETRY_TASKS_ENTRY;
+                char name[5];
+                tag4(e, name);
+                if (!g_summary)
+                    printf("task,%u,%" PRIu64 ",%u,%s,%u,%u,%u\n", seq, t64,
+                           interval, name, e[4], rd16(e + 5), rd16(e + 7));
+            }
+            break;
+        }
+        case TELEMETRY_ERR_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int n = p[8];
+            UnitStats& u = unit();
+            u.errors.assign(n, 0);
+            for (int i = 0; i < n; i++)
+                u.errors[i] = rd32(p + TELEMETRY_ERR_HDR +
+                                   i * TELEMETRY_ERR_ENTRY);
+            if (!g_summary) {
+                printf("errors,%u,%" PRIu64, seq, t64);
+                for (int i = 0; i < n; i++) printf(",%u", u.errors[i]);
+                printf("\n");
+            }
+            break;
+        }
+        case TELEMETRY_BOOT_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            UnitStats& u = unit();
+            u.boot_count = rd32(p + 8);
+            u.warm = p[12] != 0;
+            u.reset_cause = p[13];
+            u.build_id = rd32(p + 14);
+            if (!g_summary)
+                printf("bootinfo,%u,%" PRIu64
+                       ",%u,%u,%u,%08x,%08x,%08x,%u,%u\n",
+                       seq, t64, u.boot_count, u.warm, u.reset_cause,
+                       u.build_id, rd32(p + 18), rd32(p + 22),
+                       rd32(p + 26), rd32(p + 30));
+            int n = p[34];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_BOOT_HDR +
+                                   i * TELEMETRY_BOOT_ENTRY;
+                char name[5];
+                tag4(e, name);
+                if (!g_summary)
+                    printf("boot,%u,%" PRIu64 ",%u,%u,%s,%u\n", seq, t64,
+                           u.boot_count, u.warm, name, rd32(e + 4));
+            }
+            break;
+        }
+        case TELEMETRY_QUEUE_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int n = p[8];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_QUEUE_HDR +
+                                   i * TELEMETRY_QUEUE_ENTRY;
+                char name[5];
+                tag4(e, name);
+                if (!g_summary)
+                    printf("queue,%u,%" PRIu64 ",%s,%u,%u,%u,%u,%u\n", seq,
+                           t64, name, e[4], e[5], rd16(e + 6), rd16(e + 8),
+                           rd32(e + 10));
+            }
+            break;
+        }
+        case TELEMETRY_LOCK_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            uint32_t inherits = rd32(p + 8);
+            int n = p[12];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_LOCK_HDR +
+                                   i * TELEMETRY_LOCK_ENTRY;
+                char name[5];
+                tag4(e, name);
+                if (!g_summary)
+                    printf("lock,%u,%" PRIu64 ",%u,%s,%u,%u,%u,%u\n", seq,
+                           t64, inherits, name, rd32(e + 4), rd32(e + 8),
+                           rd32(e + 12), rd32(e + 16));
+            }
+            break;
+        }
+        case TELEMETRY_TRACE_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int reason = p[8];
+            int n = p[9];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_TRACE_HDR +
+                                   i * TELEMETRY_TRACE_ENTRY;
+                if (!g_summary)
+                    printf("trace,%u,%" PRIu64 ",%d,%u,%u,%u\n", seq, t64,
+                           reason, e[0], rd32(e + 1), rd32(e + 5));
+            }
+            break;
+        }
+        case TELEMETRY_DUTY_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            uint16_t day = rd16(p + 8);
+            int n = p[10];
+            UnitStats& u = unit();
+            for (int z = 0; z < n; z++) {
+                const uint8_t* e = p + TELEMETRY_DUTY_HDR +
+                                   z * TELEMETRY_DUTY_ENTRY;
+                ZoneDuty& d = u.duty[z];
+                d.on_us += rd64(e);
+                d.level_us += rd64(e + 8);
+                d.starts += rd32(e + 16);
+                if (!g_summary)
+                    printf("duty,%u,%" PRIu64 ",%u,%d,%" PRIu64 ",%" PRIu64
+                           ",%u\n", seq, t64, day, z, rd64(e), rd64(e + 8),
+                           rd32(e + 16));
+            }
+            break;
+        }
+        case TELEMETRY_METRICS_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int n = p[8];
+            for (int i = 0; i < n; i++) {
+                const uint8_t* e = p + TELEMETRY_METRICS_HDR +
+                                   i * TELEMETRY_METRICS_ENTRY;
+                // Metrics are keyed by name hash on the wire; the
+                // shell's "metrics" dump is the dictionary.
+                if (!g_summary)
+                    printf("metric,%u,%" PRIu64 ",%08x,%u,%u\n", seq, t64,
+                           rd32(e), e[4], rd32(e + 5));
+            }
+            break;
+        }
+        case TELEMETRY_IDENT_SOF: {
+            uint64_t t64 = g_clock.feed(rd32(p + 4));
+            int n = p[8];
+            char id[2 * TELEMETRY_IDENT_ID + 1];
+            for (int i = 0; i < TELEMETRY_IDENT_ID; i++)
+                snprintf(id + 2 * i, 3, "%02x", p[9 + i]);
+            // Attribution switch: everything after this frame belongs
+            // to this unit (interleaved multi-unit captures re-ident
+            // every snapshot batch).
+            g_unit = id;
+            if (!g_summary) {
+                printf("ident,%u,%" PRIu64 ",%s", seq, t64, id);
+                for (int s = 0; s < n; s++)
+                    printf(",%u", rd32(p + TELEMETRY_IDENT_HDR +
+                                       TELEMETRY_IDENT_ID +
+                                       s * TELEMETRY_IDENT_ENTRY));
+                printf("\n");
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// --- Summary report ------------------------------------------------------
+
+// Approximate percentile from the log2 histogram: the upper edge of
+// the bin where the cumulative count crosses (bin k covers
+// [2^(k-1), 2^k) us), matching the shell's own "timing" rendering.
+static uint32_t bins_percentile(const SiteLatency& l, int pct) {
+    uint64_t total = 0;
+    for (int b = 0; b < 16; b++) total += l.bins[b];
+    if (total == 0) return 0;
+    uint64_t target = (total * pct + 99) / 100;
+    uint64_t cum = 0;
+    for (int b = 0; b < 16; b++) {
+        cum += l.bins[b];
+        if (cum >= target) return 1u << b;
+    }
+    return l.max_us;
+}
+
+static void print_summary(void) {
+    for (const auto& kv : g_units) {
+        const UnitStats& u = kv.second;
+        if (u.samples == 0 && u.errors.empty() && u.latency.empty())
+            continue;
+        printf("unit %s\n", kv.first.c_str());
+        if (u.boot_count) {
+            static const char* kCause[] = {"unknown",  "power-on", "run-pin",
+                                           "debugger", "watchdog", "soft-reboot"};
+            printf("  boot %u (%s start, %s), build %08x\n", u.boot_count,
+                   u.warm ? "warm" : "cold",
+                   kCause[u.reset_cause < 6 ? u.reset_cause : 0], u.build_id);
+        }
+        if (u.span_last_us > u.span_first_us)
+            printf("  span %.1f h%s\n",
+                   (u.span_last_us - u.span_first_us) / 3.6e9,
+                   u.wall_s ? " (wall-clock synced)" : "");
+        if (u.samples) {
+            printf("  samples %" PRIu64 " (%" PRIu64 " delta), lost %" PRIu64
+                   " (%.2f%%), stale %" PRIu64 "\n",
+                   u.samples, u.deltas, u.seq_lost,
+                   100.0 * u.seq_lost / (u.samples + u.seq_lost), u.stale);
+            printf("  temp %.1f..%.1f C (mean %.1f), soil %.1f..%.1f %% "
+                   "(mean %.1f)\n",
+                   u.temp_min, u.temp_max, u.temp_sum / u.samples,
+                   u.soil_min, u.soil_max, u.soil_sum / u.samples);
+            printf("  fan on %.1f%% of cycles, pump on %.1f%%\n",
+                   100.0 * u.fan_on_cycles / u.samples,
+                   100.0 * u.pump_on_cycles / u.samples);
+        }
+        for (const auto& s : u.latency)
+            printf("  latency site %d: n %u, p50 <= %u us, p95 <= %u us, "
+                   "max %u us\n",
+                   s.first, s.second.count, bins_percentile(s.second, 50),
+                   bins_percentile(s.second, 95), s.second.max_us);
+        if (!u.errors.empty()) {
+            printf("  errors");
+            for (size_t i = 0; i < u.errors.size(); i++)
+                printf(" [%zu]=%u", i, u.errors[i]);
+            printf("\n");
+        }
+        for (const auto& z : u.duty)
+            printf("  zone %d duty: on %.1f min, %u starts\n", z.first,
+                   z.second.on_us / 6e7, z.second.starts);
+        if (u.anom_peak_q8)
+            printf("  anomaly peak %.3f\n", u.anom_peak_q8 / 256.0);
+        if (u.energy_state >= 0) {
+            static const char* kEnergy[] = {"ok", "saver", "critical"};
+            printf("  energy %s (vsys %u mV, %u transitions)\n",
+                   kEnergy[u.energy_state < 3 ? u.energy_state : 0],
+                   u.energy_vsys_mv, u.energy_transitions);
+        }
+    }
+    fprintf(stderr, "stream: %" PRIu64 " CRC failures, %" PRIu64
+            " bytes skipped in resync\n", g_crc_errors, g_resync_bytes);
+}
+
+// --- Scanner: CRC-gated demux with byte-wise resync ----------------------
+
+static void scan(const std::vector<uint8_t>& data) {
+    size_t pos = 0;
+    while (pos < data.size()) {
+        const uint8_t* p = data.data() + pos;
+        size_t avail = data.size() - pos;
+        long len = frame_length(p, avail);
+        if (len > 0 && (size_t)len <= avail &&
+            rd16(p + len - 2) == telemetry_crc16(p, (size_t)len - 2)) {
+            decode_frame(p, (size_t)len);
+            pos += (size_t)len;
+            continue;
+        }
+        if (len > 0 && (size_t)len > avail)
+            break;  // truncated trailing frame
+        if (len == 0)
+            break;  // count byte past end of input
+        // Not a frame here (or CRC refused it): slide one byte. Only
+        // candidates that looked like frames count as CRC failures.
+        if (len > 0)
+            g_crc_errors++;
+        g_resync_bytes++;
+        pos++;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--summary") == 0) {
+            g_summary = true;
+        } else if (strcmp(argv[i], "--help") == 0) {
+            printf("usage: qdnn_telemetry [--summary] [file ...]\n"
+                   "  decodes a captured telemetry byte stream (stdin when\n"
+                   "  no file is named) to CSV rows, or to per-unit fleet\n"
+                   "  summaries with --summary\n");
+            return 0;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    std::vector<uint8_t> data;
+    if (files.empty()) {
+        if (!read_stream(stdin, &data)) {
+            fprintf(stderr, "read error on stdin\n");
+            return 1;
+        }
+    }
+    for (const char* name : files) {
+        FILE* f = fopen(name, "rb");
+        if (!f) {
+            fprintf(stderr, "cannot open %s\n", name);
+            return 1;
+        }
+        bool ok = read_stream(f, &data);
+        fclose(f);
+        if (!ok) {
+            fprintf(stderr, "read error on %s\n", name);
+            return 1;
+        }
+    }
+
+    scan(data);
+
+    if (g_summary)
+        print_summary();
+    else
+        fprintf(stderr, "stream: %" PRIu64 " CRC failures, %" PRIu64
+                " bytes skipped in resync\n", g_crc_errors, g_resync_bytes);
+    return 0;
+}
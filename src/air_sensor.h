@@ -0,0 +1,62 @@
+/**
+ * @file air_sensor.h
+ *
+ * @brief Air temperature/humidity source, backend selected at compile time
+ *
+ * The input-assembly stage consumes this header instead of a concrete
+ * driver, so swapping the DHT11 for the SHT41 on the next board spin is
+ * a build option, not a code change. Both backends share the async
+ * begin/poll shape, deci-unit integer values, the -999 error value and
+ * the last-good cache; this header only papers over the names. The pin
+ * argument is the DHT11's data pin and is ignored by the I2C backend,
+ * which takes its bus pins from sht4x.h.
+ */
+
+#ifndef AIR_SENSOR_H
+#define AIR_SENSOR_H
+
+#include "pico/stdlib.h"
+
+#if QDNN_SHT4X
+
+#include "sht4x.h"
+
+#define AIR_READ_PENDING SHT4X_READ_PENDING
+#define AIR_READ_ERROR   SHT4X_READ_ERROR
+
+static inline void air_sensor_init(uint pin) {
+    (void)pin;
+    sht4x_init();
+}
+
+static inline void air_sensor_begin(uint pin) {
+    (void)pin;
+    sht4x_read_begin();
+}
+
+static inline int air_sensor_poll(int *temp10, int *rh10) {
+    return sht4x_read_poll(temp10, rh10);
+}
+
+#else  // DHT11, the shipping sensor
+
+#include "dht11-pico.h"
+
+#define AIR_READ_PENDING DHT11_READ_PENDING
+#define AIR_READ_ERROR   TRANSMISSION_ERROR
+
+static inline void air_sensor_init(uint pin) {
+    dht11_init(pin);
+}
+
+static inline void air_sensor_begin(uint pin) {
+    dht11_read_begin(pin);
+}
+
+static inline int air_sensor_poll(int *temp10, int *rh10) {
+    return dht11_read_poll(temp10, rh10);
+}
+
+#endif
+
+#endif
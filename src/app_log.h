@@ -0,0 +1,36 @@
+/**
+ * @file app_log.h
+ *
+ * @brief Leveled application logging for the QDNN_AIOT firmware
+ *
+ * Thin front-end over the logging stack already shipped in
+ * port/FreeRTOS-Kernel (logging_levels.h / logging_stack.h). Including
+ * this header provides LogError/LogWarn/LogInfo/LogDebug macros whose
+ * bodies compile out entirely below the configured level, so debug
+ * output costs nothing in release builds.
+ *
+ * The level is set project-wide with the QDNN_LOG_LEVEL CMake cache
+ * variable (passed through as LIBRARY_LOG_LEVEL); the defaults below
+ * apply when the build does not define it.
+ */
+
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include "logging_levels.h"
+
+#ifndef LIBRARY_LOG_NAME
+    #define LIBRARY_LOG_NAME    "QDNN"
+#endif
+
+#ifndef LIBRARY_LOG_LEVEL
+    #ifdef NDEBUG
+        #define LIBRARY_LOG_LEVEL    LOG_ERROR
+    #else
+        #define LIBRARY_LOG_LEVEL    LOG_DEBUG
+    #endif
+#endif
+
+#include "logging_stack.h"
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file board_profile.h
+ *
+ * @brief Compile-time pin maps for the supported board revisions
+ *
+ * One constexpr BoardProfile per revision, selected with
+ * -DQDNN_BOARD=<rev> at configure time. Everything derived from the
+ * map - zone count, GPIO masks, the per-level bar-graph value words -
+ * is folded at compile time, so a per-revision binary carries no
+ * runtime pin lookup and the mask-write actuation path stays a single
+ * SIO store. Adding a revision means adding one table here, not
+ * patching a source tree.
+ */
+
+#ifndef BOARD_PROFILE_H
+#define BOARD_PROFILE_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Widest zone table any revision may declare.
+ *
+ * Matches SOIL_ADC_MAX_CHANNELS: the on-chip ADC (GPIO 26-28) is the
+ * binding limit on every revision to date.
+ */
+#define BOARD_MAX_ZONES 3
+
+/**
+ * @brief One board revision's complete pin map.
+ *
+ * Tables are sized for BOARD_MAX_ZONES; entries past num_zones are
+ * zero-filled and never touched at runtime.
+ */
+struct BoardProfile {
+    uint dht_pin;
+    uint led_dht_error;
+    uint fan_pins[4];
+    int  num_zones;
+    uint soil_adc_pins[BOARD_MAX_ZONES];
+    uint pump_pins[BOARD_MAX_ZONES][4];
+};
+
+// rev A: bench bring-up board. Single zone, bar-graph LED banks,
+// probe on ADC0. This is the map the tree shipped with before the
+// profiles existed, and the default.
+inline constexpr BoardProfile kBoardRevA = {
+    /* dht_pin       */ 3,
+    /* led_dht_error */ 18,
+    /* fan_pins      */ {10, 11, 12, 13},
+    /* num_zones     */ 1,
+    /* soil_adc_pins */ {26, 0, 0},
+    /* pump_pins     */ {{14, 15, 16, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},
+};
+
+// rev B: three-zone field carrier. All three ADC inputs populated,
+// fan bank moved down to free GPIO 26-28's neighbours for the probe
+// headers, DHT on GPIO 2 next to the sensor connector.
+inline constexpr BoardProfile kBoardRevB = {
+    /* dht_pin       */ 2,
+    /* led_dht_error */ 22,
+    /* fan_pins      */ {6, 7, 8, 9},
+    /* num_zones     */ 3,
+    /* soil_adc_pins */ {26, 27, 28},
+    /* pump_pins     */ {{10, 11, 12, 13}, {14, 15, 16, 17}, {18, 19, 20, 21}},
+};
+
+// rev C: two-zone Pico W stack (pairs with QDNN_PICO_W). Same bank
+// layout as rev B minus zone 2; GPIO 0/1 stay free for the UART
+// telemetry path and the cyw43-internal pins are not in any table.
+inline constexpr BoardProfile kBoardRevC = {
+    /* dht_pin       */ 2,
+    /* led_dht_error */ 22,
+    /* fan_pins      */ {6, 7, 8, 9},
+    /* num_zones     */ 2,
+    /* soil_adc_pins */ {26, 27, 0},
+    /* pump_pins     */ {{10, 11, 12, 13}, {14, 15, 16, 17}, {0, 0, 0, 0}},
+};
+
+#if defined(QDNN_BOARD_REV_C)
+inline constexpr BoardProfile kBoard = kBoardRevC;
+#elif defined(QDNN_BOARD_REV_B)
+inline constexpr BoardProfile kBoard = kBoardRevB;
+#else
+inline constexpr BoardProfile kBoard = kBoardRevA;
+#endif
+
+/**
+ * @brief Precomputed bar-graph bank: pin mask plus one GPIO value word
+ *        per level (0..4 LEDs lit).
+ *
+ * Built once at compile time from a profile's pin table; the runtime
+ * commit is value[level] and a single gpio_put_masked(), no loop.
+ */
+struct LedBank {
+    uint32_t mask;
+    uint32_t value[5];
+};
+
+constexpr LedBank board_led_bank(const uint (&pins)[4]) {
+    LedBank b = {0, {0, 0, 0, 0, 0}};
+    for (int i = 0; i < 4; i++) {
+        b.mask |= 1u << pins[i];
+        for (int level = i + 1; level <= 4; level++)
+            b.value[level] |= 1u << pins[i];
+    }
+    return b;
+}
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file boot_ladder.cpp
+ *
+ * @brief Degradation ladder implementation
+ *
+ * State lives in a warm_state slot: it survives exactly the watchdog
+ * resets being counted and vanishes on power-on, so a power cycle is
+ * the built-in full reset. Only deliberate watchdog expiries count as
+ * strikes (watchdog_enable_caused_reboot()); forced reboots - firmware
+ * trials, the shell's reset - never climb the ladder.
+ */
+
+#include "boot_ladder.h"
+
+#include <string.h>
+
+#include "hardware/watchdog.h"
+
+#include "app_log.h"
+#include "warm_state.h"
+
+struct LadderState {
+    uint32_t strikes;
+    uint32_t level;
+    uint32_t entered_boot[LADDER_STEP_MAX];  // 0 = step never engaged
+};
+
+static LadderState s_ladder;
+
+static const char* const kStepName[LADDER_STEP_MAX] = {
+    "model banks", "shadow eval", "telemetry", "inference",
+};
+
+static void ladder_save(void) {
+    warm_state_save(WARM_SLOT_LADDER, &s_ladder, sizeof(s_ladder));
+}
+
+void boot_ladder_init(void) {
+    if (!warm_state_restore(WARM_SLOT_LADDER, &s_ladder, sizeof(s_ladder)))
+        memset(&s_ladder, 0, sizeof(s_ladder));
+
+    if (watchdog_enable_caused_reboot()) {
+        s_ladder.strikes++;
+        // First step after QDNN_LADDER_STRIKES crashes, one more step
+        // per further crash, floor at the hardcoded policy.
+        uint32_t want = 0;
+        if (s_ladder.strikes >= QDNN_LADDER_STRIKES)
+            want = 1 + (s_ladder.strikes - QDNN_LADDER_STRIKES);
+        if (want > LADDER_STEP_MAX) want = LADDER_STEP_MAX;
+        while (s_ladder.level < want) {
+            s_ladder.level++;
+            s_ladder.entered_boot[s_ladder.level - 1] = warm_state_boot_count();
+            LogWarn(("ladder: %u crash(es) - step %u, %s disabled",
+                     (unsigned)s_ladder.strikes, (unsigned)s_ladder.level,
+                     kStepName[s_ladder.level - 1]));
+        }
+    }
+    ladder_save();
+    if (s_ladder.level > 0)
+        LogWarn(("ladder: running degraded at level %u (\"ladder clear\" "
+                 "or power cycle to restore)", (unsigned)s_ladder.level));
+}
+
+int boot_ladder_level(void) {
+    return (int)s_ladder.level;
+}
+
+uint32_t boot_ladder_strikes(void) {
+    return s_ladder.strikes;
+}
+
+bool boot_ladder_allows(int step) {
+    return (int)s_ladder.level < step;
+}
+
+uint32_t boot_ladder_entered_boot(int step) {
+    if (step < 1 || step > LADDER_STEP_MAX) return 0;
+    return s_ladder.entered_boot[step - 1];
+}
+
+void boot_ladder_mark_healthy(void) {
+    if (s_ladder.strikes == 0) return;
+    s_ladder.strikes = 0;
+    ladder_save();
+}
+
+void boot_ladder_clear(void) {
+    memset(&s_ladder, 0, sizeof(s_ladder));
+    ladder_save();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file boot_ladder.h
+ *
+ * @brief Crash-loop detection with a progressive degradation ladder
+ *
+ * A config or model bad enough to crash every boot used to produce an
+ * endless watchdog reset loop at full actuation risk: each boot armed
+ * everything again, crashed again, and the crops saw a pump controller
+ * that was mostly rebooting. This module counts strikes - watchdog
+ * resets that fired before the controller proved itself healthy - in
+ * the reset-retained warm region, and past QDNN_LADDER_STRIKES each
+ * further crash climbs one ladder step, shedding the most likely (and
+ * least essential) culprit first:
+ *
+ *   1  uploaded model banks ignored, compiled-in models only
+ *   2  shadow-model evaluation off
+ *   3  telemetry frames muted (the human-readable log keeps flowing)
+ *   4  inference bypassed: hardcoded threshold policy (control_logic.h)
+ *
+ * A degraded-but-running controller keeps irrigating; every step entry
+ * is logged and stamped with the boot number for the postmortem. The
+ * report task marks the run healthy after QDNN_LADDER_HEALTHY_CYCLES
+ * committed decisions, which clears the strikes; the reached level
+ * latches until the operator clears it ("ladder clear") or the unit
+ * power-cycles (a cold boot invalidates the warm region).
+ */
+
+#ifndef BOOT_LADDER_H
+#define BOOT_LADDER_H
+
+#include "pico/stdlib.h"
+
+/** @brief Ladder steps; a subsystem at step s runs while level < s. */
+enum LadderStep {
+    LADDER_BANK = 1,    ///< uploaded model banks
+    LADDER_SHADOW = 2,  ///< shadow-model evaluation
+    LADDER_TELEM = 3,   ///< binary telemetry frames
+    LADDER_POLICY = 4,  ///< model inference itself
+};
+#define LADDER_STEP_MAX 4
+
+#ifndef QDNN_LADDER_STRIKES
+#define QDNN_LADDER_STRIKES 3  ///< crashes before the first step engages
+#endif
+#ifndef QDNN_LADDER_HEALTHY_CYCLES
+#define QDNN_LADDER_HEALTHY_CYCLES 10  ///< committed decisions = healthy
+#endif
+
+/**
+ * @brief Restore the ladder and score this boot. Call once, early in
+ *        main(), after warm_state_init().
+ */
+void boot_ladder_init(void);
+
+/** @brief Current degradation level (0 = everything on). */
+int boot_ladder_level(void);
+
+/** @brief Crashes since the last healthy run. */
+uint32_t boot_ladder_strikes(void);
+
+/** @brief True while the subsystem at @p step may run. */
+bool boot_ladder_allows(int step);
+
+/**
+ * @brief Boot number at which @p step engaged, 0 if it never did.
+ */
+uint32_t boot_ladder_entered_boot(int step);
+
+/**
+ * @brief The controller survived long enough: clear the strikes.
+ *        The level stays latched. Report task, after the healthy
+ *        cycle threshold; cheap to call repeatedly.
+ */
+void boot_ladder_mark_healthy(void);
+
+/** @brief Operator reset: clear strikes, level and history. */
+void boot_ladder_clear(void);
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @file boot_stages.cpp
+ *
+ * @brief Boot stage timing implementation
+ */
+
+#include "boot_stages.h"
+
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+static const char* s_tag[BOOT_STAGE_MAX];
+static uint32_t s_us[BOOT_STAGE_MAX];
+static volatile int s_count = 0;
+static spin_lock_t* s_lock = NULL;
+
+void boot_stages_init(void) {
+    s_lock = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+void boot_stages_mark(const char* tag) {
+    uint32_t now = time_us_32();
+    // Marks arrive from both cores during bring-up (core 1's model
+    // setup races main()); same spinlock discipline as err_stats.
+    uint32_t save = 0;
+    if (s_lock != NULL) save = spin_lock_blocking(s_lock);
+    if (s_count < BOOT_STAGE_MAX) {
+        s_tag[s_count] = tag;
+        s_us[s_count] = now;
+        s_count = s_count + 1;
+    }
+    if (s_lock != NULL) spin_unlock(s_lock, save);
+}
+
+int boot_stages_count(void) {
+    return s_count;
+}
+
+const char* boot_stages_tag(int i) {
+    if (i < 0 || i >= s_count) return "?";
+    return s_tag[i];
+}
+
+uint32_t boot_stages_us(int i) {
+    if (i < 0 || i >= s_count) return 0;
+    return s_us[i];
+}
@@ -0,0 +1,59 @@
+/**
+ * @file boot_stages.h
+ *
+ * @brief Per-stage boot timing record for the staged init sequence
+ *
+ * Boot used to be one opaque stretch between reset and the first
+ * control decision - when cold-boot latency regressed there was no way
+ * to see which stage grew. Each init stage now marks its completion
+ * here; a mark stores the stage tag and its completion time since
+ * reset, so the table reads as a waterfall with overlapping stages
+ * (core 1's model setup runs concurrent with main()'s sequence)
+ * represented faithfully. Marks come from both cores, hence the same
+ * hardware spinlock discipline as the error counters. The finished
+ * table ships once in the boot telemetry frame (0xAE) after the first
+ * decision.
+ */
+
+#ifndef BOOT_STAGES_H
+#define BOOT_STAGES_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Table capacity; later marks past this are dropped silently.
+ */
+#define BOOT_STAGE_MAX 16
+
+/**
+ * @brief Claim the spinlock. Call first thing in main(), before any mark.
+ */
+void boot_stages_init(void);
+
+/**
+ * @brief Record that the named stage just completed.
+ *
+ * Stages that overlap background work - a CRC sweep on the DMA
+ * sniffer, core 1's AllocateTensors - mark when their wait actually
+ * ends, so the decoder can separate critical-path time from hidden
+ * work. Tags are truncated to four characters in the telemetry frame;
+ * keep them that short.
+ */
+void boot_stages_mark(const char* tag);
+
+/**
+ * @brief Number of stages recorded so far.
+ */
+int boot_stages_count(void);
+
+/**
+ * @brief Tag of one recorded stage.
+ */
+const char* boot_stages_tag(int i);
+
+/**
+ * @brief Completion time (us since reset) of one recorded stage.
+ */
+uint32_t boot_stages_us(int i);
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * @file brownout.cpp
+ *
+ * @brief Supply-sag trip path implementation
+ *
+ * Everything on the trip path is RAM-resident arithmetic and GPIO/DMA
+ * register writes: no flash, no logging, no locks beyond the IRQ-off
+ * windows the checkpoint already takes. Console visibility comes from
+ * the err_stats counter and the shell's stats line, not from printing
+ * inside a collapsing-supply IRQ.
+ */
+
+#include "brownout.h"
+
+#include "err_stats.h"
+#include "soil_adc.h"
+#if QDNN_PUMP_DUTY
+#include "pump_duty.h"
+#endif
+#include "app_log.h"
+
+// ADC3 reads VSYS/3 against the 3.3 V reference: mv = raw * 9900/4096.
+static inline uint32_t raw_to_mv(uint32_t raw) { return raw * 9900u / 4096u; }
+static inline uint16_t mv_to_raw(uint32_t mv) { return (uint16_t)(mv * 4096u / 9900u); }
+
+static BrownoutSafeFn s_safe_fn;
+static volatile uint32_t s_trips;
+
+static void brownout_trip(uint16_t raw) {
+    (void)raw;
+    // Shed the load first: the pumps caused the sag, and dropping them
+    // is what buys the rest of this handler its hold-up time.
+    if (s_safe_fn != NULL) s_safe_fn();
+#if QDNN_PUMP_DUTY
+    pump_duty_checkpoint();
+#endif
+    err_stats_bump(ERR_BROWNOUT);
+    s_trips = s_trips + 1;
+}
+
+void brownout_init(BrownoutSafeFn safe_fn) {
+    s_safe_fn = safe_fn;
+#if QDNN_PUMP_DUTY
+    if (pump_duty_restore())
+        LogInfo(("brownout: duty accounting restored from checkpoint"));
+#endif
+    soil_adc_set_vsys_alert(mv_to_raw(BROWNOUT_VSYS_MV),
+                            (uint16_t)(mv_to_raw(BROWNOUT_HYST_MV)),
+                            BROWNOUT_DEBOUNCE_SWEEPS, brownout_trip);
+    LogInfo(("brownout: armed at %u mV (vsys now %lu mV)",
+             (unsigned)BROWNOUT_VSYS_MV, (unsigned long)brownout_vsys_mv()));
+}
+
+uint32_t brownout_count(void) {
+    return s_trips;
+}
+
+uint32_t brownout_vsys_mv(void) {
+    return raw_to_mv(soil_adc_read_vsys_raw());
+}
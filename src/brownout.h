@@ -0,0 +1,72 @@
+/**
+ * @file brownout.h
+ *
+ * @brief Supply-sag detection with an emergency state commit
+ *
+ * Pump inrush on a weak field supply sags VSYS; when the dip reaches
+ * the RP2040's brown-out detector the chip resets mid-cycle, losing
+ * the duty accounting and the datalog tail that were waiting for the
+ * next idle-window flash commit. The BOD itself gives no warning - it
+ * resets - so detection rides the spare slot on the ADC round-robin
+ * scanner (ADC3, the board's VSYS/3 divider): the sampler IRQ watches
+ * the raw per-sweep value and fires once a debounced sag is confirmed,
+ * which is milliseconds before the BOD threshold on a capacitor-held
+ * rail.
+ *
+ * The trip path runs entirely from the sampler IRQ within the hold-up
+ * window: actuators to safe state (dropping the inrush load is itself
+ * the best chance of riding the sag out), then the duty accumulators
+ * checkpointed into the reset-retained region. The datalog tail needs
+ * no action here - its staging buffer already lives in that region
+ * (datalog.cpp) - so accounting integrity survives the power event
+ * without a single extra flash sync in steady state. If the supply
+ * recovers without a reset, the watermark re-arms and the next control
+ * cycle restores the actuator levels on its own.
+ *
+ * Enabled with QDNN_BROWNOUT; expects soil_adc_init() to have been
+ * called with vsys scanning on.
+ */
+
+#ifndef BROWNOUT_H
+#define BROWNOUT_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Trip threshold on VSYS, millivolts.
+ *
+ * Default sits between the pump-inrush dips a healthy supply shrugs
+ * off (~4.6 V) and the BOD reset region; override from the build for
+ * boards with other input stages.
+ */
+#ifndef BROWNOUT_VSYS_MV
+#define BROWNOUT_VSYS_MV 4300
+#endif
+
+/** @brief Re-arm margin above the threshold, millivolts. */
+#define BROWNOUT_HYST_MV 200
+
+/** @brief Consecutive sweeps below threshold before tripping. */
+#define BROWNOUT_DEBOUNCE_SWEEPS 2
+
+/**
+ * @brief Safe-state hook, called first on a trip. IRQ context.
+ */
+typedef void (*BrownoutSafeFn)(void);
+
+/**
+ * @brief Arm the VSYS watermark and restore any prior checkpoint.
+ *
+ * Call once at boot, after soil_adc_init() and warm_state_init() and
+ * before the control tasks start; a duty checkpoint left by a prior
+ * brown-out (or any reset) is adopted here.
+ */
+void brownout_init(BrownoutSafeFn safe_fn);
+
+/** @brief Trips since boot (a ride-through leaves the unit running). */
+uint32_t brownout_count(void);
+
+/** @brief Current filtered VSYS estimate in millivolts (0 = no data). */
+uint32_t brownout_vsys_mv(void);
+
+#endif
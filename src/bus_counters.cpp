@@ -0,0 +1,28 @@
+/**
+ * @file bus_counters.cpp
+ *
+ * @brief Hardware performance counter sampling implementation
+ */
+
+#include "bus_counters.h"
+
+#include "hardware/structs/busctrl.h"
+#include "hardware/structs/xip_ctrl.h"
+
+void bus_counters_begin(const BusPerfEvent events[4]) {
+    for (int i = 0; i < 4; i++) {
+        busctrl_hw->counter[i].sel = (uint32_t)events[i];
+        busctrl_hw->counter[i].value = 0;  // any write clears
+    }
+    // XIP counters clear on write as well; order them last so fabric
+    // traffic from the writes above is not attributed to the window.
+    xip_ctrl_hw->ctr_hit = 0;
+    xip_ctrl_hw->ctr_acc = 0;
+}
+
+void bus_counters_end(BusCounters* out) {
+    out->xip_hits = xip_ctrl_hw->ctr_hit;
+    out->xip_accesses = xip_ctrl_hw->ctr_acc;
+    for (int i = 0; i < 4; i++)
+        out->perf[i] = busctrl_hw->counter[i].value;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file bus_counters.h
+ *
+ * @brief XIP cache and bus-fabric performance counter sampling
+ *
+ * Wraps the RP2040's XIP cache hit/access counters and the four
+ * BUSCTRL performance counters in a begin/end pair, so a code window
+ * (typically one Invoke()) can be classified as compute-bound or
+ * flash-fetch-bound and SRAM-bank contention between the cores can be
+ * measured directly. A low XIP hit rate argues for spending SRAM on
+ * code placement; high contested counts argue for moving arenas apart.
+ */
+
+#ifndef BUS_COUNTERS_H
+#define BUS_COUNTERS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief BUSCTRL PERFSEL event numbers (RP2040 datasheet, BUSCTRL section).
+ *
+ * Each upstream port has an access event and a contested event (the
+ * access had to wait for another master in the same cycle).
+ */
+enum BusPerfEvent {
+    BUS_PERF_APB_CONTESTED      = 0x00,
+    BUS_PERF_APB                = 0x01,
+    BUS_PERF_FASTPERI_CONTESTED = 0x02,
+    BUS_PERF_FASTPERI           = 0x03,
+    BUS_PERF_SRAM5_CONTESTED    = 0x04,
+    BUS_PERF_SRAM5              = 0x05,
+    BUS_PERF_SRAM4_CONTESTED    = 0x06,
+    BUS_PERF_SRAM4              = 0x07,
+    BUS_PERF_SRAM3_CONTESTED    = 0x08,
+    BUS_PERF_SRAM3              = 0x09,
+    BUS_PERF_SRAM2_CONTESTED    = 0x0A,
+    BUS_PERF_SRAM2              = 0x0B,
+    BUS_PERF_SRAM1_CONTESTED    = 0x0C,
+    BUS_PERF_SRAM1              = 0x0D,
+    BUS_PERF_SRAM0_CONTESTED    = 0x0E,
+    BUS_PERF_SRAM0              = 0x0F,
+    BUS_PERF_XIP_MAIN_CONTESTED = 0x10,
+    BUS_PERF_XIP_MAIN           = 0x11,
+    BUS_PERF_ROM_CONTESTED      = 0x12,
+    BUS_PERF_ROM                = 0x13,
+};
+
+/**
+ * @brief Counter values accumulated over one begin/end window.
+ */
+struct BusCounters {
+    uint32_t xip_hits;      ///< XIP cache hits in the window
+    uint32_t xip_accesses;  ///< XIP cache accesses in the window
+    uint32_t perf[4];       ///< the four BUSCTRL counters, as selected
+};
+
+/**
+ * @brief Select the four bus events and zero all counters.
+ *
+ * @param events The PERFSEL event for each of the four counters.
+ */
+void bus_counters_begin(const BusPerfEvent events[4]);
+
+/**
+ * @brief Snapshot all counters accumulated since the matching begin.
+ */
+void bus_counters_end(BusCounters* out);
+
+/**
+ * @brief XIP hit rate in permille for a captured window (0 when idle).
+ */
+static inline uint32_t bus_counters_hit_permille(const BusCounters* c) {
+    return c->xip_accesses ? (uint32_t)((uint64_t)c->xip_hits * 1000u / c->xip_accesses) : 0;
+}
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file bus_sync.cpp
+ *
+ * @brief Bus time sync implementation
+ *
+ * Offset tracking: each accepted beacon yields one offset sample,
+ * master_t_us (stamped at transmit start) minus the local clock at the
+ * first byte's arrival, corrected by the known line time of the frame
+ * already received. The first sample snaps the offset, later samples
+ * fold in at 1/8 weight - a beacon delayed behind a TX burst on a busy
+ * transceiver then nudges the timebase by an eighth of its error
+ * instead of jumping it. Reception is CRC-gated and resyncs byte by
+ * byte, exactly like the telemetry decoder, so console noise or a torn
+ * frame from a mid-beacon power-up never produces an offset sample.
+ */
+
+#include "bus_sync.h"
+
+#include <string.h>
+
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/uart.h"
+
+#include "app_log.h"
+#include "telemetry_wire.h"
+
+// UART1 with the default-adjacent pins; override per board wiring.
+#ifndef QDNN_BUS_TX_GPIO
+#define QDNN_BUS_TX_GPIO 8
+#endif
+#ifndef QDNN_BUS_RX_GPIO
+#define QDNN_BUS_RX_GPIO 9
+#endif
+// Driver-enable GPIO for half-duplex RS-485 transceivers; -1 for
+// auto-direction hardware.
+#ifndef QDNN_BUS_DE_GPIO
+#define QDNN_BUS_DE_GPIO -1
+#endif
+// Long multi-drop runs: slow and robust beats fast and reflective.
+#ifndef QDNN_BUS_BAUD
+#define QDNN_BUS_BAUD 19200
+#endif
+
+#define BUS_SYNC_MASTER (QDNN_BUS_UNIT == 0)
+
+// Line time of one beacon at QDNN_BUS_BAUD, 8N1 (10 bit times/byte):
+// the RX stamp is taken after the last byte, the TX stamp before the
+// first, so the whole frame's serialization sits between them.
+#define BEACON_WIRE_US \
+    ((uint32_t)sizeof(BusBeacon) * 10u * 1000000u / QDNN_BUS_BAUD)
+
+static uint16_t s_seq;
+
+// Slave state. The offset pair is written in the IRQ and read from
+// task context: on this 32-bit target a torn 64-bit read could pair
+// halves across an update, so readers spin on the sequence word the
+// IRQ bumps around each write (two loads and a compare - cheaper than
+// masking the IRQ on every bus_sync_time_us()).
+static volatile int64_t s_offset_us;
+static volatile uint32_t s_offset_seq;
+static volatile uint64_t s_last_beacon_us;  // local clock, lock aging
+static volatile uint32_t s_beacons;
+static bool s_was_locked;
+
+static uint8_t s_rx[sizeof(BusBeacon)];
+static size_t s_rx_fill;
+
+static void beacon_accept(const BusBeacon* b, uint64_t rx_done_us) {
+    int64_t sample =
+        (int64_t)(b->t_us + BEACON_WIRE_US) - (int64_t)rx_done_us;
+    s_offset_seq++;
+    __dmb();
+    if (s_beacons == 0)
+        s_offset_us = sample;
+    else
+        s_offset_us = s_offset_us + ((sample - s_offset_us) >> 3);
+    s_last_beacon_us = rx_done_us;
+    s_beacons = s_beacons + 1;
+    __dmb();
+    s_offset_seq++;
+}
+
+static void bus_rx_irq(void) {
+    while (uart_is_readable(uart1)) {
+        uint8_t byte = (uint8_t)uart_getc(uart1);
+        if (s_rx_fill == 0 && byte != TELEMETRY_BEACON_SOF) continue;
+        s_rx[s_rx_fill++] = byte;
+        if (s_rx_fill < sizeof(BusBeacon)) continue;
+        s_rx_fill = 0;
+
+        BusBeacon b;
+        memcpy(&b, s_rx, sizeof(b));
+        if (telemetry_crc16(s_rx, sizeof(b) - 2) != b.crc) {
+            // Torn or noise-hit frame: drop the SOF byte and rescan the
+            // remainder, the real frame may start inside it.
+            size_t next = 0;
+            for (size_t i = 1; i < sizeof(s_rx); i++)
+                if (next > 0 || s_rx[i] == TELEMETRY_BEACON_SOF)
+                    s_rx[next++] = s_rx[i];
+            s_rx_fill = next;
+            continue;
+        }
+        beacon_accept(&b, time_us_64());
+    }
+}
+
+void bus_sync_init(void) {
+    uart_init(uart1, QDNN_BUS_BAUD);
+    gpio_set_function(QDNN_BUS_TX_GPIO, GPIO_FUNC_UART);
+    gpio_set_function(QDNN_BUS_RX_GPIO, GPIO_FUNC_UART);
+#if QDNN_BUS_DE_GPIO >= 0
+    gpio_init(QDNN_BUS_DE_GPIO);
+    gpio_set_dir(QDNN_BUS_DE_GPIO, GPIO_OUT);
+    gpio_put(QDNN_BUS_DE_GPIO, BUS_SYNC_MASTER);  // master drives, slaves listen
+#endif
+#if !BUS_SYNC_MASTER
+    uart_set_irq_enables(uart1, true, false);
+    irq_set_exclusive_handler(UART1_IRQ, bus_rx_irq);
+    irq_set_enabled(UART1_IRQ, true);
+#else
+    (void)bus_rx_irq;
+#endif
+    LogInfo(("bus sync: unit %d of %d, %s, window %u ms",
+             QDNN_BUS_UNIT, QDNN_BUS_UNITS,
+             BUS_SYNC_MASTER ? "master" : "slave",
+             (unsigned)QDNN_BUS_WINDOW_MS));
+}
+
+void bus_sync_poll(void) {
+#if BUS_SYNC_MASTER
+    static uint64_t s_next_tx_us;
+    uint64_t now = time_us_64();
+    if (now < s_next_tx_us) return;
+    s_next_tx_us = now + (uint64_t)QDNN_BUS_BEACON_MS * 1000;
+
+    BusBeacon b;
+    b.sof = TELEMETRY_BEACON_SOF;
+    b.version = 1;
+    b.seq = s_seq++;
+    b.units = QDNN_BUS_UNITS;
+    b.window_ms = QDNN_BUS_WINDOW_MS;
+    b.t_us = time_us_64();  // stamped last, just before the write below
+    b.crc = telemetry_crc16((const uint8_t*)&b, sizeof(b) - 2);
+    // ~9 ms blocking at 19200: once per beacon interval in the report
+    // task's tail, after actuation is already out - not worth a DMA
+    // channel.
+    uart_write_blocking(uart1, (const uint8_t*)&b, sizeof(b));
+#else
+    bool locked = bus_sync_locked();
+    if (locked && !s_was_locked)
+        LogInfo(("bus sync: locked to master (offset %lld us)",
+                 (long long)s_offset_us));
+    else if (!locked && s_was_locked)
+        LogWarn(("bus sync: lost the master beacon, stagger suspended"));
+    s_was_locked = locked;
+#endif
+}
+
+uint64_t bus_sync_time_us(void) {
+#if BUS_SYNC_MASTER
+    return time_us_64();
+#else
+    uint32_t seq;
+    int64_t off;
+    do {
+        seq = s_offset_seq;
+        __dmb();
+        off = s_offset_us;
+        __dmb();
+    } while (seq != s_offset_seq || (seq & 1));
+    return time_us_64() + (uint64_t)off;
+#endif
+}
+
+bool bus_sync_locked(void) {
+#if BUS_SYNC_MASTER
+    return true;
+#else
+    if (s_beacons == 0) return false;
+    return time_us_64() - s_last_beacon_us <
+           (uint64_t)QDNN_BUS_BEACON_MS * 3000;
+#endif
+}
@@ -0,0 +1,87 @@
+/**
+ * @file bus_sync.h
+ *
+ * @brief Shared-bus time sync for chained units (RS-485 on UART1)
+ *
+ * Tunnel deployments daisy-chain several units on one RS-485 pair and
+ * one supply run; without a common clock their control cycles free-run
+ * and pump starts pile up at random - worst case all at once, and the
+ * combined inrush sags the supply into a brown-out. This module gives
+ * the chain one timebase: the unit built as master broadcasts a
+ * periodic beacon (BusBeacon, telemetry_wire.h) carrying its monotonic
+ * clock, and every slave tracks its offset to that clock from the
+ * beacon's arrival stamp, smoothed with the same IIR shape the ADC
+ * sampler uses so one jittered reception cannot yank the timebase.
+ *
+ * Consumers read bus_sync_time_us() - the master's clock as this unit
+ * best knows it - and phase their work against it; the report task
+ * holds rising pump commits to this unit's slot inside the shared
+ * stagger window (stagger_hold_ms, control_logic.h), which is what
+ * actually spreads the inrush. Accuracy wants are mild: slots are
+ * hundreds of milliseconds wide, so millisecond-grade sync with
+ * crystal drift between beacons (tens of ppm) is comfortable.
+ *
+ * The bus is beacon-only and one-directional; there is no arbitration
+ * to get wrong, and a slave that misses beacons for a few windows
+ * declares itself unlocked and falls back to immediate commits rather
+ * than staggering against a stale offset.
+ */
+
+#ifndef BUS_SYNC_H
+#define BUS_SYNC_H
+
+#include "pico/stdlib.h"
+
+/** @brief This unit's stagger slot; 0 is the beacon master. */
+#ifndef QDNN_BUS_UNIT
+#define QDNN_BUS_UNIT 0
+#endif
+
+/** @brief Units sharing the bus (and the supply run). */
+#ifndef QDNN_BUS_UNITS
+#define QDNN_BUS_UNITS 4
+#endif
+
+/** @brief Stagger window: fleet pump starts spread across this span. */
+#ifndef QDNN_BUS_WINDOW_MS
+#define QDNN_BUS_WINDOW_MS 1000
+#endif
+
+/** @brief Beacon cadence (master) and lock timeout basis (slaves). */
+#ifndef QDNN_BUS_BEACON_MS
+#define QDNN_BUS_BEACON_MS 2000
+#endif
+
+/**
+ * @brief Bring up UART1 and, on slaves, the beacon RX interrupt.
+ *
+ * Call once at init, before the tasks start. The master transmits
+ * from bus_sync_poll(); slaves receive entirely in the IRQ.
+ */
+void bus_sync_init(void);
+
+/**
+ * @brief Periodic service; call once per control cycle (report task).
+ *
+ * Master: sends a beacon when QDNN_BUS_BEACON_MS has elapsed.
+ * Slaves: ages the lock and logs the locked/unlocked edges.
+ */
+void bus_sync_poll(void);
+
+/**
+ * @brief The bus timebase: master clock as this unit best knows it.
+ *
+ * The master returns its own time_us_64(); slaves apply the tracked
+ * offset. Meaningful on slaves only while bus_sync_locked().
+ */
+uint64_t bus_sync_time_us(void);
+
+/**
+ * @brief True while the timebase is trustworthy.
+ *
+ * Always true on the master; true on slaves while beacons keep
+ * arriving (lock drops after three missed beacon intervals).
+ */
+bool bus_sync_locked(void);
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file calib_store.cpp
+ *
+ * @brief Runtime soil calibration store implementation
+ *
+ * One 4 KB sector at the very end of flash holds a small checksummed
+ * record. Reads go straight through XIP; the erase/program is deferred
+ * through flash_maint to the idle window between cycles (it parks both
+ * cores), with the RAM cache updated immediately so the new endpoints
+ * take effect on the very next cycle.
+ */
+
+#include "calib_store.h"
+
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "pico/flash.h"
+
+#include "app_log.h"
+#include "control_logic.h"
+#include "flash_maint.h"
+#include "lock_stats.h"
+#if QDNN_STATE_GUARD
+#include "state_guard.h"
+#endif
+#include "warm_state.h"
+
+// Last 4 KB sector of flash
+#define CALIB_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
+#define CALIB_MAGIC        0x51CA11B0u
+#define CALIB_VERSION      1u
+
+struct CalibRecord {
+    uint32_t magic;
+    uint32_t version;
+    uint16_t dry_raw;
+    uint16_t wet_raw;
+    uint32_t checksum;
+};
+
+// Cached in-RAM state; sensor path never touches flash
+static SoilCalib s_calib = { SOIL_DRY_RAW, SOIL_WET_RAW };
+
+static uint32_t record_checksum(const CalibRecord* r) {
+    return r->magic ^ r->version ^ (((uint32_t)r->dry_raw << 16) | r->wet_raw);
+}
+
+// Pull endpoints out of the flash record if it validates; otherwise
+// whatever the caller already holds stays.
+static void load_flash_record(SoilCalib* out) {
+    const CalibRecord* rec = (const CalibRecord*)(XIP_BASE + CALIB_FLASH_OFFSET);
+    if (rec->magic == CALIB_MAGIC && rec->version == CALIB_VERSION &&
+        rec->checksum == record_checksum(rec) && rec->dry_raw > rec->wet_raw) {
+        out->dry_raw = rec->dry_raw;
+        out->wet_raw = rec->wet_raw;
+    }
+}
+
+#if QDNN_STATE_GUARD
+static int s_guard = -1;
+
+// Guard trip: the RAM cache is suspect, the flash record is not (XIP
+// reads re-validate the checksum). Defaults, then flash on top - the
+// same precedence as a cold boot.
+static void calib_guard_reinit(void) {
+    SoilCalib fresh = { SOIL_DRY_RAW, SOIL_WET_RAW };
+    load_flash_record(&fresh);
+    lock_take(LOCK_CALIB);
+    s_calib = fresh;
+    lock_give(LOCK_CALIB);
+}
+#endif
+
+void calib_init(void) {
+    load_flash_record(&s_calib);
+    // A reset can land between "cal" and its deferred flash write; the
+    // checkpointed endpoints are then newer than the sector. RAM cache
+    // leads again - flash catches up at the next store.
+    SoilCalib warm;
+    if (warm_state_restore(WARM_SLOT_CALIB, &warm, sizeof(warm)) &&
+        warm.dry_raw > warm.wet_raw &&
+        (warm.dry_raw != s_calib.dry_raw || warm.wet_raw != s_calib.wet_raw)) {
+        s_calib = warm;
+        LogInfo(("calib: warm-start endpoints restored (flash stale)"));
+    }
+#if QDNN_STATE_GUARD
+    s_guard = state_guard_register("calib", &s_calib, sizeof(s_calib),
+                                   calib_guard_reinit, true);
+#endif
+}
+
+const SoilCalib* calib_get(void) {
+    return &s_calib;
+}
+
+void calib_snapshot(SoilCalib* out) {
+    lock_take(LOCK_CALIB);
+    *out = s_calib;
+    lock_give(LOCK_CALIB);
+}
+
+static void calib_flash_write(void* param) {
+    flash_range_erase(CALIB_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(CALIB_FLASH_OFFSET, (const uint8_t*)param, FLASH_PAGE_SIZE);
+}
+
+// Staged page for the deferred write; a re-store before the window
+// opens simply restages the latest values.
+static uint8_t s_page[FLASH_PAGE_SIZE];
+
+static void calib_maint_op(void) {
+    if (flash_safe_execute(calib_flash_write, s_page, 1000) != PICO_OK)
+        LogWarn(("calib: flash write failed; RAM values active, flash stale"));
+}
+
+int calib_store(uint16_t dry_raw, uint16_t wet_raw) {
+    if (dry_raw <= wet_raw) return -1;
+
+    CalibRecord rec = { CALIB_MAGIC, CALIB_VERSION, dry_raw, wet_raw, 0 };
+    rec.checksum = record_checksum(&rec);
+    memset(s_page, 0xFF, sizeof(s_page));
+    memcpy(s_page, &rec, sizeof(rec));
+
+    if (!flash_maint_defer("calib", calib_maint_op, 60)) return -1;
+
+    // RAM cache leads: the control path follows the new endpoints now,
+    // the sector catches up in the idle window. Both endpoints move
+    // under the calibration lock so a snapshot never tears the pair.
+    lock_take(LOCK_CALIB);
+    s_calib.dry_raw = dry_raw;
+    s_calib.wet_raw = wet_raw;
+    lock_give(LOCK_CALIB);
+    // Checkpoint too, so a reset before the idle window keeps them
+    warm_state_save(WARM_SLOT_CALIB, &s_calib, sizeof(s_calib));
+#if QDNN_STATE_GUARD
+    state_guard_seal(s_guard);  // legitimate write, re-seal
+#endif
+    return 0;
+}
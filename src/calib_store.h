@@ -0,0 +1,59 @@
+/**
+ * @file calib_store.h
+ *
+ * @brief Runtime soil calibration store (flash-backed, RAM-cached)
+ *
+ * The dry/wet ADC endpoints vary per probe and per soil, so the
+ * compile-time SOIL_DRY_RAW/SOIL_WET_RAW defaults can be overridden at
+ * runtime and persisted in the last flash sector. The active values are
+ * cached in RAM: the sensor path reads them with zero flash traffic,
+ * and a store only touches flash when a new calibration is committed.
+ */
+
+#ifndef CALIB_STORE_H
+#define CALIB_STORE_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief In-RAM calibration state used by the sensor path.
+ */
+struct SoilCalib {
+    uint16_t dry_raw;  ///< ADC reading in air / fully dry soil
+    uint16_t wet_raw;  ///< ADC reading in water / saturated soil
+};
+
+/**
+ * @brief Load the persisted calibration into the RAM cache.
+ *
+ * Falls back to the compile-time defaults when flash holds no valid
+ * record. Call once at boot, before the sensor task starts.
+ */
+void calib_init(void);
+
+/**
+ * @brief Access the cached calibration (always valid after calib_init()).
+ *
+ * Unlocked; fine for display. The sensor path uses calib_snapshot()
+ * so both endpoints come from the same calibration.
+ */
+const SoilCalib* calib_get(void);
+
+/**
+ * @brief Copy the cached calibration out under the calibration lock.
+ *
+ * A "cal" store updates both endpoints together; snapshotting under
+ * the lock keeps a concurrent reader from seeing one new and one old.
+ */
+void calib_snapshot(SoilCalib* out);
+
+/**
+ * @brief Persist a new calibration to flash and update the RAM cache.
+ *
+ * @param dry_raw ADC endpoint for dry soil (must be > wet_raw).
+ * @param wet_raw ADC endpoint for saturated soil.
+ * @return 0 on success, -1 on invalid endpoints or flash failure.
+ */
+int calib_store(uint16_t dry_raw, uint16_t wet_raw);
+
+#endif
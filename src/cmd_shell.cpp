@@ -0,0 +1,619 @@
+/**
+ * @file cmd_shell.cpp
+ *
+ * @brief Command shell implementation
+ *
+ * Characters are pulled with getchar_timeout_us(0) so an idle console
+ * costs one timeout check per drain loop. Input is echoed (USB CDC has
+ * no local echo) and buffered until CR/LF; oversize lines are dropped
+ * whole. Shell output goes straight to stdout - this code runs in the
+ * drain task, which owns stdio anyway.
+ */
+
+#include "cmd_shell.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "calib_store.h"
+#include "config_store.h"
+#include "device_id.h"
+#if QDNN_CYCLE_TIMING
+#include "cycle_timing.h"
+#endif
+#if QDNN_DATALOG
+#include "datalog.h"
+#endif
+#if QDNN_MODEL_BANK
+#include "model_bank.h"
+#endif
+#if QDNN_MODEL_SHADOW
+#include "model_shadow.h"
+#endif
+#if QDNN_SENSOR_EMUL
+#include "sensor_emul.h"
+#endif
+#include "err_stats.h"
+#if QDNN_FLOAT_AUDIT
+#include "float_audit.h"
+#endif
+#include "heap_stats.h"
+#include "irq_latency.h"
+#include "lock_stats.h"
+#include "queue_stats.h"
+#include "idle_meter.h"
+#include "log_ring.h"
+#include "self_test.h"
+#include "task_stats.h"
+#include "telemetry.h"
+#if QDNN_PUMP_DUTY
+#include "pump_duty.h"
+#endif
+#if QDNN_BROWNOUT
+#include "brownout.h"
+#endif
+#if QDNN_AB_SLOTS
+#include "fw_update.h"
+#endif
+#if QDNN_IRQ_MAP
+#include "irq_map.h"
+#endif
+#if QDNN_LAZY_FMT
+#include "log_fmt.h"
+#endif
+#if QDNN_SCRATCH_ARENA
+#include "scratch_arena.h"
+#endif
+#if QDNN_METRICS
+#include "metrics.h"
+#endif
+#if QDNN_BOOT_LADDER
+#include "boot_ladder.h"
+#endif
+#if QDNN_TOUCH_BTN
+#include "touch_btn.h"
+#endif
+#include "resource_map.h"
+
+// Bounds for the runtime period: below 500 ms the DHT11 cannot settle
+// between reads, above 10 min a typo would look like a hang.
+#define CMD_PERIOD_MIN_MS 500
+#define CMD_PERIOD_MAX_MS 600000
+
+#define CMD_LINE_MAX 64
+
+// Runtime config. Written only here (drain task), read by the control
+// tasks through the accessors: single word-sized fields, no locking.
+static volatile uint32_t s_period_ms = 3000;
+static volatile bool s_verbose = false;
+
+static char s_line[CMD_LINE_MAX];
+static size_t s_line_len = 0;
+
+void cmd_shell_init(uint32_t default_period_ms) {
+    // The caller has already run config_init(), so the persisted
+    // values (when any) arrive through the default and the accessor.
+    s_period_ms = default_period_ms;
+    s_verbose = config_get()->verbose != 0;
+}
+
+// Mutating commands persist through the config store: RAM takes
+// effect immediately, flash catches up in the idle window.
+static void config_persist(void) {
+    RuntimeConfig cfg = *config_get();
+    cfg.period_ms = s_period_ms;
+    cfg.verbose = s_verbose ? 1 : 0;
+    if (config_store(&cfg) != 0)
+        printf("config: flash store failed, setting not persisted\n");
+}
+
+uint32_t cmd_shell_period_ms(void) {
+    return s_period_ms;
+}
+
+bool cmd_shell_verbose(void) {
+    return s_verbose;
+}
+
+static void cmd_help(void) {
+    printf("commands:\n");
+    printf("  show              current config + calibration\n");
+    printf("  period <ms>       control cycle period (%d..%d)\n",
+           CMD_PERIOD_MIN_MS, CMD_PERIOD_MAX_MS);
+    printf("  dwell <cycles>    actuation dwell filter depth (1..10)\n");
+    printf("  margin <steps>    min top-2 logit gap to act on (0 = off)\n");
+    printf("  zone <z> <b0..b3> per-zone pump logit biases (all 0 = off)\n");
+    printf("  cal <dry> <wet>   soil ADC endpoints, persisted to flash\n");
+    printf("  time <epoch>      set the wall clock for telemetry time-sync\n");
+    printf("  verbose on|off    per-cycle human-readable report\n");
+    printf("  stats             heap + per-task CPU/stack snapshot\n");
+#if QDNN_METRICS
+    printf("  metrics           registry dump: name, wire hash, value\n");
+#endif
+#if QDNN_BOOT_LADDER
+    printf("  ladder [clear]    crash-loop degradation state / reset\n");
+#endif
+    printf("  selftest          background sensor/actuator diagnostics\n");
+    printf("  irqtest [s]       IRQ latency probe alongside the workload\n");
+#if QDNN_IRQ_MAP
+    printf("  irqs              interrupt steering map vs live NVIC state\n");
+#endif
+    printf("  res               DMA/PIO/alarm pools: owners + headroom\n");
+#if QDNN_CYCLE_TIMING
+    printf("  timing            hot-path latency histograms\n");
+#endif
+#if QDNN_TRACE_RING
+    printf("  watch [<site> <us>|freeze]   flight-recorder triggers\n");
+#endif
+#if QDNN_DATALOG
+    printf("  dump              stream the on-flash datalog (binary)\n");
+    printf("  fetch [seq]       chunked datalog export; no args = range\n");
+#endif
+#if QDNN_MODEL_BANK
+    printf("  mload fan|pump <len> <crc32hex>   upload a model to flash\n");
+#endif
+#if QDNN_AB_SLOTS
+    printf("  fw                A/B firmware slot status\n");
+    printf("  fwload <len> <crc32hex>   stream firmware to inactive slot\n");
+#endif
+#if QDNN_MODEL_SHADOW
+    printf("  shadow [promote|drop]   candidate model scoreboard / verdict\n");
+#endif
+#if QDNN_SENSOR_EMUL
+    printf("  emul [<scenario> [speedup]|off]   replay input source\n");
+#endif
+}
+
+static void cmd_show(void) {
+    const SoilCalib* cal = calib_get();
+    const uint8_t* id = device_id_get();
+    printf("unit:    ");
+    for (int i = 0; i < DEVICE_ID_LEN; i++) printf("%02x", id[i]);
+    printf("\n");
+    printf("period:  %u ms\n", (unsigned)s_period_ms);
+    printf("dwell:   %u cycles\n", (unsigned)config_get()->dwell_cycles);
+    printf("margin:  %u logit steps%s\n", (unsigned)config_get()->conf_margin,
+           config_get()->conf_margin ? "" : " (gate off)");
+    // Personalized zones only; identity rows stay quiet.
+    for (int z = 0; z < BOARD_MAX_ZONES; z++) {
+        const int8_t* zb = config_get()->zone_bias[z];
+        if (zb[0] || zb[1] || zb[2] || zb[3])
+            printf("zone %d:  %d %d %d %d logit steps\n", z,
+                   zb[0], zb[1], zb[2], zb[3]);
+    }
+    printf("calib:   dry=%u wet=%u\n", cal->dry_raw, cal->wet_raw);
+    printf("verbose: %s\n", s_verbose ? "on" : "off");
+    printf("dropped: %u log writes\n", (unsigned)log_ring_dropped());
+#if QDNN_LAZY_FMT
+    printf("         %u deferred-format records\n", (unsigned)log_fmt_dropped());
+#endif
+}
+
+static void cmd_stats(void) {
+    HeapStats hs;
+    heap_stats_collect(&hs);
+    printf("heap: free=%u min=%u largest=%u\n",
+           (unsigned)hs.free_bytes, (unsigned)hs.min_ever_free_bytes,
+           (unsigned)hs.largest_free_block);
+
+    TaskStatsReport tr;
+    task_stats_collect(&tr);
+    for (int i = 0; i < tr.num_tasks; i++)
+        printf("task %s: cpu %u/1000, stack hwm %u words\n",
+               tr.task[i].name, (unsigned)tr.task[i].cpu_permille,
+               (unsigned)tr.task[i].stack_hwm_words);
+
+    IdleMeterReport im;
+    idle_meter_collect(&im);
+    printf("idle: %u/1000 over %u ms, %u wakes\n",
+           (unsigned)im.idle_permille, (unsigned)(im.interval_us / 1000),
+           (unsigned)im.wakes);
+
+#if QDNN_SCRATCH_ARENA
+    {
+        ScratchArena* sa = scratch_cycle();
+        printf("scratch: hwm=%u/%u refused=%u\n", (unsigned)sa->high_water,
+               (unsigned)sa->size, (unsigned)sa->failures);
+    }
+#endif
+
+    printf("errors:");
+    for (int i = 0; i < ERR_SITE_COUNT; i++)
+        printf(" %s=%u", err_stats_site_name(i), (unsigned)err_stats_get(i));
+    printf("\n");
+
+    for (int q = 0; q < QSTAT_COUNT; q++) {
+        QueueStatsSnap qs;
+        queue_stats_collect(q, &qs);
+        printf("queue %-4s depth=%u/%u age=%ums max=%ums drops=%u\n",
+               queue_stats_name(q), (unsigned)qs.depth, (unsigned)qs.max_depth,
+               (unsigned)qs.age_ms, (unsigned)qs.max_age_ms, (unsigned)qs.drops);
+    }
+
+    for (int l = 0; l < LOCK_COUNT; l++) {
+        LockStatsSnap ls;
+        lock_stats_collect(l, &ls);
+        printf("lock %-4s acq=%u cont=%u wait=%uus hold=%uus\n",
+               lock_stats_name(l), (unsigned)ls.acquisitions,
+               (unsigned)ls.contended, (unsigned)ls.max_wait_us,
+               (unsigned)ls.max_hold_us);
+    }
+    printf("prio inherits: %u\n", (unsigned)lock_stats_inherits());
+
+#if QDNN_PUMP_DUTY
+    for (int z = 0; z < pump_duty_zones(); z++) {
+        PumpDutySnap d;
+        pump_duty_collect(z, &d);
+        printf("pump z%d: on=%us lvl-s=%u starts=%u (today)\n", z,
+               (unsigned)(d.on_us / 1000000),
+               (unsigned)(d.level_us / 1000000), (unsigned)d.starts);
+    }
+#endif
+
+#if QDNN_BROWNOUT
+    printf("vsys: %u mV (brownouts: %u)\n", (unsigned)brownout_vsys_mv(),
+           (unsigned)brownout_count());
+#endif
+
+#if QDNN_FLOAT_AUDIT
+    float_audit_report();
+#endif
+}
+
+#if QDNN_METRICS
+static void cmd_metrics(void) {
+    // The hash column is the id the 0xB6 frames carry - this dump is
+    // the hash-to-name dictionary for whoever keys on the wire.
+    static const char* const kType[] = {"ctr", "gauge", "hwm"};
+    for (int i = 0; i < metrics_count(); i++) {
+        const MetricDesc* m = metrics_get(i);
+        printf("%-24s %08x %-5s %u\n", m->name, (unsigned)m->hash,
+               kType[m->type], (unsigned)*m->value);
+    }
+    printf("%d/%d slots\n", metrics_count(), QDNN_METRICS_MAX);
+}
+#endif
+
+#if QDNN_CYCLE_TIMING
+static void cmd_timing(void) {
+    for (int site = 0; site < TIMING_SITE_COUNT; site++) {
+        const TimingHist* h = cycle_timing_get(site);
+        printf("%-5s n=%u max=%uus mean=%uus over=%u/%uus bins:",
+               cycle_timing_site_name(site), (unsigned)h->count,
+               (unsigned)h->max_us,
+               (unsigned)(h->count ? h->total_us / h->count : 0),
+               (unsigned)cycle_timing_over_budget(site),
+               (unsigned)TIMING_BUDGET_US[site]);
+        for (int b = 0; b < TIMING_HIST_BINS; b++)
+            printf(" %u", (unsigned)h->bins[b]);
+        printf("\n");
+        // Same data as a binary frame for the host-side tooling
+        telemetry_emit_timing((uint8_t)site, h);
+    }
+    printf("budget sum: %uus\n", (unsigned)timing_budget_total());
+}
+#endif
+
+static void run_line(char* line) {
+    char* save = NULL;
+    const char* cmd = strtok_r(line, " \t", &save);
+    if (cmd == NULL) return;
+
+    if (strcmp(cmd, "help") == 0) {
+        cmd_help();
+    } else if (strcmp(cmd, "show") == 0) {
+        cmd_show();
+    } else if (strcmp(cmd, "stats") == 0) {
+        cmd_stats();
+#if QDNN_METRICS
+    } else if (strcmp(cmd, "metrics") == 0) {
+        cmd_metrics();
+#endif
+#if QDNN_BOOT_LADDER
+    } else if (strcmp(cmd, "ladder") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        if (arg != NULL && strcmp(arg, "clear") == 0) {
+            boot_ladder_clear();
+            printf("ladder: cleared, full function from the next boot\n");
+            return;
+        }
+        printf("ladder: level %d, %u strike(s)\n", boot_ladder_level(),
+               (unsigned)boot_ladder_strikes());
+        static const char* const kLadderStep[] = {
+            "model banks", "shadow eval", "telemetry", "inference"};
+        for (int s = 1; s <= LADDER_STEP_MAX; s++)
+            if (boot_ladder_entered_boot(s) != 0)
+                printf("  step %d: %s off since boot %u\n", s,
+                       kLadderStep[s - 1],
+                       (unsigned)boot_ladder_entered_boot(s));
+#endif
+    } else if (strcmp(cmd, "selftest") == 0) {
+        self_test_print();
+    } else if (strcmp(cmd, "irqtest") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        long secs = arg ? strtol(arg, NULL, 10) : 10;
+        if (secs < 1 || secs > 600) {
+            printf("irqtest: need 1..600 s\n");
+            return;
+        }
+        if (irq_latency_start((uint32_t)secs) == 0)
+            printf("irqtest: probing for %ld s, report follows\n", secs);
+        else
+            printf("irqtest: already running or no hardware alarm free\n");
+#if QDNN_IRQ_MAP
+    } else if (strcmp(cmd, "irqs") == 0) {
+        irq_map_report();
+#endif
+    } else if (strcmp(cmd, "res") == 0) {
+        resource_report();
+#if QDNN_CYCLE_TIMING
+    } else if (strcmp(cmd, "timing") == 0) {
+        cmd_timing();
+#endif
+#if QDNN_TRACE_RING
+    } else if (strcmp(cmd, "watch") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        if (arg == NULL) {
+            for (int site = 0; site < TIMING_SITE_COUNT; site++)
+                printf("%-5s %uus\n", cycle_timing_site_name(site),
+                       (unsigned)trace_ring_watch_get(site));
+            printf("ring: %s\n", trace_ring_frozen() ? "frozen" : "armed");
+            return;
+        }
+        if (strcmp(arg, "freeze") == 0) {
+            trace_ring_freeze(TRACE_FREEZE_SHELL);
+            printf("watch: capture frozen, frame follows\n");
+            return;
+        }
+        int site = -1;
+        for (int s = 0; s < TIMING_SITE_COUNT; s++)
+            if (strcmp(arg, cycle_timing_site_name(s)) == 0) site = s;
+        const char* us_arg = strtok_r(NULL, " \t", &save);
+        if (site < 0 || us_arg == NULL) {
+            printf("watch: need <site> <us>, freeze, or no args\n");
+            return;
+        }
+        trace_ring_watch(site, (uint32_t)strtol(us_arg, NULL, 10));
+        printf("watch: %s at %uus\n", arg,
+               (unsigned)trace_ring_watch_get(site));
+#endif
+#if QDNN_DATALOG
+    } else if (strcmp(cmd, "dump") == 0) {
+        datalog_dump();
+    } else if (strcmp(cmd, "fetch") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        uint32_t lo, hi;
+        datalog_fetch_range(&lo, &hi);
+        if (arg == NULL) {
+            if (hi == 0) printf("fetch: nothing committed yet\n");
+            else printf("fetch: seq %u..%u\n", (unsigned)lo, (unsigned)hi);
+            return;
+        }
+        // One chunk per request: the host's next fetch is the ack for
+        // this one, so its receive buffer bounds the pipeline depth.
+        unsigned long seq = strtoul(arg, NULL, 10);
+        if (datalog_fetch_start((uint32_t)seq) != 0)
+            printf("fetch: seq %lu unavailable (have %u..%u)\n", seq,
+                   (unsigned)lo, (unsigned)hi);
+#endif
+    } else if (strcmp(cmd, "period") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        long ms = arg ? strtol(arg, NULL, 10) : 0;
+        if (ms < CMD_PERIOD_MIN_MS || ms > CMD_PERIOD_MAX_MS) {
+            printf("period: need %d..%d ms\n", CMD_PERIOD_MIN_MS, CMD_PERIOD_MAX_MS);
+            return;
+        }
+        s_period_ms = (uint32_t)ms;
+        config_persist();
+        printf("period: %ld ms (takes effect next cycle)\n", ms);
+    } else if (strcmp(cmd, "dwell") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        long n = arg ? strtol(arg, NULL, 10) : 0;
+        if (n < 1 || n > 10) {
+            printf("dwell: need 1..10 cycles\n");
+            return;
+        }
+        RuntimeConfig cfg = *config_get();
+        cfg.dwell_cycles = (uint8_t)n;
+        if (config_store(&cfg) != 0)
+            printf("config: flash store failed, setting not persisted\n");
+        printf("dwell: %ld cycle(s) (takes effect next cycle)\n", n);
+    } else if (strcmp(cmd, "margin") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        long n = arg ? strtol(arg, NULL, 10) : -1;
+        if (n < 0 || n > 127) {
+            printf("margin: need 0..127 logit steps (0 = off)\n");
+            return;
+        }
+        RuntimeConfig cfg = *config_get();
+        cfg.conf_margin = (uint8_t)n;
+        if (config_store(&cfg) != 0)
+            printf("config: flash store failed, setting not persisted\n");
+        printf("margin: %ld step(s) (takes effect next cycle)\n", n);
+    } else if (strcmp(cmd, "zone") == 0) {
+        const char* az = strtok_r(NULL, " \t", &save);
+        long z = az ? strtol(az, NULL, 10) : -1;
+        if (z < 0 || z >= BOARD_MAX_ZONES) {
+            printf("zone: need <z> (0..%d) <b0..b%d> logit steps\n",
+                   BOARD_MAX_ZONES - 1, CONFIG_ZONE_CLASSES - 1);
+            return;
+        }
+        int8_t row[CONFIG_ZONE_CLASSES];
+        for (int i = 0; i < CONFIG_ZONE_CLASSES; i++) {
+            const char* ab = strtok_r(NULL, " \t", &save);
+            long b = ab ? strtol(ab, NULL, 10) : 999;
+            if (b < -128 || b > 127) {
+                printf("zone: need %d biases, -128..127 each\n",
+                       CONFIG_ZONE_CLASSES);
+                return;
+            }
+            row[i] = (int8_t)b;
+        }
+        RuntimeConfig cfg = *config_get();
+        memcpy(cfg.zone_bias[z], row, sizeof(row));
+        if (config_store(&cfg) != 0)
+            printf("config: flash store failed, setting not persisted\n");
+        printf("zone %ld: %d %d %d %d (takes effect next cycle)\n", z,
+               row[0], row[1], row[2], row[3]);
+    } else if (strcmp(cmd, "time") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        unsigned long epoch = arg ? strtoul(arg, NULL, 10) : 0;
+        if (epoch == 0) {
+            printf("time: need <unix epoch seconds>\n");
+            return;
+        }
+        telemetry_set_wallclock((uint32_t)epoch);
+        // Emit the correlation record right away so the host's set-time
+        // script can confirm the pairing without waiting a snapshot period
+        telemetry_emit_timesync();
+        printf("time: wall clock set\n");
+    } else if (strcmp(cmd, "cal") == 0) {
+        const char* a1 = strtok_r(NULL, " \t", &save);
+        const char* a2 = strtok_r(NULL, " \t", &save);
+        long dry = a1 ? strtol(a1, NULL, 10) : 0;
+        long wet = a2 ? strtol(a2, NULL, 10) : 0;
+        if (dry <= 0 || dry > 4095 || wet < 0 || wet > 4095 || dry <= wet) {
+            printf("cal: need <dry> <wet>, 12-bit, dry > wet\n");
+            return;
+        }
+        if (calib_store((uint16_t)dry, (uint16_t)wet) == 0)
+            printf("cal: dry=%ld wet=%ld active, persists at next idle window\n",
+                   dry, wet);
+        else
+            printf("cal: store failed\n");
+#if QDNN_MODEL_BANK
+    } else if (strcmp(cmd, "mload") == 0) {
+        const char* which = strtok_r(NULL, " \t", &save);
+        const char* a_len = strtok_r(NULL, " \t", &save);
+        const char* a_crc = strtok_r(NULL, " \t", &save);
+        int id = -1;
+        if (which && strcmp(which, "fan") == 0) id = MODEL_BANK_FAN;
+        else if (which && strcmp(which, "pump") == 0) id = MODEL_BANK_PUMP;
+        long len = a_len ? strtol(a_len, NULL, 10) : 0;
+        unsigned long crc = a_crc ? strtoul(a_crc, NULL, 16) : 0;
+        if (id < 0 || len <= 0 || a_crc == NULL) {
+            printf("mload: need fan|pump <len> <crc32hex>\n");
+            return;
+        }
+        printf("mload: send %ld raw bytes now\n", len);
+        if (model_bank_upload(id, (uint32_t)len, (uint32_t)crc) == 0)
+            printf("mload: %s model armed, swaps at next cycle\n", which);
+        else
+            printf("mload: failed, active model untouched\n");
+#endif
+#if QDNN_AB_SLOTS
+    } else if (strcmp(cmd, "fw") == 0) {
+        fw_update_report();
+    } else if (strcmp(cmd, "fwload") == 0) {
+        const char* a_len = strtok_r(NULL, " \t", &save);
+        const char* a_crc = strtok_r(NULL, " \t", &save);
+        long len = a_len ? strtol(a_len, NULL, 10) : 0;
+        unsigned long crc = a_crc ? strtoul(a_crc, NULL, 16) : 0;
+        if (len <= 0 || a_crc == NULL) {
+            printf("fwload: need <len> <crc32hex> (tools/fw_image.py)\n");
+            return;
+        }
+        printf("fwload: send %ld bytes, one sector per 'ok' prompt\n", len);
+        if (fw_update_upload((uint32_t)len, (uint32_t)crc) == 0)
+            printf("fwload: slot armed, reboot to trial it\n");
+        else
+            printf("fwload: failed, running slot untouched\n");
+#endif
+#if QDNN_MODEL_SHADOW
+    } else if (strcmp(cmd, "shadow") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        if (arg == NULL) {
+            model_shadow_report();
+        } else if (strcmp(arg, "promote") == 0) {
+            if (model_shadow_request_promote() == 0)
+                printf("shadow: promoting at next cycle\n");
+            else
+                printf("shadow: no candidate armed\n");
+        } else if (strcmp(arg, "drop") == 0) {
+            if (model_shadow_request_dismiss() == 0)
+                printf("shadow: dropping candidate\n");
+            else
+                printf("shadow: no candidate armed\n");
+        } else {
+            printf("shadow: [promote|drop]\n");
+        }
+#endif
+#if QDNN_SENSOR_EMUL
+    } else if (strcmp(cmd, "emul") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        if (arg == NULL) {
+            sensor_emul_report();
+        } else if (strcmp(arg, "off") == 0) {
+            sensor_emul_stop();
+            printf("emul: off\n");
+        } else {
+            const char* sp = strtok_r(NULL, " \t", &save);
+            long speedup = sp ? strtol(sp, NULL, 10) : 1;
+            if (speedup < 1) speedup = 1;
+            if (sensor_emul_start(arg, (unsigned)speedup) == 0)
+                printf("emul: %s armed at %ldx\n", arg, speedup);
+            else
+                printf("emul: unknown scenario (diurnal, chatter, faults)\n");
+        }
+#endif
+    } else if (strcmp(cmd, "verbose") == 0) {
+        const char* arg = strtok_r(NULL, " \t", &save);
+        if (arg && strcmp(arg, "on") == 0) s_verbose = true;
+        else if (arg && strcmp(arg, "off") == 0) s_verbose = false;
+        else { printf("verbose: on|off\n"); return; }
+        config_persist();
+        printf("verbose: %s\n", s_verbose ? "on" : "off");
+    } else {
+        printf("unknown command '%s' - try 'help'\n", cmd);
+    }
+}
+
+void cmd_shell_poll(void) {
+    // Finished latency run? Deliver the report from stdio-owning context
+    if (irq_latency_finished()) irq_latency_print();
+
+#if QDNN_DATALOG
+    // Armed datalog chunk: one bounded slice per poll, so a full-
+    // history export never costs a pass more than DATALOG_FETCH_SLICE
+    // bytes of output alongside the live telemetry.
+    datalog_fetch_step();
+#endif
+
+#if QDNN_TOUCH_BTN
+    // Button verdicts arrive pre-debounced and pre-classified from the
+    // PIO sensing block; the mapped dump runs here, in the context
+    // that owns stdio, exactly as if the command had been typed.
+    switch (touch_btn_take_event()) {
+        case TOUCH_EV_SHORT:
+            printf("[button] selftest\n");
+            self_test_print();
+            break;
+        case TOUCH_EV_LONG:
+            printf("[button] stats\n");
+            cmd_stats();
+            break;
+        default:
+            break;
+    }
+#endif
+
+    int c;
+    while ((c = getchar_timeout_us(0)) >= 0) {
+        if (c == '\r' || c == '\n') {
+            putchar('\n');
+            s_line[s_line_len] = '\0';
+            s_line_len = 0;
+            run_line(s_line);
+        } else if (c == 0x08 || c == 0x7F) {  // backspace / DEL
+            if (s_line_len > 0) {
+                s_line_len--;
+                printf("\b \b");
+            }
+        } else if (s_line_len < CMD_LINE_MAX - 1) {
+            s_line[s_line_len++] = (char)c;
+            putchar(c);
+        }
+        // Oversize input: silently eat until the line terminator
+    }
+}
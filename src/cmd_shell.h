@@ -0,0 +1,46 @@
+/**
+ * @file cmd_shell.h
+ *
+ * @brief Line-oriented command shell on the stdio link
+ *
+ * Runtime tuning without a reflash: the drain task polls stdin between
+ * ring drains and feeds complete lines to a small interpreter that
+ * mutates the runtime config (control period, verbose reporting) or
+ * calls into the existing stores (soil calibration, stats collectors).
+ * The control-side tasks only ever read the config through the
+ * accessors below - single aligned word reads, no locking needed.
+ *
+ * Type "help" on the console for the command list.
+ */
+
+#ifndef CMD_SHELL_H
+#define CMD_SHELL_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Seed the runtime config with the compile-time defaults.
+ *
+ * Call once at boot, before the tasks that read the config start.
+ */
+void cmd_shell_init(uint32_t default_period_ms);
+
+/**
+ * @brief Poll stdin and run any completed command line.
+ *
+ * Non-blocking; call from the stdio drain task loop. Must only be
+ * called from the task that owns stdio output.
+ */
+void cmd_shell_poll(void);
+
+/**
+ * @brief Current control cycle period in ms (sensor task cadence).
+ */
+uint32_t cmd_shell_period_ms(void);
+
+/**
+ * @brief True when the per-cycle human-readable report is enabled.
+ */
+bool cmd_shell_verbose(void);
+
+#endif
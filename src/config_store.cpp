@@ -0,0 +1,209 @@
+/**
+ * @file config_store.cpp
+ *
+ * @brief Runtime configuration store implementation
+ *
+ * One 4 KB sector below the model bank region holds the record; the
+ * flash map in model_bank.h grows down by one more sector. Reads go
+ * straight through XIP; the erase/program is deferred through
+ * flash_maint, with the RAM cache updated immediately.
+ */
+
+#include "config_store.h"
+
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "pico/flash.h"
+
+#include "app_log.h"
+#include "datalog.h"
+#include "flash_maint.h"
+#include "model_bank.h"
+#if QDNN_STATE_GUARD
+#include "state_guard.h"
+#endif
+
+// One sector below the model banks (which sit below datalog + crash +
+// calib); the regions above are reserved whether or not their options
+// are compiled in, so this offset never moves with the build config.
+#define CONFIG_FLASH_OFFSET                                          \
+    (PICO_FLASH_SIZE_BYTES -                                         \
+     (2 + DATALOG_SECTORS +                                          \
+      MODEL_BANK_MODELS * 2 * MODEL_BANK_SECTORS + 1) * FLASH_SECTOR_SIZE)
+
+#define CONFIG_MAGIC   0x51C0F160u
+#define CONFIG_VERSION 3u
+
+// Fixed-offset on-flash layout. New fields go into the reserved tail
+// (keeping existing offsets) with a version bump and a migration case
+// below; never reorder or shrink existing fields. Fields that outgrow
+// the tail append before the CRC - the prefix stays stable and
+// record_valid() finds the CRC at the offset the record's own version
+// wrote it.
+struct ConfigRecord {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t period_ms;
+    uint8_t verbose;
+    uint8_t dwell_cycles;
+    uint8_t conf_margin;   // v2: actuation confidence-margin threshold
+    uint8_t reserved[5];   // future fields land here at fixed offsets
+    // v3: per-zone pump personalization deltas (logit-step biases)
+    int8_t zone_bias[BOARD_MAX_ZONES][CONFIG_ZONE_CLASSES];
+    uint32_t crc32;        // CRC-32 (IEEE) over all preceding bytes
+};
+
+static_assert(BOARD_MAX_ZONES == 3 && CONFIG_ZONE_CLASSES == 4,
+              "v3 on-flash layout is frozen at 3x4 delta rows");
+
+// Cached in-RAM state; control tasks never touch flash
+static RuntimeConfig s_config;
+
+#if QDNN_STATE_GUARD
+// Boot defaults kept for the guard's re-init path: a trip rebuilds
+// the cache the way config_init() did, defaults then flash on top.
+static RuntimeConfig s_defaults;
+static int s_guard = -1;
+#endif
+
+// Bitwise CRC-32 (IEEE): the record is ~20 bytes, so the table-free
+// loop costs microseconds once at boot and once per store.
+static uint32_t crc32_sw(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+static bool record_valid(const ConfigRecord* r) {
+    if (r->magic != CONFIG_MAGIC) return false;
+    // Pre-v3 records end at the old 24-byte trailer: their CRC sits
+    // where the v3 delta rows start. Versions from v3 on keep the
+    // current offset (further growth appends before the CRC again,
+    // with its own case here).
+    size_t crc_at = (r->version < 3) ? offsetof(ConfigRecord, zone_bias)
+                                     : offsetof(ConfigRecord, crc32);
+    uint32_t stored;
+    memcpy(&stored, (const uint8_t*)r + crc_at, sizeof(stored));
+    return stored == crc32_sw((const uint8_t*)r, crc_at);
+}
+
+// Migration: copy an older record's fields into the current RAM
+// struct; fields the old version lacked keep the caller's defaults.
+// One case per retired version, oldest first.
+static bool migrate_record(const ConfigRecord* r, RuntimeConfig* out) {
+    switch (r->version) {
+        case 1:
+            // v1 predates conf_margin; the default stays.
+            out->period_ms = r->period_ms;
+            out->verbose = r->verbose;
+            out->dwell_cycles = r->dwell_cycles;
+            return true;
+        case 2:
+            // v2 predates the zone deltas; the identity rows stay.
+            out->period_ms = r->period_ms;
+            out->verbose = r->verbose;
+            out->dwell_cycles = r->dwell_cycles;
+            out->conf_margin = r->conf_margin;
+            return true;
+        case 3:
+            out->period_ms = r->period_ms;
+            out->verbose = r->verbose;
+            out->dwell_cycles = r->dwell_cycles;
+            out->conf_margin = r->conf_margin;
+            memcpy(out->zone_bias, r->zone_bias, sizeof(out->zone_bias));
+            return true;
+        default:
+            // Newer than this firmware (downgrade): field offsets up to
+            // our layout are stable by the rule above, so read what we
+            // know and ignore the tail.
+            if (r->version > CONFIG_VERSION) {
+                out->period_ms = r->period_ms;
+                out->verbose = r->verbose;
+                out->dwell_cycles = r->dwell_cycles;
+                out->conf_margin = r->conf_margin;
+                memcpy(out->zone_bias, r->zone_bias, sizeof(out->zone_bias));
+                return true;
+            }
+            return false;
+    }
+}
+
+#if QDNN_STATE_GUARD
+static void config_guard_reinit(void) {
+    RuntimeConfig fresh = s_defaults;
+    const ConfigRecord* rec = (const ConfigRecord*)(XIP_BASE + CONFIG_FLASH_OFFSET);
+    if (record_valid(rec)) migrate_record(rec, &fresh);
+    s_config = fresh;
+}
+#endif
+
+void config_init(const RuntimeConfig* defaults) {
+    s_config = *defaults;
+#if QDNN_STATE_GUARD
+    s_defaults = *defaults;
+#endif
+    const ConfigRecord* rec = (const ConfigRecord*)(XIP_BASE + CONFIG_FLASH_OFFSET);
+    if (record_valid(rec)) {
+        if (migrate_record(rec, &s_config)) {
+            if (rec->version != CONFIG_VERSION)
+                LogInfo(("config: v%u record migrated to v%u (flash rewritten "
+                         "at next store)", (unsigned)rec->version,
+                         (unsigned)CONFIG_VERSION));
+        } else {
+            LogWarn(("config: unknown record version %u, defaults active",
+                     (unsigned)rec->version));
+        }
+    }
+#if QDNN_STATE_GUARD
+    s_guard = state_guard_register("config", &s_config, sizeof(s_config),
+                                   config_guard_reinit, true);
+#endif
+}
+
+const RuntimeConfig* config_get(void) {
+    return &s_config;
+}
+
+static void config_flash_write(void* param) {
+    flash_range_erase(CONFIG_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(CONFIG_FLASH_OFFSET, (const uint8_t*)param, FLASH_PAGE_SIZE);
+}
+
+// Staged page for the deferred write; a re-store before the window
+// opens simply restages the latest values.
+static uint8_t s_page[FLASH_PAGE_SIZE];
+
+static void config_maint_op(void) {
+    if (flash_safe_execute(config_flash_write, s_page, 1000) != PICO_OK)
+        LogWarn(("config: flash write failed; RAM values active, flash stale"));
+}
+
+int config_store(const RuntimeConfig* cfg) {
+    ConfigRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = CONFIG_MAGIC;
+    rec.version = CONFIG_VERSION;
+    rec.period_ms = cfg->period_ms;
+    rec.verbose = cfg->verbose;
+    rec.dwell_cycles = cfg->dwell_cycles;
+    rec.conf_margin = cfg->conf_margin;
+    memcpy(rec.zone_bias, cfg->zone_bias, sizeof(rec.zone_bias));
+    rec.crc32 = crc32_sw((const uint8_t*)&rec, offsetof(ConfigRecord, crc32));
+    memset(s_page, 0xFF, sizeof(s_page));
+    memcpy(s_page, &rec, sizeof(rec));
+
+    if (!flash_maint_defer("conf", config_maint_op, 60)) return -1;
+
+    // RAM cache leads: the control path follows the new values now,
+    // the sector catches up in the idle window.
+    s_config = *cfg;
+#if QDNN_STATE_GUARD
+    state_guard_seal(s_guard);  // legitimate write, re-seal
+#endif
+    return 0;
+}
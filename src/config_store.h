@@ -0,0 +1,73 @@
+/**
+ * @file config_store.h
+ *
+ * @brief Versioned runtime configuration store (flash-backed, RAM-cached)
+ *
+ * The shell's runtime config (control period, verbose reporting, dwell
+ * filter depth) otherwise resets with the unit. This store persists it
+ * as one fixed-layout binary record - magic, schema version, CRC-32 -
+ * in its own flash sector just below the model banks: the boot load is
+ * a single XIP read plus a CRC over ~20 bytes (microseconds, no
+ * parsing), and a store rewrites the whole record, so the sector never
+ * accumulates fragments.
+ *
+ * Schema bumps are handled at load time: an older valid record is
+ * migrated field-by-field into the current struct (new fields take
+ * their compile-time defaults) and flash is left as-is until the next
+ * store rewrites it in the current layout. An unrecognized or corrupt
+ * record falls back to the compile-time defaults wholesale.
+ *
+ * The RAM copy is exposed const: the control tasks read it through the
+ * accessor (single aligned word reads), only config_store() mutates it.
+ * Like the calibration store, the RAM cache leads and the erase/program
+ * is deferred through flash_maint to the idle window between cycles.
+ */
+
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include "pico/stdlib.h"
+
+#include "board_profile.h"
+
+// Output classes a per-zone delta row covers (the four pump levels).
+// Part of the on-flash v3 layout - frozen, like BOARD_MAX_ZONES.
+#define CONFIG_ZONE_CLASSES 4
+
+/**
+ * @brief In-RAM runtime configuration used by the control tasks.
+ */
+struct RuntimeConfig {
+    uint32_t period_ms;     ///< control cycle period
+    uint8_t verbose;        ///< per-cycle human-readable report
+    uint8_t dwell_cycles;   ///< actuation dwell filter depth
+    uint8_t conf_margin;    ///< min top-2 logit gap to act on (0 = off)
+    /// Per-zone personalization deltas: signed logit-step biases added
+    /// to the shared pump model's output row before the argmax, so a
+    /// zone's soil type or sun exposure shifts its decision thresholds
+    /// for bytes instead of a 20 KB model copy. All-zero = identity.
+    int8_t zone_bias[BOARD_MAX_ZONES][CONFIG_ZONE_CLASSES];
+};
+
+/**
+ * @brief Load the persisted config into the RAM cache.
+ *
+ * Falls back to the compile-time defaults (seeded by the caller) when
+ * flash holds no valid record. Call once at boot, before
+ * cmd_shell_init() and before the control tasks start.
+ */
+void config_init(const RuntimeConfig* defaults);
+
+/**
+ * @brief Access the cached config (always valid after config_init()).
+ */
+const RuntimeConfig* config_get(void);
+
+/**
+ * @brief Persist a new config to flash and update the RAM cache.
+ *
+ * @return 0 on success, -1 on flash failure (RAM values still apply).
+ */
+int config_store(const RuntimeConfig* cfg);
+
+#endif
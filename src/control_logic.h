@@ -0,0 +1,964 @@
+/**
+ * @file control_logic.h
+ *
+ * @brief Hardware-independent control pipeline logic
+ *
+ * Pure functions shared between the firmware and the host-side
+ * simulator (sim/): soil calibration and conversion, level clamping
+ * and the scalar quantization helper. No Pico SDK or TFLM includes so
+ * the same code compiles unchanged on the host.
+ */
+
+#ifndef CONTROL_LOGIC_H
+#define CONTROL_LOGIC_H
+
+#include <stdint.h>
+
+#include "fixed_q.h"
+
+// --- Soil moisture calibration ---
+#define SOIL_DRY_RAW 4000
+#define SOIL_WET_RAW 1000
+
+/**
+ * @brief Convert a raw 12-bit soil ADC reading to moisture in 0.1% units.
+ *
+ * Pure integer math: the constant-divisor divide is strength-reduced by
+ * the compiler (and the RP2040 has a hardware divider regardless), so
+ * no float ops run on the conversion path.
+ */
+static inline int adc_to_percent10_cal(uint16_t raw, int dry_raw, int wet_raw) {
+    int p10 = (dry_raw - (int)raw) * 1000 / (dry_raw - wet_raw);
+    if (p10 < 0) p10 = 0;
+    if (p10 > 1000) p10 = 1000;
+    return p10;
+}
+
+static inline int adc_to_percent10(uint16_t raw) {
+    return adc_to_percent10_cal(raw, SOIL_DRY_RAW, SOIL_WET_RAW);
+}
+
+/**
+ * @brief Convert a raw 12-bit soil ADC reading to a 0-100% moisture value.
+ *
+ * Thin wrapper over the integer conversion: one float multiply at the
+ * edge where the model input needs a float feature.
+ */
+static inline float adc_to_percent(uint16_t raw) {
+    return adc_to_percent10(raw) * 0.1f;
+}
+
+/**
+ * @brief Clamp a predicted class to the 0-4 actuation level range.
+ */
+static inline int clamp_level(int level) {
+    if (level < 0) level = 0;
+    if (level > 4) level = 4;
+    return level;
+}
+
+// --- Hardcoded fallback policy (degradation ladder floor) ---
+// When the boot-loop ladder has shed inference itself, these bands
+// stand in for the models: crude threshold irrigation that keeps crops
+// alive on a controller that cannot trust its own flatbuffers. Bands
+// are deliberately conservative - they water a little early and cool a
+// little early - and live here so the simulator exercises the exact
+// policy the degraded firmware runs.
+
+/** @brief Fallback fan level from air temperature in 0.1 C units. */
+static inline int fallback_fan_level(int temp10) {
+    if (temp10 >= 360) return 4;
+    if (temp10 >= 330) return 3;
+    if (temp10 >= 310) return 2;
+    if (temp10 >= 290) return 1;
+    return 0;
+}
+
+/** @brief Fallback pump level from soil moisture in 0.1% units. */
+static inline int fallback_pump_level(int soil_pct10) {
+    if (soil_pct10 < 200) return 4;
+    if (soil_pct10 < 300) return 3;
+    if (soil_pct10 < 400) return 2;
+    if (soil_pct10 < 500) return 1;
+    return 0;
+}
+
+// --- Delta gating thresholds: below these, a new input frame is not a
+// meaningful change and inference can be skipped. Chosen under the
+// quantization step of the int8 models and the sensors' own noise
+// floor (DHT11 resolution is 1 C / 1 %RH).
+#define DELTA_TEMP_C    0.2f
+#define DELTA_HUMID_PCT 1.0f
+#define DELTA_SOIL_PCT  1.0f
+
+/**
+ * @brief True when the input frame moved enough since the last invoke
+ * to possibly change a model's decision. Order: temp, humid, soil_pct.
+ */
+static inline bool inputs_changed(const float prev[3], const float cur[3]) {
+    float dt = cur[0] - prev[0]; if (dt < 0) dt = -dt;
+    float dh = cur[1] - prev[1]; if (dh < 0) dh = -dh;
+    float ds = cur[2] - prev[2]; if (ds < 0) ds = -ds;
+    return dt > DELTA_TEMP_C || dh > DELTA_HUMID_PCT || ds > DELTA_SOIL_PCT;
+}
+
+// Same thresholds in 0.1-unit fixed point for the integer input path.
+#define DELTA_TEMP_DECI  2
+#define DELTA_HUMID_DECI 10
+#define DELTA_SOIL_DECI  10
+// Features past the base triple (hour-of-day, trend slopes) move in
+// much smaller deci-steps; 2 deci-units keeps the gate from re-invoking
+// on every 6-minute hour tick or a one-count slope wiggle.
+#define DELTA_EXTRA_DECI 2
+
+/**
+ * @brief Integer twin of inputs_changed() for deci-unit input frames.
+ *
+ * Rows wider than the base triple (metadata-driven features) compare
+ * the extra entries against DELTA_EXTRA_DECI.
+ */
+static inline bool inputs_changed10(const int16_t* prev, const int16_t* cur, int n = 3) {
+    int dt = cur[0] - prev[0]; if (dt < 0) dt = -dt;
+    int dh = cur[1] - prev[1]; if (dh < 0) dh = -dh;
+    int ds = cur[2] - prev[2]; if (ds < 0) ds = -ds;
+    if (dt > DELTA_TEMP_DECI || dh > DELTA_HUMID_DECI || ds > DELTA_SOIL_DECI) return true;
+    for (int i = 3; i < n; i++) {
+        int d = cur[i] - prev[i]; if (d < 0) d = -d;
+        if (d > DELTA_EXTRA_DECI) return true;
+    }
+    return false;
+}
+
+// --- Hysteresis / dwell filter on actuation level transitions ---
+// A newly proposed level must persist for LEVEL_DWELL_CYCLES consecutive
+// cycles before it is committed to the hardware, so single-cycle
+// excursions at a class boundary never toggle the fan or pump.
+#define LEVEL_DWELL_CYCLES 2
+
+struct LevelFilter {
+    int committed;  ///< level currently applied to the actuator
+    int candidate;  ///< level most recently proposed by the model
+    int streak;     ///< consecutive cycles the candidate has been proposed
+};
+
+static inline void level_filter_init(LevelFilter* f) {
+    f->committed = 0;
+    f->candidate = 0;
+    f->streak = 0;
+}
+
+/**
+ * @brief Feed one proposed level; returns the level to actually apply.
+ *
+ * dwell overrides LEVEL_DWELL_CYCLES for builds with a runtime config.
+ */
+static inline int level_filter_apply(LevelFilter* f, int proposed,
+                                     int dwell = LEVEL_DWELL_CYCLES) {
+    if (proposed == f->committed) {
+        f->candidate = f->committed;
+        f->streak = 0;
+        return f->committed;
+    }
+    if (proposed == f->candidate) {
+        f->streak++;
+    } else {
+        f->candidate = proposed;
+        f->streak = 1;
+    }
+    if (f->streak >= dwell) {
+        f->committed = f->candidate;
+        f->streak = 0;
+    }
+    return f->committed;
+}
+
+/**
+ * @brief Credit skipped cycles toward the pending candidate's dwell.
+ *
+ * The dwell counts cycles, but when the scheduler skips deadlines the
+ * wall time those cycles would have covered still passed - a pending
+ * pump change has already "dwelled" through them. Crediting the streak
+ * keeps the dose response time-correct under overruns instead of
+ * stretching with the load. A candidate equal to the committed level
+ * has nothing pending and the credit is a no-op.
+ */
+static inline void level_filter_credit(LevelFilter* f, int cycles) {
+    if (f->candidate == f->committed || f->streak == 0) return;
+    f->streak += cycles;
+}
+
+// --- Temporal dither: fractional average levels on a stepped output ---
+// The actuator only has the discrete bar-graph steps, but the average
+// over cycles can sit anywhere between them: a Q8 EMA of the committed
+// stream is the fractional target, and a first-order sigma-delta
+// accumulator schedules single-step alternation so the running mean
+// tracks it exactly (the residual never exceeds one step). Feeding it
+// the dwell filter's output keeps chatter suppression intact - the
+// dither turns each dwell-approved step change into a gradual duty
+// blend between the two adjacent levels instead of an edge. Integer
+// O(1) per actuator per cycle, no extra pins or PWM slices.
+#define LEVEL_DITHER_EMA_SHIFT 2  // fractional target alpha = 1/4
+
+struct LevelDither {
+    Q8 ema;          ///< smoothed target (level in Q8)
+    int32_t acc;     ///< sigma-delta residual, raw Q8, always in [0, 256)
+    bool primed;     ///< first sample seeds the EMA instead of blending
+};
+
+static inline void level_dither_init(LevelDither* d) {
+    d->ema = Q8::from_int(0);
+    d->acc = 0;
+    d->primed = false;
+}
+
+/**
+ * @brief Feed one committed level; returns the level to apply this
+ *        cycle (floor or floor+1 of the fractional target).
+ */
+static inline int level_dither_apply(LevelDither* d, int committed) {
+    Q8 c = Q8::from_int(committed);
+    if (!d->primed) {
+        d->ema = c;
+        d->primed = true;
+    } else {
+        // Snap inside the shift's dead band so a held level settles
+        // exactly and steady state never toggles the actuator.
+        int32_t diff = (c - d->ema).raw;
+        if (diff > -(1 << LEVEL_DITHER_EMA_SHIFT) &&
+            diff < (1 << LEVEL_DITHER_EMA_SHIFT))
+            d->ema = c;
+        else
+            q_ema_step(&d->ema, c, LEVEL_DITHER_EMA_SHIFT);
+    }
+    int base = d->ema.to_int_floor();  // levels are never negative
+    d->acc += d->ema.frac_raw();
+    if (d->acc >= 256) {
+        d->acc -= 256;
+        return base + 1;
+    }
+    return base;
+}
+
+// --- Per-signal history ring with O(1) incremental statistics ---
+// Fixed power-of-two capacity, integer arithmetic only (values in
+// 0.1-unit fixed point). Sum, EMA and the regression cross-sum update
+// incrementally on push; min/max scan the resident window on query,
+// which stays off the per-cycle path (trend features only). One noisy
+// DHT11 sample moves the EMA by a quarter of its excursion instead of
+// flipping the pump.
+#define SENSOR_HIST_CAPACITY 8   // power of two
+#define SENSOR_HIST_EMA_SHIFT 2  // EMA alpha = 1/4
+
+struct SensorHistory {
+    int16_t ring[SENSOR_HIST_CAPACITY];
+    uint32_t count;   ///< total pushes; write index = count & (cap-1)
+    int32_t sum;      ///< running sum of resident entries
+    Q8 ema;           ///< EMA of the 0.1-unit value
+    int32_t sxy;      ///< running sum of i*y[i] over the resident window
+};
+
+static inline void history_init(SensorHistory* h) {
+    h->count = 0;
+    h->sum = 0;
+    h->ema = Q8::from_int(0);
+    h->sxy = 0;
+}
+
+/**
+ * @brief Push one 0.1-unit sample: evict, add, fold into the EMA and
+ * the regression cross-sum. O(1).
+ */
+static inline void history_push(SensorHistory* h, int16_t v) {
+    uint32_t idx = h->count & (SENSOR_HIST_CAPACITY - 1);
+    if (h->count >= SENSOR_HIST_CAPACITY) {
+        // Evict y[0]: every remaining sample's x index slips by one
+        // (-(sum - old)), then the new sample lands at x = cap-1.
+        int32_t old = h->ring[idx];
+        h->sxy += old - h->sum + (int32_t)(SENSOR_HIST_CAPACITY - 1) * v;
+        h->sum -= old;
+    } else {
+        h->sxy += (int32_t)h->count * v;
+    }
+    h->ring[idx] = v;
+    h->sum += v;
+    h->count++;
+    if (h->count == 1) h->ema = Q8::from_int(v);
+    else q_ema_step(&h->ema, Q8::from_int(v), SENSOR_HIST_EMA_SHIFT);
+}
+
+/**
+ * @brief Resident-window mean in 0.1 units (0 before the first push).
+ */
+static inline int16_t history_mean(const SensorHistory* h) {
+    uint32_t n = h->count < SENSOR_HIST_CAPACITY ? h->count : SENSOR_HIST_CAPACITY;
+    return n ? (int16_t)(h->sum / (int32_t)n) : 0;
+}
+
+/**
+ * @brief Exponential moving average in 0.1 units - the filtered view
+ * the model input is drawn from.
+ */
+static inline int16_t history_ema(const SensorHistory* h) {
+    return (int16_t)h->ema.to_int_floor();
+}
+
+/**
+ * @brief Least-squares slope over the resident window, 0.1 units per
+ * window span.
+ *
+ * Closed-form over the running sums (the x sums are constants of n),
+ * so the per-query cost is a handful of multiplies and one divide -
+ * no pass over the ring. Scaled to the full window span (n-1 sample
+ * intervals) so the value stays resolvable in deci-units; a model's
+ * metadata scale absorbs the unit. 0 until two samples are resident.
+ */
+static inline int16_t history_slope10(const SensorHistory* h) {
+    int32_t n = h->count < SENSOR_HIST_CAPACITY ? (int32_t)h->count : SENSOR_HIST_CAPACITY;
+    if (n < 2) return 0;
+    // slope per sample = (n*Sxy - Sx*Sy) / (n*Sxx - Sx^2), x = 0..n-1
+    int32_t sx = n * (n - 1) / 2;
+    int32_t sxx = (n - 1) * n * (2 * n - 1) / 6;
+    int32_t num = n * h->sxy - sx * h->sum;
+    int32_t den = n * sxx - sx * sx;
+    return (int16_t)(num * (n - 1) / den);
+}
+
+/**
+ * @brief Min/max over the resident window (trend features; off the hot path).
+ */
+static inline void history_minmax(const SensorHistory* h, int16_t* min_out, int16_t* max_out) {
+    uint32_t n = h->count < SENSOR_HIST_CAPACITY ? h->count : SENSOR_HIST_CAPACITY;
+    if (n == 0) { *min_out = 0; *max_out = 0; return; }
+    int16_t mn = h->ring[0], mx = h->ring[0];
+    for (uint32_t i = 1; i < n; i++) {
+        if (h->ring[i] < mn) mn = h->ring[i];
+        if (h->ring[i] > mx) mx = h->ring[i];
+    }
+    *min_out = mn;
+    *max_out = mx;
+}
+
+// --- Humidity/soil cross-consistency fusion ---
+// Air humidity and a zone's soil moisture are physically coupled:
+// irrigation and rain move both up, drying weather moves both down. A
+// probe that has failed plausibly - still jittering, still in range,
+// so the stuck/rail check never fires - shows up as soil that moves
+// AGAINST the humidity trend for hours. The score is a bounded
+// sign-correlation over the per-cycle deltas of the two EMA streams:
+// cycles where both signals move beyond their noise deadbands either
+// build (co-movement) or drain (anti-movement) a saturating
+// accumulator; cycles where either is flat carry no evidence and
+// leave it alone, so a still night neither builds nor decays trust.
+// Anti-correlated moves are weighted double - they are the fault
+// signature, and a failing probe should drag the score down faster
+// than normal weather rebuilds it. Integer, O(1) per zone per cycle.
+//
+// Deadbands reuse the inference delta gates: below those, a move is
+// sensor noise by the same definition the invoke-skip logic uses.
+#define FUSION_SCORE_MAX 64  // saturation bound = full reliability
+
+struct FusionScore {
+    int16_t prev_h10;  ///< last humidity EMA folded in (0.1 %RH)
+    int16_t prev_s10;  ///< last soil EMA folded in (0.1 %)
+    int16_t score;     ///< bounded accumulator, -MAX..+MAX
+    bool primed;       ///< first sample seeds the deltas
+};
+
+static inline void fusion_init(FusionScore* f) {
+    f->prev_h10 = 0;
+    f->prev_s10 = 0;
+    f->score = FUSION_SCORE_MAX;  // boot trusts the hardware; evidence erodes it
+    f->primed = false;
+}
+
+/**
+ * @brief Fold one cycle's humidity and soil EMA values; returns the
+ *        updated cross-consistency score.
+ *
+ * Feed only cycles with a fresh humidity sample: a substituted value
+ * barely moves and would read as a flat (no-evidence) cycle anyway,
+ * but gating at the caller keeps the score's meaning clean.
+ */
+static inline int fusion_update(FusionScore* f, int16_t humid10, int16_t soil10) {
+    if (!f->primed) {
+        f->prev_h10 = humid10;
+        f->prev_s10 = soil10;
+        f->primed = true;
+        return f->score;
+    }
+    int dh = humid10 - f->prev_h10;
+    int ds = soil10 - f->prev_s10;
+    f->prev_h10 = humid10;
+    f->prev_s10 = soil10;
+    int ah = dh < 0 ? -dh : dh;
+    int as = ds < 0 ? -ds : ds;
+    if (ah > DELTA_HUMID_DECI && as > DELTA_SOIL_DECI) {
+        if ((dh > 0) == (ds > 0)) {
+            if (f->score < FUSION_SCORE_MAX) f->score++;
+        } else {
+            f->score -= 2;
+            if (f->score < -FUSION_SCORE_MAX) f->score = -FUSION_SCORE_MAX;
+        }
+    }
+    return f->score;
+}
+
+/**
+ * @brief Reliability weight in Q8 (0..256) from a fusion score.
+ *
+ * Negative scores - accumulated anti-correlation - are worth nothing;
+ * the positive half maps linearly onto full scale.
+ */
+static inline int fusion_weight_q8(int score) {
+    if (score <= 0) return 0;
+    return score * 256 / FUSION_SCORE_MAX;
+}
+
+/**
+ * @brief Air-substitution trust bound scaled by the reliability weight.
+ *
+ * Full corroboration (soil tracking humidity right up to the outage)
+ * keeps the full window; none halves it - the substituted value is
+ * then only as good as its age.
+ */
+static inline uint32_t stale_air_bound_ms(uint32_t base_ms, int weight_q8) {
+    return base_ms / 2 + (uint32_t)((base_ms / 2) * (uint32_t)weight_q8 / 256u);
+}
+
+// --- Adaptive sampling-rate governor ---
+// A fixed cadence oversamples a flat night and undersamples a noon
+// ventilation transient. The governor watches each signal's resident-
+// window span (max-min over the history ring: one integer standing in
+// for variance and derivative at this window size) and steers the
+// cycle period between two bounds: snap to the fast bound the moment
+// any signal is moving, creep back geometrically (+1/4 per cycle)
+// while everything is flat. Snap-down/creep-up means a transient is
+// never met at the slow rate twice, and every stretched quiet cycle
+// is real sleep time for the DVFS/tickless path.
+//
+// Activity thresholds: twice the inference delta gates, so the
+// governor only slows down when the models would be skipping invokes
+// anyway.
+#define GOV_TEMP_SPAN_DECI  (2 * DELTA_TEMP_DECI)
+#define GOV_HUMID_SPAN_DECI (2 * DELTA_HUMID_DECI)
+#define GOV_SOIL_SPAN_DECI  (2 * DELTA_SOIL_DECI)
+
+struct SampleGovernor {
+    uint32_t period_ms;  ///< period to use for the next cycle
+    uint32_t min_ms;     ///< fast bound (active signals)
+    uint32_t max_ms;     ///< slow bound (everything flat)
+};
+
+static inline void governor_init(SampleGovernor* g, uint32_t min_ms, uint32_t max_ms) {
+    if (max_ms < min_ms) max_ms = min_ms;
+    g->min_ms = min_ms;
+    g->max_ms = max_ms;
+    g->period_ms = min_ms;  // boot fast: learn the scene before slowing
+}
+
+/**
+ * @brief Force the fast bound immediately (out-of-band alert path).
+ */
+static inline void governor_snap(SampleGovernor* g) {
+    g->period_ms = g->min_ms;
+}
+
+/**
+ * @brief Feed one cycle's window spans (0.1 units, order: temp, humid,
+ * soil) and get the period to schedule the next cycle at.
+ */
+static inline uint32_t governor_update(SampleGovernor* g, const int16_t span10[3]) {
+    if (span10[0] > GOV_TEMP_SPAN_DECI || span10[1] > GOV_HUMID_SPAN_DECI ||
+        span10[2] > GOV_SOIL_SPAN_DECI) {
+        g->period_ms = g->min_ms;
+    } else {
+        uint32_t next = g->period_ms + g->period_ms / 4;
+        g->period_ms = next > g->max_ms ? g->max_ms : next;
+    }
+    return g->period_ms;
+}
+
+// --- Battery/solar energy budget governor ---
+// DVFS, dormant sleep, the adaptive cadence and radio batching each
+// save power on their own, but nothing stops them fighting - the
+// sampling governor happily snaps to its fast bound on a moving signal
+// while the battery is at its last volt. This governor makes supply
+// energy a managed resource with one owner: it watches the averaged
+// VSYS reading the ADC round-robin already carries (the brownout
+// detector's channel) and steps a three-state budget machine whose
+// state the other governors' ranges are clamped against - boost
+// profile allowed, cadence floor, uplink flush stretch.
+//
+// Band changes are debounced over whole control cycles in both
+// directions: the VSYS input is the sampler's IIR average, so a real
+// trend survives the debounce and a pump-inrush dip does not.
+// Acute-sag safety is not this module's job - the brownout watermark
+// fires from the sampler IRQ long before this machine would move.
+#define ENERGY_GOV_DEBOUNCE_CYCLES 3
+
+enum EnergyState {
+    ENERGY_STATE_OK = 0,    ///< budget healthy, no constraints
+    ENERGY_STATE_SAVER,     ///< derate: no boost, slower floor, lazier radio
+    ENERGY_STATE_CRITICAL,  ///< survive: slow bound pinned, radio minimal
+};
+
+struct EnergyGovernor {
+    uint8_t state;          ///< EnergyState in effect
+    uint8_t pending;        ///< candidate state being debounced
+    uint8_t pending_n;      ///< consecutive cycles the candidate held
+    uint16_t saver_mv;      ///< enter SAVER below this VSYS
+    uint16_t crit_mv;       ///< enter CRITICAL below this VSYS
+    uint16_t hyst_mv;       ///< extra recovery margin on the way up
+    uint16_t transitions;   ///< committed state changes (saturating)
+};
+
+static inline void energy_gov_init(EnergyGovernor* g, uint16_t saver_mv,
+                                   uint16_t crit_mv, uint16_t hyst_mv) {
+    g->state = ENERGY_STATE_OK;  // boot optimistic: one debounce window
+    g->pending = ENERGY_STATE_OK;
+    g->pending_n = 0;
+    g->saver_mv = saver_mv;
+    g->crit_mv = crit_mv;
+    g->hyst_mv = hyst_mv;
+    g->transitions = 0;
+}
+
+/**
+ * @brief Feed one cycle's averaged VSYS (mV); returns the state in effect.
+ *
+ * Thresholds classify downward as given; recovery additionally needs
+ * hyst_mv of margin per boundary, so a supply resting on a threshold
+ * never flaps the derates.
+ */
+static inline int energy_gov_update(EnergyGovernor* g, uint16_t vsys_mv) {
+    int band = ENERGY_STATE_OK;
+    if (vsys_mv < g->crit_mv) band = ENERGY_STATE_CRITICAL;
+    else if (vsys_mv < g->saver_mv) band = ENERGY_STATE_SAVER;
+
+    if (band < (int)g->state) {  // improving: demand the recovery margin
+        if (g->state >= ENERGY_STATE_SAVER && band < ENERGY_STATE_SAVER &&
+            vsys_mv < (uint16_t)(g->saver_mv + g->hyst_mv))
+            band = ENERGY_STATE_SAVER;
+        if (g->state >= ENERGY_STATE_CRITICAL && band < ENERGY_STATE_CRITICAL &&
+            vsys_mv < (uint16_t)(g->crit_mv + g->hyst_mv))
+            band = ENERGY_STATE_CRITICAL;
+    }
+
+    if (band == (int)g->state) {
+        g->pending = g->state;
+        g->pending_n = 0;
+    } else if (band != (int)g->pending) {
+        g->pending = (uint8_t)band;
+        g->pending_n = 1;
+    } else if (++g->pending_n >= ENERGY_GOV_DEBOUNCE_CYCLES) {
+        g->state = (uint8_t)band;
+        g->pending_n = 0;
+        if (g->transitions != 0xFFFF) g->transitions++;
+    }
+    return g->state;
+}
+
+/**
+ * @brief Cadence floor (ms) the budget state imposes on the cycle period.
+ *
+ * base_min/base_max are the sampling governor's bounds (or the shell
+ * period and a build-chosen ceiling on fixed-cadence builds): OK leaves
+ * the fast bound alone, SAVER doubles the floor, CRITICAL pins the
+ * slow bound - the activity snap still works inside whatever room the
+ * budget leaves.
+ */
+static inline uint32_t energy_gov_period_floor_ms(int state, uint32_t base_min,
+                                                  uint32_t base_max) {
+    uint32_t floor_ms = base_min;
+    if (state == ENERGY_STATE_SAVER) floor_ms = base_min * 2;
+    else if (state == ENERGY_STATE_CRITICAL) floor_ms = base_max;
+    return floor_ms > base_max ? base_max : floor_ms;
+}
+
+/** @brief Whether the boost clock profile is inside the budget. */
+static inline bool energy_gov_allow_boost(int state) {
+    return state == ENERGY_STATE_OK;
+}
+
+/** @brief Multiplier on the uplink flush deadline (1, 2 or 4). */
+static inline uint32_t energy_gov_uplink_scale(int state) {
+    if (state == ENERGY_STATE_CRITICAL) return 4;
+    return state == ENERGY_STATE_SAVER ? 2 : 1;
+}
+
+// --- Thermal guard for the boost clock profile ---
+// 250 MHz at 1.15 V in a sealed enclosure can walk the die past its
+// rated envelope on a hot afternoon, and nothing above the lab bench
+// proves otherwise. The guard watches the internal temperature sensor
+// the ADC round-robin already scans and withdraws the boost profile by
+// die temperature: derate trips immediately at the ceiling (heat only
+// accumulates while we wait), restore is debounced below a hysteresis
+// band so a die resting on the threshold never flaps the clock. The
+// input is the sampler's IIR average, so single-conversion noise
+// (~0.58 degC per ADC count) is already smoothed before it gets here.
+#define THERMAL_RESTORE_CYCLES 3
+
+/**
+ * @brief RP2040 internal sensor: averaged 12-bit reading to deci-degC.
+ *
+ * Datasheet transfer: T = 27 - (V - 0.706 V) / 1.721 mV, V against the
+ * 3.3 V reference. Integer-only; one raw count is ~0.58 degC, so the
+ * deci result's precision comes from the sampler's averaging.
+ */
+static inline int32_t adc_to_die_temp10(uint16_t raw) {
+    // Scaled by 16 so the conversion keeps sub-mV precision: truncating
+    // to whole mV first would cost up to ~0.6 degC of bias.
+    int32_t mv16 = (int32_t)raw * 3300 * 16 / 4096;
+    return 270 - (mv16 - 706 * 16) * 625 / 1721;
+}
+
+struct ThermalGuard {
+    uint8_t derated;         ///< boost currently withdrawn
+    uint8_t restore_n;       ///< consecutive cycles below the restore line
+    int16_t derate_temp10;   ///< withdraw boost at/above this (deci-degC)
+    int16_t hyst_temp10;     ///< restore only this far below the ceiling
+    uint16_t derates;        ///< derate events since boot (saturating)
+};
+
+static inline void thermal_guard_init(ThermalGuard* g, int16_t derate_temp10,
+                                      int16_t hyst_temp10) {
+    g->derated = 0;
+    g->restore_n = 0;
+    g->derate_temp10 = derate_temp10;
+    g->hyst_temp10 = hyst_temp10;
+    g->derates = 0;
+}
+
+/**
+ * @brief Feed one cycle's averaged die temperature (deci-degC).
+ *
+ * @return true while the boost profile is inside the thermal envelope.
+ */
+static inline bool thermal_guard_update(ThermalGuard* g, int32_t temp10) {
+    if (!g->derated) {
+        if (temp10 >= g->derate_temp10) {
+            g->derated = 1;
+            g->restore_n = 0;
+            if (g->derates != 0xFFFF) g->derates++;
+        }
+    } else if (temp10 < g->derate_temp10 - g->hyst_temp10) {
+        if (++g->restore_n >= THERMAL_RESTORE_CYCLES) {
+            g->derated = 0;
+            g->restore_n = 0;
+        }
+    } else {
+        g->restore_n = 0;
+    }
+    return !g->derated;
+}
+
+// --- Multi-unit actuation stagger on a shared supply ---
+// Tunnel chains share one supply, so simultaneous pump starts multiply
+// the inrush into a fleet-wide sag. With a common bus timebase
+// (bus_sync.h) each unit owns a phase slot inside a shared window and
+// holds rising pump commits to its next slot boundary - starts across
+// the fleet then land at least window/units apart. Held commits only:
+// stops and holds carry no inrush and go out immediately.
+
+/**
+ * @brief Milliseconds to hold a rising commit until this unit's slot.
+ *
+ * @param bus_ms    Shared bus time, ms (any common epoch).
+ * @param unit      This unit's slot index (0-based).
+ * @param units     Units sharing the bus (>= 1).
+ * @param window_ms Stagger window length; slot = unit * window / units.
+ * @return 0 when the slot is now, else the wait (< window_ms).
+ */
+static inline uint32_t stagger_hold_ms(uint64_t bus_ms, int unit, int units,
+                                       uint32_t window_ms) {
+    if (units <= 1 || window_ms == 0) return 0;
+    uint32_t slot = (uint32_t)((uint64_t)unit * window_ms / (uint32_t)units);
+    uint32_t pos = (uint32_t)(bus_ms % window_ms);
+    return (slot - pos + window_ms) % window_ms;
+}
+
+// --- Median-of-N despike stage for the raw soil ADC path ---
+// Pump inrush on the shared supply shows up as single-sample spikes
+// that a mean happily averages in; a median rejects up to
+// (MEDIAN_WINDOW-1)/2 outliers outright. Runs between the DMA sampler
+// and adc_to_percent*(): integer-only, and the window is held both in
+// arrival order (ring) and sorted order so each update is a bounded
+// delete + sorted insert - constant time at this window size, no sort.
+#define MEDIAN_WINDOW 5  // odd: the median is a real sample, no averaging
+
+struct MedianFilter {
+    uint16_t ring[MEDIAN_WINDOW];    ///< samples in arrival order
+    uint16_t sorted[MEDIAN_WINDOW];  ///< the same samples, ascending
+    uint32_t count;                  ///< total pushes; ring index = count % window
+};
+
+static inline void median_init(MedianFilter* m) {
+    m->count = 0;
+}
+
+/**
+ * @brief Push one raw sample and return the current median.
+ *
+ * Until the window fills, the median is taken over the samples seen so
+ * far, so the first cycles after boot are usable immediately.
+ */
+static inline uint16_t median_push(MedianFilter* m, uint16_t v) {
+    uint32_t n = m->count < MEDIAN_WINDOW ? m->count : MEDIAN_WINDOW;
+    uint32_t idx = m->count % MEDIAN_WINDOW;
+
+    if (n == MEDIAN_WINDOW) {
+        // Evict the oldest sample from the sorted view
+        uint16_t old = m->ring[idx];
+        uint32_t i = 0;
+        while (m->sorted[i] != old) i++;
+        for (; i + 1 < MEDIAN_WINDOW; i++) m->sorted[i] = m->sorted[i + 1];
+        n--;
+    }
+
+    // Sorted insert of the new sample
+    uint32_t i = n;
+    while (i > 0 && m->sorted[i - 1] > v) {
+        m->sorted[i] = m->sorted[i - 1];
+        i--;
+    }
+    m->sorted[i] = v;
+    n++;
+
+    m->ring[idx] = v;
+    m->count++;
+    return m->sorted[n / 2];
+}
+
+// --- Direct-mapped inference result cache ---
+// Three quantized int8 features span a tiny input space, and a stable
+// deployment revisits a handful of points for hours: caching the
+// predicted level per quantized input triple turns those invokes into
+// a 3-byte compare. Direct-mapped, no eviction policy - a conflicting
+// key simply overwrites, and a miss costs one hash plus the Invoke it
+// was going to run anyway. Must be re-initialized whenever the bound
+// model changes (the mapping is per-model). Keys are the base 3-feature
+// triple; wider metadata-driven inputs bypass the cache at the call
+// sites (the time/trend features would fragment the key space anyway).
+#define INFER_CACHE_SIZE 16  // entries, power of two
+
+struct InferCacheEntry {
+    uint8_t key[3];  ///< quantized input bytes (int8 stored as raw)
+    uint8_t valid;
+    int8_t level;    ///< cached argmax result
+    int8_t conf;     ///< winner's raw logit at store time (same model,
+                     ///  same key -> the Invoke would reproduce it)
+    int8_t margin;   ///< top-2 raw-logit gap at store time, 0..127
+};
+
+struct InferCache {
+    InferCacheEntry entry[INFER_CACHE_SIZE];
+    uint32_t hits;
+    uint32_t misses;
+};
+
+static inline void infer_cache_init(InferCache* c) {
+    for (uint32_t i = 0; i < INFER_CACHE_SIZE; i++) c->entry[i].valid = 0;
+    c->hits = 0;
+    c->misses = 0;
+}
+
+static inline uint32_t infer_cache_index(const uint8_t key[3]) {
+    uint32_t h = (uint32_t)key[0] * 31u + (uint32_t)key[1] * 131u + (uint32_t)key[2] * 197u;
+    return h & (INFER_CACHE_SIZE - 1);
+}
+
+/**
+ * @brief Look up a quantized input triple; counts the hit or miss.
+ *
+ * @return Cached level (>= 0) on a hit, -1 on a miss.
+ */
+static inline int infer_cache_lookup(InferCache* c, const uint8_t key[3],
+                                     int8_t* out_conf = nullptr,
+                                     int8_t* out_margin = nullptr) {
+    InferCacheEntry* e = &c->entry[infer_cache_index(key)];
+    if (e->valid && e->key[0] == key[0] && e->key[1] == key[1] && e->key[2] == key[2]) {
+        c->hits++;
+        if (out_conf != nullptr) *out_conf = e->conf;
+        if (out_margin != nullptr) *out_margin = e->margin;
+        return e->level;
+    }
+    c->misses++;
+    return -1;
+}
+
+static inline void infer_cache_store(InferCache* c, const uint8_t key[3], int level,
+                                     int8_t conf = 0, int8_t margin = 0) {
+    InferCacheEntry* e = &c->entry[infer_cache_index(key)];
+    e->key[0] = key[0];
+    e->key[1] = key[1];
+    e->key[2] = key[2];
+    e->level = (int8_t)level;
+    e->conf = conf;
+    e->margin = margin;
+    e->valid = 1;
+}
+
+// --- Argmax directly on raw output rows (no dequantization) ---
+// One templated loop per element type; the int8 instantiation is the
+// path every descriptor-conforming model takes (the descriptor
+// static_asserts in main.cpp pin that), the others exist for
+// bank-uploaded or float-fallback models. Host-pure so the simulator's
+// drift monitor can hold the integer scans against a dequantizing
+// float reference (qdnn_sim --drift).
+template <typename CellT>
+static inline int argmax_row(const CellT* row, int out_classes) {
+    int pred = 0;
+    CellT best = row[0];
+    for(int i=1;i<out_classes;i++)
+        if(row[i] > best) { best = row[i]; pred = i; }
+    return pred;
+}
+
+// Top-2 variant: same scan, also tracking the runner-up so the margin
+// (winner minus runner-up, in raw output quantization steps) falls out
+// of an integer subtraction - the confidence-aware hysteresis gets its
+// score gap without dequantizing anything. A single-class output has
+// no contender and reports the saturated margin.
+template <typename CellT>
+static inline int argmax2_row(const CellT* row, int out_classes, int8_t* margin_out) {
+    if (out_classes < 2) {
+        *margin_out = 127;
+        return 0;
+    }
+    int pred = 0;
+    CellT best = row[0], second = row[1];
+    if (second > best) { best = row[1]; second = row[0]; pred = 1; }
+    for (int i = 2; i < out_classes; i++) {
+        if (row[i] > best) { second = best; best = row[i]; pred = i; }
+        else if (row[i] > second) second = row[i];
+    }
+    int32_t m = (int32_t)(best - second);  // float fallback truncates
+    *margin_out = (int8_t)(m > 127 ? 127 : m);
+    return pred;
+}
+
+// --- Per-zone personalization: biased row scans ---
+// The config's delta rows shift one zone's decision thresholds by
+// adding signed logit-step biases to the shared model's output row
+// inside the scan: integer adds on the raw cells, no dequantization,
+// no per-zone model copy. The margin comes out in the same biased
+// space the decision was made in. Separate variants rather than a
+// branch in the plain scans: the identity case (no row) stays on the
+// untouched hot path.
+template <typename CellT>
+static inline int argmax_row_biased(const CellT* row, int out_classes,
+                                    const int8_t* bias) {
+    int pred = 0;
+    int32_t best = (int32_t)row[0] + bias[0];
+    for (int i = 1; i < out_classes; i++) {
+        int32_t v = (int32_t)row[i] + bias[i];
+        if (v > best) { best = v; pred = i; }
+    }
+    return pred;
+}
+
+template <typename CellT>
+static inline int argmax2_row_biased(const CellT* row, int out_classes,
+                                     const int8_t* bias, int8_t* margin_out) {
+    if (out_classes < 2) {
+        *margin_out = 127;
+        return 0;
+    }
+    int pred = 0;
+    int32_t best = (int32_t)row[0] + bias[0];
+    int32_t second = (int32_t)row[1] + bias[1];
+    if (second > best) { int32_t t = best; best = second; second = t; pred = 1; }
+    for (int i = 2; i < out_classes; i++) {
+        int32_t v = (int32_t)row[i] + bias[i];
+        if (v > best) { second = best; best = v; pred = i; }
+        else if (v > second) second = v;
+    }
+    int32_t m = best - second;
+    *margin_out = (int8_t)(m > 127 ? 127 : m);
+    return pred;
+}
+
+/**
+ * @brief Quantize one value with a precomputed reciprocal scale.
+ *
+ * Multiply-add with +/-0.5 rounding and an integer clamp - no division
+ * and no libm, matching the firmware's per-invoke input path.
+ */
+static inline int32_t quantize_scaled(float x, float inv_scale, int32_t zero_point,
+                                      int32_t qmin, int32_t qmax) {
+    float scaled = x * inv_scale;
+    int32_t q = (int32_t)(scaled + (scaled >= 0.0f ? 0.5f : -0.5f)) + zero_point;
+    if (q < qmin) q = qmin;
+    if (q > qmax) q = qmax;
+    return q;
+}
+
+/**
+ * @brief Quantize a 0.1-unit integer sensor value with a Q16 multiplier.
+ *
+ * mult10_q16 encodes 0.1/scale in 16.16 fixed point (computed once at
+ * tensor-allocation time), so the per-invoke work is one 32-bit
+ * multiply, an add and a shift - no float anywhere. Rounds to nearest;
+ * sensor values are non-negative so no negative-rounding correction is
+ * needed.
+ */
+static inline int32_t quantize_deci_q16(int32_t v10, int32_t mult10_q16, int32_t zero_point,
+                                        int32_t qmin, int32_t qmax) {
+    int32_t q = Q16::from_raw(mult10_q16).mul_int_round(v10) + zero_point;
+    if (q < qmin) q = qmin;
+    if (q > qmax) q = qmax;
+    return q;
+}
+
+/**
+ * @brief Unclamped core of quantize_deci_q16(), for callers that hand
+ * the clamp to hardware (the SIO interpolator batch path).
+ */
+static inline int32_t quantize_deci_q16_noclamp(int32_t v10, int32_t mult10_q16,
+                                                int32_t zero_point) {
+    return Q16::from_raw(mult10_q16).mul_int_round(v10) + zero_point;
+}
+
+/**
+ * @brief Batch-quantize deci-unit rows for an integer input tensor.
+ *
+ * Quantizes n_rows x n_f values (row-major) in one call, shaped for
+ * the M0+ pipeline, which has neither a widening multiply nor
+ * saturating ops: the walk is feature-outer so each feature's
+ * multiplier, offset and split halves are hoisted into registers (the
+ * per-element code paid a software modulo per value just to index
+ * them), the 16.16 multiply is two single-cycle 32-bit MULS on the
+ * split halves instead of a 64-bit libgcc call, and the clamp is
+ * branchless sign-mask arithmetic. Bit-exact with quantize_deci_q16()
+ * as long as the offset-corrected value fits 16 bits, which deci-unit
+ * sensor readings do by orders of magnitude.
+ *
+ * Bytes are stored raw, so the same routine serves int8 and uint8
+ * tensors - qmin/qmax carry the range.
+ */
+static inline void quantize_rows10(const int16_t* rows10, int n_rows, int n_f,
+                                   const int32_t* mult10_q16, const int16_t* off10,
+                                   int32_t zero_point, int32_t qmin, int32_t qmax,
+                                   uint8_t* out) {
+    for (int f = 0; f < n_f; f++) {
+        const int32_t mhi = mult10_q16[f] >> 16;
+        const int32_t mlo = mult10_q16[f] & 0xFFFF;
+        const int32_t off = off10[f];
+        const int16_t* src = rows10 + f;
+        uint8_t* dst = out + f;
+        for (int r = 0; r < n_rows; r++) {
+            int32_t v = (int32_t)*src - off;
+            // (v * mult + 2^15) >> 16, reassembled from the halves
+            int32_t q = v * mhi + ((v * mlo + (1 << 15)) >> 16) + zero_point;
+            int32_t d = q - qmin;
+            q = qmin + (d & ~(d >> 31));
+            d = qmax - q;
+            q = qmax - (d & ~(d >> 31));
+            *dst = (uint8_t)q;
+            src += n_f;
+            dst += n_f;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file crash_dump.cpp
+ *
+ * @brief Crash postmortem capture implementation
+ *
+ * The flash write in a fault context cannot use flash_safe_execute():
+ * nothing can be negotiated with the other core from here. Interrupts
+ * go off, the sector is erased and programmed directly, and the
+ * watchdog reboot follows immediately - if core 1 was fetching XIP
+ * during the write it wedges for the few milliseconds until the reset,
+ * which is an acceptable price on the way down.
+ */
+
+#include "crash_dump.h"
+
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "hardware/watchdog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "app_log.h"
+
+// Second-to-last sector; the last one holds the soil calibration.
+#define CRASH_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - 2 * FLASH_SECTOR_SIZE)
+#define CRASH_RECORD_MAGIC 0xDEAD51C0u
+#define CRASH_RECORD_VERSION 1
+
+static_assert(sizeof(CrashRecord) <= FLASH_PAGE_SIZE, "record must fit one page");
+
+static const CrashRecord* stored_record(void) {
+    return (const CrashRecord*)(XIP_BASE + CRASH_FLASH_OFFSET);
+}
+
+// Fill the fields every capture shares: task, heap mark, uptime.
+static void fill_common(CrashRecord* rec, CrashKind kind) {
+    memset(rec, 0xFF, sizeof(*rec));
+    rec->magic = CRASH_RECORD_MAGIC;
+    rec->version = CRASH_RECORD_VERSION;
+    rec->kind = (uint8_t)kind;
+    memset(rec->task, 0, sizeof(rec->task));
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        const char* name = pcTaskGetName(NULL);
+        for (size_t i = 0; i + 1 < sizeof(rec->task) && name[i]; i++) rec->task[i] = name[i];
+    }
+    rec->min_free_heap = (uint32_t)xPortGetMinimumEverFreeHeapSize();
+    rec->uptime_ms = to_ms_since_boot(get_absolute_time());
+}
+
+// Write the record and reset. No return.
+static void __attribute__((noreturn)) commit_and_reboot(const CrashRecord* rec) {
+    save_and_disable_interrupts();
+
+    uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0xFF, sizeof(page));
+    memcpy(page, rec, sizeof(*rec));
+
+    flash_range_erase(CRASH_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(CRASH_FLASH_OFFSET, page, sizeof(page));
+
+    watchdog_reboot(0, 0, 10);
+    while (true) __wfi();
+}
+
+// Hardfault entry: the core pushed r0-r3, r12, lr, pc, psr at sp.
+extern "C" void crash_dump_hardfault(const uint32_t* stacked_frame) {
+    static CrashRecord rec;  // fault context: keep the fault stack shallow
+    fill_common(&rec, CRASH_KIND_HARDFAULT);
+    rec.r0 = stacked_frame[0];
+    rec.r1 = stacked_frame[1];
+    rec.r2 = stacked_frame[2];
+    rec.r3 = stacked_frame[3];
+    rec.r12 = stacked_frame[4];
+    rec.lr = stacked_frame[5];
+    rec.pc = stacked_frame[6];
+    rec.psr = stacked_frame[7];
+    rec.sp = (uint32_t)stacked_frame;
+    commit_and_reboot(&rec);
+}
+
+// Override the SDK's weak hardfault vector: recover the active stack
+// pointer and hand the stacked frame to the C capture path.
+extern "C" void __attribute__((naked)) isr_hardfault(void) {
+    __asm volatile(
+        "movs r0, #4        \n"
+        "mov  r1, lr        \n"
+        "tst  r0, r1        \n"  // EXC_RETURN bit 2: which stack was live
+        "beq  1f            \n"
+        "mrs  r0, psp       \n"
+        "b    2f            \n"
+        "1: mrs r0, msp     \n"
+        "2: ldr r1, =crash_dump_hardfault \n"
+        "bx   r1            \n");
+}
+
+extern "C" void __attribute__((noreturn)) crash_dump_assert(const char* file, int line) {
+    static CrashRecord rec;
+    fill_common(&rec, CRASH_KIND_ASSERT);
+    rec.line = (uint16_t)line;
+
+    // Keep the basename only: full paths blow the 32-byte field
+    const char* base = file;
+    for (const char* p = file; *p; p++)
+        if (*p == '/' || *p == '\\') base = p + 1;
+    for (size_t i = 0; i + 1 < sizeof(rec.file) && base[i]; i++) rec.file[i] = base[i];
+
+    commit_and_reboot(&rec);
+}
+
+bool crash_dump_check(void) {
+    const CrashRecord* rec = stored_record();
+    if (rec->magic != CRASH_RECORD_MAGIC || rec->version != CRASH_RECORD_VERSION)
+        return false;
+
+    if (rec->kind == CRASH_KIND_ASSERT) {
+        LogError(("postmortem: assert %s:%u in task '%s', uptime %u ms, min heap %u",
+                  rec->file, rec->line, rec->task,
+                  (unsigned)rec->uptime_ms, (unsigned)rec->min_free_heap));
+    } else {
+        LogError(("postmortem: hardfault pc=%08x lr=%08x psr=%08x sp=%08x task '%s'",
+                  (unsigned)rec->pc, (unsigned)rec->lr, (unsigned)rec->psr,
+                  (unsigned)rec->sp, rec->task));
+        LogError(("postmortem: r0=%08x r1=%08x r2=%08x r3=%08x r12=%08x uptime %u ms",
+                  (unsigned)rec->r0, (unsigned)rec->r1, (unsigned)rec->r2,
+                  (unsigned)rec->r3, (unsigned)rec->r12, (unsigned)rec->uptime_ms));
+    }
+
+    // One-shot: clear so the next boot doesn't re-report it
+    uint32_t save = save_and_disable_interrupts();
+    flash_range_erase(CRASH_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    restore_interrupts(save);
+    return true;
+}
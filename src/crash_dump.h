@@ -0,0 +1,65 @@
+/**
+ * @file crash_dump.h
+ *
+ * @brief Hardfault/assert postmortem capture to a reserved flash sector
+ *
+ * A unit that crashes in the field leaves its last moments in flash
+ * instead of on a USB console nobody is watching: the hardfault
+ * handler and the assert hook snapshot the stacked exception frame,
+ * the running task name and the heap low-water mark into the
+ * second-to-last flash sector (the last one belongs to the soil
+ * calibration), then force a watchdog reboot. On the next boot
+ * crash_dump_check() emits the record through the log stream and
+ * clears the sector.
+ *
+ * The capture path is deliberately minimal: registers into a packed
+ * struct, one erase, one program, interrupts off throughout. It runs
+ * from a fault context, so it uses no RTOS services beyond reading the
+ * current task's name.
+ */
+
+#ifndef CRASH_DUMP_H
+#define CRASH_DUMP_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief What tripped the capture.
+ */
+enum CrashKind : uint8_t {
+    CRASH_KIND_HARDFAULT = 1,
+    CRASH_KIND_ASSERT    = 2,
+};
+
+/**
+ * @brief One crash record as stored in flash (one page).
+ */
+struct __attribute__((packed)) CrashRecord {
+    uint32_t magic;          ///< CRASH_RECORD_MAGIC
+    uint8_t  version;        ///< record layout version
+    uint8_t  kind;           ///< CrashKind
+    uint16_t line;           ///< assert line number (asserts only)
+    uint32_t r0, r1, r2, r3; ///< stacked exception frame (hardfaults only)
+    uint32_t r12, lr, pc, psr;
+    uint32_t sp;             ///< stack pointer at capture
+    char     task[8];        ///< running task name, NUL-padded
+    char     file[32];       ///< assert file basename (asserts only)
+    uint32_t min_free_heap;  ///< heap low-water mark at capture
+    uint32_t uptime_ms;      ///< milliseconds since boot at capture
+};
+
+/**
+ * @brief Emit and clear any stored crash record. Call once at boot.
+ *
+ * @return true if a record was found and emitted.
+ */
+bool crash_dump_check(void);
+
+/**
+ * @brief Assert hook: capture, then watchdog-reboot. Does not return.
+ *
+ * C linkage: configASSERT in the (C) kernel routes here.
+ */
+extern "C" void __attribute__((noreturn)) crash_dump_assert(const char* file, int line);
+
+#endif
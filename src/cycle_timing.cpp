@@ -0,0 +1,121 @@
+/**
+ * @file cycle_timing.cpp
+ *
+ * @brief Timing histogram storage and recording
+ */
+
+#include "cycle_timing.h"
+
+#include <string.h>
+
+#if QDNN_TRACE_RING
+#include "hardware/sync.h"
+#endif
+
+static TimingHist s_hist[TIMING_SITE_COUNT];
+static uint32_t s_over_budget[TIMING_SITE_COUNT];
+
+static const char* const s_site_name[TIMING_SITE_COUNT] = {
+    "dht", "soil", "infer", "pump", "act", "anom", "e2e", "pwr",
+};
+
+#if QDNN_TRACE_RING
+// All scoped timers run in core-0 tasks, so a short IRQ-off window is
+// enough to keep the index bump and slot write atomic against
+// preemption - no spinlock, no cross-core traffic.
+static TraceEvent s_ev[TRACE_RING_EVENTS];
+static uint32_t s_ev_head;               // free-running, masked on use
+static volatile uint8_t s_frozen;        // TraceFreezeReason, 0 = armed
+static uint32_t s_frozen_t_us;
+static uint32_t s_watch_us[TIMING_SITE_COUNT];
+
+static void trace_ring_note(uint8_t site, uint32_t dur_us) {
+    if (s_frozen) return;  // capture parked until the dump re-arms it
+    uint32_t irq = save_and_disable_interrupts();
+    TraceEvent* e = &s_ev[s_ev_head & (TRACE_RING_EVENTS - 1)];
+    s_ev_head++;
+    e->t_us = time_us_32();
+    e->dur_us = dur_us;
+    e->site = site;
+    restore_interrupts(irq);
+    if (s_watch_us[site] != 0 && dur_us >= s_watch_us[site])
+        trace_ring_freeze(TRACE_FREEZE_WATCH);
+}
+
+void trace_ring_freeze(uint8_t reason) {
+    if (s_frozen || reason == TRACE_FREEZE_NONE) return;
+    s_frozen_t_us = time_us_32();
+    s_frozen = reason;
+}
+
+bool trace_ring_frozen(void) {
+    return s_frozen != 0;
+}
+
+int trace_ring_snapshot(TraceEvent* out, int max, uint8_t* reason,
+                        uint32_t* frozen_t_us) {
+    if (!s_frozen || max <= 0) return 0;
+    uint32_t n = s_ev_head < TRACE_RING_EVENTS ? s_ev_head : TRACE_RING_EVENTS;
+    if (n > (uint32_t)max) n = (uint32_t)max;
+    uint32_t start = s_ev_head - n;  // keep the newest events
+    for (uint32_t i = 0; i < n; i++)
+        out[i] = s_ev[(start + i) & (TRACE_RING_EVENTS - 1)];
+    *reason = s_frozen;
+    *frozen_t_us = s_frozen_t_us;
+    s_ev_head = 0;
+    s_frozen = 0;  // re-arm
+    return (int)n;
+}
+
+void trace_ring_watch(int site, uint32_t threshold_us) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return;
+    s_watch_us[site] = threshold_us;
+}
+
+uint32_t trace_ring_watch_get(int site) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return 0;
+    return s_watch_us[site];
+}
+#endif  // QDNN_TRACE_RING
+
+void cycle_timing_record(int site, uint32_t elapsed_us) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return;
+    TimingHist* h = &s_hist[site];
+
+    // bin k covers [2^(k-1), 2^k) us; 0 us lands in bin 0, anything
+    // past the table saturates into the last bin
+    int bin = (elapsed_us == 0) ? 0 : 32 - __builtin_clz(elapsed_us);
+    if (bin >= TIMING_HIST_BINS) bin = TIMING_HIST_BINS - 1;
+
+    h->bins[bin]++;
+    h->count++;
+    h->total_us += elapsed_us;
+    if (elapsed_us > h->max_us) h->max_us = elapsed_us;
+    // Budget 0 means "unbudgeted observation site" (e2e), not "always over"
+    if (TIMING_BUDGET_US[site] != 0 && elapsed_us > TIMING_BUDGET_US[site])
+        s_over_budget[site]++;
+
+#if QDNN_TRACE_RING
+    trace_ring_note((uint8_t)site, elapsed_us);
+#endif
+}
+
+const TimingHist* cycle_timing_get(int site) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return NULL;
+    return &s_hist[site];
+}
+
+uint32_t cycle_timing_over_budget(int site) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return 0;
+    return s_over_budget[site];
+}
+
+const char* cycle_timing_site_name(int site) {
+    if (site < 0 || site >= TIMING_SITE_COUNT) return "?";
+    return s_site_name[site];
+}
+
+void cycle_timing_reset(void) {
+    memset(s_hist, 0, sizeof(s_hist));
+    memset(s_over_budget, 0, sizeof(s_over_budget));
+}
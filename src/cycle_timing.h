@@ -0,0 +1,193 @@
+/**
+ * @file cycle_timing.h
+ *
+ * @brief Scoped hot-path timers with per-site log2 histograms
+ *
+ * Answers "where does the cycle budget actually go" with numbers: each
+ * instrumented region takes a time_us_64() pair and drops the elapsed
+ * microseconds into a fixed per-site histogram in .bss. Bins are
+ * powers of two (bin k covers [2^(k-1), 2^k) us), so one 16-bin table
+ * spans 32 us to 32 ms and a latency regression shows up as mass
+ * shifting right - no floats, no allocation, ~1 us per scope.
+ *
+ * Enabled per build with QDNN_CYCLE_TIMING; the TIMING_SCOPE macro
+ * compiles to nothing otherwise. Export is on demand: the shell's
+ * "timing" command prints the tables and ships them as telemetry
+ * frames (SOF 0xA9, one per site).
+ *
+ * Counters are plain uint32 with one writer per site (the task that
+ * owns the region); the shell's reads may race a push and see a
+ * mid-update snapshot, which is benign for histograms.
+ */
+
+#ifndef CYCLE_TIMING_H
+#define CYCLE_TIMING_H
+
+#include "pico/stdlib.h"
+
+/** @brief Instrumented sites, one histogram each. */
+enum TimingSite {
+    TIMING_SITE_DHT = 0,  ///< DHT11 poll/retry wait in the sensor task
+    TIMING_SITE_SOIL,     ///< soil ADC sweep + filtering, all zones
+    TIMING_SITE_INFER,    ///< fan (or combo) quantize + Invoke + argmax
+    TIMING_SITE_PUMP,     ///< wait for core 1's pump results
+    TIMING_SITE_ACT,      ///< actuation staging: dwell/dither pass
+    TIMING_SITE_ANOM,     ///< second-stage anomaly detector Invoke
+    TIMING_SITE_E2E,      ///< acquisition stamp to actuation commit
+    TIMING_SITE_PWR,      ///< clock-profile switch (settle + retune)
+    TIMING_SITE_COUNT
+};
+
+// --- Per-site worst-case budgets ---
+// Each instrumented stage declares the worst case it is allowed to
+// cost, in microseconds, so "does the control loop fit" is summed at
+// compile time (main.cpp static_asserts timing_budget_total() against
+// the configured period) instead of discovered in the field. The
+// defaults encode each stage's bounding mechanism - the DHT retry
+// policy, the invoke deadline - and are overridable per deployment
+// from the build. The runtime half: every recorded scope is compared
+// against its budget and an over-budget counter ticks, so a stage that
+// outgrows its declaration shows up in the "timing" report long before
+// the sum stops fitting.
+#ifndef TIMING_BUDGET_DHT_US
+#define TIMING_BUDGET_DHT_US 120000  // DHT_RETRY_MAX transactions + backoff
+#endif
+#ifndef TIMING_BUDGET_SOIL_US
+#define TIMING_BUDGET_SOIL_US 1000   // accumulator reads + median, all zones
+#endif
+#ifndef TIMING_BUDGET_INFER_US
+#define TIMING_BUDGET_INFER_US 250000  // bounded by the invoke deadline
+#endif
+#ifndef TIMING_BUDGET_PUMP_US
+#define TIMING_BUDGET_PUMP_US 250000   // core 1 wait, same deadline bound
+#endif
+#ifndef TIMING_BUDGET_ACT_US
+#define TIMING_BUDGET_ACT_US 1000    // dwell filters + one masked SIO store
+#endif
+#ifndef TIMING_BUDGET_ANOM_US
+#define TIMING_BUDGET_ANOM_US 250000   // second-stage invoke, same deadline
+#endif
+// The end-to-end site measures the sensing-to-actuation latency per
+// cycle sequence number - it spans every stage plus the queues, so it
+// is an observation, not a schedulable stage. Budget 0 = unbudgeted:
+// excluded from the over-budget check and a zero term in the
+// schedulability sum below.
+#ifndef TIMING_BUDGET_E2E_US
+#define TIMING_BUDGET_E2E_US 0
+#endif
+// A DVFS edge is regulator settle (500 us) plus PLL lock, XIP
+// redivide and SysTick retune; two edges open and close each work
+// window, each measured as one recording against this bound. A
+// transition that outgrows it means the switch sequencing regressed
+// and is eating the savings it was meant to buy.
+#ifndef TIMING_BUDGET_PWR_US
+#define TIMING_BUDGET_PWR_US 2000
+#endif
+
+constexpr uint32_t TIMING_BUDGET_US[] = {
+    TIMING_BUDGET_DHT_US,  TIMING_BUDGET_SOIL_US, TIMING_BUDGET_INFER_US,
+    TIMING_BUDGET_PUMP_US, TIMING_BUDGET_ACT_US,  TIMING_BUDGET_ANOM_US,
+    TIMING_BUDGET_E2E_US,  TIMING_BUDGET_PWR_US,
+};
+static_assert(sizeof(TIMING_BUDGET_US) / sizeof(TIMING_BUDGET_US[0]) ==
+                  TIMING_SITE_COUNT,
+              "every timing site declares a budget");
+
+/** @brief Summed worst case of all stages, us (the schedulability bound). */
+constexpr uint32_t timing_budget_total() {
+    uint32_t sum = 0;
+    for (uint32_t b : TIMING_BUDGET_US) sum += b;
+    return sum;
+}
+
+#define TIMING_HIST_BINS 16
+
+/** @brief One site's accumulated distribution since boot (or reset). */
+struct TimingHist {
+    uint32_t bins[TIMING_HIST_BINS];
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t total_us;
+};
+
+/** @brief Record one elapsed measurement for a site. */
+void cycle_timing_record(int site, uint32_t elapsed_us);
+
+/** @brief Read-only view of a site's histogram. */
+const TimingHist* cycle_timing_get(int site);
+
+/** @brief Recordings that exceeded the site's declared budget. */
+uint32_t cycle_timing_over_budget(int site);
+
+/** @brief Short site name for reports ("dht", "soil", ...). */
+const char* cycle_timing_site_name(int site);
+
+/** @brief Zero all histograms (e.g. after a config change). */
+void cycle_timing_reset(void);
+
+#if QDNN_CYCLE_TIMING
+/** @brief RAII scope: records on exit, whatever the exit path. */
+struct TimingScope {
+    int site;
+    uint64_t t0;
+    explicit TimingScope(int s) : site(s), t0(time_us_64()) {}
+    ~TimingScope() { cycle_timing_record(site, (uint32_t)(time_us_64() - t0)); }
+};
+#define TIMING_SCOPE(site) TimingScope _scope_##site(site)
+#else
+#define TIMING_SCOPE(site) ((void)0)
+#endif
+
+#if QDNN_TRACE_RING
+/*
+ * Flight recorder over the scoped timers. The histograms say how often
+ * cycles are slow; they cannot say what a particular slow cycle did.
+ * Every TimingScope exit therefore also appends a compact event (site,
+ * exit stamp, duration) to a small RAM ring - a masked store and an
+ * index bump, so it stays on at field cost. When a trigger fires (a
+ * whole cycle deadline blown, a watched site exceeding its threshold,
+ * or the shell), the ring freezes: writers drop events, the captured
+ * tail is shipped as one telemetry frame (SOF 0xB3) by the report
+ * task, and the ring re-arms. Every p99.9 cycle thus arrives with the
+ * causal trace that produced it.
+ */
+
+#define TRACE_RING_EVENTS 32
+
+/** @brief Why the ring froze (carried in the 0xB3 frame). */
+enum TraceFreezeReason {
+    TRACE_FREEZE_NONE = 0,
+    TRACE_FREEZE_OVERRUN,  ///< cycle blew one or more whole deadlines
+    TRACE_FREEZE_WATCH,    ///< a watched site exceeded its threshold
+    TRACE_FREEZE_SHELL,    ///< manual capture ("watch freeze")
+};
+
+/** @brief One scope exit. Stamps are 32-bit; the host unwraps. */
+struct TraceEvent {
+    uint32_t t_us;    ///< scope exit time
+    uint32_t dur_us;  ///< elapsed inside the scope
+    uint8_t site;     ///< TimingSite
+};
+
+/** @brief Freeze the ring (idempotent; first reason wins). */
+void trace_ring_freeze(uint8_t reason);
+
+/** @brief Whether a frozen capture is waiting to be dumped. */
+bool trace_ring_frozen(void);
+
+/**
+ * @brief Drain a frozen capture, oldest event first, and re-arm.
+ *
+ * @return Number of events copied out, 0 if the ring is not frozen.
+ */
+int trace_ring_snapshot(TraceEvent* out, int max, uint8_t* reason,
+                        uint32_t* frozen_t_us);
+
+/** @brief Arm a per-site duration threshold in us (0 disarms). */
+void trace_ring_watch(int site, uint32_t threshold_us);
+
+/** @brief Current threshold for a site (0 = not watched). */
+uint32_t trace_ring_watch_get(int site);
+#endif
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * @file datalog.cpp
+ *
+ * @brief Flash-resident circular datalogger implementation
+ *
+ * Sector layout: an 8-byte header (magic + sequence number), then
+ * frame bytes packed back to back, 0xFF fill after the last one (the
+ * decoder skips fill - no valid SOF starts with 0xFF). Sequence
+ * numbers increase monotonically across sectors, so the newest sector
+ * is the one with the highest sequence and the sweep order on dump is
+ * oldest first from there.
+ */
+
+#include "datalog.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "pico/flash.h"
+
+#include "app_log.h"
+#include "flash_maint.h"
+
+// Region sits just below the crash-dump and calibration sectors
+#define DATALOG_FLASH_OFFSET \
+    (PICO_FLASH_SIZE_BYTES - (2 + DATALOG_SECTORS) * FLASH_SECTOR_SIZE)
+
+#define DATALOG_MAGIC 0xD106D106u
+
+struct SectorHeader {
+    uint32_t magic;
+    uint32_t seq;
+};
+
+#define SECTOR_PAYLOAD (FLASH_SECTOR_SIZE - sizeof(SectorHeader))
+
+// RAM sector staging, in a reset-retained section: a brown-out or
+// watchdog reset otherwise loses up to ~4 KB of tee'd frames that were
+// waiting for the idle-window commit. The staging lives in
+// .uninitialized_data with its own magic, and init re-adopts the tail
+// only when the retained sequence/slot still line up with the flash
+// scan - a mismatch (power-on garbage, a commit that completed right
+// before the reset) discards it rather than duplicating or corrupting.
+// Appends write payload first and bump `fill` last, so a reset tearing
+// an append loses exactly that frame and nothing staged before it.
+#define STAGE_MAGIC 0xD7A11D06u
+
+struct StageRetained {
+    uint32_t magic;
+    uint32_t fill;       // payload bytes staged after the header
+    uint32_t next_seq;   // sequence for the sector being staged
+    uint32_t next_slot;  // region slot that sector will land in
+    uint8_t buf[FLASH_SECTOR_SIZE];  // header staged at the front
+};
+
+static StageRetained __uninitialized_ram(s_stage);
+#define s_buf       (s_stage.buf)
+#define s_fill      (s_stage.fill)
+#define s_next_seq  (s_stage.next_seq)
+#define s_next_slot (s_stage.next_slot)
+
+static bool s_commit_pending;  // sector staged, waiting for the idle window
+
+static const SectorHeader* sector_at(uint32_t slot) {
+    return (const SectorHeader*)(XIP_BASE + DATALOG_FLASH_OFFSET +
+                                 slot * FLASH_SECTOR_SIZE);
+}
+
+void datalog_init(void) {
+    // Newest = highest sequence among valid sectors; empty region
+    // starts at slot 0, sequence 1 (0 is never used, so a blank
+    // header can't alias a real one).
+    uint32_t best_seq = 0, best_slot = 0;
+    for (uint32_t slot = 0; slot < DATALOG_SECTORS; slot++) {
+        const SectorHeader* h = sector_at(slot);
+        if (h->magic == DATALOG_MAGIC && h->seq > best_seq) {
+            best_seq = h->seq;
+            best_slot = slot;
+        }
+    }
+    uint32_t next_seq = best_seq + 1;
+    uint32_t next_slot = (best_seq == 0) ? 0 : (best_slot + 1) % DATALOG_SECTORS;
+
+    if (s_stage.magic == STAGE_MAGIC && s_next_seq == next_seq &&
+        s_next_slot == next_slot && s_fill <= SECTOR_PAYLOAD) {
+        LogInfo(("datalog: %u staged bytes survived the reset",
+                 (unsigned)s_fill));
+    } else {
+        s_stage.magic = STAGE_MAGIC;
+        s_next_seq = next_seq;
+        s_next_slot = next_slot;
+        s_fill = 0;
+    }
+}
+
+static void datalog_flash_commit(void* param) {
+    uint32_t offset = DATALOG_FLASH_OFFSET + s_next_slot * FLASH_SECTOR_SIZE;
+    flash_range_erase(offset, FLASH_SECTOR_SIZE);
+    flash_range_program(offset, (const uint8_t*)param, FLASH_SECTOR_SIZE);
+}
+
+// Runs in the report task's idle window via flash_maint: the erase
+// stalls XIP for both cores, so it must never land mid-cycle.
+static void datalog_maint_op(void) {
+    if (flash_safe_execute(datalog_flash_commit, s_buf, 1000) != PICO_OK) {
+        // Keep the data staged; the next full buffer retries this slot
+        LogWarn(("datalog: sector commit failed, will retry"));
+        s_commit_pending = false;
+        return;
+    }
+    s_next_seq++;
+    s_next_slot = (s_next_slot + 1) % DATALOG_SECTORS;
+    s_fill = 0;
+    s_commit_pending = false;
+}
+
+static void commit_sector(void) {
+    if (s_commit_pending) return;
+    SectorHeader* h = (SectorHeader*)s_buf;
+    h->magic = DATALOG_MAGIC;
+    h->seq = s_next_seq;
+    memset(s_buf + sizeof(SectorHeader) + s_fill, 0xFF,
+           SECTOR_PAYLOAD - s_fill);
+    s_commit_pending = true;
+    if (!flash_maint_defer("datalog", datalog_maint_op, 60))
+        s_commit_pending = false;  // queue full; the next overflow retries
+}
+
+void datalog_append(const uint8_t* frame, size_t len) {
+    if (len == 0 || len > SECTOR_PAYLOAD) return;
+    if (s_fill + len > SECTOR_PAYLOAD) commit_sector();
+    // Frozen while a commit is queued - the idle-window op programs
+    // straight from this buffer. Worst case one cycle of tee'd frames
+    // is skipped, the same loss mode a failed commit already had.
+    if (s_commit_pending || s_fill + len > SECTOR_PAYLOAD) return;
+    memcpy(s_buf + sizeof(SectorHeader) + s_fill, frame, len);
+    s_fill += len;
+}
+
+// --- Chunked export state ---
+// One chunk in flight at a time; the source is either a committed
+// sector's XIP mapping (reads are plain loads, no flash stall) or the
+// RAM staging buffer for the newest, still-uncommitted sequence. The
+// CRC accumulates over the slices as they stream, so the trailer costs
+// no second pass.
+static const uint8_t* s_fetch_src;
+static uint32_t s_fetch_len;
+static uint32_t s_fetch_off;
+static uint32_t s_fetch_seq;
+static uint32_t s_fetch_crc;
+
+// Same table-free CRC-32 (IEEE) as the upload paths (model_bank,
+// fw_update): byte-rate work on data that moves at UART/USB pace.
+static uint32_t crc32_step(uint32_t crc, uint8_t b) {
+    crc ^= b;
+    for (int i = 0; i < 8; i++)
+        crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    return crc;
+}
+
+void datalog_fetch_range(uint32_t* oldest, uint32_t* newest) {
+    uint32_t lo = 0;
+    for (uint32_t i = 0; i < DATALOG_SECTORS; i++) {
+        uint32_t slot = (s_next_slot + i) % DATALOG_SECTORS;
+        const SectorHeader* h = sector_at(slot);
+        if (h->magic == DATALOG_MAGIC) {
+            lo = h->seq;
+            break;
+        }
+    }
+    // Committed sectors only: the RAM staging sector is a moving
+    // target (a mid-export commit would tear it) and its frames become
+    // fetchable as sequence s_next_seq once the idle window lands.
+    if (lo == 0) {
+        *oldest = *newest = 0;
+        return;
+    }
+    *oldest = lo;
+    *newest = s_next_seq - 1;
+}
+
+int datalog_fetch_start(uint32_t seq) {
+    if (s_fetch_src != NULL) return -1;  // previous chunk still streaming
+    const SectorHeader* h = NULL;
+    for (uint32_t slot = 0; slot < DATALOG_SECTORS && h == NULL; slot++)
+        if (sector_at(slot)->magic == DATALOG_MAGIC &&
+            sector_at(slot)->seq == seq)
+            h = sector_at(slot);
+    if (h == NULL) return -1;
+    s_fetch_src = (const uint8_t*)(h + 1);
+    s_fetch_len = SECTOR_PAYLOAD;
+    s_fetch_off = 0;
+    s_fetch_seq = seq;
+    s_fetch_crc = 0xFFFFFFFFu;
+    printf("fetch: seq %u len %u\n", (unsigned)seq, (unsigned)s_fetch_len);
+    return 0;
+}
+
+bool datalog_fetch_step(void) {
+    if (s_fetch_src == NULL) return false;
+    uint32_t n = s_fetch_len - s_fetch_off;
+    if (n > DATALOG_FETCH_SLICE) n = DATALOG_FETCH_SLICE;
+    const uint8_t* p = s_fetch_src + s_fetch_off;
+    for (uint32_t i = 0; i < n; i++)
+        s_fetch_crc = crc32_step(s_fetch_crc, p[i]);
+    fwrite(p, 1, n, stdout);
+    fflush(stdout);
+    s_fetch_off += n;
+    if (s_fetch_off < s_fetch_len) return true;
+    printf("\nfetch: seq %u crc32 %08x\n", (unsigned)s_fetch_seq,
+           (unsigned)~s_fetch_crc);
+    s_fetch_src = NULL;
+    return false;
+}
+
+void datalog_dump(void) {
+    // Oldest committed sector = the slot after the staging position
+    printf("=== datalog begin ===\n");
+    for (uint32_t i = 0; i < DATALOG_SECTORS; i++) {
+        uint32_t slot = (s_next_slot + i) % DATALOG_SECTORS;
+        const SectorHeader* h = sector_at(slot);
+        if (h->magic != DATALOG_MAGIC) continue;
+        fwrite((const uint8_t*)(h + 1), 1, SECTOR_PAYLOAD, stdout);
+    }
+    // Uncommitted tail still in RAM
+    if (s_fill > 0) fwrite(s_buf + sizeof(SectorHeader), 1, s_fill, stdout);
+    fflush(stdout);
+    printf("\n=== datalog end ===\n");
+}
@@ -0,0 +1,108 @@
+/**
+ * @file datalog.h
+ *
+ * @brief Flash-resident circular datalogger for telemetry frames
+ *
+ * Remote units run with no host on the console, so the binary frames
+ * the control loop emits otherwise vanish. This logger tees them into
+ * a RAM sector buffer and commits full, aligned 4 KB sectors into a
+ * reserved circular flash region: the hot path only ever appends to
+ * RAM, and one erase+program lands every ~4 KB of telemetry (about
+ * every 12 minutes at the default cadence - 240 cycles between flash
+ * touches). The circular sweep is its own wear-leveling: every sector
+ * in the region erases at the same rate, ~2 cycles/day against a
+ * 100k-cycle part.
+ *
+ * Region: DATALOG_SECTORS x 4 KB just below the crash-dump and
+ * calibration sectors at the top of flash. Each sector starts with a
+ * header carrying a monotonically increasing sequence number, so boot
+ * recovery finds the newest sector with one scan and keeps appending
+ * after it; the oldest data is overwritten once the region wraps.
+ *
+ * The RAM staging buffer itself sits in the reset-retained section:
+ * a brown-out or watchdog reset keeps the uncommitted tail, and init
+ * re-adopts it when it still lines up with the flash scan - so a
+ * power event costs at most the one frame it tore, without syncing
+ * flash any more often.
+ *
+ * Dump: the shell's "dump" command streams the region oldest-first as
+ * raw frame bytes (the host decoder already demuxes on SOF).
+ */
+
+#ifndef DATALOG_H
+#define DATALOG_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Reserved region size in sectors (64 x 4 KB = 256 KB,
+ * roughly 9 days of sample frames at the default cadence).
+ */
+#define DATALOG_SECTORS 64
+
+/**
+ * @brief Locate the newest sector and arm the RAM buffer.
+ *
+ * Call once at boot, before the first append and before core 1 starts
+ * competing for flash windows.
+ */
+void datalog_init(void);
+
+/**
+ * @brief Append one telemetry frame to the log.
+ *
+ * RAM-only until the sector buffer fills; the occasional full-buffer
+ * commit is deferred through flash_maint to the idle window between
+ * cycles (the ~45 ms erase+program parks both cores, so it must not
+ * land mid-cycle). Appends while a commit is queued are dropped, as an
+ * oversized frame always was.
+ */
+void datalog_append(const uint8_t* frame, size_t len);
+
+/**
+ * @brief Stream the whole log, oldest first, as raw bytes to stdout.
+ *
+ * Call only from the task that owns stdio (the shell/drain task). The
+ * RAM buffer's uncommitted tail is included at the end.
+ */
+void datalog_dump(void);
+
+// --- Chunked export ("fetch" in the shell) ---
+// The one-shot dump freezes the drain task for the whole region - fine
+// on the bench, not on a live unit. The chunked protocol serves one
+// sector per host request instead: the request-per-chunk turnaround is
+// the flow control (the host asks for seq N+1 only once it has
+// banked N, exactly the inverse of fwload's per-sector 'ok' prompt),
+// and each armed chunk streams in bounded slices from the drain task's
+// poll, so retrieval of days of history never costs a cycle more than
+// DATALOG_FETCH_SLICE bytes of output.
+
+/** @brief Max export bytes written per drain pass. */
+#ifndef DATALOG_FETCH_SLICE
+#define DATALOG_FETCH_SLICE 512
+#endif
+
+/**
+ * @brief Retrievable sequence range, oldest to newest committed
+ * sector. Both 0 when nothing has been committed yet; the RAM staging
+ * tail becomes fetchable once its idle-window commit lands.
+ */
+void datalog_fetch_range(uint32_t* oldest, uint32_t* newest);
+
+/**
+ * @brief Arm one chunk for export and print its header line.
+ *
+ * @return 0 armed; -1 when the sequence is gone (overwritten or never
+ *         written) or another chunk is still streaming.
+ */
+int datalog_fetch_start(uint32_t seq);
+
+/**
+ * @brief Stream the next slice of an armed chunk to stdout; prints the
+ * CRC-32 trailer line after the last byte. Drain task, once per poll.
+ *
+ * @return true while a chunk is still streaming.
+ */
+bool datalog_fetch_step(void);
+
+#endif
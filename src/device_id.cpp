@@ -0,0 +1,35 @@
+/**
+ * @file device_id.cpp
+ *
+ * @brief Device identity and baseline implementation
+ */
+
+#include "device_id.h"
+
+#include <string.h>
+
+#include "pico/unique_id.h"
+
+static uint8_t s_id[DEVICE_ID_LEN];
+static volatile uint32_t s_baseline[BASE_SLOT_COUNT];
+
+void device_id_init(void) {
+    pico_unique_board_id_t board_id;
+    pico_get_unique_board_id(&board_id);
+    memcpy(s_id, board_id.id, DEVICE_ID_LEN);
+}
+
+const uint8_t* device_id_get(void) {
+    return s_id;
+}
+
+void device_baseline_note(int slot, uint32_t us) {
+    if (slot < 0 || slot >= BASE_SLOT_COUNT) return;
+    if (s_baseline[slot] != 0) return;  // first measurement is the baseline
+    s_baseline[slot] = us != 0 ? us : 1;
+}
+
+uint32_t device_baseline_get(int slot) {
+    if (slot < 0 || slot >= BASE_SLOT_COUNT) return 0;
+    return s_baseline[slot];
+}
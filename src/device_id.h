@@ -0,0 +1,60 @@
+/**
+ * @file device_id.h
+ *
+ * @brief Fleet-unique device identity and boot performance baseline
+ *
+ * Aggregated fleet logs were anonymous - no way to tell which unit a
+ * frame came from, so no per-unit regression analysis. The identity is
+ * the 64-bit unique ID of the flash die (already read by the SDK at
+ * runtime init), exported in the periodic identity frame so host
+ * tooling can attribute a console or datalog stream to a unit.
+ *
+ * The baseline slots capture the unit's own boot-time performance:
+ * the first invoke of each model (cold XIP cache - a reproducible
+ * condition) and the first successful DHT11 round trip. First write
+ * wins; the host compares later behaviour against the unit's own
+ * baseline to spot aging flash or a marginal sensor, independent of
+ * fleet-wide model or clock differences.
+ */
+
+#ifndef DEVICE_ID_H
+#define DEVICE_ID_H
+
+#include "pico/stdlib.h"
+
+#define DEVICE_ID_LEN 8
+
+/**
+ * @brief Baseline slots, one per boot measurement.
+ */
+enum BaselineSlot {
+    BASE_FAN_INVOKE_US = 0,  ///< first fan invoke (combo: full zone sweep)
+    BASE_PUMP_INVOKE_US,     ///< first pump batch on core 1
+    BASE_DHT_READ_US,        ///< first successful DHT11 round trip
+    BASE_SLOT_COUNT
+};
+
+/**
+ * @brief Cache the unique board ID. Call once at boot.
+ */
+void device_id_init(void);
+
+/**
+ * @brief The unit's 8-byte unique flash ID.
+ */
+const uint8_t* device_id_get(void);
+
+/**
+ * @brief Record a baseline measurement; only the first one sticks.
+ *
+ * Cheap no-op once the slot is set, so hot-path callers may call it
+ * every cycle. Each slot has a single writer (task or core).
+ */
+void device_baseline_note(int slot, uint32_t us);
+
+/**
+ * @brief Recorded baseline for one slot, 0 while unmeasured.
+ */
+uint32_t device_baseline_get(int slot);
+
+#endif
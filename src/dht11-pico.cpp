@@ -12,126 +12,493 @@
  #include "dht11-pico.h"
  #include <cstdio>      // <- Tambahkan ini
 
+ #include "dht11_capture.pio.h"
+ #include "err_stats.h"
+ #include "ram_code.h"
+ #include "resource_map.h"
+
 // =======================
 // Class Dht11 Implementation
 // =======================
 
-Dht11::Dht11(uint pin){
+// Checksum with the 1-LSB tolerance both read paths always used
+static inline bool dht11_checksum_ok(long long raw) {
+    return ((raw & RH_INT_MASK) >> 32) +
+           ((raw & RH_DEC_MASK) >> 24) +
+           ((raw & TEMP_INT_MASK) >> 16) +
+           ((raw & TEMP_DEC_MASK) >> 8) -
+           (raw & CHECKSUM_MASK) <= 1;
+}
+
+// --- Bit salvage for checksum failures ---
+// The fixed 50 us threshold assumes nominal pulse widths, but a sensor
+// at the end of a long lead (slow rising edges) or a capture delayed
+// by bus stalls shifts the whole transfer's widths together - one
+// marginal pulse lands on the wrong side and the entire 40-bit frame
+// is discarded for a 2 s retry penalty. The widths themselves still
+// carry the answer: this transfer's own histogram is strongly bimodal,
+// so a two-means split learns where ITS gap actually sits. Re-classify
+// against that threshold and re-validate the checksum - the checksum
+// stays the sole arbiter, so a salvage can never admit a frame a
+// normal read would have rejected for real corruption. One 40-entry
+// second pass, integer only, on the failure path only.
+static long long dht11_salvage(const uint16_t* width_us) {
+    uint32_t th = DHT11_BIT_THRESHOLD_US;
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t sum0 = 0, n0 = 0, sum1 = 0, n1 = 0;
+        for (int i = 0; i < 40; i++) {
+            if (width_us[i] > th) { sum1 += width_us[i]; n1++; }
+            else                  { sum0 += width_us[i]; n0++; }
+        }
+        // All-zeros / all-ones frames are legal (0% RH does not occur
+        // on a DHT11, but do not assume): nothing to learn, and the
+        // fixed threshold already classified them.
+        if (n0 == 0 || n1 == 0) return TRANSMISSION_ERROR;
+        th = (sum0 / n0 + sum1 / n1) / 2;
+    }
+
+    long long raw = 0;
+    for (int i = 0; i < 40; i++)
+        raw = (raw << 1) | (width_us[i] > th ? 1 : 0);
+    if (!dht11_checksum_ok(raw)) return TRANSMISSION_ERROR;
+
+    err_stats_bump(ERR_DHT_SALVAGE);
+    return raw;
+}
+
+// One loaded copy of the capture program per PIO block, refcounted
+// across instances: the program is identical for every sensor, and the
+// 32-slot instruction memory is too scarce to hold duplicates.
+static int s_prog_offset[2] = {-1, -1};
+static int s_prog_users[2]  = {0, 0};
+
+Dht11::Dht11(uint pin, bool waitStabilize){
     gpioPin = pin;
+    gpio_guard_snapshot(1u << pin, &pinSnap);
     gpio_init(pin);
-    sleep_ms(1000);  // wait for sensor to stabilize
+    if (waitStabilize) {
+        // The sensor stabilizes from power-on, not from construction:
+        // only wait out the remainder of its first second of uptime,
+        // which the rest of the boot sequence usually covers already.
+        sleep_until(from_us_since_boot(1000u * 1000u));
+    }
+
+    // The capture engine is the air sensor: no state machine, no data.
+    int claimed = res_claim_pio_sm("dht11", &pio);
+    if (claimed < 0) panic("dht11: no free PIO state machine");
+    sm = (uint)claimed;
+
+    uint block = pio_get_index(pio);
+    if (s_prog_offset[block] < 0)
+        s_prog_offset[block] = pio_add_program(pio, &dht11_capture_program);
+    s_prog_users[block]++;
+    pioOffset = (uint)s_prog_offset[block];
+    dht11_capture_program_init(pio, sm, pioOffset, gpioPin);
 }
 
 Dht11::~Dht11(){
+    pio_sm_set_enabled(pio, sm, false);
+    uint block = pio_get_index(pio);
+    if (--s_prog_users[block] == 0) {
+        pio_remove_program(pio, &dht11_capture_program, pioOffset);
+        s_prog_offset[block] = -1;
+    }
+    res_release_pio_sm(pio, (int)sm);
+    // Put the SIO latches back to the pre-construction state before
+    // disconnecting the pad: whoever claims the pin next reconnects to
+    // what was there, not to the last transaction's start-signal low.
+    gpio_guard_restore(&pinSnap);
     gpio_deinit(gpioPin);
 }
 
-long long Dht11::read(){
-    int count = 0;
+// Hot path: drains 40 PIO pulse widths against a 10 ms deadline, so a
+// flash-fetch stall here eats directly into the decode margin.
+long long QDNN_HOT_FUNC_RANK(1, Dht11::read)(){
     long long raw = 0;
 
-    // Start signal
-    gpio_set_dir(gpioPin, GPIO_OUT);
-    gpio_put(gpioPin, 0);
+    // Rewind the state machine to a clean start for this transfer
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_jmp(pioOffset));
+
+    // Host drives the 20 ms start signal, then hands the line to the
+    // PIO. The guarded claim latches the low before reconnecting the
+    // pad, so the line goes idle-high -> low once, never via a stale
+    // latch value - the sensor cannot see a runt start edge.
+    gpio_guard_init_out(gpioPin, 0);
     sleep_ms(20);
     gpio_set_dir(gpioPin, GPIO_IN);
+    pio_gpio_init(pio, gpioPin);
+    pio_sm_set_enabled(pio, sm, true);
 
-    // Wait for sensor response
-    while (gpio_get(gpioPin) == 1) {
-        count++;
-        sleep_us(5);
-        if (count == POLLING_LIMIT) return TRANSMISSION_ERROR;
-    }
-
-    count = 0;
-    while (gpio_get(gpioPin) == 0) {
-        count++;
-        sleep_us(5);
-        if (count == POLLING_LIMIT) return TRANSMISSION_ERROR;
-    }
-
-    count = 0;
-    while (gpio_get(gpioPin) == 1) {
-        count++;
-        sleep_us(5);
-        if (count == POLLING_LIMIT) return TRANSMISSION_ERROR;
-    }
-
-    // Read 40 bits
+    // Drain 40 measured pulse widths from the RX FIFO and classify each
+    // against the bit threshold, keeping the widths for a possible
+    // salvage pass. A full transfer takes at most ~5 ms; anything
+    // slower is a dead sensor.
+    uint16_t widths[40];
+    absolute_time_t deadline = make_timeout_time_ms(10);
     for (int i = 0; i < 40; i++) {
-        count = 0;
-        while (gpio_get(gpioPin) == 0) sleep_us(5);
-        while (gpio_get(gpioPin) == 1) {
-            sleep_us(5);
-            count++;
+        while (pio_sm_is_rx_fifo_empty(pio, sm)) {
+            if (absolute_time_diff_us(get_absolute_time(), deadline) < 0) {
+                pio_sm_set_enabled(pio, sm, false);
+                err_stats_bump(ERR_DHT_TIMEOUT);
+                return TRANSMISSION_ERROR;
+            }
+            tight_loop_contents();
         }
-        if (count >= THRESHOLD) raw |= 1;
-        raw = raw << 1;
+        // The PIO pushes the inverted down-counter; each iteration is 2 us.
+        uint32_t width_us = (~pio_sm_get(pio, sm)) * 2;
+        widths[i] = (uint16_t)(width_us > 0xFFFF ? 0xFFFF : width_us);
+        raw = (raw << 1) | (width_us > DHT11_BIT_THRESHOLD_US ? 1 : 0);
     }
+    pio_sm_set_enabled(pio, sm, false);
 
-    // Checksum validation
-    if (((raw & RH_INT_MASK) >> 32) +
-        ((raw & RH_DEC_MASK) >> 24) +
-        ((raw & TEMP_INT_MASK) >> 16) +
-        ((raw & TEMP_DEC_MASK) >> 8) -
-        (raw & CHECKSUM_MASK) > 1) {
-        return TRANSMISSION_ERROR;
+    // Checksum validation; a failure gets one re-classification pass
+    // against this transfer's own learned threshold before it costs
+    // the caller a retry.
+    if (!dht11_checksum_ok(raw)) {
+        raw = dht11_salvage(widths);
+        if (raw == TRANSMISSION_ERROR) {
+            err_stats_bump(ERR_DHT_CHECKSUM);
+            return TRANSMISSION_ERROR;
+        }
     }
 
     return raw;
 }
 
-double Dht11::readT() {
+int Dht11::readT10() {
     long long raw = read();
     if (raw == TRANSMISSION_ERROR) return TRANSMISSION_ERROR;
 
-    int temp_int  = (raw & TEMP_INT_MASK) >> 16;
-    uint temp_dec = (raw & TEMP_DEC_MASK) >> 8;
-    if (temp_int < 0) temp_dec = -temp_dec;
-    double temp = temp_int + 0.1 * temp_dec;
-    return temp;
+    int temp_int = (raw & TEMP_INT_MASK) >> 16;
+    int temp_dec = (raw & TEMP_DEC_MASK) >> 8;
+    return temp_int * 10 + temp_dec;
 }
 
-double Dht11::readRH() {
+int Dht11::readRH10() {
     long long raw = read();
     if (raw == TRANSMISSION_ERROR) return TRANSMISSION_ERROR;
 
-    int rh_int  = (raw & RH_INT_MASK) >> 32;
-    uint rh_dec = (raw & RH_DEC_MASK) >> 24;
-    double rh = rh_int + 0.1 * rh_dec;
-    return rh;
+    int rh_int = (raw & RH_INT_MASK) >> 32;
+    int rh_dec = (raw & RH_DEC_MASK) >> 24;
+    return rh_int * 10 + rh_dec;
 }
 
-void Dht11::readRHT(double* temp, double* rh) {
+void Dht11::readRHT10(int* temp10, int* rh10) {
     long long raw = read();
     if (raw == TRANSMISSION_ERROR) {
+        *temp10 = *rh10 = TRANSMISSION_ERROR;
+        return;
+    }
+
+    int temp_int = (raw & TEMP_INT_MASK) >> 16;
+    int temp_dec = (raw & TEMP_DEC_MASK) >> 8;
+    int rh_int   = (raw & RH_INT_MASK) >> 32;
+    int rh_dec   = (raw & RH_DEC_MASK) >> 24;
+
+    *temp10 = temp_int * 10 + temp_dec;
+    *rh10   = rh_int * 10 + rh_dec;
+}
+
+// Legacy double-returning wrappers: conversion happens once at the API
+// boundary, never inside the decode path.
+
+double Dht11::readT() {
+    int t10 = readT10();
+    if (t10 == TRANSMISSION_ERROR) return TRANSMISSION_ERROR;
+    return t10 * 0.1;
+}
+
+double Dht11::readRH() {
+    int rh10 = readRH10();
+    if (rh10 == TRANSMISSION_ERROR) return TRANSMISSION_ERROR;
+    return rh10 * 0.1;
+}
+
+void Dht11::readRHT(double* temp, double* rh) {
+    int t10, rh10;
+    readRHT10(&t10, &rh10);
+    if (t10 == TRANSMISSION_ERROR || rh10 == TRANSMISSION_ERROR) {
         *temp = *rh = TRANSMISSION_ERROR;
         return;
     }
+    *temp = t10 * 0.1;
+    *rh   = rh10 * 0.1;
+}
+
+// =======================
+// Asynchronous transaction
+// =======================
+// Same transfer as read(), split at its two wait points (20 ms start
+// signal, FIFO drain) into a poll-advanced state machine: the caller
+// overlaps the transaction with other acquisition work instead of
+// spinning here.
+
+void Dht11::beginRead() {
+    // Rewind the state machine to a clean start for this transfer
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_jmp(pioOffset));
+
+    // Host drives the start signal low; the release happens in poll
+    // once the 20 ms have elapsed. Guarded claim: the low is latched
+    // before the pad reconnects, so no runt edge precedes the start.
+    gpio_guard_init_out(gpioPin, 0);
+    asyncDeadline = make_timeout_time_ms(20);
+    asyncState = AsyncState::Start;
+}
+
+int QDNN_HOT_FUNC_RANK(1, Dht11::pollRead)(long long* raw) {
+    if (asyncState == AsyncState::Idle) return TRANSMISSION_ERROR;
+
+    if (asyncState == AsyncState::Start) {
+        if (absolute_time_diff_us(get_absolute_time(), asyncDeadline) > 0)
+            return DHT11_READ_PENDING;
+        // Start signal held long enough: hand the line to the PIO
+        gpio_set_dir(gpioPin, GPIO_IN);
+        pio_gpio_init(pio, gpioPin);
+        pio_sm_set_enabled(pio, sm, true);
+        asyncDeadline = make_timeout_time_ms(10);
+        asyncRaw = 0;
+        asyncBits = 0;
+        asyncState = AsyncState::Capture;
+    }
+
+    // Drain whatever the RX FIFO holds right now; never wait on it
+    while (asyncBits < 40 && !pio_sm_is_rx_fifo_empty(pio, sm)) {
+        uint32_t width_us = (~pio_sm_get(pio, sm)) * 2;
+        asyncWidths[asyncBits] = (uint16_t)(width_us > 0xFFFF ? 0xFFFF : width_us);
+        asyncRaw = (asyncRaw << 1) | (width_us > DHT11_BIT_THRESHOLD_US ? 1 : 0);
+        asyncBits++;
+    }
+
+    if (asyncBits < 40) {
+        if (absolute_time_diff_us(get_absolute_time(), asyncDeadline) > 0)
+            return DHT11_READ_PENDING;
+        pio_sm_set_enabled(pio, sm, false);
+        asyncState = AsyncState::Idle;
+        err_stats_bump(ERR_DHT_TIMEOUT);
+        return TRANSMISSION_ERROR;  // dead sensor / truncated frame
+    }
+
+    pio_sm_set_enabled(pio, sm, false);
+    asyncState = AsyncState::Idle;
 
-    int temp_int  = (raw & TEMP_INT_MASK) >> 16;
-    uint temp_dec = (raw & TEMP_DEC_MASK) >> 8;
-    int rh_int    = (raw & RH_INT_MASK) >> 32;
-    uint rh_dec   = (raw & RH_DEC_MASK) >> 24;
+    // Checksum validation (same tolerance and salvage pass as the
+    // blocking path)
+    if (!dht11_checksum_ok(asyncRaw)) {
+        asyncRaw = dht11_salvage(asyncWidths);
+        if (asyncRaw == TRANSMISSION_ERROR) {
+            err_stats_bump(ERR_DHT_CHECKSUM);
+            return TRANSMISSION_ERROR;
+        }
+    }
 
-    *temp = temp_int + 0.1 * temp_dec;
-    *rh   = rh_int + 0.1 * rh_dec;
+    *raw = asyncRaw;
+    return 0;
 }
 
 // =======================
-// C-style Helper Function
+// C-style Helper Functions
 // =======================
 
-int read_from_dht(uint gpio_pin, float* temperature, float* humidity, bool debug) {
-    if (!temperature || !humidity) return TRANSMISSION_ERROR;
+// Persistent driver instance: constructed once so the 1-second
+// stabilization wait in the constructor is paid only at boot.
+static Dht11* s_sensor = nullptr;
+static uint   s_sensor_pin = 0;
+
+int dht11_init(uint gpio_pin) {
+    if (s_sensor != nullptr) {
+        if (s_sensor_pin == gpio_pin) return 0;  // already up on this pin
+        delete s_sensor;
+        s_sensor = nullptr;
+    }
+
+    s_sensor = new Dht11(gpio_pin);
+    if (!s_sensor) return TRANSMISSION_ERROR;
+    s_sensor_pin = gpio_pin;
+    return 0;
+}
+
+// Last-good sample cache: one sensor transaction per call, and a
+// transient failure is bridged with the previous value while it is
+// still fresh (DHT11_CACHE_MAX_AGE_MS). Cached in the sensor's native
+// 0.1-unit fixed point; the float API converts at its own edge.
+static bool            s_have_sample = false;
+static int             s_last_temp10 = 0;
+static int             s_last_rh10 = 0;
+static absolute_time_t s_last_sample_time;
+
+int read_from_dht10(uint gpio_pin, int* temp10, int* rh10, bool debug) {
+    if (!temp10 || !rh10) return TRANSMISSION_ERROR;
+
+    if (dht11_init(gpio_pin) != 0) return TRANSMISSION_ERROR;
+
+    // Single transaction, pure integer decode end to end
+    int t10, h10;
+    s_sensor->readRHT10(&t10, &h10);
 
-    Dht11 sensor(gpio_pin);
-    *temperature = sensor.readT();
-    *humidity    = sensor.readRH();
+    if (t10 != TRANSMISSION_ERROR && h10 != TRANSMISSION_ERROR) {
+        s_last_temp10 = t10;
+        s_last_rh10   = h10;
+        s_last_sample_time = get_absolute_time();
+        s_have_sample = true;
+    } else {
+        // Serve the cached sample if it is still fresh enough
+        bool fresh = s_have_sample &&
+            absolute_time_diff_us(s_last_sample_time, get_absolute_time()) <
+                (int64_t)DHT11_CACHE_MAX_AGE_MS * 1000;
+        if (!fresh) return TRANSMISSION_ERROR;
+        if (debug) printf("[DHT11] Transaction failed, serving cached sample\n");
+    }
+
+    *temp10 = s_last_temp10;
+    *rh10   = s_last_rh10;
 
     if (debug) {
-        printf("[DHT11] Read: T=%.1f, H=%.1f\n", *temperature, *humidity);
+        printf("[DHT11] Read: T=%d.%d, H=%d.%d\n",
+               s_last_temp10 / 10, s_last_temp10 % 10,
+               s_last_rh10 / 10, s_last_rh10 % 10);
     }
 
     return 0;  // success
 }
+
+int read_from_dht(uint gpio_pin, float* temperature, float* humidity, bool debug) {
+    if (!temperature || !humidity) return TRANSMISSION_ERROR;
+
+    int t10, rh10;
+    int status = read_from_dht10(gpio_pin, &t10, &rh10, debug);
+    if (status != 0) return status;
+
+    *temperature = t10 * 0.1f;
+    *humidity    = rh10 * 0.1f;
+    return 0;
+}
+
+int dht11_read_begin(uint gpio_pin) {
+    if (dht11_init(gpio_pin) != 0) return TRANSMISSION_ERROR;
+    s_sensor->beginRead();
+    return 0;
+}
+
+int dht11_read_poll(int* temp10, int* rh10) {
+    if (!temp10 || !rh10 || s_sensor == nullptr) return TRANSMISSION_ERROR;
+
+    long long raw;
+    int status = s_sensor->pollRead(&raw);
+    if (status == DHT11_READ_PENDING) return DHT11_READ_PENDING;
+
+    if (status == 0) {
+        s_last_temp10 = ((raw & TEMP_INT_MASK) >> 16) * 10 + ((raw & TEMP_DEC_MASK) >> 8);
+        s_last_rh10   = ((raw & RH_INT_MASK) >> 32) * 10 + ((raw & RH_DEC_MASK) >> 24);
+        s_last_sample_time = get_absolute_time();
+        s_have_sample = true;
+    } else {
+        // Serve the cached sample if it is still fresh enough
+        bool fresh = s_have_sample &&
+            absolute_time_diff_us(s_last_sample_time, get_absolute_time()) <
+                (int64_t)DHT11_CACHE_MAX_AGE_MS * 1000;
+        if (!fresh) return TRANSMISSION_ERROR;
+    }
+
+    *temp10 = s_last_temp10;
+    *rh10   = s_last_rh10;
+    return 0;
+}
+
+// =======================
+// Concurrent multi-sensor group
+// =======================
+// Each instance owns its own state machine, so N sensors overlap
+// completely: begin arms every engine in one pass, poll drains
+// whichever RX FIFOs hold data, and a completion bitmap tells the
+// caller when the round has settled. The last-good cache moves into
+// per-slot storage so one flaky sensor never masks the others.
+
+static Dht11*          s_group[DHT11_MAX_SENSORS];
+static int             s_group_n = 0;
+static uint32_t        s_group_done = 0;  // settled this round (ok or not)
+static uint32_t        s_group_ok = 0;    // settled with a fresh frame
+static bool            s_group_have[DHT11_MAX_SENSORS];
+static int             s_group_temp10[DHT11_MAX_SENSORS];
+static int             s_group_rh10[DHT11_MAX_SENSORS];
+static absolute_time_t s_group_time[DHT11_MAX_SENSORS];
+
+int dht11_group_init(const uint* pins, int n) {
+    if (!pins || n < 1 || n > DHT11_MAX_SENSORS) return TRANSMISSION_ERROR;
+
+    for (int i = 0; i < s_group_n; i++) {
+        delete s_group[i];
+        s_group[i] = nullptr;
+    }
+    s_group_n = 0;
+
+    // Constructors skip their individual stabilization waits; the
+    // sensors power up in parallel, so one shared wait (measured from
+    // power-on, like the single-sensor path) covers all.
+    for (int i = 0; i < n; i++) {
+        s_group[i] = new Dht11(pins[i], false);
+        if (!s_group[i]) return TRANSMISSION_ERROR;
+        s_group_have[i] = false;
+    }
+    sleep_until(from_us_since_boot(1000u * 1000u));
+
+    s_group_n = n;
+    s_group_done = 0;
+    s_group_ok = 0;
+    return 0;
+}
+
+int dht11_group_begin(void) {
+    if (s_group_n == 0) return TRANSMISSION_ERROR;
+    for (int i = 0; i < s_group_n; i++)
+        s_group[i]->beginRead();
+    s_group_done = 0;
+    s_group_ok = 0;
+    return 0;
+}
+
+uint32_t dht11_group_poll(void) {
+    for (int i = 0; i < s_group_n; i++) {
+        if (s_group_done & (1u << i)) continue;
+
+        long long raw;
+        int status = s_group[i]->pollRead(&raw);
+        if (status == DHT11_READ_PENDING) continue;
+
+        s_group_done |= 1u << i;
+        if (status == 0) {
+            s_group_ok |= 1u << i;
+            s_group_temp10[i] = ((raw & TEMP_INT_MASK) >> 16) * 10 +
+                                ((raw & TEMP_DEC_MASK) >> 8);
+            s_group_rh10[i]   = ((raw & RH_INT_MASK) >> 32) * 10 +
+                                ((raw & RH_DEC_MASK) >> 24);
+            s_group_time[i] = get_absolute_time();
+            s_group_have[i] = true;
+        }
+        // Failures fall through to the per-slot cache in _result()
+    }
+    return s_group_done;
+}
+
+int dht11_group_result(int idx, int* temp10, int* rh10) {
+    if (!temp10 || !rh10 || idx < 0 || idx >= s_group_n)
+        return TRANSMISSION_ERROR;
+    if (!(s_group_done & (1u << idx))) return DHT11_READ_PENDING;
+
+    if (!(s_group_ok & (1u << idx))) {
+        // Serve the slot's cached sample if it is still fresh enough
+        bool fresh = s_group_have[idx] &&
+            absolute_time_diff_us(s_group_time[idx], get_absolute_time()) <
+                (int64_t)DHT11_CACHE_MAX_AGE_MS * 1000;
+        if (!fresh) return TRANSMISSION_ERROR;
+    }
+
+    *temp10 = s_group_temp10[idx];
+    *rh10   = s_group_rh10[idx];
+    return 0;
+}
@@ -11,25 +11,145 @@
 #define DHT11_PICO_H
 
 #include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+#include "gpio_guard.h"
+
+/**
+ * @brief Initialize the persistent DHT11 driver instance on the given pin.
+ *
+ * Constructs the driver exactly once, paying the one-second sensor
+ * stabilization wait at boot instead of on every read. Safe to call
+ * again with the same pin (no-op); calling with a different pin tears
+ * down the old instance and brings up a new one.
+ *
+ * @param gpio_pin GPIO pin number connected to the DHT11 sensor.
+ * @return 0 on success, TRANSMISSION_ERROR on failure.
+ */
+int dht11_init(uint gpio_pin);
 
 int read_from_dht(uint gpio_pin, float *temperature, float *humidity, bool debug);
 
+/**
+ * @brief Fixed-point variant of read_from_dht(): values in 0.1 units.
+ *
+ * Same transaction and last-good cache semantics, but the result stays
+ * in the sensor's native deci-degree / deci-percent integers - no float
+ * math anywhere on the read path.
+ *
+ * @return 0 on success, TRANSMISSION_ERROR on failure.
+ */
+int read_from_dht10(uint gpio_pin, int *temp10, int *rh10, bool debug);
+
+/**
+ * @brief Result of dht11_read_poll() while the transaction is in flight.
+ */
+const int DHT11_READ_PENDING = 1;
+
+/**
+ * @brief Start an asynchronous DHT11 transaction (non-blocking).
+ *
+ * Drives the start signal and arms the PIO capture engine; the caller
+ * polls for completion with dht11_read_poll() and is free to do other
+ * work (ADC burst, soil conversion) while the sensor clocks out its
+ * frame. A transaction already in flight is restarted.
+ *
+ * @return 0 on success, TRANSMISSION_ERROR if the driver is not up.
+ */
+int dht11_read_begin(uint gpio_pin);
+
+/**
+ * @brief Poll an asynchronous transaction for completion.
+ *
+ * Advances the transaction state machine (start-signal timing, FIFO
+ * drain) without blocking. Same last-good cache semantics as
+ * read_from_dht10(): a failed transfer is bridged with the previous
+ * sample while it is still fresh.
+ *
+ * @return 0 with values on completion, DHT11_READ_PENDING while in
+ *         flight, TRANSMISSION_ERROR on failure with no fresh cache.
+ */
+int dht11_read_poll(int *temp10, int *rh10);
 
 /**
- * @brief Threshold for differentiating between bit 0 and bit 1 during DHT11 data transmission.
+ * @brief Maximum number of sensors a concurrent capture group may hold.
+ *
+ * Each sensor owns one PIO state machine; the group claims from pio0
+ * first and spills to pio1, so the ceiling is well under the eight
+ * machines the RP2040 offers even with other PIO users resident.
  */
-const int THRESHOLD = 7;
+const int DHT11_MAX_SENSORS = 4;
 
 /**
- * @brief Maximum number of polling attempts during DHT11 data transmission.
+ * @brief Bring up a group of DHT11 sensors for concurrent capture.
+ *
+ * Constructs one driver instance per pin, each on its own PIO state
+ * machine, sharing a single copy of the capture program per PIO block.
+ * The one-second stabilization wait is paid once for the whole group -
+ * the sensors power up in parallel. Replaces any previous group.
+ *
+ * @param pins Array of GPIO pin numbers, one per sensor.
+ * @param n    Number of sensors (1..DHT11_MAX_SENSORS).
+ * @return 0 on success, TRANSMISSION_ERROR on failure.
  */
-const int POLLING_LIMIT = 50;
+int dht11_group_init(const uint *pins, int n);
+
+/**
+ * @brief Start one transaction on every sensor in the group.
+ *
+ * Arms all state machines in the same pass; the start signals and
+ * captures then run concurrently, so N sensors cost the wall time of
+ * one. Poll for completion with dht11_group_poll().
+ *
+ * @return 0 on success, TRANSMISSION_ERROR if no group is up.
+ */
+int dht11_group_begin(void);
+
+/**
+ * @brief Advance all in-flight transactions without blocking.
+ *
+ * Drains whichever RX FIFOs hold data and returns the completion
+ * bitmap: bit i is set once sensor i's transaction has settled
+ * (successfully or not). The round is finished when the bitmap equals
+ * (1u << n) - 1; per-sensor values come from dht11_group_result().
+ *
+ * @return Completion bitmap for the current round.
+ */
+uint32_t dht11_group_poll(void);
+
+/**
+ * @brief Fetch one sensor's values from the finished round.
+ *
+ * Same last-good cache semantics as read_from_dht10(), kept per slot: a
+ * failed transfer is bridged with that sensor's previous sample while
+ * it is still fresh.
+ *
+ * @return 0 with values, DHT11_READ_PENDING if the sensor has not
+ *         settled this round, TRANSMISSION_ERROR on failure with no
+ *         fresh cache.
+ */
+int dht11_group_result(int idx, int *temp10, int *rh10);
+
+
+/**
+ * @brief Measured high-pulse width (us) separating a 0-bit from a 1-bit.
+ *
+ * The PIO engine timestamps each bit's high phase; 0-bits are 22-30 us and
+ * 1-bits 65-75 us across DHT11 variants, so 50 us sits mid-gap.
+ */
+const uint32_t DHT11_BIT_THRESHOLD_US = 50;
 
 /**
  * @brief Error value returned when there is a transmission error during DHT11 data reading.
  */
 const int TRANSMISSION_ERROR = -999;
 
+/**
+ * @brief Maximum age (ms) of the cached last-good sample that read_from_dht()
+ * may serve when a fresh transaction fails.
+ */
+const uint32_t DHT11_CACHE_MAX_AGE_MS = 10000;
+
 /**
  * @brief Bit mask to extract the integer part of relative humidity from the raw data.
  */
@@ -61,17 +181,35 @@ const long long CHECKSUM_MASK = 0x00000000FF;
  * @brief DHT11 Sensor Class
  *
  * This class provides methods to initialize, read, and retrieve temperature and humidity values from the DHT11 sensor.
+ *
+ * Instances are independent: each claims its own PIO state machine
+ * (pio0 first, spilling to pio1) while sharing one loaded copy of the
+ * capture program per PIO block, so several sensors can run their
+ * transactions concurrently via beginRead()/pollRead().
  */
 class Dht11 {
-    uint gpioPin; ///< GPIO pin connected to the DHT11 sensor
+    uint gpioPin;   ///< GPIO pin connected to the DHT11 sensor
+    PIO pio;        ///< PIO instance running the capture program
+    uint sm;        ///< Claimed state machine index
+    uint pioOffset; ///< Load offset of the capture program
+
+    GpioSnapshot pinSnap;  ///< pin state as found, restored on teardown
+
+    enum class AsyncState { Idle, Start, Capture };
+    AsyncState asyncState = AsyncState::Idle;  ///< async transaction phase
+    absolute_time_t asyncDeadline;             ///< phase deadline
+    long long asyncRaw;                        ///< bits shifted in so far
+    int asyncBits;                             ///< count of bits captured
+    uint16_t asyncWidths[40];                  ///< pulse widths for salvage
 
     /**
      * @brief Private method to read raw data from the DHT11 sensor.
      *
      * @return Raw data read from the DHT11 sensor.
      *
-     * This method reads the raw data from the DHT11 sensor by sending and receiving pulses
-     * to determine the temperature and humidity values.
+     * This method drives the start signal on the line, then lets the PIO
+     * capture engine clock in the 40-bit pulse train autonomously and
+     * drains the result from the state machine RX FIFO.
      */
     long long read(void);
 
@@ -81,11 +219,18 @@ public:
      * @brief Dht11 class constructor. Initializes GPIO and waits for the sensor to stablize.
      *
      * @param pin GPIO pin number connected to the DHT11 sensor.
+     * @param waitStabilize Pass false to skip the one-second wait when
+     *        the caller stabilizes a whole group of sensors at once.
      */
-    Dht11(uint pin);
+    Dht11(uint pin, bool waitStabilize = true);
 
     /**
      * @brief Dht11 class destructor. De-initialize GPIO.
+     *
+     * Restores the direction and output level the pin had before
+     * construction, so a teardown/re-init cycle (recovery re-probing a
+     * different pin, group rebuild) never leaves the line driving a
+     * stale start-signal low.
      */
     ~Dht11();
 
@@ -109,6 +254,34 @@ public:
      */
     double readRH(void);
 
+    /**
+     * @brief Read the temperature in fixed-point tenths of a degree.
+     *
+     * @return Temperature in 0.1 C units, or TRANSMISSION_ERROR.
+     *
+     * Pure integer decode - no soft-double math on the sensor path.
+     */
+    int readT10(void);
+
+    /**
+     * @brief Read the relative humidity in fixed-point tenths of a percent.
+     *
+     * @return Humidity in 0.1 %RH units, or TRANSMISSION_ERROR.
+     *
+     * Pure integer decode - no soft-double math on the sensor path.
+     */
+    int readRH10(void);
+
+    /**
+     * @brief Read both values in fixed-point tenths from a single transaction.
+     *
+     * @param temp10 Receives temperature in 0.1 C units.
+     * @param rh10   Receives humidity in 0.1 %RH units.
+     *
+     * Both are set to TRANSMISSION_ERROR on a failed transfer.
+     */
+    void readRHT10(int* temp10, int* rh10);
+
     /**
      * @brief Read both temperature and humidity values from the DHT11 sensor.
      *
@@ -119,6 +292,20 @@ public:
      * in the provided variables. If there is a transmission error, the values are set to TRANSMISSION_ERROR.
      */
     void readRHT(double* temperature, double* rel_humidity);
+
+    /**
+     * @brief Start an asynchronous transaction (see dht11_read_begin()).
+     */
+    void beginRead(void);
+
+    /**
+     * @brief Advance the asynchronous transaction without blocking.
+     *
+     * @param raw Receives the 40-bit frame on completion.
+     * @return 0 on completion, DHT11_READ_PENDING in flight,
+     *         TRANSMISSION_ERROR on timeout/checksum failure.
+     */
+    int pollRead(long long* raw);
 };
 
 #endif
\ No newline at end of file
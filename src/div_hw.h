@@ -0,0 +1,58 @@
+/**
+ * @file div_hw.h
+ *
+ * @brief SIO hardware-divider wrappers for the per-cycle divide sites
+ *
+ * The SDK already routes compiler-emitted / and % through the 8-cycle
+ * SIO divider (pico_divider's AEABI implementations), so plain division
+ * is not software division here - but each operator pays the AEABI
+ * call, and a quotient/remainder pair pays it twice for one divide the
+ * hardware already computed both results of. These wrappers launch the
+ * divide once through the SDK's inlined divider access and hand back
+ * both halves, cutting a deci-unit split ("%ld.%ld") or a
+ * seconds-of-day decomposition to a single 8-cycle operation plus
+ * register reads.
+ *
+ * Safety: the inlined SDK helpers spin out the 8-cycle latency before
+ * reading results, the FreeRTOS port saves divider state across the
+ * task switch, and pico_divider's IRQ-side users save/restore an
+ * in-flight divide - so these are safe from any task context. The host
+ * fallback keeps the header includable from shared code.
+ */
+
+#ifndef DIV_HW_H
+#define DIV_HW_H
+
+#include <stdint.h>
+
+#if PICO_RP2040
+#include "hardware/divider.h"
+
+static inline void divmod_u32(uint32_t n, uint32_t d,
+                              uint32_t* q, uint32_t* r) {
+    divmod_result_t res = hw_divider_divmod_u32(n, d);
+    *q = to_quotient_u32(res);
+    *r = to_remainder_u32(res);
+}
+
+static inline void divmod_s32(int32_t n, int32_t d,
+                              int32_t* q, int32_t* r) {
+    divmod_result_t res = hw_divider_divmod_s32(n, d);
+    *q = to_quotient_s32(res);
+    *r = to_remainder_s32(res);
+}
+#else
+static inline void divmod_u32(uint32_t n, uint32_t d,
+                              uint32_t* q, uint32_t* r) {
+    *q = n / d;
+    *r = n % d;
+}
+
+static inline void divmod_s32(int32_t n, int32_t d,
+                              int32_t* q, int32_t* r) {
+    *q = n / d;
+    *r = n % d;
+}
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file err_stats.cpp
+ *
+ * @brief Error counter implementation
+ */
+
+#include "err_stats.h"
+
+#include "hardware/sync.h"
+
+// One detail record per site per interval; everything in between is
+// counter-only. 10 s keeps a flapping sensor readable on the console
+// while the summary frame still carries the true rate.
+#define ERR_STATS_DETAIL_MIN_MS 10000
+
+static volatile uint32_t s_count[ERR_SITE_COUNT];
+static uint32_t s_last_detail_ms[ERR_SITE_COUNT];
+static spin_lock_t* s_lock = NULL;
+
+static const char* const s_site_name[ERR_SITE_COUNT] = {
+    "dht_crc", "dht_tmo", "adc_rng", "invoke", "inv_dl", "q_drop", "stale",
+    "skp_fl", "skp_sn", "skp_ot", "m_bind", "brownout", "sguard",
+    "dht_slv", "golden",
+};
+
+void err_stats_init(void) {
+    s_lock = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+void err_stats_bump(int site) {
+    if (site < 0 || site >= ERR_SITE_COUNT) return;
+    // M0+ has no atomic RMW; the SIO spinlock makes the increment safe
+    // against the other core and against IRQs for a handful of cycles.
+    if (s_lock != NULL) {
+        uint32_t save = spin_lock_blocking(s_lock);
+        s_count[site]++;
+        spin_unlock(s_lock, save);
+    } else {
+        s_count[site]++;  // pre-init: single-threaded boot path
+    }
+}
+
+uint32_t err_stats_get(int site) {
+    if (site < 0 || site >= ERR_SITE_COUNT) return 0;
+    return s_count[site];  // word read, atomic on this core
+}
+
+const char* err_stats_site_name(int site) {
+    if (site < 0 || site >= ERR_SITE_COUNT) return "?";
+    return s_site_name[site];
+}
+
+bool err_stats_detail_allowed(int site) {
+    if (site < 0 || site >= ERR_SITE_COUNT) return false;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if (s_last_detail_ms[site] != 0 &&
+        now - s_last_detail_ms[site] < ERR_STATS_DETAIL_MIN_MS)
+        return false;
+    s_last_detail_ms[site] = now != 0 ? now : 1;
+    return true;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file err_stats.h
+ *
+ * @brief Fixed-slot error counters with rate-limited detail records
+ *
+ * The only error signals used to be the DHT LED and a printf per
+ * failed Invoke - a unit could fail thousands of reads with nothing
+ * quantifying it. Each failure site now bumps one fixed counter slot
+ * (a few cycles under a hardware spinlock, safe from both cores and
+ * from IRQ context), and the periodic telemetry batch exports the
+ * whole table in one summary frame. Detail records (the human-readable
+ * LogWarn/LogError lines) are rate-limited per site, so log volume
+ * stays flat no matter how fast a site fails - the counters carry the
+ * rate, the occasional detail line carries the context.
+ */
+
+#ifndef ERR_STATS_H
+#define ERR_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Counter slots, one per failure site.
+ */
+enum ErrSite {
+    ERR_DHT_CHECKSUM = 0,  ///< DHT11 frame received but checksum mismatched
+    ERR_DHT_TIMEOUT,       ///< DHT11 transfer truncated / polling deadline hit
+    ERR_ADC_RANGE,         ///< soil reading pinned at an ADC rail
+    ERR_INVOKE,            ///< interpreter Invoke() returned an error
+    ERR_INVOKE_DL,         ///< Invoke() overran its deadline, result discarded
+    ERR_QUEUE_OVERRUN,     ///< non-blocking queue deposit dropped
+    ERR_STALE_ACT,         ///< frame older than the staleness bound actuated
+    ERR_SKIP_FLASH,        ///< cycle deadline skipped, flash maintenance ran
+    ERR_SKIP_SENSOR,       ///< cycle deadline skipped, sensor retries/timeout
+    ERR_SKIP_OTHER,        ///< cycle deadline skipped, no attributed cause
+    ERR_MODEL_BIND,        ///< model bind/AllocateTensors failed, fallback engaged
+    ERR_BROWNOUT,          ///< supply sag tripped the emergency commit path
+    ERR_STATE_GUARD,       ///< guarded state block failed its checksum
+    ERR_DHT_SALVAGE,       ///< DHT11 checksum failure recovered by re-classify
+    ERR_GOLDEN,            ///< golden-vector probe mismatch, bank fallback engaged
+    ERR_SITE_COUNT
+};
+
+/**
+ * @brief Claim the counter spinlock. Call once at boot, before any site
+ *        can fire (bumps before init fall back to an unlocked add).
+ */
+void err_stats_init(void);
+
+/**
+ * @brief Count one failure at the given site. Safe from any context.
+ */
+void err_stats_bump(int site);
+
+/**
+ * @brief Cumulative count for one site since boot.
+ */
+uint32_t err_stats_get(int site);
+
+/**
+ * @brief Short site name for the shell / summary printouts.
+ */
+const char* err_stats_site_name(int site);
+
+/**
+ * @brief Ask permission to emit a detail record for this site.
+ *
+ * Grants at most one detail per site per ERR_STATS_DETAIL_MIN_MS; the
+ * first failure after boot is always granted. Callers skip their log
+ * line when this returns false - the counter still ticked.
+ */
+bool err_stats_detail_allowed(int site);
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * @file fixed_q.h
+ *
+ * @brief Const-generic Q-format fixed point for the integer pipeline
+ *
+ * The soft-float elimination program has been hand-rolling Q formats
+ * stage by stage - the Q16 quantizer multipliers, the Q8 EMAs in the
+ * history ring and the dither, the interpolator scale path - and every
+ * hand-rolled shift is a place for a scaling bug to breed. This header
+ * gives those stages one vocabulary: QFixed<Frac> wraps the raw int32
+ * with its binary point carried in the type, so mixing Q8 into a Q16
+ * expression without an explicit rescale<>() fails to compile instead
+ * of shipping a silently wrong shift.
+ *
+ * Zero-cost discipline: every member is a trivial inline over the same
+ * int32 arithmetic the call sites already emit - the struct is one
+ * register wide, there is no virtual anything, and the benchmark suite
+ * (sim --bench "quantize" and the on-target QuantBenchmark) times the
+ * library-backed quantizer against its golden numbers, so an
+ * abstraction that ever grew a real cost would fail the bench gate.
+ * Compile-time conversion factors (lit()) are the only place float
+ * appears, and constexpr guarantees it never reaches the target.
+ *
+ * Host-pure (stdint only): control_logic.h builds on it, so the sim's
+ * bit-exactness twins cover every mapping.
+ */
+
+#ifndef FIXED_Q_H
+#define FIXED_Q_H
+
+#include <stdint.h>
+
+/** @brief Saturate a widened intermediate back to int32. */
+static inline int32_t fixed_sat32(int64_t v) {
+    if (v > INT32_MAX) return INT32_MAX;
+    if (v < INT32_MIN) return INT32_MIN;
+    return (int32_t)v;
+}
+
+template <int Frac>
+struct QFixed {
+    static_assert(Frac >= 0 && Frac < 31, "binary point out of range");
+
+    int32_t raw;  ///< value * 2^Frac
+
+    /** @brief Wrap an already-scaled raw value (interop with legacy fields). */
+    static constexpr QFixed from_raw(int32_t r) { return QFixed{r}; }
+
+    /** @brief Whole number into Q; the shift is the only conversion. */
+    static constexpr QFixed from_int(int32_t v) {
+        return QFixed{(int32_t)((uint32_t)v << Frac)};
+    }
+
+    /**
+     * @brief Compile-time literal: the one sanctioned float appearance.
+     *
+     * Use for conversion factors ("0.1 / scale" and friends) in
+     * constexpr context only; the rounding matches the init-time
+     * factor computations the stages already do.
+     */
+    static constexpr QFixed lit(double v) {
+        return QFixed{(int32_t)(v * (double)(1u << Frac) +
+                                (v >= 0 ? 0.5 : -0.5))};
+    }
+
+    /** @brief Truncate toward negative infinity (arithmetic shift). */
+    constexpr int32_t to_int_floor() const { return raw >> Frac; }
+
+    /** @brief Round to nearest integer (half away from zero is not
+     * needed anywhere in the pipeline; this is half-up, matching the
+     * (+2^(Frac-1)) >> Frac idiom every stage uses). */
+    constexpr int32_t to_int_round() const {
+        return (int32_t)((raw + (1 << (Frac - 1))) >> Frac);
+    }
+
+    /** @brief Fractional part, raw (always in [0, 2^Frac) for v >= 0). */
+    constexpr int32_t frac_raw() const {
+        return raw - (int32_t)((uint32_t)(raw >> Frac) << Frac);
+    }
+
+    constexpr QFixed operator+(QFixed o) const { return QFixed{raw + o.raw}; }
+    constexpr QFixed operator-(QFixed o) const { return QFixed{raw - o.raw}; }
+    constexpr bool operator==(QFixed o) const { return raw == o.raw; }
+    constexpr bool operator<(QFixed o) const { return raw < o.raw; }
+
+    /** @brief Saturating add: one widening add and two compares on M0+. */
+    QFixed sat_add(QFixed o) const {
+        return QFixed{fixed_sat32((int64_t)raw + o.raw)};
+    }
+
+    QFixed sat_sub(QFixed o) const {
+        return QFixed{fixed_sat32((int64_t)raw - o.raw)};
+    }
+
+    /**
+     * @brief Q*Q multiply, rounded: widening MULS pair plus shift.
+     *
+     * The widening multiply is what the M0+ batch paths split into two
+     * 32-bit MULS by hand (quantize_rows10); single-value call sites
+     * take the libgcc 64-bit multiply, same as they always have.
+     */
+    QFixed mul(QFixed o) const {
+        return QFixed{(int32_t)(((int64_t)raw * o.raw +
+                                 ((int64_t)1 << (Frac - 1))) >> Frac)};
+    }
+
+    /**
+     * @brief Multiply by a whole number, result rounded to a whole
+     * number - the quantizer's core op (Q16 factor x deci value).
+     */
+    int32_t mul_int_round(int32_t v) const {
+        return (int32_t)(((int64_t)raw * v + ((int64_t)1 << (Frac - 1))) >>
+                         Frac);
+    }
+
+    /** @brief Move the binary point; widening narrows with rounding. */
+    template <int To>
+    constexpr QFixed<To> rescale() const {
+        return To >= Frac
+            ? QFixed<To>{(int32_t)((uint32_t)raw << (To - Frac))}
+            : QFixed<To>{(int32_t)((raw + (1 << (Frac - To - 1))) >>
+                                   (Frac - To))};
+    }
+};
+
+// The formats the pipeline actually speaks.
+using Q8 = QFixed<8>;    ///< EMAs, dither targets, confidence weights
+using Q16 = QFixed<16>;  ///< quantizer multipliers (16.16)
+
+/**
+ * @brief One EMA step with the pipeline's shift-alpha convention:
+ * e += (target - e) >> shift. Same truncation bias as every existing
+ * site, so adoption is bit-exact.
+ */
+template <int Frac>
+static inline void q_ema_step(QFixed<Frac>* e, QFixed<Frac> target,
+                              int shift) {
+    e->raw += (target.raw - e->raw) >> shift;
+}
+
+#endif
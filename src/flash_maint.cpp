@@ -0,0 +1,100 @@
+/**
+ * @file flash_maint.cpp
+ *
+ * @brief Flash maintenance scheduler implementation
+ *
+ * Small fixed queue under a hardware spinlock (defer can come from the
+ * report and drain tasks); execution is single-consumer in the report
+ * task, so the operations themselves need no locking beyond their own
+ * flash_safe_execute().
+ */
+
+#include "flash_maint.h"
+
+#include "hardware/sync.h"
+
+#include "app_log.h"
+
+#define FLASH_MAINT_SLOTS 4
+
+// Safety margin on top of each operation's own estimate: the erase
+// time datasheet numbers are typical, not worst case.
+#define FLASH_MAINT_MARGIN_MS 20
+
+// Cycles an operation may be skipped for lack of window before it runs
+// regardless. One late frame beats losing staged data indefinitely.
+#define FLASH_MAINT_STARVE_CYCLES 10
+
+struct MaintOp {
+    const char* name;
+    FlashMaintFn fn;
+    uint32_t cost_ms;
+};
+
+static MaintOp s_queue[FLASH_MAINT_SLOTS];
+static volatile int s_queued;
+static uint32_t s_starved;  // report task only
+static volatile uint32_t s_last_run_ms;
+static spin_lock_t* s_lock = NULL;
+
+void flash_maint_init(void) {
+    s_lock = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+bool flash_maint_defer(const char* name, FlashMaintFn fn, uint32_t cost_ms) {
+    uint32_t save = spin_lock_blocking(s_lock);
+    for (int i = 0; i < s_queued; i++) {
+        if (s_queue[i].fn == fn) {  // already pending; staged data is shared
+            spin_unlock(s_lock, save);
+            return true;
+        }
+    }
+    if (s_queued == FLASH_MAINT_SLOTS) {
+        spin_unlock(s_lock, save);
+        return false;
+    }
+    s_queue[s_queued].name = name;
+    s_queue[s_queued].fn = fn;
+    s_queue[s_queued].cost_ms = cost_ms;
+    s_queued = s_queued + 1;
+    spin_unlock(s_lock, save);
+    return true;
+}
+
+bool flash_maint_pending(void) {
+    return s_queued > 0;
+}
+
+void flash_maint_run(uint32_t idle_ms) {
+    while (true) {
+        uint32_t save = spin_lock_blocking(s_lock);
+        if (s_queued == 0) {
+            spin_unlock(s_lock, save);
+            s_starved = 0;
+            return;
+        }
+        MaintOp op = s_queue[0];
+        bool fits = op.cost_ms + FLASH_MAINT_MARGIN_MS <= idle_ms;
+        if (!fits && s_starved < FLASH_MAINT_STARVE_CYCLES) {
+            spin_unlock(s_lock, save);
+            s_starved++;
+            return;
+        }
+        for (int i = 1; i < s_queued; i++) s_queue[i - 1] = s_queue[i];
+        s_queued = s_queued - 1;
+        spin_unlock(s_lock, save);
+
+        if (!fits)
+            LogWarn(("flash maint: no window for %s in %u cycles, running anyway",
+                     op.name, (unsigned)s_starved));
+        op.fn();
+        s_starved = 0;
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        s_last_run_ms = now != 0 ? now : 1;
+        idle_ms = fits ? idle_ms - op.cost_ms : 0;
+    }
+}
+
+uint32_t flash_maint_last_run_ms(void) {
+    return s_last_run_ms;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file flash_maint.h
+ *
+ * @brief Idle-window scheduler for flash erase/program maintenance
+ *
+ * A sector erase stalls XIP for tens of milliseconds and
+ * flash_safe_execute() parks the other core on top of that - run
+ * mid-cycle (the datalogger used to commit whenever its buffer
+ * happened to fill) it stalls inference and actuation together.
+ * Writers now stage their data in RAM and defer the flash operation
+ * here; the report task drains the queue right after actuation goes
+ * out, when the next frame is most of a control period away, and only
+ * runs an operation whose cost estimate fits the remaining window.
+ * An operation starved too long (adaptive period pinned short) runs
+ * anyway with a warning - one late frame beats unbounded data loss.
+ *
+ * The deferred functions do their own flash_safe_execute(); this
+ * module only decides when they run. Bulk interactive paths (model
+ * upload) stay synchronous - they monopolize the shell by design.
+ */
+
+#ifndef FLASH_MAINT_H
+#define FLASH_MAINT_H
+
+#include "pico/stdlib.h"
+
+typedef void (*FlashMaintFn)(void);
+
+/**
+ * @brief Claim the queue spinlock. Call once at boot.
+ */
+void flash_maint_init(void);
+
+/**
+ * @brief Queue a maintenance operation for the next idle window.
+ *
+ * A function already queued is not queued twice (the staged RAM data
+ * it reads is simply the latest). Safe from any task.
+ *
+ * @param name    Short tag for log lines.
+ * @param fn      Operation; runs in the report task's idle window.
+ * @param cost_ms Worst-case runtime estimate, for window fitting.
+ * @return false when the queue is full (caller retries later).
+ */
+bool flash_maint_defer(const char* name, FlashMaintFn fn, uint32_t cost_ms);
+
+/**
+ * @brief Anything queued?
+ */
+bool flash_maint_pending(void);
+
+/**
+ * @brief Run queued operations that fit the remaining idle time.
+ *
+ * Called once per cycle from the report task after actuation.
+ */
+void flash_maint_run(uint32_t idle_ms);
+
+/**
+ * @brief Boot-relative ms of the most recent executed operation, 0 if
+ *        none yet. The scheduler uses this to attribute cycle overruns.
+ */
+uint32_t flash_maint_last_run_ms(void);
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file float_audit.cpp
+ *
+ * @brief Counting shims around the AEABI soft-float intrinsics
+ *
+ * Only compiled into QDNN_FLOAT_AUDIT builds; the --wrap options that
+ * route calls through here live next to the option in CMakeLists.txt.
+ * The shims must not themselves touch floating point beyond forwarding
+ * the arguments, and they run from any context (both cores, IRQs), so
+ * the bookkeeping is plain word writes: an occasional lost tick is
+ * acceptable in a build whose job is finding call sites, not billing
+ * exact cycle counts.
+ */
+
+#include "float_audit.h"
+
+#include <cstdio>
+
+static volatile uint32_t s_count[FA_OP_COUNT];
+static volatile uint32_t s_caller[FA_OP_COUNT][FLOAT_AUDIT_CALLERS];
+
+static const char* const s_op_name[FA_OP_COUNT] = {
+    "fadd", "fmul", "fdiv", "dadd", "dmul", "ddiv",
+    "f2i", "d2i", "f2d", "sqrt",
+};
+
+// Bump one slot and remember the caller if it is new and there is room.
+// The Thumb bit is stripped so the addresses line up with addr2line.
+static void note(int op, void* ra) {
+    s_count[op] = s_count[op] + 1;
+    uint32_t addr = (uint32_t)ra & ~1u;
+    for (int i = 0; i < FLOAT_AUDIT_CALLERS; i++) {
+        if (s_caller[op][i] == addr) return;
+        if (s_caller[op][i] == 0) {
+            s_caller[op][i] = addr;
+            return;
+        }
+    }
+}
+
+uint32_t float_audit_count(int op) {
+    if (op < 0 || op >= FA_OP_COUNT) return 0;
+    return s_count[op];
+}
+
+const char* float_audit_op_name(int op) {
+    if (op < 0 || op >= FA_OP_COUNT) return "?";
+    return s_op_name[op];
+}
+
+void float_audit_report(void) {
+    for (int op = 0; op < FA_OP_COUNT; op++) {
+        if (s_count[op] == 0) continue;
+        printf("float %-4s n=%u from", s_op_name[op], (unsigned)s_count[op]);
+        for (int i = 0; i < FLOAT_AUDIT_CALLERS && s_caller[op][i]; i++)
+            printf(" %08x", (unsigned)s_caller[op][i]);
+        printf("\n");
+    }
+}
+
+// =======================
+// Intrinsic shims
+// =======================
+// One macro per AEABI signature; __real_ resolves to the libgcc
+// implementation (the audit build selects the compiler float/double
+// backends so the SDK's ROM wrappers do not contend for these slots).
+
+#define SHIM2(ret, name, slot, t1, t2)                      \
+    extern "C" ret __real_##name(t1, t2);                   \
+    extern "C" ret __wrap_##name(t1 a, t2 b) {              \
+        note(slot, __builtin_return_address(0));            \
+        return __real_##name(a, b);                         \
+    }
+
+#define SHIM1(ret, name, slot, t1)                          \
+    extern "C" ret __real_##name(t1);                       \
+    extern "C" ret __wrap_##name(t1 a) {                    \
+        note(slot, __builtin_return_address(0));            \
+        return __real_##name(a);                            \
+    }
+
+SHIM2(float,  __aeabi_fadd, FA_FADD, float, float)
+SHIM2(float,  __aeabi_fsub, FA_FADD, float, float)
+SHIM2(float,  __aeabi_fmul, FA_FMUL, float, float)
+SHIM2(float,  __aeabi_fdiv, FA_FDIV, float, float)
+SHIM2(double, __aeabi_dadd, FA_DADD, double, double)
+SHIM2(double, __aeabi_dsub, FA_DADD, double, double)
+SHIM2(double, __aeabi_dmul, FA_DMUL, double, double)
+SHIM2(double, __aeabi_ddiv, FA_DDIV, double, double)
+SHIM1(float,  __aeabi_i2f,  FA_F2I, int)
+SHIM1(float,  __aeabi_ui2f, FA_F2I, unsigned)
+SHIM1(int,      __aeabi_f2iz,  FA_F2I, float)
+SHIM1(unsigned, __aeabi_f2uiz, FA_F2I, float)
+SHIM1(double, __aeabi_i2d,  FA_D2I, int)
+SHIM1(double, __aeabi_ui2d, FA_D2I, unsigned)
+SHIM1(int,      __aeabi_d2iz,  FA_D2I, double)
+SHIM1(unsigned, __aeabi_d2uiz, FA_D2I, double)
+SHIM1(double, __aeabi_f2d,  FA_F2D, float)
+SHIM1(float,  __aeabi_d2f,  FA_F2D, double)
+SHIM1(float,  sqrtf,        FA_SQRT, float)
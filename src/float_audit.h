@@ -0,0 +1,68 @@
+/**
+ * @file float_audit.h
+ *
+ * @brief Soft-float usage counters for the QDNN_FLOAT_AUDIT build
+ *
+ * The RP2040 emulates all floating point, so one stray float on the
+ * hot path costs hundreds of cycles - and after the integer-path
+ * conversion work there is no guard against someone reintroducing a
+ * double division in a loop. The audit build wraps the AEABI
+ * soft-float intrinsics (and sqrtf) with counting shims via the
+ * linker's --wrap: every call bumps a per-intrinsic counter and
+ * records the first few distinct caller return addresses, so "stats"
+ * shows not just that floats run but where from (feed the addresses to
+ * addr2line against the audit ELF). The same build also drops a
+ * link-time symbol report next to the ELF listing every soft-float
+ * reference that survived into the image.
+ *
+ * Audit builds route the intrinsics through libgcc instead of the
+ * SDK's ROM-accelerated wrappers (which claim the same --wrap slots),
+ * so the numbers describe call frequency, not production cycle cost.
+ */
+
+#ifndef FLOAT_AUDIT_H
+#define FLOAT_AUDIT_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Counter slots, one per wrapped intrinsic.
+ */
+enum FloatAuditOp {
+    FA_FADD = 0,  ///< float add/sub (__aeabi_fadd / __aeabi_fsub)
+    FA_FMUL,      ///< float multiply
+    FA_FDIV,      ///< float divide
+    FA_DADD,      ///< double add/sub
+    FA_DMUL,      ///< double multiply
+    FA_DDIV,      ///< double divide
+    FA_F2I,       ///< float <-> int conversions
+    FA_D2I,       ///< double <-> int conversions
+    FA_F2D,       ///< float <-> double conversions
+    FA_SQRT,      ///< sqrtf
+    FA_OP_COUNT
+};
+
+/**
+ * @brief Distinct caller addresses remembered per slot.
+ */
+#define FLOAT_AUDIT_CALLERS 4
+
+/**
+ * @brief Cumulative call count for one intrinsic slot since boot.
+ */
+uint32_t float_audit_count(int op);
+
+/**
+ * @brief Short intrinsic name for the shell printout.
+ */
+const char* float_audit_op_name(int op);
+
+/**
+ * @brief One-line-per-slot report of counts and caller addresses.
+ *
+ * Counters are plain increments - a race between cores can undercount
+ * by a tick, which is noise at the rates that matter here.
+ */
+void float_audit_report(void);
+
+#endif
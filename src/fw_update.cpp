@@ -0,0 +1,268 @@
+/**
+ * @file fw_update.cpp
+ *
+ * @brief A/B firmware slot implementation
+ *
+ * Commit discipline mirrors model_bank: image sectors stream and
+ * program first, the header sector is held back and programmed last
+ * with the next monotonic sequence, so "newest valid header" is the
+ * atomic activation point and a power cut mid-download leaves the
+ * running slot newest. The difference is pacing - every sector
+ * program here rides the flash-maintenance queue into the
+ * post-actuation idle window, so a 300 KB download stretches over
+ * minutes of cycles without one of them missing its deadline.
+ */
+
+#include "fw_update.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/structs/watchdog.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "pico/flash.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "app_log.h"
+#include "flash_maint.h"
+#include "model_crc.h"
+
+static int s_running_slot;           // 0 when no selector note found
+static bool s_running_confirmed;
+static uint32_t s_slot_seq[2];       // 0 = no valid header
+static bool s_slot_valid[2];
+
+static const FwSlotHeader* slot_header(int slot) {
+    // No-allocate alias: header reads must see flash, not a cache line
+    return (const FwSlotHeader*)(XIP_NOCACHE_NOALLOC_BASE + FW_SLOT_OFFSET(slot));
+}
+
+// Reflected CRC-32 step (poly 0xEDB88320), for the stream tally; the
+// flash readback goes through the DMA sniffer instead.
+static uint32_t crc32_step(uint32_t crc, uint8_t b) {
+    crc ^= b;
+    for (int i = 0; i < 8; i++)
+        crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    return crc;
+}
+
+// Header plausibility + sniffer CRC over the flash image. Claims the
+// sniffer channel; the caller releases when its checks are done.
+static bool slot_valid(int slot) {
+    const FwSlotHeader* h = slot_header(slot);
+    if (h->magic != FW_SLOT_MAGIC) return false;
+    if (h->slot != (uint32_t)slot) return false;
+    if (h->len == 0 || h->len > FW_SLOT_BYTES - FW_HEADER_BYTES) return false;
+    model_crc_begin((const uint8_t*)h + FW_HEADER_BYTES, h->len);
+    return model_crc_wait() == h->crc32;
+}
+
+void fw_update_init(void) {
+    if (watchdog_hw->scratch[FW_SCRATCH_IDX] == FW_SCRATCH_MAGIC)
+        s_running_slot =
+            (int)fw_trial_slot(watchdog_hw->scratch[FW_SCRATCH_IDX + 1]);
+    for (int s = 0; s < 2; s++) {
+        s_slot_valid[s] = slot_valid(s);
+        s_slot_seq[s] = s_slot_valid[s] ? slot_header(s)->seq : 0;
+    }
+    model_crc_release();
+    s_running_confirmed = s_slot_valid[s_running_slot] &&
+                          slot_header(s_running_slot)->confirmed == 0;
+    LogInfo(("fw: running slot %d (seq %u, %s)", s_running_slot,
+             (unsigned)s_slot_seq[s_running_slot],
+             s_running_confirmed ? "confirmed" : "on trial"));
+}
+
+int fw_update_slot(void) {
+    return s_running_slot;
+}
+
+// --- Deferred sector program: stage, queue, wait for the idle window ---
+
+struct FwProgOp {
+    uint32_t offset;
+    const uint8_t* data;
+};
+
+static FwProgOp s_op;
+static volatile bool s_op_done;
+static volatile bool s_op_ok;
+
+static void fw_flash_call(void* param) {
+    const FwProgOp* op = (const FwProgOp*)param;
+    flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+    flash_range_program(op->offset, op->data, FLASH_SECTOR_SIZE);
+}
+
+static void fw_maint_op(void) {
+    s_op_ok = (flash_safe_execute(fw_flash_call, &s_op, 1000) == PICO_OK);
+    s_op_done = true;
+}
+
+static int program_deferred(uint32_t offset, const uint8_t* data) {
+    s_op.offset = offset;
+    s_op.data = data;
+    s_op_ok = false;
+    s_op_done = false;
+    while (!flash_maint_defer("fwup", fw_maint_op, 60))
+        vTaskDelay(pdMS_TO_TICKS(50));  // queue full: drains next cycle
+    while (!s_op_done)
+        vTaskDelay(pdMS_TO_TICKS(10));  // runs in the next idle window
+    if (!s_op_ok)
+        LogError(("fw: flash program failed at 0x%08x", (unsigned)offset));
+    return s_op_ok ? 0 : -1;
+}
+
+// Streaming buffer: one sector staged at a time; the completion wait
+// above doubles as flow control, so a second buffer buys nothing.
+static uint8_t s_first[FLASH_SECTOR_SIZE];
+static uint8_t s_sector[FLASH_SECTOR_SIZE];
+
+int fw_update_upload(uint32_t len, uint32_t expect_crc) {
+    int target = 1 - s_running_slot;
+    if (len <= FW_HEADER_BYTES || len > FW_SLOT_BYTES) {
+        LogError(("fw: length %u outside slot capacity %u",
+                  (unsigned)len, (unsigned)FW_SLOT_BYTES));
+        return -1;
+    }
+    uint32_t base = FW_SLOT_OFFSET(target);
+
+    // Sector 0 (with the header) staged in s_first and committed last;
+    // later sectors stream through s_sector one idle window at a time.
+    memset(s_first, 0xFF, sizeof(s_first));
+    uint32_t crc = 0xFFFFFFFFu;
+    uint32_t received = 0;
+    uint32_t sector = 0;
+    uint32_t fill = 0;
+    uint8_t* buf = s_first;
+
+    while (received < len) {
+        uint32_t want = len - received;
+        if (want > FLASH_SECTOR_SIZE - fill) want = FLASH_SECTOR_SIZE - fill;
+        // Prompt-per-chunk flow control: the host sends the next burst
+        // only after the previous sector landed in flash.
+        printf("ok %u\n", (unsigned)sector);
+        for (uint32_t i = 0; i < want; i++) {
+            int c = getchar_timeout_us(10 * 1000 * 1000);
+            if (c < 0) {
+                LogError(("fw: upload timed out at byte %u", (unsigned)received));
+                return -1;
+            }
+            buf[fill++] = (uint8_t)c;
+            crc = crc32_step(crc, (uint8_t)c);
+            received++;
+        }
+        if (fill == FLASH_SECTOR_SIZE || received == len) {
+            if (sector > 0 &&
+                program_deferred(base + sector * FLASH_SECTOR_SIZE, buf) != 0)
+                return -1;
+            sector++;
+            if (buf == s_first) buf = s_sector;
+            memset(buf, 0xFF, FLASH_SECTOR_SIZE);
+            fill = 0;
+        }
+    }
+    crc = ~crc;
+    if (crc != expect_crc) {
+        LogError(("fw: stream CRC %08x != announced %08x",
+                  (unsigned)crc, (unsigned)expect_crc));
+        return -1;
+    }
+
+    // The streamed header must be an image built for this slot; the
+    // link address is baked in, so a slot mismatch would hard fault
+    // at the first flash literal.
+    FwSlotHeader* h = (FwSlotHeader*)s_first;
+    if (h->magic != FW_SLOT_MAGIC || h->slot != (uint32_t)target ||
+        h->len != len - FW_HEADER_BYTES || h->confirmed != 0xFFFFFFFFu) {
+        LogError(("fw: header rejects (magic/slot/len), built for slot %u?",
+                  (unsigned)h->slot));
+        return -1;
+    }
+    uint32_t newest = s_slot_seq[0] > s_slot_seq[1] ? s_slot_seq[0]
+                                                    : s_slot_seq[1];
+    h->seq = newest + 1;  // header CRC covers the image only; free to stamp
+
+    if (program_deferred(base, s_first) != 0)
+        return -1;
+
+    // Read back the flash copy end to end before arming it
+    if (!slot_valid(target)) {
+        model_crc_release();
+        LogError(("fw: flash readback mismatch, slot %d left inactive", target));
+        return -1;
+    }
+    model_crc_release();
+    xip_ctrl_hw->flush = 1;
+    (void)xip_ctrl_hw->flush;  // no stale lines under the new image
+
+    s_slot_valid[target] = true;
+    s_slot_seq[target] = h->seq;
+    LogInfo(("fw: slot %d armed (seq %u, %u bytes); trial at next reboot",
+             target, (unsigned)h->seq, (unsigned)len));
+    return 0;
+}
+
+#define FW_CONFIRM_PAGE_BYTES 256
+static_assert(FW_HEADER_BYTES == FW_CONFIRM_PAGE_BYTES,
+              "confirm reprograms exactly the header page");
+
+static uint8_t s_confirm_page[FW_CONFIRM_PAGE_BYTES];
+static volatile bool s_confirm_queued;
+
+static void fw_confirm_call(void* param) {
+    (void)param;
+    flash_range_program(FW_SLOT_OFFSET(s_running_slot), s_confirm_page,
+                        FW_CONFIRM_PAGE_BYTES);
+}
+
+static void fw_confirm_op(void) {
+    if (flash_safe_execute(fw_confirm_call, NULL, 1000) == PICO_OK) {
+        s_running_confirmed = true;
+        LogInfo(("fw: slot %d confirmed good", s_running_slot));
+    } else {
+        s_confirm_queued = false;  // retried by the next cycle's call
+        LogWarn(("fw: confirm program failed, still on trial"));
+    }
+}
+
+void fw_update_mark_good(void) {
+    // Trial scratch clears first: the very next watchdog reset must
+    // not count against an image that already reached a decision.
+    if (watchdog_hw->scratch[FW_SCRATCH_IDX] == FW_SCRATCH_MAGIC) {
+        uint32_t p = watchdog_hw->scratch[FW_SCRATCH_IDX + 1];
+        if (fw_trial_attempts(p) != 0)
+            watchdog_hw->scratch[FW_SCRATCH_IDX + 1] =
+                fw_trial_pack(fw_trial_slot(p), 0, fw_trial_seq(p));
+    }
+    if (!s_slot_valid[s_running_slot] || s_running_confirmed ||
+        s_confirm_queued)
+        return;
+
+    // NOR program only clears bits: rewriting the header page with
+    // confirmed = 0 commits without an erase, so the header's other
+    // fields are untouchable mid-operation. Fire-and-forget defer -
+    // this runs in the report task, which also drains the queue, so
+    // waiting here would deadlock the idle window.
+    memcpy(s_confirm_page, (const void*)slot_header(s_running_slot),
+           FW_CONFIRM_PAGE_BYTES);
+    ((FwSlotHeader*)s_confirm_page)->confirmed = 0;
+    if (flash_maint_defer("fwok", fw_confirm_op, 10))
+        s_confirm_queued = true;
+}
+
+void fw_update_report(void) {
+    for (int s = 0; s < 2; s++) {
+        const FwSlotHeader* h = slot_header(s);
+        if (s_slot_valid[s])
+            printf("  slot %d: seq %u, %u bytes, v%u, %s%s\n", s,
+                   (unsigned)h->seq, (unsigned)h->len, (unsigned)h->version,
+                   h->confirmed == 0 ? "confirmed" : "on trial",
+                   s == s_running_slot ? " (running)" : "");
+        else
+            printf("  slot %d: empty%s\n", s,
+                   s == s_running_slot ? " (running, headerless)" : "");
+    }
+}
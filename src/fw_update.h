@@ -0,0 +1,140 @@
+/**
+ * @file fw_update.h
+ *
+ * @brief A/B firmware slots with background OTA streaming
+ *
+ * Model OTA (model_bank.h) removed the truck roll for retrained
+ * weights; firmware itself still needed the BOOTSEL button. This
+ * module gives the application image the same dual-bank treatment:
+ * two slots at the bottom of flash behind a small boot selector, an
+ * update streamed into the inactive slot with every sector program
+ * deferred through the flash-maintenance scheduler (XIP stalls land
+ * in the post-actuation idle window, never mid-cycle), payload
+ * integrity verified with the DMA sniffer CRC, and an MCUboot-style
+ * trial boot: the selector launches an unconfirmed image under a
+ * hardware watchdog and counts attempts in a scratch register, the
+ * image confirms itself after its first healthy decision, and
+ * FW_TRIAL_MAX failed attempts roll back to the previous slot.
+ *
+ * Flash map (bottom up): FW_BOOT_SECTORS of boot2 + selector, then
+ * slot 0 and slot 1 of QDNN_FW_SLOT_SECTORS each. The top-of-flash
+ * data regions (calib/crash/datalog/model banks/config) are unmoved;
+ * the slot size is a configure-time knob and must leave them intact.
+ * Each slot is a FW_HEADER_BYTES header followed by a standard
+ * application image (boot2 stub + vector table), linked for that
+ * slot's XIP address - an image built for one slot is refused by the
+ * other, which is why the header carries its slot index.
+ *
+ * Confirmation reuses NOR program semantics: the header ships with
+ * confirmed = 0xFFFFFFFF and marking good programs the header page
+ * again with confirmed = 0 - bits only clear, no erase, so the commit
+ * is a single deferred page program.
+ *
+ * Enabled with QDNN_AB_SLOTS; tools/fw_image.py wraps an app.bin
+ * into a slot image and prints the matching "fwload" line.
+ */
+
+#ifndef FW_UPDATE_H
+#define FW_UPDATE_H
+
+#include "hardware/flash.h"
+#include "pico/stdlib.h"
+
+/** @brief Sectors reserved for boot2 + the slot selector. */
+#define FW_BOOT_SECTORS 4
+
+/** @brief Sectors per application slot (configure-time knob). */
+#ifndef QDNN_FW_SLOT_SECTORS
+#define QDNN_FW_SLOT_SECTORS 200
+#endif
+
+#define FW_SLOT_BYTES   ((uint32_t)QDNN_FW_SLOT_SECTORS * FLASH_SECTOR_SIZE)
+#define FW_SLOT_OFFSET(s) \
+    ((uint32_t)FW_BOOT_SECTORS * FLASH_SECTOR_SIZE + (uint32_t)(s) * FW_SLOT_BYTES)
+
+/** @brief Header size; keeps the image (and its vector table) aligned. */
+#define FW_HEADER_BYTES 256
+
+#define FW_SLOT_MAGIC 0x51465730u  // "QFW0"
+
+/** @brief Failed trial boots before the selector rolls back. */
+#define FW_TRIAL_MAX 3
+
+/**
+ * @brief Slot header, first FW_HEADER_BYTES of each slot (tail 0xFF).
+ *
+ * Shared with boot/boot_select.c - this struct is the contract
+ * between selector and application.
+ */
+struct FwSlotHeader {
+    uint32_t magic;
+    uint32_t seq;        ///< monotonic across both slots; newest wins
+    uint32_t len;        ///< image bytes after the header
+    uint32_t crc32;      ///< CRC-32 (IEEE) of the image
+    uint32_t slot;       ///< slot this image was linked for
+    uint32_t version;    ///< host build stamp, informational
+    uint32_t confirmed;  ///< 0xFFFFFFFF = on trial, 0 = known good
+    uint32_t reserved;
+};
+
+/**
+ * @brief Trial bookkeeping in watchdog scratch (survives watchdog and
+ *        soft resets, not power cycles - a power-cycled bad image
+ *        re-earns its FW_TRIAL_MAX, which is bounded and acceptable).
+ *
+ * scratch[0]/[1] belong to watchdog_guard (level restore); the
+ * selector owns scratch[2] (magic) and scratch[3] (packed trial).
+ */
+#define FW_SCRATCH_MAGIC 0x46575452u  // "FWTR"
+#define FW_SCRATCH_IDX   2
+
+static inline uint32_t fw_trial_pack(uint32_t slot, uint32_t attempts,
+                                     uint32_t seq) {
+    return (slot & 1u) | ((attempts & 0xFu) << 4) | ((seq & 0xFFFFu) << 16);
+}
+static inline uint32_t fw_trial_slot(uint32_t p)     { return p & 1u; }
+static inline uint32_t fw_trial_attempts(uint32_t p) { return (p >> 4) & 0xFu; }
+static inline uint32_t fw_trial_seq(uint32_t p)      { return (p >> 16) & 0xFFFFu; }
+
+/**
+ * @brief Learn the running slot from the selector's scratch note and
+ *        log the slot/seq/confirm state. Call once at boot, after
+ *        watchdog_restore_levels() has read its own scratch pair.
+ */
+void fw_update_init(void);
+
+/** @brief Slot this image is running from (0 when no selector ran). */
+int fw_update_slot(void);
+
+/**
+ * @brief Receive a slot image over stdio into the inactive slot.
+ *
+ * Flow-controlled: the shell announces length and stream CRC-32, then
+ * the host sends one sector's worth of raw bytes per "ok" prompt.
+ * Each sector program is deferred through flash_maint and the next
+ * prompt waits for it, so every erase lands in an idle window and
+ * the control loop never misses a beat during the download. The
+ * header sector is held back and committed last with the next
+ * monotonic sequence, after the flash copy verified against the
+ * header CRC through the DMA sniffer - a power cut mid-stream leaves
+ * the running slot newest.
+ *
+ * @return 0 on success (reboot to trial), -1 on timeout/size/CRC/
+ *         slot mismatch (the running slot is untouched either way).
+ */
+int fw_update_upload(uint32_t len, uint32_t expect_crc);
+
+/**
+ * @brief Confirm the running image after its first healthy decision.
+ *
+ * Clears the trial scratch immediately and defers the header confirm
+ * program; no-op when already confirmed or running without a header.
+ */
+void fw_update_mark_good(void);
+
+/**
+ * @brief Shell status line: both slots' header state + running slot.
+ */
+void fw_update_report(void);
+
+#endif
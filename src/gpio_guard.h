@@ -0,0 +1,67 @@
+/**
+ * @file gpio_guard.h
+ *
+ * @brief Glitch-free GPIO claim and snapshot/restore of pin state
+ *
+ * The SDK's gpio_init()/gpio_set_dir()/gpio_put() triple walks a pin
+ * through an observable intermediate: the pad floats as an input, then
+ * drives whatever stale value the SIO output latch holds, and only then
+ * takes the intended level. On a relay or MOSFET gate that window is a
+ * real click - a spurious actuator pulse on every reconfiguration. The
+ * helpers here order the writes so the level and direction are latched
+ * before the pad is connected, and capture/restore direction + output
+ * for a pin set in whole SIO words so recovery paths can put the pins
+ * back exactly as they found them, atomically per register.
+ */
+
+#ifndef GPIO_GUARD_H
+#define GPIO_GUARD_H
+
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+
+/**
+ * @brief Direction and output state for a set of pins, one SIO word each.
+ */
+struct GpioSnapshot {
+    uint32_t mask;  ///< pins the snapshot covers
+    uint32_t out;   ///< SIO output latch bits, masked
+    uint32_t dir;   ///< SIO output-enable bits, masked
+};
+
+/**
+ * @brief Capture direction and output level for every pin in the mask.
+ */
+static inline void gpio_guard_snapshot(uint32_t mask, GpioSnapshot* out) {
+    out->mask = mask;
+    out->out  = sio_hw->gpio_out & mask;
+    out->dir  = sio_hw->gpio_oe & mask;
+}
+
+/**
+ * @brief Restore a captured pin set without intermediate states.
+ *
+ * Output latches are written before output enables, so a pin returning
+ * to output drives its restored level from the first cycle it drives at
+ * all - never the value the interim owner left behind. Each register
+ * update is one masked SIO write, so all pins in the set move together.
+ */
+static inline void gpio_guard_restore(const GpioSnapshot* s) {
+    gpio_put_masked(s->mask, s->out);
+    gpio_set_dir_masked(s->mask, s->dir);
+}
+
+/**
+ * @brief Claim a pin as an SIO output already driving the given level.
+ *
+ * Replacement for the init/set_dir/put triple: level first, then
+ * direction, then the function switch that connects the pad - the load
+ * only ever sees the old state and then the requested one.
+ */
+static inline void gpio_guard_init_out(uint pin, bool value) {
+    gpio_put(pin, value);
+    gpio_set_dir(pin, GPIO_OUT);
+    gpio_set_function(pin, GPIO_FUNC_SIO);
+}
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * @file heap_stats.cpp
+ *
+ * @brief Heap instrumentation implementation
+ */
+
+#include "heap_stats.h"
+
+#include "FreeRTOS.h"
+#include "portable.h"
+
+#include "cppMemory.h"
+
+void heap_stats_collect(HeapStats* out) {
+    HeapStats_t hs;
+    vPortGetHeapStats(&hs);
+    out->free_bytes          = hs.xAvailableHeapSpaceInBytes;
+    out->min_ever_free_bytes = hs.xMinimumEverFreeBytesRemaining;
+    out->largest_free_block  = hs.xSizeOfLargestFreeBlockInBytes;
+
+    PoolAllocStats pool;
+    pool_get_stats(&pool);
+    out->pool_heap_allocs = pool.heap_allocs;
+    out->pool_exhausted = 0;
+    for (int c = 0; c < POOL_NUM_CLASSES; c++)
+        out->pool_exhausted += pool.exhausted[c];
+}
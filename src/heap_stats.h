@@ -0,0 +1,34 @@
+/**
+ * @file heap_stats.h
+ *
+ * @brief Runtime heap_4 instrumentation for fleet monitoring
+ *
+ * Snapshots free space, minimum-ever free and the largest free block
+ * from heap_4, plus the pool-allocator counters from cppMemory, into a
+ * fixed struct suitable for the binary telemetry stream. Largest free
+ * block shrinking while total free stays flat is the fragmentation
+ * signature fleet monitoring alerts on.
+ */
+
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief One heap snapshot.
+ */
+struct HeapStats {
+    uint32_t free_bytes;          ///< current free heap
+    uint32_t min_ever_free_bytes; ///< low-water mark since boot
+    uint32_t largest_free_block;  ///< biggest single allocation possible
+    uint32_t pool_heap_allocs;    ///< allocations that escaped the pools to heap_4
+    uint32_t pool_exhausted;      ///< pool-class misses (all classes summed)
+};
+
+/**
+ * @brief Fill @p out from heap_4 and the pool allocator counters.
+ */
+void heap_stats_collect(HeapStats* out);
+
+#endif
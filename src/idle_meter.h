@@ -0,0 +1,49 @@
+/**
+ * @file idle_meter.h
+ *
+ * @brief Idle-time accounting for power budgeting
+ *
+ * Field units run on panels sized from guesses; this module turns the
+ * guess into a measured duty cycle. Two power states are accounted:
+ *
+ *  - tickless builds: the port's deep-sleep window is timestamped via
+ *    configPRE/POST_SLEEP_PROCESSING, so the metric is exactly the
+ *    time the core spent in WFI with the sleep clocks gated;
+ *  - DVFS builds (tickless off): the idle hook wraps its own WFI and
+ *    accounts the time until the next interrupt.
+ *
+ * Either way the result feeds telemetry as an idle permille per
+ * collection interval plus a wake count - enough to verify that a
+ * DMA/PIO offload actually converted into measured idle time, and to
+ * project battery life per firmware release from the dashboards.
+ */
+
+#ifndef IDLE_METER_H
+#define IDLE_METER_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Idle accounting over the interval since the previous collect.
+ */
+struct IdleMeterReport {
+    uint32_t interval_us;   ///< wall time the numbers below cover
+    uint32_t idle_us;       ///< time spent asleep within the interval
+    uint16_t idle_permille; ///< idle_us / interval_us, 0..1000
+    uint32_t wakes;         ///< sleep entries (tickless) or WFI wakes
+};
+
+/**
+ * @brief Snapshot and reset the interval. First call covers since boot.
+ */
+void idle_meter_collect(IdleMeterReport* out);
+
+/**
+ * @brief Idle permille of the last collected interval, without
+ *        disturbing the interval (for consumers that scale work to
+ *        measured headroom, e.g. the drain shaper). 1000 until the
+ *        first collect.
+ */
+uint16_t idle_meter_last_permille(void);
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @file interp_scale.h
+ *
+ * @brief Hardware-interpolator clamp stage for batch feature scaling
+ *
+ * The per-feature affine maps in input assembly are already integer-only
+ * (Q16 multiply-add in quantize_deci_q16()), so what the SIO
+ * interpolator can usefully take over is the clamp: interp1's clamp
+ * mode bounds ACCUM0 into [BASE0, BASE1] in a single cycle, replacing
+ * the two compare-and-select pairs per feature in the batch conversion
+ * of multi-zone frames. Blend mode was considered for the linear map
+ * itself and rejected: its 8-bit fraction would quantize a 0..1000
+ * deci-percent range in ~4-unit steps, a real accuracy loss against
+ * the exact Q16 path.
+ *
+ * The interpolator is per-core SIO state, so each core may use this
+ * concurrently; setup is three register writes and is re-done per
+ * batch, which also means no claim/ownership protocol is needed.
+ * Header-only, firmware-side (control_logic.h stays host-pure).
+ */
+
+#ifndef INTERP_SCALE_H
+#define INTERP_SCALE_H
+
+#include "hardware/interp.h"
+
+/**
+ * @brief Program this core's interp1 lane 0 for signed clamping.
+ */
+static inline void interp_clamp_setup(int32_t qmin, int32_t qmax) {
+    interp_config cfg = interp_default_config();
+    interp_config_set_clamp(&cfg, true);
+    interp_config_set_signed(&cfg, true);
+    interp_set_config(interp1, 0, &cfg);
+    interp1->base[0] = (uint32_t)qmin;
+    interp1->base[1] = (uint32_t)qmax;
+}
+
+/**
+ * @brief Clamp one value into the range programmed by the setup call.
+ */
+static inline int32_t interp_clamp(int32_t v) {
+    interp1->accum[0] = (uint32_t)v;
+    return (int32_t)interp1->peek[0];
+}
+
+#endif
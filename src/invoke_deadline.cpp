@@ -0,0 +1,62 @@
+/**
+ * @file invoke_deadline.cpp
+ *
+ * @brief Invoke deadline guard implementation
+ *
+ * Low-level hardware alarms rather than the alarm pool: the pool's
+ * callback dispatch runs only on the core that owns it, and the guard
+ * needs a deadline on each core independently. Arm/disarm are two
+ * timer register writes, cheap enough to wrap every Invoke.
+ */
+
+#include "invoke_deadline.h"
+
+#include "hardware/timer.h"
+
+#include "app_log.h"
+#include "err_stats.h"
+#include "resource_map.h"
+
+// Per-core guard state, indexed by get_core_num(). The fired flag is
+// only ever set by this core's alarm IRQ and cleared by this core's
+// arm, so plain volatile accesses suffice.
+static int s_alarm[2] = {-1, -1};
+static uint32_t s_budget_ms[2];
+static volatile bool s_fired[2];
+
+static void deadline_alarm_cb(uint alarm_num) {
+    (void)alarm_num;
+    s_fired[get_core_num()] = true;
+    // Counted from the IRQ, not on disarm: a long overrun shows up in
+    // the periodic error summary while the Invoke is still running,
+    // instead of only after it (maybe never) returns.
+    err_stats_bump(ERR_INVOKE_DL);
+}
+
+void invoke_deadline_init(uint32_t budget_ms) {
+    uint core = get_core_num();
+    int alarm = res_claim_alarm("deadline", false);
+    if (alarm < 0) {
+        // Fail soft: no alarm left on this build, run unguarded.
+        LogWarn(("invoke deadline: no hardware alarm free, guard off (core %u)", core));
+        return;
+    }
+    hardware_alarm_set_callback((uint)alarm, deadline_alarm_cb);
+    s_budget_ms[core] = budget_ms;
+    s_alarm[core] = alarm;
+}
+
+void invoke_deadline_arm(void) {
+    uint core = get_core_num();
+    if (s_alarm[core] < 0) return;
+    s_fired[core] = false;
+    hardware_alarm_set_target((uint)s_alarm[core],
+                              make_timeout_time_ms(s_budget_ms[core]));
+}
+
+bool invoke_deadline_disarm(void) {
+    uint core = get_core_num();
+    if (s_alarm[core] < 0) return false;
+    hardware_alarm_cancel((uint)s_alarm[core]);
+    return s_fired[core];
+}
@@ -0,0 +1,48 @@
+/**
+ * @file invoke_deadline.h
+ *
+ * @brief Hardware-alarm deadline guard around interpreter Invoke()
+ *
+ * Invoke() is unbounded: a pathological model upload or a corrupted
+ * tensor can spin the interpreter far past its normal few-millisecond
+ * cost, and until now the only backstop was the staged watchdog - a
+ * whole-system reset. The guard arms a one-shot hardware alarm before
+ * each Invoke: if the budget expires mid-run the alarm IRQ counts the
+ * overrun immediately (so the periodic summary shows it while the
+ * interpreter is still spinning), and the caller sees the overrun on
+ * disarm and discards the late result in favour of the previous
+ * cycle's levels. The alarm cannot unwind an Invoke that never
+ * returns - a hard hang still belongs to the watchdog, which pinpoints
+ * the stage - but everything short of that now degrades to held levels
+ * instead of a reset.
+ *
+ * One alarm per core: core 0 guards the fan/combo interpreters, core 1
+ * the pump batch. Each core calls init once; with no alarm free the
+ * guard fails soft and Invoke runs unguarded.
+ */
+
+#ifndef INVOKE_DEADLINE_H
+#define INVOKE_DEADLINE_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Claim a hardware alarm for the calling core's guard.
+ *
+ * @param budget_ms Deadline applied to every subsequent arm on this core.
+ */
+void invoke_deadline_init(uint32_t budget_ms);
+
+/**
+ * @brief Start the deadline for one Invoke on the calling core.
+ */
+void invoke_deadline_arm(void);
+
+/**
+ * @brief Stop the deadline after the Invoke returned.
+ *
+ * @return true if the budget expired while the Invoke was running.
+ */
+bool invoke_deadline_disarm(void);
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file irq_latency.cpp
+ *
+ * @brief Interrupt-latency harness implementation
+ *
+ * Targets are scheduled on an absolute grid (previous target + period,
+ * not "now + period") so the probe rate is drift-free and a late
+ * service cannot hide itself by pushing the next deadline out. A
+ * service so late that the next grid slot already passed skips ahead -
+ * the missed slots were measured by the delta that caused them.
+ */
+
+#include "irq_latency.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/timer.h"
+
+#include "resource_map.h"
+
+#if QDNN_IRQ_MAP
+#include "irq_map.h"
+#endif
+
+// Prime period: never phase-locks to the 1 kHz tick or USB SOF.
+#define IRQ_LAT_PERIOD_US 997
+#define IRQ_LAT_BINS      16
+
+static int s_alarm = -1;
+static volatile bool s_running;
+static volatile bool s_done;
+static uint64_t s_target_us;
+static uint64_t s_end_us;
+static uint32_t s_seconds;
+
+static uint32_t s_bins[IRQ_LAT_BINS];
+static uint32_t s_count;
+static uint32_t s_max_us;
+static uint64_t s_total_us;
+
+static void probe_alarm_cb(uint alarm_num) {
+    uint64_t now = time_us_64();
+    uint32_t lat = (uint32_t)(now - s_target_us);
+
+    // Same binning as cycle_timing: bin k covers [2^(k-1), 2^k) us
+    int bin = (lat == 0) ? 0 : 32 - __builtin_clz(lat);
+    if (bin >= IRQ_LAT_BINS) bin = IRQ_LAT_BINS - 1;
+    s_bins[bin]++;
+    s_count++;
+    s_total_us += lat;
+    if (lat > s_max_us) s_max_us = lat;
+
+    if (now >= s_end_us) {
+        s_running = false;
+        s_done = true;  // drain task prints and releases the alarm
+        return;
+    }
+    s_target_us += IRQ_LAT_PERIOD_US;
+    if (s_target_us <= now) s_target_us = now + IRQ_LAT_PERIOD_US;
+    hardware_alarm_set_target(alarm_num, from_us_since_boot(s_target_us));
+}
+
+int irq_latency_start(uint32_t seconds) {
+    if (s_running || s_done) return -1;
+    s_alarm = res_claim_alarm("irqtest", false);
+    if (s_alarm < 0) return -1;
+
+    memset(s_bins, 0, sizeof(s_bins));
+    s_count = 0;
+    s_max_us = 0;
+    s_total_us = 0;
+    s_seconds = seconds;
+
+    uint64_t now = time_us_64();
+    s_end_us = now + (uint64_t)seconds * 1000000u;
+    s_target_us = now + IRQ_LAT_PERIOD_US;
+    s_running = true;
+    hardware_alarm_set_callback((uint)s_alarm, probe_alarm_cb);
+    hardware_alarm_set_target((uint)s_alarm, from_us_since_boot(s_target_us));
+    return 0;
+}
+
+bool irq_latency_finished(void) {
+    return s_done;
+}
+
+void irq_latency_print(void) {
+    if (!s_done) return;
+    printf("irqtest: %u probes over %u s, max=%uus mean=%uus bins:",
+           (unsigned)s_count, (unsigned)s_seconds, (unsigned)s_max_us,
+           (unsigned)(s_count ? s_total_us / s_count : 0));
+    for (int b = 0; b < IRQ_LAT_BINS; b++)
+        printf(" %u", (unsigned)s_bins[b]);
+    printf("\n");
+#if QDNN_IRQ_MAP
+    // Close the loop on the steering map's stated number: this run's
+    // worst case is the control core's measured preemption reality.
+    irq_map_check_budget(s_max_us);
+#endif
+
+    hardware_alarm_set_callback((uint)s_alarm, NULL);
+    res_release_alarm(s_alarm);
+    s_alarm = -1;
+    s_done = false;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file irq_latency.h
+ *
+ * @brief On-demand interrupt-latency measurement harness
+ *
+ * The PIO capture and the free-running ADC sampler moved the tightest
+ * decode timing into hardware, but several paths still assume bounded
+ * IRQ service latency - the invoke deadline alarm, UART DMA
+ * completion, the pacer-driven PWM ramps - and FreeRTOS critical
+ * sections plus the USB stack mask interrupts for stretches nobody
+ * had measured on this firmware. The harness claims a spare hardware
+ * alarm and fires a probe IRQ on a drift-free 997 us grid (prime, so
+ * it cannot phase-lock to the 1 kHz tick); each service records the
+ * scheduled-vs-actual delta into a log2 histogram (same binning as
+ * cycle_timing) while the real workload keeps running. A worst-case
+ * bin above a decoder's pulse-discrimination margin disqualifies that
+ * decoder from running under an IRQ on this build.
+ *
+ * Driven from the shell ("irqtest [seconds]"), so it measures core 0,
+ * the core carrying FreeRTOS, USB and the deadline alarm. The alarm
+ * is claimed for the run only and released with the report.
+ */
+
+#ifndef IRQ_LATENCY_H
+#define IRQ_LATENCY_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Start a probe run alongside the live workload.
+ *
+ * @param seconds Measurement window.
+ * @return 0 started, -1 when already running or no alarm is free.
+ */
+int irq_latency_start(uint32_t seconds);
+
+/**
+ * @brief True once when a finished run awaits printing.
+ */
+bool irq_latency_finished(void);
+
+/**
+ * @brief Print the histogram and release the alarm. Shell task only.
+ */
+void irq_latency_print(void);
+
+#endif
@@ -0,0 +1,131 @@
+/**
+ * @file irq_map.cpp
+ *
+ * @brief Interrupt steering map implementation
+ */
+
+#include "irq_map.h"
+
+#include <stdio.h>
+
+#include "hardware/irq.h"
+#include "hardware/regs/intctrl.h"
+
+#include "app_log.h"
+
+struct IrqRoute {
+    const char* name;
+    uint8_t irq;
+    uint8_t core;      // intended service core, or IRQ_MAP_CORE_ANY
+    uint8_t priority;  // NVIC priority (lower value preempts)
+};
+
+// The whole interrupt story of this firmware, in priority order. The
+// unused vectors are deliberately absent: the report flags anything
+// enabled that is not listed here, so additions must come through
+// this table.
+static const IrqRoute s_map[] = {
+    // Deadline guard + latency probe alarms; claimed per core by
+    // hardware_alarm_claim_unused(), so any of the four can be the
+    // one a core ends up with - all ride at the top.
+    {"tmr0", TIMER_IRQ_0, IRQ_MAP_CORE_ANY, 0x40},
+    {"tmr1", TIMER_IRQ_1, IRQ_MAP_CORE_ANY, 0x40},
+    {"tmr2", TIMER_IRQ_2, IRQ_MAP_CORE_ANY, 0x40},
+    {"tmr3", TIMER_IRQ_3, IRQ_MAP_CORE_ANY, 0x40},
+    // ADC sweep completion (soil_adc shared handler)
+    {"adcd", DMA_IRQ_0, 0, 0x80},
+#if QDNN_BUS_SYNC
+    // Beacon RX on the chained-unit bus (slave units enable it)
+    {"busr", UART1_IRQ, 0, 0x80},
+#endif
+    // USB CDC housekeeping (SDK stdio stack)
+    {"usb ", USBCTRL_IRQ, 0, 0xC0},
+#if QDNN_TOUCH_BTN
+    // Diagnostics button verdicts - either PIO block, whichever had a
+    // free state machine at claim time; a thumb is never urgent.
+    {"tch0", PIO0_IRQ_0, 0, 0xC0},
+    {"tch1", PIO1_IRQ_0, 0, 0xC0},
+#endif
+};
+
+#define IRQ_MAP_ENTRIES (int)(sizeof(s_map) / sizeof(s_map[0]))
+
+// Core 1 state snapshot, published by its apply call: per-entry
+// enabled flag + priority, plus the full enable mask for the
+// unmapped-IRQ sweep. Written once before core 1's READY handshake,
+// read by the shell task afterwards - no racing writes to order.
+static volatile uint32_t s_core1_enable_mask;
+static volatile uint8_t s_core1_prio[IRQ_MAP_ENTRIES];
+static volatile bool s_core1_seen;
+
+void irq_map_apply(void) {
+    uint core = get_core_num();
+    for (int i = 0; i < IRQ_MAP_ENTRIES; i++)
+        irq_set_priority(s_map[i].irq, s_map[i].priority);
+    if (core == 1) {
+        uint32_t mask = 0;
+        for (uint irq = 0; irq < NUM_IRQS; irq++)
+            if (irq_is_enabled(irq)) mask |= 1u << irq;
+        for (int i = 0; i < IRQ_MAP_ENTRIES; i++)
+            s_core1_prio[i] = (uint8_t)irq_get_priority(s_map[i].irq);
+        s_core1_enable_mask = mask;
+        s_core1_seen = true;
+    }
+}
+
+static int map_index(uint irq) {
+    for (int i = 0; i < IRQ_MAP_ENTRIES; i++)
+        if (s_map[i].irq == irq) return i;
+    return -1;
+}
+
+static void report_core(int core, uint32_t enable_mask,
+                        const uint8_t* prio_by_entry) {
+    for (uint irq = 0; irq < NUM_IRQS; irq++) {
+        bool enabled = (enable_mask >> irq) & 1;
+        int i = map_index(irq);
+        if (i < 0) {
+            if (enabled)
+                printf("  ! irq%-2u enabled but unmapped\n", irq);
+            continue;
+        }
+        if (!enabled) continue;
+        uint8_t prio = prio_by_entry[i];
+        bool core_ok = s_map[i].core == IRQ_MAP_CORE_ANY ||
+                       s_map[i].core == core;
+        bool prio_ok = prio == s_map[i].priority;
+        printf("  %s%s irq%-2u prio %02x", core_ok && prio_ok ? "" : "! ",
+               s_map[i].name, irq, prio);
+        if (!prio_ok) printf(" (map says %02x)", s_map[i].priority);
+        if (!core_ok) printf(" (mapped to core %u)", s_map[i].core);
+        printf("\n");
+    }
+}
+
+void irq_map_report(void) {
+    uint8_t prio[IRQ_MAP_ENTRIES];
+    uint32_t mask = 0;
+    for (uint irq = 0; irq < NUM_IRQS; irq++)
+        if (irq_is_enabled(irq)) mask |= 1u << irq;
+    for (int i = 0; i < IRQ_MAP_ENTRIES; i++)
+        prio[i] = (uint8_t)irq_get_priority(s_map[i].irq);
+    printf("core 0 (live):\n");
+    report_core(0, mask, prio);
+    if (s_core1_seen) {
+        uint8_t p1[IRQ_MAP_ENTRIES];
+        for (int i = 0; i < IRQ_MAP_ENTRIES; i++) p1[i] = s_core1_prio[i];
+        printf("core 1 (at init):\n");
+        report_core(1, s_core1_enable_mask, p1);
+    }
+    printf("core 0 budget: %u us worst-case service ('irqtest' verifies)\n",
+           (unsigned)QDNN_IRQ_BUDGET_US);
+}
+
+void irq_map_check_budget(uint32_t max_us) {
+    if (max_us > QDNN_IRQ_BUDGET_US)
+        LogWarn(("irq budget EXCEEDED: %u us measured, %u us configured",
+                 (unsigned)max_us, (unsigned)QDNN_IRQ_BUDGET_US));
+    else
+        printf("irq budget: %u us measured <= %u us configured\n",
+               (unsigned)max_us, (unsigned)QDNN_IRQ_BUDGET_US);
+}
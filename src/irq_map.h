@@ -0,0 +1,75 @@
+/**
+ * @file irq_map.h
+ *
+ * @brief Declarative per-core interrupt steering and priority map
+ *
+ * Every interrupt in this firmware lands on whichever core happened to
+ * call the enabling SDK function - which is core 0 for all of them
+ * except the core 1 deadline alarm, and core 0 is where the control
+ * pipeline lives. The routing was an accident of init order; this
+ * module makes it a table. Each entry names the IRQ, the core that is
+ * supposed to service it, and its NVIC priority; irq_map_apply() runs
+ * once per core during that core's init and programs the priorities,
+ * so preemption ordering under the control path is configured in one
+ * audited place:
+ *
+ *   - TIMER alarms highest: the invoke-deadline guard must cut a hung
+ *     Invoke even mid-USB-burst, and the latency probe must measure
+ *     the stack, not be deferred by it.
+ *   - DMA completion (ADC sweep) in the middle: it feeds control but
+ *     the 4-deep FIFO leaves milliseconds of slack.
+ *   - USB housekeeping lowest: CDC can always wait a few microseconds.
+ *
+ * Verified, not assumed, two ways. The shell's "irqs" report diffs
+ * each core's live NVIC state against this table and flags any enabled
+ * interrupt the map does not account for - new code that quietly
+ * parks an IRQ on the control core shows up as a '!' line. And the
+ * irq_latency harness compares its measured worst-case service delay
+ * on core 0 against QDNN_IRQ_BUDGET_US, so the control core's
+ * worst-case preemption is a number the build states and a shell
+ * command checks.
+ *
+ * Core 1 has no FreeRTOS and its NVIC is not addressable from core 0,
+ * so its apply call also publishes a snapshot of the mapped IRQs'
+ * enable/priority state for the report; core 0 is read live.
+ */
+
+#ifndef IRQ_MAP_H
+#define IRQ_MAP_H
+
+#include "pico/stdlib.h"
+
+// Worst-case probe-to-service latency the control core is allowed
+// (irq_latency measures against this; see "irqtest" in the shell).
+#ifndef QDNN_IRQ_BUDGET_US
+#define QDNN_IRQ_BUDGET_US 200
+#endif
+
+// Entry core field: serviced by whichever core claims it (the
+// hardware alarms are claimed per-core by invoke_deadline).
+#define IRQ_MAP_CORE_ANY 0xFF
+
+/**
+ * @brief Program the map's NVIC priorities on the calling core.
+ *
+ * Call once per core during its init, after the core's own IRQ users
+ * have claimed their vectors (priorities persist over later enables
+ * either way). On core 1 this also publishes the state snapshot the
+ * report prints.
+ */
+void irq_map_apply(void);
+
+/**
+ * @brief Print the table and the live-vs-intended diff. Shell task.
+ */
+void irq_map_report(void);
+
+/**
+ * @brief Check a measured worst-case latency against the budget.
+ *
+ * Called by irq_latency with its run's maximum; prints the verdict
+ * line so "irqtest" closes the loop on the configured number.
+ */
+void irq_map_check_budget(uint32_t max_us);
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file lock_stats.cpp
+ *
+ * @brief Mutex contention counter implementation
+ *
+ * Contention is detected with a zero-timeout take first: the fast
+ * path (lock free, by far the common case) costs one extra comparison
+ * and no timestamp read. Only the slow path pays for two time_us_32()
+ * reads to measure the wait.
+ */
+
+#include "lock_stats.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+static SemaphoreHandle_t s_sem[LOCK_COUNT];
+static StaticSemaphore_t s_sem_buf[LOCK_COUNT];
+static LockStatsSnap s_slot[LOCK_COUNT];
+static uint32_t s_take_us[LOCK_COUNT];
+
+// Bumped from the kernel's trace hooks, inside a critical section
+static volatile uint32_t s_inherits;
+
+static const char* const s_name[LOCK_COUNT] = {
+    "cal",
+};
+
+void lock_stats_init(void) {
+    for (int i = 0; i < LOCK_COUNT; i++)
+        s_sem[i] = xSemaphoreCreateMutexStatic(&s_sem_buf[i]);
+}
+
+void lock_take(int slot) {
+    if (slot < 0 || slot >= LOCK_COUNT) return;
+    if (xSemaphoreTake(s_sem[slot], 0) != pdTRUE) {
+        LockStatsSnap* s = &s_slot[slot];
+        s->contended++;
+        uint32_t t0 = time_us_32();
+        xSemaphoreTake(s_sem[slot], portMAX_DELAY);
+        uint32_t wait = time_us_32() - t0;
+        if (wait > s->max_wait_us) s->max_wait_us = wait;
+    }
+    s_slot[slot].acquisitions++;
+    s_take_us[slot] = time_us_32();
+}
+
+void lock_give(int slot) {
+    if (slot < 0 || slot >= LOCK_COUNT) return;
+    uint32_t held = time_us_32() - s_take_us[slot];
+    if (held > s_slot[slot].max_hold_us) s_slot[slot].max_hold_us = held;
+    xSemaphoreGive(s_sem[slot]);
+}
+
+void lock_stats_collect(int slot, LockStatsSnap* out) {
+    if (slot < 0 || slot >= LOCK_COUNT) {
+        *out = LockStatsSnap{};
+        return;
+    }
+    *out = s_slot[slot];
+}
+
+const char* lock_stats_name(int slot) {
+    if (slot < 0 || slot >= LOCK_COUNT) return "?";
+    return s_name[slot];
+}
+
+uint32_t lock_stats_inherits(void) {
+    return s_inherits;
+}
+
+// Trace hook targets (FreeRTOSConfig.h): the kernel boosting a mutex
+// holder past a blocked higher-priority taker, and the matching drop.
+// Only the boost is counted - each one is an inversion that happened.
+extern "C" void vLockStatsPriorityInherit(void) {
+    s_inherits++;
+}
+
+extern "C" void vLockStatsPriorityDisinherit(void) {
+}
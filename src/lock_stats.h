@@ -0,0 +1,80 @@
+/**
+ * @file lock_stats.h
+ *
+ * @brief Contention and hold-time counters for shared-state mutexes
+ *
+ * configUSE_MUTEXES has been on since day one but every cross-task
+ * structure so far got by on queues, word-sized writes or spinlocks.
+ * The pipeline is now growing state that genuinely needs a mutex (the
+ * calibration cache is the first: two endpoints updated together must
+ * never be read torn mid-zone-loop), and an uninstrumented lock is a
+ * cycle-time drift we would have to bisect firmware to find. Every
+ * mutex therefore goes through this wrapper: per-lock acquisition and
+ * contention counts, worst-case wait and hold times, plus a global
+ * count of the kernel's priority-inheritance engagements (each one is
+ * a priority inversion that actually happened, wired up via the trace
+ * macros in FreeRTOSConfig.h). All of it surfaces in "stats" and in
+ * the periodic lock telemetry frame.
+ *
+ * Counters are written only by the task that holds (or is acquiring)
+ * the lock, so the bookkeeping itself needs no further locking.
+ */
+
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Tracked mutexes, one slot each.
+ */
+enum LockSlot {
+    LOCK_CALIB = 0,  ///< calibration RAM cache (shell writer / sensor reader)
+    LOCK_COUNT
+};
+
+/**
+ * @brief One lock's counters, as collected for a report.
+ */
+struct LockStatsSnap {
+    uint32_t acquisitions;  ///< successful takes since boot
+    uint32_t contended;     ///< takes that found the lock already held
+    uint32_t max_wait_us;   ///< longest time a taker sat blocked
+    uint32_t max_hold_us;   ///< longest take-to-give interval
+};
+
+/**
+ * @brief Create the tracked mutexes.
+ *
+ * Call once in main() before anything takes a lock (calib_init() is
+ * the earliest user) and before the scheduler starts.
+ */
+void lock_stats_init(void);
+
+/**
+ * @brief Acquire a tracked lock (blocking).
+ */
+void lock_take(int slot);
+
+/**
+ * @brief Release a tracked lock.
+ */
+void lock_give(int slot);
+
+/**
+ * @brief Copy one lock's counters out for a report.
+ */
+void lock_stats_collect(int slot, LockStatsSnap* out);
+
+/**
+ * @brief Short lock name for the shell / telemetry tags.
+ */
+const char* lock_stats_name(int slot);
+
+/**
+ * @brief Priority-inheritance engagements since boot (all mutexes,
+ *        the SDK/libc interop ones included).
+ */
+uint32_t lock_stats_inherits(void);
+
+#endif
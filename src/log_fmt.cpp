@@ -0,0 +1,152 @@
+/**
+ * @file log_fmt.cpp
+ *
+ * @brief Deferred debug-text rendering implementation
+ *
+ * Ring records are {id, n, int32 args[n]}; head/tail are byte indexes
+ * into a power-of-two buffer. The drain side renders straight to
+ * stdout - the drain task is the stdio writer in every topology, and
+ * routing rendered text through log_ring would add a second producer
+ * to a ring that is correct only because it has one.
+ */
+
+#include "log_fmt.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "div_hw.h"
+
+#define LOG_FMT_RING 512  // power of two
+#define LOG_FMT_MAX_ARGS 16
+
+static uint8_t s_ring[LOG_FMT_RING];
+static volatile uint32_t s_head;  // producer-owned
+static volatile uint32_t s_tail;  // drain-owned
+static uint32_t s_dropped;
+
+static void put_bytes(uint32_t at, const void* src, size_t len) {
+    const uint8_t* p = (const uint8_t*)src;
+    for (size_t i = 0; i < len; i++)
+        s_ring[(at + i) & (LOG_FMT_RING - 1)] = p[i];
+}
+
+void log_fmt_emit(uint8_t id, const int32_t* args, uint8_t n) {
+    if (n > LOG_FMT_MAX_ARGS) n = LOG_FMT_MAX_ARGS;
+    uint32_t need = 2 + 4u * n;
+    // Two producer tasks share the head; the copy is a few words, so
+    // a critical section is cheaper than any cleverness.
+    taskENTER_CRITICAL();
+    if (LOG_FMT_RING - (s_head - s_tail) < need) {
+        s_dropped++;
+        taskEXIT_CRITICAL();
+        return;
+    }
+    uint32_t at = s_head;
+    put_bytes(at, &id, 1);
+    put_bytes(at + 1, &n, 1);
+    put_bytes(at + 2, args, 4u * n);
+    __dmb();  // record lands before the head moves
+    s_head = at + need;
+    taskEXIT_CRITICAL();
+}
+
+uint32_t log_fmt_dropped(void) {
+    return s_dropped;
+}
+
+// All rendering - the format strings and the deci/milli fixed-point
+// scales - lives in this one switch. The whole/fraction splits run
+// through one divider launch each (divmod) instead of a / and a %
+// AEABI call per fixed-point value.
+static int32_t q10(int32_t v, int32_t* frac) {
+    int32_t q;
+    divmod_s32(v, 10, &q, frac);
+    return q;
+}
+
+static void render(uint8_t id, const int32_t* a, uint8_t n) {
+    char line[160];
+    int len = 0;
+    int32_t fa, fb, fc;
+    switch (id) {
+        case LOG_FMT_RULE:
+            len = snprintf(line, sizeof(line),
+                           "-----------------------------------\n");
+            break;
+        case LOG_FMT_AIR:
+            if (n < 2) return;
+            len = snprintf(line, sizeof(line),
+                           "Temp: %ld.%ld°C | Humid: %ld.%ld%%\n",
+                           (long)q10(a[0], &fa), (long)fa,
+                           (long)q10(a[1], &fb), (long)fb);
+            break;
+        case LOG_FMT_FAN:
+            if (n < 2) return;
+            len = snprintf(line, sizeof(line), "Fan Level: %ld (model %ld)\n",
+                           (long)a[0], (long)a[1]);
+            break;
+        case LOG_FMT_ZONE:
+            if (n < 5) return;
+            len = snprintf(line, sizeof(line),
+                           "Zone %ld: Soil %ld.%ld%% (raw=%ld) | Pump Level: "
+                           "%ld (model %ld)\n",
+                           (long)a[0], (long)q10(a[1], &fa), (long)fa,
+                           (long)a[2], (long)a[3], (long)a[4]);
+            break;
+        case LOG_FMT_VERBOSE:
+            if (n < 6) return;
+            len = snprintf(line, sizeof(line),
+                           "T=%ld.%ld H=%ld.%ld S=%ld.%ld raw=%ld fan=%ld "
+                           "pump=%ld\n",
+                           (long)q10(a[0], &fa), (long)fa,
+                           (long)q10(a[1], &fb), (long)fb,
+                           (long)q10(a[2], &fc), (long)fc,
+                           (long)a[3], (long)a[4], (long)a[5]);
+            break;
+        case LOG_FMT_SCORES:
+            len = snprintf(line, sizeof(line), "Scores:");
+            for (uint8_t i = 0; i < n && len < (int)sizeof(line) - 12; i++) {
+                int32_t q;
+                divmod_s32(a[i], 1000, &q, &fa);
+                len += snprintf(line + len, sizeof(line) - len, " %ld.%03ld",
+                                (long)q, (long)(fa < 0 ? -fa : fa));
+            }
+            if (len < (int)sizeof(line) - 1) line[len++] = '\n';
+            break;
+        default:
+            return;  // unknown ID: skip (record length already parsed)
+    }
+    if (len > 0) fwrite(line, 1, (size_t)len, stdout);
+}
+
+void log_fmt_drain(void) {
+    log_fmt_drain_some(-1);
+}
+
+int log_fmt_drain_some(int max_records) {
+    bool wrote = false;
+    int rendered = 0;
+    while (s_head != s_tail && (max_records < 0 || rendered < max_records)) {
+        uint32_t at = s_tail;
+        uint8_t id = s_ring[at & (LOG_FMT_RING - 1)];
+        uint8_t n = s_ring[(at + 1) & (LOG_FMT_RING - 1)];
+        int32_t args[LOG_FMT_MAX_ARGS];
+        if (n > LOG_FMT_MAX_ARGS) n = LOG_FMT_MAX_ARGS;
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t* d = (uint8_t*)&args[i];
+            for (int b = 0; b < 4; b++)
+                d[b] = s_ring[(at + 2 + 4u * i + b) & (LOG_FMT_RING - 1)];
+        }
+        render(id, args, n);
+        __dmb();  // reads done before the slot is released
+        s_tail = at + 2 + 4u * n;
+        wrote = true;
+        rendered++;
+    }
+    if (wrote) fflush(stdout);
+    return rendered;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file log_fmt.h
+ *
+ * @brief Deferred debug-text rendering: format IDs now, strings later
+ *
+ * The human-readable debug report and the score dump still ran
+ * printf-family formatting inside the control tasks - "%d.%d" is
+ * cheap, but the call itself walks the format string, and the float
+ * score rendering drags in soft-float formatting, so a LOG_DEBUG
+ * build's hot path pays an order of magnitude over release for text
+ * nobody reads at microsecond resolution. This module splits the work:
+ * the hot path deposits a record - one format ID plus the raw integer
+ * (fixed-point) arguments, a few word stores - into a small ring, and
+ * the low-priority stdio drain task renders the string on its own
+ * time. A full ring drops the record whole and counts it, mirroring
+ * log_ring's policy: debug text must never block control.
+ *
+ * Records come from two core 0 tasks (inference: scores, report: the
+ * cycle text), so unlike the strictly single-producer log_ring the
+ * deposit takes a critical section for its few-word copy.
+ */
+
+#ifndef LOG_FMT_H
+#define LOG_FMT_H
+
+#include "pico/stdlib.h"
+
+// One ID per debug line shape; the renderer in log_fmt.cpp is the
+// single place that knows the text and the fixed-point scales.
+enum LogFmtId : uint8_t {
+    LOG_FMT_RULE,     // separator line; no args
+    LOG_FMT_AIR,      // temp deci-C, humid deci-%
+    LOG_FMT_FAN,      // applied level, model level
+    LOG_FMT_ZONE,     // zone, soil deci-%, raw ADC, applied, model
+    LOG_FMT_VERBOSE,  // temp10, humid10, soil10, raw, fan, pump
+    LOG_FMT_SCORES,   // class scores, milli-units
+};
+
+/**
+ * @brief Deposit one record; non-blocking, drops whole when full.
+ */
+void log_fmt_emit(uint8_t id, const int32_t* args, uint8_t n);
+
+/**
+ * @brief Render every pending record to stdio. Drain task only.
+ */
+void log_fmt_drain(void);
+
+/**
+ * @brief Render at most max_records pending records (-1 = all); the
+ *        shaped drain uses this to keep debug floods from starving
+ *        the telemetry budget. Returns records rendered.
+ */
+int log_fmt_drain_some(int max_records);
+
+/**
+ * @brief Records dropped because the ring was full.
+ */
+uint32_t log_fmt_dropped(void);
+
+#endif
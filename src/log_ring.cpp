@@ -0,0 +1,85 @@
+/**
+ * @file log_ring.cpp
+ *
+ * @brief Deferred output ring implementation
+ *
+ * Classic SPSC ring: the producer only advances head, the consumer only
+ * advances tail, both indices are free-running and masked on use, so no
+ * lock is needed between the report task and the drain task.
+ */
+
+#include "log_ring.h"
+
+static uint8_t s_buf[LOG_RING_SIZE];
+static volatile uint32_t s_head = 0;  // producer index
+static volatile uint32_t s_tail = 0;  // consumer index
+static volatile uint32_t s_dropped = 0;
+
+#define RING_MASK (LOG_RING_SIZE - 1)
+
+size_t log_ring_write(const uint8_t* data, size_t len) {
+    uint32_t head = s_head;
+    uint32_t used = head - s_tail;
+    if (len > LOG_RING_SIZE - used) {
+        s_dropped = s_dropped + 1;
+        return 0;  // drop whole, keep frame boundaries intact
+    }
+    for (size_t i = 0; i < len; i++)
+        s_buf[(head + i) & RING_MASK] = data[i];
+    __dmb();  // bytes land before the head moves
+    s_head = head + len;
+    return len;
+}
+
+size_t log_ring_read(uint8_t* out, size_t maxlen) {
+    uint32_t tail = s_tail;
+    uint32_t avail = s_head - tail;
+    if (avail == 0) return 0;
+    if (avail > maxlen) avail = maxlen;
+    for (size_t i = 0; i < avail; i++)
+        out[i] = s_buf[(tail + i) & RING_MASK];
+    __dmb();
+    s_tail = tail + avail;
+    return avail;
+}
+
+size_t log_ring_used(void) {
+    return s_head - s_tail;
+}
+
+uint32_t log_ring_dropped(void) {
+    return s_dropped;
+}
+
+const volatile uint32_t* log_ring_dropped_ref(void) {
+    return &s_dropped;
+}
+
+uint8_t* log_ring_reserve(size_t maxlen) {
+    uint32_t head = s_head;
+    if (maxlen > LOG_RING_SIZE - (head - s_tail)) return NULL;  // full
+    uint32_t off = head & RING_MASK;
+    if (off + maxlen > LOG_RING_SIZE) return NULL;  // would wrap: copy path
+    return &s_buf[off];
+}
+
+void log_ring_commit(size_t len) {
+    __dmb();  // in-place fields land before the head moves
+    s_head = s_head + len;
+}
+
+size_t log_ring_peek(const uint8_t** span) {
+    uint32_t tail = s_tail;
+    uint32_t avail = s_head - tail;
+    if (avail == 0) return 0;
+    uint32_t off = tail & RING_MASK;
+    uint32_t contig = LOG_RING_SIZE - off;
+    if (avail > contig) avail = contig;
+    *span = &s_buf[off];
+    return avail;
+}
+
+void log_ring_consume(size_t len) {
+    __dmb();
+    s_tail = s_tail + len;
+}
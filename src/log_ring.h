@@ -0,0 +1,96 @@
+/**
+ * @file log_ring.h
+ *
+ * @brief Non-blocking deferred output ring between the control loop and stdio
+ *
+ * stdio writes (USB CDC in particular) can stall for milliseconds. The
+ * control-side tasks now push bytes into this single-producer /
+ * single-consumer ring and return immediately; a low-priority drain
+ * task moves the bytes to stdio when nothing more important is running.
+ * When the ring is full a write is dropped whole (frames stay intact)
+ * and counted, never blocked on.
+ *
+ * Two access styles share the ring. The copy API (write/read) takes
+ * caller buffers. The zero-copy API builds frames in place: the
+ * producer reserves a contiguous max-size slot, writes fields directly
+ * into ring storage and commits the actual length; the drain side
+ * peeks the committed contiguous span and hands it straight to the
+ * UART DMA channel, consuming only after the transfer retires. A
+ * reservation that would straddle the wrap point returns NULL and the
+ * caller falls back to the copy path - one copied frame per ~2 KiB of
+ * traffic instead of a padding protocol on the wire.
+ */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Ring capacity in bytes (power of two).
+ */
+const size_t LOG_RING_SIZE = 2048;
+
+/**
+ * @brief Push bytes into the ring without blocking.
+ *
+ * @return len on success, 0 if the ring had no room (write dropped whole).
+ */
+size_t log_ring_write(const uint8_t* data, size_t len);
+
+/**
+ * @brief Pop up to maxlen bytes from the ring (drain side).
+ *
+ * @return Number of bytes copied out, 0 when the ring is empty.
+ */
+size_t log_ring_read(uint8_t* out, size_t maxlen);
+
+/**
+ * @brief Bytes currently buffered (committed, not yet read).
+ */
+size_t log_ring_used(void);
+
+/**
+ * @brief Number of writes dropped because the ring was full.
+ */
+uint32_t log_ring_dropped(void);
+
+/**
+ * @brief Address of the dropped-write counter (metrics registration).
+ */
+const volatile uint32_t* log_ring_dropped_ref(void);
+
+/**
+ * @brief Reserve a contiguous in-place slot of maxlen bytes.
+ *
+ * Returns a pointer into ring storage the producer writes directly, or
+ * NULL when the ring is too full or the slot would straddle the wrap
+ * point (fall back to log_ring_write in that case - it drops and
+ * counts if the ring is genuinely full). At most one reservation may
+ * be outstanding; commit before reserving again.
+ */
+uint8_t* log_ring_reserve(size_t maxlen);
+
+/**
+ * @brief Publish len bytes of the current reservation (len may be
+ *        shorter than reserved; the tail of the slot is simply reused).
+ */
+void log_ring_commit(size_t len);
+
+/**
+ * @brief Borrow the longest contiguous committed span (drain side).
+ *
+ * The bytes stay in the ring - valid until log_ring_consume() - so the
+ * span can be handed to a DMA channel without copying.
+ *
+ * @return Span length, 0 when the ring is empty.
+ */
+size_t log_ring_peek(const uint8_t** span);
+
+/**
+ * @brief Release len bytes returned by log_ring_peek() after the
+ *        transfer out of them has fully retired.
+ */
+void log_ring_consume(size_t len);
+
+#endif
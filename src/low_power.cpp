@@ -0,0 +1,26 @@
+/**
+ * @file low_power.cpp
+ *
+ * @brief Deep-sleep configuration implementation
+ */
+
+#include "low_power.h"
+
+#include "pico/stdlib.h"
+#include "hardware/structs/clocks.h"
+#include "hardware/structs/scb.h"
+
+void low_power_init(void) {
+    // While the cores sleep, gate every clock except the wakeup sources:
+    // the system timer (FreeRTOS tick / alarms) and UART0 for telemetry.
+    // sleep_en only applies in the sleep state - normal-run clocks are
+    // untouched, and everything resumes automatically on wake.
+    clocks_hw->sleep_en0 = 0;
+    clocks_hw->sleep_en1 = CLOCKS_SLEEP_EN1_CLK_SYS_TIMER_BITS
+                         | CLOCKS_SLEEP_EN1_CLK_SYS_UART0_BITS
+                         | CLOCKS_SLEEP_EN1_CLK_PERI_UART0_BITS;
+
+    // Make the tickless-idle WFI enter processor deep sleep rather than
+    // the ordinary sleep state.
+    scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+}
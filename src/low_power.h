@@ -0,0 +1,24 @@
+/**
+ * @file low_power.h
+ *
+ * @brief Deep-sleep configuration for battery deployments
+ *
+ * The FreeRTOS port already runs tickless idle (configUSE_TICKLESS_IDLE).
+ * This module makes those idle periods actually cheap: it programs the
+ * RP2040 sleep-state clock enables so that only the wakeup sources (the
+ * system timer and UART0 telemetry) stay clocked while the core waits,
+ * and arms SLEEPDEEP so the idle WFI enters processor deep sleep.
+ *
+ * Used by the QDNN_LOW_POWER build, which also drops USB CDC stdio -
+ * servicing USB would keep the core out of deep sleep entirely.
+ */
+
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+/**
+ * @brief Configure sleep-state clock gating and deep sleep. Call once at boot.
+ */
+void low_power_init(void);
+
+#endif
@@ -1,58 +1,361 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
+#include "pico/multicore.h"
+#if LIB_PICO_STDIO_USB
+#include "pico/stdio_usb.h"
+#endif
 #include "hardware/adc.h"
-#include "dht11-pico.h"
+#include "hardware/watchdog.h"
+#include "hardware/structs/vreg_and_chip_reset.h"
+#include "air_sensor.h"
+#if QDNN_SENSOR_EMUL
+#include "sensor_emul.h"
+#endif
+#include "board_profile.h"
+#include "gpio_guard.h"
+#include "soil_adc.h"
+#include "control_logic.h"
+#include "calib_store.h"
+#include "config_store.h"
+#include "telemetry.h"
+#include "heap_stats.h"
+#include "idle_meter.h"
+#include "task_stats.h"
+#include "watchdog_guard.h"
+#include "warm_state.h"
+#if QDNN_BOOT_LADDER
+#include "boot_ladder.h"
+#endif
+#include "crash_dump.h"
+#include "log_ring.h"
+#include "device_id.h"
+#include "err_stats.h"
+#include "invoke_deadline.h"
+#include "flash_maint.h"
+#include "boot_stages.h"
+#include "queue_stats.h"
+#include "lock_stats.h"
+#include "cmd_shell.h"
+#include "self_test.h"
+#if QDNN_USB_ON_DEMAND
+#include "usb_gate.h"
+#endif
+#include "cycle_timing.h"
+#if QDNN_MODEL_BANK
+#include "model_bank.h"
+#endif
+#if QDNN_MODEL_SHADOW
+#include "model_shadow.h"
+#endif
+#if QDNN_MODEL_PREFLIGHT
+#include "model_preflight.h"
+#endif
+#include "model_crc.h"
+#if QDNN_NET_UPLINK
+#include "net_uplink.h"
+#endif
+#if QDNN_UART_DMA_TELEMETRY
+#include "uart_dma_tx.h"
+#endif
+#include "perf_profile.h"
+#include "ram_code.h"
+#if QDNN_BUS_COUNTERS
+#include "bus_counters.h"
+#endif
+#include "app_log.h"
+#if QDNN_LOW_POWER
+#include "low_power.h"
+#endif
+#if QDNN_PWM_ACTUATION
+#include "pwm_actuate.h"
+#endif
+#if QDNN_PUMP_DUTY
+#include "pump_duty.h"
+#endif
+#if QDNN_INTERP_SCALE
+#include "interp_scale.h"
+#endif
+#include "div_hw.h"
+#if QDNN_DATALOG
+#include "datalog.h"
+#endif
+#if QDNN_BROWNOUT
+#include "brownout.h"
+#endif
+#if QDNN_WS2812_STATUS
+#include "ws2812_status.h"
+#endif
+#if QDNN_TOUCH_BTN
+#include "touch_btn.h"
+#endif
+#if QDNN_STATE_GUARD
+#include "state_guard.h"
+#endif
+#if QDNN_AB_SLOTS
+#include "fw_update.h"
+#endif
+#if QDNN_IRQ_MAP
+#include "irq_map.h"
+#endif
+#if QDNN_LAZY_FMT
+#include "log_fmt.h"
+#endif
+#if QDNN_SOIL_AC
+#include "soil_ac.h"
+#endif
+#if QDNN_SCRATCH_ARENA
+#include "scratch_arena.h"
+#endif
+#if QDNN_METRICS
+#include "metrics.h"
+#endif
+#if QDNN_WATCH_CHANNEL
+#include "watch_channel.h"
+#endif
+#if QDNN_BUS_SYNC
+#include "bus_sync.h"
+#endif
+
+// FreeRTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#if QDNN_SPSC_QUEUES
+#include "spsc_queue.h"
+#endif
 
 // TinyML
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/schema/schema_generated.h"
+// Generated at build time by tools/gen_op_resolver.py from the model
+// flatbuffers: exact-size resolver, registrations always in sync.
+#include "qdnn_op_resolver.h"
+#include "model_slot.h"
+#if QDNN_PROFILE_OPS
+#include "tensorflow/lite/micro/micro_profiler.h"
+#endif
+#if QDNN_ARENA_AUDIT
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#endif
+#ifdef USE_TFLM_COMPRESSION
+#include <string.h>
+#include "tensorflow/lite/micro/compression.h"
+#endif
+#if QDNN_COMBO_MODEL
+// Dual-head export from the training pipeline: one graph with a shared
+// trunk, output 0 = fan head, output 1 = pump head.
+#include "qdnn_combo_model.h"
+#else
 #include "qdnn_fan_model.h"
 #include "qdnn_pump_model.h"
+#endif
+#include "model_meta.h"
+#if QDNN_ANOMALY_MODEL
+#include "qdnn_anomaly_model.h"
+#endif
+// Generated at build time by tools/gen_model_desc.py: constexpr
+// input/output descriptors parsed from the same flatbuffers. The
+// static_asserts below turn a model export with a different shape or
+// dtype into a compile error naming the mismatch, instead of a runtime
+// surprise behind a tensor->type branch.
+#include "qdnn_model_desc.h"
+
+// Kontrak kode<->model. The quantize-once handoff and the int8 fast
+// paths assume int8 in/out; the input width is read from the model
+// (the base temp/humid/soil triple up to the metadata feature bound,
+// with rows past the triple filled by the feature builder below). The
+// 3-byte inference cache only engages on 3-feature models, and the fan
+// and pump heads must agree on the class count because they share the
+// LevelFilter/LED plumbing.
+#if QDNN_COMBO_MODEL
+static_assert(kQdnnComboModelDesc.input.type == kTfLiteInt8 &&
+              kQdnnComboModelDesc.output.type == kTfLiteInt8,
+              "combo model must be int8-quantized");
+static_assert(qdnn_desc_last_dim(kQdnnComboModelDesc.input) >= 3 &&
+              qdnn_desc_last_dim(kQdnnComboModelDesc.input) <= QDNN_META_MAX_FEATURES,
+              "combo input width outside the feature-builder range");
+#else
+static_assert(kQdnnFanModelDesc.input.type == kTfLiteInt8 &&
+              kQdnnFanModelDesc.output.type == kTfLiteInt8,
+              "fan model must be int8-quantized");
+static_assert(kQdnnPumpModelDesc.input.type == kTfLiteInt8 &&
+              kQdnnPumpModelDesc.output.type == kTfLiteInt8,
+              "pump model must be int8-quantized");
+static_assert(qdnn_desc_last_dim(kQdnnFanModelDesc.input) >= 3 &&
+              qdnn_desc_last_dim(kQdnnFanModelDesc.input) <= QDNN_META_MAX_FEATURES &&
+              qdnn_desc_last_dim(kQdnnPumpModelDesc.input) >= 3 &&
+              qdnn_desc_last_dim(kQdnnPumpModelDesc.input) <= QDNN_META_MAX_FEATURES,
+              "model input width outside the feature-builder range");
+static_assert(qdnn_desc_last_dim(kQdnnFanModelDesc.output) ==
+              qdnn_desc_last_dim(kQdnnPumpModelDesc.output),
+              "fan and pump must emit the same class count");
+#endif
 
 // --- Tensor arena ---
-constexpr int kArenaSize = 16 * 1024;
-static uint8_t fan_arena[kArenaSize];
-static uint8_t pump_arena[kArenaSize];
+// Single shared block, statically partitioned between the two
+// interpreters. Full TFLM multi-tenant sharing would also share the
+// non-persistent head, which is unsafe while the fan and pump invokes
+// overlap on both cores - so each model keeps a fixed slice instead.
+// 12 KB per model leaves comfortable headroom over the usage reported
+// by the QDNN_ARENA_AUDIT build.
+//
+// Placement under dual-core invoke: the arenas sit in main SRAM, which
+// the RP2040 word-stripes across banks 0-3 in hardware - two cores
+// streaming different arena slices therefore spread across all four
+// banks instead of serializing on one, which is exactly the behaviour
+// a manual per-bank split would try to buy (the non-striped SRAM0-3
+// aliases can't be carved out without a custom memory map, because the
+// striped region already covers every bank word-interleaved). The
+// per-core SRAM4/SRAM5 scratch banks hold each core's stack (SDK
+// default: core 0 in scratch_y, core 1 in scratch_x) plus the small
+// cross-core buffers below, so stack and handoff traffic never touches
+// the striped banks the arenas stream through. Validated with the
+// SRAM-contested bus counters (QDNN_BUS_COUNTERS / benchmark image).
+constexpr int kArenaSize = 12 * 1024;
+static uint8_t shared_arena[2 * kArenaSize] __attribute__((aligned(16)));
+static uint8_t* const fan_arena  = shared_arena;
+static uint8_t* const pump_arena = shared_arena + kArenaSize;
 
-// --- Pin definitions ---
-#define DHT_PIN        3
-#define SOIL_ADC_PIN   26
-const uint FAN_LEDS[4]  = {10, 11, 12, 13};
-const uint PUMP_LEDS[4] = {14, 15, 16, 17};
-#define LED_DHT_ERROR 18
+#if QDNN_ANOMALY_MODEL
+// The anomaly slot was asked to share the resident models'
+// non-persistent region, but the vendored allocator plans persistent
+// state into the same block per interpreter - a third tenant would
+// clobber the fan plan. Same fixed-slice rationale as above instead.
+constexpr int kAnomalyArenaSize = 8 * 1024;
+static uint8_t anomaly_arena[kAnomalyArenaSize] __attribute__((aligned(16)));
+#endif
 
-// --- Soil moisture calibration ---
-#define SOIL_DRY_RAW 4000
-#define SOIL_WET_RAW 1000
+// --- Pin definitions: dari profil board terpilih (board_profile.h) ---
+// The selected revision's map, all folded at compile time. The names
+// below keep their historical spelling so the rest of the file reads
+// the same as when the pins were loose #defines.
+#define DHT_PIN        (kBoard.dht_pin)
+#define LED_DHT_ERROR  (kBoard.led_dht_error)
 
-// --- Fungsi ADC averaging ---
-uint16_t read_soil_adc() {
-    const int samples = 64;
-    uint32_t sum = 0;
-    for (int i=0; i<samples; i++) {
-        sum += adc_read();
-        sleep_us(50);
-    }
-    return (uint16_t)(sum / samples);
+// --- Zona irigasi ---
+// One probe + one pump channel per zone, all zones sharing the two
+// interpreters round-robin: per-zone incremental cost is one extra
+// pump inference per cycle. The on-chip ADC caps this at
+// SOIL_ADC_MAX_CHANNELS zones; denser installs need an external mux.
+#define NUM_ZONES      (kBoard.num_zones)
+#define SOIL_ADC_PINS  (kBoard.soil_adc_pins)
+
+// --- Nyalakan LED sesuai level: satu tulisan mask ke SIO ---
+// All four pins change in the same cycle instead of one gpio_put per
+// pin, so partial bar-graph states are never visible on the pins. The
+// mask and the per-level value words come precomputed from the board
+// profile, so the commit is one table load and one SIO store.
+static constexpr LedBank FAN_BANK = board_led_bank(kBoard.fan_pins);
+static constexpr LedBank PUMP_BANK[BOARD_MAX_ZONES] = {
+    board_led_bank(kBoard.pump_pins[0]),
+    board_led_bank(kBoard.pump_pins[1]),
+    board_led_bank(kBoard.pump_pins[2]),
+};
+void set_led_level(const LedBank& bank, int level) {
+    gpio_put_masked(bank.mask, bank.value[clamp_level(level)]);
+}
+
+// --- Actuation backend ---
+// Bench build: bar-graph LED banks. Production (QDNN_PWM_ACTUATION):
+// one MOSFET gate per actuator on the bank's first pin, soft-started
+// by the DMA ramp sequencer - the commit below is O(1) either way.
+//
+// Disarmed when the boot-time model CRC check fails: the levels the
+// interpreters would produce from a corrupted flatbuffer are garbage,
+// so every commit is forced to 0 and the pins stay safe.
+static bool s_actuation_armed = true;
+#if QDNN_PWM_ACTUATION
+static PwmActuator fan_act;
+static PwmActuator pump_act[NUM_ZONES];
+static inline void apply_fan_level(int level) { pwm_actuate_set_level(&fan_act, s_actuation_armed ? level : 0); }
+static inline void apply_pump_level(int z, int level) { pwm_actuate_set_level(&pump_act[z], s_actuation_armed ? level : 0); }
+#else
+static inline void apply_fan_level(int level) { set_led_level(FAN_BANK, s_actuation_armed ? level : 0); }
+static inline void apply_pump_level(int z, int level) { set_led_level(PUMP_BANK[z], s_actuation_armed ? level : 0); }
+#endif
+
+// --- Whole-cycle actuation commit: fan + every zone in one go ---
+// LED build: the per-bank masks and level words are already folded
+// constants, so the fan and all pump banks OR into one mask / one
+// value and commit as a single SIO store - constant time in zones and
+// levels, and no cycle where one zone shows the new level while its
+// neighbour still shows the old. PWM build: one table-lookup DMA
+// enqueue per actuator (each O(1), unchanged levels are no-ops).
+#if !QDNN_PWM_ACTUATION
+constexpr uint32_t actuation_mask_all() {
+    uint32_t m = FAN_BANK.mask;
+    for (int z = 0; z < NUM_ZONES; z++) m |= PUMP_BANK[z].mask;
+    return m;
 }
+static constexpr uint32_t ACT_MASK_ALL = actuation_mask_all();
+#endif
 
-// --- Konversi ADC ke persentase ---
-float adc_to_percent(uint16_t raw) {
-    float percent = (float)(SOIL_DRY_RAW - raw) * 100.0f / (SOIL_DRY_RAW - SOIL_WET_RAW);
-    if (percent < 0) percent = 0;
-    if (percent > 100) percent = 100;
-    return percent;
+// Differential commit: a shadow of the last levels written to the
+// hardware, so a steady-state cycle costs a few compares and no bus
+// traffic at all (the PWM ramp enqueues and LED stores only happen on
+// delta). The shadow is trusted only for QDNN_ACT_REFRESH_MS - after
+// that an unchanged commit re-writes the pins anyway, so a level
+// corrupted behind our back (EMI, an errant gpio_put, a glitched PWM
+// slice) is corrected within one bounded, scheduled interval instead
+// of whenever the model next changes its mind.
+#ifndef QDNN_ACT_REFRESH_MS
+#define QDNN_ACT_REFRESH_MS 30000
+#endif
+static bool s_act_committed;  // false until the first hardware write
+static int s_act_shadow_fan;
+static int s_act_shadow_pump[NUM_ZONES];
+static uint32_t s_act_refresh_us;
+
+static inline void actuation_commit(int fan_level, const int pump_level[]) {
+#if QDNN_PUMP_DUTY
+    // Meter what actually reaches the pins: post-arm, post-clamp.
+    // Duty integrates over time, so metering stays per-cycle even
+    // when the hardware write below is skipped.
+    for (int z = 0; z < NUM_ZONES; z++)
+        pump_duty_note(z, clamp_level(s_actuation_armed ? pump_level[z] : 0));
+#endif
+    // Compare effective (post-arm, post-clamp) levels, so arming
+    // changes dirty the shadow like any level change.
+    int eff_fan = clamp_level(s_actuation_armed ? fan_level : 0);
+    int eff_pump[NUM_ZONES];
+    bool dirty = !s_act_committed || eff_fan != s_act_shadow_fan;
+    for (int z = 0; z < NUM_ZONES; z++) {
+        eff_pump[z] = clamp_level(s_actuation_armed ? pump_level[z] : 0);
+        dirty = dirty || eff_pump[z] != s_act_shadow_pump[z];
+    }
+    uint32_t now = time_us_32();
+    if (!dirty && now - s_act_refresh_us < QDNN_ACT_REFRESH_MS * 1000u)
+        return;
+    s_act_refresh_us = now;
+    s_act_committed = true;
+    s_act_shadow_fan = eff_fan;
+    for (int z = 0; z < NUM_ZONES; z++) s_act_shadow_pump[z] = eff_pump[z];
+#if QDNN_PWM_ACTUATION
+    apply_fan_level(fan_level);
+    for (int z = 0; z < NUM_ZONES; z++) apply_pump_level(z, pump_level[z]);
+#else
+    uint32_t value = FAN_BANK.value[eff_fan];
+    for (int z = 0; z < NUM_ZONES; z++)
+        value |= PUMP_BANK[z].value[eff_pump[z]];
+    gpio_put_masked(ACT_MASK_ALL, value);
+#endif
 }
 
-// --- Nyalakan LED sesuai level ---
-void set_led_level(const uint leds[4], int level) {
-    if (level < 0) level = 0;
-    if (level > 4) level = 4;
-    for (int i=0;i<4;i++) gpio_put(leds[i], i<level);
+#if QDNN_BROWNOUT
+// Brown-out safe state: force everything off NOW, from the sampler
+// IRQ, also metering the shutdown so the duty checkpoint that follows
+// is closed at zero. Arming is untouched - if the supply rides the sag
+// out, the next actuation commit restores the computed levels (and
+// re-forces anything a racing commit re-raised mid-trip).
+static void brownout_safe_outputs(void) {
+    int off[NUM_ZONES] = {};
+    actuation_commit(0, off);
 }
+#endif
 
-// --- Debug: tampil info tensor ---
+// --- Debug: tampil info tensor (compiled out below LOG_DEBUG) ---
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
 void print_tensor_info(TfLiteTensor* t, const char* name) {
     printf("Tensor %s: type=%d dims=", name, t->type);
     for (int i=0;i<t->dims->size;i++) printf("%d ", t->dims->data[i]);
@@ -60,59 +363,395 @@ void print_tensor_info(TfLiteTensor* t, const char* name) {
     if (t->params.scale != 0.0f || t->params.zero_point != 0)
         printf("  quant params: scale=%.6f zero_point=%d\n", t->params.scale, t->params.zero_point);
 }
+#endif
+
+// --- Konteks kuantisasi: disiapkan sekali setelah AllocateTensors() ---
+// Per-feature multipliers: derived from the model's embedded
+// normalization metadata when it carries one (identity otherwise), so
+// a model trained on shifted/scaled features generates its own integer
+// quantization path instead of relying on the 0.1-unit convention.
+struct QuantContext {
+    TfLiteType in_type;
+    float in_inv_scale;       // precomputed 1/scale: quantize is a multiply-add
+    int32_t in_mult10_q16[QDNN_META_MAX_FEATURES];  // 0.1*feat_scale/in_scale in Q16
+    int16_t in_off10[QDNN_META_MAX_FEATURES];       // deci-unit offset per feature
+    float in_fscale[QDNN_META_MAX_FEATURES];        // float-model fallback: 0.1*feat_scale
+    int32_t in_zero_point;
+    int32_t in_qmin;          // clamp bounds for the input type
+    int32_t in_qmax;
+    TfLiteType out_type;
+    float out_scale;
+    int32_t out_zero_point;
+    int out_classes;          // innermost output dim, hoisted from dims
+    int n_input;              // innermost input dim, feature-bound clamped
+};
+
+QuantContext prepare_quant_context(TfLiteTensor* input_tensor, TfLiteTensor* output_tensor,
+                                   const QdnnModelMeta* meta = nullptr) {
+    QuantContext ctx;
+    ctx.in_type = input_tensor->type;
+    ctx.in_inv_scale = (input_tensor->params.scale != 0.0f)
+                           ? 1.0f / input_tensor->params.scale : 0.0f;
+    ctx.in_zero_point = input_tensor->params.zero_point;
+    if (ctx.in_type == kTfLiteUInt8) { ctx.in_qmin = 0;    ctx.in_qmax = 255; }
+    else                             { ctx.in_qmin = -128; ctx.in_qmax = 127; }
+
+    // Verify the metadata against the graph before trusting it: a
+    // feature-count mismatch means the block belongs to a different
+    // export, and identity is the safer assumption.
+    int n_input = input_tensor->dims->data[input_tensor->dims->size - 1];
+    if (meta != nullptr && meta->input_count != n_input) {
+        LogWarn(("model meta: %d features vs tensor %d - using identity",
+                 meta->input_count, n_input));
+        meta = nullptr;
+    }
+    // Feature-builder consumers never see past the metadata bound (the
+    // control models are statically asserted within it); the anomaly
+    // window is legitimately wider and reads its width off the tensor.
+    ctx.n_input = n_input > QDNN_META_MAX_FEATURES ? QDNN_META_MAX_FEATURES : n_input;
+
+    // A few float multiplies here, at allocation time; every invoke
+    // after this quantizes deci-unit sensor integers with one Q16
+    // multiply-add per feature.
+    for (int f = 0; f < QDNN_META_MAX_FEATURES; f++) {
+        float feat_scale = (meta != nullptr && f < meta->input_count)
+                               ? meta->feature[f].scale : 1.0f;
+        ctx.in_off10[f] = (meta != nullptr && f < meta->input_count)
+                              ? meta->feature[f].offset10 : 0;
+        ctx.in_mult10_q16[f] =
+            (int32_t)(ctx.in_inv_scale * 0.1f * feat_scale * 65536.0f + 0.5f);
+        ctx.in_fscale[f] = 0.1f * feat_scale;
+    }
+
+    // Range audit: the training distribution's endpoints must still be
+    // representable after quantization, or accuracy silently dies in a
+    // clamp. One-shot boot warning, not a runtime check.
+    if (meta != nullptr && ctx.in_type != kTfLiteFloat32) {
+        for (int f = 0; f < meta->input_count && f < QDNN_META_MAX_FEATURES; f++) {
+            int32_t qlo = (((meta->feature[f].min10 - ctx.in_off10[f]) *
+                            ctx.in_mult10_q16[f]) >> 16) + ctx.in_zero_point;
+            int32_t qhi = (((meta->feature[f].max10 - ctx.in_off10[f]) *
+                            ctx.in_mult10_q16[f]) >> 16) + ctx.in_zero_point;
+            if (qlo < ctx.in_qmin || qhi > ctx.in_qmax)
+                LogWarn(("model meta: feature %d range [%d,%d] quantizes to [%ld,%ld], clamped",
+                         f, meta->feature[f].min10, meta->feature[f].max10,
+                         (long)qlo, (long)qhi));
+        }
+    }
+
+    ctx.out_type = output_tensor->type;
+    ctx.out_scale = output_tensor->params.scale;
+    ctx.out_zero_point = output_tensor->params.zero_point;
+    ctx.out_classes = output_tensor->dims->data[output_tensor->dims->size - 1];
+    return ctx;
+}
+
+// Quantize satu nilai deci-unit untuk fitur f: Q16 multiply-add, integer murni
+static inline int32_t quantize_value10(int32_t v10, const QuantContext &ctx, int f) {
+    return quantize_deci_q16(v10 - ctx.in_off10[f], ctx.in_mult10_q16[f],
+                             ctx.in_zero_point, ctx.in_qmin, ctx.in_qmax);
+}
+
+// --- Inference result cache (direct-mapped, keyed by quantized input) ---
+// One cache per model. The pump cache is written by core 1 (or by the
+// combo task on core 0); the report task only reads the hit/miss
+// counters - single word reads, benign if a push races them.
+static InferCache fan_cache;
+static InferCache pump_cache;
+
+// --- Argmax langsung pada data output mentah (tanpa dequantization) ---
+// The raw-row scans (argmax_row and friends) live in control_logic.h
+// now: host-pure templates, so the simulator's drift monitor holds the
+// exact integer code against a dequantizing float reference.
+
+// offset = awal baris dalam elemen, untuk output batch (baris z mulai
+// di z * out_classes); single-row callers pass 0. Dispatch happens
+// once per call, not inside the scan loop. margin_out selects the
+// top-2 scan; callers that only need the winner keep the plain one.
+static int QDNN_HOT_FUNC_RANK(3, argmax_output)(TfLiteTensor* output_tensor, const QuantContext &qctx, int out_classes, int offset,
+                                        int8_t* margin_out = nullptr,
+                                        const int8_t* bias = nullptr) {
+    // bias: per-zone delta row in logit steps, integer outputs only -
+    // the float fallback has no step unit, so it decides unbiased.
+    if (qctx.out_type == kTfLiteInt8) {
+        if (bias != nullptr)
+            return margin_out ? argmax2_row_biased(output_tensor->data.int8 + offset, out_classes, bias, margin_out)
+                              : argmax_row_biased(output_tensor->data.int8 + offset, out_classes, bias);
+        return margin_out ? argmax2_row(output_tensor->data.int8 + offset, out_classes, margin_out)
+                          : argmax_row(output_tensor->data.int8 + offset, out_classes);
+    }
+    if (qctx.out_type == kTfLiteUInt8) {
+        if (bias != nullptr)
+            return margin_out ? argmax2_row_biased(output_tensor->data.uint8 + offset, out_classes, bias, margin_out)
+                              : argmax_row_biased(output_tensor->data.uint8 + offset, out_classes, bias);
+        return margin_out ? argmax2_row(output_tensor->data.uint8 + offset, out_classes, margin_out)
+                          : argmax_row(output_tensor->data.uint8 + offset, out_classes);
+    }
+    if (qctx.out_type == kTfLiteFloat32)
+        return margin_out ? argmax2_row(output_tensor->data.f + offset, out_classes, margin_out)
+                          : argmax_row(output_tensor->data.f + offset, out_classes);
+    LogError(("Unsupported output tensor type %d", qctx.out_type));
+    return -1;
+}
+
+// --- Confidence in the model's own output quantization ---
+// The winner's raw logit cell, reported as-is: int8 ships unchanged,
+// uint8 re-biases by 128 (same scale, shifted zero), the float
+// fallback saturates into the int8 range. No dequantization anywhere -
+// one byte per model per cycle instead of a float score vector.
+static inline int8_t output_conf_raw(TfLiteTensor* output_tensor, const QuantContext &qctx,
+                                     int pred, int offset) {
+    if (pred < 0) return INT8_MIN;
+    if (qctx.out_type == kTfLiteInt8)
+        return output_tensor->data.int8[offset + pred];
+    if (qctx.out_type == kTfLiteUInt8)
+        return (int8_t)(output_tensor->data.uint8[offset + pred] - 128);
+    float v = output_tensor->data.f[offset + pred];
+    if (v > 127.0f) v = 127.0f;
+    if (v < -128.0f) v = -128.0f;
+    return (int8_t)v;
+}
+
+// --- Per-zone delta row lookup ---
+// Identity rows (all zero) return nullptr so the plain scans and the
+// shared infer cache keep their fast path. A zone with a live row
+// bypasses the cache instead: the key is input-only, and two zones
+// with the same input may now legitimately decide differently. A model
+// with more classes than the config row covers gets no bias - the
+// delta schema is sized for the shipped four-level heads.
+static inline const int8_t* bias_row_live(const int8_t* row) {
+    if (row == nullptr) return nullptr;
+    for (int i = 0; i < CONFIG_ZONE_CLASSES; i++)
+        if (row[i] != 0) return row;
+    return nullptr;
+}
+
+static inline const int8_t* zone_bias_row(int z, int out_classes) {
+    if (out_classes > CONFIG_ZONE_CLASSES) return nullptr;
+    return bias_row_live(config_get()->zone_bias[z]);
+}
+
+// --- Shared input preparation: satu sumber integer, tensor manapun ---
+// Factored out of run_model_safe/run_model_batch so every consumer of
+// the same deci-unit values (fan, pump rows for core 1, combo sweep)
+// runs one loop shape, and a cycle that feeds two models pays two
+// fixed-point multiplies per feature from one integer source instead
+// of two full input-assembly passes. total may span several rows of
+// n_input features (row-major); the feature index wraps per row.
+static bool QDNN_HOT_FUNC_RANK(2, prepare_input_values)(TfLiteTensor* input_tensor, const QuantContext &qctx,
+                                 const int16_t* vals10, int total, int n_input) {
+    if (qctx.in_type == kTfLiteFloat32) {
+        // Float fallback model: unavoidable conversion, reference-kernel
+        // path anyway (see audit_kernel_path). The feature index is a
+        // wrap counter - a modulo here is a divider launch per element.
+        for (int i = 0, f = 0; i < total; i++) {
+            input_tensor->data.f[i] = (vals10[i] - qctx.in_off10[f]) * qctx.in_fscale[f];
+            if (++f == n_input) f = 0;
+        }
+#if QDNN_INTERP_SCALE
+    } else if (qctx.in_type == kTfLiteInt8) {
+        // Batch scaling with the clamp in this core's interpolator:
+        // the ALU does only the Q16 multiply-add per feature.
+        interp_clamp_setup(qctx.in_qmin, qctx.in_qmax);
+        for (int i = 0, f = 0; i < total; i++) {
+            input_tensor->data.int8[i] = (int8_t)interp_clamp(
+                quantize_deci_q16_noclamp(vals10[i] - qctx.in_off10[f],
+                                          qctx.in_mult10_q16[f], qctx.in_zero_point));
+            if (++f == n_input) f = 0;
+        }
+    } else if (qctx.in_type == kTfLiteUInt8) {
+        interp_clamp_setup(qctx.in_qmin, qctx.in_qmax);
+        for (int i = 0, f = 0; i < total; i++) {
+            input_tensor->data.uint8[i] = (uint8_t)interp_clamp(
+                quantize_deci_q16_noclamp(vals10[i] - qctx.in_off10[f],
+                                          qctx.in_mult10_q16[f], qctx.in_zero_point));
+            if (++f == n_input) f = 0;
+        }
+#else
+    } else if (qctx.in_type == kTfLiteInt8 || qctx.in_type == kTfLiteUInt8) {
+        // Batch quantizer: feature-hoisted constants, split-half MULS
+        // and branchless clamps - the per-element path paid a software
+        // modulo and a 64-bit multiply per value.
+        uint8_t* dst = (qctx.in_type == kTfLiteInt8)
+            ? (uint8_t*)input_tensor->data.int8 : input_tensor->data.uint8;
+        quantize_rows10(vals10, total / n_input, n_input, qctx.in_mult10_q16,
+                        qctx.in_off10, qctx.in_zero_point, qctx.in_qmin,
+                        qctx.in_qmax, dst);
+#endif
+    } else {
+        LogError(("Unsupported input tensor type %d", qctx.in_type));
+        return false;
+    }
+    return true;
+}
+
+// --- Invoke dengan deadline hardware ---
+// Budget per single Invoke. Steady-state invokes run a few
+// milliseconds even at the eco clock, so the default is pure pathology
+// margin (bad model upload, corrupted tensor); overridable from the
+// build for deployments with heavier models.
+#ifndef QDNN_INVOKE_DEADLINE_MS
+#define QDNN_INVOKE_DEADLINE_MS 250
+#endif
+
+// Every control-path Invoke goes through here: the deadline is armed
+// around the run, failures and overruns are counted once, and the
+// caller falls back (held levels) on false. The guard is one alarm per
+// core, so it must only be armed from one task per core - the anomaly
+// task deliberately invokes unguarded.
+static bool QDNN_HOT_FUNC_RANK(4, invoke_guarded)(tflite::MicroInterpreter &interpreter) {
+    invoke_deadline_arm();
+    bool ok = interpreter.Invoke() == kTfLiteOk;
+    bool late = invoke_deadline_disarm();
+    if (!ok) {
+        err_stats_bump(ERR_INVOKE);
+        if (err_stats_detail_allowed(ERR_INVOKE)) LogError(("Invoke failed"));
+        return false;
+    }
+    if (late) {
+        // ERR_INVOKE_DL already ticked from the alarm IRQ
+        if (err_stats_detail_allowed(ERR_INVOKE_DL))
+            LogWarn(("Invoke overran the %u ms deadline, result discarded",
+                     (unsigned)QDNN_INVOKE_DEADLINE_MS));
+        return false;
+    }
+    return true;
+}
+
+#if QDNN_GOLDEN_PROBE
+// --- Scheduled self-consistency probe over the embedded golden vectors ---
+// The model bank's integrity checks prove the bytes are the bytes that
+// were uploaded; nothing proves those bytes still decide like the model
+// that was trained. The metadata block pins a few high-margin training
+// vectors to their exported decisions, and on a slow schedule (about
+// one spare Invoke per hour at the default cycle cadence) the live
+// interpreter re-answers them. A mismatch is counted and, when a bank
+// model is serving, trips the same compiled-in fallback a failed bind
+// would - a CRC-clean but wrong model degrades loudly, not silently.
+#ifndef QDNN_GOLDEN_PERIOD_CYCLES
+#define QDNN_GOLDEN_PERIOD_CYCLES 1200
+#endif
+
+// 1: all vectors agreed. 0: nothing to check (pre-golden export) or the
+// Invoke itself failed - that is already counted at ERR_INVOKE and the
+// held-level machinery owns it, so it must not also trip the fallback.
+// -1: a vector decided differently from its pinned level.
+static int golden_probe_run(const char* name, tflite::MicroInterpreter& interp,
+                            TfLiteTensor* input, TfLiteTensor* output,
+                            const QuantContext& qctx, const QdnnModelMeta* meta) {
+    int n = meta->golden_count;
+    if (n > QDNN_META_MAX_GOLDEN) n = QDNN_META_MAX_GOLDEN;
+    if (n == 0) return 0;
+    for (int i = 0; i < n; i++) {
+        const QdnnGoldenVector* gv = &meta->golden[i];
+        if (!prepare_input_values(input, qctx, gv->in10, qctx.n_input,
+                                  qctx.n_input))
+            return 0;
+        if (!invoke_guarded(interp)) return 0;
+        // Unbiased decision: the vectors were pinned at training, before
+        // any per-zone personalization delta existed.
+        int level = argmax_output(output, qctx, qctx.out_classes, 0);
+        if (level != gv->expect_level) {
+            err_stats_bump(ERR_GOLDEN);
+            if (err_stats_detail_allowed(ERR_GOLDEN))
+                LogError(("%s golden vector %d: decided %d, training pinned %d",
+                          name, i, level, (int)gv->expect_level));
+            return -1;
+        }
+    }
+    return 1;
+}
+#endif
 
 // --- Jalankan model dengan auto quantization ---
-int run_model_safe(tflite::MicroInterpreter &interpreter, TfLiteTensor* input_tensor,
-                   TfLiteTensor* output_tensor, float* input_vals, int n_input,
-                   float* out_scores_buffer, int max_out_scores) {
+// pre_q: baris input yang sudah terkuantisasi di tempat lain (int8
+// saja); tensor diisi memcpy, tanpa kuantisasi ulang.
+int QDNN_HOT_FUNC_RANK(4, run_model_safe)(tflite::MicroInterpreter &interpreter, TfLiteTensor* input_tensor,
+                   TfLiteTensor* output_tensor, const QuantContext &qctx,
+                   const int16_t* input_vals10, int n_input, InferCache* cache,
+                   float* out_scores_buffer, int max_out_scores,
+                   const int8_t* pre_q = nullptr, int8_t* out_conf = nullptr,
+                   int8_t* out_margin = nullptr,
+                   const int8_t* out_bias = nullptr) {
 
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
     print_tensor_info(input_tensor, "input");
     print_tensor_info(output_tensor, "output");
+#endif
 
-    // isi input
-    if (input_tensor->type == kTfLiteFloat32) {
-        for (int i=0;i<n_input;i++) input_tensor->data.f[i] = input_vals[i];
-    } else if (input_tensor->type == kTfLiteInt8) {
-        float scale = input_tensor->params.scale;
-        int zp = input_tensor->params.zero_point;
-        for (int i=0;i<n_input;i++) {
-            int32_t q = (int32_t)round(input_vals[i]/scale)+zp;
-            if (q<-128) q=-128; if(q>127) q=127;
-            input_tensor->data.int8[i] = (int8_t)q;
-        }
-    } else if (input_tensor->type == kTfLiteUInt8) {
-        float scale = input_tensor->params.scale;
-        int zp = input_tensor->params.zero_point;
-        for (int i=0;i<n_input;i++) {
-            int32_t q = (int32_t)round(input_vals[i]/scale)+zp;
-            if (q<0) q=0; if(q>255) q=255;
-            input_tensor->data.uint8[i] = (uint8_t)q;
-        }
-    } else {
-        printf("Unsupported input tensor type %d\n", input_tensor->type);
+    // isi input: deci-unit integer langsung ke tensor, tanpa float
+    if (pre_q != nullptr && qctx.in_type == kTfLiteInt8) {
+        memcpy(input_tensor->data.int8, pre_q, (size_t)n_input);
+    } else if (!prepare_input_values(input_tensor, qctx, input_vals10, n_input, n_input)) {
         return -1;
     }
 
-    if(interpreter.Invoke()!=kTfLiteOk) { printf("Invoke failed\n"); return -1; }
+    // Cache lookup on the quantized key: in stable conditions the same
+    // handful of triples recurs for hours, and a hit is a 3-byte
+    // compare instead of an Invoke. Logit-only path only (the cache
+    // stores levels, not scores) and quantized inputs only.
+    uint8_t cache_key[3];
+    bool cacheable = (cache != nullptr) && (out_scores_buffer == nullptr) &&
+                     (n_input == 3) && (qctx.in_type != kTfLiteFloat32) &&
+                     (out_bias == nullptr);
+    if (cacheable) {
+        const uint8_t* qdata = (qctx.in_type == kTfLiteInt8)
+            ? (const uint8_t*)input_tensor->data.int8 : input_tensor->data.uint8;
+        for (int i = 0; i < 3; i++) cache_key[i] = qdata[i];
+        int cached = infer_cache_lookup(cache, cache_key, out_conf, out_margin);
+        if (cached >= 0) return cached;
+    }
 
-    // baca output dan dequantize
-    int out_classes = output_tensor->dims->data[1];
+#if QDNN_BUS_COUNTERS
+    // One window per Invoke: XIP hit rate answers compute- vs
+    // fetch-bound, the contested counts show cross-core arena traffic.
+    // Counters are chip-global, so read them on measurement builds with
+    // one invoke in flight (combo model, or core 1 idle).
+    static const BusPerfEvent kInvokeEvents[4] = {
+        BUS_PERF_XIP_MAIN, BUS_PERF_XIP_MAIN_CONTESTED,
+        BUS_PERF_SRAM4_CONTESTED, BUS_PERF_SRAM5_CONTESTED};
+    bus_counters_begin(kInvokeEvents);
+#endif
+
+    if (!invoke_guarded(interpreter)) return -1;
+
+#if QDNN_BUS_COUNTERS
+    BusCounters bc;
+    bus_counters_end(&bc);
+    LogInfo(("invoke: xip hit %u/1000 (%u acc), xip contested %u, sram4/5 contested %u/%u",
+             (unsigned)bus_counters_hit_permille(&bc), (unsigned)bc.xip_accesses,
+             (unsigned)bc.perf[1], (unsigned)bc.perf[2], (unsigned)bc.perf[3]));
+#endif
+
+    int out_classes = qctx.out_classes;
     if(out_classes>max_out_scores) out_classes = max_out_scores;
 
-    if(output_tensor->type==kTfLiteFloat32) {
+    // Fast path logit-only: Softmax monotonik dan scale > 0, jadi argmax
+    // pada output mentah (quantized/logit) sama dengan argmax pada skor
+    // dequantized. Tanpa buffer skor, lewati dequantization sepenuhnya.
+    if (out_scores_buffer == nullptr) {
+        int8_t margin = INT8_MIN;
+        bool want_margin = (out_margin != nullptr) || cacheable;
+        int pred = argmax_output(output_tensor, qctx, out_classes, 0,
+                                 want_margin ? &margin : nullptr, out_bias);
+        int8_t conf = output_conf_raw(output_tensor, qctx, pred, 0);
+        if (out_conf != nullptr) *out_conf = conf;
+        if (out_margin != nullptr) *out_margin = margin;
+        if (cacheable && pred >= 0) infer_cache_store(cache, cache_key, pred, conf, margin);
+        return pred;
+    }
+
+    // baca output dan dequantize
+    if(qctx.out_type==kTfLiteFloat32) {
         for(int i=0;i<out_classes;i++) out_scores_buffer[i] = output_tensor->data.f[i];
-    } else if(output_tensor->type==kTfLiteInt8) {
-        float scale = output_tensor->params.scale;
-        int zp = output_tensor->params.zero_point;
+    } else if(qctx.out_type==kTfLiteInt8) {
         for(int i=0;i<out_classes;i++)
-            out_scores_buffer[i] = (output_tensor->data.int8[i]-zp)*scale;
-    } else if(output_tensor->type==kTfLiteUInt8) {
-        float scale = output_tensor->params.scale;
-        int zp = output_tensor->params.zero_point;
+            out_scores_buffer[i] = (output_tensor->data.int8[i]-qctx.out_zero_point)*qctx.out_scale;
+    } else if(qctx.out_type==kTfLiteUInt8) {
         for(int i=0;i<out_classes;i++)
-            out_scores_buffer[i] = (output_tensor->data.uint8[i]-zp)*scale;
+            out_scores_buffer[i] = (output_tensor->data.uint8[i]-qctx.out_zero_point)*qctx.out_scale;
     } else {
-        printf("Unsupported output tensor type %d\n", output_tensor->type);
+        LogError(("Unsupported output tensor type %d", qctx.out_type));
         return -1;
     }
 
@@ -122,81 +761,3282 @@ int run_model_safe(tflite::MicroInterpreter &interpreter, TfLiteTensor* input_te
     for(int i=1;i<out_classes;i++) {
         if(out_scores_buffer[i]>maxs) { maxs=out_scores_buffer[i]; pred=i; }
     }
+    // A zone delta row overrides the float scan on integer outputs:
+    // the decision must match the release build's biased raw argmax.
+    if (out_bias != nullptr && qctx.out_type != kTfLiteFloat32)
+        pred = argmax_output(output_tensor, qctx, out_classes, 0, nullptr, out_bias);
 
-    // print scores
+    // Full-precision scores are a debug-build view; the reported
+    // confidence and margin stay in the model's own quantization
+    // either way (monotonic scale: the raw argmax matches pred).
+    if (out_conf != nullptr)
+        *out_conf = output_conf_raw(output_tensor, qctx, pred, 0);
+    if (out_margin != nullptr)
+        argmax_output(output_tensor, qctx, out_classes, 0, out_margin, out_bias);
+
+    // print scores (debug builds only)
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
+#if QDNN_LAZY_FMT
+    // Milli-unit integers into the format ring; the drain task renders
+    // the text. The float-to-int is a cycle each, the printf was not.
+    {
+        int32_t ms[16];
+        int nsc = out_classes > 16 ? 16 : out_classes;
+        for (int i = 0; i < nsc; i++)
+            ms[i] = (int32_t)(out_scores_buffer[i] * 1000.0f);
+        log_fmt_emit(LOG_FMT_SCORES, ms, (uint8_t)nsc);
+    }
+#else
     printf("Scores: ");
     for(int i=0;i<out_classes;i++) printf("%.3f ", out_scores_buffer[i]);
     printf("\n");
+#endif
+#endif
 
     return pred;
 }
 
-int main() {
-    stdio_init_all();
-    sleep_ms(2000);
-    printf("=== Pico DHT11 + Soil + TinyML Fan/Pump ===\n");
+// --- Batched invoke: semua zona dalam satu Invoke() ---
+// FullyConnected stacks batch naturally: a model exported with leading
+// dimension N computes every zone's row in one pass over the weights,
+// so each weight byte comes out of flash once per cycle instead of once
+// per zone, and the fixed interpreter dispatch cost is paid once. The
+// vendored batch-1 models take the per-row fallback below; this API is
+// the stable seam the multi-zone export plugs into.
+//
+// rows10 is n_rows x n_input deci-unit values, row-major. out_levels
+// gets one argmax per row. Returns 0, or -1 on interpreter error.
+static int QDNN_HOT_FUNC_RANK(2, run_model_batch)(tflite::MicroInterpreter &interpreter, TfLiteTensor* input_tensor,
+                    TfLiteTensor* output_tensor, const QuantContext &qctx,
+                    const int16_t* rows10, int n_rows, int n_input,
+                    InferCache* cache, int* out_levels,
+                    const int8_t* rows_q = nullptr, int8_t* out_conf = nullptr,
+                    int8_t* out_margin = nullptr,
+                    const int8_t* row_bias = nullptr, int bias_stride = 0) {
+    // row_bias: per-row (per-zone) delta rows, bias_stride bytes apart;
+    // identity rows stay cacheable, live ones decide biased.
+    // Batch-1 model (atau batch terlalu kecil): jalur per-baris lama
+    if (input_tensor->dims->data[0] < n_rows) {
+        for (int r = 0; r < n_rows; r++)
+            out_levels[r] = run_model_safe(interpreter, input_tensor, output_tensor, qctx,
+                                           rows10 + r * n_input, n_input, cache, nullptr, 0,
+                                           rows_q ? rows_q + r * n_input : nullptr,
+                                           out_conf ? out_conf + r : nullptr,
+                                           out_margin ? out_margin + r : nullptr,
+                                           row_bias ? bias_row_live(row_bias + r * bias_stride)
+                                                    : nullptr);
+        return 0;
+    }
 
-    // --- Init GPIO ---
-    for(int i=0;i<4;i++){
-        gpio_init(FAN_LEDS[i]); gpio_set_dir(FAN_LEDS[i], GPIO_OUT); gpio_put(FAN_LEDS[i],0);
-        gpio_init(PUMP_LEDS[i]); gpio_set_dir(PUMP_LEDS[i], GPIO_OUT); gpio_put(PUMP_LEDS[i],0);
+    const int total = n_rows * n_input;
+    if (rows_q != nullptr && qctx.in_type == kTfLiteInt8) {
+        // Rows arrived pre-quantized (quantize-once on the other core)
+        memcpy(input_tensor->data.int8, rows_q, (size_t)total);
+    } else if (!prepare_input_values(input_tensor, qctx, rows10, total, n_input)) {
+        return -1;
     }
-    gpio_init(LED_DHT_ERROR); gpio_set_dir(LED_DHT_ERROR, GPIO_OUT); gpio_put(LED_DHT_ERROR,0);
 
-    // --- Init ADC ---
-    adc_init();
-    adc_gpio_init(SOIL_ADC_PIN);
-    adc_select_input(0);
+    // Cache probe per baris: only a full set of hits skips the Invoke -
+    // a partial batch would forfeit exactly the amortization this path
+    // exists for, so misses run the whole batch and re-store every row.
+    const uint8_t* qdata = nullptr;
+    bool cacheable = (cache != nullptr) && (n_input == 3) && (qctx.in_type != kTfLiteFloat32);
+    if (cacheable) {
+        qdata = (qctx.in_type == kTfLiteInt8)
+            ? (const uint8_t*)input_tensor->data.int8 : input_tensor->data.uint8;
+        bool all_hit = true;
+        for (int r = 0; r < n_rows; r++) {
+            // A row with a live delta never consults the shared cache:
+            // its decision no longer follows from the input alone.
+            const int8_t* rb = row_bias ? bias_row_live(row_bias + r * bias_stride)
+                                        : nullptr;
+            out_levels[r] = rb ? -1
+                               : infer_cache_lookup(cache, qdata + r * 3,
+                                                    out_conf ? out_conf + r : nullptr,
+                                                    out_margin ? out_margin + r : nullptr);
+            if (out_levels[r] < 0) all_hit = false;
+        }
+        if (all_hit) return 0;
+    }
 
-    // --- DHT ---
-    float temp=0, humid=0;
+    if (!invoke_guarded(interpreter)) return -1;
 
-    // --- TinyML Fan ---
-    const tflite::Model* fan_model = tflite::GetModel(qdnn_fan_model);
-    tflite::MicroMutableOpResolver<10> fan_resolver;
-    fan_resolver.AddFullyConnected(); fan_resolver.AddReshape(); fan_resolver.AddSoftmax();
-    tflite::MicroInterpreter fan_interpreter(fan_model, fan_resolver, fan_arena, kArenaSize);
-    fan_interpreter.AllocateTensors();
-    TfLiteTensor* fan_input = fan_interpreter.input(0);
-    TfLiteTensor* fan_output = fan_interpreter.output(0);
+    int out_classes = qctx.out_classes;
+    for (int r = 0; r < n_rows; r++) {
+        int8_t margin = INT8_MIN;
+        bool want_margin = (out_margin != nullptr) || cacheable;
+        const int8_t* rb = row_bias ? bias_row_live(row_bias + r * bias_stride)
+                                    : nullptr;
+        out_levels[r] = argmax_output(output_tensor, qctx, out_classes, r * out_classes,
+                                      want_margin ? &margin : nullptr, rb);
+        int8_t conf = output_conf_raw(output_tensor, qctx, out_levels[r], r * out_classes);
+        if (out_conf != nullptr) out_conf[r] = conf;
+        if (out_margin != nullptr) out_margin[r] = margin;
+        if (cacheable && rb == nullptr && out_levels[r] >= 0)
+            infer_cache_store(cache, qdata + r * 3, out_levels[r], conf, margin);
+    }
+    return 0;
+}
+
+// --- Audit: pastikan model benar-benar memakai jalur CMSIS-NN int8 ---
+// pico-tflmicro is built with CMSIS_NN=1, but the fast kernels only
+// engage for int8 tensors; a float model silently falls back to the
+// reference kernels. Check once at boot, and in the forced-fast build
+// (QDNN_REQUIRE_FAST_KERNELS) refuse to run on the slow path.
+static void audit_kernel_path(const char* name, TfLiteTensor* input, TfLiteTensor* output) {
+    bool int8_path = (input->type == kTfLiteInt8) && (output->type == kTfLiteInt8);
+    if (int8_path) {
+        LogInfo(("%s model: int8 tensors, CMSIS-NN fast kernels active", name));
+    } else {
+        LogWarn(("%s model: tensor types in=%d out=%d fall back to reference kernels",
+                 name, input->type, output->type));
+#if QDNN_REQUIRE_FAST_KERNELS
+        configASSERT(int8_path);
+#endif
+    }
+}
 
-    // --- TinyML Pump ---
+#ifdef USE_TFLM_COMPRESSION
+// --- Audit: model terkompresi vs kemampuan kernel ---
+// The allocator parses COMPRESSION_METADATA transparently and draws the
+// decompression scratch from the arena (visible as kCompressionData in
+// the QDNN_ARENA_AUDIT report). But decompression happens per kernel,
+// and the vendored CMSIS-NN FullyConnected kernel reads its weights
+// with plain GetTensorData() - a compressed FC model would multiply the
+// raw bitstream and produce garbage levels. Refuse at boot until the
+// kernel side grows the decompress hooks.
+static void audit_compression(const char* name, const tflite::Model* model) {
+    bool compressed = false;
+    if (model->metadata() != nullptr) {
+        for (auto m : *model->metadata()) {
+            if (m->name() != nullptr &&
+                strcmp(m->name()->c_str(), tflite::kCompressionMetadataString) == 0) {
+                compressed = true;
+                break;
+            }
+        }
+    }
+    if (compressed) {
+        LogError(("%s model: compressed tensors present but the CMSIS-NN "
+                  "FullyConnected kernel cannot decompress them", name));
+        configASSERT(!compressed);
+    } else {
+        LogInfo(("%s model: no compressed tensors", name));
+    }
+}
+#else
+#define audit_compression(name, model) ((void)0)
+#endif
+
+#if QDNN_ARENA_AUDIT
+// --- Audit: dump rencana penempatan arena per tensor ---
+// PrintAllocations() gives per-type totals, but not the shape of the
+// greedy plan - which tensors overlap, where the padding sits, how much
+// slack a kArenaSize trim would really have. The planner itself (and
+// its PrintMemoryPlan()) is buried inside the allocator, but the plan
+// is fully recoverable after AllocateTensors(): every eval tensor's
+// data pointer is the planned offset, and lifetimes fall out of one
+// pass over the operator list. The interpreter only hands out its
+// eval-tensor table through the protected TfLiteContext, hence the
+// thin subclass below - audit builds only, never in the flight image.
+//
+// One line per tensor, machine-readable for the offline overlap chart:
+//
+//   [plan],<model>,<tensor>,<offset|rom>,<bytes>,<first_op>,<last_op>
+//
+// "rom" marks buffers served straight from the flatbuffer in flash.
+// first_op/last_op are execution-order operator indices (-1 -1 for
+// buffers no operator touches). Kernel scratch requested during
+// Prepare() shares the same plan but has no flatbuffer identity, so it
+// does not appear here - reconcile the total against the "[arena] used"
+// line above the dump.
+class AuditInterpreter : public tflite::RecordingMicroInterpreter {
+public:
+    using RecordingMicroInterpreter::RecordingMicroInterpreter;
+    const TfLiteContext& plan_context() const { return context(); }
+};
+
+static void audit_memory_plan(const char* name, const tflite::Model* model,
+                              const AuditInterpreter& interp,
+                              const uint8_t* arena, size_t arena_size) {
+    const TfLiteContext& ctx = interp.plan_context();
+    const tflite::SubGraph* graph = model->subgraphs()->Get(0);
+    const auto* ops = graph->operators();
+    int n_tensors = (int)graph->tensors()->size();
+    printf("[plan] %s: %d tensors, header model,tensor,offset,bytes,first_op,last_op\n",
+           name, n_tensors);
+    for (int t = 0; t < n_tensors; t++) {
+        TfLiteEvalTensor* ev = ctx.GetEvalTensor(&ctx, t);
+        if (ev == nullptr || ev->data.data == nullptr) continue;
+        size_t bytes = 0;
+        tflite::TfLiteEvalTensorByteLength(ev, &bytes);
+        int first = -1, last = -1;
+        for (int o = 0; ops != nullptr && o < (int)ops->size(); o++) {
+            const tflite::Operator* op = ops->Get(o);
+            bool uses = false;
+            if (op->inputs() != nullptr)
+                for (auto ti : *op->inputs())
+                    if (ti == t) uses = true;
+            if (op->outputs() != nullptr)
+                for (auto ti : *op->outputs())
+                    if (ti == t) uses = true;
+            if (uses) {
+                if (first < 0) first = o;
+                last = o;
+            }
+        }
+        const uint8_t* p = (const uint8_t*)ev->data.data;
+        if (p >= arena && p < arena + arena_size) {
+            printf("[plan],%s,%d,%u,%u,%d,%d\n", name, t,
+                   (unsigned)(p - arena), (unsigned)bytes, first, last);
+        } else {
+            printf("[plan],%s,%d,rom,%u,%d,%d\n", name, t,
+                   (unsigned)bytes, first, last);
+        }
+    }
+}
+#endif
+
+#if !QDNN_COMBO_MODEL
+// --- Dual-core handoff: pump model jalan di core 1 ---
+#define CORE1_READY 0xC0DE0001u
+#define CORE1_GO    0xC0DE0002u
+
+// Input frames untuk core 1 (satu per zona), ditulis core 0 sebelum
+// handoff. Lives in core 1's scratch bank (SRAM4) next to its stack:
+// the handoff writes are the only cross-bank traffic, and core 1's
+// reads during quantize never leave its own bank. Rows are packed at
+// the pump model's feature width (core1_ml_n), row-major, so the batch
+// API consumes them in place.
+static int16_t __scratch_x("core1_handoff") core1_ml_input[NUM_ZONES * QDNN_META_MAX_FEATURES];
+static volatile int32_t core1_ml_n;       // width the rows were packed at
+
+// Quantize-once handoff: core 1 publishes its bound model's quant
+// context so core 0 can fill the pump rows in the same input-assembly
+// pass that feeds the fan tensor - two fixed-point multiplies per
+// feature from one integer source instead of a second full pass on
+// core 1. The generation counter catches a model-bank rebind racing a
+// batch: rows stamped with a stale generation are re-quantized on
+// core 1 from the raw values that always travel alongside.
+static QuantContext __scratch_x("core1_handoff") pump_qctx_shared;
+static volatile uint32_t pump_qctx_gen;   // 0 = not yet published
+static int8_t __scratch_x("core1_handoff") core1_ml_q[NUM_ZONES * QDNN_META_MAX_FEATURES];
+static volatile uint32_t core1_ml_q_gen;  // generation the rows were stamped with
+
+// Per-zone confidence travelling back: core 1 writes the batch's raw
+// winner logits here before pushing the levels, so the FIFO pops on
+// core 0 order the reads. One byte per zone, no extra FIFO words.
+// Margins (top-2 logit gaps) ride the same way for the confidence
+// gate in the actuation task.
+static volatile int8_t __scratch_x("core1_handoff") core1_pump_conf[NUM_ZONES];
+static volatile int8_t __scratch_x("core1_handoff") core1_pump_margin[NUM_ZONES];
+
+static void core1_pump_entry() {
+    // Core 1 harus bisa diparkir saat core 0 menulis flash
+    multicore_lockout_victim_init();
+
+    // Core 1 memiliki pump interpreter sepenuhnya
+#if QDNN_ARENA_AUDIT
     const tflite::Model* pump_model = tflite::GetModel(qdnn_pump_model);
-    tflite::MicroMutableOpResolver<10> pump_resolver;
-    pump_resolver.AddFullyConnected(); pump_resolver.AddReshape(); pump_resolver.AddSoftmax();
-    tflite::MicroInterpreter pump_interpreter(pump_model, pump_resolver, pump_arena, kArenaSize);
+    QdnnOpResolver pump_resolver;
+    qdnn_register_ops(pump_resolver);
+    AuditInterpreter pump_interpreter(pump_model, pump_resolver, pump_arena, kArenaSize);
     pump_interpreter.AllocateTensors();
+    printf("[arena] pump used %u of %u bytes\n",
+           (unsigned)pump_interpreter.arena_used_bytes(), (unsigned)kArenaSize);
+    pump_interpreter.GetMicroAllocator().PrintAllocations();
+    audit_memory_plan("pump", pump_model, pump_interpreter, pump_arena, kArenaSize);
+#elif QDNN_PROFILE_OPS
+    const tflite::Model* pump_model = tflite::GetModel(qdnn_pump_model);
+    QdnnOpResolver pump_resolver;
+    qdnn_register_ops(pump_resolver);
+    tflite::MicroProfiler pump_profiler;
+    tflite::MicroInterpreter pump_interpreter(pump_model, pump_resolver, pump_arena, kArenaSize,
+                                              nullptr, &pump_profiler);
+    pump_interpreter.AllocateTensors();
+#else
+    // Model slot: arena, resolver and interpreter storage outlive the
+    // bound flatbuffer, so rotating per-zone pump models through this
+    // core is a sub-ms rebind instead of a cold interpreter start.
+    static ModelSlot pump_slot;
+    model_slot_init(&pump_slot, pump_arena, kArenaSize);
+#if QDNN_MODEL_BANK
+    // Prefer the newest flash bank; empty banks - and a bank whose plan
+    // no longer fits the arena - fall back to the compiled-in
+    // flatbuffer (verified bind: both failure classes logged + counted).
+    const unsigned char* pump_data = model_bank_active(MODEL_BANK_PUMP);
+    model_slot_bind_verified(&pump_slot, pump_data ? pump_data : qdnn_pump_model,
+                             qdnn_pump_model);
+#else
+    model_slot_bind_verified(&pump_slot, qdnn_pump_model, nullptr);
+#endif
+    if (model_slot_interpreter(&pump_slot) == nullptr) {
+        // Even the compiled-in model failed to plan: a logged degraded
+        // mode, not a silent brick. Keep answering batches with level 0
+        // (actuation is disarmed anyway) so core 0's pipeline, the
+        // shell and telemetry all stay alive for diagnosis.
+        s_actuation_armed = false;
+        boot_stages_mark("pump");
+        multicore_fifo_push_blocking(CORE1_READY);
+        while (true) {
+            multicore_fifo_pop_blocking();
+            for (int z = 0; z < NUM_ZONES; z++) {
+                core1_pump_conf[z] = INT8_MIN;  // no invoke backs these levels
+                core1_pump_margin[z] = INT8_MIN;
+                multicore_fifo_push_blocking(0);
+            }
+        }
+    }
+#if QDNN_MODEL_BANK && QDNN_MODEL_SHADOW
+    // Shadow evaluation rebinds the slot per cycle; remember what the
+    // live model actually is (the fallback may have engaged above) so
+    // every detour comes back to it.
+    const unsigned char* live_data = pump_slot.model_data;
+#endif
+    const tflite::Model* pump_model = model_slot_model(&pump_slot);
+    tflite::MicroInterpreter& pump_interpreter = *model_slot_interpreter(&pump_slot);
+#endif
     TfLiteTensor* pump_input = pump_interpreter.input(0);
     TfLiteTensor* pump_output = pump_interpreter.output(0);
+    QuantContext pump_qctx = prepare_quant_context(pump_input, pump_output,
+                                                   &qdnn_pump_model_meta);
+    audit_kernel_path("pump", pump_input, pump_output);
+    audit_compression("pump", pump_model);
+    // Fresh cache per bound model: the key->level mapping is per-model,
+    // so any future rebind must come back through here.
+    infer_cache_init(&pump_cache);
+    // Boot report: how much arena the plan actually took
+    telemetry_boot_note_model(1, 0, (uint32_t)pump_interpreter.arena_used_bytes());
+    pump_qctx_shared = pump_qctx;
+    __dmb();  // context lands before the generation moves
+    pump_qctx_gen = pump_qctx_gen + 1;
+
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
+    float scores_buf[16];
+    float* scores = scores_buf;
+#else
+    float* scores = nullptr;  // logit-only fast path: skip dequantization
+#endif
+    // Core 1's own deadline alarm: the guard state is per core
+    invoke_deadline_init(QDNN_INVOKE_DEADLINE_MS);
+#if QDNN_IRQ_MAP
+    // After the alarm claim, so the published snapshot shows it
+    irq_map_apply();
+#endif
+    boot_stages_mark("pump");
+    multicore_fifo_push_blocking(CORE1_READY);
+
+    while (true) {
+        multicore_fifo_pop_blocking();  // wait for a fresh batch of zone frames
+#if QDNN_MODEL_BANK && !(QDNN_ARENA_AUDIT || QDNN_PROFILE_OPS)
+#if QDNN_MODEL_SHADOW
+        // Shadowed rollout: an upload arms the candidate slot and the
+        // live model keeps serving until the shell promotes it. Both
+        // verdicts land here, at the batch boundary, where the rebind
+        // is safe.
+        if (model_shadow_take_promote()) {
+            const unsigned char* cand = model_shadow_data();
+            if (model_slot_bind(&pump_slot, cand) == 0) {
+                live_data = cand;
+                LogInfo(("pump shadow: candidate promoted to live"));
+            } else {
+                model_slot_bind(&pump_slot, live_data);
+                LogError(("pump shadow: promote bind failed, live model kept"));
+            }
+            pump_input = pump_interpreter.input(0);
+            pump_output = pump_interpreter.output(0);
+            pump_qctx = prepare_quant_context(pump_input, pump_output,
+                                              &qdnn_pump_model_meta);
+            infer_cache_init(&pump_cache);
+            pump_qctx_shared = pump_qctx;
+            __dmb();
+            pump_qctx_gen = pump_qctx_gen + 1;
+            model_shadow_clear();
+        } else if (model_shadow_take_dismiss()) {
+            LogInfo(("pump shadow: candidate dropped, live model untouched"));
+            model_shadow_clear();
+        }
+        if (model_bank_update_pending(MODEL_BANK_PUMP)) {
+            model_shadow_offer(model_bank_active(MODEL_BANK_PUMP));
+            model_bank_consume(MODEL_BANK_PUMP);
+        }
+#else
+        // Cycle boundary: swap in an uploaded pump model before this
+        // batch. Sub-ms replan; core 0 is still busy with the fan.
+        // Verified bind: a candidate whose plan does not fit re-binds
+        // the model that was just serving, so the interpreter reference
+        // below never dangles over an unbound slot.
+        if (model_bank_update_pending(MODEL_BANK_PUMP)) {
+            const unsigned char* prev_data = pump_slot.model_data;
+            int bind_rc = model_slot_bind_verified(
+                &pump_slot, model_bank_active(MODEL_BANK_PUMP), prev_data);
+            if (bind_rc < 0)  // last resort: the built-in always plans
+                bind_rc = model_slot_bind(&pump_slot, qdnn_pump_model);
+            if (bind_rc >= 0) {
+                pump_input = pump_interpreter.input(0);
+                pump_output = pump_interpreter.output(0);
+                pump_qctx = prepare_quant_context(pump_input, pump_output,
+                                                  &qdnn_pump_model_meta);
+                infer_cache_init(&pump_cache);
+                pump_qctx_shared = pump_qctx;
+                __dmb();
+                pump_qctx_gen = pump_qctx_gen + 1;
+            }
+            model_bank_consume(MODEL_BANK_PUMP);
+        }
+#endif
+#endif
+        // Rows were packed at the width core 0 last saw; a rebind that
+        // changed the input width under a batch in flight makes them
+        // unreadable at this model's stride, so fail the batch into the
+        // held-level path upstream (the next cycle repacks at the new
+        // width from the republished context).
+        const int n_in = pump_qctx.n_input;
+        if ((int)core1_ml_n != n_in) {
+            for (int z = 0; z < NUM_ZONES; z++) {
+                core1_pump_conf[z] = INT8_MIN;
+                core1_pump_margin[z] = INT8_MIN;
+            }
+            __dmb();
+            for (int z = 0; z < NUM_ZONES; z++)
+                multicore_fifo_push_blocking((uint32_t)(int32_t)-1);
+            continue;
+        }
+        if (scores != nullptr) {
+            // Debug builds keep the per-zone path: the batch API is
+            // logit-only (no score buffer to hand back per row).
+            for (int z = 0; z < NUM_ZONES; z++) {
+                int8_t conf = INT8_MIN, margin = INT8_MIN;
+                int level = run_model_safe(pump_interpreter, pump_input, pump_output, pump_qctx,
+                                           &core1_ml_input[z * n_in], n_in, &pump_cache, scores, 16,
+                                           nullptr, &conf, &margin,
+                                           zone_bias_row(z, pump_qctx.out_classes));
+                core1_pump_conf[z] = conf;
+                core1_pump_margin[z] = margin;
+                __dmb();  // conf lands before the level pops on core 0
+                multicore_fifo_push_blocking((uint32_t)(int32_t)level);
+            }
+        } else {
+            int levels[NUM_ZONES];
+            int8_t confs[NUM_ZONES], margins[NUM_ZONES];
+            for (int z = 0; z < NUM_ZONES; z++) {
+                confs[z] = INT8_MIN;
+                margins[z] = INT8_MIN;
+            }
+            // Rows stamped with the current generation skip the
+            // quantize pass entirely; a stale stamp (rebind above)
+            // falls back to the raw values.
+            const int8_t* rows_q = (core1_ml_q_gen == pump_qctx_gen &&
+                                    pump_qctx.in_type == kTfLiteInt8)
+                ? core1_ml_q : nullptr;
+            // Personalization deltas ride the batch as per-row bias
+            // rows (rows are zones); the base pointer is only handed
+            // over when some zone carries a live row the config's
+            // class count can cover.
+            const int8_t* zb = nullptr;
+            for (int z = 0; z < NUM_ZONES; z++)
+                if (zone_bias_row(z, pump_qctx.out_classes) != nullptr) {
+                    zb = config_get()->zone_bias[0];
+                    break;
+                }
+            uint32_t inv_t0 = time_us_32();
+            run_model_batch(pump_interpreter, pump_input, pump_output, pump_qctx,
+                            core1_ml_input, NUM_ZONES, n_in, &pump_cache, levels, rows_q,
+                            confs, margins, zb, CONFIG_ZONE_CLASSES);
+            uint32_t live_us = time_us_32() - inv_t0;
+            // First full zone batch (cold XIP) is this unit's baseline
+            device_baseline_note(BASE_PUMP_INVOKE_US, live_us);
+            for (int z = 0; z < NUM_ZONES; z++) {
+                core1_pump_conf[z] = confs[z];
+                core1_pump_margin[z] = margins[z];
+            }
+            __dmb();  // confs land before the levels pop on core 0
+            for (int z = 0; z < NUM_ZONES; z++)
+                multicore_fifo_push_blocking((uint32_t)(int32_t)levels[z]);
+#if QDNN_MODEL_SHADOW
+            // Actuation is already fed; the rest of this cycle is this
+            // core's spare headroom. Run the candidate over the same
+            // zone rows and score it against the live decisions. Two
+            // sub-ms replans bracket the eval instead of a second
+            // arena; they also reinit the cache each cycle, so the
+            // live batch above really invoked and live_us is a fair
+            // comparison, not a cache hit.
+            if (model_shadow_armed()) {
+                if (model_slot_bind(&pump_slot, model_shadow_data()) == 0) {
+                    TfLiteTensor* sh_input = pump_interpreter.input(0);
+                    TfLiteTensor* sh_output = pump_interpreter.output(0);
+                    QuantContext sh_qctx = prepare_quant_context(
+                        sh_input, sh_output, &qdnn_pump_model_meta);
+                    int sh_levels[NUM_ZONES];
+                    uint32_t sh_t0 = time_us_32();
+                    // A candidate with a different input width cannot
+                    // eat the live rows; score it as an error.
+                    // The candidate is scored under the same zone
+                    // deltas the live decisions ran with - a mismatch
+                    // must mean the models differ, not the biases.
+                    int rc = (sh_qctx.n_input == n_in)
+                        ? run_model_batch(pump_interpreter, sh_input, sh_output,
+                                          sh_qctx, core1_ml_input,
+                                          NUM_ZONES, n_in, nullptr, sh_levels,
+                                          nullptr, nullptr, nullptr,
+                                          (sh_qctx.out_classes <= CONFIG_ZONE_CLASSES)
+                                              ? zb : nullptr,
+                                          CONFIG_ZONE_CLASSES)
+                        : -1;
+                    if (rc == 0)
+                        model_shadow_note(levels, sh_levels, NUM_ZONES,
+                                          live_us, time_us_32() - sh_t0);
+                    else
+                        model_shadow_note_error();
+                } else {
+                    model_shadow_note_error();
+                }
+                // Back onto the live model before the next batch; if
+                // even that fails, the compiled-in flatbuffer is the
+                // one binding known to replan on this arena.
+                if (model_slot_bind(&pump_slot, live_data) != 0) {
+                    LogError(("pump shadow: live rebind failed, using built-in model"));
+                    live_data = qdnn_pump_model;
+                    model_slot_bind(&pump_slot, live_data);
+                }
+                pump_input = pump_interpreter.input(0);
+                pump_output = pump_interpreter.output(0);
+                pump_qctx = prepare_quant_context(pump_input, pump_output,
+                                                  &qdnn_pump_model_meta);
+                infer_cache_init(&pump_cache);
+                pump_qctx_shared = pump_qctx;
+                __dmb();
+                pump_qctx_gen = pump_qctx_gen + 1;
+            }
+#endif
+        }
+#if QDNN_GOLDEN_PROBE && !(QDNN_ARENA_AUDIT || QDNN_PROFILE_OPS)
+        // Same schedule as the fan probe, in this core's spare headroom
+        // after the batch is answered. The rebind republishes the
+        // context so core 0's quantize-once rows re-stamp next cycle.
+        {
+            static uint32_t s_probe_in = QDNN_GOLDEN_PERIOD_CYCLES;
+            if (--s_probe_in == 0) {
+                s_probe_in = QDNN_GOLDEN_PERIOD_CYCLES;
+                if (golden_probe_run("pump", pump_interpreter, pump_input,
+                                     pump_output, pump_qctx,
+                                     &qdnn_pump_model_meta) < 0 &&
+                    pump_slot.model_data != qdnn_pump_model &&
+                    model_slot_bind(&pump_slot, qdnn_pump_model) >= 0) {
+                    LogError(("pump golden probe: bank model demoted, built-in serving"));
+#if QDNN_MODEL_SHADOW
+                    live_data = qdnn_pump_model;
+#endif
+                    pump_input = pump_interpreter.input(0);
+                    pump_output = pump_interpreter.output(0);
+                    pump_qctx = prepare_quant_context(pump_input, pump_output,
+                                                      &qdnn_pump_model_meta);
+                    infer_cache_init(&pump_cache);
+                    pump_qctx_shared = pump_qctx;
+                    __dmb();
+                    pump_qctx_gen = pump_qctx_gen + 1;
+                }
+            }
+        }
+#endif
+#if QDNN_PROFILE_OPS
+        printf("--- pump per-op ticks ---\n");
+        pump_profiler.LogTicksPerTagCsv();
+        pump_profiler.ClearEvents();
+#endif
+    }
+}
+#endif  // !QDNN_COMBO_MODEL
+
+// =======================
+// FreeRTOS Task Pipeline
+// =======================
+
+// --- Frame antar-stage ---
+// Air readings are shared; soil and pump levels are per zone. Values
+// stay in the sensors' native 0.1-unit fixed point all the way to the
+// input tensor; floats only appear at the reporting edge.
+struct SensorFrame {
+    int16_t temp10;                 // 0.1 C
+    int16_t humid10;                // 0.1 %RH
+    int16_t soil_pct10[NUM_ZONES];  // 0.1 %
+    uint16_t soil_raw[NUM_ZONES];
+    // Time/trend features for the metadata-driven builder: computed
+    // once per acquisition from the history rings' running sums and
+    // the shell-set wall clock, so richer models cost the inference
+    // stage nothing beyond the row copy.
+    int16_t soil_slope10[NUM_ZONES];// 0.1 % per history window (regression)
+    int16_t hour10;                 // 0.1 h of day; 0 until "time" is set
+    uint8_t stale_mask;             // TELEMETRY_STALE_*: substituted features
+    uint8_t missed;                 // deadlines skipped before this acquisition
+    uint32_t t_ms;                  // acquisition time; ages the frame downstream
+    uint32_t cycle_seq;             // global cycle number, stamped at acquisition
+};
+
+struct ControlResult {
+    SensorFrame frame;
+    int fan_level;
+    int pump_level[NUM_ZONES];
+    int8_t fan_conf;              // winner's raw logit, model's own scale
+    int8_t pump_conf[NUM_ZONES];  // INT8_MIN when no invoke backs the level
+    int8_t fan_margin;              // top-2 raw-logit gap, 0..127
+    int8_t pump_margin[NUM_ZONES];  // INT8_MIN when no invoke backs the level
+};
+
+// --- Feature-vector builder ---
+// Input assembly used to hardcode the temp/humid/soil triple at every
+// call site; a model's row is now built from its metadata block, so a
+// retrained export that adds hour-of-day or a soil-moisture slope is a
+// data change, not a code audit. Source 0 resolves through the
+// positional convention (model_meta.h), which is also what a metadata-
+// less model (meta == nullptr: the combo export, a mismatched block)
+// gets; positions past the convention fill zero and rely on the boot
+// range audit to flag the misconfiguration.
+static const uint8_t kFeatByIndex[] = {
+    QDNN_FEAT_TEMP, QDNN_FEAT_HUMID, QDNN_FEAT_SOIL,
+    QDNN_FEAT_HOUR, QDNN_FEAT_SOIL_SLOPE,
+};
+
+static void build_feature_row(const SensorFrame* f, int z,
+                              const QdnnModelMeta* meta, int n_input,
+                              int16_t* row) {
+    for (int i = 0; i < n_input; i++) {
+        uint8_t src = (meta != nullptr && i < meta->input_count)
+                          ? meta->feature[i].source
+                          : (uint8_t)QDNN_FEAT_BY_INDEX;
+        if (src == QDNN_FEAT_BY_INDEX)
+            src = (i < (int)sizeof(kFeatByIndex)) ? kFeatByIndex[i] : 0;
+        int16_t v = 0;
+        switch (src) {
+            case QDNN_FEAT_TEMP:       v = f->temp10; break;
+            case QDNN_FEAT_HUMID:      v = f->humid10; break;
+            case QDNN_FEAT_SOIL:       v = f->soil_pct10[z]; break;
+            case QDNN_FEAT_HOUR:       v = f->hour10; break;
+            case QDNN_FEAT_SOIL_SLOPE: v = f->soil_slope10[z]; break;
+            default: break;  // unmapped source: zero, flagged at boot
+        }
+        row[i] = v;
+    }
+}
+
+#define SENSOR_QUEUE_LEN 2
+#define RESULT_QUEUE_LEN 2
+
+#if QDNN_SPSC_QUEUES
+// Hot handoffs on lock-free SPSC rings: the stage copy is tens of
+// cycles with no kernel critical section. FreeRTOS queues stay the
+// tool for anything control-plane / multi-client.
+static SpscQueue<SensorFrame, SENSOR_QUEUE_LEN> sensor_ring;    // sensing   -> inference
+static SpscQueue<ControlResult, RESULT_QUEUE_LEN> result_ring;  // inference -> actuation/report
+
+// Watermark hooks around the handoffs: depth after every deposit, age
+// at every consume. The push never drops (it blocks), so the rings
+// have no drop counter - latency growth is the failure mode here.
+static inline void pipeline_send_frame(const SensorFrame* f) {
+    sensor_ring.push(*f);
+    queue_stats_note_push(QSTAT_SENSOR, sensor_ring.tail - sensor_ring.head);
+}
+static inline void pipeline_recv_frame(SensorFrame* f) {
+    sensor_ring.pop(f);
+    queue_stats_note_pop_age(QSTAT_SENSOR, to_ms_since_boot(get_absolute_time()) - f->t_ms);
+}
+static inline void pipeline_send_result(const ControlResult* r) {
+    result_ring.push(*r);
+    queue_stats_note_push(QSTAT_RESULT, result_ring.tail - result_ring.head);
+}
+static inline void pipeline_recv_result(ControlResult* r) {
+    result_ring.pop(r);
+    queue_stats_note_pop_age(QSTAT_RESULT, to_ms_since_boot(get_absolute_time()) - r->frame.t_ms);
+}
+#else
+static QueueHandle_t sensor_queue;  // sensing   -> inference
+static QueueHandle_t result_queue;  // inference -> actuation/report
+
+static inline void pipeline_send_frame(const SensorFrame* f) {
+    xQueueSend(sensor_queue, f, portMAX_DELAY);
+    queue_stats_note_push(QSTAT_SENSOR, uxQueueMessagesWaiting(sensor_queue));
+}
+static inline void pipeline_recv_frame(SensorFrame* f) {
+    xQueueReceive(sensor_queue, f, portMAX_DELAY);
+    queue_stats_note_pop_age(QSTAT_SENSOR, to_ms_since_boot(get_absolute_time()) - f->t_ms);
+}
+static inline void pipeline_send_result(const ControlResult* r) {
+    xQueueSend(result_queue, r, portMAX_DELAY);
+    queue_stats_note_push(QSTAT_RESULT, uxQueueMessagesWaiting(result_queue));
+}
+static inline void pipeline_recv_result(ControlResult* r) {
+    xQueueReceive(result_queue, r, portMAX_DELAY);
+    queue_stats_note_pop_age(QSTAT_RESULT, to_ms_since_boot(get_absolute_time()) - r->frame.t_ms);
+}
+#endif
+
+#if QDNN_ANOMALY_MODEL
+// --- Second-stage anomaly detection (budget-gated free-rider) ---
+// The detector gets the latest zone-0 feature triplet through a
+// one-deep mailbox (xQueueOverwrite: a busy detector just sees the
+// newest sample) and hands scores back through its own small queue.
+// Control-plane traffic, so plain FreeRTOS queues either way.
+struct AnomalySample { int16_t v10[3]; uint32_t t_ms; };
+struct AnomalyScore  { uint16_t score_q8; };
+
+#define ANOMALY_QUEUE_LEN        1
+#define ANOMALY_RESULT_QUEUE_LEN 4
+
+static QueueHandle_t anomaly_queue;         // inference -> detector
+static QueueHandle_t anomaly_result_queue;  // detector  -> report
+
+// Warn threshold for the mean absolute reconstruction error, in
+// quantized LSBs x 256. Overridable per deployment from the build.
+#ifndef QDNN_ANOMALY_WARN_Q8
+#define QDNN_ANOMALY_WARN_Q8 (8 * 256)
+#endif
+#endif
+
+// --- Task priorities & stacks (stack depth in words) ---
+#define SENSOR_TASK_PRIO    (tskIDLE_PRIORITY + 2)
+#define INFER_TASK_PRIO     (tskIDLE_PRIORITY + 2)
+#define REPORT_TASK_PRIO    (tskIDLE_PRIORITY + 1)
+#define DRAIN_TASK_PRIO     (tskIDLE_PRIORITY + 0)
+// Monitor above every pipeline task: the table validation and the
+// hardware feed must stay schedulable even when a runaway pipeline
+// task is exactly what hung - then the starved victim's entry goes
+// stale and gets named, instead of the monitor being the one starved.
+#define WDGMON_TASK_PRIO    (tskIDLE_PRIORITY + 3)
+#define SENSOR_TASK_STACK   1024
+#define INFER_TASK_STACK    2048
+#define REPORT_TASK_STACK   1024
+#define DRAIN_TASK_STACK    512
+#define WDGMON_TASK_STACK   256
+#if QDNN_NET_UPLINK
+// Same floor as the drain task: the radio waits on everything else
+#define NET_TASK_PRIO       (tskIDLE_PRIORITY + 0)
+#define NET_TASK_STACK      1024
+#endif
+#if QDNN_ANOMALY_MODEL
+// Idle floor: the scheduler alone already guarantees the detector can
+// never push a pump decision past deadline; the budget gate on top
+// keeps it from eating the sleep window.
+#define ANOMALY_TASK_PRIO   (tskIDLE_PRIORITY + 0)
+#define ANOMALY_TASK_STACK  2048
+#endif
+
+#if QDNN_STATIC_ALLOC
+// --- Static allocation mode: semua objek RTOS dari .bss ---
+// Deterministic layout (visible in the map file) and nothing in the
+// steady state touches heap_4 or its critical section. The baselines
+// below back the post-init "heap untouched" assertion.
+#if !QDNN_SPSC_QUEUES
+static StaticQueue_t sensor_queue_cb, result_queue_cb;
+static uint8_t sensor_queue_storage[SENSOR_QUEUE_LEN * sizeof(SensorFrame)];
+static uint8_t result_queue_storage[RESULT_QUEUE_LEN * sizeof(ControlResult)];
+#endif
+#if QDNN_ANOMALY_MODEL
+static StaticQueue_t anomaly_queue_cb, anomaly_result_queue_cb;
+static uint8_t anomaly_queue_storage[ANOMALY_QUEUE_LEN * sizeof(AnomalySample)];
+static uint8_t anomaly_result_queue_storage[ANOMALY_RESULT_QUEUE_LEN * sizeof(AnomalyScore)];
+static StaticTask_t anomaly_tcb;
+static StackType_t anomaly_stack[ANOMALY_TASK_STACK];
+#endif
+static StaticTask_t sensor_tcb, infer_tcb, report_tcb, drain_tcb, wdgmon_tcb;
+static StackType_t sensor_stack[SENSOR_TASK_STACK];
+static StackType_t infer_stack[INFER_TASK_STACK];
+static StackType_t report_stack[REPORT_TASK_STACK];
+static StackType_t drain_stack[DRAIN_TASK_STACK];
+static StackType_t wdgmon_stack[WDGMON_TASK_STACK];
+#if QDNN_NET_UPLINK
+static StaticTask_t net_tcb;
+static StackType_t net_stack[NET_TASK_STACK];
+#endif
+static uint32_t s_heap_baseline_free;
+static uint32_t s_heap_baseline_min;
+#endif
+
+// --- Control cadence: satu siklus tiap CONTROL_PERIOD_MS, tanpa drift ---
+// Compile-time default only: the command shell can retune the period at
+// runtime ("period <ms>" on the console).
+#define CONTROL_PERIOD_MS 3000
+
+// Schedulability: the summed per-stage worst-case budgets declared in
+// cycle_timing.h must fit the period this build configures, so a new
+// stage (or a deadline bump) that no longer fits fails right here
+// instead of in a greenhouse. A runtime "period" retune below the sum
+// is still legal - the per-site over-budget counters in the timing
+// report carry that case.
+static_assert(timing_budget_total() <= (uint32_t)CONTROL_PERIOD_MS * 1000u,
+              "stage budgets exceed the control period");
+#if QDNN_ADAPTIVE_PERIOD
+static_assert(timing_budget_total() <= (uint32_t)QDNN_GOV_MIN_MS * 1000u,
+              "stage budgets exceed the governor's fast bound");
+#endif
+
+// --- Heap snapshot tiap N siklus (1 menit pada period 3 s) ---
+#define HEAP_STATS_PERIOD_CYCLES 20
+
+// --- DHT11 retry budget per cycle ---
+// A full transaction is ~30 ms, so two attempts with a short backoff
+// fit comfortably inside even an aggressively shortened period.
+#define DHT_RETRY_MAX        2
+#define DHT_RETRY_BACKOFF_MS 50
+
+// --- Cycle overrun policy ---
+// A cycle that blows past one or more deadlines (flash maintenance,
+// DHT retry storms) must neither bunch catch-up cycles back to back
+// nor vanish from the accounting - irrigation dosing cares about how
+// much wall time each decision actually covered. Skip (default) stays
+// on the absolute deadline grid and drops the missed slots; slip
+// restarts the cadence from the late wake, keeping the inter-cycle
+// spacing at the cost of grid phase. Either way every missed deadline
+// is counted by cause and reported downstream in the frame so the
+// dwell filters can credit the elapsed time.
+#ifndef QDNN_CYCLE_OVERRUN_SLIP
+#define QDNN_CYCLE_OVERRUN_SLIP 0
+#endif
+
+// --- Staleness policy ---
+// The cycle always runs on schedule: a feature whose sensor did not
+// deliver is substituted with its filtered last-good value and flagged
+// in the frame, so the actuation cadence is decoupled from the slowest
+// sensor. Past this age the substitution itself is suspect and gets a
+// one-shot warning (the flags keep shipping either way).
+#define STALE_AIR_MAX_MS 30000
+
+// Sensing-to-actuation staleness bound: a frame older than this when
+// it reaches the hardware means the pipeline is backed up, and the
+// pumps are acting on conditions that no longer hold. The defaults
+// absorb the legitimate delays each build carries - the pipelined
+// build holds every frame one full period by design - and the bound
+// is overridable from the build for deployments with tighter needs.
+#ifndef QDNN_STALE_ACT_MS
+#if QDNN_PIPELINE && QDNN_ADAPTIVE_PERIOD
+#define QDNN_STALE_ACT_MS (QDNN_GOV_MAX_MS + 2000)
+#elif QDNN_PIPELINE
+#define QDNN_STALE_ACT_MS (CONTROL_PERIOD_MS + 2000)
+#else
+#define QDNN_STALE_ACT_MS 2000
+#endif
+#endif
+
+#if QDNN_ACT_ALIGN
+// --- Two-phase actuation: commit at a cycle-aligned deadline ---
+// The dwell/dither pass stages this cycle's commands; the hardware
+// write then holds until the frame's acquisition stamp plus this
+// offset, so the actuators always move at the same instant of the
+// cycle no matter how long the DHT retries or the invokes took. A
+// frame already past its deadline commits immediately - late and
+// jittered beats later and aligned. The offset must cover the
+// pipeline's worst case (DHT retry ceiling plus both invoke
+// deadlines) or every cycle degenerates to the immediate path.
+#ifndef QDNN_ACT_ALIGN_MS
+#define QDNN_ACT_ALIGN_MS 700
+#endif
+static_assert(QDNN_ACT_ALIGN_MS < QDNN_STALE_ACT_MS,
+              "aligned commits would trip the staleness warning");
+#endif
+
+#if QDNN_BUS_SYNC
+// A stagger hold is bounded by one window; it must stay inside the
+// actuation staleness budget like the aligned-commit offset does.
+static_assert(QDNN_BUS_WINDOW_MS < QDNN_STALE_ACT_MS,
+              "a staggered commit would trip the staleness warning");
+#endif
+
+#if QDNN_DVFS
+// --- DVFS governor: clock tinggi hanya selama jendela kerja ---
+// The sensor task raises the clock at each cycle start (before the
+// DHT11 PIO capture, whose divider is computed at the active clock)
+// and the report task drops back to eco once actuation is out. The
+// ADC sampler runs off clk_adc at a fixed 48 MHz, so sample cadence
+// is untouched by the switches.
+#if QDNN_BOOST_CLOCK
+#define DVFS_ACTIVE_PROFILE PERF_PROFILE_BOOST
+#else
+#define DVFS_ACTIVE_PROFILE PERF_PROFILE_NORMAL
+#endif
+#endif
+
+#if QDNN_ENERGY_GOV
+// --- Energy budget governor: satu pemilik untuk anggaran daya ---
+// The budget machine (control_logic.h) steps on the scanner's averaged
+// VSYS reading once per cycle in the sensor task; the derates are read
+// wherever each power feature already makes its decision - the DVFS
+// work-window profile, the cadence floor below, the uplink flush
+// stretch. Thresholds default to a single-cell LiPo behind the VSYS
+// divider; 5 V installs override them from the build exactly like the
+// brownout watermark.
+#ifndef QDNN_ENERGY_SAVER_MV
+#define QDNN_ENERGY_SAVER_MV 3700
+#endif
+#ifndef QDNN_ENERGY_CRIT_MV
+#define QDNN_ENERGY_CRIT_MV  3450
+#endif
+#ifndef QDNN_ENERGY_HYST_MV
+#define QDNN_ENERGY_HYST_MV  100
+#endif
+// Coefficient model for the telemetry draw estimate: electronics rail
+// only (actuator draw is metered by the duty record). Defaults are
+// bench figures for this board at 125 MHz / deep sleep; calibrate per
+// hardware revision from the build.
+#ifndef QDNN_ENERGY_ACTIVE_MW
+#define QDNN_ENERGY_ACTIVE_MW 150
+#endif
+#ifndef QDNN_ENERGY_SLEEP_MW
+#define QDNN_ENERGY_SLEEP_MW  25
+#endif
+static EnergyGovernor s_energy_gov;
+// Cross-task snapshot: written by the sensor task's update, read by
+// the report task's telemetry pass. Plain word-sized fields, benign
+// mid-update reads, same as the other stat mirrors.
+static volatile uint16_t s_energy_vsys_mv;
+static volatile uint8_t  s_energy_state;
+static volatile uint8_t  s_energy_actions;
+static volatile uint16_t s_energy_transitions;
+#endif
+
+#if QDNN_THERMAL_GUARD
+// --- Thermal guard: boost hanya di dalam amplop suhu die ---
+// The guard machine (control_logic.h) steps on the scanner's averaged
+// internal-sensor reading once per cycle in the sensor task; the
+// verdict is read where the DVFS work-window profile is chosen, so a
+// hot die drops the cycle to 125 MHz and the enclosure sheds heat at
+// the lower dissipation. Defaults leave ~10 degC of margin to the
+// RP2040's 85 degC rating; a better-ventilated enclosure can raise
+// them from the build.
+#ifndef QDNN_THERMAL_DERATE_C10
+#define QDNN_THERMAL_DERATE_C10 750
+#endif
+#ifndef QDNN_THERMAL_HYST_C10
+#define QDNN_THERMAL_HYST_C10   50
+#endif
+static ThermalGuard s_thermal_guard;
+// Cross-task snapshot, same shape as the energy governor's mirrors.
+static volatile uint8_t  s_thermal_derated;
+static volatile uint32_t s_die_temp10;
+static volatile uint32_t s_thermal_derates;
+#endif
+
+#if QDNN_DVFS
+// Work-window profile after the energy budget's verdict: boost is the
+// first thing to go when the supply sags.
+static inline PerfProfile dvfs_active_profile(void) {
+#if QDNN_ENERGY_GOV
+    if (!energy_gov_allow_boost(s_energy_state)) return PERF_PROFILE_NORMAL;
+#endif
+#if QDNN_THERMAL_GUARD
+    if (s_thermal_derated) return PERF_PROFILE_NORMAL;
+#endif
+    return DVFS_ACTIVE_PROFILE;
+}
+
+// Profile switches as first-class timing events: every real edge runs
+// inside a TIMING_SCOPE, so the settle cost lands in the "pwr"
+// histogram and rides the flight recorder into frozen captures - a
+// slow cycle's trace shows exactly which clock edges it paid for. The
+// no-change case is filtered here, not left to perf_profile_apply's
+// early-out, so steady cycles never flood the trace ring with
+// zero-length events.
+static inline void dvfs_switch(PerfProfile want) {
+    if (perf_profile_get() == want) return;
+    TIMING_SCOPE(TIMING_SITE_PWR);
+    perf_profile_apply(want);
+}
+#endif
+
+#if QDNN_MODEL_PREFETCH
+// --- Prefetch bank model ke XIP cache sebelum invoke ---
+// Between cycles the 16 KB XIP cache refills with telemetry and driver
+// code, so the first invoke touches on the weight region are a
+// cold-miss burst paid inside the infer window. This stage streams the
+// active model ranges through the cached alias during the DHT capture
+// - the PIO is clocking the sensor out and the CPU would otherwise be
+// parked in 2 ms sleeps - so the flash fetches hide behind sensor
+// settle instead of stretching the invoke.
+#ifndef QDNN_PREFETCH_LINE
+#define QDNN_PREFETCH_LINE 8  // RP2040 XIP cache line, bytes
+#endif
+#ifndef QDNN_PREFETCH_CAP
+// Per-range budget. The flatbuffers are larger than the cache, so a
+// full pass would evict its own head (and the resident code lines)
+// before the invoke arrives; half the cache per model keeps the two
+// ranges' leading regions - schema, tensor tables, first weight rows,
+// which the interpreter walks front-to-back - warm together.
+#define QDNN_PREFETCH_CAP 8192
+#endif
+
+static void model_prefetch_range(const uint8_t* data, uint32_t len) {
+    if (data == NULL || len == 0) return;
+    uintptr_t p = (uintptr_t)data;
+    if (p < XIP_BASE || p >= XIP_NOALLOC_BASE) return;  // RAM copy: no misses to hide
+    if (len > QDNN_PREFETCH_CAP) len = QDNN_PREFETCH_CAP;
+    // One read per cache line fills the whole line; the volatile sink
+    // keeps the loop from folding away.
+    volatile uint32_t sink = 0;
+    for (uint32_t off = 0; off < len; off += QDNN_PREFETCH_LINE)
+        sink += data[off];
+    (void)sink;
+}
+
+// Same pointer selection as the bind sites: the active bank when one
+// is serving, the compiled-in flatbuffer otherwise.
+static void model_prefetch_active(void) {
+#if QDNN_COMBO_MODEL
+    model_prefetch_range(qdnn_combo_model, qdnn_combo_model_len);
+#else
+    const uint8_t* fan = qdnn_fan_model;
+    uint32_t fan_len = qdnn_fan_model_len;
+    const uint8_t* pump = qdnn_pump_model;
+    uint32_t pump_len = qdnn_pump_model_len;
+#if QDNN_MODEL_BANK
+    if (model_bank_active(MODEL_BANK_FAN) != NULL) {
+        fan = model_bank_active(MODEL_BANK_FAN);
+        fan_len = model_bank_active_len(MODEL_BANK_FAN);
+    }
+    if (model_bank_active(MODEL_BANK_PUMP) != NULL) {
+        pump = model_bank_active(MODEL_BANK_PUMP);
+        pump_len = model_bank_active_len(MODEL_BANK_PUMP);
+    }
+#endif
+    model_prefetch_range(fan, fan_len);
+    model_prefetch_range(pump, pump_len);
+#endif
+}
+#endif
+
+#if QDNN_WATCH_CHANNEL
+// --- Advisory watches over the published signals ---
+// Site-condition diagnostics as watch subscriptions rather than
+// inline threshold checks in the sensor task: one warning on entry
+// into the region, re-armed through each watch's own hysteresis.
+// Thresholds are deployment-specific and overridable from the build,
+// like the energy bands above.
+#ifndef QDNN_WATCH_TEMP_HI_10
+#define QDNN_WATCH_TEMP_HI_10 450  // deci-degC: canopy heat stress
+#endif
+#ifndef QDNN_WATCH_VSYS_LO_MV
+#define QDNN_WATCH_VSYS_LO_MV 3600  // early supply-sag advisory
+#endif
+
+static void watch_log_cb(int watch, int32_t value, void* arg) {
+    LogWarn(("watch %d: %s (%ld)", watch, (const char*)arg, (long)value));
+}
+#endif
+
+// --- Out-of-band soil watermarks ---
+// A burst line saturates a probe within seconds while the polled
+// cadence would sleep through most of it. The ADC sampler's sweep IRQ
+// evaluates calibration-derived watermarks with hysteresis and this
+// callback yanks the sensor task out of its deadline sleep.
+static TaskHandle_t s_sensor_task_handle;
+static volatile uint32_t s_soil_alert_count;
+
+static void soil_alert_isr(int channel, uint16_t avg, bool high) {
+    (void)channel; (void)avg; (void)high;
+    s_soil_alert_count = s_soil_alert_count + 1;
+    if (s_sensor_task_handle != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(s_sensor_task_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+// --- Task: baca DHT11 + soil, kirim frame ke inference ---
+static void sensor_task(void*) {
+    int temp10=0, humid10=0;
+
+    // Per-signal history rings (.bss): the model inputs are drawn from
+    // the EMA view instead of the raw sample, so a single noisy DHT11
+    // or soil reading decays over cycles instead of landing on the
+    // interpreter directly. Also the source for trend features.
+    static SensorHistory temp_hist, humid_hist, soil_hist[NUM_ZONES];
+    // Despike stage on the raw soil path: pump inrush on the shared
+    // supply spikes single ADC sweeps, and the sampler's mean averages
+    // the spike in. The median rejects it before conversion.
+    static MedianFilter soil_median[NUM_ZONES];
+    // Fusion cross-check: per-zone humidity/soil co-movement score over
+    // the EMA streams. Feeds the self-test divergence check and weights
+    // how long a substituted air value stays trusted.
+    static FusionScore soil_fusion[NUM_ZONES];
+    history_init(&temp_hist);
+    history_init(&humid_hist);
+    for (int z = 0; z < NUM_ZONES; z++) {
+        history_init(&soil_hist[z]);
+        median_init(&soil_median[z]);
+        fusion_init(&soil_fusion[z]);
+    }
+
+    // Warm start: refill the filter windows from the checkpoint the
+    // previous boot left in retained RAM - the first decision after a
+    // watchdog reset runs on full windows instead of a minute of
+    // half-filled EMA ramp-up. Cold boots (or a layout change) fail
+    // the restore and keep the fresh init above.
+    struct SensorWarm {
+        SensorHistory temp, humid, soil[NUM_ZONES];
+        MedianFilter median[NUM_ZONES];
+    } warm;
+    if (warm_state_restore(WARM_SLOT_SENSOR, &warm, sizeof(warm))) {
+        temp_hist = warm.temp;
+        humid_hist = warm.humid;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            soil_hist[z] = warm.soil[z];
+            soil_median[z] = warm.median[z];
+        }
+        LogInfo(("warm start: sensor filter state restored"));
+    }
+
+#if QDNN_STATE_GUARD
+    // Integrity guard over the filter state: sealed at the end of each
+    // body after the pushes, verified at the top before the reads. The
+    // statics are task-local, so these are owner-checked blocks - the
+    // re-init on a trip happens here, not in a callback.
+    int sg_rings[4];
+    sg_rings[0] = state_guard_register("thist", &temp_hist,
+                                       sizeof(temp_hist), NULL, false);
+    sg_rings[1] = state_guard_register("hhist", &humid_hist,
+                                       sizeof(humid_hist), NULL, false);
+    sg_rings[2] = state_guard_register("shist", soil_hist,
+                                       sizeof(soil_hist), NULL, false);
+    sg_rings[3] = state_guard_register("smed", soil_median,
+                                       sizeof(soil_median), NULL, false);
+#endif
+
+#if QDNN_ADAPTIVE_PERIOD
+    // Sampling governor: fast while any signal is moving, creeping
+    // toward the slow bound while everything is flat. The slow bound
+    // must stay under WDG_STAGE_STALE_MS or a quiet night would read
+    // as a hung sensor stage.
+    static SampleGovernor governor;
+    governor_init(&governor, QDNN_GOV_MIN_MS, QDNN_GOV_MAX_MS);
+    static_assert(QDNN_GOV_MAX_MS < WDG_STAGE_STALE_MS,
+                  "governor slow bound would trip the stage watchdog");
+#endif
+
+#if QDNN_ENERGY_GOV
+    energy_gov_init(&s_energy_gov, QDNN_ENERGY_SAVER_MV, QDNN_ENERGY_CRIT_MV,
+                    QDNN_ENERGY_HYST_MV);
+#endif
+
+#if QDNN_THERMAL_GUARD
+    thermal_guard_init(&s_thermal_guard, QDNN_THERMAL_DERATE_C10,
+                       QDNN_THERMAL_HYST_C10);
+#endif
+
+    // The 1 s sensor stabilization runs here, in parallel with tensor
+    // allocation in the inference task and on core 1 - not before the
+    // scheduler starts.
+#if QDNN_DVFS
+    // PIO capture divider is derived from clk_sys at init; initialize
+    // at the active clock, which is also the only clock DHT reads see.
+    perf_profile_apply(dvfs_active_profile());
+#endif
+    air_sensor_init(DHT_PIN);
+
+#if QDNN_PIPELINE
+    // Pipelined mode: the frame published at each period boundary was
+    // acquired during the previous cycle's inference window, so the
+    // DHT capture and ADC settle overlap model compute entirely and
+    // the critical path per cycle is max(acquire, infer), not the sum.
+    // Cost: inputs are one period older when they reach the tensors.
+    SensorFrame pending;
+    bool have_pending = false;
+#endif
+
+    TickType_t last_wake = xTaskGetTickCount();
+    // Overrun attribution state, filled in by each body for the next
+    // boundary's verdict: did the DHT path retry or fail, and when did
+    // this body start (to window the flash maintenance check).
+    bool dht_struggled = false;
+    uint32_t body_t0_ms = to_ms_since_boot(get_absolute_time());
+    while(true){
+        // Deadline-based: period measured from the previous deadline, so
+        // sensing/inference time no longer stretches the cycle. The
+        // sleep is a notification wait with the deadline as timeout so
+        // an out-of-band soil alert (ADC watermark IRQ) can cut it
+        // short - sub-100 ms reaction to a burst line instead of
+        // waiting out the period. A spurious give (e.g. the SPSC
+        // full-ring handshake shares the notification slot) just runs
+        // one harmless early cycle.
+#if QDNN_ADAPTIVE_PERIOD
+        // Governed cadence: the shell's fixed period gives way to the
+        // activity-driven one (bounds set at configure time).
+        TickType_t period = pdMS_TO_TICKS(governor.period_ms);
+#else
+        TickType_t period = pdMS_TO_TICKS(cmd_shell_period_ms());
+#endif
+#if QDNN_ENERGY_GOV
+        // Budget floor under the cadence: the activity snap still works
+        // inside whatever room the energy state leaves.
+        {
+#if QDNN_ADAPTIVE_PERIOD
+            uint32_t efloor = energy_gov_period_floor_ms(
+                s_energy_state, QDNN_GOV_MIN_MS, QDNN_GOV_MAX_MS);
+#else
+            // Fixed-cadence bounds: up to 4x the shell period, clamped
+            // under the stage watchdog like the adaptive slow bound.
+            uint32_t ebase = cmd_shell_period_ms();
+            uint32_t emax = ebase * 4;
+            if (emax > WDG_STAGE_STALE_MS - 1000) emax = WDG_STAGE_STALE_MS - 1000;
+            if (emax < ebase) emax = ebase;
+            uint32_t efloor = energy_gov_period_floor_ms(s_energy_state, ebase, emax);
+#endif
+            if (period < pdMS_TO_TICKS(efloor)) period = pdMS_TO_TICKS(efloor);
+        }
+#endif
+        // Overrun verdict on the previous body: whole deadlines blown
+        // are counted per cause (flash window in the last body beats a
+        // struggling sensor as the explanation - an erase stalls both
+        // cores) and the policy above decides where the cadence lands.
+        uint32_t missed_now = 0;
+        {
+            int32_t late = (int32_t)(xTaskGetTickCount() - last_wake);
+            if (late >= (int32_t)period) {
+                missed_now = (uint32_t)late / (uint32_t)period;
+                int cause = ERR_SKIP_OTHER;
+                if (flash_maint_last_run_ms() >= body_t0_ms) cause = ERR_SKIP_FLASH;
+                else if (dht_struggled) cause = ERR_SKIP_SENSOR;
+                for (uint32_t i = 0; i < missed_now; i++) err_stats_bump(cause);
+#if QDNN_TRACE_RING
+                // Freeze the flight recorder on the spot: the ring now
+                // holds the scopes of the cycle that blew the deadline.
+                trace_ring_freeze(TRACE_FREEZE_OVERRUN);
+#endif
+                if (err_stats_detail_allowed(cause))
+                    LogWarn(("cycle overrun: %u deadline(s) skipped (%s)",
+                             (unsigned)missed_now, err_stats_site_name(cause)));
+#if QDNN_CYCLE_OVERRUN_SLIP
+                last_wake = xTaskGetTickCount();   // slip: full spacing, grid lost
+#else
+                last_wake += missed_now * period;  // skip: hold the deadline grid
+#endif
+            }
+        }
+        TickType_t remain = last_wake + period - xTaskGetTickCount();
+        if (remain > period) remain = 0;  // deadline already passed (wrap-safe)
+        if (ulTaskNotifyTake(pdTRUE, remain) != 0) {
+            // Emergency cycle: restart the cadence from here so the
+            // follow-up sample also comes a full period later.
+            last_wake = xTaskGetTickCount();
+#if QDNN_ADAPTIVE_PERIOD
+            governor_snap(&governor);  // ride out the burst at full rate
+#endif
+            LogWarn(("soil alert: out-of-band cycle (%u alerts since boot)",
+                     (unsigned)s_soil_alert_count));
+        } else {
+            last_wake += period;
+        }
+        body_t0_ms = to_ms_since_boot(get_absolute_time());
+
+#if QDNN_STATE_GUARD
+        // Verify the rings before this cycle reads them. Any trip
+        // restarts all four blocks: corruption is rare enough that
+        // fine-grained salvage is not worth carrying, and a cold
+        // window costs one EMA ramp, not days of poisoned sums.
+        {
+            bool ok = true;
+            for (int i = 0; i < 4; i++) ok &= state_guard_check(sg_rings[i]);
+            if (!ok) {
+                history_init(&temp_hist);
+                history_init(&humid_hist);
+                for (int z = 0; z < NUM_ZONES; z++) {
+                    history_init(&soil_hist[z]);
+                    median_init(&soil_median[z]);
+                    // The fusion deltas come off the re-initialized
+                    // rings; stale prevs would fake one giant move.
+                    fusion_init(&soil_fusion[z]);
+                }
+                for (int i = 0; i < 4; i++) state_guard_seal(sg_rings[i]);
+            }
+        }
+#endif
+
+#if QDNN_DVFS
+        // Work window opens: full clock for decode + the two invokes
+        dvfs_switch(dvfs_active_profile());
+#endif
+
+#if QDNN_PIPELINE
+        // Publish last cycle's acquisition first: inference starts
+        // immediately, and the acquisition below runs in its shadow
+        // (the inference task preempts this one only between reads).
+        if (have_pending) pipeline_send_frame(&pending);
+#endif
+
+        // Kick the DHT transaction asynchronously, then sample soil
+        // while the sensor clocks out its frame: the 20 ms start signal
+        // and the transfer overlap the ADC work instead of preceding it.
+        uint32_t dht_t0 = time_us_32();
+        air_sensor_begin(DHT_PIN);
+
+        SensorFrame frame;
+        frame.t_ms = to_ms_since_boot(get_absolute_time());
+        // Global cycle number, stamped once at acquisition and carried
+        // through every queue: with pipelining in play, this is the
+        // only unambiguous link from an actuation back to its sample.
+        static uint32_t s_cycle_seq = 0;
+        frame.cycle_seq = ++s_cycle_seq;
+        // Dose compensation rides the frame: downstream sees how many
+        // deadlines this decision is standing in for
+        frame.missed = (uint8_t)(missed_now > 255 ? 255 : missed_now);
+        // Snapshot under the calibration lock: a concurrent "cal" can
+        // never hand this zone loop one new and one old endpoint.
+        SoilCalib cal_snap;
+        calib_snapshot(&cal_snap);
+        const SoilCalib* cal = &cal_snap;
+        {
+            TIMING_SCOPE(TIMING_SITE_SOIL);
+            for (int z = 0; z < NUM_ZONES; z++) {
+#if QDNN_SOIL_AC
+                // AC excitation: one ~0.7 ms burst per zone, amplitude
+                // on the same 0..4095 scale the calibration expects
+                uint16_t raw = soil_ac_sample(z);
+#else
+                uint16_t raw = soil_adc_read_avg(z);
+#endif
+#if QDNN_SENSOR_EMUL
+                // Replay scenario armed: substitute the sample, keep
+                // the sampler running so its timing stays realistic
+                raw = sensor_emul_soil(z, raw);
+#endif
+                frame.soil_raw[z] = median_push(&soil_median[z], raw);
+                int p10 = adc_to_percent10_cal(frame.soil_raw[z], cal->dry_raw, cal->wet_raw);
+                history_push(&soil_hist[z], (int16_t)p10);
+                frame.soil_pct10[z] = history_ema(&soil_hist[z]);
+                // Rail-pinned readings (open probe / short) go into the
+                // fleet counters; the self-test tracks the pattern.
+                if (frame.soil_raw[z] <= 8 || frame.soil_raw[z] >= 4087)
+                    err_stats_bump(ERR_ADC_RANGE);
+                self_test_feed_soil(z, frame.soil_raw[z]);
+            }
+        }
+
+#if QDNN_MODEL_PREFETCH
+        // The DHT transaction is still clocking out on the PIO: spend
+        // the wait warming the model ranges so the invoke this frame
+        // feeds does not open on a cold-miss burst.
+        model_prefetch_active();
+#endif
+
+        // Bounded retry with a short backoff: a flaky DHT11 gets
+        // DHT_RETRY_MAX attempts inside this cycle, and however they
+        // end the soil channels above have already been served.
+        int status = AIR_READ_ERROR;
+        int dht_attempts = 0;
+        {
+            // Timed as the residual wait: the soil sweep above already
+            // absorbed part of the transaction
+            TIMING_SCOPE(TIMING_SITE_DHT);
+            while (dht_attempts < DHT_RETRY_MAX) {
+                status = air_sensor_poll(&temp10, &humid10);
+#if QDNN_SENSOR_EMUL
+                // Completed polls go through the replay filter; an
+                // injected fault drives the real retry/backoff path
+                status = sensor_emul_air(&temp10, &humid10, status);
+#endif
+                if (status == AIR_READ_PENDING) {
+                    vTaskDelay(pdMS_TO_TICKS(2));  // transaction in flight
+                    continue;
+                }
+                if (status == 0) break;
+                if (++dht_attempts < DHT_RETRY_MAX) {
+                    vTaskDelay(pdMS_TO_TICKS(DHT_RETRY_BACKOFF_MS));
+                    air_sensor_begin(DHT_PIN);
+                }
+            }
+        }
+        // Overrun attribution for the next boundary: retries and
+        // failures are the sensor path's slow cases
+        dht_struggled = (status != 0) || dht_attempts > 0;
+        // Baseline unit: round trip DHT pertama yang sukses (termasuk
+        // retry) - sensor marginal kelihatan dari sini
+        if (status == 0)
+            device_baseline_note(BASE_DHT_READ_US, time_us_32() - dht_t0);
+
+        // Per-feature staleness: both air features ride one sensor, so
+        // they share a freshness timestamp; the soil channels come from
+        // the free-running DMA sampler and are fresh by construction.
+        static TickType_t air_last_fresh = 0;
+        static bool air_stale_warned = false;
+
+        bool air_ok = (status == 0 && humid10 >= 0 && humid10 <= 1000);
+        self_test_feed_dht(air_ok);
+        frame.stale_mask = 0;
+        if (air_ok) {
+            gpio_put(LED_DHT_ERROR,0);
+            // Push 0.1-unit integer samples; the frame carries the EMA view
+            history_push(&temp_hist, (int16_t)temp10);
+            history_push(&humid_hist, (int16_t)humid10);
+            air_last_fresh = xTaskGetTickCount();
+            air_stale_warned = false;
+        } else {
+            // Air fault: the irrigation decision only needs the soil
+            // channels, so the cycle proceeds on the filtered history
+            // instead of freezing pump control on a humidity hiccup.
+            // The frame is flagged so the host knows these values are
+            // substitutes, not samples.
+            gpio_put(LED_DHT_ERROR,1);
+            frame.stale_mask |= TELEMETRY_STALE_TEMP | TELEMETRY_STALE_HUMID;
+            TickType_t age = xTaskGetTickCount() - air_last_fresh;
+            // Reliability-weighted bound: a zone whose soil was tracking
+            // humidity right up to the outage corroborates the substitute,
+            // so full fusion trust keeps the full window and zero trust
+            // halves it. Best zone wins - one live cross-check is enough.
+            int fw = 0;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                int w = fusion_weight_q8(soil_fusion[z].score);
+                if (w > fw) fw = w;
+            }
+            uint32_t bound_ms = stale_air_bound_ms(STALE_AIR_MAX_MS, fw);
+            if (!air_stale_warned && age > pdMS_TO_TICKS(bound_ms)) {
+                LogWarn(("air features stale beyond %u ms (fusion %d/256), "
+                         "still substituting", (unsigned)bound_ms, fw));
+                air_stale_warned = true;
+            }
+        }
+
+        if (temp_hist.count == 0) {
+            // Never had air data: nothing sane to feed the fan model.
+            // Refresh all heartbeats so a dead-at-boot DHT alone can't
+            // trip the watchdog while soil hardware is still fine.
+            watchdog_stage_checkin_all();
+#if QDNN_DVFS
+            dvfs_switch(PERF_PROFILE_ECO);  // no work this cycle
+#endif
+#if QDNN_PIPELINE
+            have_pending = false;  // nothing fresh for the next boundary
+#endif
+#if QDNN_STATE_GUARD
+            // The soil pushes above still landed; seal before bailing
+            // or the next top-of-body check reads a stale sum as a trip.
+            for (int i = 0; i < 4; i++) state_guard_seal(sg_rings[i]);
+#endif
+            continue;
+        }
+        watchdog_stage_checkin(WDG_STAGE_SENSOR);
+
+        frame.temp10 = history_ema(&temp_hist);
+        frame.humid10 = history_ema(&humid_hist);
+
+        // Time/trend features for the metadata-driven builder: the
+        // slope falls out of each soil ring's running regression sums
+        // (O(1) per query), the hour out of the shell-set wall clock.
+        // Models that don't name these features never read them.
+        for (int z = 0; z < NUM_ZONES; z++)
+            frame.soil_slope10[z] = history_slope10(&soil_hist[z]);
+
+        // Fusion step: fold this cycle's EMA pair into each zone's
+        // cross-consistency score and hand the diagnostics engine its
+        // copy. Only fresh humidity carries evidence - a substituted
+        // value is the EMA talking to itself.
+        for (int z = 0; z < NUM_ZONES; z++) {
+            int sc = air_ok
+                ? fusion_update(&soil_fusion[z], frame.humid10, frame.soil_pct10[z])
+                : soil_fusion[z].score;
+            self_test_feed_fusion(z, sc);
+        }
+        {
+            // Seconds-of-day via one divider launch (the day quotient
+            // rides along free), then the deci-hour scale.
+            uint32_t day, sec;
+            divmod_u32(telemetry_wallclock_s(), 86400u, &day, &sec);
+            (void)day;
+            frame.hour10 = (int16_t)(sec / 360u);
+        }
+
+#if QDNN_WATCH_CHANNEL
+        // One publication per filtered signal per cycle: every
+        // registered threshold subscription on a signal is evaluated
+        // in this single pass instead of each consumer rescanning the
+        // history rings on its own.
+        watch_update(WATCH_SIG_TEMP10, frame.temp10);
+        watch_update(WATCH_SIG_HUMID10, frame.humid10);
+        for (int z = 0; z < NUM_ZONES; z++)
+            watch_update((uint8_t)(WATCH_SIG_SOIL0 + z), frame.soil_pct10[z]);
+#endif
+
+#if QDNN_ADAPTIVE_PERIOD
+        // Feed the governor this cycle's activity: window span per
+        // signal, worst zone for soil. Decides the next deadline.
+        {
+            int16_t mn, mx, span[3];
+            history_minmax(&temp_hist, &mn, &mx);
+            span[0] = (int16_t)(mx - mn);
+            history_minmax(&humid_hist, &mn, &mx);
+            span[1] = (int16_t)(mx - mn);
+            span[2] = 0;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                history_minmax(&soil_hist[z], &mn, &mx);
+                if ((int16_t)(mx - mn) > span[2]) span[2] = (int16_t)(mx - mn);
+            }
+            governor_update(&governor, span);
+        }
+#endif
+#if QDNN_ENERGY_GOV
+        // Energy budget step on the scanner's averaged VSYS (ADC3 reads
+        // VSYS/3 against the 3.3 V reference: mv = raw * 9900/4096).
+        // The verdict lands in the snapshot statics the derate sites
+        // and the report task's telemetry pass read.
+        {
+            uint16_t mv = (uint16_t)((uint32_t)soil_adc_read_vsys_raw() * 9900u / 4096u);
+            int est = energy_gov_update(&s_energy_gov, mv);
+            uint8_t actions = 0;
+#if QDNN_DVFS && QDNN_BOOST_CLOCK
+            if (!energy_gov_allow_boost(est)) actions |= TELEMETRY_ENERGY_NO_BOOST;
+#endif
+            if (est != ENERGY_STATE_OK) actions |= TELEMETRY_ENERGY_CADENCE;
+#if QDNN_PICO_W
+            if (est != ENERGY_STATE_OK) actions |= TELEMETRY_ENERGY_UPLINK;
+            net_uplink_set_flush_scale((uint8_t)energy_gov_uplink_scale(est));
+#endif
+            s_energy_vsys_mv = mv;
+            s_energy_state = (uint8_t)est;
+            s_energy_actions = actions;
+            s_energy_transitions = s_energy_gov.transitions;
+#if QDNN_WATCH_CHANNEL
+            watch_update(WATCH_SIG_VSYS_MV, mv);
+#endif
+        }
+#endif
+#if QDNN_THERMAL_GUARD
+        // Thermal guard step on the scanner's averaged internal sensor
+        // (ADC4). Edges are worth a log line each: a derate in the
+        // field is exactly the event the guard exists to prove out.
+        {
+            int32_t die10 = adc_to_die_temp10(soil_adc_read_temp_raw());
+            bool was = s_thermal_guard.derated != 0;
+            bool boost_ok = thermal_guard_update(&s_thermal_guard, die10);
+            if (!boost_ok && !was)
+                LogWarn(("thermal: die %ld.%ld C, boost withdrawn",
+                         (long)(die10 / 10), (long)(die10 % 10)));
+            else if (boost_ok && was)
+                LogInfo(("thermal: die %ld.%ld C, boost restored",
+                         (long)(die10 / 10), (long)(die10 % 10)));
+            s_thermal_derated = (uint8_t)!boost_ok;
+            s_die_temp10 = (uint32_t)die10;
+            s_thermal_derates = s_thermal_guard.derates;
+        }
+#endif
+        // First complete acquisition (includes the DHT stabilization
+        // remainder) closes the sensor leg of the boot waterfall.
+        static bool s_first_frame = true;
+        if (s_first_frame) {
+            boot_stages_mark("dht");
+            s_first_frame = false;
+        }
+#if QDNN_PIPELINE
+        // Hold this frame as the next boundary's publication; the queue
+        // copy plus this slot are the two buffers of the pipeline.
+        pending = frame;
+        have_pending = true;
+#else
+        pipeline_send_frame(&frame);
+#endif
+
+        // Checkpoint the filled windows for the next boot's warm start
+        warm.temp = temp_hist;
+        warm.humid = humid_hist;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            warm.soil[z] = soil_hist[z];
+            warm.median[z] = soil_median[z];
+        }
+        warm_state_save(WARM_SLOT_SENSOR, &warm, sizeof(warm));
+#if QDNN_STATE_GUARD
+        // Writes for this cycle are done; seal what the next top-of-
+        // body check verifies.
+        for (int i = 0; i < 4; i++) state_guard_seal(sg_rings[i]);
+#endif
+    }
+}
+
+#if QDNN_ANOMALY_MODEL
+// Dispatch gate: hand the detector a sample only when the measured
+// hot-path spend plus the detector's own measured worst case fits the
+// cycle budget with a 20% guard band. Without the timing build the
+// idle priority floor alone protects the deadline, so every changed
+// cycle dispatches.
+static bool anomaly_budget_ok(void) {
+#if QDNN_CYCLE_TIMING
+    uint32_t spent_us = 0;
+    for (int s = 0; s < TIMING_SITE_COUNT; s++) {
+        if (s == TIMING_SITE_ANOM) continue;
+        spent_us += cycle_timing_get(s)->max_us;
+    }
+    const TimingHist* a = cycle_timing_get(TIMING_SITE_ANOM);
+    uint32_t need_us = a->count ? a->max_us : 5000;  // unmeasured: assume 5 ms
+    uint64_t budget_us = (uint64_t)cmd_shell_period_ms() * 1000u;
+    return spent_us + need_us < budget_us - budget_us / 5;
+#else
+    return true;
+#endif
+}
+
+static void anomaly_dispatch(const int16_t v10[3]) {
+    AnomalySample s;
+    for (int i = 0; i < 3; i++) s.v10[i] = v10[i];
+    s.t_ms = to_ms_since_boot(get_absolute_time());
+    if (anomaly_budget_ok()) {
+        xQueueOverwrite(anomaly_queue, &s);
+        queue_stats_note_push(QSTAT_ANOM, uxQueueMessagesWaiting(anomaly_queue));
+    }
+}
+
+// --- Task: autoencoder anomaly scoring over the recent feature window ---
+// Free-rides on idle budget: sits at the idle priority floor, wakes
+// only when the inference task dispatches a sample, and scores once
+// its sliding window (k triplets, k from the model's input shape) is
+// full. The score is the mean absolute reconstruction error in
+// quantized LSBs; report consumes it from the result queue.
+static void anomaly_task(void*) {
+    const tflite::Model* anom_model = tflite::GetModel(qdnn_anomaly_model);
+    QdnnOpResolver anom_resolver;
+    qdnn_register_ops(anom_resolver);
+    tflite::MicroInterpreter anom_interpreter(anom_model, anom_resolver,
+                                              anomaly_arena, kAnomalyArenaSize);
+    if (anom_interpreter.AllocateTensors() != kTfLiteOk) {
+        LogError(("anomaly model: AllocateTensors failed, detector off"));
+        vTaskDelete(NULL);
+    }
+    TfLiteTensor* anom_input  = anom_interpreter.input(0);
+    TfLiteTensor* anom_output = anom_interpreter.output(0);
+    QuantContext anom_qctx = prepare_quant_context(anom_input, anom_output);
+    const int n_in = anom_input->dims->data[anom_input->dims->size - 1];
+    if (anom_input->type != kTfLiteInt8 || anom_output->type != kTfLiteInt8 ||
+        n_in % 3 != 0 || n_in > 96 ||
+        anom_output->dims->data[anom_output->dims->size - 1] != n_in) {
+        LogError(("anomaly model: expected int8 autoencoder over 3k inputs, detector off"));
+        vTaskDelete(NULL);
+    }
+    const int k = n_in / 3;
+
+    // Window lives outside the tensor: the non-persistent input buffer
+    // is invoke scratch and does not survive between runs.
+    static int8_t window[96];
+    int filled = 0;
+
+    AnomalySample s;
+    while (true) {
+        xQueueReceive(anomaly_queue, &s, portMAX_DELAY);
+        queue_stats_note_pop_age(QSTAT_ANOM, to_ms_since_boot(get_absolute_time()) - s.t_ms);
+
+        if (filled == k) memmove(window, window + 3, (size_t)(n_in - 3));
+        else filled++;
+        int8_t* dst = window + (filled - 1) * 3;
+        for (int i = 0; i < 3; i++)
+            dst[i] = (int8_t)quantize_value10(s.v10[i], anom_qctx, i);
+        if (filled < k) continue;
+
+        uint32_t err_sum;
+        {
+            TIMING_SCOPE(TIMING_SITE_ANOM);
+            memcpy(anom_input->data.int8, window, (size_t)n_in);
+            // Unguarded by design: the deadline alarm is per core and
+            // belongs to the inference task; a slow anomaly pass only
+            // delays a score, never actuation.
+            if (anom_interpreter.Invoke() != kTfLiteOk) {
+                err_stats_bump(ERR_INVOKE);
+                if (err_stats_detail_allowed(ERR_INVOKE))
+                    LogError(("anomaly Invoke failed"));
+                continue;
+            }
+            err_sum = 0;
+            for (int i = 0; i < n_in; i++) {
+                int d = (int)anom_output->data.int8[i] - (int)window[i];
+                err_sum += (uint32_t)(d < 0 ? -d : d);
+            }
+        }
+
+        uint32_t score = err_sum * 256u / (uint32_t)n_in;
+        AnomalyScore r = { (uint16_t)(score > 0xFFFF ? 0xFFFF : score) };
+        if (xQueueSend(anomaly_result_queue, &r, 0) != pdTRUE) {
+            err_stats_bump(ERR_QUEUE_OVERRUN);  // drop when report lags
+            queue_stats_note_drop(QSTAT_ANOM_RES);
+        } else {
+            queue_stats_note_push(QSTAT_ANOM_RES, uxQueueMessagesWaiting(anomaly_result_queue));
+        }
+    }
+}
+#endif  // QDNN_ANOMALY_MODEL
+
+#if QDNN_COMBO_MODEL
+// --- Task: satu interpreter dual-head (fan = output 0, pump = output 1) ---
+static void inference_task(void*) {
+    const tflite::Model* combo_model = tflite::GetModel(qdnn_combo_model);
+    QdnnOpResolver combo_resolver;
+    qdnn_register_ops(combo_resolver);
+    tflite::MicroInterpreter combo_interpreter(combo_model, combo_resolver,
+                                               shared_arena, 2 * kArenaSize);
+    if (combo_interpreter.AllocateTensors() != kTfLiteOk) {
+        // No slot/fallback on this build (the combo flatbuffer is
+        // compiled in); degrade to a logged level-0 pipeline instead of
+        // running with invalid tensors.
+        err_stats_bump(ERR_MODEL_BIND);
+        LogError(("combo model: AllocateTensors failed on %u arena bytes, "
+                  "degraded mode", (unsigned)(2 * kArenaSize)));
+        s_actuation_armed = false;
+        boot_stages_mark("cmbo");
+        SensorFrame dframe;
+        ControlResult dresult;
+        while (true) {
+            pipeline_recv_frame(&dframe);
+            dresult.frame = dframe;
+            dresult.fan_level = 0;
+            dresult.fan_conf = INT8_MIN;
+            dresult.fan_margin = INT8_MIN;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                dresult.pump_level[z] = 0;
+                dresult.pump_conf[z] = INT8_MIN;
+                dresult.pump_margin[z] = INT8_MIN;
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+            pipeline_send_result(&dresult);
+        }
+    }
+    TfLiteTensor* combo_input = combo_interpreter.input(0);
+    TfLiteTensor* fan_output  = combo_interpreter.output(0);
+    TfLiteTensor* pump_output = combo_interpreter.output(1);
+    QuantContext fan_qctx  = prepare_quant_context(combo_input, fan_output);
+    QuantContext pump_qctx = prepare_quant_context(combo_input, pump_output);
+    // Both heads share the one input tensor; no metadata block ships
+    // with the combo export yet, so rows resolve through the positional
+    // convention at the tensor's width.
+    const int n_in = fan_qctx.n_input;
+    audit_kernel_path("combo", combo_input, fan_output);
+    audit_compression("combo", combo_model);
+    infer_cache_init(&fan_cache);
+    infer_cache_init(&pump_cache);
+    boot_stages_mark("cmbo");
+
+    bool have_prev = false;
+    int16_t prev_input[NUM_ZONES][QDNN_META_MAX_FEATURES] = {};
+    int prev_fan = 0, prev_pump[NUM_ZONES] = {};
+    // Confidence and margin ride with the levels and inherit their hold
+    // policy: a gated or failed cycle re-reports the last invoked value.
+    int8_t fan_conf = INT8_MIN, pump_conf[NUM_ZONES];
+    int8_t fan_margin = INT8_MIN, pump_margin[NUM_ZONES];
+    for (int z = 0; z < NUM_ZONES; z++) {
+        pump_conf[z] = INT8_MIN;
+        pump_margin[z] = INT8_MIN;
+    }
+
+    SensorFrame frame;
+    while(true){
+        pipeline_recv_frame(&frame);
 
+#if QDNN_BOOT_LADDER
+        // Ladder floor: the flatbuffers are the suspects, so decisions
+        // come from the hardcoded bands and no interpreter runs.
+        if (!boot_ladder_allows(LADDER_POLICY)) {
+            ControlResult result;
+            result.frame = frame;
+            result.fan_level = fallback_fan_level(frame.temp10);
+            result.fan_conf = INT8_MIN;
+            result.fan_margin = INT8_MIN;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                result.pump_level[z] = fallback_pump_level(frame.soil_pct10[z]);
+                result.pump_conf[z] = INT8_MIN;
+                result.pump_margin[z] = INT8_MIN;
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+            pipeline_send_result(&result);
+            continue;
+        }
+#endif
+
+        int16_t ml_input[NUM_ZONES][QDNN_META_MAX_FEATURES];
+        bool changed = !have_prev;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            build_feature_row(&frame, z, nullptr, n_in, ml_input[z]);
+            if (!changed && inputs_changed10(prev_input[z], ml_input[z], n_in)) changed = true;
+        }
+
+        // Delta gating: semua zona nyaris tak berubah -> pakai hasil terakhir
+        if (!changed) {
+            ControlResult result;
+            result.frame = frame;
+            result.fan_level = prev_fan;
+            result.fan_conf = fan_conf;
+            result.fan_margin = fan_margin;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                result.pump_level[z] = prev_pump[z];
+                result.pump_conf[z] = pump_conf[z];
+                result.pump_margin[z] = pump_margin[z];
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+        pipeline_send_result(&result);
+            continue;
+        }
+
+        // Round-robin zona melalui satu interpreter: fan diambil dari
+        // invoke zona 0 (input udara sama untuk semua zona)
+        ControlResult result;
+        result.frame = frame;
+        result.fan_level = -1;
+        // Combo builds have no separate pump wait; the infer site
+        // covers the rest of the iteration, dominated by the per-zone
+        // quantize + Invoke sweep.
+        TIMING_SCOPE(TIMING_SITE_INFER);
+        uint32_t sweep_t0 = time_us_32();
+        for (int z = 0; z < NUM_ZONES; z++) {
+            // Same shared prepare stage as the split models (both
+            // heads read one input tensor, so one pass per zone)
+            if (!prepare_input_values(combo_input, fan_qctx, ml_input[z], n_in, n_in)) {
+                result.pump_level[z] = -1;
+                continue;
+            }
+
+            // Cache on the shared quantized key: both heads must hit to
+            // skip the Invoke (zone > 0 needs only the pump head). A
+            // zone with a live delta row opts its pump head out - the
+            // key is input-only and this zone no longer decides from
+            // the input alone.
+            const int8_t* zb = zone_bias_row(z, pump_qctx.out_classes);
+            uint8_t key[3];
+            bool cacheable = (fan_qctx.in_type != kTfLiteFloat32) && (n_in == 3);
+            if (cacheable) {
+                const uint8_t* qdata = (fan_qctx.in_type == kTfLiteInt8)
+                    ? (const uint8_t*)combo_input->data.int8 : combo_input->data.uint8;
+                for (int i = 0; i < 3; i++) key[i] = qdata[i];
+                int pump_hit = (zb == nullptr)
+                    ? infer_cache_lookup(&pump_cache, key, &pump_conf[z],
+                                         &pump_margin[z]) : -1;
+                int fan_hit = (z == 0)
+                    ? infer_cache_lookup(&fan_cache, key, &fan_conf, &fan_margin) : 0;
+                if (pump_hit >= 0 && fan_hit >= 0) {
+                    if (z == 0) result.fan_level = fan_hit;
+                    result.pump_level[z] = pump_hit;
+                    continue;
+                }
+            }
+
+            if (!invoke_guarded(combo_interpreter)) {
+                result.pump_level[z] = -1;
+                continue;
+            }
+            if (z == 0) {
+                result.fan_level = argmax_output(fan_output, fan_qctx, fan_qctx.out_classes, 0,
+                                                 &fan_margin);
+                fan_conf = output_conf_raw(fan_output, fan_qctx, result.fan_level, 0);
+            }
+            result.pump_level[z] = argmax_output(pump_output, pump_qctx, pump_qctx.out_classes, 0,
+                                                 &pump_margin[z], zb);
+            pump_conf[z] = output_conf_raw(pump_output, pump_qctx, result.pump_level[z], 0);
+            if (cacheable) {
+                if (z == 0 && result.fan_level >= 0)
+                    infer_cache_store(&fan_cache, key, result.fan_level, fan_conf, fan_margin);
+                if (zb == nullptr && result.pump_level[z] >= 0)
+                    infer_cache_store(&pump_cache, key, result.pump_level[z], pump_conf[z],
+                                      pump_margin[z]);
+            }
+        }
+        // Combo carries the whole dual-head sweep in the fan slot; the
+        // separate pump slot stays unmeasured on this build
+        device_baseline_note(BASE_FAN_INVOKE_US, time_us_32() - sweep_t0);
+
+        result.fan_conf = fan_conf;
+        result.fan_margin = fan_margin;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            result.pump_conf[z] = pump_conf[z];
+            result.pump_margin[z] = pump_margin[z];
+        }
+
+        // Invoke gagal / overrun deadline -> tahan level siklus
+        // sebelumnya; jangan paksa aktuator ke nol karena model rewel
+        if (have_prev) {
+            if (result.fan_level < 0) result.fan_level = prev_fan;
+            for (int z = 0; z < NUM_ZONES; z++)
+                if (result.pump_level[z] < 0) result.pump_level[z] = prev_pump[z];
+        }
+
+        for (int z = 0; z < NUM_ZONES; z++) {
+            for (int i=0;i<n_in;i++) prev_input[z][i] = ml_input[z][i];
+            prev_pump[z] = result.pump_level[z];
+        }
+        prev_fan = result.fan_level;
+        have_prev = true;
+
+        watchdog_stage_checkin(WDG_STAGE_INFER);
+        pipeline_send_result(&result);
+#if QDNN_ANOMALY_MODEL
+        // The detector is trained on the base triple regardless of the
+        // control model's feature layout, so feed it from the frame.
+        {
+            int16_t anom_in[3] = { frame.temp10, frame.humid10, frame.soil_pct10[0] };
+            anomaly_dispatch(anom_in);  // changed cycles only: new info
+        }
+#endif
+    }
+}
+#else
+// --- Task: fan model di core 0, pump model tetap di core 1 ---
+static void inference_task(void*) {
+#if QDNN_ARENA_AUDIT
+    const tflite::Model* fan_model = tflite::GetModel(qdnn_fan_model);
+    QdnnOpResolver fan_resolver;
+    qdnn_register_ops(fan_resolver);
+    AuditInterpreter fan_interpreter(fan_model, fan_resolver, fan_arena, kArenaSize);
+    fan_interpreter.AllocateTensors();
+    printf("[arena] fan used %u of %u bytes\n",
+           (unsigned)fan_interpreter.arena_used_bytes(), (unsigned)kArenaSize);
+    fan_interpreter.GetMicroAllocator().PrintAllocations();
+    audit_memory_plan("fan", fan_model, fan_interpreter, fan_arena, kArenaSize);
+#elif QDNN_PROFILE_OPS
+    const tflite::Model* fan_model = tflite::GetModel(qdnn_fan_model);
+    QdnnOpResolver fan_resolver;
+    qdnn_register_ops(fan_resolver);
+    tflite::MicroProfiler fan_profiler;
+    tflite::MicroInterpreter fan_interpreter(fan_model, fan_resolver, fan_arena, kArenaSize,
+                                             nullptr, &fan_profiler);
+    fan_interpreter.AllocateTensors();
+#else
+    // Model slot, same rationale as the pump side on core 1.
+    static ModelSlot fan_slot;
+    model_slot_init(&fan_slot, fan_arena, kArenaSize);
+#if QDNN_MODEL_BANK
+    const unsigned char* fan_data = model_bank_active(MODEL_BANK_FAN);
+    model_slot_bind_verified(&fan_slot, fan_data ? fan_data : qdnn_fan_model,
+                             qdnn_fan_model);
+#else
+    model_slot_bind_verified(&fan_slot, qdnn_fan_model, nullptr);
+#endif
+    if (model_slot_interpreter(&fan_slot) == nullptr) {
+        // Even the compiled-in model failed to plan: a logged degraded
+        // mode, not a silent brick. Keep the pipeline moving with
+        // level 0 (actuation is disarmed anyway) so telemetry and the
+        // shell stay alive for diagnosis.
+        s_actuation_armed = false;
+        boot_stages_mark("fan");
+        SensorFrame dframe;
+        ControlResult dresult;
+        while (true) {
+            pipeline_recv_frame(&dframe);
+            dresult.frame = dframe;
+            dresult.fan_level = 0;
+            dresult.fan_conf = INT8_MIN;
+            dresult.fan_margin = INT8_MIN;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                dresult.pump_level[z] = 0;
+                dresult.pump_conf[z] = INT8_MIN;
+                dresult.pump_margin[z] = INT8_MIN;
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+            pipeline_send_result(&dresult);
+        }
+    }
+    const tflite::Model* fan_model = model_slot_model(&fan_slot);
+    tflite::MicroInterpreter& fan_interpreter = *model_slot_interpreter(&fan_slot);
+#endif
+    TfLiteTensor* fan_input = fan_interpreter.input(0);
+    TfLiteTensor* fan_output = fan_interpreter.output(0);
+    QuantContext fan_qctx = prepare_quant_context(fan_input, fan_output,
+                                                  &qdnn_fan_model_meta);
+    audit_kernel_path("fan", fan_input, fan_output);
+    audit_compression("fan", fan_model);
+    infer_cache_init(&fan_cache);
+    // Boot report: how much arena the plan actually took
+    telemetry_boot_note_model(0, 0, (uint32_t)fan_interpreter.arena_used_bytes());
+    boot_stages_mark("fan");
+
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
     float scores_buf[16];
+    float* scores = scores_buf;
+#else
+    float* scores = nullptr;  // logit-only fast path: skip dequantization
+#endif
+    bool have_prev = false;
+    // Fan and pump rows are built per model from their metadata blocks,
+    // so each side remembers its own previous row for the delta gate.
+    int16_t prev_input[NUM_ZONES][QDNN_META_MAX_FEATURES] = {};
+    int16_t prev_pump_in[NUM_ZONES][QDNN_META_MAX_FEATURES] = {};
+    int prev_fan = 0, prev_pump[NUM_ZONES] = {};
+    // Confidence and margin ride with the levels and inherit their hold
+    // policy: a gated or failed cycle re-reports the last invoked value.
+    int8_t fan_conf = INT8_MIN, pump_conf[NUM_ZONES];
+    int8_t fan_margin = INT8_MIN, pump_margin[NUM_ZONES];
+    for (int z = 0; z < NUM_ZONES; z++) {
+        pump_conf[z] = INT8_MIN;
+        pump_margin[z] = INT8_MIN;
+    }
+
+    SensorFrame frame;
 
     while(true){
-        // --- Baca DHT11 ---
-        int status = read_from_dht(DHT_PIN,&temp,&humid,false);
-        if(status!=0 || humid<0 || humid>100){gpio_put(LED_DHT_ERROR,1); sleep_ms(2000); continue;}
-        else gpio_put(LED_DHT_ERROR,0);
+        pipeline_recv_frame(&frame);
+
+#if QDNN_BOOT_LADDER
+        // Ladder floor: the flatbuffers are the suspects, so decisions
+        // come from the hardcoded bands - no rebind, no invoke, and
+        // core 1 never gets handed this frame's rows.
+        if (!boot_ladder_allows(LADDER_POLICY)) {
+            ControlResult result;
+            result.frame = frame;
+            result.fan_level = fallback_fan_level(frame.temp10);
+            result.fan_conf = INT8_MIN;
+            result.fan_margin = INT8_MIN;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                result.pump_level[z] = fallback_pump_level(frame.soil_pct10[z]);
+                result.pump_conf[z] = INT8_MIN;
+                result.pump_margin[z] = INT8_MIN;
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+            pipeline_send_result(&result);
+            continue;
+        }
+#endif
+
+#if QDNN_MODEL_BANK && !(QDNN_ARENA_AUDIT || QDNN_PROFILE_OPS)
+        // Cycle boundary: swap in an uploaded fan model before this
+        // frame, and drop the delta gate (its remembered levels came
+        // from the old model). Verified bind: a candidate whose plan
+        // does not fit re-binds the model that was just serving, so the
+        // interpreter reference never dangles over an unbound slot.
+        if (model_bank_update_pending(MODEL_BANK_FAN)) {
+            const unsigned char* prev_data = fan_slot.model_data;
+            int bind_rc = model_slot_bind_verified(
+                &fan_slot, model_bank_active(MODEL_BANK_FAN), prev_data);
+            if (bind_rc < 0)  // last resort: the built-in always plans
+                bind_rc = model_slot_bind(&fan_slot, qdnn_fan_model);
+            if (bind_rc >= 0) {
+                fan_input = fan_interpreter.input(0);
+                fan_output = fan_interpreter.output(0);
+                fan_qctx = prepare_quant_context(fan_input, fan_output,
+                                                 &qdnn_fan_model_meta);
+                infer_cache_init(&fan_cache);
+                have_prev = false;
+            }
+            model_bank_consume(MODEL_BANK_FAN);
+        }
+#endif
 
-        // --- Soil ---
-        uint16_t raw = read_soil_adc();
-        float soil_pct = adc_to_percent(raw);
+        // The published pump context carries the width core 1's bound
+        // model wants; before the first publication the compiled-in
+        // metadata is the only (and correct) answer.
+        uint32_t qgen = pump_qctx_gen;
+        const int pump_n = (qgen != 0) ? pump_qctx_shared.n_input
+                                       : (int)qdnn_pump_model_meta.input_count;
+        int16_t ml_input[NUM_ZONES][QDNN_META_MAX_FEATURES];  // fan rows
+        int16_t pump_in[NUM_ZONES][QDNN_META_MAX_FEATURES];   // pump rows, for core 1
+        bool changed = !have_prev;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            build_feature_row(&frame, z, &qdnn_fan_model_meta, fan_qctx.n_input, ml_input[z]);
+            build_feature_row(&frame, z, &qdnn_pump_model_meta, pump_n, pump_in[z]);
+            if (!changed &&
+                (inputs_changed10(prev_input[z], ml_input[z], fan_qctx.n_input) ||
+                 inputs_changed10(prev_pump_in[z], pump_in[z], pump_n)))
+                changed = true;
+        }
 
-        // --- Siapkan input model ---
-        float ml_input[3]={temp, humid, soil_pct};
+        // Delta gating: semua zona nyaris tak berubah -> pakai hasil
+        // terakhir, tanpa Invoke dan tanpa handoff ke core 1
+        if (!changed) {
+            ControlResult result;
+            result.frame = frame;
+            result.fan_level = prev_fan;
+            result.fan_conf = fan_conf;
+            result.fan_margin = fan_margin;
+            for (int z = 0; z < NUM_ZONES; z++) {
+                result.pump_level[z] = prev_pump[z];
+                result.pump_conf[z] = pump_conf[z];
+                result.pump_margin[z] = pump_margin[z];
+            }
+            watchdog_stage_checkin(WDG_STAGE_INFER);
+        pipeline_send_result(&result);
+            continue;
+        }
 
-        // --- Fan ---
-        int fan_level = run_model_safe(fan_interpreter, fan_input, fan_output, ml_input, 3, scores_buf,16);
-        set_led_level(FAN_LEDS,fan_level);
+        // kirim batch zona ke core 1, jalan paralel dengan fan; baris
+        // pump ikut terkuantisasi di sini (quantize-once) dengan
+        // konteks yang dipublikasikan core 1
+        for (int z = 0; z < NUM_ZONES; z++)
+            for (int i=0;i<pump_n;i++) core1_ml_input[z * pump_n + i] = pump_in[z][i];
+        core1_ml_n = pump_n;
+        if (qgen != 0 && pump_qctx_shared.in_type == kTfLiteInt8) {
+            for (int z = 0; z < NUM_ZONES; z++)
+                for (int i=0;i<pump_n;i++)
+                    core1_ml_q[z * pump_n + i] =
+                        (int8_t)quantize_value10(pump_in[z][i], pump_qctx_shared, i);
+        }
+        core1_ml_q_gen = qgen;
+        multicore_fifo_push_blocking(CORE1_GO);
 
-        // --- Pump ---
-        int pump_level = run_model_safe(pump_interpreter, pump_input, pump_output, ml_input, 3, scores_buf,16);
-        set_led_level(PUMP_LEDS,pump_level);
+        ControlResult result;
+        result.frame = frame;
+        {
+            TIMING_SCOPE(TIMING_SITE_INFER);
+            uint32_t inv_t0 = time_us_32();
+            result.fan_level = run_model_safe(fan_interpreter, fan_input, fan_output, fan_qctx,
+                                              ml_input[0], fan_qctx.n_input, &fan_cache, scores, 16,
+                                              nullptr, &fan_conf, &fan_margin);
+            // Invoke pertama (XIP dingin) jadi baseline unit
+            device_baseline_note(BASE_FAN_INVOKE_US, time_us_32() - inv_t0);
+        }
+        {
+            TIMING_SCOPE(TIMING_SITE_PUMP);
+            for (int z = 0; z < NUM_ZONES; z++)
+                result.pump_level[z] = (int)(int32_t)multicore_fifo_pop_blocking();
+            // The pops above order these reads after core 1's writes
+            for (int z = 0; z < NUM_ZONES; z++)
+                if (result.pump_level[z] >= 0) {
+                    pump_conf[z] = core1_pump_conf[z];
+                    pump_margin[z] = core1_pump_margin[z];
+                }
+        }
+        result.fan_conf = fan_conf;
+        result.fan_margin = fan_margin;
+        for (int z = 0; z < NUM_ZONES; z++) {
+            result.pump_conf[z] = pump_conf[z];
+            result.pump_margin[z] = pump_margin[z];
+        }
+#if QDNN_PROFILE_OPS
+        printf("--- fan per-op ticks ---\n");
+        fan_profiler.LogTicksPerTagCsv();
+        fan_profiler.ClearEvents();
+#endif
 
-        // --- Print hasil ---
+        // Invoke gagal / overrun deadline -> tahan level siklus
+        // sebelumnya; jangan paksa aktuator ke nol karena model rewel
+        if (have_prev) {
+            if (result.fan_level < 0) result.fan_level = prev_fan;
+            for (int z = 0; z < NUM_ZONES; z++)
+                if (result.pump_level[z] < 0) result.pump_level[z] = prev_pump[z];
+        }
+
+        for (int z = 0; z < NUM_ZONES; z++) {
+            for (int i=0;i<fan_qctx.n_input;i++) prev_input[z][i] = ml_input[z][i];
+            for (int i=0;i<pump_n;i++) prev_pump_in[z][i] = pump_in[z][i];
+            prev_pump[z] = result.pump_level[z];
+        }
+        prev_fan = result.fan_level;
+        have_prev = true;
+
+        watchdog_stage_checkin(WDG_STAGE_INFER);
+        pipeline_send_result(&result);
+#if QDNN_GOLDEN_PROBE && !(QDNN_ARENA_AUDIT || QDNN_PROFILE_OPS)
+        // Actuation is already fed; the probe's spare Invoke rides the
+        // tail of its scheduled cycle. Only a bank model falls back -
+        // the compiled-in model failing its own vectors has no better
+        // model to fall to, so it stays, counted and logged.
+        {
+            static uint32_t s_probe_in = QDNN_GOLDEN_PERIOD_CYCLES;
+            if (--s_probe_in == 0) {
+                s_probe_in = QDNN_GOLDEN_PERIOD_CYCLES;
+                if (golden_probe_run("fan", fan_interpreter, fan_input,
+                                     fan_output, fan_qctx,
+                                     &qdnn_fan_model_meta) < 0 &&
+                    fan_slot.model_data != qdnn_fan_model &&
+                    model_slot_bind(&fan_slot, qdnn_fan_model) >= 0) {
+                    LogError(("fan golden probe: bank model demoted, built-in serving"));
+                    fan_input = fan_interpreter.input(0);
+                    fan_output = fan_interpreter.output(0);
+                    fan_qctx = prepare_quant_context(fan_input, fan_output,
+                                                     &qdnn_fan_model_meta);
+                    infer_cache_init(&fan_cache);
+                    have_prev = false;
+                }
+            }
+        }
+#endif
+#if QDNN_ANOMALY_MODEL
+        // The detector is trained on the base triple regardless of the
+        // control model's feature layout, so feed it from the frame.
+        {
+            int16_t anom_in[3] = { frame.temp10, frame.humid10, frame.soil_pct10[0] };
+            anomaly_dispatch(anom_in);  // changed cycles only: new info
+        }
+#endif
+    }
+}
+#endif  // QDNN_COMBO_MODEL
+
+// --- Task: aktuasi LED (dengan filter dwell) + laporan serial ---
+static void report_task(void*) {
+    ControlResult result;
+    LevelFilter fan_filter, pump_filters[NUM_ZONES];
+    level_filter_init(&fan_filter);
+    for (int z = 0; z < NUM_ZONES; z++) level_filter_init(&pump_filters[z]);
+#if QDNN_LEVEL_DITHER
+    // Sigma-delta stage behind the dwell filter: fractional average
+    // levels by single-step alternation (control_logic.h). Cold state
+    // after any reset - it re-primes from the first committed level.
+    LevelDither fan_dither, pump_dithers[NUM_ZONES];
+    level_dither_init(&fan_dither);
+    for (int z = 0; z < NUM_ZONES; z++) level_dither_init(&pump_dithers[z]);
+#endif
+
+    // Warm start: the dwell filters pick up their pre-reset committed
+    // levels and streaks, so the restored actuators (scratch-register
+    // path in main()) are not fought by filters that believe the
+    // hardware is at level 0.
+    struct ActWarm {
+        LevelFilter fan;
+        LevelFilter pump[NUM_ZONES];
+    } awarm;
+    if (warm_state_restore(WARM_SLOT_ACT, &awarm, sizeof(awarm))) {
+        fan_filter = awarm.fan;
+        for (int z = 0; z < NUM_ZONES; z++) pump_filters[z] = awarm.pump[z];
+        LogInfo(("warm start: dwell state restored"));
+    }
+
+#if QDNN_STATE_GUARD
+    // Owner-checked guard over the dwell state, same contract as the
+    // sensor rings: verified before each commit, sealed after.
+    int sg_fan = state_guard_register("fdwell", &fan_filter,
+                                      sizeof(fan_filter), NULL, false);
+    int sg_pump = state_guard_register("pdwell", pump_filters,
+                                       sizeof(pump_filters), NULL, false);
+#endif
+
+    while(true){
+        pipeline_recv_result(&result);
+
+        uint32_t cycle_start_ms = to_ms_since_boot(get_absolute_time());
+
+#if QDNN_SCRATCH_ARENA
+        // Cycle boundary: every scratch allocation from the previous
+        // cycle is dead from here on (scratch_arena.h ownership rules)
+        scratch_arena_reset(scratch_cycle());
+#endif
+
+        // Staleness bound at the last gate: by here the frame has paid
+        // every queue and stage, so age above the bound means a slow
+        // consumer is growing sensing-to-actuation latency silently.
+        uint32_t act_age_ms = cycle_start_ms - result.frame.t_ms;
+        if (act_age_ms > QDNN_STALE_ACT_MS) {
+            err_stats_bump(ERR_STALE_ACT);
+            if (err_stats_detail_allowed(ERR_STALE_ACT))
+                LogWarn(("actuating on a %u ms old frame (bound %u ms)",
+                         (unsigned)act_age_ms, (unsigned)QDNN_STALE_ACT_MS));
+        }
+
+#if QDNN_STATE_GUARD
+        // Corrupt dwell state restarts at level 0 and re-earns its
+        // dwell - a frozen "committed" field must not keep vouching
+        // for a level nobody decided.
+        {
+            bool fan_ok = state_guard_check(sg_fan);
+            bool pump_ok = state_guard_check(sg_pump);
+            if (!fan_ok || !pump_ok) {
+                level_filter_init(&fan_filter);
+                for (int z = 0; z < NUM_ZONES; z++)
+                    level_filter_init(&pump_filters[z]);
+                state_guard_seal(sg_fan);
+                state_guard_seal(sg_pump);
+            }
+        }
+#endif
+
+        // A proposed level must hold for LEVEL_DWELL_CYCLES before the
+        // hardware follows it - border chatter never reaches the pumps.
+        int fan_level;
+        int pump_level[NUM_ZONES];
+        {
+            TIMING_SCOPE(TIMING_SITE_ACT);
+            // Skipped deadlines count toward any pending dwell: the
+            // wall time passed even though the cycles did not, so a
+            // pump change under dwell is not delayed further by load.
+            if (result.frame.missed > 0) {
+                level_filter_credit(&fan_filter, result.frame.missed);
+                for (int z = 0; z < NUM_ZONES; z++)
+                    level_filter_credit(&pump_filters[z], result.frame.missed);
+            }
+            int dwell = (int)config_get()->dwell_cycles;
+            // Confidence gate in raw logit space: a winner whose top-2
+            // margin sits under the configured threshold is a coin
+            // flip at a class boundary, so the committed level stands
+            // in for it and the dwell never starts. Threshold 0
+            // disables the gate; INT8_MIN margins (held levels, cache
+            // misses on failed invokes) pass through ungated - the
+            // hold policy already vouched for those levels.
+            int mth = (int)config_get()->conf_margin;
+            int fan_prop = clamp_level(result.fan_level);
+            if (mth > 0 && result.fan_margin >= 0 && result.fan_margin < mth)
+                fan_prop = fan_filter.committed;
+            fan_level = level_filter_apply(&fan_filter, fan_prop, dwell);
+            for (int z = 0; z < NUM_ZONES; z++) {
+                int prop = clamp_level(result.pump_level[z]);
+                if (mth > 0 && result.pump_margin[z] >= 0 && result.pump_margin[z] < mth)
+                    prop = pump_filters[z].committed;
+                pump_level[z] = level_filter_apply(&pump_filters[z], prop, dwell);
+            }
+#if QDNN_LEVEL_DITHER
+            // Blend each dwell-approved step change across cycles; a
+            // held level passes through untouched (exact settling).
+            fan_level = level_dither_apply(&fan_dither, fan_level);
+            for (int z = 0; z < NUM_ZONES; z++)
+                pump_level[z] = level_dither_apply(&pump_dithers[z], pump_level[z]);
+#endif
+        }
+
+#if QDNN_ACT_ALIGN
+        // Phase two: the commands above are staged; hold them to the
+        // cycle's actuation deadline so every zone moves at the same
+        // cycle-relative instant regardless of when inference landed.
+        {
+            uint32_t deadline_ms = result.frame.t_ms + QDNN_ACT_ALIGN_MS;
+            uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+            if ((int32_t)(deadline_ms - now_ms) > 0)
+                vTaskDelay(pdMS_TO_TICKS(deadline_ms - now_ms));
+        }
+#endif
+#if QDNN_BUS_SYNC
+        // Fleet inrush stagger: a rising pump commit waits for this
+        // unit's slot inside the shared window, so starts across the
+        // chained units land at least window/units apart on the common
+        // supply. Stops and holds carry no inrush and go out now;
+        // an unlocked timebase falls back to immediate commits - late
+        // and simultaneous beats staggered against a stale offset.
+        {
+            static int s_prev_pump[NUM_ZONES];
+            bool rising = false;
+            for (int z = 0; z < NUM_ZONES; z++)
+                if (pump_level[z] > s_prev_pump[z]) rising = true;
+            if (rising && bus_sync_locked()) {
+                uint32_t hold = stagger_hold_ms(
+                    bus_sync_time_us() / 1000, QDNN_BUS_UNIT,
+                    QDNN_BUS_UNITS, QDNN_BUS_WINDOW_MS);
+                if (hold > 0) vTaskDelay(pdMS_TO_TICKS(hold));
+            }
+            for (int z = 0; z < NUM_ZONES; z++)
+                s_prev_pump[z] = pump_level[z];
+        }
+#endif
+        // Commit: all zones in one masked write (one O(1) ramp enqueue
+        // per actuator on the PWM build), cost independent of how the
+        // results trickled in.
+        actuation_commit(fan_level, pump_level);
+#if QDNN_CYCLE_TIMING
+        // End-to-end latency of this decision: acquisition stamp
+        // (same cycle_seq) to the commit that just landed. Spans
+        // stages plus queues, hence its own unbudgeted site.
+        cycle_timing_record(TIMING_SITE_E2E,
+            (to_ms_since_boot(get_absolute_time()) - result.frame.t_ms) * 1000u);
+#endif
+
+        // First decision out of cold boot: close the waterfall and
+        // ship the staged-init record once, now that every leg
+        // (sensor, both models, init sequence) has marked in.
+        static bool s_boot_reported = false;
+        if (!s_boot_reported) {
+            boot_stages_mark("dec1");
+            telemetry_emit_boot();
+            // Identity + baseline right behind it: by now the first
+            // invokes and DHT round trip have all been measured
+            telemetry_emit_ident();
+            s_boot_reported = true;
+        }
+
+#if QDNN_AB_SLOTS
+        // A decision made it out the door: a trial image is healthy by
+        // the only definition that matters here. Cheap no-op once
+        // confirmed; calling per cycle retries a failed confirm defer.
+        fw_update_mark_good();
+#endif
+
+#if QDNN_BOOT_LADDER
+        // Committed decisions are the health signal the ladder trusts:
+        // past the threshold this run stops counting as a crash loop
+        // (the reached level stays latched until "ladder clear").
+        static uint32_t s_ladder_ok_cycles = 0;
+        if (++s_ladder_ok_cycles == QDNN_LADDER_HEALTHY_CYCLES)
+            boot_ladder_mark_healthy();
+#endif
+
+        // Diagnostics sees what actually went out, post dwell filter
+        for (int z = 0; z < NUM_ZONES; z++)
+            self_test_feed_actuation(z, pump_level[z], result.frame.soil_pct10[z]);
+
+        // Actuation went out: heartbeat + stash the levels so a
+        // watchdog reset can restore them before the first new cycle.
+        watchdog_stage_checkin(WDG_STAGE_REPORT);
+        watchdog_save_levels(fan_level, pump_level, NUM_ZONES);
+        awarm.fan = fan_filter;
+        for (int z = 0; z < NUM_ZONES; z++) awarm.pump[z] = pump_filters[z];
+        warm_state_save(WARM_SLOT_ACT, &awarm, sizeof(awarm));
+#if QDNN_STATE_GUARD
+        state_guard_seal(sg_fan);
+        state_guard_seal(sg_pump);
+        // One rotated block per cycle (calibration, config): the whole
+        // quasi-static set re-verifies every few cycles for a few
+        // microseconds each pass.
+        state_guard_step();
+#endif
+
+#if QDNN_BUS_SYNC
+        // Bus service after actuation is out: the master's beacon
+        // blocks ~9 ms at the bus baud once per beacon interval, which
+        // is dead time here and jitter anywhere earlier in the cycle.
+        bus_sync_poll();
+#endif
+
+        // Telemetri biner: tanpa formatting float di hot path. Frame v1
+        // membawa satu zona; multi-zone pakai satu frame per zona nanti.
+        TelemetrySample sample;
+        sample.temp       = result.frame.temp10 * 0.1f;
+        sample.humid      = result.frame.humid10 * 0.1f;
+        sample.soil_pct   = result.frame.soil_pct10[0] * 0.1f;
+        sample.soil_raw   = result.frame.soil_raw[0];
+        sample.fan_level  = (uint8_t)fan_level;
+        sample.pump_level = (uint8_t)pump_level[0];
+        sample.fan_conf   = result.fan_conf;
+        sample.pump_conf  = result.pump_conf[0];
+        sample.stale_mask = result.frame.stale_mask;
+        sample.cycle_seq  = result.frame.cycle_seq;
+        telemetry_emit(&sample);
+
+#if QDNN_REPLAY_TRACE
+        // Decision record: the complete input frame plus both the
+        // model's proposal and what the dwell/confidence plumbing
+        // committed. The datalog tee keeps a sliding flash window of
+        // these, so a wrong field decision dumps into a trace the host
+        // simulator replays bit-exactly (qdnn_sim --replay).
+        {
+            ReplayRecord rec = {};
+            rec.cycle_seq  = result.frame.cycle_seq;
+            rec.t_ms       = result.frame.t_ms;
+            rec.temp10     = result.frame.temp10;
+            rec.humid10    = result.frame.humid10;
+            for (int z = 0; z < NUM_ZONES && z < TELEMETRY_REPLAY_ZONES; z++) {
+                rec.soil_raw[z]     = result.frame.soil_raw[z];
+                rec.soil_pct10[z]   = result.frame.soil_pct10[z];
+                rec.soil_slope10[z] = result.frame.soil_slope10[z];
+                rec.pump_model[z]   = (int8_t)result.pump_level[z];
+                rec.pump_commit[z]  = (uint8_t)pump_level[z];
+            }
+            rec.hour10     = result.frame.hour10;
+            rec.stale_mask = result.frame.stale_mask;
+            rec.missed     = result.frame.missed;
+#if QDNN_MODEL_BANK
+            rec.fan_bank_seq  = (uint16_t)model_bank_active_seq(MODEL_BANK_FAN);
+            rec.pump_bank_seq = (uint16_t)model_bank_active_seq(MODEL_BANK_PUMP);
+#endif
+            rec.fan_model  = (int8_t)result.fan_level;
+            rec.fan_commit = (uint8_t)fan_level;
+            rec.fan_conf   = result.fan_conf;
+            rec.fan_margin = result.fan_margin;
+            telemetry_emit_replay(&rec);
+        }
+#endif
+
+#if QDNN_TRACE_RING
+        // Ship any frozen capture; no-op while the ring is armed, so a
+        // trigger's trace leaves within one report cycle.
+        telemetry_emit_trace();
+#endif
+
+#if QDNN_PUMP_DUTY
+        // Daily duty rollover: the frame's datalog tee is the
+        // persistent metering record.
+        {
+            PumpDutySnap duty[BOARD_MAX_ZONES];
+            uint16_t duty_day;
+            int duty_n = pump_duty_day_close(duty, NUM_ZONES, &duty_day);
+            if (duty_n > 0) telemetry_emit_duty(duty, duty_n, duty_day);
+        }
+#endif
+
+#if QDNN_ANOMALY_MODEL
+        // Scores trickle in at the detector's own pace; ship each one
+        // and warn once per excursion above the threshold.
+        AnomalyScore an;
+        static bool anom_high = false;
+        while (xQueueReceive(anomaly_result_queue, &an, 0) == pdTRUE) {
+            telemetry_emit_anomaly(an.score_q8, QDNN_ANOMALY_WARN_Q8);
+            if (an.score_q8 >= QDNN_ANOMALY_WARN_Q8 && !anom_high) {
+                LogWarn(("anomaly: reconstruction error %u.%02u LSB",
+                         (unsigned)(an.score_q8 >> 8),
+                         (unsigned)((an.score_q8 & 0xFF) * 100 / 256)));
+                anom_high = true;
+            } else if (an.score_q8 < QDNN_ANOMALY_WARN_Q8) {
+                anom_high = false;
+            }
+        }
+#endif
+
+#if QDNN_WS2812_STATUS
+        // Status strip: committed levels per pixel, system pixel by
+        // ascending severity. One word write per changed pixel; the
+        // commit is a single DMA trigger (or a no-op on a quiet cycle).
+        {
+            ws2812_status_fan(fan_level);
+            for (int z = 0; z < NUM_ZONES; z++)
+                ws2812_status_zone(z, pump_level[z],
+                                   (result.frame.stale_mask & TELEMETRY_STALE_SOIL) != 0);
+            uint8_t sys = WS2812_SYS_OK;
+            if (result.frame.stale_mask &
+                (TELEMETRY_STALE_TEMP | TELEMETRY_STALE_HUMID))
+                sys = WS2812_SYS_DHT_FAULT;
+#if QDNN_ANOMALY_MODEL
+            if (anom_high) sys = WS2812_SYS_ANOMALY;
+#endif
+            if (!s_actuation_armed) sys = WS2812_SYS_DISARMED;
+            ws2812_status_system(sys);
+            ws2812_status_commit();
+        }
+#endif
+
+        // Runtime-verbose report ("verbose on" in the shell): one
+        // compact line per cycle through the deferred-output ring, so
+        // release builds can be inspected without a LOG_DEBUG reflash.
+        if (cmd_shell_verbose()) {
+#if QDNN_LAZY_FMT
+            // Raw values only; the snprintf happens in the drain task
+            int32_t v[6] = {result.frame.temp10, result.frame.humid10,
+                            result.frame.soil_pct10[0], result.frame.soil_raw[0],
+                            fan_level, pump_level[0]};
+            log_fmt_emit(LOG_FMT_VERBOSE, v, 6);
+#else
+            char line[96];
+            int len = snprintf(line, sizeof(line),
+                "T=%d.%d H=%d.%d S=%d.%d raw=%u fan=%d pump=%d\n",
+                result.frame.temp10 / 10, result.frame.temp10 % 10,
+                result.frame.humid10 / 10, result.frame.humid10 % 10,
+                result.frame.soil_pct10[0] / 10, result.frame.soil_pct10[0] % 10,
+                result.frame.soil_raw[0], fan_level, pump_level[0]);
+            if (len > 0) log_ring_write((const uint8_t*)line, (size_t)len);
+#endif
+        }
+
+        // Heap + CPU-share snapshots interleaved at low rate: heap
+        // fragmentation creep and priority misconfigurations both show
+        // up in the fleet dashboards long before a field failure.
+        static int heap_countdown = HEAP_STATS_PERIOD_CYCLES;
+        if (--heap_countdown <= 0) {
+            heap_countdown = HEAP_STATS_PERIOD_CYCLES;
+            HeapStats hs;
+            heap_stats_collect(&hs);
+            telemetry_emit_heap(&hs);
+
+            TaskStatsReport tr;
+            task_stats_collect(&tr);
+            telemetry_emit_tasks(&tr);
+
+            // Cache effectiveness: in stable conditions the hit share
+            // should dominate; a persistent miss streak means the
+            // inputs wander more than the delta gates assume.
+            InferCacheStats cs;
+            cs.fan_hits    = fan_cache.hits;
+            cs.fan_misses  = fan_cache.misses;
+            cs.pump_hits   = pump_cache.hits;
+            cs.pump_misses = pump_cache.misses;
+            telemetry_emit_cache(&cs);
+
+            // Idle duty over the same interval: the number the solar
+            // sizing sheet wants, and the proof (or refutation) that
+            // an offload change bought real sleep time.
+            IdleMeterReport im;
+            idle_meter_collect(&im);
+            telemetry_emit_power(&im);
+
+#if QDNN_ENERGY_GOV
+            // Energy budget verdict over the same interval, with the
+            // coefficient-model draw estimate weighted by the measured
+            // busy/sleep split above.
+            EnergyReport er;
+            er.vsys_mv = s_energy_vsys_mv;
+            er.state = s_energy_state;
+            er.actions = s_energy_actions;
+            er.transitions = s_energy_transitions;
+            uint32_t busy_us = im.interval_us - im.idle_us;
+            er.est_mw = im.interval_us == 0
+                ? 0
+                : (uint16_t)(((uint64_t)busy_us * QDNN_ENERGY_ACTIVE_MW +
+                              (uint64_t)im.idle_us * QDNN_ENERGY_SLEEP_MW) /
+                             im.interval_us);
+            telemetry_emit_energy(&er);
+#endif
+
+            // Time-sync record alongside the snapshots: the full
+            // 64-bit counter lets the host unwrap the 32-bit per-frame
+            // stamps, and carries the wall-clock correlation once the
+            // shell's "time" command has set it.
+            telemetry_emit_timesync();
+
+            // Error-counter summary: the failure rates the detail logs
+            // deliberately stop reporting past the rate limit.
+            uint32_t errs[ERR_SITE_COUNT];
+            for (int i = 0; i < ERR_SITE_COUNT; i++) errs[i] = err_stats_get(i);
+            telemetry_emit_errors(errs, ERR_SITE_COUNT);
+
+            // Queue watermarks: backpressure shows here as depth and
+            // entry age creeping up cycles before the staleness bound
+            // above ever fires.
+            telemetry_emit_queues();
+
+            // Lock contention: cycle-time drift attributable to a
+            // specific mutex instead of a firmware bisect.
+            telemetry_emit_locks();
+
+#if QDNN_METRICS
+            // Registry walk: every registered counter/gauge in one
+            // frame, keyed by name hash (shell "metrics" maps them).
+            telemetry_emit_metrics();
+#endif
+
+            // Identity rides every snapshot batch, so any captured log
+            // segment can be attributed to this unit.
+            telemetry_emit_ident();
+
+            // One-shot sizing report after the first interval, when
+            // every task has been through its worst-case path at least
+            // once: trim each stack to measured peak plus guard.
+            static bool hwm_reported = false;
+            if (!hwm_reported) {
+                hwm_reported = true;
+                for (int i = 0; i < tr.num_tasks; i++)
+                    LogInfo(("stack %s: high-water %u words free",
+                             tr.task[i].name, tr.task[i].stack_hwm_words));
+            }
+#if QDNN_STATIC_ALLOC
+            // Free unchanged catches net leaks; the low-water mark also
+            // catches transient pvPortMalloc calls that were freed again.
+            configASSERT(hs.free_bytes == s_heap_baseline_free);
+            configASSERT(hs.min_ever_free_bytes == s_heap_baseline_min);
+#endif
+        }
+
+#if LIBRARY_LOG_LEVEL >= LOG_DEBUG
+#if QDNN_LAZY_FMT
+        // laporan human-readable hanya di debug build - raw deci-unit
+        // args into the format ring, text rendered by the drain task
+        log_fmt_emit(LOG_FMT_RULE, NULL, 0);
+        {
+            int32_t air[2] = {result.frame.temp10, result.frame.humid10};
+            log_fmt_emit(LOG_FMT_AIR, air, 2);
+            int32_t fan[2] = {fan_level, result.fan_level};
+            log_fmt_emit(LOG_FMT_FAN, fan, 2);
+            for (int z = 0; z < NUM_ZONES; z++) {
+                int32_t zn[5] = {z, result.frame.soil_pct10[z],
+                                 result.frame.soil_raw[z], pump_level[z],
+                                 result.pump_level[z]};
+                log_fmt_emit(LOG_FMT_ZONE, zn, 5);
+            }
+        }
+#else
+        // laporan human-readable hanya di debug build
         printf("-----------------------------------\n");
-        printf("Temp: %.1f°C | Humid: %.1f%% | Soil: %.1f%% (raw=%u)\n", temp, humid, soil_pct, raw);
-        printf("Fan Level: %d | Pump Level: %d\n", fan_level, pump_level);
+        printf("Temp: %d.%d°C | Humid: %d.%d%%\n",
+               result.frame.temp10 / 10, result.frame.temp10 % 10,
+               result.frame.humid10 / 10, result.frame.humid10 % 10);
+        printf("Fan Level: %d (model %d)\n", fan_level, result.fan_level);
+        for (int z = 0; z < NUM_ZONES; z++)
+            printf("Zone %d: Soil %d.%d%% (raw=%u) | Pump Level: %d (model %d)\n",
+                   z, result.frame.soil_pct10[z] / 10, result.frame.soil_pct10[z] % 10,
+                   result.frame.soil_raw[z], pump_level[z], result.pump_level[z]);
+#endif
+#endif
+
+        // Jendela idle: aktuasi sudah keluar dan result berikutnya
+        // masih hampir satu periode lagi - satu-satunya tempat aman
+        // untuk erase flash (membekukan XIP di kedua core).
+        if (flash_maint_pending()) {
+            uint32_t spent_ms = to_ms_since_boot(get_absolute_time()) - cycle_start_ms;
+            uint32_t period_ms = cmd_shell_period_ms();
+            flash_maint_run(period_ms > spent_ms ? period_ms - spent_ms : 0);
+        }
+
+#if QDNN_DVFS
+        // Work window closed: coast at 48 MHz until the next cycle
+        dvfs_switch(PERF_PROFILE_ECO);
+#endif
+    }
+}
+
+#if QDNN_CORE1_IO
+// --- Core 1: servis I/O (topologi isolasi, build combo) ---
+// With the merged model there is no second interpreter to host, so
+// instead of idling, core 1 takes over the byte-moving half of the
+// drain path: it is the sole log-ring consumer and owns the USB/UART
+// stalls those writes can take. Core 0 then runs nothing but the
+// deadline-scheduled sensor -> inference -> actuation pipeline - for
+// single-zone units this isolation beats parallel invoke on worst-case
+// cycle latency (compare the "stats" cycle numbers between builds).
+// The ring is SPSC with barriers on both index moves, so relocating
+// the consumer across cores needs no extra locking.
+#define CORE1_IO_READY 0xC0DE0003u
+
+static void core1_io_entry() {
+    // Core 1 harus bisa diparkir saat core 0 menulis flash
+    multicore_lockout_victim_init();
+#if QDNN_IRQ_MAP
+    // No IRQ users on this topology's core 1 (the UART DMA path
+    // polls); the snapshot proving that is the point.
+    irq_map_apply();
+#endif
+    boot_stages_mark("io1");
+    multicore_fifo_push_blocking(CORE1_IO_READY);
+
+#if QDNN_UART_DMA_TELEMETRY
+    uart_dma_tx_init();
+    size_t inflight = 0;
+    while (true) {
+        if (inflight > 0) {
+            if (uart_dma_tx_busy()) { sleep_us(500); continue; }
+            log_ring_consume(inflight);
+            inflight = 0;
+        }
+        const uint8_t* span;
+        size_t n = log_ring_peek(&span);
+        if (n > 0) {
+            uart_dma_tx_start(span, n);
+            inflight = n;
+        } else {
+            sleep_ms(2);
+        }
+    }
+#else
+    uint8_t chunk[64];
+    while (true) {
+        size_t n = log_ring_read(chunk, sizeof(chunk));
+        if (n > 0) {
+            fwrite(chunk, 1, n, stdout);
+            fflush(stdout);
+        } else {
+            sleep_ms(2);
+        }
+    }
+#endif
+}
+#endif  // QDNN_CORE1_IO
+
+#if QDNN_DRAIN_SHAPER
+// --- Burst shaping untuk drain telemetri ---
+// A reconnect or a debug flood can leave the ring and the deferred-
+// format queue brim-full; pushed out at line rate, the drain owns the
+// CPU exactly when the flash scheduler and the control tasks expect
+// their idle window back. Three policies, all per 10 ms drain slot:
+// a byte budget scaled by the idle meter's measured headroom (floor
+// QDNN_DRAIN_MIN_BYTES so stats frames always move), deferred-format
+// rendering capped to one record per slot while the ring is
+// backlogged (debug text ages instead of starving the binary frames),
+// and drop-oldest once the ring rides above three-quarters full for
+// QDNN_DRAIN_DROP_SLOTS consecutive slots - the host decoder resyncs
+// on the next SOF, and the discarded bytes are counted.
+#ifndef QDNN_DRAIN_SLOT_BYTES
+#define QDNN_DRAIN_SLOT_BYTES 2048  // budget per slot at full idle
+#endif
+#ifndef QDNN_DRAIN_MIN_BYTES
+#define QDNN_DRAIN_MIN_BYTES 256
+#endif
+#ifndef QDNN_DRAIN_FMT_BACKLOG
+#define QDNN_DRAIN_FMT_BACKLOG (LOG_RING_SIZE / 2)
+#endif
+#ifndef QDNN_DRAIN_DROP_SLOTS
+#define QDNN_DRAIN_DROP_SLOTS 50  // ~0.5 s of sustained overflow
+#endif
+static volatile uint32_t s_drain_dropped_bytes;
+
+static inline uint32_t drain_slot_budget(void) {
+    uint32_t b = (uint32_t)QDNN_DRAIN_SLOT_BYTES *
+                 idle_meter_last_permille() / 1000u;
+    return b < QDNN_DRAIN_MIN_BYTES ? QDNN_DRAIN_MIN_BYTES : b;
+}
+
+// Drop-oldest under sustained overflow: a full ring means producers
+// outpace the shaped budget, and without this the producers' own
+// drop-newest policy silently loses the freshest data instead of the
+// stalest. Caller must hold no outstanding peek.
+static void drain_overflow_police(void) {
+    static uint16_t s_over_slots;
+    if (log_ring_used() < LOG_RING_SIZE - LOG_RING_SIZE / 4) {
+        s_over_slots = 0;
+        return;
+    }
+    if (++s_over_slots < QDNN_DRAIN_DROP_SLOTS) return;
+    s_over_slots = 0;
+    size_t discard = log_ring_used() - LOG_RING_SIZE / 2;
+    uint8_t scratch[64];
+    size_t done = 0;
+    while (done < discard) {
+        size_t want = discard - done;
+        if (want > sizeof(scratch)) want = sizeof(scratch);
+        size_t n = log_ring_read(scratch, want);
+        if (n == 0) break;
+        done += n;
+    }
+    s_drain_dropped_bytes = s_drain_dropped_bytes + (uint32_t)done;
+}
+#endif
+
+#if QDNN_LAZY_FMT
+// One deferred-format slice per drain slot, aged under backlog when
+// the shaper is on: a LogDebug flood renders one record per slot
+// until the binary frames have drained back under the watermark.
+static inline void drain_fmt_slice(void) {
+#if QDNN_DRAIN_SHAPER
+    log_fmt_drain_some(log_ring_used() > QDNN_DRAIN_FMT_BACKLOG ? 1 : -1);
+#else
+    log_fmt_drain();
+#endif
+}
+#endif
+
+// --- Task: kuras ring output saat sistem senggang ---
+#if QDNN_CORE1_IO
+// Isolation topology: the bytes leave through core 1 above; this task
+// keeps only the periodic housekeeping the drain slot has always owned
+// (shell, self-test slice) so those never preempt the pipeline tasks
+// at a worse priority than today.
+static void stdio_drain_task(void*) {
+    while (true) {
+        watchdog_stage_checkin(WDG_STAGE_DRAIN);
+        cmd_shell_poll();
+#if QDNN_USB_ON_DEMAND
+        usb_gate_poll();  // arm CDC if a cable appeared since boot
+#endif
+        self_test_step();  // satu irisan diagnosa per lewatan
+#if QDNN_LAZY_FMT
+        drain_fmt_slice();  // render deferred debug text on our time
+#endif
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+#elif QDNN_UART_DMA_TELEMETRY
+// Zero-copy UART DMA: pinjam span komit yang bersambung langsung dari
+// storage ring (log_ring_peek) dan serahkan ke channel DMA; byte baru
+// dilepas (consume) setelah transfer selesai, jadi produser tidak
+// pernah menimpanya. Tidak ada buffer perantara sama sekali.
+static void stdio_drain_task(void*) {
+    size_t inflight = 0;
+    uart_dma_tx_init();
+    while(true){
+        watchdog_stage_checkin(WDG_STAGE_DRAIN);
+        cmd_shell_poll();
+#if QDNN_USB_ON_DEMAND
+        usb_gate_poll();  // arm CDC if a cable appeared since boot
+#endif
+        self_test_step();  // satu irisan diagnosa per lewatan
+#if QDNN_LAZY_FMT
+        drain_fmt_slice();  // render deferred debug text on our time
+#endif
+        if (inflight > 0) {
+            if (uart_dma_tx_busy()) { vTaskDelay(1); continue; }
+            log_ring_consume(inflight);
+            inflight = 0;
+        }
+#if QDNN_DRAIN_SHAPER
+        drain_overflow_police();  // safe: no peek outstanding here
+#endif
+        const uint8_t* span;
+        size_t n = log_ring_peek(&span);
+        if (n > 0) {
+#if QDNN_DRAIN_SHAPER
+            // One shaped burst per slot: the DMA moves the bytes, but
+            // capping the span keeps the consume/refill cadence - and
+            // the producers' view of ring headroom - inside budget.
+            uint32_t budget = drain_slot_budget();
+            if (n > budget) n = budget;
+#endif
+            uart_dma_tx_start(span, n);
+            inflight = n;
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+}
+#else
+static void stdio_drain_task(void*) {
+    uint8_t chunk[64];
+    while(true){
+        watchdog_stage_checkin(WDG_STAGE_DRAIN);
+        cmd_shell_poll();
+#if QDNN_USB_ON_DEMAND
+        usb_gate_poll();  // arm CDC if a cable appeared since boot
+#endif
+        self_test_step();  // satu irisan diagnosa per lewatan
+#if QDNN_LAZY_FMT
+        drain_fmt_slice();  // render deferred debug text on our time
+#endif
+#if QDNN_DRAIN_SHAPER
+        // Shaped slot: write at most the idle-scaled budget, then
+        // sleep the slot out whether or not the ring is empty - the
+        // post-reconnect backlog drains at a bounded, scheduled rate
+        // instead of monopolizing the core until empty.
+        uint32_t budget = drain_slot_budget();
+        size_t spent = 0;
+        size_t n;
+        while (spent < budget && (n = log_ring_read(chunk, sizeof(chunk))) > 0) {
+            fwrite(chunk, 1, n, stdout);
+            spent += n;
+        }
+        if (spent > 0) fflush(stdout);
+        drain_overflow_police();
+        vTaskDelay(pdMS_TO_TICKS(10));
+#else
+        size_t n = log_ring_read(chunk, sizeof(chunk));
+        if (n > 0) {
+            fwrite(chunk, 1, n, stdout);
+            fflush(stdout);
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+#endif
+    }
+}
+#endif
+
+int main() {
+#if QDNN_USB_ON_DEMAND
+    // Headless units never start the CDC stack at all; UART stdio is
+    // up from the first line either way.
+    stdio_uart_init();
+    usb_gate_init();
+#else
+    stdio_init_all();
+#endif
+
+    // --- Boot waterfall: klaim spinlock sebelum mark pertama ---
+    boot_stages_init();
+
+    // Fast-boot setelah watchdog reset: tanpa tunggu USB, aktuator
+    // langsung dipulihkan dari scratch register di bawah.
+    bool fast_boot = watchdog_guard_fast_boot();
 
-        sleep_ms(3000);
+    // Checkpoint region pertama: sebelum calib_init dan sebelum task
+    // manapun bisa restore/save (warm vs cold start diputuskan di sini)
+    warm_state_init();
+
+#if QDNN_BOOT_LADDER
+    // Verdict before any of its subjects initialize: the bank scan,
+    // shadow offers and telemetry commits all consult the level.
+    boot_ladder_init();
+#endif
+
+#if LIB_PICO_STDIO_USB
+    // Tunggu host USB paling lama 2 s; lanjut begitu terhubung (atau
+    // langsung kalau tidak ada host) - bukan stall 2 s tetap.
+#if QDNN_USB_ON_DEMAND
+    // On-demand builds only wait when the gate actually armed the
+    // stack at boot (VBUS present); headless units skip straight on.
+    if (!fast_boot && usb_gate_armed()) {
+#else
+    if (!fast_boot) {
+#endif
+        absolute_time_t usb_deadline = make_timeout_time_ms(2000);
+        while (!stdio_usb_connected() &&
+               absolute_time_diff_us(get_absolute_time(), usb_deadline) > 0) {
+            sleep_ms(10);
+        }
     }
+#endif
+    printf("=== Pico DHT11 + Soil + TinyML Fan/Pump ===\n");
+    // --- Sebab reset untuk boot report (0xAE v3): decode sekarang, ---
+    // --- register chip_reset bisa tertimpa oleh soft reboot nanti ---
+    {
+        uint8_t cause = 0;
+        uint32_t cr = vreg_and_chip_reset_hw->chip_reset;
+        if (watchdog_caused_reboot())
+            cause = watchdog_enable_caused_reboot() ? 4 : 5;
+        else if (cr & VREG_AND_CHIP_RESET_CHIP_RESET_HAD_POR_BITS)
+            cause = 1;
+        else if (cr & VREG_AND_CHIP_RESET_CHIP_RESET_HAD_RUN_BITS)
+            cause = 2;
+        else if (cr & VREG_AND_CHIP_RESET_CHIP_RESET_HAD_PSM_RESTART_BITS)
+            cause = 3;
+        telemetry_boot_note_reset(cause);
+    }
+    if (fast_boot) {
+        LogWarn(("watchdog reset - fast boot"));
+        // Attribution the monitor wrote before the bite: which stage
+        // went silent, and for how long when the feed last stopped.
+        uint32_t age_s = 0;
+        int guilty = watchdog_guard_culprit(&age_s);
+        if (guilty >= 0)
+            LogWarn(("watchdog: '%s' stage hung (silent %u s at last poll)",
+                     watchdog_stage_name(guilty), (unsigned)age_s));
+    }
+    LogInfo(("boot %u (%s start)", (unsigned)warm_state_boot_count(),
+             warm_state_is_warm() ? "warm" : "cold"));
+    boot_stages_mark("usb");
+
+#if !QDNN_COMBO_MODEL
+    // Kick the fan-model CRC sweep now: the DMA sniffer grinds through
+    // the flatbuffer while the init sequence below runs, so the check
+    // is free in boot wall-time. Verified before actuation arms.
+    model_crc_begin(qdnn_fan_model, qdnn_fan_model_len);
+#endif
+
+    // Detach peripheral clocks from clk_sys so profile switches never
+    // disturb UART/ADC timing; optionally boot straight into boost.
+    perf_profile_init();
+#if QDNN_BOOST_CLOCK
+    perf_profile_apply(PERF_PROFILE_BOOST);
+#endif
+
+#if QDNN_LOW_POWER
+    // Battery build: deep-sleep between control cycles (tickless idle)
+    low_power_init();
+#endif
+    boot_stages_mark("clk");
+
+    // --- Init GPIO / actuation backend ---
+#if QDNN_PWM_ACTUATION
+    pwm_actuate_init(&fan_act, kBoard.fan_pins[0]);
+    for(int z=0;z<NUM_ZONES;z++) pwm_actuate_init(&pump_act[z], kBoard.pump_pins[z][0]);
+#else
+    // gpio_guard_init_out latches level 0 before connecting each pad:
+    // a relay input never sees the floating/stale-latch window the
+    // plain init/set_dir/put order exposes.
+    for(int i=0;i<4;i++) gpio_guard_init_out(kBoard.fan_pins[i], 0);
+    for(int z=0;z<NUM_ZONES;z++){
+        for(int i=0;i<4;i++) gpio_guard_init_out(kBoard.pump_pins[z][i], 0);
+    }
+#endif
+    gpio_guard_init_out(LED_DHT_ERROR, 0);
+
+#if QDNN_WS2812_STATUS
+    // --- Status strip: one data pin, PIO+DMA refresh, rich at-a-glance
+    // diagnostics without another discrete LED bank ---
+    ws2812_status_init();
+#endif
+#if QDNN_TOUCH_BTN
+    // --- Diagnostics button: debounce and press classification live
+    // in a PIO state machine, the shell consumes the verdicts ---
+    touch_btn_init();
+#endif
+
+    // Pulihkan level aktuator terakhir segera setelah GPIO siap: fan
+    // dan pompa kembali ke keadaan pra-reset jauh sebelum siklus
+    // kontrol pertama menghasilkan level baru.
+    if (fast_boot) {
+        int fan_level = 0, pump_level[NUM_ZONES] = {};
+        if (watchdog_restore_levels(&fan_level, pump_level, NUM_ZONES))
+            actuation_commit(fan_level, pump_level);
+    }
+    boot_stages_mark("gpio");
+
+    // --- Init ADC (free-running DMA sampler, satu channel per zona) ---
+#if QDNN_THERMAL_GUARD
+#define SOIL_ADC_WANT_TEMP true   // + die temperature slot (ADC4)
+#else
+#define SOIL_ADC_WANT_TEMP false
+#endif
+#if QDNN_BROWNOUT || QDNN_ENERGY_GOV
+    soil_adc_init(SOIL_ADC_PINS, NUM_ZONES, SOIL_ADC_WANT_TEMP, true);  // + VSYS slot
+#else
+    soil_adc_init(SOIL_ADC_PINS, NUM_ZONES, SOIL_ADC_WANT_TEMP);
+#endif
+#if QDNN_SOIL_AC
+    // --- Eksitasi AC probe: PWM drive + IQ demod, scanner tetap jalan ---
+    soil_ac_init(QDNN_SOIL_AC_GPIO, SOIL_ADC_PINS, NUM_ZONES);
+#endif
+
+    // --- Kalibrasi soil dari flash (fallback ke default compile-time) ---
+    lock_stats_init();  // calib_init() is the first lock user
+    calib_init();
+
+    // --- Watermark out-of-band: 10% margin dari endpoint kalibrasi ---
+    // Low = nyaris jenuh (pipa pecah), high = nyaris kering/terlepas;
+    // histeresis 5% span agar satu kondisi hanya memicu sekali.
+    {
+        const SoilCalib* wm_cal = calib_get();
+        uint16_t span = (uint16_t)(wm_cal->dry_raw - wm_cal->wet_raw);
+        for (int z = 0; z < NUM_ZONES; z++)
+            soil_adc_set_alert(z, (uint16_t)(wm_cal->wet_raw + span / 10),
+                               (uint16_t)(wm_cal->dry_raw - span / 10),
+                               (uint16_t)(span / 20), soil_alert_isr);
+    }
+
+#if QDNN_BROWNOUT
+    // --- Supply-sag watermark di slot VSYS (plus adopsi checkpoint) ---
+    brownout_init(brownout_safe_outputs);
+#endif
+    boot_stages_mark("adc");
+
+#if !QDNN_COMBO_MODEL
+    // --- Model integrity: collect the fan sweep, start the pump one ---
+    // (The combo header is produced outside this tree and carries no
+    // embedded CRC; combo builds skip the check.)
+    uint32_t fan_crc = model_crc_wait();
+    boot_stages_mark("crcf");
+    model_crc_begin(qdnn_pump_model, qdnn_pump_model_len);
+#endif
+
+    // RAM-only inits overlap the pump sweep grinding on the DMA
+    // sniffer. Anything that touches flash (model banks, datalog,
+    // crash-dump erase) stays behind the sweep: an erase would yank
+    // XIP out from under the sniffer's reads.
+
+    // --- Runtime config: compile-time default, persisted sector wins ---
+    // One XIP read + a ~20-byte CRC: microseconds, no parsing. The
+    // shell mutates and re-persists through the same store.
+    {
+        RuntimeConfig cfg_defaults = { CONTROL_PERIOD_MS, 0, LEVEL_DWELL_CYCLES, 0, {} };
+        config_init(&cfg_defaults);
+    }
+    cmd_shell_init(config_get()->period_ms);
+
+    // --- Self-test background: jendela diagnosa per zona ---
+    self_test_init(NUM_ZONES);
+
+    // --- Error counters: klaim spinlock sebelum site pertama aktif ---
+    err_stats_init();
+
+    // --- Deadline guard core 0 (fan/combo); core 1 mengklaim miliknya ---
+    invoke_deadline_init(QDNN_INVOKE_DEADLINE_MS);
+
+    // --- Flash maintenance: erase/program hanya di jendela idle ---
+    flash_maint_init();
+
+    // --- Identitas unit: ID flash unik untuk atribusi telemetri ---
+    device_id_init();
+
+#if QDNN_BUS_SYNC
+    // --- Timebase bersama antar unit di bus RS-485 (UART1) ---
+    bus_sync_init();
+#endif
+    boot_stages_mark("cfg");
+
+#if !QDNN_COMBO_MODEL
+    uint32_t pump_crc = model_crc_wait();
+    model_crc_release();
+    if (fan_crc != qdnn_fan_model_crc32 || pump_crc != qdnn_pump_model_crc32) {
+        LogError(("model CRC mismatch (fan %08x/%08x pump %08x/%08x) - actuation disarmed",
+                  (unsigned)fan_crc, (unsigned)qdnn_fan_model_crc32,
+                  (unsigned)pump_crc, (unsigned)qdnn_pump_model_crc32));
+        s_actuation_armed = false;
+    }
+    // Boot report carries what the sweep actually measured - matching
+    // or not - so a disarmed unit still tells the host exactly why
+    telemetry_boot_note_model(0, fan_crc, 0);
+    telemetry_boot_note_model(1, pump_crc, 0);
+    boot_stages_mark("crcp");
+#endif
+
+#if QDNN_MODEL_BANK
+    // --- Model banks: scan + validate before core 1 starts ---
+    // (Needs the CRC sniffer, so after model_crc_release() above.)
+    model_bank_init();
+#if QDNN_MODEL_PREFLIGHT
+    // The preflight trial-plans uploads against the same slice the
+    // live interpreters own.
+    model_preflight_init(kArenaSize);
+#endif
+#endif
+
+#if QDNN_AB_SLOTS
+    // --- A/B slots: note the running slot and both headers' state ---
+    // (Also sniffer-based, and reads the selector's scratch pair.)
+    fw_update_init();
+#endif
+
+#if QDNN_DATALOG
+    // --- Datalogger: temukan sektor terbaru sebelum core 1 jalan ---
+    datalog_init();
+#endif
+
+    // --- Postmortem dari boot sebelumnya (jika ada), lalu bersihkan ---
+    // Before core 1 launches: the one-shot sector erase in here must
+    // not race another core's XIP fetches.
+    crash_dump_check();
+    boot_stages_mark("flsh");
+
+#if QDNN_IRQ_MAP
+    // --- Steering map: prioritas NVIC core 0 dari satu tabel ---
+    // After every core 0 IRQ user has claimed its vector (USB stdio,
+    // ADC DMA, the deadline alarm); core 1 applies its own in its
+    // entry function.
+    irq_map_apply();
+#endif
+
+#if !QDNN_COMBO_MODEL
+    // --- TinyML Pump: jalan di core 1 ---
+    multicore_launch_core1(core1_pump_entry);
+    while (multicore_fifo_pop_blocking() != CORE1_READY) tight_loop_contents();
+#elif QDNN_CORE1_IO
+    // --- Topologi isolasi: core 1 servis I/O, core 0 murni kontrol ---
+    multicore_launch_core1(core1_io_entry);
+    while (multicore_fifo_pop_blocking() != CORE1_IO_READY) tight_loop_contents();
+#endif
+    boot_stages_mark("cor1");
+
+#if QDNN_METRICS
+    // --- Metrics registry: satu permukaan baca untuk counter lama ---
+    // Registration wraps storage the modules already maintain; nothing
+    // here changes how any of them update. Init-time only - the table
+    // is frozen once the tasks start.
+    metrics_register("log.dropped", METRIC_COUNTER, log_ring_dropped_ref());
+    metrics_register("soil.alerts", METRIC_COUNTER, &s_soil_alert_count);
+#if QDNN_DRAIN_SHAPER
+    metrics_register("drain.dropped", METRIC_COUNTER, &s_drain_dropped_bytes);
+#endif
+#if QDNN_SCRATCH_ARENA
+    metrics_register("scratch.refused", METRIC_COUNTER,
+                     &scratch_cycle()->failures);
+#endif
+#if QDNN_THERMAL_GUARD
+    metrics_register("thermal.derates", METRIC_COUNTER, &s_thermal_derates);
+    metrics_register("die.temp10", METRIC_GAUGE, &s_die_temp10);
+#endif
+#endif
+
+#if QDNN_WATCH_CHANNEL
+    // --- Watch subscriptions: satu lintasan evaluasi per sinyal ---
+    // Init-time only, like the metrics table. Hysteresis in each
+    // signal's own units: 2.0 degC of cooling re-arms the heat
+    // advisory, 100 mV of recovery re-arms the supply one.
+    watch_register(WATCH_SIG_TEMP10, WATCH_ABOVE, QDNN_WATCH_TEMP_HI_10, 20,
+                   watch_log_cb, (void*)"air temp above limit");
+    watch_register(WATCH_SIG_VSYS_MV, WATCH_BELOW, QDNN_WATCH_VSYS_LO_MV, 100,
+                   watch_log_cb, (void*)"supply sagging");
+#endif
+
+    // --- Buat pipeline: queues + tasks ---
+#if QDNN_STATIC_ALLOC
+#if !QDNN_SPSC_QUEUES
+    sensor_queue = xQueueCreateStatic(SENSOR_QUEUE_LEN, sizeof(SensorFrame),
+                                      sensor_queue_storage, &sensor_queue_cb);
+    result_queue = xQueueCreateStatic(RESULT_QUEUE_LEN, sizeof(ControlResult),
+                                      result_queue_storage, &result_queue_cb);
+#endif
+#if QDNN_ANOMALY_MODEL
+    anomaly_queue = xQueueCreateStatic(ANOMALY_QUEUE_LEN, sizeof(AnomalySample),
+                                       anomaly_queue_storage, &anomaly_queue_cb);
+    anomaly_result_queue = xQueueCreateStatic(ANOMALY_RESULT_QUEUE_LEN, sizeof(AnomalyScore),
+                                              anomaly_result_queue_storage, &anomaly_result_queue_cb);
+#endif
+
+    s_sensor_task_handle =
+    xTaskCreateStatic(sensor_task,     "sensor", SENSOR_TASK_STACK, NULL, SENSOR_TASK_PRIO, sensor_stack, &sensor_tcb);
+    xTaskCreateStatic(inference_task,  "infer",  INFER_TASK_STACK,  NULL, INFER_TASK_PRIO,  infer_stack,  &infer_tcb);
+    xTaskCreateStatic(report_task,     "report", REPORT_TASK_STACK, NULL, REPORT_TASK_PRIO, report_stack, &report_tcb);
+    xTaskCreateStatic(stdio_drain_task,"drain",  DRAIN_TASK_STACK,  NULL, DRAIN_TASK_PRIO,  drain_stack,  &drain_tcb);
+    xTaskCreateStatic(watchdog_monitor_task, "wdg", WDGMON_TASK_STACK, NULL, WDGMON_TASK_PRIO, wdgmon_stack, &wdgmon_tcb);
+#if QDNN_NET_UPLINK
+    xTaskCreateStatic(net_uplink_task, "net",    NET_TASK_STACK,    NULL, NET_TASK_PRIO,    net_stack,    &net_tcb);
+#endif
+#if QDNN_ANOMALY_MODEL
+    xTaskCreateStatic(anomaly_task,    "anom",   ANOMALY_TASK_STACK,NULL, ANOMALY_TASK_PRIO, anomaly_stack, &anomaly_tcb);
+#endif
+
+    // Everything after this point must leave heap_4 untouched; the
+    // periodic heap snapshot asserts against these baselines.
+    s_heap_baseline_free = xPortGetFreeHeapSize();
+    s_heap_baseline_min  = xPortGetMinimumEverFreeHeapSize();
+#else
+#if !QDNN_SPSC_QUEUES
+    sensor_queue = xQueueCreate(SENSOR_QUEUE_LEN, sizeof(SensorFrame));
+    result_queue = xQueueCreate(RESULT_QUEUE_LEN, sizeof(ControlResult));
+#endif
+#if QDNN_ANOMALY_MODEL
+    anomaly_queue = xQueueCreate(ANOMALY_QUEUE_LEN, sizeof(AnomalySample));
+    anomaly_result_queue = xQueueCreate(ANOMALY_RESULT_QUEUE_LEN, sizeof(AnomalyScore));
+#endif
+
+    xTaskCreate(sensor_task,    "sensor", SENSOR_TASK_STACK, NULL, SENSOR_TASK_PRIO, &s_sensor_task_handle);
+    xTaskCreate(inference_task, "infer",  INFER_TASK_STACK,  NULL, INFER_TASK_PRIO,  NULL);
+    xTaskCreate(report_task,    "report", REPORT_TASK_STACK, NULL, REPORT_TASK_PRIO, NULL);
+    xTaskCreate(stdio_drain_task,"drain", DRAIN_TASK_STACK,  NULL, DRAIN_TASK_PRIO,  NULL);
+    xTaskCreate(watchdog_monitor_task, "wdg", WDGMON_TASK_STACK, NULL, WDGMON_TASK_PRIO, NULL);
+#if QDNN_NET_UPLINK
+    xTaskCreate(net_uplink_task, "net",   NET_TASK_STACK,    NULL, NET_TASK_PRIO,    NULL);
+#endif
+#if QDNN_ANOMALY_MODEL
+    xTaskCreate(anomaly_task,    "anom",  ANOMALY_TASK_STACK,NULL, ANOMALY_TASK_PRIO, NULL);
+#endif
+#endif
+
+    // Arm the watchdog last: from here on, only a pipeline where every
+    // stage keeps making progress holds the reset off.
+    watchdog_guard_init();
+
+    vTaskStartScheduler();
+
+    // never reached
+    while(true) tight_loop_contents();
 }
@@ -0,0 +1,45 @@
+/**
+ * @file metrics.cpp
+ *
+ * @brief Metrics registry implementation
+ */
+
+#include "metrics.h"
+
+#include <string.h>
+
+static MetricDesc s_table[QDNN_METRICS_MAX];
+static int s_count;
+
+uint32_t metrics_hash(const char* name) {
+    // FNV-1a, 32-bit: stable across builds, good dispersion on short
+    // dotted names, and trivially reproduced host-side.
+    uint32_t h = 2166136261u;
+    while (*name) {
+        h ^= (uint8_t)*name++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+int metrics_register(const char* name, uint8_t type,
+                     const volatile uint32_t* value) {
+    uint32_t h = metrics_hash(name);
+    for (int i = 0; i < s_count; i++)
+        if (s_table[i].hash == h) return i;
+    if (s_count >= QDNN_METRICS_MAX) return -1;
+    s_table[s_count].hash = h;
+    s_table[s_count].name = name;
+    s_table[s_count].type = type;
+    s_table[s_count].value = value;
+    return s_count++;  // slot fully written before the count publishes it
+}
+
+int metrics_count(void) {
+    return s_count;
+}
+
+const MetricDesc* metrics_get(int idx) {
+    if (idx < 0 || idx >= s_count) return NULL;
+    return &s_table[idx];
+}
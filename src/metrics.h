@@ -0,0 +1,74 @@
+/**
+ * @file metrics.h
+ *
+ * @brief Fixed-slot metrics registry with pull-based export
+ *
+ * Counters, watermarks and gauges have been accumulating module by
+ * module - err_stats slots, cache hit pairs, scratch high-water, ring
+ * drop counts - each with its own reporting path or none at all. The
+ * registry gives them one read surface without touching how any of
+ * them update: a module registers a descriptor (name, type, pointer to
+ * its existing uint32 storage) once at init, and updates stay the
+ * module's own single-writer stores - no indirection, no new macros on
+ * the hot path, nothing allocated ever.
+ *
+ * Export is pull-based: the report task walks the table into one
+ * telemetry frame (SOF 0xB6) on the periodic stats cadence, and the
+ * shell's "metrics" command prints name = value for a human. On the
+ * wire each metric is identified by the FNV-1a hash of its name, so
+ * the frame size is independent of name lengths and the host keys
+ * dashboards on stable 32-bit ids; the shell dump is the hash-to-name
+ * dictionary when one is needed.
+ *
+ * Registration is init-time only (before the tasks start): the table
+ * is append-only and unlocked, safe because readers only ever see
+ * fully-written slots behind the published count.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+/** @brief How a reader should interpret a metric's value. */
+enum MetricType {
+    METRIC_COUNTER = 0,    ///< monotonic since boot (rates via deltas)
+    METRIC_GAUGE = 1,      ///< instantaneous level
+    METRIC_WATERMARK = 2,  ///< worst case since boot (or last reset)
+};
+
+/** @brief One registered metric. The registry never writes *value. */
+struct MetricDesc {
+    uint32_t hash;                  ///< FNV-1a of name: the wire id
+    const char* name;               ///< shell dump only; not on the wire
+    uint8_t type;                   ///< MetricType
+    const volatile uint32_t* value; ///< the module's own storage
+};
+
+/** @brief Registry capacity; a full table refuses further slots. */
+#ifndef QDNN_METRICS_MAX
+#define QDNN_METRICS_MAX 32
+#endif
+
+/** @brief FNV-1a over the name (the id the wire carries). */
+uint32_t metrics_hash(const char* name);
+
+/**
+ * @brief Register one metric. Call from init code, before the tasks.
+ *
+ * Re-registering a name returns its existing slot (idempotent init
+ * paths stay simple); a full table returns -1 and the metric simply
+ * stays unexported.
+ *
+ * @return Slot index, or -1 when the table is full.
+ */
+int metrics_register(const char* name, uint8_t type,
+                     const volatile uint32_t* value);
+
+/** @brief Registered slot count. */
+int metrics_count(void);
+
+/** @brief Read-only view of one slot, NULL out of range. */
+const MetricDesc* metrics_get(int idx);
+
+#endif
@@ -0,0 +1,281 @@
+/**
+ * @file model_bank.cpp
+ *
+ * @brief Dual-bank model storage implementation
+ *
+ * Commit discipline: payload sectors are streamed and programmed
+ * first, the 32-byte header sector is programmed only after the whole
+ * stream arrived with the announced CRC, and the header carries the
+ * next monotonic sequence - so "newest valid header" is the atomic
+ * activation point, exactly like the datalog's sector sweep.
+ *
+ * Verification reads go through the XIP no-allocate alias so a stale
+ * cache line can never vouch for flash contents; after a successful
+ * commit the XIP cache is flushed once so every later fetch of the new
+ * bank is real.
+ */
+
+#include "model_bank.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "pico/flash.h"
+
+#include "app_log.h"
+#if QDNN_BOOT_LADDER
+#include "boot_ladder.h"
+#endif
+#include "datalog.h"
+#include "model_crc.h"
+#if QDNN_MODEL_PREFLIGHT
+#include "model_preflight.h"
+#endif
+
+// Region sits just below the datalog (which sits below crash + calib)
+#define MODEL_BANK_REGION_OFFSET                                     \
+    (PICO_FLASH_SIZE_BYTES -                                         \
+     (2 + DATALOG_SECTORS +                                          \
+      MODEL_BANK_MODELS * 2 * MODEL_BANK_SECTORS) * FLASH_SECTOR_SIZE)
+
+#define MODEL_BANK_MAGIC 0x514D4F44u  // "QMOD"
+
+struct BankHeader {
+    uint32_t magic;
+    uint32_t seq;        // monotonic across both banks of a model
+    uint32_t len;        // payload bytes
+    uint32_t crc32;      // CRC-32 (IEEE) of the payload
+    uint32_t model_id;
+    uint32_t reserved[3];
+};
+
+static_assert(sizeof(BankHeader) == 32, "header must keep the payload 16-byte aligned");
+
+#define BANK_BYTES    (MODEL_BANK_SECTORS * FLASH_SECTOR_SIZE)
+#define BANK_CAPACITY (BANK_BYTES - sizeof(BankHeader))
+
+static int s_active_bank[MODEL_BANK_MODELS];        // -1 = compiled-in only
+static uint32_t s_active_seq[MODEL_BANK_MODELS];
+static volatile bool s_pending[MODEL_BANK_MODELS];
+
+// Upload staging: sector 0 (with the header gap) is held back and
+// programmed last; every other sector streams through the second
+// buffer. One upload at a time, from the shell task.
+static uint8_t s_first[FLASH_SECTOR_SIZE];
+static uint8_t s_sector[FLASH_SECTOR_SIZE];
+
+static uint32_t bank_offset(int model_id, int bank) {
+    return MODEL_BANK_REGION_OFFSET +
+           (uint32_t)(model_id * 2 + bank) * BANK_BYTES;
+}
+
+static const BankHeader* bank_header(int model_id, int bank) {
+    // No-allocate alias: header reads must see flash, not a cache line
+    return (const BankHeader*)(XIP_NOCACHE_NOALLOC_BASE +
+                               bank_offset(model_id, bank));
+}
+
+// Reflected CRC-32 step (poly 0xEDB88320), state pre/post inverted by
+// the callers - bitwise is plenty at upload rates.
+static uint32_t crc32_step(uint32_t crc, uint8_t b) {
+    crc ^= b;
+    for (int i = 0; i < 8; i++)
+        crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    return crc;
+}
+
+static void xip_flush(void) {
+    xip_ctrl_hw->flush = 1;
+    (void)xip_ctrl_hw->flush;  // read stalls until the flush completes
+}
+
+struct FlashProgOp {
+    uint32_t offset;
+    const uint8_t* data;
+};
+
+static void bank_flash_program(void* param) {
+    const FlashProgOp* op = (const FlashProgOp*)param;
+    flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+    flash_range_program(op->offset, op->data, FLASH_SECTOR_SIZE);
+}
+
+static int program_sector(uint32_t offset, const uint8_t* data) {
+    FlashProgOp op = {offset, data};
+    if (flash_safe_execute(bank_flash_program, &op, 1000) != PICO_OK) {
+        LogError(("model bank: sector program failed at 0x%08x", (unsigned)offset));
+        return -1;
+    }
+    return 0;
+}
+
+static bool bank_valid(int model_id, int bank) {
+    const BankHeader* h = bank_header(model_id, bank);
+    if (h->magic != MODEL_BANK_MAGIC) return false;
+    if (h->model_id != (uint32_t)model_id) return false;
+    if (h->len == 0 || h->len > BANK_CAPACITY) return false;
+    model_crc_begin((const uint8_t*)(h + 1), h->len);
+    return model_crc_wait() == h->crc32;
+}
+
+void model_bank_init(void) {
+    for (int m = 0; m < MODEL_BANK_MODELS; m++) {
+        s_active_bank[m] = -1;
+        s_active_seq[m] = 0;
+        s_pending[m] = false;
+#if QDNN_BOOT_LADDER
+        // Crash-looping with uploads in play: a bad uploaded model is
+        // the prime suspect, so the ladder's first step leaves every
+        // bank dormant and the compiled-in models serve.
+        if (!boot_ladder_allows(LADDER_BANK)) {
+            LogWarn(("model bank: model %d banks ignored (degradation "
+                     "ladder level %d)", m, boot_ladder_level()));
+            continue;
+        }
+#endif
+        for (int b = 0; b < 2; b++) {
+            if (!bank_valid(m, b)) continue;
+            uint32_t seq = bank_header(m, b)->seq;
+            if (seq > s_active_seq[m]) {
+                s_active_seq[m] = seq;
+                s_active_bank[m] = b;
+            }
+        }
+        if (s_active_bank[m] >= 0)
+            LogInfo(("model bank: model %d serving bank %d (seq %u)",
+                     m, s_active_bank[m], (unsigned)s_active_seq[m]));
+    }
+    model_crc_release();
+}
+
+const uint8_t* model_bank_active(int model_id) {
+    if (model_id < 0 || model_id >= MODEL_BANK_MODELS) return NULL;
+    if (s_active_bank[model_id] < 0) return NULL;
+    // Cached alias for the consumer: this is the pointer the
+    // interpreter runs from.
+    return (const uint8_t*)(XIP_BASE +
+                            bank_offset(model_id, s_active_bank[model_id]) +
+                            sizeof(BankHeader));
+}
+
+uint32_t model_bank_active_len(int model_id) {
+    if (model_id < 0 || model_id >= MODEL_BANK_MODELS) return 0;
+    if (s_active_bank[model_id] < 0) return 0;
+    const BankHeader* h = (const BankHeader*)(XIP_BASE +
+        bank_offset(model_id, s_active_bank[model_id]));
+    return h->len;
+}
+
+uint32_t model_bank_active_seq(int model_id) {
+    if (model_id < 0 || model_id >= MODEL_BANK_MODELS) return 0;
+    if (s_active_bank[model_id] < 0) return 0;
+    return s_active_seq[model_id];
+}
+
+bool model_bank_update_pending(int model_id) {
+    return s_pending[model_id];
+}
+
+void model_bank_consume(int model_id) {
+    s_pending[model_id] = false;
+}
+
+int model_bank_upload(int model_id, uint32_t len, uint32_t expect_crc) {
+    if (model_id < 0 || model_id >= MODEL_BANK_MODELS) return -1;
+    if (len == 0 || len > BANK_CAPACITY) {
+        LogError(("model bank: length %u exceeds bank capacity %u",
+                  (unsigned)len, (unsigned)BANK_CAPACITY));
+        return -1;
+    }
+
+    int target = (s_active_bank[model_id] == 0) ? 1 : 0;
+    uint32_t base = bank_offset(model_id, target);
+
+    // Stream raw bytes: sector 0 staged in s_first (header bytes left
+    // 0xFF), later sectors programmed as they fill. Nothing here can
+    // hurt the active bank.
+    memset(s_first, 0xFF, sizeof(s_first));
+    memset(s_sector, 0xFF, sizeof(s_sector));
+    uint32_t crc = 0xFFFFFFFFu;
+    uint32_t received = 0;
+    uint32_t sector = 0;
+    size_t fill = sizeof(BankHeader);
+    uint8_t* buf = s_first;
+
+    while (received < len) {
+        int c = getchar_timeout_us(5 * 1000 * 1000);
+        if (c < 0) {
+            LogError(("model bank: upload timed out at byte %u", (unsigned)received));
+            return -1;
+        }
+        buf[fill++] = (uint8_t)c;
+        crc = crc32_step(crc, (uint8_t)c);
+        received++;
+        if (fill == FLASH_SECTOR_SIZE) {
+            if (sector > 0 &&
+                program_sector(base + sector * FLASH_SECTOR_SIZE, buf) != 0)
+                return -1;
+            sector++;
+            buf = s_sector;
+            memset(buf, 0xFF, FLASH_SECTOR_SIZE);
+            fill = 0;
+        }
+    }
+    crc = ~crc;
+    if (crc != expect_crc) {
+        LogError(("model bank: stream CRC %08x != announced %08x",
+                  (unsigned)crc, (unsigned)expect_crc));
+        return -1;
+    }
+    if (sector > 0 && fill > 0 &&
+        program_sector(base + sector * FLASH_SECTOR_SIZE, buf) != 0)
+        return -1;
+
+#if QDNN_MODEL_PREFLIGHT
+    // The preflight wants the whole flatbuffer contiguous, but sector
+    // 0 is normally held back in RAM until the header commit. Program
+    // it now with the header bytes still 0xFF - no magic, so the bank
+    // stays unarmed - flush the cached alias (it may hold lines from
+    // this bank's previous occupant), and validate the flash copy. The
+    // header commit below re-programs sector 0 with the real header; a
+    // rejection returns before it, so "newest valid header" keeps
+    // naming the old bank. Costs one extra erase cycle on sector 0 per
+    // upload, which is noise at upload rates.
+    if (program_sector(base, s_first) != 0) return -1;
+    xip_flush();
+    if (model_preflight_check(model_id,
+                              (const uint8_t*)(XIP_BASE + base + sizeof(BankHeader)),
+                              len) != 0) {
+        LogError(("model bank: preflight rejected the upload, bank left inactive"));
+        return -1;
+    }
+#endif
+
+    // Payload verified in RAM; commit sector 0 with the header last.
+    BankHeader* h = (BankHeader*)s_first;
+    h->magic = MODEL_BANK_MAGIC;
+    h->seq = s_active_seq[model_id] + 1;
+    h->len = len;
+    h->crc32 = crc;
+    h->model_id = (uint32_t)model_id;
+    h->reserved[0] = h->reserved[1] = h->reserved[2] = 0xFFFFFFFFu;
+    if (program_sector(base, s_first) != 0) return -1;
+
+    // Read back the flash copy end to end before handing it out
+    if (!bank_valid(model_id, target)) {
+        model_crc_release();
+        LogError(("model bank: flash readback mismatch, bank left inactive"));
+        return -1;
+    }
+    model_crc_release();
+
+    xip_flush();  // no stale lines under the new payload
+    s_active_bank[model_id] = target;
+    s_active_seq[model_id] = h->seq;
+    s_pending[model_id] = true;
+    LogInfo(("model bank: model %d bank %d armed (seq %u, %u bytes)",
+             model_id, target, (unsigned)h->seq, (unsigned)len));
+    return 0;
+}
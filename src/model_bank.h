@@ -0,0 +1,101 @@
+/**
+ * @file model_bank.h
+ *
+ * @brief Dual-bank flash model storage with over-the-wire update
+ *
+ * Decouples the model flatbuffers from the firmware image: each model
+ * (fan, pump) owns two 32 KB flash banks just below the datalog
+ * region, and a retrained model is uploaded over the console into the
+ * inactive bank while the active one keeps serving inference. The
+ * bank header - magic, monotonic sequence, length, CRC-32 - is
+ * programmed only after the payload has been written and read back
+ * through XIP with a matching CRC, so activation is atomic: a power
+ * cut mid-upload leaves the old bank newest and nothing half-armed.
+ * With QDNN_MODEL_PREFLIGHT the upload also runs an interpreter
+ * preflight on the flash copy before the header commit
+ * (model_preflight.h), so a flatbuffer this image cannot run is
+ * rejected at upload time rather than at the next re-bind.
+ *
+ * Consumption is pull-based at cycle boundaries: the upload sets a
+ * pending flag, and the inference stage that owns the model re-binds
+ * its model slot at the top of its next cycle (a sub-ms replan; see
+ * model_slot.h), so actuation never misses a beat. Empty banks fall
+ * back to the compiled-in headers.
+ *
+ * Flash map (top of flash, growing down): calibration sector, crash
+ * sector, DATALOG_SECTORS of datalog, then 4 x MODEL_BANK_SECTORS of
+ * model banks (fan bank 0/1, pump bank 0/1), then the runtime-config
+ * sector (config_store.h).
+ */
+
+#ifndef MODEL_BANK_H
+#define MODEL_BANK_H
+
+#include "pico/stdlib.h"
+
+/** @brief Models with banked storage. */
+enum ModelBankId {
+    MODEL_BANK_FAN = 0,
+    MODEL_BANK_PUMP = 1,
+    MODEL_BANK_MODELS
+};
+
+/** @brief Bank size: 8 x 4 KB, comfortable over the ~20 KB models. */
+#define MODEL_BANK_SECTORS 8
+
+/**
+ * @brief Scan the banks and validate payload CRCs (DMA sniffer).
+ *
+ * Call once at boot, before core 1 starts; invalid or empty banks are
+ * ignored and the compiled-in model remains active.
+ */
+void model_bank_init(void);
+
+/**
+ * @brief Newest valid payload for a model, or NULL for none.
+ *
+ * The pointer is XIP-resident and stays valid until an upload
+ * overwrites the *other* bank and bumps the sequence - callers pick up
+ * the new pointer through the pending flag, never mid-cycle.
+ */
+const uint8_t* model_bank_active(int model_id);
+
+/**
+ * @brief Payload length of the active bank, 0 for none.
+ *
+ * Same lifetime as the model_bank_active() pointer; the pair describes
+ * the flash range the interpreter executes from (the prefetch stage
+ * streams it through the XIP cache ahead of the invoke).
+ */
+uint32_t model_bank_active_len(int model_id);
+
+/**
+ * @brief Monotonic sequence of the active bank, 0 for compiled-in.
+ *
+ * Identifies WHICH uploaded model made a decision - the replay
+ * records carry it so a field trace names its model generation.
+ */
+uint32_t model_bank_active_seq(int model_id);
+
+/**
+ * @brief True once an upload has activated a new bank; cleared by
+ * model_bank_consume() after the owner re-binds.
+ */
+bool model_bank_update_pending(int model_id);
+
+/** @brief Acknowledge a pending update (from the consuming stage). */
+void model_bank_consume(int model_id);
+
+/**
+ * @brief Receive one model over stdio into the inactive bank.
+ *
+ * Call from the shell after announcing length and expected CRC-32;
+ * reads exactly len raw bytes (5 s inactivity timeout), programs them
+ * sector by sector, verifies the flash copy, then commits the header.
+ *
+ * @return 0 on success, -1 on timeout/size/CRC failure (the active
+ *         bank is untouched either way).
+ */
+int model_bank_upload(int model_id, uint32_t len, uint32_t expect_crc);
+
+#endif
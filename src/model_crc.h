@@ -0,0 +1,43 @@
+/**
+ * @file model_crc.h
+ *
+ * @brief Boot-time model integrity check via the DMA sniffer CRC32
+ *
+ * A corrupted flash sector under a model flatbuffer otherwise shows up
+ * as garbage inference or a hard fault mid-cycle. The RP2040 DMA
+ * sniffer computes CRC32 in hardware alongside an ordinary channel
+ * transfer, so sweeping a ~20 KB model costs one DMA walk over XIP -
+ * and because the check runs as begin/wait halves, the sweep overlaps
+ * GPIO/ADC/calibration init instead of adding boot wall-time.
+ *
+ * The sniffer is configured for standard CRC-32 (IEEE): reflected
+ * calculation, seed 0xFFFFFFFF, result bit-reversed and inverted on
+ * readout - the same value zlib's crc32() produces, which is what the
+ * generated model headers embed as the expected constant.
+ *
+ * One check in flight at a time; the DMA channel is claimed on the
+ * first begin and released after the last wait.
+ */
+
+#ifndef MODEL_CRC_H
+#define MODEL_CRC_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Start a background CRC32 sweep over a flash-resident array.
+ */
+void model_crc_begin(const uint8_t* data, uint32_t len);
+
+/**
+ * @brief Wait for the sweep started by model_crc_begin() and return
+ * the CRC-32 (IEEE) of the data.
+ */
+uint32_t model_crc_wait(void);
+
+/**
+ * @brief Release the DMA channel once all checks are done.
+ */
+void model_crc_release(void);
+
+#endif
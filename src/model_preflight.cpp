@@ -0,0 +1,188 @@
+/**
+ * @file model_preflight.cpp
+ *
+ * @brief Upload-time model validation implementation
+ *
+ * Every check mirrors, at runtime, something the build pins
+ * statically: the op whitelist comes from the generated resolver
+ * header, the shape/dtype contract from the generated descriptors, and
+ * the trial plan runs through the recording allocator exactly like a
+ * failed bind's post-mortem replay (model_slot.cpp) - except here the
+ * verdict arrives before the bank header is committed, not after a
+ * missed cycle.
+ *
+ * The trial arena: a model plan needs the full slice size, which is
+ * far beyond the cycle scratch region, so the trial block is a
+ * transient heap allocation held only for the milliseconds the upload
+ * path runs. Static-alloc builds assert heap_4 stays untouched after
+ * init, so they carry a dedicated .bss block instead - consistent with
+ * that mode's everything-in-the-map philosophy. If no trial block is
+ * available the allocation check is skipped with a logged warning
+ * rather than rejecting a model the structural checks passed.
+ */
+
+#include "model_preflight.h"
+
+#include "FreeRTOS.h"
+
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#include "app_log.h"
+#include "model_bank.h"
+#include "model_meta.h"
+#include "qdnn_model_desc.h"
+#include "qdnn_op_resolver.h"
+
+static size_t s_arena_bytes;
+
+#if QDNN_STATIC_ALLOC
+// Mirrors kArenaSize (main.cpp); the runtime bound from
+// model_preflight_init() is clamped to this capacity.
+#ifndef QDNN_PREFLIGHT_ARENA_BYTES
+#define QDNN_PREFLIGHT_ARENA_BYTES (12 * 1024)
+#endif
+static uint8_t s_trial_arena[QDNN_PREFLIGHT_ARENA_BYTES] __attribute__((aligned(16)));
+#endif
+
+// Expected output width per bank: the class count is pinned because
+// the fan and pump heads share the LevelFilter/LED plumbing; the input
+// width is free within the feature builder's range (see main.cpp).
+static int expected_classes(int model_id) {
+#if QDNN_COMBO_MODEL
+    (void)model_id;
+    return qdnn_desc_last_dim(kQdnnComboModelDesc.output);
+#else
+    return model_id == MODEL_BANK_FAN
+               ? qdnn_desc_last_dim(kQdnnFanModelDesc.output)
+               : qdnn_desc_last_dim(kQdnnPumpModelDesc.output);
+#endif
+}
+
+static bool op_whitelisted(int32_t code) {
+    for (int i = 0; i < QDNN_NUM_OPS; i++)
+        if (kQdnnOpWhitelist[i] == code) return true;
+    return false;
+}
+
+static int shape_last_dim(const tflite::Tensor* t) {
+    const auto* shape = t->shape();
+    if (shape == nullptr || shape->size() == 0) return 0;
+    return shape->Get(shape->size() - 1);
+}
+
+void model_preflight_init(size_t arena_bytes) {
+    s_arena_bytes = arena_bytes;
+#if QDNN_STATIC_ALLOC
+    if (s_arena_bytes > sizeof(s_trial_arena))
+        s_arena_bytes = sizeof(s_trial_arena);
+#endif
+}
+
+int model_preflight_check(int model_id, const uint8_t* data, uint32_t len) {
+    // 1. Structural verification: every offset and vector bound in the
+    //    buffer is checked before anything below dereferences it, so a
+    //    truncated or corrupt table can't walk the preflight itself
+    //    off the payload.
+    flatbuffers::Verifier verifier(data, len);
+    if (!tflite::VerifyModelBuffer(verifier)) {
+        LogError(("preflight: flatbuffer verification failed"));
+        return -1;
+    }
+
+    const tflite::Model* model = tflite::GetModel(data);
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        LogError(("preflight: schema version %u, expected %d",
+                  (unsigned)model->version(), TFLITE_SCHEMA_VERSION));
+        return -1;
+    }
+
+    // 2. Operator walk against the resolver whitelist: anything
+    //    outside the generated registration set would fail op
+    //    resolution at bind time.
+    const auto* op_codes = model->operator_codes();
+    if (op_codes != nullptr) {
+        for (flatbuffers::uoffset_t i = 0; i < op_codes->size(); i++) {
+            int32_t code = (int32_t)tflite::GetBuiltinCode(op_codes->Get(i));
+            if (!op_whitelisted(code)) {
+                LogError(("preflight: builtin op %d not in this image's resolver",
+                          (int)code));
+                return -1;
+            }
+        }
+    }
+
+    // 3. I/O contract: the same bounds main.cpp static_asserts against
+    //    the compiled-in descriptors, applied to subgraph 0.
+    const auto* subgraphs = model->subgraphs();
+    if (subgraphs == nullptr || subgraphs->size() == 0) {
+        LogError(("preflight: model has no subgraphs"));
+        return -1;
+    }
+    const tflite::SubGraph* sg = subgraphs->Get(0);
+    const auto* tensors = sg->tensors();
+    const auto* inputs = sg->inputs();
+    const auto* outputs = sg->outputs();
+    if (tensors == nullptr || inputs == nullptr || outputs == nullptr ||
+        inputs->size() == 0 || outputs->size() == 0) {
+        LogError(("preflight: subgraph missing inputs or outputs"));
+        return -1;
+    }
+    const tflite::Tensor* in = tensors->Get(inputs->Get(0));
+    const tflite::Tensor* out = tensors->Get(outputs->Get(0));
+    if (in->type() != tflite::TensorType_INT8 ||
+        out->type() != tflite::TensorType_INT8) {
+        LogError(("preflight: model is not int8 in/out"));
+        return -1;
+    }
+    int in_width = shape_last_dim(in);
+    if (in_width < 3 || in_width > QDNN_META_MAX_FEATURES) {
+        LogError(("preflight: input width %d outside feature-builder range 3..%d",
+                  in_width, QDNN_META_MAX_FEATURES));
+        return -1;
+    }
+    int out_width = shape_last_dim(out);
+    if (out_width != expected_classes(model_id)) {
+        LogError(("preflight: %d output classes, plumbing expects %d",
+                  out_width, expected_classes(model_id)));
+        return -1;
+    }
+
+    // 4. Trial plan: AllocateTensors() through the recording allocator
+    //    over an arena-sized block, so a plan that outgrew the live
+    //    slice is rejected here with its requested bytes named.
+    if (s_arena_bytes == 0) {
+        LogWarn(("preflight: no arena bound recorded, skipping trial plan"));
+        return 0;
+    }
+#if QDNN_STATIC_ALLOC
+    uint8_t* trial = s_trial_arena;
+#else
+    uint8_t* raw = (uint8_t*)pvPortMalloc(s_arena_bytes + 16);
+    if (raw == nullptr) {
+        LogWarn(("preflight: heap cannot stage a %u-byte trial arena, "
+                 "skipping trial plan", (unsigned)s_arena_bytes));
+        return 0;
+    }
+    uint8_t* trial = (uint8_t*)(((uintptr_t)raw + 15) & ~(uintptr_t)15);
+#endif
+    int rc = 0;
+    {
+        QdnnOpResolver resolver;
+        qdnn_register_ops(resolver);
+        tflite::RecordingMicroInterpreter interp(model, resolver, trial,
+                                                 s_arena_bytes);
+        if (interp.AllocateTensors() != kTfLiteOk) {
+            LogError(("preflight: trial plan needs > %u of %u arena bytes",
+                      (unsigned)interp.GetMicroAllocator()
+                          .GetSimpleMemoryAllocator()->GetRequestedBytes(),
+                      (unsigned)s_arena_bytes));
+            rc = -1;
+        }
+    }  // interpreter torn down before the trial block is returned
+#if !QDNN_STATIC_ALLOC
+    vPortFree(raw);
+#endif
+    return rc;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file model_preflight.h
+ *
+ * @brief Upload-time validation of OTA model flatbuffers
+ *
+ * The model bank's CRC discipline proves the uploaded bytes arrived
+ * and landed in flash intact - it says nothing about whether the
+ * flatbuffer can run on this image. A syntactically valid but wrong
+ * export (an op outside the generated resolver, a reshaped head, a
+ * plan that outgrew the arena slice) sails through the upload and then
+ * fails deep inside AllocateTensors() or Invoke() at the next re-bind,
+ * costing a control cycle and a fallback bind instead of an upload
+ * error the operator sees immediately.
+ *
+ * The preflight runs the contract the build pins statically against
+ * the compiled-in models (the qdnn_model_desc.h static_asserts in
+ * main.cpp) on the uploaded payload while it is still unarmed in
+ * flash: flatbuffer structural verification, an operator-code walk
+ * against the generated resolver's whitelist, input/output shape and
+ * dtype checks, and a trial AllocateTensors() through the recording
+ * allocator over an arena-sized trial block. A rejected upload never
+ * gets its bank header, so "newest valid bank" still names the old
+ * model and nothing downstream notices.
+ *
+ * Enabled with QDNN_MODEL_PREFLIGHT (requires QDNN_MODEL_BANK); the
+ * bank upload path calls the check between payload verification and
+ * header commit.
+ */
+
+#ifndef MODEL_PREFLIGHT_H
+#define MODEL_PREFLIGHT_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Record the live per-model arena slice size for trial plans.
+ *
+ * Call once at boot (main.cpp, beside model_bank_init()) with the
+ * fixed slice each interpreter owns; the preflight plans candidate
+ * models against the same bound.
+ */
+void model_preflight_init(size_t arena_bytes);
+
+/**
+ * @brief Validate an uploaded flatbuffer before its bank is armed.
+ *
+ * @param model_id ModelBankId the payload targets.
+ * @param data     Payload bytes (the XIP-resident flash copy).
+ * @param len      Payload length from the upload announcement.
+ * @return 0 if the model can run on this image, -1 otherwise (the
+ *         specific failure is logged).
+ */
+int model_preflight_check(int model_id, const uint8_t* data, uint32_t len);
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * @file model_shadow.cpp
+ *
+ * @brief Shadow evaluation scoreboard implementation
+ */
+
+#include "model_shadow.h"
+
+#include <stdio.h>
+
+#include "app_log.h"
+#if QDNN_BOOT_LADDER
+#include "boot_ladder.h"
+#endif
+
+static const uint8_t* volatile s_data;
+static volatile bool s_promote_req;
+static volatile bool s_dismiss_req;
+
+// Scoreboard: core 1 writes, the shell reads single words racily.
+// The us sums wrap together after ~71 minutes of accumulated invoke
+// time; the means stay indicative over any realistic evaluation.
+static volatile uint32_t s_batches;
+static volatile uint32_t s_zone_evals;
+static volatile uint32_t s_diverged;
+static volatile uint32_t s_absdelta_sum;
+static volatile uint32_t s_absdelta_max;
+static volatile uint32_t s_errors;
+static volatile uint32_t s_live_us_sum;
+static volatile uint32_t s_shadow_us_sum;
+
+void model_shadow_offer(const uint8_t* model_data) {
+#if QDNN_BOOT_LADDER
+    // Second ladder step: a crash-looping unit stops spending its
+    // spare core-1 headroom auditioning candidates.
+    if (!boot_ladder_allows(LADDER_SHADOW)) {
+        LogWarn(("pump shadow: offer refused (degradation ladder level %d)",
+                 boot_ladder_level()));
+        return;
+    }
+#endif
+    model_shadow_clear();
+    s_data = model_data;
+    LogInfo(("pump shadow: candidate armed, evaluating against live"));
+}
+
+bool model_shadow_armed(void) {
+    return s_data != NULL;
+}
+
+const uint8_t* model_shadow_data(void) {
+    return s_data;
+}
+
+void model_shadow_note(const int* live_levels, const int* shadow_levels,
+                       int zones, uint32_t live_us, uint32_t shadow_us) {
+    for (int z = 0; z < zones; z++) {
+        int d = shadow_levels[z] - live_levels[z];
+        if (d < 0) d = -d;
+        if (d != 0) s_diverged = s_diverged + 1;
+        s_absdelta_sum = s_absdelta_sum + (uint32_t)d;
+        if ((uint32_t)d > s_absdelta_max) s_absdelta_max = (uint32_t)d;
+    }
+    s_zone_evals = s_zone_evals + (uint32_t)zones;
+    s_batches = s_batches + 1;
+    s_live_us_sum = s_live_us_sum + live_us;
+    s_shadow_us_sum = s_shadow_us_sum + shadow_us;
+}
+
+void model_shadow_note_error(void) {
+    s_errors = s_errors + 1;
+}
+
+int model_shadow_request_promote(void) {
+    if (s_data == NULL) return -1;
+    s_promote_req = true;
+    return 0;
+}
+
+int model_shadow_request_dismiss(void) {
+    if (s_data == NULL) return -1;
+    s_dismiss_req = true;
+    return 0;
+}
+
+bool model_shadow_take_promote(void) {
+    if (!s_promote_req) return false;
+    s_promote_req = false;
+    return true;
+}
+
+bool model_shadow_take_dismiss(void) {
+    if (!s_dismiss_req) return false;
+    s_dismiss_req = false;
+    return true;
+}
+
+void model_shadow_clear(void) {
+    s_data = NULL;
+    s_promote_req = false;
+    s_dismiss_req = false;
+    s_batches = 0;
+    s_zone_evals = 0;
+    s_diverged = 0;
+    s_absdelta_sum = 0;
+    s_absdelta_max = 0;
+    s_errors = 0;
+    s_live_us_sum = 0;
+    s_shadow_us_sum = 0;
+}
+
+void model_shadow_report(void) {
+    if (s_data == NULL) {
+        printf("shadow: no candidate armed\n");
+        return;
+    }
+    uint32_t n = s_zone_evals;
+    uint32_t b = s_batches;
+    printf("shadow: candidate under evaluation, %u batches\n", (unsigned)b);
+    printf("  diverged %u/%u zone decisions, |dlevel| mean %u.%02u max %u\n",
+           (unsigned)s_diverged, (unsigned)n,
+           (unsigned)(n ? s_absdelta_sum / n : 0),
+           (unsigned)(n ? (s_absdelta_sum * 100 / n) % 100 : 0),
+           (unsigned)s_absdelta_max);
+    printf("  invoke avg: live %u us, shadow %u us; errors %u\n",
+           (unsigned)(b ? s_live_us_sum / b : 0),
+           (unsigned)(b ? s_shadow_us_sum / b : 0),
+           (unsigned)s_errors);
+}
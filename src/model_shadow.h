@@ -0,0 +1,79 @@
+/**
+ * @file model_shadow.h
+ *
+ * @brief Shadow evaluation slot for candidate pump models
+ *
+ * An OTA pump model used to go live at the next cycle boundary - the
+ * first evidence of a bad retrain was the pumps acting on it. With
+ * shadowing enabled, an upload arms this slot instead: core 1 runs the
+ * candidate over the same zone rows as the live model in its spare
+ * headroom (it would otherwise just block on the next batch), and the
+ * decisions are scored against the live ones - divergence counts,
+ * |level delta| statistics, and a per-batch invoke latency comparison.
+ * The shell's "shadow" command reads the scoreboard; "shadow promote"
+ * swaps the candidate in at the next batch boundary and "shadow drop"
+ * discards it, so a rollout is benchmarked in production before it
+ * touches hardware.
+ *
+ * The candidate shares the live arena: two sub-ms slot rebinds bracket
+ * each evaluation instead of a second tensor arena. While a candidate
+ * is under evaluation the pump inference cache and the quantize-once
+ * handoff stand down (every rebind invalidates them) - shadowing is a
+ * bounded evaluation window, not a steady state.
+ *
+ * This module is only the scoreboard and the shell handshake; the
+ * invokes and rebinds stay with core 1, which owns the pump slot.
+ * Writers: core 1 (stats, clear), drain task (requests). All fields
+ * are single words, read racily by design like the cache counters.
+ */
+
+#ifndef MODEL_SHADOW_H
+#define MODEL_SHADOW_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Arm (or replace) the candidate. Called by the model owner
+ *        when an upload lands; resets the scoreboard.
+ */
+void model_shadow_offer(const uint8_t* model_data);
+
+/** @brief A candidate is armed and being evaluated. */
+bool model_shadow_armed(void);
+
+/** @brief The candidate flatbuffer (XIP-resident), NULL if none. */
+const uint8_t* model_shadow_data(void);
+
+/**
+ * @brief Score one evaluated batch against the live decisions.
+ *
+ * @param live_levels   Levels the live model produced, one per zone.
+ * @param shadow_levels Levels the candidate produced.
+ * @param zones         Row count.
+ * @param live_us       Live batch invoke time.
+ * @param shadow_us     Candidate batch invoke time.
+ */
+void model_shadow_note(const int* live_levels, const int* shadow_levels,
+                       int zones, uint32_t live_us, uint32_t shadow_us);
+
+/** @brief Count a failed candidate invoke or bind. */
+void model_shadow_note_error(void);
+
+/**
+ * @brief Request promotion / dismissal (from the shell).
+ * @return 0 on accepted request, -1 when no candidate is armed.
+ */
+int model_shadow_request_promote(void);
+int model_shadow_request_dismiss(void);
+
+/** @brief Poll-and-clear the requests (model owner, batch boundary). */
+bool model_shadow_take_promote(void);
+bool model_shadow_take_dismiss(void);
+
+/** @brief Drop the candidate and scoreboard after promote/dismiss. */
+void model_shadow_clear(void);
+
+/** @brief Print the scoreboard (shell "shadow"). */
+void model_shadow_report(void);
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file model_slot.cpp
+ *
+ * @brief Re-bindable interpreter slot implementation
+ */
+
+#include "model_slot.h"
+
+#include <new>
+
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "app_log.h"
+#include "err_stats.h"
+
+void model_slot_init(ModelSlot* slot, uint8_t* arena, size_t arena_size) {
+    slot->interp = nullptr;
+    slot->model = nullptr;
+    slot->model_data = nullptr;
+    slot->arena = arena;
+    slot->arena_size = arena_size;
+    qdnn_register_ops(slot->resolver);
+}
+
+int model_slot_bind(ModelSlot* slot, const unsigned char* model_data) {
+    if (slot->interp != nullptr && slot->model_data == model_data) return 0;
+
+    if (slot->interp != nullptr) {
+        slot->interp->~MicroInterpreter();
+        slot->interp = nullptr;
+        slot->model_data = nullptr;
+    }
+
+    const tflite::Model* model = tflite::GetModel(model_data);
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        err_stats_bump(ERR_MODEL_BIND);
+        LogError(("model slot: schema version %u, expected %d",
+                  (unsigned)model->version(), TFLITE_SCHEMA_VERSION));
+        return -1;
+    }
+
+    tflite::MicroInterpreter* interp = new (slot->interp_buf)
+        tflite::MicroInterpreter(model, slot->resolver, slot->arena, slot->arena_size);
+    if (interp->AllocateTensors() != kTfLiteOk) {
+        interp->~MicroInterpreter();
+        err_stats_bump(ERR_MODEL_BIND);
+        // Replay the failed plan through the recording allocator: it
+        // tallies requested bytes up to the point the arena ran out, so
+        // the log carries a hard lower bound on what this graph needs
+        // instead of just the fact that it did not fit.
+        {
+            tflite::RecordingMicroInterpreter rec(model, slot->resolver,
+                                                  slot->arena, slot->arena_size);
+            rec.AllocateTensors();
+            LogError(("model slot: AllocateTensors failed, plan needs > %u of %u arena bytes",
+                      (unsigned)rec.GetMicroAllocator()
+                          .GetSimpleMemoryAllocator()->GetRequestedBytes(),
+                      (unsigned)slot->arena_size));
+        }
+        return -1;
+    }
+
+    slot->interp = interp;
+    slot->model = model;
+    slot->model_data = model_data;
+    return 0;
+}
+
+int model_slot_bind_verified(ModelSlot* slot, const unsigned char* model_data,
+                             const unsigned char* fallback_data) {
+    if (model_slot_bind(slot, model_data) == 0) return 0;
+    if (fallback_data != nullptr && fallback_data != model_data &&
+        model_slot_bind(slot, fallback_data) == 0) {
+        LogError(("model slot: running on fallback model"));
+        return 1;
+    }
+    return -1;
+}
+
+tflite::MicroInterpreter* model_slot_interpreter(ModelSlot* slot) {
+    return slot->interp;
+}
+
+const tflite::Model* model_slot_model(ModelSlot* slot) {
+    return slot->model;
+}
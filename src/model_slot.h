@@ -0,0 +1,86 @@
+/**
+ * @file model_slot.h
+ *
+ * @brief Re-bindable interpreter slot for rotating model flatbuffers
+ *
+ * A MicroInterpreter binds one model at construction, which is why the
+ * firmware carries one instance per model today. For the multi-zone
+ * roadmap where zone-specific pump models rotate through one core, a
+ * slot keeps the long-lived pieces - the arena, the registered op
+ * resolver and the interpreter storage itself - and re-binding to
+ * another flatbuffer is a placement re-init plus AllocateTensors() on
+ * the new graph. For the two-op models this firmware runs that replan
+ * is well under a millisecond; everything that makes a cold start
+ * expensive (resolver registration, static construction, arena zeroing)
+ * happens once in model_slot_init().
+ *
+ * The vendored tflite-micro has no allocator-level re-bind path (the
+ * memory plan is computed against one model), so the replan is the
+ * irreducible cost of a switch; the slot eliminates the rest.
+ */
+
+#ifndef MODEL_SLOT_H
+#define MODEL_SLOT_H
+
+#include "pico/stdlib.h"
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+#include "qdnn_op_resolver.h"
+
+struct ModelSlot {
+    alignas(alignof(tflite::MicroInterpreter))
+    uint8_t interp_buf[sizeof(tflite::MicroInterpreter)];
+    QdnnOpResolver resolver;              ///< registered once in init
+    tflite::MicroInterpreter* interp;     ///< nullptr until first bind
+    const tflite::Model* model;           ///< parsed view of model_data
+    const unsigned char* model_data;      ///< flatbuffer currently bound
+    uint8_t* arena;
+    size_t arena_size;
+};
+
+/**
+ * @brief Prepare a slot over an arena. No model is bound yet.
+ */
+void model_slot_init(ModelSlot* slot, uint8_t* arena, size_t arena_size);
+
+/**
+ * @brief Bind the slot to a model flatbuffer (no-op if already bound).
+ *
+ * Tears down the previous interpreter in place and replans over the
+ * same arena. Tensor pointers and quant contexts taken from the slot
+ * before the call are invalid after it.
+ *
+ * @return 0 on success, -1 on schema mismatch or allocation failure
+ *         (the slot is left unbound).
+ */
+int model_slot_bind(ModelSlot* slot, const unsigned char* model_data);
+
+/**
+ * @brief Verifying bring-up: bind model_data, fall back on failure.
+ *
+ * Both failure classes are checked and counted (ERR_MODEL_BIND, so the
+ * fault reaches the telemetry error frame): a schema mismatch and an
+ * arena that cannot hold the plan - the latter logged with
+ * required-vs-available bytes from a recording-allocator replay. On
+ * failure the slot re-binds fallback_data (typically the last-good or
+ * compiled-in flatbuffer) so the unit degrades to a logged known model
+ * instead of running with invalid tensors.
+ *
+ * @return 0 model_data bound, 1 fallback bound (degraded), -1 nothing
+ *         bound (the slot is unbound; callers must not invoke).
+ */
+int model_slot_bind_verified(ModelSlot* slot, const unsigned char* model_data,
+                             const unsigned char* fallback_data);
+
+/**
+ * @brief The bound interpreter (valid after a successful bind).
+ */
+tflite::MicroInterpreter* model_slot_interpreter(ModelSlot* slot);
+
+/**
+ * @brief Parsed view of the bound flatbuffer (for the boot audits).
+ */
+const tflite::Model* model_slot_model(ModelSlot* slot);
+
+#endif
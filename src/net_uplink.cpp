@@ -0,0 +1,178 @@
+/**
+ * @file net_uplink.cpp
+ *
+ * @brief WiFi uplink implementation (Pico W builds only)
+ *
+ * Same free-running SPSC ring as log_ring: producers only advance
+ * head, the uplink task only advances tail. The cyw43 arch is the
+ * threadsafe_background flavor, so lwIP runs off an async context and
+ * every call from this task sits between cyw43_arch_lwip_begin/end.
+ */
+
+#if QDNN_NET_UPLINK
+
+#include "net_uplink.h"
+
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "lwip/udp.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "app_log.h"
+
+// Compile-time site config, baked by CMake (QDNN_WIFI_SSID etc.)
+#ifndef QDNN_WIFI_SSID
+#define QDNN_WIFI_SSID ""
+#endif
+#ifndef QDNN_WIFI_PASS
+#define QDNN_WIFI_PASS ""
+#endif
+#ifndef QDNN_UPLINK_HOST
+#define QDNN_UPLINK_HOST "192.168.1.2"
+#endif
+#ifndef QDNN_UPLINK_PORT
+#define QDNN_UPLINK_PORT 9000
+#endif
+
+#define NET_RING_SIZE        4096   // power of two; ~4 min of frames at default cadence
+#define NET_BATCH_MAX        1024   // one UDP payload, comfortably under the MTU
+#define NET_FLUSH_MS         5000   // flush deadline when traffic is light
+#define NET_POLL_MS          100    // ring check cadence between flushes
+#define NET_CONNECT_TIMEOUT_MS 15000
+#define NET_RETRY_BACKOFF_MS 30000
+
+static uint8_t s_buf[NET_RING_SIZE];
+static volatile uint32_t s_head = 0;
+static volatile uint32_t s_tail = 0;
+static volatile uint32_t s_dropped = 0;
+
+// Flush-deadline stretch, set by the energy budget governor: the
+// full-payload trigger stays (a full batch costs the same to send
+// whenever it goes), only light-traffic flushes get lazier.
+static volatile uint8_t s_flush_scale = 1;
+
+void net_uplink_set_flush_scale(uint8_t scale) {
+    s_flush_scale = scale == 0 ? 1 : scale;
+}
+
+#define NET_RING_MASK (NET_RING_SIZE - 1)
+
+size_t net_uplink_push(const uint8_t* data, size_t len) {
+    uint32_t head = s_head;
+    uint32_t used = head - s_tail;
+    if (len > NET_RING_SIZE - used) {
+        s_dropped = s_dropped + 1;
+        return 0;  // drop whole, keep frame boundaries intact
+    }
+    for (size_t i = 0; i < len; i++)
+        s_buf[(head + i) & NET_RING_MASK] = data[i];
+    __dmb();
+    s_head = head + len;
+    return len;
+}
+
+uint32_t net_uplink_dropped(void) {
+    return s_dropped;
+}
+
+static size_t ring_read(uint8_t* out, size_t maxlen) {
+    uint32_t tail = s_tail;
+    uint32_t avail = s_head - tail;
+    if (avail == 0) return 0;
+    if (avail > maxlen) avail = maxlen;
+    for (size_t i = 0; i < avail; i++)
+        out[i] = s_buf[(tail + i) & NET_RING_MASK];
+    __dmb();
+    s_tail = tail + avail;
+    return avail;
+}
+
+/** @brief One datagram per call; true if the send went out. */
+static bool send_batch(struct udp_pcb* pcb, const ip_addr_t* dest,
+                       const uint8_t* data, size_t len) {
+    cyw43_arch_lwip_begin();
+    struct pbuf* p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)len, PBUF_RAM);
+    err_t err = ERR_MEM;
+    if (p != NULL) {
+        memcpy(p->payload, data, len);
+        err = udp_sendto(pcb, p, dest, QDNN_UPLINK_PORT);
+        pbuf_free(p);
+    }
+    cyw43_arch_lwip_end();
+    return err == ERR_OK;
+}
+
+void net_uplink_task(void*) {
+    if (QDNN_WIFI_SSID[0] == '\0') {
+        LogWarn(("net: no SSID configured (QDNN_WIFI_SSID), uplink idle"));
+        vTaskDelete(NULL);
+    }
+    if (cyw43_arch_init() != 0) {
+        LogError(("net: cyw43 init failed, uplink disabled"));
+        vTaskDelete(NULL);
+    }
+    cyw43_arch_enable_sta_mode();
+
+    ip_addr_t dest;
+    if (!ipaddr_aton(QDNN_UPLINK_HOST, &dest)) {
+        LogError(("net: bad collector address '%s', uplink disabled",
+                  QDNN_UPLINK_HOST));
+        vTaskDelete(NULL);
+    }
+
+    struct udp_pcb* pcb = NULL;
+    static uint8_t batch[NET_BATCH_MAX];
+    bool up = false;
+    TickType_t last_flush = xTaskGetTickCount();
+
+    while (true) {
+        if (!up) {
+            LogInfo(("net: connecting to '%s'", QDNN_WIFI_SSID));
+            if (cyw43_arch_wifi_connect_timeout_ms(QDNN_WIFI_SSID, QDNN_WIFI_PASS,
+                    CYW43_AUTH_WPA2_AES_PSK, NET_CONNECT_TIMEOUT_MS) != 0) {
+                // Frames keep accumulating (and eventually dropping)
+                // in the ring; the control loop never notices.
+                LogWarn(("net: connect failed, retry in %u s",
+                         NET_RETRY_BACKOFF_MS / 1000));
+                vTaskDelay(pdMS_TO_TICKS(NET_RETRY_BACKOFF_MS));
+                continue;
+            }
+            if (pcb == NULL) {
+                cyw43_arch_lwip_begin();
+                pcb = udp_new();
+                cyw43_arch_lwip_end();
+            }
+            LogInfo(("net: up, uplink to %s:%u", QDNN_UPLINK_HOST,
+                     (unsigned)QDNN_UPLINK_PORT));
+            up = true;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(NET_POLL_MS));
+
+        // Batch policy: send when a full payload is waiting, or when
+        // the flush deadline passes with anything at all queued.
+        uint32_t avail = s_head - s_tail;
+        TickType_t now = xTaskGetTickCount();
+        if (avail < NET_BATCH_MAX &&
+            (avail == 0 ||
+             now - last_flush < pdMS_TO_TICKS(NET_FLUSH_MS) * s_flush_scale))
+            continue;
+        last_flush = now;
+
+        size_t n;
+        while ((n = ring_read(batch, sizeof(batch))) > 0) {
+            if (!send_batch(pcb, &dest, batch, n)) break;  // backlog waits for next pass
+            if (n < sizeof(batch)) break;                  // ring drained
+        }
+
+        if (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) != CYW43_LINK_UP) {
+            LogWarn(("net: link lost, reconnecting"));
+            up = false;
+        }
+    }
+}
+
+#endif  // QDNN_NET_UPLINK
@@ -0,0 +1,53 @@
+/**
+ * @file net_uplink.h
+ *
+ * @brief Batched WiFi telemetry uplink for the Pico W variant
+ *
+ * The wired fleet needs a serial harvester per unit; the Pico W build
+ * (-DQDNN_PICO_W=ON) uplinks the same binary frame stream over UDP
+ * instead. Frames tee into a second deferred ring at emit time, and a
+ * background task drains them in batches - one datagram per flush -
+ * because at our frame rates the radio wake cost dwarfs the payload
+ * cost, so the power bill is per send, not per frame.
+ *
+ * The stream stays byte-oriented exactly like the serial path: frames
+ * may straddle datagram boundaries and the collector resyncs on SOF,
+ * so the same host decoder works on both transports.
+ *
+ * Decoupling from the control loop is total: the push is the same
+ * non-blocking ring write the console uses, and every lwIP/cyw43 call
+ * lives in the uplink task. A dead AP costs the control path nothing
+ * but a fuller ring.
+ */
+
+#ifndef NET_UPLINK_H
+#define NET_UPLINK_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Push frame bytes into the uplink ring without blocking.
+ *
+ * @return len on success, 0 if the ring had no room (frame dropped whole).
+ */
+size_t net_uplink_push(const uint8_t* data, size_t len);
+
+/**
+ * @brief Number of frames dropped because the ring was full.
+ */
+uint32_t net_uplink_dropped(void);
+
+/**
+ * @brief Stretch the light-traffic flush deadline by a factor (min 1).
+ *
+ * Energy budget derate hook: a full batch still sends immediately,
+ * only the "anything queued" deadline gets lazier.
+ */
+void net_uplink_set_flush_scale(uint8_t scale);
+
+/**
+ * @brief Uplink task entry: WiFi bring-up, reconnect, batch + send loop.
+ */
+void net_uplink_task(void* params);
+
+#endif
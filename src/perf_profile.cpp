@@ -0,0 +1,92 @@
+/**
+ * @file perf_profile.cpp
+ *
+ * @brief Performance profile implementation
+ *
+ * Boost sequencing: raise the core voltage and let it settle, widen
+ * the QSPI divider so the flash never sees more than its rated clock,
+ * then raise the PLL. Dropping back runs the same steps in reverse.
+ * The divider write runs from SRAM with interrupts off because the SSI
+ * must be disabled while XIP code cannot be fetched.
+ */
+
+#include "perf_profile.h"
+
+#include "hardware/clocks.h"
+#include "hardware/structs/ssi.h"
+#include "hardware/structs/systick.h"
+#include "hardware/sync.h"
+#include "hardware/uart.h"
+#include "hardware/vreg.h"
+#include "pico/stdlib.h"
+
+static PerfProfile s_profile = PERF_PROFILE_NORMAL;
+
+// Reprogram the XIP SSI clock divider. Must execute from SRAM: the SSI
+// is disabled across the write, so nothing may fetch from flash.
+static void __no_inline_not_in_flash_func(xip_set_clkdiv)(uint32_t div) {
+    uint32_t save = save_and_disable_interrupts();
+    ssi_hw->ssienr = 0;
+    ssi_hw->baudr = div;
+    ssi_hw->ssienr = 1;
+    restore_interrupts(save);
+}
+
+// Peripherals keep their own fixed reference across profile switches:
+// clk_peri from the 48 MHz USB PLL instead of clk_sys. Re-applied after
+// every switch because the SDK clock setters point clk_peri back at
+// clk_sys.
+static void peri_reclock(void) {
+    clock_configure(clk_peri, 0,
+                    CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB,
+                    48 * MHZ, 48 * MHZ);
+}
+
+void perf_profile_init(void) {
+    peri_reclock();
+    uart_set_baudrate(uart0, PICO_DEFAULT_UART_BAUD_RATE);
+}
+
+// SysTick counts clk_sys cycles and the port computes its reload at
+// scheduler start; keep the 1 kHz RTOS tick exact after a clock switch.
+// A disabled SysTick (benchmark image, pre-scheduler code) is left alone.
+static void systick_retune(void) {
+    if (systick_hw->csr & 1u) {
+        systick_hw->rvr = clock_get_hz(clk_sys) / 1000 - 1;
+        systick_hw->cvr = 0;
+    }
+}
+
+void perf_profile_apply(PerfProfile profile) {
+    if (profile == s_profile) return;
+
+    // Voltage leads rising clocks and trails falling ones, so the core
+    // never runs a clock its current voltage can't carry.
+    if (profile == PERF_PROFILE_BOOST) {
+        vreg_set_voltage(VREG_VOLTAGE_1_15);
+        sleep_us(500);            // let the regulator settle before loading it
+        xip_set_clkdiv(4);        // flash at 62.5 MHz once clk_sys hits 250
+        set_sys_clock_khz(250000, true);
+    } else if (profile == PERF_PROFILE_NORMAL) {
+        if (s_profile == PERF_PROFILE_ECO) {
+            vreg_set_voltage(VREG_VOLTAGE_DEFAULT);
+            sleep_us(500);
+            set_sys_clock_khz(125000, true);
+        } else {
+            set_sys_clock_khz(125000, true);
+            xip_set_clkdiv(2);    // back to the boot-2 divider
+            vreg_set_voltage(VREG_VOLTAGE_DEFAULT);
+        }
+    } else {
+        set_sys_clock_48mhz();    // clk_sys off the USB PLL, sys PLL powered down
+        xip_set_clkdiv(2);
+        vreg_set_voltage(VREG_VOLTAGE_1_00);
+    }
+    s_profile = profile;
+    peri_reclock();
+    systick_retune();
+}
+
+PerfProfile perf_profile_get(void) {
+    return s_profile;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file perf_profile.h
+ *
+ * @brief System clock performance profiles (normal / boost)
+ *
+ * Invoke time scales almost linearly with the core clock, so the boost
+ * profile runs the RP2040 at 250 MHz with the core voltage raised one
+ * step and the QSPI divider widened to keep the flash inside its rated
+ * clock. The eco profile runs clk_sys straight off the 48 MHz USB PLL
+ * with the system PLL powered down and the core at 1.00 V - the
+ * resting state for DVFS between control cycles. Peripherals are
+ * re-derived once at init: clk_peri moves to the fixed 48 MHz USB PLL,
+ * so UART baud rates (and the ADC sampler, which already runs off
+ * clk_adc at 48 MHz) are unaffected by profile switches. When the RTOS
+ * tick is live, each switch retunes SysTick so the 1 kHz tick stays
+ * exact under the new clk_sys.
+ */
+
+#ifndef PERF_PROFILE_H
+#define PERF_PROFILE_H
+
+#include "pico/stdlib.h"
+
+enum PerfProfile {
+    PERF_PROFILE_ECO,     ///< 48 MHz straight off the USB PLL, 1.00 V, sys PLL down
+    PERF_PROFILE_NORMAL,  ///< 125 MHz, default voltage, QSPI div 2
+    PERF_PROFILE_BOOST,   ///< 250 MHz, 1.15 V, QSPI div 4
+};
+
+/**
+ * @brief One-time peripheral clock re-derivation; call before the first apply.
+ *
+ * Moves clk_peri to the 48 MHz USB PLL so later profile switches never
+ * change peripheral timing, then re-baudens the stdio UART once.
+ */
+void perf_profile_init(void);
+
+/**
+ * @brief Switch the system clock to @p profile.
+ *
+ * Safe to call at runtime from the control task; the switch itself
+ * takes a few hundred microseconds (voltage settle dominates).
+ */
+void perf_profile_apply(PerfProfile profile);
+
+/**
+ * @brief Profile currently in effect.
+ */
+PerfProfile perf_profile_get(void);
+
+#endif
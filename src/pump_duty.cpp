@@ -0,0 +1,142 @@
+/**
+ * @file pump_duty.cpp
+ *
+ * @brief Pump run-time accumulators and daily rollover
+ */
+
+#include "pump_duty.h"
+
+#include <string.h>
+
+#include "board_profile.h"
+#include "hardware/sync.h"
+
+#include "warm_state.h"
+
+struct ZoneAcc {
+    uint64_t on_us;
+    uint64_t level_us;
+    uint32_t starts;
+    uint64_t t_open;  ///< capture stamp of the last transition to on
+    uint8_t level;    ///< committed level as of t_open
+};
+
+static ZoneAcc s_zone[BOARD_MAX_ZONES];
+static int s_zones;
+static uint64_t s_day_t0;
+static uint16_t s_day;
+
+// Fold the interval since the last transition into the accumulators
+// and restart it at `now`. Caller holds interrupts off.
+static void close_interval(ZoneAcc* a, uint64_t now) {
+    if (a->level > 0) {
+        uint64_t dur = now - a->t_open;
+        a->on_us += dur;
+        a->level_us += dur * a->level;
+    }
+    a->t_open = now;
+}
+
+void pump_duty_note(int zone, int level) {
+    if (zone < 0 || zone >= BOARD_MAX_ZONES) return;
+    ZoneAcc* a = &s_zone[zone];
+    if (zone >= s_zones) s_zones = zone + 1;
+    if ((uint8_t)level == a->level) return;  // steady state: no capture read
+
+    uint64_t now = time_us_64();
+    uint32_t irq = save_and_disable_interrupts();
+    close_interval(a, now);
+    if (a->level == 0 && level > 0) a->starts++;
+    a->level = (uint8_t)level;
+    restore_interrupts(irq);
+}
+
+void pump_duty_collect(int zone, PumpDutySnap* out) {
+    memset(out, 0, sizeof(*out));
+    if (zone < 0 || zone >= BOARD_MAX_ZONES) return;
+    ZoneAcc* a = &s_zone[zone];
+
+    uint64_t now = time_us_64();
+    uint32_t irq = save_and_disable_interrupts();
+    out->on_us = a->on_us;
+    out->level_us = a->level_us;
+    out->starts = a->starts;
+    if (a->level > 0) {  // include the run in progress
+        uint64_t dur = now - a->t_open;
+        out->on_us += dur;
+        out->level_us += dur * a->level;
+    }
+    restore_interrupts(irq);
+}
+
+int pump_duty_zones(void) {
+    return s_zones;
+}
+
+int pump_duty_day_close(PumpDutySnap* out, int max_zones, uint16_t* day) {
+    uint64_t now = time_us_64();
+    if (now - s_day_t0 < PUMP_DUTY_DAY_US) return 0;
+
+    int n = s_zones < max_zones ? s_zones : max_zones;
+    uint32_t irq = save_and_disable_interrupts();
+    for (int z = 0; z < n; z++) {
+        ZoneAcc* a = &s_zone[z];
+        close_interval(a, now);  // open runs split at the day boundary
+        out[z].on_us = a->on_us;
+        out[z].level_us = a->level_us;
+        out[z].starts = a->starts;
+        a->on_us = 0;
+        a->level_us = 0;
+        a->starts = 0;
+    }
+    *day = s_day++;
+    s_day_t0 += PUMP_DUTY_DAY_US;  // hold the grid, no boundary drift
+    restore_interrupts(irq);
+    return n;
+}
+
+// Checkpoint image: closed day totals only. Open-run bookkeeping
+// (t_open, level) is deliberately absent - the stamps are this boot's
+// clock and the brown-out path forces the pumps off anyway.
+struct DutyPersist {
+    PumpDutySnap zone[BOARD_MAX_ZONES];
+    uint64_t day_elapsed_us;  ///< into the current day at checkpoint
+    uint16_t day;
+    uint8_t zones;
+};
+
+void pump_duty_checkpoint(void) {
+    DutyPersist p;
+    memset(&p, 0, sizeof(p));
+    uint64_t now = time_us_64();
+    uint32_t irq = save_and_disable_interrupts();
+    for (int z = 0; z < s_zones; z++) {
+        close_interval(&s_zone[z], now);
+        p.zone[z].on_us = s_zone[z].on_us;
+        p.zone[z].level_us = s_zone[z].level_us;
+        p.zone[z].starts = s_zone[z].starts;
+    }
+    p.day_elapsed_us = now - s_day_t0;
+    p.day = s_day;
+    p.zones = (uint8_t)s_zones;
+    restore_interrupts(irq);
+    warm_state_save(WARM_SLOT_DUTY, &p, sizeof(p));
+}
+
+bool pump_duty_restore(void) {
+    DutyPersist p;
+    if (!warm_state_restore(WARM_SLOT_DUTY, &p, sizeof(p))) return false;
+    if (p.zones > BOARD_MAX_ZONES ||
+        p.day_elapsed_us > PUMP_DUTY_DAY_US) return false;
+    for (int z = 0; z < p.zones; z++) {
+        s_zone[z].on_us = p.zone[z].on_us;
+        s_zone[z].level_us = p.zone[z].level_us;
+        s_zone[z].starts = p.zone[z].starts;
+    }
+    s_zones = p.zones;
+    s_day = p.day;
+    // Re-anchor the boundary so the restored day still spans 24 h of
+    // metered time: the elapsed share moves behind this boot's zero.
+    s_day_t0 = (uint64_t)0 - p.day_elapsed_us;
+    return true;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file pump_duty.h
+ *
+ * @brief Per-zone pump run-time metering from actuation transitions
+ *
+ * Water delivered is the product, and "pump level 3" on a bar graph is
+ * not a measurement. This module timestamps every pump level transition
+ * at the actuation commit with the timer's latched capture pair
+ * (time_us_64() reads TIMELR, which freezes TIMEHR for the high half)
+ * and integrates the intervals into per-zone 64-bit microsecond
+ * accumulators: plain on-time and a level-weighted sum (level x us, the
+ * flow proxy for PWM builds where level scales the duty). Cost per
+ * control cycle is one compare per zone, plus one capture read on the
+ * cycles where a level actually changes - runs between transitions are
+ * one closed interval, however long.
+ *
+ * Accounting rolls over every 24 h of uptime: the report task closes
+ * the day, ships the totals as a telemetry frame (SOF 0xB4), and the
+ * datalog tee makes that the on-flash daily record. Day boundaries are
+ * uptime-relative, not wall-clock; the host aligns them via the frame
+ * timestamp and its own time-sync history.
+ *
+ * Accumulators are written by the report task (commit path) and read
+ * by the shell task; both sides take a short IRQ-off window, so 64-bit
+ * values never tear on this single-core scheduler.
+ */
+
+#ifndef PUMP_DUTY_H
+#define PUMP_DUTY_H
+
+#include "pico/stdlib.h"
+
+/** @brief Accounting period: totals reset and ship once per day. */
+#define PUMP_DUTY_DAY_US (24ull * 60 * 60 * 1000000)
+
+/** @brief One zone's totals for the current (or a closed) day. */
+struct PumpDutySnap {
+    uint64_t on_us;     ///< pump on, any level
+    uint64_t level_us;  ///< sum of level x interval (flow proxy)
+    uint32_t starts;    ///< off-to-on transitions
+};
+
+/**
+ * @brief Record the committed level for a zone.
+ *
+ * Call from the actuation commit, after arming/clamping, every cycle;
+ * unchanged levels return without touching the timer.
+ */
+void pump_duty_note(int zone, int level);
+
+/** @brief Day-to-date totals for a zone, open run included. */
+void pump_duty_collect(int zone, PumpDutySnap* out);
+
+/** @brief Number of zones that have reported a level (for display). */
+int pump_duty_zones(void);
+
+/**
+ * @brief Close the day if PUMP_DUTY_DAY_US has elapsed.
+ *
+ * Copies up to max_zones day totals into out, resets the accumulators
+ * (open runs carry into the new day), and bumps the day index.
+ *
+ * @return Zones copied, or 0 while the current day is still running.
+ */
+int pump_duty_day_close(PumpDutySnap* out, int max_zones, uint16_t* day);
+
+/**
+ * @brief Emergency checkpoint into the reset-retained region.
+ *
+ * Closes the open runs up to now and saves the day totals to
+ * WARM_SLOT_DUTY - a memcpy plus a checksum over ~100 bytes, safe from
+ * IRQ context and fast enough for a brown-out hold-up window. The
+ * accumulators keep running; calling this does not end the day.
+ */
+void pump_duty_checkpoint(void);
+
+/**
+ * @brief Restore a checkpoint left by a brown-out or reset.
+ *
+ * Call once at boot, before the control tasks start. The day continues
+ * where the checkpoint left it, with its boundary re-anchored to this
+ * boot's clock (day boundaries are uptime-relative; the reset gap is
+ * unmetered either way, since the pumps were forced off).
+ *
+ * @return true when a valid checkpoint was adopted.
+ */
+bool pump_duty_restore(void);
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file pwm_actuate.cpp
+ *
+ * @brief DMA-chained PWM actuation backend implementation
+ *
+ * Carrier: 25 kHz above the audible band, 1000-count resolution.
+ * Pacer: a spare slice wrapping at PWM_RAMP_STEPS / PWM_RAMP_MS, whose
+ * wrap DREQ paces the ramp DMA (the DMA pacing timers cannot divide
+ * clk_sys far enough down for a 100 Hz step rate - their 16-bit
+ * fraction bottoms out around 2 kHz - so a slice does the job).
+ */
+
+#include "pwm_actuate.h"
+
+#include "hardware/dma.h"
+#include "hardware/pwm.h"
+
+#include "app_log.h"
+#include "resource_map.h"
+
+// Carrier: clk_sys 125 MHz / 5 / 1000 = 25 kHz
+#define PWM_CARRIER_WRAP 999
+#define PWM_CARRIER_DIV  5.0f
+
+// Pacer: 125 MHz / 250 / (PACER_WRAP+1) = PWM_RAMP_STEPS/PWM_RAMP_MS
+#define PWM_PACER_DIV  250.0f
+#define PWM_PACER_WRAP (125000000u / 250u * PWM_RAMP_MS / 1000u / PWM_RAMP_STEPS - 1u)
+
+// Shared ramp tables: duty sequence for every from->to level pair,
+// linear, last entry exactly the target duty. 5*5*50 u16 = 2.5 KB,
+// folded at compile time so the whole block lives in .rodata (flash)
+// instead of SRAM - the DMA streams straight from XIP, and at the
+// 100 Hz step rate that is far below any contention concern.
+struct RampTables {
+    uint16_t duty[5][5][PWM_RAMP_STEPS];
+};
+
+static constexpr uint16_t level_duty(int level) {
+    return (uint16_t)((uint32_t)level * PWM_CARRIER_WRAP / 4u);
+}
+
+static constexpr RampTables build_ramp_tables() {
+    RampTables t{};
+    for (int from = 0; from < 5; from++) {
+        int32_t d0 = level_duty(from);
+        for (int to = 0; to < 5; to++) {
+            int32_t d1 = level_duty(to);
+            for (int i = 0; i < PWM_RAMP_STEPS; i++)
+                t.duty[from][to][i] =
+                    (uint16_t)(d0 + (d1 - d0) * (i + 1) / PWM_RAMP_STEPS);
+        }
+    }
+    return t;
+}
+static constexpr RampTables s_ramp = build_ramp_tables();
+
+// Slice bookkeeping: no SDK claim API for PWM slices, so track locally
+// which ones this backend has taken (carriers and pacers).
+static bool s_slice_used[NUM_PWM_SLICES];
+
+int pwm_actuate_init(PwmActuator* a, uint gpio) {
+    a->gpio = gpio;
+    a->slice = pwm_gpio_to_slice_num(gpio);
+    a->chan = pwm_gpio_to_channel(gpio);
+    a->level = 0;
+    s_slice_used[a->slice] = true;
+
+    // Carrier slice on the output pin, duty 0 until the first commit
+    gpio_set_function(gpio, GPIO_FUNC_PWM);
+    pwm_set_wrap(a->slice, PWM_CARRIER_WRAP);
+    pwm_set_clkdiv(a->slice, PWM_CARRIER_DIV);
+    pwm_set_chan_level(a->slice, a->chan, 0);
+    pwm_set_enabled(a->slice, true);
+
+    // Pacer: first slice nobody drives a pin from
+    uint pacer;
+    for (pacer = 0; pacer < NUM_PWM_SLICES; pacer++)
+        if (!s_slice_used[pacer]) break;
+    if (pacer == NUM_PWM_SLICES) {
+        LogError(("pwm actuate: out of PWM slices for the pacer"));
+        return -1;
+    }
+    s_slice_used[pacer] = true;
+    a->pacer_slice = pacer;
+    pwm_set_wrap(pacer, PWM_PACER_WRAP);
+    pwm_set_clkdiv(pacer, PWM_PACER_DIV);
+    pwm_set_enabled(pacer, true);
+
+    a->dma_ch = res_claim_dma("pwm_ramp", false);
+    if (a->dma_ch < 0) return -1;
+
+    // 16-bit writes land on the carrier channel's half of the 32-bit
+    // compare register; channel B lives in the upper half.
+    volatile void* cc_addr =
+        (uint8_t*)&pwm_hw->slice[a->slice].cc + (a->chan == PWM_CHAN_B ? 2 : 0);
+
+    dma_channel_config c = dma_channel_get_default_config(a->dma_ch);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pwm_get_dreq(a->pacer_slice));
+    dma_channel_configure(a->dma_ch, &c, cc_addr, NULL, 0, false);
+    return 0;
+}
+
+void pwm_actuate_set_level(PwmActuator* a, int level) {
+    if (level < 0) level = 0;
+    if (level > 4) level = 4;
+    if (level == a->level) return;
+
+    // A ramp still in flight is aborted; the new table starts from the
+    // previous committed duty, so the worst case is a small step. At
+    // the control cadence (dwell-filtered, cycles apart) a 500 ms ramp
+    // is always long done.
+    if (dma_channel_is_busy(a->dma_ch)) dma_channel_abort(a->dma_ch);
+
+    dma_channel_set_read_addr(a->dma_ch, s_ramp.duty[a->level][level], false);
+    dma_channel_set_trans_count(a->dma_ch, PWM_RAMP_STEPS, true);
+    a->level = level;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file pwm_actuate.h
+ *
+ * @brief DMA-chained PWM soft-start backend for fan and pump drive
+ *
+ * Production units drive MOSFET fans and pumps, which want duty ramps
+ * rather than the bar-graph LED banks of the bench build. A level
+ * change here enqueues one of the precomputed duty ramp tables and the
+ * hardware does the rest: a DMA channel streams the table into the PWM
+ * slice's compare register, paced by a dedicated pacer slice whose
+ * wrap DREQ fires at the ramp step rate. A 500 ms soft start therefore
+ * costs the CPU two DMA register writes - the control loop commits a
+ * transition in O(1) and never revisits it.
+ *
+ * Per actuator: one PWM slice for the 25 kHz carrier on the output
+ * pin, one pin-less pacer slice for the step clock, one DMA channel.
+ * Enabled with QDNN_PWM_ACTUATION; the LED bank backend stays the
+ * default for bench units.
+ */
+
+#ifndef PWM_ACTUATE_H
+#define PWM_ACTUATE_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Soft-start ramp duration and resolution.
+ */
+#define PWM_RAMP_MS    500
+#define PWM_RAMP_STEPS 50
+
+struct PwmActuator {
+    uint gpio;          ///< output pin (MOSFET gate)
+    uint slice;         ///< carrier slice driving the pin
+    uint chan;          ///< carrier channel (A/B) on that slice
+    uint pacer_slice;   ///< pin-less slice supplying the step DREQ
+    int dma_ch;         ///< channel streaming the ramp table
+    int level;          ///< last committed level (0..4)
+};
+
+/**
+ * @brief Bring up one actuator: carrier, pacer and DMA channel.
+ *
+ * The shared ramp tables are compile-time constants in flash; nothing
+ * is built at init beyond the hardware setup.
+ *
+ * @return 0 on success, -1 when out of PWM slices or DMA channels.
+ */
+int pwm_actuate_init(PwmActuator* a, uint gpio);
+
+/**
+ * @brief Commit a level transition; the ramp runs in hardware.
+ *
+ * O(1): aborts any ramp still in flight (cannot happen at the control
+ * cadence - the dwell filter spaces transitions by two cycles) and
+ * points the DMA channel at the precomputed table for this from/to
+ * pair. No-op when the level is unchanged.
+ */
+void pwm_actuate_set_level(PwmActuator* a, int level);
+
+#endif
@@ -0,0 +1,614 @@
+/**
+ * @file qdnn_benchmark.cpp
+ *
+ * @brief On-target benchmark suite for the QDNN fan and pump models
+ *
+ * Separate firmware image (qdnn_benchmark.uf2, built when
+ * QDNN_BUILD_BENCHMARKS is on) that measures steady-state invoke cost
+ * of both models on real silicon using the MicroBenchmarkRunner /
+ * MicroProfiler machinery from pico-tflmicro. Each model gets a few
+ * warm-up invokes (XIP cache, lazy init), then a timed batch with the
+ * per-op tick breakdown printed as CSV. A sustained burst scenario
+ * follows, interleaving both models for minutes the way the control
+ * loop does, to surface cache-contention effects the single-model
+ * batches cannot show.
+ *
+ * Builds for both architectures. On RP2040 the run additionally sweeps
+ * the normal/boost clock profiles and samples the XIP/bus counters; on
+ * RP2350 (Pico 2, Cortex-M33) those blocks compile out - the silicon has
+ * neither the RP2040 BUSCTRL counter map nor the validated boost
+ * profile - and the timed batches alone qualify the FPU/DSP kernel
+ * paths CMSIS-NN selects for the M33.
+ */
+
+#include <new>
+
+#include "pico/stdlib.h"
+
+#if PICO_RP2040
+#include "pico/multicore.h"
+
+#include "hardware/adc.h"
+
+#include "bus_counters.h"
+#include "control_logic.h"
+#include "div_hw.h"
+#include "perf_profile.h"
+#endif
+#include "qdnn_fan_model.h"
+#include "qdnn_op_resolver.h"
+#include "qdnn_pump_model.h"
+
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/system_setup.h"
+
+namespace {
+
+using QdnnBenchmarkRunner = tflite::MicroBenchmarkRunner<int8_t>;
+
+constexpr int kTensorArenaSize = 12 * 1024;
+alignas(16) uint8_t tensor_arena[kTensorArenaSize];
+
+// Placement buffers so each model run starts from a clean runner without
+// relying on global construction order.
+uint8_t op_resolver_buffer[sizeof(QdnnOpResolver)];
+uint8_t runner_buffer[sizeof(QdnnBenchmarkRunner)];
+
+constexpr int kWarmupIterations = 5;
+constexpr int kTimedIterations  = 100;
+
+void BenchmarkModel(const char* name, const unsigned char* model_data,
+                    tflite::MicroProfiler* profiler) {
+    QdnnOpResolver* op_resolver = new (op_resolver_buffer) QdnnOpResolver();
+    qdnn_register_ops(*op_resolver);
+
+    QdnnBenchmarkRunner* runner = new (runner_buffer)
+        QdnnBenchmarkRunner(model_data, op_resolver, tensor_arena,
+                            kTensorArenaSize, profiler);
+    runner->SetRandomInput(42);
+
+    for (int i = 0; i < kWarmupIterations; i++) runner->RunSingleIteration();
+    profiler->ClearEvents();
+
+#if PICO_RP2040
+    // XIP + bus counters over the timed batch: decides whether invoke
+    // latency is compute-bound or flash-fetch-bound on this build.
+    static const BusPerfEvent kEvents[4] = {
+        BUS_PERF_XIP_MAIN, BUS_PERF_XIP_MAIN_CONTESTED,
+        BUS_PERF_SRAM4_CONTESTED, BUS_PERF_SRAM5_CONTESTED};
+    bus_counters_begin(kEvents);
+#endif
+    uint32_t start = tflite::GetCurrentTimeTicks();
+    for (int i = 0; i < kTimedIterations; i++) runner->RunSingleIteration();
+    uint32_t total = tflite::GetCurrentTimeTicks() - start;
+
+    MicroPrintf("%s: %d invokes, %d ticks total, %d ticks/invoke (%d ticks/s)",
+                name, kTimedIterations, total, total / kTimedIterations,
+                tflite::ticks_per_second());
+#if PICO_RP2040
+    BusCounters bc;
+    bus_counters_end(&bc);
+    MicroPrintf("%s: xip hit %u/1000 (%u accesses), xip contested %u, sram4/5 contested %u/%u",
+                name, (unsigned)bus_counters_hit_permille(&bc), (unsigned)bc.xip_accesses,
+                (unsigned)bc.perf[1], (unsigned)bc.perf[2], (unsigned)bc.perf[3]);
+#endif
+    profiler->LogTicksPerTagCsv();
+}
+
+// --- Sustained burst scenario -------------------------------------------
+//
+// The timed batches above run one model at a time, so its weights own the
+// 16 KB XIP cache for the whole batch. Production interleaves: one fan
+// invoke, then one pump invoke per zone, every cycle - the two weight
+// regions evict each other and the steady-state hit rate is lower than
+// either single-model run suggests. Keep both runners resident (separate
+// arenas, as in the app) and drive that access pattern for minutes,
+// reporting a throughput-over-time curve in one-second windows so
+// model-placement and copy-to-RAM decisions can be judged against the
+// real interleaving penalty rather than the single-shot numbers.
+
+constexpr int kBurstSeconds  = 120;
+constexpr uint32_t kBurstWindowUs = 1000u * 1000u;
+constexpr int kBurstZones    = 3;  // pump invokes per batch, as on the 3-zone board
+
+// Second arena + placement buffers so the pump runner can coexist with
+// the fan runner (which reuses the single-model buffers above).
+alignas(16) uint8_t burst_arena[kTensorArenaSize];
+uint8_t burst_resolver_buffer[sizeof(QdnnOpResolver)];
+uint8_t burst_runner_buffer[sizeof(QdnnBenchmarkRunner)];
+
+void BurstBenchmark() {
+    static const unsigned char* const kModels[2] = {qdnn_fan_model,
+                                                    qdnn_pump_model};
+    static uint8_t* const kArenas[2]    = {tensor_arena, burst_arena};
+    static uint8_t* const kResolvers[2] = {op_resolver_buffer,
+                                           burst_resolver_buffer};
+    static uint8_t* const kRunners[2]   = {runner_buffer, burst_runner_buffer};
+
+    QdnnBenchmarkRunner* runner[2];
+    for (int m = 0; m < 2; m++) {
+        QdnnOpResolver* resolver = new (kResolvers[m]) QdnnOpResolver();
+        qdnn_register_ops(*resolver);
+        // No profiler: per-op event storage would overflow long before the
+        // burst ends, and only whole-invoke ticks matter here.
+        runner[m] = new (kRunners[m]) QdnnBenchmarkRunner(
+            kModels[m], resolver, kArenas[m], kTensorArenaSize, nullptr);
+        runner[m]->SetRandomInput(42 + m);
+        for (int i = 0; i < kWarmupIterations; i++)
+            runner[m]->RunSingleIteration();
+    }
+
+    MicroPrintf("[burst],header,window_s,invokes,ticks_avg,ticks_min,ticks_max"
+#if PICO_RP2040
+                ",xip_hit_permille,xip_contested"
+#endif
+    );
+
+#if PICO_RP2040
+    static const BusPerfEvent kBurstEvents[4] = {
+        BUS_PERF_XIP_MAIN, BUS_PERF_XIP_MAIN_CONTESTED,
+        BUS_PERF_SRAM4_CONTESTED, BUS_PERF_SRAM5_CONTESTED};
+#endif
+
+    uint32_t t0 = time_us_32();
+    for (int window = 0; window < kBurstSeconds; window++) {
+        uint32_t invokes = 0, ticks_sum = 0;
+        uint32_t ticks_min = UINT32_MAX, ticks_max = 0;
+#if PICO_RP2040
+        bus_counters_begin(kBurstEvents);
+#endif
+        while ((uint32_t)(time_us_32() - t0) <
+               (uint32_t)(window + 1) * kBurstWindowUs) {
+            // One production batch: fan, then the per-zone pump invokes.
+            for (int i = 0; i <= kBurstZones; i++) {
+                QdnnBenchmarkRunner* r = runner[i == 0 ? 0 : 1];
+                uint32_t start = tflite::GetCurrentTimeTicks();
+                r->RunSingleIteration();
+                uint32_t d = tflite::GetCurrentTimeTicks() - start;
+                ticks_sum += d;
+                invokes++;
+                if (d < ticks_min) ticks_min = d;
+                if (d > ticks_max) ticks_max = d;
+            }
+        }
+#if PICO_RP2040
+        BusCounters bc;
+        bus_counters_end(&bc);
+        MicroPrintf("[burst],%d,%u,%u,%u,%u,%u,%u", window, (unsigned)invokes,
+                    (unsigned)(invokes ? ticks_sum / invokes : 0),
+                    (unsigned)ticks_min, (unsigned)ticks_max,
+                    (unsigned)bus_counters_hit_permille(&bc),
+                    (unsigned)bc.perf[1]);
+#else
+        MicroPrintf("[burst],%d,%u,%u,%u,%u", window, (unsigned)invokes,
+                    (unsigned)(invokes ? ticks_sum / invokes : 0),
+                    (unsigned)ticks_min, (unsigned)ticks_max);
+#endif
+    }
+}
+
+// --- Input quantization stage --------------------------------------------
+//
+// With zone batching the prepare-inputs pass quantizes N x 3 deci-unit
+// values per cycle. Two implementations of the same math: the original
+// per-element chain (software modulo to index the feature constants,
+// 64-bit multiply, compare-and-branch clamps) and the batch routine
+// from control_logic.h with hoisted constants, split-half MULS and
+// branchless clamps. Timed against each other over identical rows and
+// checked for bit-identical output, so a regression in either the
+// speed or the math shows up here before it ships.
+
+constexpr int kQuantRows       = 64;
+constexpr int kQuantFeatures   = 3;
+constexpr int kQuantIterations = 500;
+
+void QuantBenchmark() {
+    static int16_t rows10[kQuantRows * kQuantFeatures];
+    static uint8_t out_ref[kQuantRows * kQuantFeatures];
+    static uint8_t out_batch[kQuantRows * kQuantFeatures];
+
+    // Plausible tensor parameters: int8 output, scale ~ 1/6 deci-unit
+    static const int32_t kMult[kQuantFeatures] = {39322, 26214, 52429};
+    static const int16_t kOff[kQuantFeatures]  = {0, 0, 250};
+    const int32_t zp = -13, qmin = -128, qmax = 127;
+
+    // Deterministic deci-unit inputs across the realistic sensor range
+    uint32_t seed = 0x5eed;
+    for (int i = 0; i < kQuantRows * kQuantFeatures; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        rows10[i] = (int16_t)((seed >> 16) % 1200);
+    }
+
+    uint32_t start = tflite::GetCurrentTimeTicks();
+    for (int it = 0; it < kQuantIterations; it++) {
+        for (int i = 0; i < kQuantRows * kQuantFeatures; i++) {
+            const int f = i % kQuantFeatures;
+            out_ref[i] = (uint8_t)quantize_deci_q16(rows10[i] - kOff[f], kMult[f],
+                                                    zp, qmin, qmax);
+        }
+    }
+    uint32_t ref_ticks = tflite::GetCurrentTimeTicks() - start;
+
+    start = tflite::GetCurrentTimeTicks();
+    for (int it = 0; it < kQuantIterations; it++) {
+        quantize_rows10(rows10, kQuantRows, kQuantFeatures, kMult, kOff,
+                        zp, qmin, qmax, out_batch);
+    }
+    uint32_t batch_ticks = tflite::GetCurrentTimeTicks() - start;
+
+    int mismatches = 0;
+    for (int i = 0; i < kQuantRows * kQuantFeatures; i++)
+        if (out_ref[i] != out_batch[i]) mismatches++;
+
+    MicroPrintf("quantize: %d values x %d iters: per-element %u ticks, "
+                "batch %u ticks, %d mismatches",
+                kQuantRows * kQuantFeatures, kQuantIterations,
+                (unsigned)ref_ticks, (unsigned)batch_ticks, mismatches);
+}
+
+#if PICO_RP2040
+// --- Three-model concurrency stress --------------------------------------
+//
+// Before anomaly detection joins the dual-core fan/pump split, prove the
+// memory system holds up with three resident interpreters. Arenas are
+// adjacent static blocks in striped main SRAM, exactly as the app lays
+// them out (the 4 KB per-core scratch banks cannot hold a 12 KB arena,
+// so striped-vs-scratch is not a real axis on this silicon); the
+// placement variable that remains is which core drives which
+// interpreter. Three variants, each driving the same three models:
+//
+//   serial3   all three round-robin on core 0 (baseline latencies)
+//   split2+1  pump free-running on core 1; fan + anomaly on core 0
+//   split1+2  pump + anomaly on core 1; fan alone on core 0
+//
+// Each window reports per-model invoke min/avg/max plus the contested
+// ratios on a representative striped bank (striping spreads the arenas
+// across banks 0-3 evenly, so bank 0 stands for all four) and on the
+// XIP port, where the three weight regions fight for the 16 KB cache.
+// The anomaly detector is not exported into this tree yet; a second
+// instance of the pump model in its own arena stands in - same op mix,
+// same weight footprint class, which is what the memory system sees.
+
+constexpr int kStressModels  = 3;
+constexpr int kStressSeconds = 20;
+
+alignas(16) uint8_t stress_anom_arena[kTensorArenaSize];
+uint8_t stress_anom_resolver_buffer[sizeof(QdnnOpResolver)];
+uint8_t stress_anom_runner_buffer[sizeof(QdnnBenchmarkRunner)];
+
+QdnnBenchmarkRunner* stress_runner[kStressModels];
+
+struct StressStats {
+    uint32_t invokes;
+    uint32_t ticks_sum;
+    uint32_t ticks_min;
+    uint32_t ticks_max;
+};
+
+// One writer per model per variant (a model runs on exactly one core),
+// so plain volatile publication is enough.
+volatile StressStats stress_stats[kStressModels];
+volatile bool stress_core1_run;
+volatile uint32_t stress_core1_mask;
+volatile bool stress_core1_done;
+
+void StressNote(int m, uint32_t d) {
+    volatile StressStats* s = &stress_stats[m];
+    s->invokes++;
+    s->ticks_sum += d;
+    if (d < s->ticks_min) s->ticks_min = d;
+    if (d > s->ticks_max) s->ticks_max = d;
+}
+
+void StressDrive(uint32_t mask) {
+    for (int m = 0; m < kStressModels; m++) {
+        if (!(mask & (1u << m))) continue;
+        uint32_t start = tflite::GetCurrentTimeTicks();
+        stress_runner[m]->RunSingleIteration();
+        StressNote(m, tflite::GetCurrentTimeTicks() - start);
+    }
+}
+
+void StressCore1Entry() {
+    while (stress_core1_run) StressDrive(stress_core1_mask);
+    stress_core1_done = true;
+    while (true) tight_loop_contents();
+}
+
+void StressVariant(const char* name, uint32_t core0_mask, uint32_t core1_mask) {
+    static const char* const kModelNames[kStressModels] = {"fan", "pump", "anom"};
+
+    for (int m = 0; m < kStressModels; m++) {
+        volatile StressStats* s = &stress_stats[m];
+        s->invokes = 0;
+        s->ticks_sum = 0;
+        s->ticks_min = UINT32_MAX;
+        s->ticks_max = 0;
+    }
+
+    if (core1_mask) {
+        multicore_reset_core1();
+        stress_core1_mask = core1_mask;
+        stress_core1_done = false;
+        stress_core1_run = true;
+        multicore_launch_core1(StressCore1Entry);
+    }
+
+    static const BusPerfEvent kStressEvents[4] = {
+        BUS_PERF_SRAM0, BUS_PERF_SRAM0_CONTESTED,
+        BUS_PERF_XIP_MAIN, BUS_PERF_XIP_MAIN_CONTESTED};
+    bus_counters_begin(kStressEvents);
+
+    uint32_t t0 = time_us_32();
+    while ((uint32_t)(time_us_32() - t0) < (uint32_t)kStressSeconds * 1000000u)
+        StressDrive(core0_mask);
+
+    if (core1_mask) {
+        stress_core1_run = false;
+        while (!stress_core1_done) tight_loop_contents();
+        multicore_reset_core1();
+    }
+
+    BusCounters bc;
+    bus_counters_end(&bc);
+
+    // Contested permille: fraction of accesses that had to wait for the
+    // other master in the same cycle.
+    uint32_t sram_pm = bc.perf[0] ? (uint32_t)((uint64_t)bc.perf[1] * 1000u / bc.perf[0]) : 0;
+    uint32_t xip_pm = bc.perf[2] ? (uint32_t)((uint64_t)bc.perf[3] * 1000u / bc.perf[2]) : 0;
+    for (int m = 0; m < kStressModels; m++) {
+        volatile StressStats* s = &stress_stats[m];
+        MicroPrintf("[stress],%s,%s,%u,%u,%u,%u", name, kModelNames[m],
+                    (unsigned)s->invokes,
+                    (unsigned)(s->invokes ? s->ticks_sum / s->invokes : 0),
+                    (unsigned)(s->invokes ? s->ticks_min : 0),
+                    (unsigned)s->ticks_max);
+    }
+    MicroPrintf("[stress],%s,bus,sram0 contested %u/1000, xip hit %u/1000, "
+                "xip contested %u/1000",
+                name, (unsigned)sram_pm,
+                (unsigned)bus_counters_hit_permille(&bc), (unsigned)xip_pm);
+}
+
+void StressBenchmark() {
+    // Third interpreter in its own arena; fan and pump reuse the burst
+    // runners, which are still resident and warm.
+    QdnnOpResolver* resolver = new (stress_anom_resolver_buffer) QdnnOpResolver();
+    qdnn_register_ops(*resolver);
+    stress_runner[0] = reinterpret_cast<QdnnBenchmarkRunner*>(runner_buffer);
+    stress_runner[1] = reinterpret_cast<QdnnBenchmarkRunner*>(burst_runner_buffer);
+    stress_runner[2] = new (stress_anom_runner_buffer) QdnnBenchmarkRunner(
+        qdnn_pump_model, resolver, stress_anom_arena, kTensorArenaSize, nullptr);
+    stress_runner[2]->SetRandomInput(44);
+    for (int i = 0; i < kWarmupIterations; i++)
+        stress_runner[2]->RunSingleIteration();
+
+    MicroPrintf("[stress],header,variant,model,invokes,ticks_avg,ticks_min,ticks_max");
+
+    uint32_t serial_fan_avg, split21_fan_avg, split12_fan_avg;
+
+    StressVariant("serial3", 0x7, 0x0);
+    serial_fan_avg = stress_stats[0].invokes
+        ? stress_stats[0].ticks_sum / stress_stats[0].invokes : 0;
+
+    StressVariant("split2+1", 0x5, 0x2);  // core 0: fan+anom, core 1: pump
+    split21_fan_avg = stress_stats[0].invokes
+        ? stress_stats[0].ticks_sum / stress_stats[0].invokes : 0;
+
+    StressVariant("split1+2", 0x1, 0x6);  // core 0: fan, core 1: pump+anom
+    split12_fan_avg = stress_stats[0].invokes
+        ? stress_stats[0].ticks_sum / stress_stats[0].invokes : 0;
+
+    // Verdict: fan carries the control deadline on core 0, so the
+    // recommended split is the one that inflates its invoke least over
+    // the uncontended baseline. The full table above backs it up.
+    if (serial_fan_avg) {
+        uint32_t infl21 = (uint32_t)((uint64_t)split21_fan_avg * 1000u / serial_fan_avg);
+        uint32_t infl12 = (uint32_t)((uint64_t)split12_fan_avg * 1000u / serial_fan_avg);
+        MicroPrintf("[stress],verdict,fan inflation split2+1 %u/1000, "
+                    "split1+2 %u/1000 -> place anomaly on core %d",
+                    (unsigned)infl21, (unsigned)infl12, infl12 < infl21 ? 1 : 0);
+    }
+}
+// --- Net-energy-per-cycle sweep ------------------------------------------
+//
+// The clock profiles ship with measured invoke latencies but only
+// theoretical power numbers. This scenario closes the loop on cheap
+// hardware: VSYS sags under load in proportion to the draw through the
+// supply's source impedance, so the ADC's VSYS channel is a coarse
+// consumption proxy with no shunt or bench meter attached. Per profile:
+// time the transition in, average an idle baseline at the settled
+// clock, then drive the production fan + 3-zone interleave for a fixed
+// wall-clock window and report the loaded sag and its time-integral
+// per cycle. The absolute numbers are supply-dependent; the ratios
+// across profiles - whether boost's shorter busy window really beats
+// normal's longer one - are what the DVFS defaults need measured.
+
+constexpr int kEnergySeconds     = 5;
+constexpr int kEnergyIdleSamples = 256;
+
+uint32_t VsysReadMv() {
+    adc_select_input(3);
+    (void)adc_read();  // discard one conversion for mux settle
+    uint32_t sum = 0;
+    for (int i = 0; i < 8; i++) sum += adc_read();
+    // 3.3 V reference behind the board's 3:1 VSYS divider
+    return (sum / 8) * 9900u / 4096u;
+}
+
+void EnergyBenchmark() {
+    adc_init();
+    adc_gpio_init(29);
+
+    // Burst runners are still resident and warm; same access pattern.
+    QdnnBenchmarkRunner* runner[2] = {
+        reinterpret_cast<QdnnBenchmarkRunner*>(runner_buffer),
+        reinterpret_cast<QdnnBenchmarkRunner*>(burst_runner_buffer)};
+
+    static const PerfProfile kProfiles[3] = {
+        PERF_PROFILE_ECO, PERF_PROFILE_NORMAL, PERF_PROFILE_BOOST};
+    static const char* const kNames[3] = {"eco", "normal", "boost"};
+
+    MicroPrintf("[energy],header,profile,switch_us,idle_mv,load_mv,sag_mv,"
+                "cycles,us_per_cycle,sag_uvs_per_cycle");
+
+    for (int p = 0; p < 3; p++) {
+        uint32_t t0 = time_us_32();
+        perf_profile_apply(kProfiles[p]);
+        uint32_t switch_us = time_us_32() - t0;
+
+        sleep_ms(50);  // regulator + supply settle before the baseline
+        uint64_t idle_sum = 0;
+        for (int i = 0; i < kEnergyIdleSamples; i++) idle_sum += VsysReadMv();
+        uint32_t idle_mv = (uint32_t)(idle_sum / kEnergyIdleSamples);
+
+        uint32_t cycles = 0;
+        uint64_t load_sum = 0;
+        t0 = time_us_32();
+        while ((uint32_t)(time_us_32() - t0) <
+               (uint32_t)kEnergySeconds * 1000000u) {
+            for (int i = 0; i <= kBurstZones; i++)
+                runner[i == 0 ? 0 : 1]->RunSingleIteration();
+            cycles++;
+            load_sum += VsysReadMv();
+        }
+        uint32_t span_us = time_us_32() - t0;
+        uint32_t load_mv = cycles ? (uint32_t)(load_sum / cycles) : idle_mv;
+        uint32_t sag_mv = idle_mv > load_mv ? idle_mv - load_mv : 0;
+        // Energy proxy: sag (proportional to current) integrated over
+        // the window, divided across the cycles it bought.
+        uint32_t sag_uvs = cycles
+            ? (uint32_t)((uint64_t)sag_mv * span_us / cycles) : 0;
+        MicroPrintf("[energy],%s,%u,%u,%u,%u,%u,%u,%u", kNames[p],
+                    (unsigned)switch_us, (unsigned)idle_mv, (unsigned)load_mv,
+                    (unsigned)sag_mv, (unsigned)cycles,
+                    (unsigned)(cycles ? span_us / cycles : 0),
+                    (unsigned)sag_uvs);
+    }
+    perf_profile_apply(PERF_PROFILE_NORMAL);
+}
+// --- Divider quotient/remainder pair cost -------------------------------
+//
+// pico_divider already routes compiler / and % through the SIO divider,
+// so this is not hardware-vs-software division; it measures what a
+// quotient/remainder PAIR costs when it goes through two AEABI calls
+// (the compiler cannot fuse them) versus one explicit divmod launch.
+// The firmware's fixed-point "%ld.%ld" splits and the wallclock
+// decomposition are exactly such pairs.
+
+constexpr int kDivIterations = 100000;
+
+void DividerBenchmark() {
+    // Volatile operands so the compiler neither constant-folds the
+    // divides nor hoists them out of the loops; volatile sinks so it
+    // cannot drop the remainder half of the pair.
+    volatile int32_t num = 123456789;
+    volatile int32_t den = 10;
+    volatile int32_t sink_q = 0, sink_r = 0;
+
+    MicroPrintf("[divhw],header,path,iters,total_us,ns_per_pair");
+
+    uint32_t t0 = time_us_32();
+    for (int i = 0; i < kDivIterations; i++) {
+        int32_t n = num, d = den;
+        sink_q = n / d;
+        sink_r = n % d;
+    }
+    uint32_t aeabi_us = time_us_32() - t0;
+
+    t0 = time_us_32();
+    for (int i = 0; i < kDivIterations; i++) {
+        int32_t q, r;
+        divmod_s32(num, den, &q, &r);
+        sink_q = q;
+        sink_r = r;
+    }
+    uint32_t divmod_us = time_us_32() - t0;
+    (void)sink_q;
+    (void)sink_r;
+
+    MicroPrintf("[divhw],aeabi_pair,%d,%u,%u", kDivIterations,
+                (unsigned)aeabi_us,
+                (unsigned)((uint64_t)aeabi_us * 1000u / kDivIterations));
+    MicroPrintf("[divhw],divmod,%d,%u,%u", kDivIterations,
+                (unsigned)divmod_us,
+                (unsigned)((uint64_t)divmod_us * 1000u / kDivIterations));
+    if (divmod_us)
+        MicroPrintf("[divhw],verdict,pair cost %u/1000 of two AEABI calls",
+                    (unsigned)((uint64_t)divmod_us * 1000u / aeabi_us));
+}
+#endif  // PICO_RP2040
+
+}  // namespace
+
+int main() {
+    tflite::InitializeTarget();
+    sleep_ms(2000);  // let the USB console attach before results scroll by
+
+    MicroPrintf("=== QDNN on-target benchmark ===");
+
+    tflite::MicroProfiler profiler;
+
+#if PICO_RP2040
+    perf_profile_init();
+
+    // Both profiles back to back: the ticks/invoke ratio validates the
+    // boost clock (and its flash timing) before it ships enabled.
+    MicroPrintf("--- profile: normal (125 MHz) ---");
+    BenchmarkModel("fan", qdnn_fan_model, &profiler);
+    profiler.ClearEvents();
+    BenchmarkModel("pump", qdnn_pump_model, &profiler);
+    profiler.ClearEvents();
+
+    perf_profile_apply(PERF_PROFILE_BOOST);
+    MicroPrintf("--- profile: boost (250 MHz) ---");
+    BenchmarkModel("fan", qdnn_fan_model, &profiler);
+    profiler.ClearEvents();
+    BenchmarkModel("pump", qdnn_pump_model, &profiler);
+
+    perf_profile_apply(PERF_PROFILE_NORMAL);
+#else
+    // RP2350: stock clock, M33 FPU/DSP kernel paths.
+    MicroPrintf("--- profile: stock (rp2350) ---");
+    BenchmarkModel("fan", qdnn_fan_model, &profiler);
+    profiler.ClearEvents();
+    BenchmarkModel("pump", qdnn_pump_model, &profiler);
+#endif
+
+    // Quantization micro-stage: cheap, runs before the long burst.
+    MicroPrintf("--- stage: input quantization ---");
+    QuantBenchmark();
+
+#if PICO_RP2040
+    // Divider micro-stage: quotient/remainder pair via two AEABI calls
+    // vs one explicit divmod launch. Cheap; runs before the long burst.
+    MicroPrintf("--- stage: divider pair cost ---");
+    DividerBenchmark();
+#endif
+
+    // Sustained interleaved burst at the shipping clock profile; last
+    // because it monopolizes the console for kBurstSeconds.
+    MicroPrintf("--- burst: fan + %d-zone pump interleave, %d s ---",
+                kBurstZones, kBurstSeconds);
+    BurstBenchmark();
+
+#if PICO_RP2040
+    // Dual-core stress: three resident interpreters, both cores, per
+    // placement variant. Reuses the burst runners, so it must run after.
+    MicroPrintf("--- stress: 3-model dual-core placement sweep, %d s/variant ---",
+                kStressSeconds);
+    StressBenchmark();
+
+    // Net-energy sweep last: needs the warm burst runners and quiet
+    // cores (core 1 is parked again after the stress variants).
+    MicroPrintf("--- energy: VSYS-proxy profile sweep, %d s/profile ---",
+                kEnergySeconds);
+    EnergyBenchmark();
+#endif
+
+    MicroPrintf("=== benchmark done ===");
+    while (true) tight_loop_contents();
+}
@@ -0,0 +1,45 @@
+/**
+ * @file queue_stats.cpp
+ *
+ * @brief Pipeline queue watermark implementation
+ */
+
+#include "queue_stats.h"
+
+static QueueStatsSnap s_slot[QSTAT_COUNT];
+
+static const char* const s_name[QSTAT_COUNT] = {
+    "sens", "res", "anom", "ascr",
+};
+
+void queue_stats_note_push(int slot, unsigned depth) {
+    if (slot < 0 || slot >= QSTAT_COUNT) return;
+    QueueStatsSnap* s = &s_slot[slot];
+    s->depth = (uint8_t)(depth > 0xFF ? 0xFF : depth);
+    if (s->depth > s->max_depth) s->max_depth = s->depth;
+}
+
+void queue_stats_note_pop_age(int slot, uint32_t age_ms) {
+    if (slot < 0 || slot >= QSTAT_COUNT) return;
+    QueueStatsSnap* s = &s_slot[slot];
+    s->age_ms = (uint16_t)(age_ms > 0xFFFF ? 0xFFFF : age_ms);
+    if (s->age_ms > s->max_age_ms) s->max_age_ms = s->age_ms;
+}
+
+void queue_stats_note_drop(int slot) {
+    if (slot < 0 || slot >= QSTAT_COUNT) return;
+    s_slot[slot].drops++;
+}
+
+void queue_stats_collect(int slot, QueueStatsSnap* out) {
+    if (slot < 0 || slot >= QSTAT_COUNT) {
+        *out = QueueStatsSnap{};
+        return;
+    }
+    *out = s_slot[slot];
+}
+
+const char* queue_stats_name(int slot) {
+    if (slot < 0 || slot >= QSTAT_COUNT) return "?";
+    return s_name[slot];
+}
@@ -0,0 +1,71 @@
+/**
+ * @file queue_stats.h
+ *
+ * @brief Depth and age watermarks for the inter-stage pipeline queues
+ *
+ * A slow consumer grows latency between sensing and actuation without
+ * tripping anything - the pipeline handoffs block instead of dropping,
+ * so the failure is silent until a pump acts on stale soil numbers.
+ * Each handoff now reports its depth after every deposit and the age
+ * of every entry it consumes; the watermarks (max depth, max age)
+ * surface in the periodic queue telemetry frame and in "stats", and
+ * the actuation stage bumps the error counters when a frame older
+ * than the staleness bound reaches the hardware.
+ *
+ * All producers and consumers are FreeRTOS tasks on core 0, so the
+ * bookkeeping is plain word writes - no spinlock needed here.
+ */
+
+#ifndef QUEUE_STATS_H
+#define QUEUE_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Watermark slots, one per inter-stage queue.
+ */
+enum QueueStatSlot {
+    QSTAT_SENSOR = 0,  ///< sensing -> inference frames
+    QSTAT_RESULT,      ///< inference -> actuation/report results
+    QSTAT_ANOM,        ///< inference -> anomaly detector mailbox
+    QSTAT_ANOM_RES,    ///< detector -> report scores
+    QSTAT_COUNT
+};
+
+/**
+ * @brief One slot's counters, as collected for a report.
+ */
+struct QueueStatsSnap {
+    uint8_t  depth;       ///< depth after the most recent deposit
+    uint8_t  max_depth;   ///< high watermark since boot
+    uint16_t age_ms;      ///< age of the most recently consumed entry
+    uint16_t max_age_ms;  ///< oldest entry ever consumed
+    uint32_t drops;       ///< non-blocking deposits that were dropped
+};
+
+/**
+ * @brief Record the queue depth right after a deposit.
+ */
+void queue_stats_note_push(int slot, unsigned depth);
+
+/**
+ * @brief Record the age of an entry at the moment it is consumed.
+ */
+void queue_stats_note_pop_age(int slot, uint32_t age_ms);
+
+/**
+ * @brief Count one dropped non-blocking deposit.
+ */
+void queue_stats_note_drop(int slot);
+
+/**
+ * @brief Copy one slot's counters out for a report.
+ */
+void queue_stats_collect(int slot, QueueStatsSnap* out);
+
+/**
+ * @brief Short queue name for the shell / telemetry tags.
+ */
+const char* queue_stats_name(int slot);
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file ram_code.h
+ *
+ * @brief Ranked hot-path SRAM placement
+ *
+ * Under QDNN_RAM_HOT_CODE, functions wrapped in QDNN_HOT_FUNC_RANK
+ * execute from zero-wait-state SRAM instead of XIP flash - avoiding
+ * the dozens-of-cycles cache-miss stalls in tight decode and
+ * inference glue loops - when their rank is within QDNN_RAM_TOPK.
+ * Each pinned function costs its .text size in SRAM, so the ranks are
+ * not guesses: tools/ram_placement.py consumes a benchmark console
+ * capture (MicroProfiler per-op CSV plus the scoped-timer lines) and
+ * the link map, scores every annotated site by cycles-in-flash per KB
+ * the copy would cost, and prints the QDNN_RAM_TOPK that fits a given
+ * budget. Shrinking the budget drops the worst-value sites first.
+ *
+ * The TFLM/CMSIS-NN kernels themselves stay in flash at every rank: a
+ * whole-image copy_to_ram build does not fit beside the 128 KB heap
+ * and the tensor arenas, and pinning individual vendored kernels
+ * means carrying lib patches. The tool still reports their flash
+ * share so a library bump can revisit that trade.
+ */
+
+#ifndef RAM_CODE_H
+#define RAM_CODE_H
+
+#include "pico/platform.h"
+
+// Ranks 1..QDNN_RAM_TOPK land in SRAM when QDNN_RAM_HOT_CODE is on;
+// the rest stay in flash. Re-derive with tools/ram_placement.py after
+// kernel or model changes; the default pins every annotated site.
+#ifndef QDNN_RAM_TOPK
+#define QDNN_RAM_TOPK 4
+#endif
+
+#if QDNN_RAM_HOT_CODE && QDNN_RAM_TOPK >= 1
+#define QDNN_HOT_RANK_1(fn) __not_in_flash_func(fn)
+#else
+#define QDNN_HOT_RANK_1(fn) fn
+#endif
+#if QDNN_RAM_HOT_CODE && QDNN_RAM_TOPK >= 2
+#define QDNN_HOT_RANK_2(fn) __not_in_flash_func(fn)
+#else
+#define QDNN_HOT_RANK_2(fn) fn
+#endif
+#if QDNN_RAM_HOT_CODE && QDNN_RAM_TOPK >= 3
+#define QDNN_HOT_RANK_3(fn) __not_in_flash_func(fn)
+#else
+#define QDNN_HOT_RANK_3(fn) fn
+#endif
+#if QDNN_RAM_HOT_CODE && QDNN_RAM_TOPK >= 4
+#define QDNN_HOT_RANK_4(fn) __not_in_flash_func(fn)
+#else
+#define QDNN_HOT_RANK_4(fn) fn
+#endif
+
+/** @brief Annotate a function with its measured placement rank. */
+#define QDNN_HOT_FUNC_RANK(rank, fn) QDNN_HOT_RANK_##rank(fn)
+
+/** @brief Rank-1 shorthand (the original single-tier annotation). */
+#define QDNN_HOT_FUNC(fn) QDNN_HOT_FUNC_RANK(1, fn)
+
+#endif
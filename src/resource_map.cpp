@@ -0,0 +1,116 @@
+/**
+ * @file resource_map.cpp
+ *
+ * @brief Hardware resource ledger implementation
+ *
+ * Thin shims over the SDK claim calls plus a name per slot. The SDK
+ * keeps its own claim bitmaps (and its atomicity); the ledger only
+ * adds the attribution, so a slot the SDK refuses is reported with
+ * every current owner's name next to it.
+ */
+
+#include "resource_map.h"
+
+#include <stdio.h>
+
+#include "hardware/dma.h"
+#include "hardware/timer.h"
+
+#include "app_log.h"
+
+static const char* s_dma_owner[NUM_DMA_CHANNELS];
+static const char* s_sm_owner[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+static const char* s_alarm_owner[NUM_TIMERS];
+
+static void log_exhaustion(const char* pool, const char* owner) {
+    LogError(("%s pool exhausted claiming for %s - ledger follows", pool,
+              owner));
+    resource_report();
+}
+
+int res_claim_dma(const char* owner, bool required) {
+    int chan = dma_claim_unused_channel(false);
+    if (chan < 0) {
+        log_exhaustion("dma", owner);
+        if (required) panic("out of DMA channels");
+        return -1;
+    }
+    s_dma_owner[chan] = owner;
+    return chan;
+}
+
+void res_release_dma(int chan) {
+    if (chan < 0) return;
+    dma_channel_unclaim((uint)chan);
+    s_dma_owner[chan] = NULL;
+}
+
+int res_claim_pio_sm(const char* owner, PIO* out_pio) {
+    PIO pio = pio0;
+    int sm = pio_claim_unused_sm(pio0, false);
+    if (sm < 0) {
+        pio = pio1;
+        sm = pio_claim_unused_sm(pio1, false);
+    }
+    if (sm < 0) {
+        log_exhaustion("pio", owner);
+        return -1;
+    }
+    s_sm_owner[pio_get_index(pio)][sm] = owner;
+    *out_pio = pio;
+    return sm;
+}
+
+void res_release_pio_sm(PIO pio, int sm) {
+    if (sm < 0) return;
+    pio_sm_unclaim(pio, (uint)sm);
+    s_sm_owner[pio_get_index(pio)][sm] = NULL;
+}
+
+int res_claim_alarm(const char* owner, bool required) {
+    int alarm = hardware_alarm_claim_unused(false);
+    if (alarm < 0) {
+        log_exhaustion("alarm", owner);
+        if (required) panic("out of hardware alarms");
+        return -1;
+    }
+    s_alarm_owner[alarm] = owner;
+    return alarm;
+}
+
+void res_release_alarm(int alarm) {
+    if (alarm < 0) return;
+    hardware_alarm_unclaim((uint)alarm);
+    s_alarm_owner[alarm] = NULL;
+}
+
+void resource_report(void) {
+    int used = 0;
+    printf("dma: ");
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++)
+        if (s_dma_owner[i] != NULL) {
+            printf(" %d=%s", i, s_dma_owner[i]);
+            used++;
+        }
+    printf("  (%d/%d, budget %d)\n", used, NUM_DMA_CHANNELS, RES_DMA_DEMAND);
+
+    used = 0;
+    printf("pio: ");
+    for (int b = 0; b < NUM_PIOS; b++)
+        for (int s = 0; s < NUM_PIO_STATE_MACHINES; s++)
+            if (s_sm_owner[b][s] != NULL) {
+                printf(" %d.%d=%s", b, s, s_sm_owner[b][s]);
+                used++;
+            }
+    printf("  (%d/%d, budget %d)\n", used,
+           NUM_PIOS * NUM_PIO_STATE_MACHINES, RES_SM_DEMAND);
+
+    used = 0;
+    printf("alarm:");
+    for (int i = 0; i < NUM_TIMERS; i++)
+        if (s_alarm_owner[i] != NULL) {
+            printf(" %d=%s", i, s_alarm_owner[i]);
+            used++;
+        }
+    printf("  (%d/%d, budget %d)\n", used, NUM_TIMERS, RES_ALARM_DEMAND);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file resource_map.h
+ *
+ * @brief Central ledger for the RP2040's fixed hardware pools
+ *
+ * DMA channels, PIO state machines and hardware alarms used to be
+ * claimed ad hoc, each module calling the SDK directly - which worked
+ * while the claimants were few, but the pools are fixed (12 channels,
+ * 2x4 state machines, 4 alarms) and the feature options now stack: a
+ * build that turns everything on is close enough to the DMA ceiling
+ * that the next feature collides at runtime, as a claim panic or -
+ * with non-required claims - as a silently disabled module.
+ *
+ * Two layers make that impossible to miss. At compile time this header
+ * tallies the worst-case demand of every enabled option against each
+ * pool and static_asserts the budget, so a feature combination that
+ * cannot coexist fails the build with the arithmetic in plain sight
+ * (same philosophy as the IRQ steering table: additions must come
+ * through the map). At runtime every claim goes through the wrappers
+ * below, which record an owner name per slot; exhaustion logs the
+ * full ownership table before failing, so a boot fault names the
+ * squatters instead of leaving a DMA whodunit, and the shell's "res"
+ * command prints the live ledger on request.
+ *
+ * The wrappers keep SDK semantics (required claims still panic, after
+ * logging; optional claims return -1) and centralize the pio0-first-
+ * then-pio1 spill policy the PIO claimants had each reimplemented.
+ */
+
+#ifndef RESOURCE_MAP_H
+#define RESOURCE_MAP_H
+
+#include "pico/stdlib.h"
+
+#include "hardware/pio.h"
+
+// --- Compile-time pool budget ---
+// Worst-case static demand per enabled feature, summed against the
+// hardware pools. Transient claimants (the CRC sniffer walk, the
+// latency probe's alarm) are budgeted as held: they may overlap any
+// steady claimant's lifetime.
+
+#if QDNN_SHT4X
+#define RES_DMA_AIR 2       // I2C TX + RX pacing
+#define RES_SM_AIR  0
+#else
+#define RES_DMA_AIR 0
+#define RES_SM_AIR  1       // DHT capture engine
+#endif
+
+#if QDNN_PWM_ACTUATION
+#define RES_DMA_PWM (1 + 3)  // fan + up to three pump-zone ramps
+#else
+#define RES_DMA_PWM 0
+#endif
+
+#if QDNN_WS2812_STATUS
+#define RES_DMA_WS2812 1
+#define RES_SM_WS2812  1
+#else
+#define RES_DMA_WS2812 0
+#define RES_SM_WS2812  0
+#endif
+
+#if QDNN_TOUCH_BTN
+#define RES_SM_TOUCH 1
+#else
+#define RES_SM_TOUCH 0
+#endif
+
+#if QDNN_SOIL_AC
+#define RES_DMA_SOIL_AC 1
+#else
+#define RES_DMA_SOIL_AC 0
+#endif
+
+#if QDNN_UART_DMA_TELEMETRY || QDNN_CORE1_IO
+#define RES_DMA_UART_TX 1
+#else
+#define RES_DMA_UART_TX 0
+#endif
+
+// soil_adc sweep + model_crc sniffer are unconditional claimants.
+#define RES_DMA_DEMAND (1 + 1 + RES_DMA_AIR + RES_DMA_PWM + \
+                        RES_DMA_WS2812 + RES_DMA_SOIL_AC + RES_DMA_UART_TX)
+#define RES_SM_DEMAND  (RES_SM_AIR + RES_SM_WS2812 + RES_SM_TOUCH)
+// Invoke-deadline guard per core + the irqtest probe.
+#define RES_ALARM_DEMAND (2 + 1)
+
+static_assert(RES_DMA_DEMAND <= NUM_DMA_CHANNELS,
+              "enabled features oversubscribe the DMA channel pool");
+static_assert(RES_SM_DEMAND <= NUM_PIOS * NUM_PIO_STATE_MACHINES,
+              "enabled features oversubscribe the PIO state machines");
+static_assert(RES_ALARM_DEMAND <= NUM_TIMERS,
+              "enabled features oversubscribe the hardware alarms");
+
+// --- Runtime claim tracking ---
+
+/**
+ * @brief Claim a DMA channel, recording the owner name.
+ *
+ * @param owner    Short static string for the ledger/report.
+ * @param required True panics on exhaustion (after logging the full
+ *                 ownership table); false returns -1.
+ */
+int res_claim_dma(const char* owner, bool required);
+
+/** @brief Return a claimed channel to the pool. */
+void res_release_dma(int chan);
+
+/**
+ * @brief Claim a PIO state machine: pio0 first, spill to pio1.
+ *
+ * @param owner   Short static string for the ledger/report.
+ * @param out_pio Receives the block the state machine lives on.
+ * @return State machine index, or -1 with both blocks full (logged).
+ */
+int res_claim_pio_sm(const char* owner, PIO* out_pio);
+
+/** @brief Return a claimed state machine to its block. */
+void res_release_pio_sm(PIO pio, int sm);
+
+/**
+ * @brief Claim a hardware alarm, recording the owner name.
+ *
+ * Safe from either core (the guard claims per core at init); the
+ * ledger slots are distinct per alarm, so concurrent claims never
+ * write the same entry.
+ */
+int res_claim_alarm(const char* owner, bool required);
+
+/** @brief Return a claimed alarm to the pool. */
+void res_release_alarm(int alarm);
+
+/**
+ * @brief Print the ownership ledger and per-pool headroom. Shell task.
+ */
+void resource_report(void);
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * @file scratch_arena.cpp
+ *
+ * @brief Backing storage for the shared per-cycle scratch arena
+ */
+
+#include "scratch_arena.h"
+
+#ifndef QDNN_SCRATCH_BYTES
+#define QDNN_SCRATCH_BYTES 2048
+#endif
+
+static uint8_t s_cycle_buf[QDNN_SCRATCH_BYTES] __attribute__((aligned(8)));
+static ScratchArena s_cycle;
+static bool s_cycle_ready;
+
+ScratchArena* scratch_cycle(void) {
+    if (!s_cycle_ready) {
+        scratch_arena_init(&s_cycle, s_cycle_buf, sizeof(s_cycle_buf));
+        s_cycle_ready = true;
+    }
+    return &s_cycle;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file scratch_arena.h
+ *
+ * @brief Per-cycle bump allocator for transient stage buffers
+ *
+ * Pipeline stages keep growing working buffers - despike windows,
+ * demodulation blocks, frame assembly - and the two existing homes for
+ * them are both wrong: an ad-hoc static burns its SRAM forever for a
+ * lifetime of microseconds, and pvPortMalloc in the loop is exactly
+ * what the static-allocation mode exists to ban. A scratch arena
+ * time-multiplexes one region instead: allocation is a pointer bump,
+ * the whole arena resets in O(1) at a cycle boundary, and a high-water
+ * mark says how big the region actually needs to be.
+ *
+ * Ownership is the whole safety story: an arena has exactly one
+ * resetting owner, and every allocation is dead the moment that owner
+ * resets. Nothing here takes a lock - hand pointers from a scratch
+ * arena to another task and the next reset frees them under it. The
+ * shared cycle arena below belongs to the report task's cycle; stages
+ * running on other clocks (core 1, IRQ handlers) must carve their own.
+ *
+ * Borrowing the tensor arenas' non-persistent region was considered
+ * and rejected for this tree: with dual-core invoke and the pipelined
+ * acquisition overlap there is no phase, on any one task's clock, in
+ * which that region is provably idle.
+ */
+
+#ifndef SCRATCH_ARENA_H
+#define SCRATCH_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct ScratchArena {
+    uint8_t* base;
+    size_t size;
+    size_t off;         ///< next free byte
+    size_t high_water;  ///< worst-case off since init
+    uint32_t failures;  ///< allocations refused for want of space
+};
+
+static inline void scratch_arena_init(ScratchArena* a, void* base,
+                                      size_t size) {
+    a->base = (uint8_t*)base;
+    a->size = size;
+    a->off = 0;
+    a->high_water = 0;
+    a->failures = 0;
+}
+
+/** @brief Free everything at once; O(1), call at the owner's cycle
+ *         boundary. High water and failure counts persist. */
+static inline void scratch_arena_reset(ScratchArena* a) {
+    a->off = 0;
+}
+
+/**
+ * @brief Allocate @p bytes at @p align (power of two); NULL when the
+ *        arena cannot hold it - callers keep a degraded path, the
+ *        failure counter makes the undersizing visible.
+ */
+static inline void* scratch_arena_alloc(ScratchArena* a, size_t bytes,
+                                        size_t align) {
+    size_t off = (a->off + (align - 1)) & ~(align - 1);
+    if (bytes > a->size || off > a->size - bytes) {
+        a->failures++;
+        return NULL;
+    }
+    void* p = a->base + off;
+    a->off = off + bytes;
+    if (a->off > a->high_water) a->high_water = a->off;
+    return p;
+}
+
+/** @brief Typed allocation: n elements of T, aligned for T. */
+#define SCRATCH_ALLOC_T(arena, T, n) \
+    ((T*)scratch_arena_alloc((arena), (n) * sizeof(T), alignof(T)))
+
+/**
+ * @brief The shared per-cycle arena (QDNN_SCRATCH_BYTES of SRAM).
+ *
+ * Owned by the report task: reset at each cycle top, so any core-0
+ * stage running strictly inside the cycle may allocate from it.
+ */
+ScratchArena* scratch_cycle(void);
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file self_test.cpp
+ *
+ * @brief Incremental self-test evaluation
+ *
+ * Concurrency: the feed functions run on the pipeline tasks and only
+ * append single words into per-check windows; evaluation runs on the
+ * drain task and reads the same windows. A slice that races an append
+ * sees a window one sample off - the verdicts are thresholds over 32
+ * samples, so the worst case is a fault latched or cleared one cycle
+ * later. No locks in the control path for that.
+ *
+ * Each self_test_step() call evaluates exactly one check (one zone's
+ * soil window, the DHT history, or one zone's pump counter), so the
+ * cost per call is a bounded 32-element scan at most.
+ */
+
+#include "self_test.h"
+
+#include <stdio.h>
+
+#include "app_log.h"
+#include "control_logic.h"
+
+// Soil probe: window span below the ADC noise floor, or a reading
+// pinned at a rail, for a whole window = stuck/disconnected probe.
+#define SOIL_WINDOW        32
+#define SOIL_STUCK_SPAN    2      // counts; live probes jitter more than this
+#define SOIL_RAIL_LO       8      // shorted / pulled to ground
+#define SOIL_RAIL_HI       4087   // disconnected / pulled to VREF
+
+// DHT11: failure density over the last DHT_WINDOW transactions.
+#define DHT_WINDOW         32
+#define DHT_FAIL_MAX       16     // more than half dead trips the fault
+
+// Pump: this many consecutive cycles of a strong command with no
+// moisture gain means the relay or line is not delivering. There is
+// no flow sensor, so the soil response is the feedback channel.
+#define PUMP_MIN_LEVEL     3
+#define PUMP_STALL_CYCLES  20
+
+// Fusion divergence: the sensor task's cross-consistency score must
+// sink three quarters of the way to its anti-correlated bound to trip,
+// and climb back above zero to clear - the hysteresis keeps a probe
+// hovering at the threshold from flapping the fault.
+#define FUSION_TRIP_SCORE  (-(3 * FUSION_SCORE_MAX / 4))
+#define FUSION_CLEAR_SCORE 0
+
+struct SoilWindow {
+    uint16_t raw[SOIL_WINDOW];
+    uint8_t idx;
+    uint8_t filled;
+};
+
+static int s_zones;
+static SoilWindow s_soil[SELF_TEST_MAX_ZONES];
+
+static uint32_t s_dht_hist;      // 1 bit per transaction, 1 = failed
+static uint8_t s_dht_count;      // valid bits in s_dht_hist, up to 32
+
+static int16_t s_pump_last10[SELF_TEST_MAX_ZONES];
+static uint8_t s_pump_stalled[SELF_TEST_MAX_ZONES];
+
+static int16_t s_fusion_score[SELF_TEST_MAX_ZONES];
+
+static uint32_t s_faults;
+static int s_check;              // round-robin cursor for step()
+
+void self_test_init(int zones) {
+    s_zones = zones > SELF_TEST_MAX_ZONES ? SELF_TEST_MAX_ZONES : zones;
+    for (int z = 0; z < SELF_TEST_MAX_ZONES; z++) {
+        s_soil[z].idx = s_soil[z].filled = 0;
+        s_pump_last10[z] = -1;
+        s_pump_stalled[z] = 0;
+        s_fusion_score[z] = FUSION_SCORE_MAX;  // matches fusion_init()'s boot trust
+    }
+    s_dht_hist = 0;
+    s_dht_count = 0;
+    s_faults = 0;
+    s_check = 0;
+}
+
+void self_test_feed_soil(int zone, uint16_t raw) {
+    if (zone >= s_zones) return;
+    SoilWindow* w = &s_soil[zone];
+    w->raw[w->idx] = raw;
+    w->idx = (uint8_t)((w->idx + 1) % SOIL_WINDOW);
+    if (w->filled < SOIL_WINDOW) w->filled++;
+}
+
+void self_test_feed_dht(bool ok) {
+    s_dht_hist = (s_dht_hist << 1) | (ok ? 0u : 1u);
+    if (s_dht_count < DHT_WINDOW) s_dht_count++;
+}
+
+void self_test_feed_fusion(int zone, int score) {
+    if (zone >= s_zones) return;
+    s_fusion_score[zone] = (int16_t)score;
+}
+
+void self_test_feed_actuation(int zone, int pump_level, int16_t soil_pct10) {
+    if (zone >= s_zones) return;
+    // Counting here is one compare per cycle; the threshold verdict
+    // stays in the step() slice with the other checks.
+    if (pump_level >= PUMP_MIN_LEVEL && s_pump_last10[zone] >= 0
+            && soil_pct10 <= s_pump_last10[zone]) {
+        if (s_pump_stalled[zone] < 255) s_pump_stalled[zone]++;
+    } else {
+        s_pump_stalled[zone] = 0;
+    }
+    s_pump_last10[zone] = soil_pct10;
+}
+
+/** @brief Set or clear one fault bit, logging the transition once. */
+static void fault_update(uint32_t bit, bool active, const char* what, int zone) {
+    if (active && !(s_faults & bit)) {
+        s_faults |= bit;
+        if (zone >= 0) { LogWarn(("selftest: %s fault, zone %d", what, zone)); }
+        else          { LogWarn(("selftest: %s fault", what)); }
+    } else if (!active && (s_faults & bit)) {
+        s_faults &= ~bit;
+        if (zone >= 0) { LogInfo(("selftest: %s recovered, zone %d", what, zone)); }
+        else          { LogInfo(("selftest: %s recovered", what)); }
+    }
+}
+
+static void check_soil(int zone) {
+    const SoilWindow* w = &s_soil[zone];
+    if (w->filled < SOIL_WINDOW) return;  // verdict needs a full window
+    uint16_t lo = 0xFFFF, hi = 0;
+    for (int i = 0; i < SOIL_WINDOW; i++) {
+        uint16_t v = w->raw[i];
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    bool stuck = (hi - lo) <= SOIL_STUCK_SPAN || hi <= SOIL_RAIL_LO
+              || lo >= SOIL_RAIL_HI;
+    fault_update(SELF_TEST_FAULT_SOIL(zone), stuck, "soil probe", zone);
+}
+
+static void check_dht(void) {
+    if (s_dht_count < DHT_WINDOW) return;
+    int fails = __builtin_popcount(s_dht_hist);
+    fault_update(SELF_TEST_FAULT_DHT, fails > DHT_FAIL_MAX, "dht11", -1);
+}
+
+static void check_pump(int zone) {
+    fault_update(SELF_TEST_FAULT_PUMP(zone),
+                 s_pump_stalled[zone] >= PUMP_STALL_CYCLES, "pump", zone);
+}
+
+static void check_fusion(int zone) {
+    bool tripped = (s_faults & SELF_TEST_FAULT_DIVERGE(zone)) != 0;
+    bool active = tripped ? s_fusion_score[zone] < FUSION_CLEAR_SCORE
+                          : s_fusion_score[zone] <= FUSION_TRIP_SCORE;
+    fault_update(SELF_TEST_FAULT_DIVERGE(zone), active, "soil/humid diverge", zone);
+}
+
+void self_test_step(void) {
+    // Checks 0..zones-1: soil; zones: DHT; zones+1..2*zones: pump;
+    // 2*zones+1..3*zones: fusion divergence.
+    int n = 3 * s_zones + 1;
+    if (n <= 1) return;
+    int c = s_check;
+    s_check = (s_check + 1) % n;
+    if (c < s_zones)            check_soil(c);
+    else if (c == s_zones)      check_dht();
+    else if (c <= 2 * s_zones)  check_pump(c - s_zones - 1);
+    else                        check_fusion(c - 2 * s_zones - 1);
+}
+
+uint32_t self_test_faults(void) {
+    return s_faults;
+}
+
+void self_test_print(void) {
+    printf("selftest: faults=0x%08lx\n", (unsigned long)s_faults);
+    for (int z = 0; z < s_zones; z++) {
+        const SoilWindow* w = &s_soil[z];
+        uint16_t lo = 0xFFFF, hi = 0;
+        for (int i = 0; i < w->filled; i++) {
+            if (w->raw[i] < lo) lo = w->raw[i];
+            if (w->raw[i] > hi) hi = w->raw[i];
+        }
+        printf("  zone %d: soil %s (raw %u..%u over %u), pump %s (%u stalled), "
+               "fusion %s (score %d)\n",
+               z,
+               (s_faults & SELF_TEST_FAULT_SOIL(z)) ? "FAULT" : "ok",
+               w->filled ? lo : 0, w->filled ? hi : 0, w->filled,
+               (s_faults & SELF_TEST_FAULT_PUMP(z)) ? "FAULT" : "ok",
+               s_pump_stalled[z],
+               (s_faults & SELF_TEST_FAULT_DIVERGE(z)) ? "FAULT" : "ok",
+               (int)s_fusion_score[z]);
+    }
+    printf("  dht11: %s (%d/%u failed)\n",
+           (s_faults & SELF_TEST_FAULT_DHT) ? "FAULT" : "ok",
+           __builtin_popcount(s_dht_hist), s_dht_count);
+}
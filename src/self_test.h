@@ -0,0 +1,70 @@
+/**
+ * @file self_test.h
+ *
+ * @brief Time-sliced background self-tests for sensors and actuators
+ *
+ * The field failures that actually happen - corroded soil probes that
+ * read a constant, DHT11s that stop answering, pumps that hum but move
+ * no water - are invisible to the control loop, which keeps inferring
+ * on dead inputs. This engine watches for them continuously without
+ * touching the control path: the pipeline tasks feed it observations
+ * they already have in hand (one append each, no scans), and the
+ * evaluation work runs one small slice per call from the drain task's
+ * idle loop, a few microseconds at a time.
+ *
+ * Checks:
+ *  - soil probe: a full observation window whose raw readings span
+ *    less than the noise floor, or sit on an ADC rail, is a stuck or
+ *    disconnected probe;
+ *  - DHT11: failure density over the last 32 transactions; a sensor
+ *    drifting from "occasionally flaky" to "mostly dead" trips before
+ *    it flatlines;
+ *  - pump effectiveness: sustained high pump commands that never move
+ *    the zone's soil moisture mean a seized relay or a dry line;
+ *  - humidity/soil divergence: a zone whose fusion cross-consistency
+ *    score has saturated deep in the anti-correlated range is a probe
+ *    failing plausibly - in range and jittering, so the stuck check
+ *    never sees it, but moving against the weather for hours.
+ *
+ * Faults are one-shot logged on transition (and again on recovery) and
+ * exported as a bitmask for the shell's selftest command.
+ */
+
+#ifndef SELF_TEST_H
+#define SELF_TEST_H
+
+#include "pico/stdlib.h"
+
+#define SELF_TEST_MAX_ZONES 4
+
+// Fault bit layout
+#define SELF_TEST_FAULT_SOIL(z)    (1u << (z))                       ///< stuck/disconnected probe
+#define SELF_TEST_FAULT_DIVERGE(z) (1u << (4 + (z)))                 ///< probe anti-correlated with humidity
+#define SELF_TEST_FAULT_DHT        (1u << 8)                         ///< air sensor mostly dead
+#define SELF_TEST_FAULT_PUMP(z)    (1u << (16 + (z)))                ///< actuation without effect
+
+/** @brief Reset all windows and fault state. */
+void self_test_init(int zones);
+
+/** @brief One raw soil reading per zone per cycle (sensor task). */
+void self_test_feed_soil(int zone, uint16_t raw);
+
+/** @brief Outcome of this cycle's DHT11 transaction (sensor task). */
+void self_test_feed_dht(bool ok);
+
+/** @brief This cycle's humidity/soil cross-consistency score (sensor task). */
+void self_test_feed_fusion(int zone, int score);
+
+/** @brief Committed pump level + observed moisture (report task). */
+void self_test_feed_actuation(int zone, int pump_level, int16_t soil_pct10);
+
+/** @brief Run one evaluation slice (drain task idle loop). */
+void self_test_step(void);
+
+/** @brief Current fault bitmask (SELF_TEST_FAULT_*). */
+uint32_t self_test_faults(void);
+
+/** @brief Human-readable status to stdout (shell's selftest command). */
+void self_test_print(void);
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @file sensor_emul.cpp
+ *
+ * @brief Replay input source implementation
+ *
+ * Waveforms are generated, not tabulated: a triangle-wave primitive on
+ * the virtual clock covers the diurnal and drydown shapes in a few
+ * words of flash each, and the fault scripts count reads so their
+ * pattern is identical at any speed-up. Everything here runs once per
+ * control cycle on the sensor task - the soft divides are fine.
+ */
+
+#include "sensor_emul.h"
+
+#include <string.h>
+
+#include <stdio.h>
+
+#include "air_sensor.h"
+#include "app_log.h"
+
+#define EMUL_MAX_ZONES 4
+
+enum EmulScenario {
+    EMUL_OFF = 0,
+    EMUL_DIURNAL,  ///< 24 h air/soil waveform, no faults
+    EMUL_CHATTER,  ///< soil oscillating across a level boundary
+    EMUL_FAULTS,   ///< diurnal values + DHT retry storms + ADC spikes
+};
+
+static EmulScenario s_scenario = EMUL_OFF;
+static unsigned s_speedup = 1;
+static uint32_t s_start_ms;
+static uint32_t s_air_reads;
+static uint32_t s_soil_reads[EMUL_MAX_ZONES];
+
+// Virtual milliseconds since the scenario was armed
+static uint32_t virt_ms(void) {
+    return (to_ms_since_boot(get_absolute_time()) - s_start_ms) * s_speedup;
+}
+
+// Symmetric triangle wave between lo and hi with the given period
+static int32_t tri_wave(uint32_t t_ms, uint32_t period_ms, int32_t lo, int32_t hi) {
+    uint32_t ph = t_ms % period_ms;
+    uint32_t half = period_ms / 2;
+    int32_t span = hi - lo;
+    if (ph < half) return lo + (int32_t)((int64_t)span * ph / half);
+    return hi - (int32_t)((int64_t)span * (ph - half) / half);
+}
+
+bool sensor_emul_active(void) {
+    return s_scenario != EMUL_OFF;
+}
+
+int sensor_emul_start(const char* name, unsigned speedup) {
+    EmulScenario sc;
+    if (strcmp(name, "diurnal") == 0)      sc = EMUL_DIURNAL;
+    else if (strcmp(name, "chatter") == 0) sc = EMUL_CHATTER;
+    else if (strcmp(name, "faults") == 0)  sc = EMUL_FAULTS;
+    else return -1;
+
+    s_scenario = sc;
+    s_speedup = speedup ? speedup : 1;
+    s_start_ms = to_ms_since_boot(get_absolute_time());
+    s_air_reads = 0;
+    memset(s_soil_reads, 0, sizeof(s_soil_reads));
+    LogWarn(("sensor emul: scenario '%s' armed at %ux - live values ignored",
+             name, s_speedup));
+    return 0;
+}
+
+void sensor_emul_stop(void) {
+    if (s_scenario == EMUL_OFF) return;
+    s_scenario = EMUL_OFF;
+    LogWarn(("sensor emul: disarmed, hardware values live again"));
+}
+
+int sensor_emul_air(int* temp10, int* humid10, int real_status) {
+    if (s_scenario == EMUL_OFF || real_status == AIR_READ_PENDING)
+        return real_status;
+
+    uint32_t n = s_air_reads++;
+    if (s_scenario == EMUL_FAULTS) {
+        // Read-counted fault script: every 5th poll fails once, every
+        // 16th opens a 3-deep burst - a deterministic retry storm that
+        // exercises the backoff loop and the substitution path.
+        if (n % 5 == 4 || n % 16 < 3) return AIR_READ_ERROR;
+    }
+
+    uint32_t t = virt_ms();
+    if (s_scenario == EMUL_CHATTER) {
+        // Flat air: all the action is in the soil channel
+        *temp10 = 250;
+        *humid10 = 600;
+    } else {
+        // One virtual day: warm afternoons, humid nights (half-period
+        // phase shift between the two)
+        *temp10 = tri_wave(t, 86400000u, 170, 330);
+        *humid10 = tri_wave(t + 43200000u, 86400000u, 450, 850);
+    }
+    return 0;
+}
+
+uint16_t sensor_emul_soil(int zone, uint16_t real_raw) {
+    if (s_scenario == EMUL_OFF || zone < 0 || zone >= EMUL_MAX_ZONES)
+        return real_raw;
+
+    uint32_t n = s_soil_reads[zone]++;
+    uint32_t t = virt_ms();
+
+    if (s_scenario == EMUL_CHATTER) {
+        // A few counts of square wave straddling a level boundary:
+        // worst case for the dwell filters, every cycle proposes a
+        // flip. Zones are phase-offset so commits never line up.
+        uint32_t ph = (t / 30000u + (uint32_t)zone) & 1u;
+        return (uint16_t)(2200 + (ph ? 8 : -8));
+    }
+
+    // Drydown sawtooth: six virtual hours from wet to dry, then an
+    // "irrigation" reset; zones staggered by 40 virtual minutes.
+    uint32_t zt = t + (uint32_t)zone * 2400000u;
+    uint32_t ph = zt % 21600000u;
+    uint16_t raw = (uint16_t)(1400 + (uint32_t)((uint64_t)1800 * ph / 21600000u));
+
+    if (s_scenario == EMUL_FAULTS && zone == 0) {
+        // Rail spikes on one zone: the median window and the ADC range
+        // counters see them, the control values should not.
+        if (n % 7 == 6) return 4095;
+        if (n % 11 == 10) return 0;
+    }
+    return raw;
+}
+
+void sensor_emul_report(void) {
+    if (s_scenario == EMUL_OFF) {
+        printf("emul: off (scenarios: diurnal, chatter, faults)\n");
+        return;
+    }
+    static const char* const kNames[] = { "off", "diurnal", "chatter", "faults" };
+    printf("emul: %s at %ux, %lu air reads, %lu soil samples/zone0\n",
+           kNames[s_scenario], s_speedup,
+           (unsigned long)s_air_reads, (unsigned long)s_soil_reads[0]);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file sensor_emul.h
+ *
+ * @brief Replay input source for deterministic on-target load testing
+ *
+ * Performance experiments against a live DHT11 and a cup of soil are
+ * unrepeatable: no two runs see the same values, let alone the same
+ * fault pattern. This module sits behind the sensor task's two read
+ * sites and, when armed from the shell ("emul"), substitutes the
+ * delivered values and statuses with flash-resident synthetic
+ * scenarios - a diurnal waveform, threshold chatter around a level
+ * boundary, and a fault script with DHT retry storms and ADC rail
+ * spikes. The live drivers keep running underneath so transaction
+ * timing stays realistic; only the results are replaced.
+ *
+ * Waveforms run on a virtual clock (elapsed time times the configured
+ * speed-up), fault injection counts reads - both deterministic, so a
+ * stress scenario benchmarks identically across firmware versions.
+ * Never ship a build with the emulator armed; it exists for A/B runs
+ * on the bench.
+ */
+
+#ifndef SENSOR_EMUL_H
+#define SENSOR_EMUL_H
+
+#include "pico/stdlib.h"
+
+/** @brief True while a scenario is substituting sensor results. */
+bool sensor_emul_active(void);
+
+/**
+ * @brief Arm a scenario by name ("diurnal", "chatter", "faults").
+ *
+ * @param speedup virtual-clock multiplier, >= 1.
+ * @return 0 on success, -1 on unknown scenario.
+ */
+int sensor_emul_start(const char* name, unsigned speedup);
+
+/** @brief Disarm; the next reads come from hardware again. */
+void sensor_emul_stop(void);
+
+/**
+ * @brief Filter one air-sensor poll result.
+ *
+ * Passes PENDING through untouched. Otherwise substitutes the
+ * scenario's values (and injected fault statuses) for the hardware's.
+ *
+ * @return the status the sensor task should act on.
+ */
+int sensor_emul_air(int* temp10, int* humid10, int real_status);
+
+/**
+ * @brief Substitute one raw soil sample for @p zone.
+ */
+uint16_t sensor_emul_soil(int zone, uint16_t real_raw);
+
+/** @brief Print scenario list / current state to the shell. */
+void sensor_emul_report(void);
+
+#endif
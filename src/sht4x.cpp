@@ -0,0 +1,216 @@
+/**
+ * @file sht4x.cpp
+ *
+ * @brief SHT4x DMA-driven I2C backend implementation
+ *
+ * Two DMA channels against the I2C block's DREQ pair: TX streams
+ * 16-bit DATA_CMD entries (the measure command, later the six read
+ * command beats), RX drains received bytes from the same register's
+ * low byte. The CPU only flips the state machine forward on poll -
+ * command kick, conversion wait, completion check - each a handful of
+ * register accesses. Address and channel configs are set once at init;
+ * per phase only read/write pointers and counts change.
+ */
+
+#include "sht4x.h"
+
+#include <string.h>
+
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+
+#include "app_log.h"
+#include "resource_map.h"
+
+#ifndef SHT4X_I2C_INST
+#define SHT4X_I2C_INST i2c0
+#endif
+
+#define SHT4X_ADDR          0x44
+#define SHT4X_CMD_MEAS_HI   0xFD  // high precision, 8.3 ms max conversion
+#define SHT4X_CMD_SERIAL    0x89
+#define SHT4X_MEAS_WAIT_MS  10
+#define SHT4X_READ_WAIT_MS  5     // 6 bytes at 400 kHz is ~0.2 ms
+#define SHT4X_CACHE_MAX_AGE_MS 10000
+
+// DATA_CMD entries for the DMA: the measure command (with STOP), and
+// six read beats, the last one closing the transaction.
+static const uint16_t s_meas_cmd[1] = {
+    SHT4X_CMD_MEAS_HI | I2C_IC_DATA_CMD_STOP_BITS,
+};
+static const uint16_t s_read_cmds[6] = {
+    I2C_IC_DATA_CMD_CMD_BITS, I2C_IC_DATA_CMD_CMD_BITS,
+    I2C_IC_DATA_CMD_CMD_BITS, I2C_IC_DATA_CMD_CMD_BITS,
+    I2C_IC_DATA_CMD_CMD_BITS,
+    I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_STOP_BITS,
+};
+
+enum class SensorPhase { Idle, Convert, Read };
+
+static bool s_up;
+static int s_tx_dma = -1, s_rx_dma = -1;
+static SensorPhase s_phase = SensorPhase::Idle;
+static absolute_time_t s_deadline;
+static uint8_t s_rx[6];
+
+// Last-good cache, same bridging semantics as the DHT11 driver
+static int s_cache_t10, s_cache_rh10;
+static absolute_time_t s_cache_time;
+static bool s_cache_valid;
+
+// Sensirion CRC-8: poly 0x31, init 0xFF, over each 2-byte word
+static uint8_t sht4x_crc8(const uint8_t* d, int n) {
+    uint8_t crc = 0xFF;
+    for (int i = 0; i < n; i++) {
+        crc ^= d[i];
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+static bool bus_aborted(void) {
+    return (SHT4X_I2C_INST->hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) != 0;
+}
+
+static int serve_cache(int* temp10, int* rh10) {
+    if (s_cache_valid &&
+        absolute_time_diff_us(s_cache_time, get_absolute_time()) <
+            (int64_t)SHT4X_CACHE_MAX_AGE_MS * 1000) {
+        *temp10 = s_cache_t10;
+        *rh10 = s_cache_rh10;
+        return 0;
+    }
+    return SHT4X_READ_ERROR;
+}
+
+// Abort both channels, clear the I2C abort latch and drain whatever
+// landed in the RX FIFO, then bridge with the cache.
+static int fail_transaction(int* temp10, int* rh10) {
+    dma_channel_abort(s_tx_dma);
+    dma_channel_abort(s_rx_dma);
+    (void)SHT4X_I2C_INST->hw->clr_tx_abrt;
+    while (SHT4X_I2C_INST->hw->rxflr != 0) (void)SHT4X_I2C_INST->hw->data_cmd;
+    s_phase = SensorPhase::Idle;
+    return serve_cache(temp10, rh10);
+}
+
+int sht4x_init(void) {
+    i2c_init(SHT4X_I2C_INST, 400 * 1000);
+    gpio_set_function(SHT4X_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(SHT4X_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(SHT4X_I2C_SDA_PIN);
+    gpio_pull_up(SHT4X_I2C_SCL_PIN);
+
+    // Probe with the serial-number command: a missing or miswired part
+    // fails at boot, not on the first control cycle.
+    uint8_t cmd = SHT4X_CMD_SERIAL;
+    uint8_t serial[6];
+    if (i2c_write_blocking(SHT4X_I2C_INST, SHT4X_ADDR, &cmd, 1, false) != 1) {
+        LogError(("sht4x: no response at 0x%02x", SHT4X_ADDR));
+        return SHT4X_READ_ERROR;
+    }
+    sleep_ms(1);
+    if (i2c_read_blocking(SHT4X_I2C_INST, SHT4X_ADDR, serial, 6, false) != 6) {
+        LogError(("sht4x: serial read failed"));
+        return SHT4X_READ_ERROR;
+    }
+
+    s_tx_dma = res_claim_dma("sht4x_tx", false);
+    s_rx_dma = res_claim_dma("sht4x_rx", false);
+    if (s_tx_dma < 0 || s_rx_dma < 0) {
+        res_release_dma(s_tx_dma);
+        res_release_dma(s_rx_dma);
+        s_tx_dma = s_rx_dma = -1;
+        return SHT4X_READ_ERROR;
+    }
+
+    // Fix the target address and hand both FIFO sides to the DMA
+    SHT4X_I2C_INST->hw->enable = 0;
+    SHT4X_I2C_INST->hw->tar = SHT4X_ADDR;
+    SHT4X_I2C_INST->hw->enable = 1;
+    SHT4X_I2C_INST->hw->dma_cr =
+        I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+
+    dma_channel_config tc = dma_channel_get_default_config(s_tx_dma);
+    channel_config_set_transfer_data_size(&tc, DMA_SIZE_16);
+    channel_config_set_read_increment(&tc, true);
+    channel_config_set_write_increment(&tc, false);
+    channel_config_set_dreq(&tc, i2c_get_dreq(SHT4X_I2C_INST, true));
+    dma_channel_configure(s_tx_dma, &tc, &SHT4X_I2C_INST->hw->data_cmd,
+                          NULL, 0, false);
+
+    dma_channel_config rc = dma_channel_get_default_config(s_rx_dma);
+    channel_config_set_transfer_data_size(&rc, DMA_SIZE_8);
+    channel_config_set_read_increment(&rc, false);
+    channel_config_set_write_increment(&rc, true);
+    channel_config_set_dreq(&rc, i2c_get_dreq(SHT4X_I2C_INST, false));
+    dma_channel_configure(s_rx_dma, &rc, NULL,
+                          &SHT4X_I2C_INST->hw->data_cmd, 0, false);
+
+    s_up = true;
+    return 0;
+}
+
+int sht4x_read_begin(void) {
+    if (!s_up) return SHT4X_READ_ERROR;
+    if (s_phase != SensorPhase::Idle) {
+        // Restart semantics, like the DHT driver: tear the old one down
+        int t, h;
+        (void)fail_transaction(&t, &h);
+    }
+    dma_channel_set_read_addr(s_tx_dma, s_meas_cmd, false);
+    dma_channel_set_trans_count(s_tx_dma, 1, true);
+    s_phase = SensorPhase::Convert;
+    s_deadline = make_timeout_time_ms(SHT4X_MEAS_WAIT_MS);
+    return 0;
+}
+
+int sht4x_read_poll(int* temp10, int* rh10) {
+    if (!s_up) return SHT4X_READ_ERROR;
+
+    if (s_phase == SensorPhase::Convert) {
+        if (bus_aborted()) return fail_transaction(temp10, rh10);
+        if (!time_reached(s_deadline)) return SHT4X_READ_PENDING;
+        // Conversion done inside the sensor: kick the read-phase pair,
+        // RX armed first so no received byte can beat its drain.
+        dma_channel_set_write_addr(s_rx_dma, s_rx, false);
+        dma_channel_set_trans_count(s_rx_dma, 6, true);
+        dma_channel_set_read_addr(s_tx_dma, s_read_cmds, false);
+        dma_channel_set_trans_count(s_tx_dma, 6, true);
+        s_phase = SensorPhase::Read;
+        s_deadline = make_timeout_time_ms(SHT4X_READ_WAIT_MS);
+        return SHT4X_READ_PENDING;
+    }
+
+    if (s_phase == SensorPhase::Read) {
+        if (bus_aborted()) return fail_transaction(temp10, rh10);
+        if (dma_channel_is_busy(s_rx_dma)) {
+            if (time_reached(s_deadline)) return fail_transaction(temp10, rh10);
+            return SHT4X_READ_PENDING;
+        }
+        if (sht4x_crc8(&s_rx[0], 2) != s_rx[2] ||
+            sht4x_crc8(&s_rx[3], 2) != s_rx[5])
+            return fail_transaction(temp10, rh10);
+
+        // Integer conversion in deci-units; >>16 instead of /65535 is
+        // a 0.002% bias, far under the part's accuracy spec.
+        uint32_t raw_t = ((uint32_t)s_rx[0] << 8) | s_rx[1];
+        uint32_t raw_rh = ((uint32_t)s_rx[3] << 8) | s_rx[4];
+        int t10 = -450 + (int)((raw_t * 1750u) >> 16);
+        int rh10 = -60 + (int)((raw_rh * 1250u) >> 16);
+        if (rh10 < 0) rh10 = 0;
+        if (rh10 > 1000) rh10 = 1000;
+
+        s_cache_t10 = t10;
+        s_cache_rh10 = rh10;
+        s_cache_time = get_absolute_time();
+        s_cache_valid = true;
+        s_phase = SensorPhase::Idle;
+        *temp10 = t10;
+        *rh10 = rh10;
+        return 0;
+    }
+
+    return serve_cache(temp10, rh10);
+}
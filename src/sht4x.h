@@ -0,0 +1,78 @@
+/**
+ * @file sht4x.h
+ *
+ * @brief SHT4x (SHT40/41/45) I2C air sensor backend with DMA transfers
+ *
+ * The next hardware revision replaces the DHT11 with an SHT41: I2C
+ * instead of the single-wire pulse train, ~8 ms high-precision
+ * conversion instead of the DHT's 1 s sample ceiling, and 0.01 C-class
+ * accuracy. The transaction is fully DMA-driven - the measure command
+ * and the six read-command/data beats move through the I2C block's TX
+ * and RX DREQs - so a complete read costs microseconds of CPU across
+ * begin and the poll that finds it finished, against the DHT path's
+ * milliseconds of polling.
+ *
+ * Same async begin/poll shape and last-good cache semantics as the
+ * DHT11 driver, so the input-assembly stage consumes either backend
+ * through air_sensor.h unchanged. Values stay in the same deci-unit
+ * integers. Select with QDNN_SHT4X; bus pins default below and
+ * override from the build for other board spins.
+ */
+
+#ifndef SHT4X_H
+#define SHT4X_H
+
+#include "pico/stdlib.h"
+
+#ifndef SHT4X_I2C_SDA_PIN
+#define SHT4X_I2C_SDA_PIN 4
+#endif
+#ifndef SHT4X_I2C_SCL_PIN
+#define SHT4X_I2C_SCL_PIN 5
+#endif
+
+/**
+ * @brief Result of sht4x_read_poll() while the transaction is in flight.
+ */
+const int SHT4X_READ_PENDING = 1;
+
+/**
+ * @brief Error value on a failed read with no fresh cache. Matches the
+ * DHT11 driver's TRANSMISSION_ERROR so call sites are backend-agnostic.
+ */
+const int SHT4X_READ_ERROR = -999;
+
+/**
+ * @brief Bring up the I2C bus and claim the two DMA channels.
+ *
+ * Probes the sensor with its serial-number command so a missing or
+ * miswired part fails here, at boot, not on the first cycle.
+ *
+ * @return 0 on success, SHT4X_READ_ERROR when the probe fails.
+ */
+int sht4x_init(void);
+
+/**
+ * @brief Start an asynchronous measurement (non-blocking).
+ *
+ * Pushes the high-precision measure command through the TX DMA and
+ * returns; the ~8.3 ms conversion runs inside the sensor. A
+ * transaction already in flight is restarted.
+ *
+ * @return 0 on success, SHT4X_READ_ERROR if the driver is not up.
+ */
+int sht4x_read_begin(void);
+
+/**
+ * @brief Poll an asynchronous measurement for completion.
+ *
+ * Advances the transaction (conversion wait, read-phase DMA kick,
+ * CRC check) without blocking. A failed transfer is bridged with the
+ * previous sample while it is still fresh.
+ *
+ * @return 0 with values on completion, SHT4X_READ_PENDING while in
+ *         flight, SHT4X_READ_ERROR on failure with no fresh cache.
+ */
+int sht4x_read_poll(int *temp10, int *rh10);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file soil_ac.cpp
+ *
+ * @brief AC excitation and IQ demodulation implementation
+ *
+ * Burst geometry: the ADC free-runs at 48 MHz / 96 = 500 ksps exactly,
+ * the PWM wrap is computed from the system clock for 31.25 kHz, so a
+ * period is 16 samples to crystal accuracy and the correlation window
+ * of 16 whole periods is coherent - DC and every even harmonic of the
+ * square drive cancel over the window, and the window's ~1.95 kHz
+ * bin width rejects mains harmonics without a single filter tap.
+ *
+ * Amplitude math, all integer: with the Q14 quadrature table and
+ * N = 256 correlated samples, a fundamental of A counts produces
+ * |(I,Q)| = A * (N/2) * 2^14 = A * 2^21. I and Q are pre-shifted by 8
+ * before squaring so the sum of squares stays inside 64 bits, leaving
+ * the amplitude at (isqrt >> 13) counts.
+ */
+
+#include "soil_ac.h"
+
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pwm.h"
+
+#include "app_log.h"
+#include "resource_map.h"
+
+#define SOIL_AC_FREQ_HZ 31250
+#define SOIL_AC_BURST \
+    ((SOIL_AC_SETTLE + SOIL_AC_PERIODS) * SOIL_AC_SAMPLES_PER_PERIOD)
+
+// Q14 quadrature table, one excitation period at 16 samples
+static const int16_t s_cos[SOIL_AC_SAMPLES_PER_PERIOD] = {
+    16384, 15137, 11585, 6270, 0, -6270, -11585, -15137,
+    -16384, -15137, -11585, -6270, 0, 6270, 11585, 15137};
+static const int16_t s_sin[SOIL_AC_SAMPLES_PER_PERIOD] = {
+    0, 6270, 11585, 15137, 16384, 15137, 11585, 6270,
+    0, -6270, -11585, -15137, -16384, -15137, -11585, -6270};
+
+static uint s_slice;
+static uint s_pwm_chan;
+static uint16_t s_level_on;         // 50% compare value
+static int s_dma_chan = -1;
+static uint s_adc_channel[SOIL_ADC_MAX_CHANNELS];
+static int s_num_probes;
+
+// Same accumulator shape as soil_adc: value << SOIL_ADC_AVG_SHIFT
+static uint32_t s_filt[SOIL_ADC_MAX_CHANNELS];
+
+static uint16_t s_burst[SOIL_AC_BURST];
+
+static uint32_t isqrt64(uint64_t v) {
+    uint64_t r = 0;
+    uint64_t bit = 1ull << 62;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+// One burst on one sense channel: borrow the ADC, drive, capture,
+// restore, correlate. Returns the amplitude in ADC counts.
+static uint16_t burst_amplitude(uint adc_channel) {
+    soil_adc_suspend();
+
+    adc_set_round_robin(0);
+    adc_select_input(adc_channel);
+    adc_set_clkdiv(0);  // full tilt: 500 ksps
+    adc_fifo_setup(true, true, 1, false, false);
+
+    dma_channel_set_write_addr(s_dma_chan, s_burst, false);
+    dma_channel_set_trans_count(s_dma_chan, SOIL_AC_BURST, true);
+
+    pwm_set_counter(s_slice, 0);
+    pwm_set_chan_level(s_slice, s_pwm_chan, s_level_on);
+    adc_run(true);
+
+    // ~0.7 ms all-hardware; cheaper to spin than to context-switch
+    // twice around a sub-tick wait.
+    dma_channel_wait_for_finish_blocking(s_dma_chan);
+
+    adc_run(false);
+    pwm_set_chan_level(s_slice, s_pwm_chan, 0);  // idle low: no net DC
+
+    soil_adc_resume();
+
+    // Correlate past the ring-in; DC needs no subtraction, a constant
+    // is orthogonal to the table over whole periods.
+    const uint16_t* x = s_burst + SOIL_AC_SETTLE * SOIL_AC_SAMPLES_PER_PERIOD;
+    int64_t i_acc = 0, q_acc = 0;
+    for (int n = 0; n < SOIL_AC_PERIODS * SOIL_AC_SAMPLES_PER_PERIOD; n++) {
+        int k = n & (SOIL_AC_SAMPLES_PER_PERIOD - 1);
+        i_acc += (int64_t)x[n] * s_cos[k];
+        q_acc += (int64_t)x[n] * s_sin[k];
+    }
+    int64_t i8 = i_acc >> 8, q8 = q_acc >> 8;
+    uint32_t amp = isqrt64((uint64_t)(i8 * i8) + (uint64_t)(q8 * q8)) >> 13;
+    return amp > 4095 ? 4095 : (uint16_t)amp;
+}
+
+void soil_ac_init(uint excite_gpio, const uint* adc_gpios, int num_channels) {
+    if (num_channels > SOIL_ADC_MAX_CHANNELS)
+        num_channels = SOIL_ADC_MAX_CHANNELS;
+    s_num_probes = num_channels;
+    for (int i = 0; i < num_channels; i++)
+        s_adc_channel[i] = adc_gpios[i] - 26;
+
+    // Excitation slice: wrap for 31.25 kHz from the live system clock
+    // (exact at 125/250 MHz, within ~30 ppm elsewhere - far inside the
+    // correlation window's bin). Level 0 between bursts keeps the net
+    // driven low, not floating.
+    gpio_set_function(excite_gpio, GPIO_FUNC_PWM);
+    s_slice = pwm_gpio_to_slice_num(excite_gpio);
+    s_pwm_chan = pwm_gpio_to_channel(excite_gpio);
+    uint32_t wrap = clock_get_hz(clk_sys) / SOIL_AC_FREQ_HZ;
+    pwm_set_wrap(s_slice, (uint16_t)(wrap - 1));
+    s_level_on = (uint16_t)(wrap / 2);
+    pwm_set_chan_level(s_slice, s_pwm_chan, 0);
+    pwm_set_enabled(s_slice, true);
+
+    s_dma_chan = res_claim_dma("soil_ac", true);
+    dma_channel_config cfg = dma_channel_get_default_config(s_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_dreq(&cfg, DREQ_ADC);
+    dma_channel_set_read_addr(s_dma_chan, &adc_hw->fifo, false);
+    dma_channel_set_config(s_dma_chan, &cfg, false);
+
+    // Seed the filters so the first control cycle reads converged
+    for (int i = 0; i < num_channels; i++)
+        s_filt[i] = (uint32_t)burst_amplitude(s_adc_channel[i])
+                    << SOIL_ADC_AVG_SHIFT;
+    LogInfo(("soil_ac: %d probe(s), %u Hz excitation on GPIO %u",
+             num_channels, (unsigned)SOIL_AC_FREQ_HZ, excite_gpio));
+}
+
+uint16_t soil_ac_sample(int channel) {
+    if (channel < 0 || channel >= s_num_probes) channel = 0;
+    uint16_t amp = burst_amplitude(s_adc_channel[channel]);
+    uint32_t f = s_filt[channel];
+    s_filt[channel] = f - (f >> SOIL_ADC_AVG_SHIFT) + amp;
+    return (uint16_t)(s_filt[channel] >> SOIL_ADC_AVG_SHIFT);
+}
+
+uint16_t soil_ac_read_avg(int channel) {
+    if (channel < 0 || channel >= s_num_probes) channel = 0;
+    return (uint16_t)(s_filt[channel] >> SOIL_ADC_AVG_SHIFT);
+}
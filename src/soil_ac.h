@@ -0,0 +1,75 @@
+/**
+ * @file soil_ac.h
+ *
+ * @brief AC soil probe excitation with synchronous IQ demodulation
+ *
+ * The DC read path polarizes resistive probes (they electroplate
+ * themselves into drift) and cannot read capacitive probes at all -
+ * those need an AC drive and a measurement of the response amplitude.
+ * This module is that engine: a PWM slice drives the probe's
+ * excitation net with a ~31.25 kHz square wave, the ADC free-runs at
+ * its full 500 ksps on the probe input - exactly 16 samples per
+ * excitation period, both clocks crystal-derived - and a DMA channel
+ * captures one short burst. A fixed-point IQ correlation against a
+ * 16-point quadrature table then yields the response amplitude at the
+ * excitation fundamental; harmonics of the square drive and mains hum
+ * fall out of the correlation for free. Per reading: one ~0.7 ms burst
+ * of DMA (the CPU sleeps through it) and a few hundred multiply-adds
+ * of demodulation - microseconds of CPU.
+ *
+ * The engine borrows the ADC from the round-robin scanner
+ * (soil_adc_suspend/resume) for the burst, so the supply-sag watermark
+ * is blind for under a millisecond per zone per cycle; the excitation
+ * idles low between bursts, so the probe sits unpolarized ~99.9% of
+ * the time either way.
+ *
+ * The amplitude is scaled to the familiar 0..4095 ADC-count range and
+ * folded into the same IIR shape soil_adc keeps, so the calibration
+ * store ("cal dry/wet"), the percent conversion and the median/EMA
+ * stack downstream all apply unchanged - only the physical quantity
+ * under them improves.
+ */
+
+#ifndef SOIL_AC_H
+#define SOIL_AC_H
+
+#include "pico/stdlib.h"
+
+#include "soil_adc.h"
+
+// Excitation and capture geometry. 500 ksps / 16 = 31.25 kHz; the
+// burst is SOIL_AC_SETTLE periods of ring-in discarded plus
+// SOIL_AC_PERIODS periods correlated.
+#define SOIL_AC_SAMPLES_PER_PERIOD 16
+#define SOIL_AC_PERIODS            16
+#define SOIL_AC_SETTLE             3
+
+/**
+ * @brief Claim the excitation pin's PWM slice and seed the filters.
+ *
+ * Call after soil_adc_init(): the seeding bursts borrow the running
+ * scanner. The excitation GPIO drives every zone's probe through the
+ * shared excitation net; per-zone selection is on the sense side.
+ *
+ * @param excite_gpio  PWM-capable pin driving the probe excitation.
+ * @param adc_gpios    Probe sense pins (26-28), as given to soil_adc.
+ * @param num_channels Entries in adc_gpios.
+ */
+void soil_ac_init(uint excite_gpio, const uint* adc_gpios, int num_channels);
+
+/**
+ * @brief Run one excitation burst on a probe and return the filtered
+ *        amplitude.
+ *
+ * Blocks for the burst (~0.7 ms); call from the sensor task's soil
+ * section, once per zone per cycle. The result lands in the channel's
+ * IIR accumulator and the updated average is returned, 0..4095 scale.
+ */
+uint16_t soil_ac_sample(int channel);
+
+/**
+ * @brief Read the filtered amplitude without exciting. Never blocks.
+ */
+uint16_t soil_ac_read_avg(int channel);
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * @file soil_adc.cpp
+ *
+ * @brief Round-robin ADC scanner implementation
+ *
+ * The ADC free-runs with RROBIN set over the enabled inputs; starting
+ * from the lowest input, every DMA block of num-slots samples is one
+ * full sweep in ascending-channel order. The completion handler folds
+ * each slot into its channel's fixed-point IIR accumulator and
+ * re-arms, so sweep boundaries stay aligned as long as the FIFO never
+ * overflows (4-deep FIFO at 1 kHz leaves milliseconds of IRQ slack).
+ */
+
+#include "soil_adc.h"
+
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#include "resource_map.h"
+
+#define ADC_VSYS_CHANNEL 3
+#define ADC_TEMP_CHANNEL 4
+
+static int s_dma_chan = -1;
+static int s_num_slots = 0;                 // scan slots per sweep (probes + vsys + temp)
+static int s_temp_slot = -1;                // slot index of ADC4, -1 if disabled
+static int s_vsys_slot = -1;                // slot index of ADC3, -1 if disabled
+static int s_slot_of_probe[SOIL_ADC_MAX_CHANNELS];
+
+// One sweep's worth of raw samples, refilled by DMA every sweep
+static uint16_t s_block[SOIL_ADC_MAX_CHANNELS + 2];
+
+// Fixed-point accumulators: value << SOIL_ADC_AVG_SHIFT. Written only
+// by the DMA IRQ, read by the control loop; 32-bit reads are atomic.
+static volatile uint32_t s_filt[SOIL_ADC_MAX_CHANNELS + 2];
+
+// Out-of-band watermarks, evaluated per sweep on the filtered value.
+// The armed flags implement the hysteresis: a watermark fires once at
+// the crossing and stays quiet until the value recedes past the band.
+struct SoilAlert {
+    uint16_t low, high, hyst;
+    bool armed_low, armed_high;
+    bool enabled;
+};
+static SoilAlert s_alert[SOIL_ADC_MAX_CHANNELS];
+static SoilAdcAlertFn s_alert_fn;
+static int s_num_probes = 0;
+
+// Supply brown-out watermark, evaluated on the raw ADC3 sample with a
+// consecutive-sweep debounce (see the header for why not the IIR).
+struct VsysAlert {
+    uint16_t low, hyst;
+    uint8_t debounce;
+    uint8_t streak;     // consecutive sweeps on the pending side
+    bool armed;
+    bool enabled;
+};
+static VsysAlert s_vsys_alert;
+static SoilAdcVsysFn s_vsys_fn;
+
+static uint s_input_mask;           // for restoring the scan after a loan
+static volatile bool s_suspended;   // gate against a latched completion IRQ
+
+static void __isr adc_dma_handler(void) {
+    dma_hw->ints0 = 1u << s_dma_chan;  // ack
+    if (s_suspended) return;  // stale completion during a loan: no re-arm
+
+    for (int i = 0; i < s_num_slots; i++) {
+        uint32_t f = s_filt[i];
+        s_filt[i] = f - (f >> SOIL_ADC_AVG_SHIFT) + s_block[i];
+    }
+
+    // Brown-out check first: if the supply really is collapsing, the
+    // hold-up window is being spent in this handler.
+    if (s_vsys_alert.enabled && s_vsys_slot >= 0) {
+        VsysAlert* v = &s_vsys_alert;
+        uint16_t raw = s_block[s_vsys_slot];
+        if (v->armed) {
+            if (raw <= v->low) {
+                if (++v->streak >= v->debounce) {
+                    v->armed = false;
+                    v->streak = 0;
+                    s_vsys_fn(raw);
+                }
+            } else {
+                v->streak = 0;
+            }
+        } else {
+            if (raw >= (uint16_t)(v->low + v->hyst)) {
+                if (++v->streak >= v->debounce) {
+                    v->armed = true;
+                    v->streak = 0;
+                }
+            } else {
+                v->streak = 0;
+            }
+        }
+    }
+
+    // Watermark sweep: a handful of compares at the sweep rate, only
+    // for channels that armed an alert.
+    if (s_alert_fn != NULL) {
+        for (int p = 0; p < s_num_probes; p++) {
+            SoilAlert* a = &s_alert[p];
+            if (!a->enabled) continue;
+            uint16_t avg = (uint16_t)(s_filt[s_slot_of_probe[p]] >> SOIL_ADC_AVG_SHIFT);
+            if (a->armed_low && avg <= a->low) {
+                a->armed_low = false;
+                s_alert_fn(p, avg, false);
+            } else if (!a->armed_low && avg >= (uint16_t)(a->low + a->hyst)) {
+                a->armed_low = true;
+            }
+            if (a->armed_high && avg >= a->high) {
+                a->armed_high = false;
+                s_alert_fn(p, avg, true);
+            } else if (!a->armed_high && avg <= (uint16_t)(a->high - a->hyst)) {
+                a->armed_high = true;
+            }
+        }
+    }
+
+    // Re-arm for the next sweep
+    dma_channel_set_write_addr(s_dma_chan, s_block, false);
+    dma_channel_set_trans_count(s_dma_chan, s_num_slots, true);
+}
+
+void soil_adc_set_alert(int channel, uint16_t low, uint16_t high,
+                        uint16_t hysteresis, SoilAdcAlertFn fn) {
+    if (channel < 0 || channel >= SOIL_ADC_MAX_CHANNELS) return;
+    SoilAlert* a = &s_alert[channel];
+    a->enabled = false;  // quiesce while the fields change under the IRQ
+    a->low = low;
+    a->high = high;
+    a->hyst = hysteresis;
+    // Start armed only on the safe side of each watermark
+    uint16_t avg = soil_adc_read_avg(channel);
+    a->armed_low = avg > low;
+    a->armed_high = avg < high;
+    s_alert_fn = fn;
+    __dmb();
+    a->enabled = (fn != NULL);
+}
+
+void soil_adc_init(const uint* adc_gpios, int num_channels, bool board_temp,
+                   bool vsys) {
+    if (num_channels < 1) num_channels = 1;
+    if (num_channels > SOIL_ADC_MAX_CHANNELS) num_channels = SOIL_ADC_MAX_CHANNELS;
+    s_num_probes = num_channels;
+
+    adc_init();
+
+    // RROBIN visits set bits in ascending channel order; record where
+    // each probe lands in the sweep so reads stay probe-indexed.
+    uint input_mask = 0;
+    uint probe_channel[SOIL_ADC_MAX_CHANNELS];
+    for (int i = 0; i < num_channels; i++) {
+        adc_gpio_init(adc_gpios[i]);
+        probe_channel[i] = adc_gpios[i] - 26;
+        input_mask |= 1u << probe_channel[i];
+    }
+    if (vsys) {
+        // GPIO29 carries VSYS through the board's /3 divider
+        adc_gpio_init(26 + ADC_VSYS_CHANNEL);
+        input_mask |= 1u << ADC_VSYS_CHANNEL;
+    }
+    if (board_temp) {
+        adc_set_temp_sensor_enabled(true);
+        input_mask |= 1u << ADC_TEMP_CHANNEL;
+    }
+
+    s_num_slots = 0;
+    s_temp_slot = -1;
+    s_vsys_slot = -1;
+    for (uint ch = 0; ch <= ADC_TEMP_CHANNEL; ch++) {
+        if (!(input_mask & (1u << ch))) continue;
+        for (int i = 0; i < num_channels; i++)
+            if (probe_channel[i] == ch) s_slot_of_probe[i] = s_num_slots;
+        if (ch == ADC_VSYS_CHANNEL && vsys) s_vsys_slot = s_num_slots;
+        if (ch == ADC_TEMP_CHANNEL) s_temp_slot = s_num_slots;
+        s_num_slots++;
+    }
+
+    // Seed the accumulators so the first control cycle reads sane values
+    for (uint ch = 0, slot = 0; ch <= ADC_TEMP_CHANNEL; ch++) {
+        if (!(input_mask & (1u << ch))) continue;
+        adc_select_input(ch);
+        s_filt[slot++] = (uint32_t)adc_read() << SOIL_ADC_AVG_SHIFT;
+    }
+
+    // Sweeps start from the lowest enabled input
+    s_input_mask = input_mask;
+    adc_select_input(__builtin_ctz(input_mask));
+    adc_set_round_robin(input_mask);
+
+    // FIFO feeds DMA, one-sample DREQ threshold, no error bit, full 12-bit samples
+    adc_fifo_setup(true, true, 1, false, false);
+
+    // Pace conversions at ~1 kHz total: 48 MHz ADC clock / (47999 + 1)
+    adc_set_clkdiv(47999.0f);
+
+    s_dma_chan = res_claim_dma("soil_adc", true);
+    dma_channel_config cfg = dma_channel_get_default_config(s_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_dreq(&cfg, DREQ_ADC);
+
+    dma_channel_configure(s_dma_chan, &cfg,
+                          s_block,           // write address (one sweep)
+                          &adc_hw->fifo,     // read address
+                          s_num_slots,       // one IRQ per sweep
+                          false);
+
+    dma_channel_set_irq0_enabled(s_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, adc_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    dma_channel_start(s_dma_chan);
+    adc_run(true);
+}
+
+void soil_adc_suspend(void) {
+    s_suspended = true;
+    __dmb();
+    adc_run(false);
+    dma_channel_abort(s_dma_chan);
+    dma_hw->ints0 = 1u << s_dma_chan;  // drop any completion we raced
+    adc_fifo_drain();
+}
+
+void soil_adc_resume(void) {
+    // Mirror of the init sequence: sweeps restart from the lowest
+    // enabled input so the block-to-channel mapping holds.
+    adc_select_input(__builtin_ctz(s_input_mask));
+    adc_set_round_robin(s_input_mask);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(47999.0f);
+    dma_channel_set_write_addr(s_dma_chan, s_block, false);
+    s_suspended = false;
+    __dmb();
+    dma_channel_set_trans_count(s_dma_chan, s_num_slots, true);
+    adc_run(true);
+}
+
+uint16_t soil_adc_read_avg(int channel) {
+    if (channel < 0 || channel >= SOIL_ADC_MAX_CHANNELS) channel = 0;
+    return (uint16_t)(s_filt[s_slot_of_probe[channel]] >> SOIL_ADC_AVG_SHIFT);
+}
+
+uint16_t soil_adc_read_temp_raw(void) {
+    if (s_temp_slot < 0) return 0;
+    return (uint16_t)(s_filt[s_temp_slot] >> SOIL_ADC_AVG_SHIFT);
+}
+
+uint16_t soil_adc_read_vsys_raw(void) {
+    if (s_vsys_slot < 0) return 0;
+    return (uint16_t)(s_filt[s_vsys_slot] >> SOIL_ADC_AVG_SHIFT);
+}
+
+void soil_adc_set_vsys_alert(uint16_t low_raw, uint16_t hysteresis,
+                             uint8_t debounce, SoilAdcVsysFn fn) {
+    VsysAlert* v = &s_vsys_alert;
+    v->enabled = false;  // quiesce while the fields change under the IRQ
+    v->low = low_raw;
+    v->hyst = hysteresis;
+    v->debounce = debounce < 1 ? 1 : debounce;
+    v->streak = 0;
+    // Start armed only when the supply is currently healthy
+    v->armed = soil_adc_read_vsys_raw() > low_raw;
+    s_vsys_fn = fn;
+    __dmb();
+    v->enabled = (fn != NULL && s_vsys_slot >= 0);
+}
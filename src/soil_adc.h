@@ -0,0 +1,139 @@
+/**
+ * @file soil_adc.h
+ *
+ * @brief Free-running round-robin ADC sampler for Raspberry Pi Pico
+ *
+ * The RP2040 ADC scans the configured inputs in hardware round-robin
+ * mode while a DMA channel drains the FIFO in one-sweep blocks. The
+ * DMA completion handler demuxes each sweep into per-channel running
+ * averages, so the control loop reads pre-filtered values without ever
+ * blocking on a conversion - adding probes (or the internal
+ * temperature sensor) costs zero additional CPU sampling time.
+ */
+
+#ifndef SOIL_ADC_H
+#define SOIL_ADC_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Maximum number of soil probes (ADC-capable GPIOs 26-28).
+ */
+const int SOIL_ADC_MAX_CHANNELS = 3;
+
+/**
+ * @brief IIR smoothing strength: effective window of 2^shift sweeps.
+ */
+const int SOIL_ADC_AVG_SHIFT = 4;
+
+/**
+ * @brief Start the scanner on the given ADC-capable GPIOs.
+ *
+ * Conversions run at ~1 kHz total, shared round-robin across the
+ * enabled inputs. Call once at boot; readings converge within a few
+ * sweeps (the accumulators are seeded with one blocking read each).
+ *
+ * @param adc_gpios    Array of GPIO pins (26-28), one per soil probe.
+ * @param num_channels Number of entries in adc_gpios (1..SOIL_ADC_MAX_CHANNELS).
+ * @param board_temp   Also scan the internal temperature sensor (ADC4).
+ * @param vsys         Also scan the supply divider on ADC3 (VSYS/3).
+ */
+void soil_adc_init(const uint* adc_gpios, int num_channels, bool board_temp = false,
+                   bool vsys = false);
+
+/**
+ * @brief Alert callback, invoked from the sampler IRQ.
+ *
+ * @param channel Probe index that crossed a watermark.
+ * @param avg     Filtered value at the crossing.
+ * @param high    true for the high watermark, false for the low one.
+ */
+typedef void (*SoilAdcAlertFn)(int channel, uint16_t avg, bool high);
+
+/**
+ * @brief Arm out-of-band watermarks on one probe.
+ *
+ * Evaluated once per sweep in the sampler's completion IRQ, on the
+ * filtered value (so single-sample noise cannot fire it). Each
+ * watermark fires once at the crossing and re-arms only after the
+ * value recedes past the hysteresis band, so a persistent condition
+ * costs one callback, not one per sweep. The callback runs in IRQ
+ * context - FromISR rules apply.
+ *
+ * @param channel    Probe index (0-based).
+ * @param low        Fire when the filtered value drops to/below this.
+ * @param high       Fire when the filtered value rises to/above this.
+ * @param hysteresis Re-arm margin past each watermark, ADC counts.
+ * @param fn         Callback; shared by all armed channels.
+ */
+void soil_adc_set_alert(int channel, uint16_t low, uint16_t high,
+                        uint16_t hysteresis, SoilAdcAlertFn fn);
+
+/**
+ * @brief Pause the scanner and lend out the ADC.
+ *
+ * Stops conversions, aborts the sweep DMA and drains the FIFO so a
+ * borrower (the AC excitation engine) can reconfigure the ADC freely.
+ * Watermarks and the supply alert are blind until resume; keep the
+ * loan to sub-millisecond bursts.
+ */
+void soil_adc_suspend(void);
+
+/**
+ * @brief Restore the round-robin scan after soil_adc_suspend().
+ */
+void soil_adc_resume(void);
+
+/**
+ * @brief Read the running-average soil value for one probe.
+ *
+ * Returns straight from the accumulator maintained by the DMA
+ * completion handler; never blocks.
+ *
+ * @param channel Probe index (0-based, as passed to soil_adc_init()).
+ * @return Averaged 12-bit ADC reading.
+ */
+uint16_t soil_adc_read_avg(int channel);
+
+/**
+ * @brief Read the running-average internal temperature sensor value.
+ *
+ * @return Averaged 12-bit ADC reading of ADC4, or 0 if the sensor was
+ *         not enabled at init.
+ */
+uint16_t soil_adc_read_temp_raw(void);
+
+/**
+ * @brief Read the running-average supply reading (ADC3, VSYS/3).
+ *
+ * @return Averaged 12-bit ADC reading, or 0 if vsys was not enabled.
+ */
+uint16_t soil_adc_read_vsys_raw(void);
+
+/**
+ * @brief Supply sag callback, invoked from the sampler IRQ.
+ *
+ * @param raw The raw (unfiltered) ADC3 sample that confirmed the sag.
+ */
+typedef void (*SoilAdcVsysFn)(uint16_t raw);
+
+/**
+ * @brief Arm a supply brown-out watermark on the VSYS channel.
+ *
+ * Unlike the probe watermarks this one evaluates the RAW per-sweep
+ * sample, not the IIR view - a pump-inrush sag lasts tens of
+ * milliseconds and the filter's lag would eat the hold-up window.
+ * Noise rejection comes from the debounce instead: the callback fires
+ * only after @p debounce consecutive sweeps at/below the watermark,
+ * then latches until the raw value has spent the same number of sweeps
+ * back above watermark + hysteresis. The callback runs in IRQ context.
+ *
+ * @param low_raw    Fire at/below this raw ADC3 value.
+ * @param hysteresis Re-arm margin above the watermark, ADC counts.
+ * @param debounce   Consecutive sweeps required on either side (>= 1).
+ * @param fn         Callback, or NULL to disarm.
+ */
+void soil_adc_set_vsys_alert(uint16_t low_raw, uint16_t hysteresis,
+                             uint8_t debounce, SoilAdcVsysFn fn);
+
+#endif
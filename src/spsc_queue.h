@@ -0,0 +1,92 @@
+/**
+ * @file spsc_queue.h
+ *
+ * @brief Lock-free single-producer/single-consumer pipeline ring
+ *
+ * xQueueSend/Receive take the kernel critical section on every
+ * operation; for the two hot stage handoffs (sensor -> inference ->
+ * actuation, exactly one producer and one consumer each) a lock-free
+ * ring does the copy in tens of cycles instead. Fixed power-of-two
+ * capacity, free-running 32-bit indices, release store on publish and
+ * acquire load on consume - the same discipline the log ring uses,
+ * generalized over the payload type.
+ *
+ * Blocking is kept off the data path: a task that finds the ring empty
+ * (or full) advertises that it is waiting and sleeps on its task
+ * notification; the other side sends the notification only when it saw
+ * the flag. The 1-tick notification timeout makes the flag handshake's
+ * benign race self-healing instead of requiring a second barrier
+ * protocol. FreeRTOS queues remain the right tool for anything with
+ * multiple producers or consumers.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+template <typename T, uint32_t N>
+struct SpscQueue {
+    static_assert((N & (N - 1)) == 0, "capacity must be a power of two");
+
+    T slot[N];
+    volatile uint32_t head;  ///< consumer index (free-running)
+    volatile uint32_t tail;  ///< producer index (free-running)
+    TaskHandle_t consumer;   ///< self-registered on first pop
+    TaskHandle_t producer;   ///< self-registered on first push
+    volatile bool consumer_waiting;
+    volatile bool producer_waiting;
+
+    bool try_push(const T& v) {
+        if (tail - __atomic_load_n(&head, __ATOMIC_ACQUIRE) == N) return false;
+        slot[tail & (N - 1)] = v;
+        __atomic_store_n(&tail, tail + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    bool try_pop(T* out) {
+        if (__atomic_load_n(&tail, __ATOMIC_ACQUIRE) == head) return false;
+        *out = slot[head & (N - 1)];
+        __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /** @brief Push, sleeping on the task notification while full. */
+    void push(const T& v) {
+        if (producer == nullptr) producer = xTaskGetCurrentTaskHandle();
+        while (!try_push(v)) {
+            producer_waiting = true;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (try_push(v)) {
+                producer_waiting = false;
+                break;
+            }
+            ulTaskNotifyTake(pdTRUE, 1);
+        }
+        if (consumer_waiting) {
+            consumer_waiting = false;
+            xTaskNotifyGive(consumer);
+        }
+    }
+
+    /** @brief Pop, sleeping on the task notification while empty. */
+    void pop(T* out) {
+        if (consumer == nullptr) consumer = xTaskGetCurrentTaskHandle();
+        while (!try_pop(out)) {
+            consumer_waiting = true;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (try_pop(out)) {
+                consumer_waiting = false;
+                break;
+            }
+            ulTaskNotifyTake(pdTRUE, 1);
+        }
+        if (producer_waiting) {
+            producer_waiting = false;
+            xTaskNotifyGive(producer);
+        }
+    }
+};
+
+#endif
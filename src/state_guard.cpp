@@ -0,0 +1,136 @@
+/**
+ * @file state_guard.cpp
+ *
+ * @brief Incremental state checksum implementation
+ *
+ * Fixed slot table, no allocation. Each slot keeps the sealed FNV-1a
+ * sum plus a generation counter bumped by every seal; the rotation
+ * cursor walks the rotated slots one per step. The suspect flag is
+ * the one-cycle grace for rotated blocks: a verify that raced a
+ * legitimate write mismatches once, the writer's seal moves the
+ * generation, and the suspicion clears without a trip.
+ */
+
+#include "state_guard.h"
+
+#include "app_log.h"
+#include "err_stats.h"
+
+struct GuardSlot {
+    const char* name;
+    const uint8_t* data;
+    uint32_t len;
+    uint32_t sum;          // sealed checksum
+    uint32_t gen;          // bumped per seal; grace discriminator
+    uint32_t suspect_gen;  // generation at the first rotated mismatch
+    bool suspect;
+    bool rotate;
+    StateGuardReinit reinit;
+};
+
+static GuardSlot s_slot[STATE_GUARD_MAX_BLOCKS];
+static int s_count;
+static int s_cursor;
+static uint32_t s_trips;
+
+// FNV-1a, same choice as warm_state: byte-oriented, cheap on M0+,
+// and a zeroed block does not sum to zero.
+static uint32_t block_sum(const uint8_t* p, uint32_t len) {
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void trip(GuardSlot* s) {
+    s_trips++;
+    err_stats_bump(ERR_STATE_GUARD);
+    if (err_stats_detail_allowed(ERR_STATE_GUARD))
+        LogError(("state guard: '%s' checksum mismatch (%u bytes), "
+                  "re-initializing", s->name, (unsigned)s->len));
+    s->suspect = false;
+    if (s->reinit != NULL) {
+        s->reinit();
+        s->gen++;
+        s->sum = block_sum(s->data, s->len);
+    }
+    // NULL reinit: contents left for the owner, who re-inits on the
+    // false return from state_guard_check() and seals.
+}
+
+int state_guard_register(const char* name, const void* data, size_t len,
+                         StateGuardReinit reinit, bool rotate) {
+    if (s_count >= STATE_GUARD_MAX_BLOCKS) {
+        LogWarn(("state guard: table full, '%s' unguarded", name));
+        return -1;
+    }
+    if (len == 0 || len > STATE_GUARD_MAX_BLOCK_BYTES) {
+        LogWarn(("state guard: '%s' %u bytes exceeds %u, unguarded",
+                 name, (unsigned)len, (unsigned)STATE_GUARD_MAX_BLOCK_BYTES));
+        return -1;
+    }
+    GuardSlot* s = &s_slot[s_count];
+    s->name = name;
+    s->data = (const uint8_t*)data;
+    s->len = (uint32_t)len;
+    s->sum = block_sum(s->data, s->len);
+    s->gen = 0;
+    s->suspect = false;
+    s->rotate = rotate;
+    s->reinit = reinit;
+    return s_count++;
+}
+
+void state_guard_seal(int handle) {
+    if (handle < 0 || handle >= s_count) return;
+    GuardSlot* s = &s_slot[handle];
+    s->sum = block_sum(s->data, s->len);
+    s->gen++;
+    s->suspect = false;
+}
+
+bool state_guard_check(int handle) {
+    if (handle < 0 || handle >= s_count) return true;
+    GuardSlot* s = &s_slot[handle];
+    if (block_sum(s->data, s->len) == s->sum) {
+        s->suspect = false;
+        return true;
+    }
+    // Owner context: the sealing task is the calling task, so there
+    // is no write to race and the mismatch is corruption outright.
+    trip(s);
+    return false;
+}
+
+void state_guard_step(void) {
+    if (s_count == 0) return;
+    for (int tries = 0; tries < s_count; tries++) {
+        GuardSlot* s = &s_slot[s_cursor];
+        s_cursor = (s_cursor + 1) % s_count;
+        if (!s->rotate) continue;
+
+        // Generation snapshot brackets the scan: a seal landing inside
+        // it means the writer moved the block under us - discard.
+        uint32_t gen = s->gen;
+        uint32_t sum = block_sum(s->data, s->len);
+        if (gen != s->gen) return;
+
+        if (sum == s->sum) {
+            s->suspect = false;
+        } else if (s->suspect && s->suspect_gen == s->gen) {
+            // Second mismatch with no intervening seal: corruption,
+            // not a half-landed store.
+            trip(s);
+        } else {
+            s->suspect = true;
+            s->suspect_gen = s->gen;
+        }
+        return;  // one block per step keeps the cycle cost bounded
+    }
+}
+
+uint32_t state_guard_trips(void) {
+    return s_trips;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file state_guard.h
+ *
+ * @brief Incremental checksums over critical control state
+ *
+ * SRAM corruption on marginal supplies is quiet: a flipped bit in a
+ * history ring's running sums or in the calibration cache does not
+ * crash anything, it just skews every decision drawn from that block
+ * for days. This module keeps an FNV-1a checksum per registered block
+ * and re-verifies continuously at a sliver of the cost of a full
+ * scan: one block per call, each a few hundred bytes at most, so a
+ * verification step stays in single-digit microseconds.
+ *
+ * Two usage patterns, chosen per block at registration:
+ *
+ *  - Owner-checked (rotate = false): state the owning task mutates
+ *    every cycle (filter rings, dwell state). The owner calls
+ *    state_guard_check() before reading its block each cycle and
+ *    state_guard_seal() after the cycle's writes. Same task on both
+ *    sides, so a mismatch is corruption, never a race, and trips
+ *    immediately.
+ *
+ *  - Rotated (rotate = true): quasi-static blocks mutated only
+ *    through their store API (calibration cache, runtime config).
+ *    state_guard_step() - report task, once per cycle - verifies the
+ *    next such block round-robin. The store's writer seals after each
+ *    legitimate write; a verify that lands inside the write window
+ *    is absorbed by a one-cycle grace (the seal bumps the block's
+ *    generation, clearing suspicion), so only a mismatch that
+ *    persists across an unchanged generation trips.
+ *
+ * A trip bumps ERR_STATE_GUARD, logs a rate-limited detail line, and
+ * re-initializes the block: through the registered callback where one
+ * was given (stores reload from flash), otherwise the owner reacts to
+ * the false return from state_guard_check() and re-seals - the
+ * function-local filter statics cannot be reached by a file-scope
+ * callback.
+ *
+ * Enabled with QDNN_STATE_GUARD. Slots are single-owner by contract
+ * (same rule as warm_state), so seal/check need no locking.
+ */
+
+#ifndef STATE_GUARD_H
+#define STATE_GUARD_H
+
+#include "pico/stdlib.h"
+
+/** @brief Registration table size; registration past this fails. */
+#define STATE_GUARD_MAX_BLOCKS 12
+
+/** @brief Per-block size cap, keeping every verify step bounded. */
+#define STATE_GUARD_MAX_BLOCK_BYTES 512
+
+/**
+ * @brief Re-initializer invoked when a rotated block trips; restores
+ *        the block to a sane state (defaults and/or flash reload).
+ */
+typedef void (*StateGuardReinit)(void);
+
+/**
+ * @brief Register a block and seal its current contents.
+ *
+ * @param name   Short tag for the trip log line.
+ * @param data   Block start; must outlive the guard (statics only).
+ * @param len    Block length, at most STATE_GUARD_MAX_BLOCK_BYTES.
+ * @param reinit Re-initializer for rotated blocks; NULL for
+ *               owner-checked blocks (the caller re-inits and seals).
+ * @param rotate True to include in the state_guard_step() rotation.
+ *
+ * @return Handle for seal/check, or -1 (table full / block too big).
+ */
+int state_guard_register(const char* name, const void* data, size_t len,
+                         StateGuardReinit reinit, bool rotate);
+
+/**
+ * @brief Re-seal a block after a legitimate write. Owner context only.
+ */
+void state_guard_seal(int handle);
+
+/**
+ * @brief Verify a block now, from its owning task.
+ *
+ * @return False when the block tripped: with a NULL reinit the
+ *         contents are untouched and the caller must re-initialize
+ *         and seal.
+ */
+bool state_guard_check(int handle);
+
+/**
+ * @brief Verify the next rotated block. Once per cycle from the
+ *        report task; bounded by the per-block size cap.
+ */
+void state_guard_step(void);
+
+/**
+ * @brief Total trips since boot (also counted under ERR_STATE_GUARD).
+ */
+uint32_t state_guard_trips(void);
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file task_stats.cpp
+ *
+ * @brief Task CPU share collection implementation
+ */
+
+#include "task_stats.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+// Run-time counter for the kernel (portGET_RUN_TIME_COUNTER_VALUE):
+// the free-running 1 MHz system timer, one register read.
+extern "C" unsigned long ulTaskStatsGetRunTimeCounter(void) {
+    return time_us_32();
+}
+
+// Previous-counter values keyed by kernel task number, so shares are
+// per-interval deltas rather than since-boot averages.
+#define TASK_STATS_MAX_TASK_NUMBER 16
+static uint32_t s_prev_runtime[TASK_STATS_MAX_TASK_NUMBER];
+static uint32_t s_prev_total;
+
+void task_stats_collect(TaskStatsReport* out) {
+    TaskStatus_t status[TASK_STATS_MAX_TASKS];
+    uint32_t total_runtime = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, TASK_STATS_MAX_TASKS, &total_runtime);
+
+    uint32_t interval = total_runtime - s_prev_total;
+    s_prev_total = total_runtime;
+    if (interval == 0) interval = 1;
+
+    out->num_tasks = (uint8_t)n;
+    out->interval_us = interval;
+    for (UBaseType_t i = 0; i < n; i++) {
+        TaskCpuStat* t = &out->task[i];
+        for (int c = 0; c < 4; c++) t->name[c] = status[i].pcTaskName[c];
+        t->name[4] = '\0';
+        t->task_number = (uint8_t)status[i].xTaskNumber;
+
+        uint32_t prev = (status[i].xTaskNumber < TASK_STATS_MAX_TASK_NUMBER)
+                            ? s_prev_runtime[status[i].xTaskNumber] : 0;
+        uint32_t delta = status[i].ulRunTimeCounter - prev;
+        if (status[i].xTaskNumber < TASK_STATS_MAX_TASK_NUMBER)
+            s_prev_runtime[status[i].xTaskNumber] = status[i].ulRunTimeCounter;
+
+        uint64_t permille = (uint64_t)delta * 1000u / interval;
+        t->cpu_permille = permille > 1000 ? 1000 : (uint16_t)permille;
+
+        // Minimum-ever free stack: a stack is right-sized when this
+        // settles just above the guard margin.
+        t->stack_hwm_words = (uint16_t)status[i].usStackHighWaterMark;
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * @file task_stats.h
+ *
+ * @brief Per-task CPU share collection on the FreeRTOS trace facility
+ *
+ * The kernel accrues per-task run time against the free-running 1 MHz
+ * system timer (configGENERATE_RUN_TIME_STATS). This module snapshots
+ * uxTaskGetSystemState() into fixed structs and computes each task's
+ * CPU share over the interval since the previous snapshot - no string
+ * formatting on target, ready for the binary telemetry stream. An
+ * inference task crowding out sensing, or a logging task running at
+ * the wrong priority, shows up directly in the per-task permille.
+ * Each snapshot also carries the stack high-water mark per task, so
+ * stacks can be trimmed to measured peak plus guard and the reclaimed
+ * SRAM given back to arenas and DMA buffering.
+ */
+
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Upper bound on tracked tasks (4 app + idle + timer + slack).
+ */
+const int TASK_STATS_MAX_TASKS = 8;
+
+/**
+ * @brief CPU share and stack usage of one task.
+ */
+struct TaskCpuStat {
+    char name[5];             ///< first four chars of the task name, NUL-terminated
+    uint8_t task_number;      ///< stable kernel task number
+    uint16_t cpu_permille;    ///< share of the interval, 0..1000
+    uint16_t stack_hwm_words; ///< minimum-ever free stack, in words
+};
+
+/**
+ * @brief One collection: per-task shares plus the interval they cover.
+ */
+struct TaskStatsReport {
+    uint8_t num_tasks;
+    TaskCpuStat task[TASK_STATS_MAX_TASKS];
+    uint32_t interval_us;   ///< run-time counter delta the shares are relative to
+};
+
+/**
+ * @brief Snapshot the trace facility and compute deltas since the last call.
+ *
+ * The first call establishes the baseline and reports shares since boot.
+ */
+void task_stats_collect(TaskStatsReport* out);
+
+#endif
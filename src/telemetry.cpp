@@ -0,0 +1,804 @@
+/**
+ * @file telemetry.cpp
+ *
+ * @brief Binary telemetry frame output implementation
+ */
+
+#include "telemetry.h"
+
+#include <string.h>
+
+#include "boot_stages.h"
+#if QDNN_BOOT_LADDER
+#include "boot_ladder.h"
+#endif
+#include "device_id.h"
+#include "lock_stats.h"
+#include "log_ring.h"
+#include "queue_stats.h"
+#include "warm_state.h"
+#if QDNN_PUMP_DUTY
+#include "board_profile.h"
+#include "pump_duty.h"
+#endif
+#if QDNN_METRICS
+#include "metrics.h"
+#endif
+#if QDNN_DATALOG
+#include "datalog.h"
+#endif
+#if QDNN_NET_UPLINK
+#include "net_uplink.h"
+#endif
+
+// SOF bytes, frame structs, CRC and varint primitives come from
+// telemetry_wire.h (via telemetry.h) - shared verbatim with the host
+// decoder so the two ends cannot drift apart.
+
+static uint16_t s_heap_seq = 0;
+
+// Wall-clock correlation pair, set by telemetry_set_wallclock(). The
+// monotonic side never stops (the timer stays clocked in the low-power
+// sleep state), so one pair per boot is enough to extrapolate from.
+static uint32_t s_wall_epoch_s = 0;
+static uint64_t s_wall_ref_us = 0;
+static bool s_wall_valid = false;
+
+// Frame timestamp: low 32 bits of the monotonic counter, captured in
+// the producer's emit call so queueing and drain delay never skew it.
+static inline uint32_t stamp_us(void) {
+    return (uint32_t)time_us_64();
+}
+
+// Zero-copy frame construction: every emitter reserves its slot
+// directly in the console ring, writes fields in place and commits -
+// no builder-buffer memcpy between the field stores and the wire (the
+// drain task hands the committed span straight to the UART DMA
+// channel). A reservation that would straddle the ring's wrap point
+// falls back to the caller-provided stack frame plus one copy; the
+// flash datalog and WiFi uplink tees copy by nature of their media
+// either way, reading the committed bytes in place.
+static uint8_t* frame_begin(size_t maxlen, uint8_t* fallback) {
+    uint8_t* p = log_ring_reserve(maxlen);
+    return p != NULL ? p : fallback;
+}
+
+#if QDNN_TELEM_DELTA
+static size_t delta_encode_sample(const uint8_t* frame, size_t len, uint8_t* out);
+#endif
+
+static void frame_end(const uint8_t* frame, size_t len, const uint8_t* fallback) {
+#if QDNN_BOOT_LADDER
+    // Third ladder step: a crash-looping unit mutes the binary frames
+    // (console, tees and all); the one central commit point makes the
+    // mute total. The human-readable log keeps flowing for diagnosis.
+    if (!boot_ladder_allows(LADDER_TELEM)) return;
+#endif
+    if (frame == fallback)
+        log_ring_write(frame, len);  // wrap-point miss: one copied frame
+    else
+        log_ring_commit(len);
+#if QDNN_DATALOG || QDNN_NET_UPLINK
+    const uint8_t* tee = frame;
+    size_t tee_len = len;
+#if QDNN_TELEM_DELTA
+    // Storage/radio tees get the delta stream; the console above stays
+    // raw so a live host never needs reconstruction state.
+    uint8_t enc[32];
+    size_t elen = delta_encode_sample(frame, len, enc);
+    if (elen) { tee = enc; tee_len = elen; }
+#endif
+#if QDNN_DATALOG
+    datalog_append(tee, tee_len);
+#endif
+#if QDNN_NET_UPLINK
+    net_uplink_push(tee, tee_len);
+#endif
+#endif
+}
+
+#if QDNN_TELEM_DELTA
+// --- Delta codec for the storage/radio tees (0xB2, telemetry.h) ---
+// Only the per-cycle sample frame is worth compressing: it dominates
+// the stream by count and is almost entirely redundant between cycles
+// (temperature moves 0.1 C an hour). Everything rides zigzag varints
+// against the last committed frame; the sequence number is implicit
+// (+1 per delta) and the timestamp is second-order (its delta against
+// the previous cycle's delta - zero on a steady cadence). A keyframe
+// (the raw frame) goes out every QDNN_TELEM_DELTA_KEYFRAME samples or
+// whenever continuity breaks, so a decoder joining mid-stream locks on
+// within one key interval.
+#ifndef QDNN_TELEM_DELTA_KEYFRAME
+#define QDNN_TELEM_DELTA_KEYFRAME 16
+#endif
+
+static TelemetryFrame s_delta_prev;
+static bool s_delta_have_prev = false;
+static bool s_delta_tdelta_known = false;
+static uint32_t s_delta_prev_tdelta = 0;
+static unsigned s_delta_since_key = 0;
+
+// Encode one committed frame for the tees. Returns the encoded length,
+// or 0 when the raw frame itself should go out (non-sample frame, or
+// this sample is a keyframe).
+static size_t delta_encode_sample(const uint8_t* frame, size_t len, uint8_t* out) {
+    if (len != sizeof(TelemetryFrame) || frame[0] != TELEMETRY_SOF)
+        return 0;
+    TelemetryFrame cur;
+    memcpy(&cur, frame, sizeof(cur));
+
+    bool key = !s_delta_have_prev ||
+               s_delta_since_key >= QDNN_TELEM_DELTA_KEYFRAME ||
+               (uint16_t)(cur.seq - s_delta_prev.seq) != 1;
+    if (!key) {
+        size_t n = 3;  // SOF + two bitmap bytes (sample v4)
+        uint8_t bitmap = 0;
+        uint8_t bitmap2 = 0;
+        uint32_t tdelta = cur.t_us - s_delta_prev.t_us;
+        if (!s_delta_tdelta_known || tdelta != s_delta_prev_tdelta) {
+            bitmap |= 0x80;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)(tdelta - s_delta_prev_tdelta)));
+        }
+        if (cur.temp10 != s_delta_prev.temp10) {
+            bitmap |= 0x01;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32(cur.temp10 - s_delta_prev.temp10));
+        }
+        if (cur.humid10 != s_delta_prev.humid10) {
+            bitmap |= 0x02;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.humid10 - s_delta_prev.humid10));
+        }
+        if (cur.soil_raw != s_delta_prev.soil_raw) {
+            bitmap |= 0x04;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.soil_raw - s_delta_prev.soil_raw));
+        }
+        if (cur.soil10 != s_delta_prev.soil10) {
+            bitmap |= 0x08;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.soil10 - s_delta_prev.soil10));
+        }
+        if (cur.fan_level != s_delta_prev.fan_level) {
+            bitmap |= 0x10;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.fan_level - s_delta_prev.fan_level));
+        }
+        if (cur.pump_level != s_delta_prev.pump_level) {
+            bitmap |= 0x20;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.pump_level - s_delta_prev.pump_level));
+        }
+        if (cur.flags != s_delta_prev.flags) {
+            bitmap |= 0x40;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.flags - s_delta_prev.flags));
+        }
+        if (cur.fan_conf != s_delta_prev.fan_conf) {
+            bitmap2 |= 0x01;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.fan_conf - s_delta_prev.fan_conf));
+        }
+        if (cur.pump_conf != s_delta_prev.pump_conf) {
+            bitmap2 |= 0x02;
+            n += telemetry_put_varint(out + n, telemetry_zigzag32((int32_t)cur.pump_conf - s_delta_prev.pump_conf));
+        }
+        out[0] = TELEMETRY_DELTA_SOF;
+        out[1] = bitmap;
+        out[2] = bitmap2;
+        uint16_t crc = telemetry_crc16(out, n);
+        out[n++] = (uint8_t)(crc & 0xFF);
+        out[n++] = (uint8_t)(crc >> 8);
+        // A pathological frame that encodes no smaller than raw is
+        // promoted to a keyframe instead (cannot happen on the normal
+        // layout, kept as the safety rail).
+        if (n < sizeof(TelemetryFrame)) {
+            s_delta_prev_tdelta = tdelta;
+            s_delta_tdelta_known = true;
+            s_delta_prev = cur;
+            s_delta_since_key++;
+            return n;
+        }
+    }
+
+    s_delta_prev = cur;
+    s_delta_have_prev = true;
+    s_delta_tdelta_known = false;  // first delta after a key carries time
+    s_delta_since_key = 0;
+    return 0;
+}
+#endif  // QDNN_TELEM_DELTA
+
+void telemetry_emit(const TelemetrySample* sample) {
+    uint8_t fb[sizeof(TelemetryFrame)];
+    TelemetryFrame* f = (TelemetryFrame*)frame_begin(sizeof(TelemetryFrame), fb);
+    f->sof        = TELEMETRY_SOF;
+    f->version    = TELEMETRY_VERSION;
+    // The sequence number IS the source frame's cycle number (low 16
+    // bits), not an emission counter: a gap now means the pipeline
+    // actually skipped cycles, and an actuation attributes back to its
+    // acquisition by number. Discontinuities force a delta keyframe
+    // below, so the tees stay decodable.
+    f->seq        = (uint16_t)sample->cycle_seq;
+    f->t_us       = stamp_us();
+    f->temp10     = (int16_t)(sample->temp * 10.0f + (sample->temp >= 0 ? 0.5f : -0.5f));
+    f->humid10    = (uint16_t)(sample->humid * 10.0f + 0.5f);
+    f->soil_raw   = sample->soil_raw;
+    f->soil10     = (uint16_t)(sample->soil_pct * 10.0f + 0.5f);
+    f->fan_level  = sample->fan_level;
+    f->pump_level = sample->pump_level;
+    f->fan_conf   = sample->fan_conf;
+    f->pump_conf  = sample->pump_conf;
+    f->flags      = sample->stale_mask;
+    f->crc        = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    // Non-blocking: the drain task moves the frame to stdio later
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+// Saturate the 16-bit counter fields instead of wrapping: a maxed-out
+// field still reads as "worth a look" months after the first overflow.
+static uint16_t sat16(uint32_t v) {
+    return v > 0xFFFF ? 0xFFFF : (uint16_t)v;
+}
+
+void telemetry_emit_heap(const HeapStats* stats) {
+    uint8_t fb[sizeof(HeapFrame)];
+    HeapFrame* f = (HeapFrame*)frame_begin(sizeof(HeapFrame), fb);
+    f->sof              = TELEMETRY_HEAP_SOF;
+    f->version          = TELEMETRY_VERSION;
+    f->seq              = s_heap_seq++;
+    f->t_us             = stamp_us();
+    f->free_bytes       = stats->free_bytes;
+    f->min_ever_free    = stats->min_ever_free_bytes;
+    f->largest_block    = stats->largest_free_block;
+    f->pool_heap_allocs = sat16(stats->pool_heap_allocs);
+    f->pool_exhausted   = sat16(stats->pool_exhausted);
+    f->crc              = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_emit_tasks(const TaskStatsReport* report) {
+    // Variable length: 13-byte header + 9 bytes per task + CRC
+    uint8_t fb[13 + TASK_STATS_MAX_TASKS * 9 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t n = 0;
+    buf[n++] = TELEMETRY_TASKS_SOF;
+    buf[n++] = TELEMETRY_VERSION;
+    static uint16_t s_tasks_seq = 0;
+    buf[n++] = (uint8_t)(s_tasks_seq & 0xFF);
+    buf[n++] = (uint8_t)(s_tasks_seq >> 8);
+    s_tasks_seq++;
+    uint32_t t_us = stamp_us();
+    buf[n++] = (uint8_t)(t_us & 0xFF);
+    buf[n++] = (uint8_t)(t_us >> 8);
+    buf[n++] = (uint8_t)(t_us >> 16);
+    buf[n++] = (uint8_t)(t_us >> 24);
+    buf[n++] = (uint8_t)(report->interval_us & 0xFF);
+    buf[n++] = (uint8_t)(report->interval_us >> 8);
+    buf[n++] = (uint8_t)(report->interval_us >> 16);
+    buf[n++] = (uint8_t)(report->interval_us >> 24);
+    buf[n++] = report->num_tasks;
+    for (int i = 0; i < report->num_tasks && i < TASK_STATS_MAX_TASKS; i++) {
+        const TaskCpuStat* t = &report->task[i];
+        for (int c = 0; c < 4; c++) buf[n++] = (uint8_t)t->name[c];
+        buf[n++] = t->task_number;
+        buf[n++] = (uint8_t)(t->cpu_permille & 0xFF);
+        buf[n++] = (uint8_t)(t->cpu_permille >> 8);
+        buf[n++] = (uint8_t)(t->stack_hwm_words & 0xFF);
+        buf[n++] = (uint8_t)(t->stack_hwm_words >> 8);
+    }
+    uint16_t crc = telemetry_crc16(buf, n);
+    buf[n++] = (uint8_t)(crc & 0xFF);
+    buf[n++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, n, fb);
+}
+
+void telemetry_emit_power(const IdleMeterReport* report) {
+    static uint16_t s_power_seq = 0;
+    uint8_t fb[sizeof(PowerFrame)];
+    PowerFrame* f = (PowerFrame*)frame_begin(sizeof(PowerFrame), fb);
+    f->sof           = TELEMETRY_POWER_SOF;
+    f->version       = 2;
+    f->seq           = s_power_seq++;
+    f->t_us          = stamp_us();
+    f->interval_us   = report->interval_us;
+    f->idle_us       = report->idle_us;
+    f->idle_permille = report->idle_permille;
+    f->wakes         = sat16(report->wakes);
+    f->crc           = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_emit_energy(const EnergyReport* report) {
+    static uint16_t s_energy_seq = 0;
+    uint8_t fb[sizeof(EnergyFrame)];
+    EnergyFrame* f = (EnergyFrame*)frame_begin(sizeof(EnergyFrame), fb);
+    f->sof         = TELEMETRY_ENERGY_SOF;
+    f->version     = 1;
+    f->seq         = s_energy_seq++;
+    f->t_us        = stamp_us();
+    f->vsys_mv     = report->vsys_mv;
+    f->state       = report->state;
+    f->actions     = report->actions;
+    f->transitions = report->transitions;
+    f->est_mw      = report->est_mw;
+    f->crc         = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_emit_replay(ReplayRecord* rec) {
+    uint8_t fb[sizeof(ReplayRecord)];
+    ReplayRecord* f = (ReplayRecord*)frame_begin(sizeof(ReplayRecord), fb);
+    if (f != rec) *f = *rec;
+    f->sof     = TELEMETRY_REPLAY_SOF;
+    f->version = 1;
+    f->crc     = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_emit_anomaly(uint16_t score_q8, uint16_t threshold_q8) {
+    static uint16_t s_anom_seq = 0;
+    uint8_t fb[sizeof(AnomFrame)];
+    AnomFrame* f = (AnomFrame*)frame_begin(sizeof(AnomFrame), fb);
+    f->sof          = TELEMETRY_ANOM_SOF;
+    f->version      = 2;
+    f->seq          = s_anom_seq++;
+    f->t_us         = stamp_us();
+    f->score_q8     = score_q8;
+    f->threshold_q8 = threshold_q8;
+    f->crc          = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_set_wallclock(uint32_t epoch_s) {
+    s_wall_ref_us = time_us_64();
+    s_wall_epoch_s = epoch_s;
+    s_wall_valid = true;
+}
+
+uint32_t telemetry_wallclock_s(void) {
+    if (!s_wall_valid) return 0;
+    return s_wall_epoch_s + (uint32_t)((time_us_64() - s_wall_ref_us) / 1000000u);
+}
+
+void telemetry_emit_timesync(void) {
+    static uint16_t s_time_seq = 0;
+    uint64_t now = time_us_64();
+    uint8_t fb[sizeof(TimeSyncFrame)];
+    TimeSyncFrame* f = (TimeSyncFrame*)frame_begin(sizeof(TimeSyncFrame), fb);
+    f->sof        = TELEMETRY_TIME_SOF;
+    f->version    = 1;
+    f->seq        = s_time_seq++;
+    f->t_us       = now;
+    f->wall_s     = s_wall_valid
+                    ? s_wall_epoch_s + (uint32_t)((now - s_wall_ref_us) / 1000000u)
+                    : 0;
+    f->wall_valid = s_wall_valid ? 1 : 0;
+    f->crc        = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
+
+void telemetry_emit_errors(const uint32_t* counts, uint8_t n) {
+    // Variable length: 9-byte header + 4 bytes per counter + CRC.
+    // Sized for a few slots of growth past the current ErrSite table.
+    static uint16_t s_err_seq = 0;
+    uint8_t fb[9 + 16 * 4 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    if (n > 16) n = 16;
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_ERR_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_err_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_err_seq >> 8);
+    s_err_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    buf[idx++] = n;
+    for (int i = 0; i < n; i++) {
+        buf[idx++] = (uint8_t)(counts[i] & 0xFF);
+        buf[idx++] = (uint8_t)(counts[i] >> 8);
+        buf[idx++] = (uint8_t)(counts[i] >> 16);
+        buf[idx++] = (uint8_t)(counts[i] >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+
+// Boot-report sidecar fields, deposited by whoever measured them
+// before the one-shot emit after the first decision. Slot 0 is the
+// fan model, slot 1 the pump model; unreported fields ship as 0.
+#ifndef QDNN_BUILD_ID
+#define QDNN_BUILD_ID 0
+#endif
+static uint8_t s_boot_reset_cause;
+static uint32_t s_boot_model_crc[2];
+static uint32_t s_boot_arena_used[2];
+
+void telemetry_boot_note_reset(uint8_t cause) {
+    s_boot_reset_cause = cause;
+}
+
+void telemetry_boot_note_model(int which, uint32_t crc32,
+                               uint32_t arena_used) {
+    // Zero fields leave the slot untouched: the CRC arrives from the
+    // init-time sweep, the arena figure from the interpreter's own
+    // bring-up, each from its own call.
+    if (which < 0 || which > 1) return;
+    if (crc32 != 0) s_boot_model_crc[which] = crc32;
+    if (arena_used != 0) s_boot_arena_used[which] = arena_used;
+}
+
+void telemetry_emit_boot(void) {
+    // Variable length: 35-byte header + 8 bytes per stage + CRC.
+    static uint16_t s_boot_seq = 0;
+    uint8_t fb[TELEMETRY_BOOT_HDR + BOOT_STAGE_MAX * 8 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    int n = boot_stages_count();
+    if (n > BOOT_STAGE_MAX) n = BOOT_STAGE_MAX;
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_BOOT_SOF;
+    buf[idx++] = 3;
+    buf[idx++] = (uint8_t)(s_boot_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_boot_seq >> 8);
+    s_boot_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    // v2: warm/cold provenance - boot counter plus the warm flag, so
+    // the host can split bring-up timings by start type
+    uint32_t boots = warm_state_boot_count();
+    buf[idx++] = (uint8_t)(boots & 0xFF);
+    buf[idx++] = (uint8_t)(boots >> 8);
+    buf[idx++] = (uint8_t)(boots >> 16);
+    buf[idx++] = (uint8_t)(boots >> 24);
+    buf[idx++] = warm_state_is_warm() ? 1 : 0;
+    // v3: the self-documenting baseline - why we restarted, what build
+    // and models are running, and how full the arenas came up
+    buf[idx++] = s_boot_reset_cause;
+    uint32_t words[5] = { (uint32_t)QDNN_BUILD_ID,
+                          s_boot_model_crc[0], s_boot_model_crc[1],
+                          s_boot_arena_used[0], s_boot_arena_used[1] };
+    for (int w = 0; w < 5; w++) {
+        buf[idx++] = (uint8_t)(words[w] & 0xFF);
+        buf[idx++] = (uint8_t)(words[w] >> 8);
+        buf[idx++] = (uint8_t)(words[w] >> 16);
+        buf[idx++] = (uint8_t)(words[w] >> 24);
+    }
+    buf[idx++] = (uint8_t)n;
+    for (int i = 0; i < n; i++) {
+        const char* tag = boot_stages_tag(i);
+        for (int c = 0; c < 4; c++) {
+            buf[idx++] = (uint8_t)(*tag ? *tag : ' ');
+            if (*tag) tag++;
+        }
+        uint32_t us = boot_stages_us(i);
+        buf[idx++] = (uint8_t)(us & 0xFF);
+        buf[idx++] = (uint8_t)(us >> 8);
+        buf[idx++] = (uint8_t)(us >> 16);
+        buf[idx++] = (uint8_t)(us >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+
+void telemetry_emit_queues(void) {
+    // Variable length: 9-byte header + 14 bytes per queue + CRC.
+    static uint16_t s_queue_seq = 0;
+    uint8_t fb[9 + QSTAT_COUNT * 14 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_QUEUE_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_queue_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_queue_seq >> 8);
+    s_queue_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    buf[idx++] = QSTAT_COUNT;
+    for (int q = 0; q < QSTAT_COUNT; q++) {
+        QueueStatsSnap s;
+        queue_stats_collect(q, &s);
+        const char* tag = queue_stats_name(q);
+        for (int c = 0; c < 4; c++) {
+            buf[idx++] = (uint8_t)(*tag ? *tag : ' ');
+            if (*tag) tag++;
+        }
+        buf[idx++] = s.depth;
+        buf[idx++] = s.max_depth;
+        buf[idx++] = (uint8_t)(s.age_ms & 0xFF);
+        buf[idx++] = (uint8_t)(s.age_ms >> 8);
+        buf[idx++] = (uint8_t)(s.max_age_ms & 0xFF);
+        buf[idx++] = (uint8_t)(s.max_age_ms >> 8);
+        buf[idx++] = (uint8_t)(s.drops & 0xFF);
+        buf[idx++] = (uint8_t)(s.drops >> 8);
+        buf[idx++] = (uint8_t)(s.drops >> 16);
+        buf[idx++] = (uint8_t)(s.drops >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+
+#if QDNN_METRICS
+void telemetry_emit_metrics(void) {
+    // Variable length: 9-byte header + 9 bytes per metric + CRC. Each
+    // value is one volatile read of the owning module's storage.
+    static uint16_t s_metrics_seq = 0;
+    uint8_t fb[TELEMETRY_METRICS_HDR + QDNN_METRICS_MAX * TELEMETRY_METRICS_ENTRY + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_METRICS_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_metrics_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_metrics_seq >> 8);
+    s_metrics_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    int n = metrics_count();
+    buf[idx++] = (uint8_t)n;
+    for (int m = 0; m < n; m++) {
+        const MetricDesc* d = metrics_get(m);
+        buf[idx++] = (uint8_t)(d->hash & 0xFF);
+        buf[idx++] = (uint8_t)(d->hash >> 8);
+        buf[idx++] = (uint8_t)(d->hash >> 16);
+        buf[idx++] = (uint8_t)(d->hash >> 24);
+        buf[idx++] = d->type;
+        uint32_t v = *d->value;
+        buf[idx++] = (uint8_t)(v & 0xFF);
+        buf[idx++] = (uint8_t)(v >> 8);
+        buf[idx++] = (uint8_t)(v >> 16);
+        buf[idx++] = (uint8_t)(v >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+#endif  // QDNN_METRICS
+
+void telemetry_emit_locks(void) {
+    // Variable length: 13-byte header + 20 bytes per lock + CRC.
+    static uint16_t s_lock_seq = 0;
+    uint8_t fb[13 + LOCK_COUNT * 20 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_LOCK_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_lock_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_lock_seq >> 8);
+    s_lock_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    uint32_t inh = lock_stats_inherits();
+    buf[idx++] = (uint8_t)(inh & 0xFF);
+    buf[idx++] = (uint8_t)(inh >> 8);
+    buf[idx++] = (uint8_t)(inh >> 16);
+    buf[idx++] = (uint8_t)(inh >> 24);
+    buf[idx++] = LOCK_COUNT;
+    for (int l = 0; l < LOCK_COUNT; l++) {
+        LockStatsSnap s;
+        lock_stats_collect(l, &s);
+        const char* tag = lock_stats_name(l);
+        for (int c = 0; c < 4; c++) {
+            buf[idx++] = (uint8_t)(*tag ? *tag : ' ');
+            if (*tag) tag++;
+        }
+        buf[idx++] = (uint8_t)(s.acquisitions & 0xFF);
+        buf[idx++] = (uint8_t)(s.acquisitions >> 8);
+        buf[idx++] = (uint8_t)(s.acquisitions >> 16);
+        buf[idx++] = (uint8_t)(s.acquisitions >> 24);
+        buf[idx++] = (uint8_t)(s.contended & 0xFF);
+        buf[idx++] = (uint8_t)(s.contended >> 8);
+        buf[idx++] = (uint8_t)(s.contended >> 16);
+        buf[idx++] = (uint8_t)(s.contended >> 24);
+        buf[idx++] = (uint8_t)(s.max_wait_us & 0xFF);
+        buf[idx++] = (uint8_t)(s.max_wait_us >> 8);
+        buf[idx++] = (uint8_t)(s.max_wait_us >> 16);
+        buf[idx++] = (uint8_t)(s.max_wait_us >> 24);
+        buf[idx++] = (uint8_t)(s.max_hold_us & 0xFF);
+        buf[idx++] = (uint8_t)(s.max_hold_us >> 8);
+        buf[idx++] = (uint8_t)(s.max_hold_us >> 16);
+        buf[idx++] = (uint8_t)(s.max_hold_us >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+
+#if QDNN_TRACE_RING
+void telemetry_emit_trace(void) {
+    // Variable length: 10-byte header + 9 bytes per event + CRC. One
+    // frame per frozen capture; quiet while the ring is armed.
+    TraceEvent ev[TRACE_RING_EVENTS];
+    uint8_t reason;
+    uint32_t frozen_t_us;
+    int n = trace_ring_snapshot(ev, TRACE_RING_EVENTS, &reason, &frozen_t_us);
+    if (n <= 0) return;
+
+    static uint16_t s_trace_seq = 0;
+    uint8_t fb[10 + TRACE_RING_EVENTS * 9 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_TRACE_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_trace_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_trace_seq >> 8);
+    s_trace_seq++;
+    buf[idx++] = (uint8_t)(frozen_t_us & 0xFF);
+    buf[idx++] = (uint8_t)(frozen_t_us >> 8);
+    buf[idx++] = (uint8_t)(frozen_t_us >> 16);
+    buf[idx++] = (uint8_t)(frozen_t_us >> 24);
+    buf[idx++] = reason;
+    buf[idx++] = (uint8_t)n;
+    for (int i = 0; i < n; i++) {
+        buf[idx++] = ev[i].site;
+        buf[idx++] = (uint8_t)(ev[i].t_us & 0xFF);
+        buf[idx++] = (uint8_t)(ev[i].t_us >> 8);
+        buf[idx++] = (uint8_t)(ev[i].t_us >> 16);
+        buf[idx++] = (uint8_t)(ev[i].t_us >> 24);
+        buf[idx++] = (uint8_t)(ev[i].dur_us & 0xFF);
+        buf[idx++] = (uint8_t)(ev[i].dur_us >> 8);
+        buf[idx++] = (uint8_t)(ev[i].dur_us >> 16);
+        buf[idx++] = (uint8_t)(ev[i].dur_us >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+#endif  // QDNN_TRACE_RING
+
+#if QDNN_PUMP_DUTY
+void telemetry_emit_duty(const PumpDutySnap* zones, int n, uint16_t day) {
+    // Variable length: 11-byte header + 20 bytes per zone + CRC. One
+    // frame per 24 h rollover.
+    static uint16_t s_duty_seq = 0;
+    uint8_t fb[11 + BOARD_MAX_ZONES * 20 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_DUTY_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_duty_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_duty_seq >> 8);
+    s_duty_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    buf[idx++] = (uint8_t)(day & 0xFF);
+    buf[idx++] = (uint8_t)(day >> 8);
+    if (n > BOARD_MAX_ZONES) n = BOARD_MAX_ZONES;
+    buf[idx++] = (uint8_t)n;
+    for (int z = 0; z < n; z++) {
+        for (int b = 0; b < 8; b++)
+            buf[idx++] = (uint8_t)(zones[z].on_us >> (8 * b));
+        for (int b = 0; b < 8; b++)
+            buf[idx++] = (uint8_t)(zones[z].level_us >> (8 * b));
+        buf[idx++] = (uint8_t)(zones[z].starts & 0xFF);
+        buf[idx++] = (uint8_t)(zones[z].starts >> 8);
+        buf[idx++] = (uint8_t)(zones[z].starts >> 16);
+        buf[idx++] = (uint8_t)(zones[z].starts >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+#endif  // QDNN_PUMP_DUTY
+
+void telemetry_emit_ident(void) {
+    // Variable length: 9-byte header + 8-byte ID + 4 bytes per
+    // baseline slot + CRC.
+    static uint16_t s_ident_seq = 0;
+    uint8_t fb[9 + DEVICE_ID_LEN + BASE_SLOT_COUNT * 4 + 2];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t idx = 0;
+    buf[idx++] = TELEMETRY_IDENT_SOF;
+    buf[idx++] = 1;
+    buf[idx++] = (uint8_t)(s_ident_seq & 0xFF);
+    buf[idx++] = (uint8_t)(s_ident_seq >> 8);
+    s_ident_seq++;
+    uint32_t t_us = stamp_us();
+    buf[idx++] = (uint8_t)(t_us & 0xFF);
+    buf[idx++] = (uint8_t)(t_us >> 8);
+    buf[idx++] = (uint8_t)(t_us >> 16);
+    buf[idx++] = (uint8_t)(t_us >> 24);
+    buf[idx++] = BASE_SLOT_COUNT;
+    const uint8_t* id = device_id_get();
+    for (int i = 0; i < DEVICE_ID_LEN; i++) buf[idx++] = id[i];
+    for (int s = 0; s < BASE_SLOT_COUNT; s++) {
+        uint32_t us = device_baseline_get(s);
+        buf[idx++] = (uint8_t)(us & 0xFF);
+        buf[idx++] = (uint8_t)(us >> 8);
+        buf[idx++] = (uint8_t)(us >> 16);
+        buf[idx++] = (uint8_t)(us >> 24);
+    }
+    uint16_t crc = telemetry_crc16(buf, idx);
+    buf[idx++] = (uint8_t)(crc & 0xFF);
+    buf[idx++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, idx, fb);
+}
+
+void telemetry_emit_timing(uint8_t site, const TimingHist* hist) {
+    // Fixed 52 bytes, built by hand like the task frame
+    static uint16_t s_timing_seq = 0;
+    uint8_t fb[52];
+    uint8_t* buf = frame_begin(sizeof(fb), fb);
+    size_t n = 0;
+    buf[n++] = TELEMETRY_TIMING_SOF;
+    buf[n++] = 2;
+    buf[n++] = (uint8_t)(s_timing_seq & 0xFF);
+    buf[n++] = (uint8_t)(s_timing_seq >> 8);
+    s_timing_seq++;
+    uint32_t t_us = stamp_us();
+    buf[n++] = (uint8_t)(t_us & 0xFF);
+    buf[n++] = (uint8_t)(t_us >> 8);
+    buf[n++] = (uint8_t)(t_us >> 16);
+    buf[n++] = (uint8_t)(t_us >> 24);
+    buf[n++] = site;
+    buf[n++] = TIMING_HIST_BINS;
+    buf[n++] = (uint8_t)(hist->count & 0xFF);
+    buf[n++] = (uint8_t)(hist->count >> 8);
+    buf[n++] = (uint8_t)(hist->count >> 16);
+    buf[n++] = (uint8_t)(hist->count >> 24);
+    buf[n++] = (uint8_t)(hist->max_us & 0xFF);
+    buf[n++] = (uint8_t)(hist->max_us >> 8);
+    buf[n++] = (uint8_t)(hist->max_us >> 16);
+    buf[n++] = (uint8_t)(hist->max_us >> 24);
+    for (int b = 0; b < TIMING_HIST_BINS; b++) {
+        uint16_t c = sat16(hist->bins[b]);
+        buf[n++] = (uint8_t)(c & 0xFF);
+        buf[n++] = (uint8_t)(c >> 8);
+    }
+    uint16_t crc = telemetry_crc16(buf, n);
+    buf[n++] = (uint8_t)(crc & 0xFF);
+    buf[n++] = (uint8_t)(crc >> 8);
+
+    frame_end(buf, n, fb);
+}
+
+void telemetry_emit_cache(const InferCacheStats* stats) {
+    static uint16_t s_cache_seq = 0;
+    uint8_t fb[sizeof(CacheFrame)];
+    CacheFrame* f = (CacheFrame*)frame_begin(sizeof(CacheFrame), fb);
+    f->sof         = TELEMETRY_CACHE_SOF;
+    f->version     = TELEMETRY_VERSION;
+    f->seq         = s_cache_seq++;
+    f->t_us        = stamp_us();
+    f->fan_hits    = stats->fan_hits;
+    f->fan_misses  = stats->fan_misses;
+    f->pump_hits   = stats->pump_hits;
+    f->pump_misses = stats->pump_misses;
+    f->crc         = telemetry_crc16((const uint8_t*)f, sizeof(*f) - sizeof(f->crc));
+
+    frame_end((const uint8_t*)f, sizeof(*f), fb);
+}
@@ -0,0 +1,516 @@
+/**
+ * @file telemetry.h
+ *
+ * @brief Binary telemetry frame output for the control loop
+ *
+ * Replaces per-cycle printf float formatting with a fixed 23-byte
+ * little-endian frame: no float-to-text conversion on the hot path and
+ * a fraction of the UART/CDC airtime. Values are fixed-point (0.1-unit)
+ * integers and the frame carries a sequence number and CRC-16/CCITT so
+ * the host decoder can detect loss and corruption.
+ *
+ * Every frame carries a timestamp at offset 4: the low 32 bits of
+ * time_us_64(), captured in the producer's emit call (the O(1) ring
+ * deposit), never at drain time. The 32-bit field wraps every ~71.6
+ * minutes; the periodic time-sync frame (SOF 0xAC below) carries the
+ * full 64-bit counter so the host decoder can unwrap unambiguously.
+ * The system timer stays clocked through the QDNN_LOW_POWER sleep
+ * state (see low_power_init()), so the stamps are monotonic across
+ * dormant cycles.
+ *
+ * Frame layout (version 4, packed, little-endian):
+ *   0  uint8  SOF (0xA5)
+ *   1  uint8  version (4)
+ *   2  uint16 sequence number (low 16 bits of the source frame's
+ *             cycle number - a gap means the pipeline skipped cycles)
+ *   4  uint32 timestamp, us (low 32 bits of time_us_64())
+ *   8  int16  temperature, 0.1 C
+ *  10  uint16 humidity, 0.1 %RH
+ *  12  uint16 raw soil ADC count
+ *  14  uint16 soil moisture, 0.1 %
+ *  16  uint8  fan level
+ *  17  uint8  pump level
+ *  18  int8   fan confidence: the winner's raw logit in the model's
+ *             own int8 output quantization (uint8 outputs re-biased by
+ *             128, float fallbacks saturated) - decode with the
+ *             deployed model's output scale/zero point, or compare
+ *             raw values within one model generation
+ *  19  int8   pump confidence (zone 0), same encoding
+ *  20  uint8  staleness flags (TELEMETRY_STALE_*: the value is the
+ *             filtered last-good substitute, not a fresh sample)
+ *  21  uint16 CRC-16/CCITT over bytes 0..20
+ *
+ * A second frame type (SOF 0xA6, 26 bytes) carries the periodic heap
+ * snapshot; the host decoder demuxes on the SOF byte:
+ *   0  uint8  SOF (0xA6)
+ *   1  uint8  version (3)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 free heap bytes
+ *  12  uint32 minimum-ever free bytes
+ *  16  uint32 largest free block bytes
+ *  20  uint16 pool-to-heap fallback count (saturating)
+ *  22  uint16 pool exhaustion count (saturating)
+ *  24  uint16 CRC-16/CCITT over bytes 0..23
+ *
+ * A third frame type (SOF 0xA7, variable length) carries per-task CPU
+ * shares and stack high-water marks from the run-time stats engine:
+ *   0  uint8  SOF (0xA7)
+ *   1  uint8  version (3)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 collection interval, us
+ *  12  uint8  task count N
+ *  13  N x { char name[4]; uint8 task number; uint16 CPU permille;
+ *            uint16 stack high-water mark, words }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A fourth frame type (SOF 0xA8, 26 bytes) carries the inference
+ * result-cache counters (cumulative since boot):
+ *   0  uint8  SOF (0xA8)
+ *   1  uint8  version (3)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 fan cache hits
+ *  12  uint32 fan cache misses
+ *  16  uint32 pump cache hits
+ *  20  uint32 pump cache misses
+ *  24  uint16 CRC-16/CCITT over bytes 0..23
+ *
+ * A fifth frame type (SOF 0xA9, 52 bytes) carries one hot-path timing
+ * histogram (QDNN_CYCLE_TIMING builds, emitted on demand by the
+ * shell's "timing" command, one frame per site):
+ *   0  uint8  SOF (0xA9)
+ *   1  uint8  version (2)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint8  site id (TimingSite)
+ *   9  uint8  bin count (16)
+ *  10  uint32 sample count
+ *  14  uint32 maximum, us
+ *  18  16 x uint16 bin counts, saturating (bin k covers
+ *             [2^(k-1), 2^k) us)
+ *  50  uint16 CRC-16/CCITT over bytes 0..49
+ *
+ * A sixth frame type (SOF 0xAA, 22 bytes) carries the idle/power duty
+ * cycle over the collection interval:
+ *   0  uint8  SOF (0xAA)
+ *   1  uint8  version (2)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 collection interval, us
+ *  12  uint32 idle (slept) time within the interval, us
+ *  16  uint16 idle permille
+ *  18  uint16 sleep entries / WFI wakes (saturating)
+ *  20  uint16 CRC-16/CCITT over bytes 0..19
+ *
+ * A seventh frame type (SOF 0xAB, 14 bytes) carries one second-stage
+ * anomaly score (QDNN_ANOMALY_MODEL builds, one per scored window):
+ *   0  uint8  SOF (0xAB)
+ *   1  uint8  version (2)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint16 reconstruction error, mean abs LSB x 256
+ *  10  uint16 threshold the firmware warns at, same units
+ *  12  uint16 CRC-16/CCITT over bytes 0..11
+ *
+ * An eighth frame type (SOF 0xAC, 19 bytes) is the time-sync record:
+ * the full monotonic counter plus the wall-clock correlation ("time
+ * <epoch>" in the shell sets it). Emitted with the periodic snapshot
+ * frames, it lets the host unwrap the 32-bit stamps and place a whole
+ * fleet's frames on one real-time axis:
+ *   0  uint8  SOF (0xAC)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint64 timestamp, us (full time_us_64())
+ *  12  uint32 wall clock, Unix epoch seconds (0 until set)
+ *  16  uint8  wall clock valid flag
+ *  17  uint16 CRC-16/CCITT over bytes 0..16
+ *
+ * A ninth frame type (SOF 0xAD, variable length) is the error-counter
+ * summary: the whole err_stats table, cumulative since boot, emitted
+ * with the periodic snapshot batch. Slot order follows the ErrSite
+ * enum (err_stats.h):
+ *   0  uint8  SOF (0xAD)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint8  counter count N
+ *   9  N x uint32 cumulative error count
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A tenth frame type (SOF 0xAE, variable length) is the boot report:
+ * the staged-init timing table (boot_stages.h), emitted exactly once
+ * per boot after the first control decision. Each entry is a 4-char
+ * stage tag (space padded) plus its completion time since reset, so
+ * the host can draw the bring-up waterfall - overlapping stages (CRC
+ * sweep on the DMA sniffer, core 1's model setup) included - and
+ * track cold-boot-to-first-decision across firmware versions. Version
+ * 2 added the retained-RAM boot counter and warm flag (warm_state.h)
+ * so the host can split bring-up timings by start type. Version 3
+ * makes the frame a full boot report - reset cause, build identity,
+ * model CRCs and arena occupancy - so every capture opens with a
+ * parseable record of exactly what is running and why it restarted,
+ * instead of the host skipping the human banner heuristically:
+ *   0  uint8  SOF (0xAE)
+ *   1  uint8  version (3)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 boot count (restarts from 1 on a cold start)
+ *  12  uint8  warm flag (1 = retained state survived the reset)
+ *  13  uint8  reset cause (0 unknown, 1 power-on, 2 RUN pin,
+ *             3 debugger/PSM, 4 watchdog timeout, 5 soft reboot)
+ *  14  uint32 build id (short git hash of the building tree, or 0)
+ *  18  uint32 fan model CRC-32       (0 = not measured this build)
+ *  22  uint32 pump model CRC-32      (0 = not measured this build)
+ *  26  uint32 fan arena bytes used   (0 = not reported this build)
+ *  30  uint32 pump arena bytes used  (0 = not reported this build)
+ *  34  uint8  stage count N
+ *  35  N x { char[4] tag, uint32 completion us since reset }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * An eleventh frame type (SOF 0xAF, variable length) is the pipeline
+ * queue watermark report (queue_stats.h), emitted with the periodic
+ * snapshot batch. Depth and age watermarks per inter-stage queue make
+ * a slow consumer visible long before stale frames reach actuation:
+ *   0  uint8  SOF (0xAF)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint8  queue count N
+ *   9  N x { char[4] tag, uint8 depth, uint8 max depth,
+ *            uint16 last consumed age ms, uint16 max age ms,
+ *            uint32 drops }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A twelfth frame type (SOF 0xB0, variable length) is the unit
+ * identity and boot baseline (device_id.h), emitted once after the
+ * first control decision and again with every snapshot batch so any
+ * captured log segment can be attributed to its unit. The baseline
+ * slots (BaselineSlot order; 0 = not yet measured) are this unit's own
+ * boot-time reference, for per-unit degradation tracking on the host:
+ *   0  uint8  SOF (0xB0)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint8  baseline slot count N
+ *   9  8-byte unique flash/board ID
+ *   17 N x uint32 baseline, us
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A thirteenth frame type (SOF 0xB1, variable length) is the lock
+ * contention report (lock_stats.h), emitted with the periodic
+ * snapshot batch. When cycle-time percentiles drift, the per-lock
+ * contention counts and worst-case wait/hold times attribute it to a
+ * specific lock; the inheritance count is the kernel's own tally of
+ * priority inversions that actually engaged:
+ *   0  uint8  SOF (0xB1)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint32 priority-inheritance engagements
+ *  12  uint8  lock count N
+ *  13  N x { char[4] tag, uint32 acquisitions, uint32 contended,
+ *            uint32 max wait us, uint32 max hold us }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A fourteenth frame type (SOF 0xB2, variable length, QDNN_TELEM_DELTA
+ * builds) appears only on the datalog/uplink tees, never on the
+ * console: the sample frame (0xA5) delta-encoded against the previous
+ * committed sample. The sequence number is implicit (+1 per delta);
+ * a raw 0xA5 keyframe recurs every QDNN_TELEM_DELTA_KEYFRAME samples
+ * so a decoder joining mid-stream locks on within one key interval.
+ * Deltas are zigzag varints (LEB128, zigzag = (v << 1) ^ (v >> 31)):
+ *   0  uint8  SOF (0xB2)
+ *   1  uint8  change bitmap: 0x01 temp10, 0x02 humid10, 0x04 soil raw,
+ *             0x08 soil10, 0x10 fan level, 0x20 pump level, 0x40 flags,
+ *             0x80 timestamp cadence change
+ *   2  uint8  change bitmap 2 (sample v4): 0x01 fan confidence,
+ *             0x02 pump confidence
+ *   3  varint zigzag second-order t_us delta, if bit 0x80
+ *   ...varint zigzag field delta per set bit, bitmap 1 fields
+ *      ascending then bitmap 2 fields ascending
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A fifteenth frame type (SOF 0xB3, variable length, QDNN_TRACE_RING
+ * builds) is the flight-recorder dump: the scoped-timer event ring
+ * captured at the moment a slow-cycle trigger froze it (cycle_timing.h).
+ * Emitted by the report task in the cycle after the trigger, then the
+ * ring re-arms. Event stamps are raw 32-bit microseconds; the host
+ * unwraps them against the frame timestamp:
+ *   0  uint8  SOF (0xB3)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 freeze timestamp, us
+ *   8  uint8  freeze reason (TraceFreezeReason)
+ *   9  uint8  event count N, oldest first
+ *  10  N x { uint8 site, uint32 exit stamp us, uint32 duration us }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A sixteenth frame type (SOF 0xB4, variable length, QDNN_PUMP_DUTY
+ * builds) is the daily pump duty record: per-zone run-time totals for
+ * one 24 h uptime window, emitted once at rollover. The datalog tee
+ * makes this the persistent metering history; day boundaries are
+ * uptime-relative (see pump_duty.h):
+ *   0  uint8  SOF (0xB4)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint16 day index since boot
+ *  10  uint8  zone count N
+ *  11  N x { uint64 on-time us, uint64 level-weighted us,
+ *            uint32 pump starts }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * A seventeenth frame type (SOF 0xB5, 18 bytes, QDNN_ENERGY_GOV
+ * builds) carries the energy budget governor's verdict alongside the
+ * periodic snapshots: the supply reading it acted on, the budget state
+ * and which derates are in effect, plus a coefficient-model estimate
+ * of the electronics draw over the collection interval (actuator draw
+ * is metered separately by the 0xB4 duty record):
+ *   0  uint8  SOF (0xB5)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint16 averaged VSYS, mV
+ *  10  uint8  budget state (0 ok, 1 saver, 2 critical)
+ *  11  uint8  derates in effect (TELEMETRY_ENERGY_* bits)
+ *  12  uint16 committed state transitions since boot (saturating)
+ *  14  uint16 estimated electronics draw, mW
+ *  16  uint16 CRC-16/CCITT over bytes 0..15
+ *
+ * An eighteenth frame type (SOF 0xB6, variable length, QDNN_METRICS
+ * builds) is the metrics registry walk: every registered counter,
+ * gauge and watermark in one frame on the stats cadence. Metrics are
+ * keyed by the FNV-1a hash of their registered name (the shell's
+ * "metrics" dump is the hash-to-name dictionary):
+ *   0  uint8  SOF (0xB6)
+ *   1  uint8  version (1)
+ *   2  uint16 sequence number
+ *   4  uint32 timestamp, us
+ *   8  uint8  metric count N
+ *   9  N x { uint32 name hash, uint8 type (MetricType),
+ *            uint32 value }
+ *   ...uint16 CRC-16/CCITT over all preceding bytes
+ *
+ * The SOF bytes, packed fixed-frame structs, CRC and varint primitives
+ * live in telemetry_wire.h, which the host decoder
+ * (sim/telemetry_decode.cpp) compiles verbatim - change a layout there
+ * and both ends move together or fail to build.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "pico/stdlib.h"
+
+#include "cycle_timing.h"
+#include "heap_stats.h"
+#include "idle_meter.h"
+#include "task_stats.h"
+#include "telemetry_wire.h"
+
+/**
+ * @brief One control-cycle sample to be emitted.
+ */
+struct TelemetrySample {
+    float temp;
+    float humid;
+    float soil_pct;
+    uint16_t soil_raw;
+    uint8_t fan_level;
+    uint8_t pump_level;
+    int8_t fan_conf;     ///< winner's raw logit, model's own int8 scale
+    int8_t pump_conf;    ///< same, pump head, zone 0
+    uint8_t stale_mask;  ///< TELEMETRY_STALE_* bits
+    uint32_t cycle_seq;  ///< source frame's cycle number (stamped at acquisition)
+};
+
+/**
+ * @brief Pack and write one binary frame to stdio.
+ */
+void telemetry_emit(const TelemetrySample* sample);
+
+/**
+ * @brief Pack and write one heap snapshot frame to stdio.
+ */
+void telemetry_emit_heap(const HeapStats* stats);
+
+/**
+ * @brief Pack and write one per-task CPU share frame to stdio.
+ */
+void telemetry_emit_tasks(const TaskStatsReport* report);
+
+/**
+ * @brief Inference result-cache counters, cumulative since boot.
+ */
+struct InferCacheStats {
+    uint32_t fan_hits;
+    uint32_t fan_misses;
+    uint32_t pump_hits;
+    uint32_t pump_misses;
+};
+
+/**
+ * @brief Pack and write one cache-counter frame to stdio.
+ */
+void telemetry_emit_cache(const InferCacheStats* stats);
+
+/**
+ * @brief Pack and write one timing-histogram frame to stdio.
+ */
+void telemetry_emit_timing(uint8_t site, const TimingHist* hist);
+
+/**
+ * @brief Pack and write one idle/power duty-cycle frame to stdio.
+ */
+void telemetry_emit_power(const IdleMeterReport* report);
+
+/**
+ * @brief Energy budget governor verdict for one collection interval.
+ */
+struct EnergyReport {
+    uint16_t vsys_mv;     ///< averaged supply reading acted on
+    uint8_t state;        ///< EnergyState in effect
+    uint8_t actions;      ///< TELEMETRY_ENERGY_* derate bits
+    uint16_t transitions; ///< committed state changes since boot
+    uint16_t est_mw;      ///< coefficient-model electronics draw
+};
+
+/**
+ * @brief Pack and write one energy budget frame to stdio.
+ */
+void telemetry_emit_energy(const EnergyReport* report);
+
+/**
+ * @brief Pack and ship one decision replay record (0xB7).
+ *
+ * Caller fills every payload field; sof, version and CRC are stamped
+ * here. The datalog tee gives the flash region its sliding window of
+ * replayable decisions (see qdnn_sim --replay).
+ */
+void telemetry_emit_replay(ReplayRecord* rec);
+
+/**
+ * @brief Pack and write one anomaly-score frame to stdio.
+ */
+void telemetry_emit_anomaly(uint16_t score_q8, uint16_t threshold_q8);
+
+/**
+ * @brief Record the wall-clock correlation point.
+ *
+ * Pairs the given Unix time with time_us_64() at the moment of the
+ * call; subsequent time-sync frames extrapolate from that pair, so one
+ * host-issued "time" command per boot is enough.
+ *
+ * @param epoch_s Unix epoch seconds, as the host knows them.
+ */
+void telemetry_set_wallclock(uint32_t epoch_s);
+
+/**
+ * @brief Current wall-clock time extrapolated from the correlation
+ * point, or 0 while no "time" command has been issued this boot.
+ */
+uint32_t telemetry_wallclock_s(void);
+
+/**
+ * @brief Pack and write one time-sync frame to stdio.
+ */
+void telemetry_emit_timesync(void);
+
+/**
+ * @brief Pack and write one error-counter summary frame to stdio.
+ *
+ * @param counts Counter table, ErrSite slot order.
+ * @param n      Number of entries (ERR_SITE_COUNT).
+ */
+void telemetry_emit_errors(const uint32_t* counts, uint8_t n);
+
+/**
+ * @brief Pack and write the one-shot boot report frame to stdio.
+ *
+ * Reads the boot_stages table directly; call once after the first
+ * control decision, when every init stage has marked in.
+ */
+void telemetry_emit_boot(void);
+
+/**
+ * @brief Record the decoded reset cause for the boot report.
+ *
+ * Call early in main(), before the reset registers get overwritten by
+ * a later soft reboot. Cause codes are documented with the 0xAE frame
+ * layout above.
+ */
+void telemetry_boot_note_reset(uint8_t cause);
+
+/**
+ * @brief Record one model's identity for the boot report.
+ *
+ * Each inference setup path reports its own model once the interpreter
+ * has allocated: the CRC the boot sweep measured and the arena bytes
+ * the planner actually used. Unreported slots stay 0 on the wire.
+ *
+ * @param which      0 = fan, 1 = pump.
+ * @param crc32      Measured model CRC-32 (zlib convention).
+ * @param arena_used Planner-allocated arena bytes.
+ */
+void telemetry_boot_note_model(int which, uint32_t crc32,
+                               uint32_t arena_used);
+
+/**
+ * @brief Pack and write one queue watermark frame to stdio.
+ *
+ * Reads the queue_stats table directly; emit with the periodic
+ * snapshot batch.
+ */
+void telemetry_emit_queues(void);
+
+/**
+ * @brief Pack and write one lock contention frame to stdio.
+ *
+ * Reads the lock_stats table directly; emit with the periodic
+ * snapshot batch.
+ */
+void telemetry_emit_locks(void);
+
+#if QDNN_TRACE_RING
+/**
+ * @brief Dump a frozen flight-recorder capture as one frame, if any.
+ *
+ * No-op while the trace ring is armed; draining the capture re-arms
+ * it. Called by the report task every cycle so a trigger's trace ships
+ * within one cycle of firing.
+ */
+void telemetry_emit_trace(void);
+#endif
+
+#if QDNN_PUMP_DUTY
+struct PumpDutySnap;
+
+/**
+ * @brief Pack and write one daily pump-duty frame to stdio.
+ *
+ * Called by the report task when pump_duty_day_close() closes a day;
+ * the datalog tee persists it as the on-flash metering record.
+ */
+void telemetry_emit_duty(const PumpDutySnap* zones, int n, uint16_t day);
+#endif
+
+#if QDNN_METRICS
+/**
+ * @brief Pack and write one metrics-registry frame to stdio.
+ *
+ * Walks the registry directly; emit with the periodic snapshot batch.
+ */
+void telemetry_emit_metrics(void);
+#endif
+
+/**
+ * @brief Pack and write one identity + boot baseline frame to stdio.
+ *
+ * Reads device_id directly; emit once after the first decision and
+ * with every snapshot batch.
+ */
+void telemetry_emit_ident(void);
+
+#endif
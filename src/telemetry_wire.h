@@ -0,0 +1,302 @@
+/**
+ * @file telemetry_wire.h
+ *
+ * @brief Telemetry wire format: the one header both ends compile
+ *
+ * Everything a consumer needs to parse the binary stream - SOF bytes,
+ * versions, the packed fixed-frame structs, the CRC and the delta
+ * codec primitives - lives here, with no SDK includes, so the host
+ * decoder (sim/telemetry_decode.cpp) and the firmware packers
+ * (telemetry.cpp) compile the same definitions. A layout change that
+ * touches only one side now fails the other side's build or its
+ * static_asserts instead of shipping a silent drift.
+ *
+ * The variable-length frames (0xA7, 0xAD..0xB1, 0xB3, 0xB4) are
+ * packed field-by-field on the firmware side; their layouts are
+ * documented frame-by-frame in telemetry.h and their header/stride
+ * constants are defined below so the decoder derives lengths from the
+ * same numbers the packers count with.
+ */
+
+#ifndef TELEMETRY_WIRE_H
+#define TELEMETRY_WIRE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Start-of-frame bytes, one per frame type (telemetry.h)
+#define TELEMETRY_SOF        0xA5
+#define TELEMETRY_HEAP_SOF   0xA6
+#define TELEMETRY_TASKS_SOF  0xA7
+#define TELEMETRY_CACHE_SOF  0xA8
+#define TELEMETRY_TIMING_SOF 0xA9
+#define TELEMETRY_POWER_SOF  0xAA
+#define TELEMETRY_ANOM_SOF   0xAB
+#define TELEMETRY_TIME_SOF   0xAC
+#define TELEMETRY_ERR_SOF    0xAD
+#define TELEMETRY_BOOT_SOF   0xAE
+#define TELEMETRY_QUEUE_SOF  0xAF
+#define TELEMETRY_IDENT_SOF  0xB0
+#define TELEMETRY_LOCK_SOF   0xB1
+#define TELEMETRY_DELTA_SOF  0xB2
+#define TELEMETRY_TRACE_SOF  0xB3
+#define TELEMETRY_DUTY_SOF   0xB4
+#define TELEMETRY_ENERGY_SOF  0xB5
+#define TELEMETRY_METRICS_SOF 0xB6
+#define TELEMETRY_REPLAY_SOF  0xB7
+#define TELEMETRY_BEACON_SOF  0xB8
+
+#define TELEMETRY_VERSION 4
+
+// Staleness flag bits (sample frame flags byte, SensorFrame::stale_mask)
+#define TELEMETRY_STALE_TEMP  0x01
+#define TELEMETRY_STALE_HUMID 0x02
+#define TELEMETRY_STALE_SOIL  0x04
+
+// Delta frame (0xB2) change bitmaps
+#define TELEMETRY_DELTA_TEMP   0x01
+#define TELEMETRY_DELTA_HUMID  0x02
+#define TELEMETRY_DELTA_RAW    0x04
+#define TELEMETRY_DELTA_SOIL   0x08
+#define TELEMETRY_DELTA_FAN    0x10
+#define TELEMETRY_DELTA_PUMP   0x20
+#define TELEMETRY_DELTA_FLAGS  0x40
+#define TELEMETRY_DELTA_TIME   0x80
+#define TELEMETRY_DELTA2_FCONF 0x01
+#define TELEMETRY_DELTA2_PCONF 0x02
+
+// --- Fixed-length frames: shared packed structs ---
+
+struct __attribute__((packed)) TelemetryFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    int16_t  temp10;
+    uint16_t humid10;
+    uint16_t soil_raw;
+    uint16_t soil10;
+    uint8_t  fan_level;
+    uint8_t  pump_level;
+    int8_t   fan_conf;
+    int8_t   pump_conf;
+    uint8_t  flags;
+    uint16_t crc;
+};
+
+static_assert(sizeof(TelemetryFrame) == 23, "frame layout drifted");
+
+struct __attribute__((packed)) HeapFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    uint32_t free_bytes;
+    uint32_t min_ever_free;
+    uint32_t largest_block;
+    uint16_t pool_heap_allocs;
+    uint16_t pool_exhausted;
+    uint16_t crc;
+};
+
+static_assert(sizeof(HeapFrame) == 26, "frame layout drifted");
+
+struct __attribute__((packed)) CacheFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    uint32_t fan_hits;
+    uint32_t fan_misses;
+    uint32_t pump_hits;
+    uint32_t pump_misses;
+    uint16_t crc;
+};
+
+static_assert(sizeof(CacheFrame) == 26, "frame layout drifted");
+
+struct __attribute__((packed)) PowerFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    uint32_t interval_us;
+    uint32_t idle_us;
+    uint16_t idle_permille;
+    uint16_t wakes;
+    uint16_t crc;
+};
+
+static_assert(sizeof(PowerFrame) == 22, "frame layout drifted");
+
+struct __attribute__((packed)) AnomFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    uint16_t score_q8;
+    uint16_t threshold_q8;
+    uint16_t crc;
+};
+
+static_assert(sizeof(AnomFrame) == 14, "frame layout drifted");
+
+struct __attribute__((packed)) TimeSyncFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint64_t t_us;
+    uint32_t wall_s;
+    uint8_t  wall_valid;
+    uint16_t crc;
+};
+
+static_assert(sizeof(TimeSyncFrame) == 19, "frame layout drifted");
+
+struct __attribute__((packed)) EnergyFrame {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint32_t t_us;
+    uint16_t vsys_mv;
+    uint8_t  state;        ///< EnergyState
+    uint8_t  actions;      ///< TELEMETRY_ENERGY_* derates in effect
+    uint16_t transitions;  ///< committed state changes since boot
+    uint16_t est_mw;       ///< estimated electronics draw, mW
+    uint16_t crc;
+};
+
+static_assert(sizeof(EnergyFrame) == 18, "frame layout drifted");
+
+// Energy frame (0xB5) action bits
+#define TELEMETRY_ENERGY_NO_BOOST   0x01
+#define TELEMETRY_ENERGY_CADENCE    0x02
+#define TELEMETRY_ENERGY_UPLINK     0x04
+
+// Replay record (0xB7): the complete input frame behind one decision,
+// captured at the actuation commit so both the model's proposal and
+// what the dwell/confidence plumbing actually sent to the hardware are
+// on record. Tees into the datalog ring like every frame, so the flash
+// region holds a sliding window of decisions a dumped capture replays
+// bit-exactly through the host-side pipeline (qdnn_sim --replay).
+#define TELEMETRY_REPLAY_ZONES 3
+
+struct __attribute__((packed)) ReplayRecord {
+    uint8_t  sof;
+    uint8_t  version;
+    uint32_t cycle_seq;     ///< acquisition-stamped global cycle number
+    uint32_t t_ms;          ///< frame acquisition time
+    int16_t  temp10;
+    int16_t  humid10;
+    uint16_t soil_raw[TELEMETRY_REPLAY_ZONES];
+    int16_t  soil_pct10[TELEMETRY_REPLAY_ZONES];
+    int16_t  soil_slope10[TELEMETRY_REPLAY_ZONES];
+    int16_t  hour10;
+    uint8_t  stale_mask;    ///< TELEMETRY_STALE_* substitutions in effect
+    uint8_t  missed;        ///< deadlines this decision stood in for
+    uint16_t fan_bank_seq;  ///< active model bank sequence, 0 = compiled-in
+    uint16_t pump_bank_seq;
+    int8_t   fan_model;     ///< model-proposed levels (pre-dwell)
+    int8_t   pump_model[TELEMETRY_REPLAY_ZONES];
+    uint8_t  fan_commit;    ///< what actually reached the hardware
+    uint8_t  pump_commit[TELEMETRY_REPLAY_ZONES];
+    int8_t   fan_conf;
+    int8_t   fan_margin;
+    uint16_t crc;
+};
+
+static_assert(sizeof(ReplayRecord) == 52, "frame layout drifted");
+
+// Bus beacon (0xB8): the shared-bus time reference, sent by the sync
+// master on the RS-485 link (bus_sync.h) rather than the telemetry
+// stream - it lives here because it uses the same framing and CRC, and
+// a bus capture then decodes with the same tooling. t_us is the
+// master's monotonic clock sampled just before the first byte leaves.
+struct __attribute__((packed)) BusBeacon {
+    uint8_t  sof;
+    uint8_t  version;
+    uint16_t seq;
+    uint64_t t_us;        ///< master clock at transmit start
+    uint8_t  units;       ///< stagger slots on this bus
+    uint16_t window_ms;   ///< shared stagger window length
+    uint16_t crc;
+};
+
+static_assert(sizeof(BusBeacon) == 17, "frame layout drifted");
+
+// --- Variable-length frames: header bytes + per-entry stride ---
+// length = header + count * stride + 2 (CRC); the count byte's offset
+// is the last header byte unless noted.
+
+#define TELEMETRY_TASKS_HDR   13  // count at offset 12
+#define TELEMETRY_TASKS_ENTRY 9
+#define TELEMETRY_TIMING_LEN  52  // fixed, hand-packed (16 bins)
+#define TELEMETRY_ERR_HDR     9
+#define TELEMETRY_ERR_ENTRY   4
+#define TELEMETRY_BOOT_HDR    35  // v3: count at offset 34
+#define TELEMETRY_BOOT_ENTRY  8
+#define TELEMETRY_QUEUE_HDR   9
+#define TELEMETRY_QUEUE_ENTRY 14
+#define TELEMETRY_IDENT_HDR   9   // count byte, then the 8-byte ID
+#define TELEMETRY_IDENT_ID    8
+#define TELEMETRY_IDENT_ENTRY 4
+#define TELEMETRY_LOCK_HDR    13  // count at offset 12
+#define TELEMETRY_LOCK_ENTRY  20
+#define TELEMETRY_TRACE_HDR   10  // count at offset 9
+#define TELEMETRY_TRACE_ENTRY 9
+#define TELEMETRY_DUTY_HDR    11  // count at offset 10
+#define TELEMETRY_DUTY_ENTRY  20
+#define TELEMETRY_METRICS_HDR   9
+#define TELEMETRY_METRICS_ENTRY 9
+
+// --- Shared primitives ---
+
+/** @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF). */
+static inline uint16_t telemetry_crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021)
+                                 : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+/** @brief Zigzag fold for the delta codec's signed deltas. */
+static inline uint32_t telemetry_zigzag32(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t telemetry_unzigzag32(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+/** @brief LEB128 varint append; returns bytes written (max 5). */
+static inline size_t telemetry_put_varint(uint8_t* out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/**
+ * @brief LEB128 varint read; returns bytes consumed, 0 on truncation.
+ */
+static inline size_t telemetry_get_varint(const uint8_t* in, size_t avail,
+                                          uint32_t* out) {
+    uint32_t v = 0;
+    for (size_t n = 0; n < avail && n < 5; n++) {
+        v |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+        if (!(in[n] & 0x80)) {
+            *out = v;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file touch_btn.cpp
+ *
+ * @brief Diagnostics button implementation
+ *
+ * The state machine does all the timing (touch_btn.pio); this side is
+ * one claim-and-load at boot and an interrupt handler that drains the
+ * verdict word into a single volatile slot. No queue: presses are
+ * human-rate and the shell polls every drain pass, so the latest
+ * verdict standing in for a missed one is fine.
+ */
+
+#include "touch_btn.h"
+
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+
+#include "app_log.h"
+#include "resource_map.h"
+#include "touch_btn.pio.h"
+
+// Slow SM clock: instruction counts become times. 10 kHz puts the
+// 2*DEBOUNCE-cycle make/break windows at ~6 ms - beyond any switch in
+// the parts bin - while keeping the clkdiv well inside its 16-bit
+// integer range at every supported clk_sys.
+#define TOUCH_BTN_HZ 10000
+
+static PIO s_pio;
+static int s_sm = -1;
+static volatile uint32_t s_event;  // TouchEvent; handler writes, poll clears
+
+static void touch_irq(void) {
+    pio_interrupt_clear(s_pio, 0);
+    while (!pio_sm_is_rx_fifo_empty(s_pio, (uint)s_sm)) {
+        uint32_t verdict = pio_sm_get(s_pio, (uint)s_sm);
+        s_event = verdict ? TOUCH_EV_LONG : TOUCH_EV_SHORT;
+    }
+}
+
+void touch_btn_init(void) {
+    int sm = res_claim_pio_sm("touch", &s_pio);
+    if (sm < 0) {
+        LogWarn(("touch: no free state machine, button disabled"));
+        return;
+    }
+
+    uint offset = pio_add_program(s_pio, &touch_btn_program);
+    touch_btn_program_init(s_pio, (uint)sm, offset, QDNN_TOUCH_GPIO,
+                           TOUCH_BTN_HZ);
+
+    // Long-press threshold in hold-loop iterations (2 SM cycles each);
+    // the program's leading pull parks it in the OSR before the SM
+    // ever looks at the pin.
+    pio_sm_put(s_pio, (uint)sm,
+               (uint32_t)QDNN_TOUCH_LONG_MS * (TOUCH_BTN_HZ / 1000) / 2);
+
+    s_sm = sm;
+    uint irq_n = (s_pio == pio0) ? PIO0_IRQ_0 : PIO1_IRQ_0;
+    pio_set_irq0_source_enabled(s_pio, pis_interrupt0, true);
+    irq_set_exclusive_handler(irq_n, touch_irq);
+    irq_set_enabled(irq_n, true);
+
+    pio_sm_set_enabled(s_pio, (uint)sm, true);
+    LogInfo(("touch: button on GPIO %d, long press %u ms",
+             QDNN_TOUCH_GPIO, (unsigned)QDNN_TOUCH_LONG_MS));
+}
+
+int touch_btn_take_event(void) {
+    if (s_sm < 0 || s_event == TOUCH_EV_NONE) return TOUCH_EV_NONE;
+    uint32_t ev = s_event;
+    s_event = TOUCH_EV_NONE;
+    return (int)ev;
+}
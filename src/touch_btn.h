@@ -0,0 +1,66 @@
+/**
+ * @file touch_btn.h
+ *
+ * @brief Diagnostics button on a PIO state machine, zero control-loop cost
+ *
+ * Field techs need the diagnostics dumps without a laptop on the CDC
+ * port, and the obvious implementations both tax the control path:
+ * polling a GPIO from a task adds a per-loop check that is almost
+ * always false, and a raw GPIO interrupt needs software debouncing -
+ * a timer per bounce burst preempting whatever the control core was
+ * doing. This module moves the whole interaction into a PIO state
+ * machine (touch_btn.pio): debounce and the short/long-press decision
+ * run at a few kHz in the SM, and the CPU hears exactly one interrupt
+ * per completed press, carrying the finished verdict in the RX FIFO.
+ *
+ * The handler does nothing but latch the event; the command shell's
+ * drain-task poll consumes it and runs the mapped dump from the
+ * context that owns stdio - a short press answers like typing
+ * "selftest", a long press (>= QDNN_TOUCH_LONG_MS) like "stats". The
+ * PIO interrupt is registered in the steering map (irq_map.cpp) at the
+ * bottom priority tier with the USB housekeeping: a human thumb is
+ * never latency-critical.
+ *
+ * Enabled with QDNN_TOUCH_BTN; the button pulls QDNN_TOUCH_GPIO to
+ * ground (the SM enables the internal pull-up).
+ */
+
+#ifndef TOUCH_BTN_H
+#define TOUCH_BTN_H
+
+#include "pico/stdlib.h"
+
+/** @brief Button GPIO, active low; override from the build per board. */
+#ifndef QDNN_TOUCH_GPIO
+#define QDNN_TOUCH_GPIO 22
+#endif
+
+/** @brief Hold time classified as a long press. */
+#ifndef QDNN_TOUCH_LONG_MS
+#define QDNN_TOUCH_LONG_MS 1500
+#endif
+
+/** @brief Completed-press verdicts, as the shell poll consumes them. */
+enum TouchEvent {
+    TOUCH_EV_NONE = 0,  ///< nothing pending
+    TOUCH_EV_SHORT,     ///< released before the long-press threshold
+    TOUCH_EV_LONG,      ///< held through it
+};
+
+/**
+ * @brief Claim a state machine, load the program and hook the PIO IRQ.
+ *
+ * Call once at boot. Same crowded-PIO policy as the status strip: a
+ * failed claim logs and leaves the module inert.
+ */
+void touch_btn_init(void);
+
+/**
+ * @brief Consume the pending event, if any. Shell/drain task.
+ *
+ * Presses landing faster than the poll coalesce: the latest verdict
+ * wins, which is what a tech mashing the button expects.
+ */
+int touch_btn_take_event(void);
+
+#endif
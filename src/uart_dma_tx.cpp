@@ -0,0 +1,37 @@
+/**
+ * @file uart_dma_tx.cpp
+ *
+ * @brief UART0 DMA transmit implementation
+ */
+
+#include "uart_dma_tx.h"
+
+#include "hardware/dma.h"
+#include "hardware/uart.h"
+
+#include "resource_map.h"
+
+static int s_chan = -1;
+
+void uart_dma_tx_init(void) {
+    s_chan = res_claim_dma("uart_tx", true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(s_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, uart_get_dreq(uart0, true));
+    dma_channel_set_config(s_chan, &cfg, false);
+    dma_channel_set_write_addr(s_chan, &uart_get_hw(uart0)->dr, false);
+}
+
+bool uart_dma_tx_busy(void) {
+    return s_chan >= 0 && dma_channel_is_busy(s_chan);
+}
+
+bool uart_dma_tx_start(const uint8_t* data, size_t len) {
+    if (s_chan < 0 || dma_channel_is_busy(s_chan)) return false;
+    dma_channel_set_read_addr(s_chan, data, false);
+    dma_channel_set_trans_count(s_chan, len, true);
+    return true;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file uart_dma_tx.h
+ *
+ * @brief DMA transmit path for UART telemetry
+ *
+ * Streams telemetry buffers out of UART0 with a dedicated DMA channel
+ * paced by the UART TX DREQ, so the drain task hands off a whole chunk
+ * and is free while the bytes shift out at line rate. Used by the
+ * QDNN_UART_DMA_TELEMETRY build in place of byte-at-a-time stdio.
+ */
+
+#ifndef UART_DMA_TX_H
+#define UART_DMA_TX_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Claim and configure the TX DMA channel for UART0. Call once.
+ */
+void uart_dma_tx_init(void);
+
+/**
+ * @brief True while a previous transfer is still streaming out.
+ */
+bool uart_dma_tx_busy(void);
+
+/**
+ * @brief Start a transfer. Non-blocking; the buffer must stay valid
+ * until uart_dma_tx_busy() reports false.
+ *
+ * @return false if a transfer is already in flight.
+ */
+bool uart_dma_tx_start(const uint8_t* data, size_t len);
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * @file usb_gate.h
+ *
+ * @brief On-demand USB CDC bring-up gated on VBUS presence
+ *
+ * Most field units never see a host, yet the TinyUSB device stack they
+ * carry runs its IRQ machinery forever - idle cycles spent and a
+ * recurring jitter source in the interrupt-latency budget. With
+ * QDNN_USB_ON_DEMAND the CDC driver is simply not initialized until
+ * VBUS is actually observed: headless units never start the stack at
+ * all, and plugging a cable in arms it within one housekeeping pass of
+ * the drain task. UART stdio is up from boot either way, so telemetry
+ * and the shell never depend on the gate.
+ *
+ * The gate is one-way: once armed the stack stays up (the SDK exposes
+ * no safe stdio_usb teardown), which is the right trade - an armed
+ * idle stack is cheap, and the 95% case this exists for is the unit
+ * that never arms.
+ */
+
+#ifndef USB_GATE_H
+#define USB_GATE_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Sample VBUS once and arm USB CDC immediately if present.
+ *
+ * Call where stdio_init_all() used to run, after stdio_uart_init().
+ */
+void usb_gate_init(void);
+
+/**
+ * @brief Arm USB CDC if VBUS has appeared since init. Cheap (one GPIO
+ *        read) - called from the drain task's housekeeping pass.
+ */
+void usb_gate_poll(void);
+
+/**
+ * @brief Whether the CDC stack has been brought up.
+ */
+bool usb_gate_armed(void);
+
+#endif
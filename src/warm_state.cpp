@@ -0,0 +1,82 @@
+/**
+ * @file warm_state.cpp
+ *
+ * @brief Reset-retained checkpoint implementation
+ *
+ * Single-writer-per-slot by contract, so the only locking is none:
+ * saves are whole-block memcpy + checksum from the owning task, and
+ * restores happen once at task start before the writer runs.
+ */
+
+#include "warm_state.h"
+
+#include <string.h>
+
+#include "app_log.h"
+
+#define WARM_MAGIC 0x5AFE57A7u
+
+struct WarmSlotHdr {
+    uint32_t len;   // 0 = never saved
+    uint32_t sum;
+};
+
+struct WarmRegion {
+    uint32_t magic;
+    uint32_t boot_count;
+    WarmSlotHdr hdr[WARM_SLOT_COUNT];
+    uint8_t data[WARM_SLOT_COUNT][WARM_SLOT_BYTES];
+};
+
+// .uninitialized_data: the crt0 clears .bss around this, never through it
+static WarmRegion __uninitialized_ram(s_region);
+
+static bool s_warm;
+
+// FNV-1a: cheap, byte-oriented, and a zeroed block does not sum to zero
+static uint32_t block_sum(const uint8_t* p, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+void warm_state_init(void) {
+    s_warm = (s_region.magic == WARM_MAGIC);
+    if (!s_warm) {
+        memset(&s_region, 0, sizeof(s_region));
+        s_region.magic = WARM_MAGIC;
+    }
+    s_region.boot_count++;
+}
+
+bool warm_state_is_warm(void) {
+    return s_warm;
+}
+
+uint32_t warm_state_boot_count(void) {
+    return s_region.boot_count;
+}
+
+void warm_state_save(int slot, const void* src, size_t len) {
+    if (slot < 0 || slot >= WARM_SLOT_COUNT) return;
+    if (len > WARM_SLOT_BYTES) {
+        LogWarn(("warm state: slot %d block %u bytes exceeds %u, not saved",
+                 slot, (unsigned)len, (unsigned)WARM_SLOT_BYTES));
+        return;
+    }
+    memcpy(s_region.data[slot], src, len);
+    s_region.hdr[slot].len = (uint32_t)len;
+    s_region.hdr[slot].sum = block_sum(s_region.data[slot], len);
+}
+
+bool warm_state_restore(int slot, void* dst, size_t len) {
+    if (slot < 0 || slot >= WARM_SLOT_COUNT) return false;
+    const WarmSlotHdr* h = &s_region.hdr[slot];
+    if (h->len != len || h->len == 0) return false;
+    if (block_sum(s_region.data[slot], len) != h->sum) return false;
+    memcpy(dst, s_region.data[slot], len);
+    return true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file warm_state.h
+ *
+ * @brief Reset-retained checkpoint region for fast-restart control state
+ *
+ * A watchdog or soft reset restores the actuator levels from scratch
+ * registers within a second, but every filter behind them - history
+ * rings, median windows, dwell streaks, a staged calibration - came up
+ * cold, so the first minute of decisions ran on half-filled windows.
+ * SRAM survives those resets: this module keeps a small checkpoint
+ * region in a .uninitialized_data section that the runtime never
+ * zeroes, with a magic plus per-slot checksums so a power-on (random
+ * RAM) or a layout change can never restore garbage. Writers
+ * checkpoint their block once per cycle (a short memcpy plus a
+ * checksum) and restore it at task start, so recovery to steady-state
+ * control quality after a reset is one cycle.
+ *
+ * The region also carries a boot counter: it increments every boot and
+ * restarts from 1 when the region is invalid, so warm (reset) and cold
+ * (power-on) starts are distinguishable in the boot telemetry frame.
+ */
+
+#ifndef WARM_STATE_H
+#define WARM_STATE_H
+
+#include "pico/stdlib.h"
+
+/** @brief Checkpoint slots, one writer each. */
+enum WarmSlot {
+    WARM_SLOT_SENSOR = 0,  ///< history rings + median windows (sensor task)
+    WARM_SLOT_ACT,         ///< dwell filter states (report task)
+    WARM_SLOT_CALIB,       ///< calibration endpoints, incl. staged-not-flushed
+    WARM_SLOT_DUTY,        ///< pump duty accumulators (brown-out commit)
+    WARM_SLOT_LADDER,      ///< crash-loop degradation ladder (boot_ladder)
+    WARM_SLOT_COUNT
+};
+
+/** @brief Per-slot capacity; a larger save is rejected with a warning. */
+#define WARM_SLOT_BYTES 256
+
+/**
+ * @brief Validate the region and bump the boot counter.
+ *
+ * Call once, early in main() - before any restore and before tasks.
+ */
+void warm_state_init(void);
+
+/** @brief True when the region survived the reset intact. */
+bool warm_state_is_warm(void);
+
+/** @brief Boots since the region was last cold (this one included). */
+uint32_t warm_state_boot_count(void);
+
+/**
+ * @brief Checkpoint a block into its slot (called once per cycle).
+ */
+void warm_state_save(int slot, const void* src, size_t len);
+
+/**
+ * @brief Restore a slot into @p dst.
+ *
+ * @return true when the slot holds a checksummed block of exactly
+ *         @p len bytes; false on cold boot, size change or corruption.
+ */
+bool warm_state_restore(int slot, void* dst, size_t len);
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file watch_channel.cpp
+ *
+ * @brief Watch-channel implementation
+ */
+
+#include "watch_channel.h"
+
+#include <stddef.h>
+
+struct Watch {
+    uint8_t signal;
+    uint8_t edge;
+    bool in_region;
+    int32_t threshold;
+    int32_t hyst;
+    uint32_t fires;
+    WatchFn fn;
+    void* arg;
+};
+
+static Watch s_table[QDNN_WATCH_MAX];
+static int s_count;
+
+int watch_register(uint8_t signal, uint8_t edge, int32_t threshold,
+                   int32_t hyst, WatchFn fn, void* arg) {
+    if (s_count >= QDNN_WATCH_MAX) return -1;
+    Watch* w = &s_table[s_count];
+    w->signal = signal;
+    w->edge = edge;
+    w->in_region = false;
+    w->threshold = threshold;
+    w->hyst = hyst >= 0 ? hyst : 0;
+    w->fires = 0;
+    w->fn = fn;
+    w->arg = arg;
+    return s_count++;  // slot fully written before the count publishes it
+}
+
+void watch_update(uint8_t signal, int32_t value) {
+    for (int i = 0; i < s_count; i++) {
+        Watch* w = &s_table[i];
+        if (w->signal != signal) continue;
+        if (!w->in_region) {
+            bool enter = w->edge == WATCH_ABOVE ? value >= w->threshold
+                                                : value <= w->threshold;
+            if (enter) {
+                w->in_region = true;
+                w->fires++;
+                if (w->fn != NULL) w->fn(i, value, w->arg);
+            }
+        } else {
+            // Re-arm only past the hysteresis margin: a value parked
+            // on the boundary fires once, not once per update.
+            bool leave = w->edge == WATCH_ABOVE
+                             ? value < w->threshold - w->hyst
+                             : value > w->threshold + w->hyst;
+            if (leave) w->in_region = false;
+        }
+    }
+}
+
+bool watch_active(int watch) {
+    if (watch < 0 || watch >= s_count) return false;
+    return s_table[watch].in_region;
+}
+
+uint32_t watch_fires(int watch) {
+    if (watch < 0 || watch >= s_count) return 0;
+    return s_table[watch].fires;
+}
+
+int watch_count(void) {
+    return s_count;
+}
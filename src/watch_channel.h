@@ -0,0 +1,90 @@
+/**
+ * @file watch_channel.h
+ *
+ * @brief Threshold subscriptions over the filtered signal store
+ *
+ * Several features independently want "tell me when signal X crosses
+ * Y" - the soil watermark wake, the energy governor's supply bands,
+ * ad-hoc diagnostics - and each private implementation rescans the
+ * same filtered values it was handed. A watch channel inverts that:
+ * consumers register a subscription (signal, direction, threshold,
+ * hysteresis, callback) once at init, and the producer of each signal
+ * publishes its post-filter value once per update. Evaluation is one
+ * pass over the subscriptions for that signal - O(watches), no ring
+ * scans - and a callback fires on entry into the watched region only,
+ * re-arming after the signal retreats past threshold minus (or plus)
+ * the per-watch hysteresis, so a value parked on the boundary fires
+ * once, not every cycle.
+ *
+ * Host-pure: no SDK or RTOS types. Callbacks run in the publisher's
+ * context (a task for the per-cycle signals here) and must stay as
+ * cheap as that context allows - a counter bump, a log line, a task
+ * notification wrapper. Registration is init-time only, before the
+ * tasks start; the table is append-only and unlocked, same contract
+ * as the metrics registry.
+ */
+
+#ifndef WATCH_CHANNEL_H
+#define WATCH_CHANNEL_H
+
+#include <stdint.h>
+
+/** @brief Published signals, post-filter, in their native units. */
+enum WatchSignal {
+    WATCH_SIG_TEMP10 = 0,  ///< air temperature, deci-degC
+    WATCH_SIG_HUMID10,     ///< air humidity, deci-%
+    WATCH_SIG_SOIL0,       ///< soil moisture zone 0, deci-%
+    WATCH_SIG_SOIL1,       ///< zone 1
+    WATCH_SIG_SOIL2,       ///< zone 2
+    WATCH_SIG_VSYS_MV,     ///< supply rail, millivolts
+    WATCH_SIG_COUNT
+};
+
+/** @brief Which crossing arms the watch. */
+enum WatchEdge {
+    WATCH_ABOVE = 0,  ///< fire when value rises to >= threshold
+    WATCH_BELOW,      ///< fire when value falls to <= threshold
+};
+
+/**
+ * @brief Subscription callback; runs in the publisher's context.
+ *
+ * @param watch Slot index returned by watch_register.
+ * @param value The value that entered the watched region.
+ * @param arg   The subscriber's registration argument.
+ */
+typedef void (*WatchFn)(int watch, int32_t value, void* arg);
+
+/** @brief Subscription capacity; a full table refuses further slots. */
+#ifndef QDNN_WATCH_MAX
+#define QDNN_WATCH_MAX 8
+#endif
+
+/**
+ * @brief Register one subscription. Call from init code, before tasks.
+ *
+ * @param signal    WatchSignal the subscription evaluates against.
+ * @param edge      WatchEdge direction.
+ * @param threshold Region boundary, in the signal's native units.
+ * @param hyst      Re-arm margin past the boundary (>= 0).
+ * @return Slot index, or -1 when the table is full.
+ */
+int watch_register(uint8_t signal, uint8_t edge, int32_t threshold,
+                   int32_t hyst, WatchFn fn, void* arg);
+
+/**
+ * @brief Publish one post-filter value; evaluates every subscription
+ *        on that signal and dispatches entry crossings.
+ */
+void watch_update(uint8_t signal, int32_t value);
+
+/** @brief Whether a watch is currently inside its region. */
+bool watch_active(int watch);
+
+/** @brief Entry crossings dispatched since boot. */
+uint32_t watch_fires(int watch);
+
+/** @brief Registered slot count. */
+int watch_count(void);
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * @file watchdog_guard.cpp
+ *
+ * @brief Watchdog supervision implementation
+ *
+ * Scratch register use: scratch[0] carries a magic so stale contents
+ * never restore garbage levels; scratch[1] packs the fan level and up
+ * to three pump levels one nibble each in the bottom half (levels are
+ * 0..4) and the hang attribution in the top half (marker nibble,
+ * silence age, stage ID). scratch[2]/[3] belong to the A/B boot
+ * selector (fw_update.h), scratch[4..7] to the boot ROM and
+ * watchdog_reboot().
+ *
+ * The two scratch[1] halves have different writers (report task vs
+ * the monitor), so each write preserves the other half. A concurrent
+ * save can still lose one culprit update, but the poll rewrites the
+ * record every period while the stage stays silent, so the value that
+ * survives the bite is at most one period stale.
+ */
+
+#include "watchdog_guard.h"
+
+#include "hardware/watchdog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define WDG_SCRATCH_MAGIC  0x51D06A7Du
+// scratch[1] top half: marker nibble in bits 31..28, silence age in
+// seconds in 27..20, stage ID in 19..16. A power-on reset clears the
+// scratch bank to zero, so the marker never reads back as garbage.
+#define WDG_CULPRIT_MARK   0xCu
+
+// Monitor cadence: 80 feeds per timeout window, so the last culprit
+// write before a bite is at most 100 ms stale.
+#define WDG_MONITOR_PERIOD_MS 100
+
+// Last checkin time per stage, in milliseconds since boot. Written by
+// one task each, read by the poll; 32-bit accesses are atomic.
+static volatile uint32_t s_last_checkin_ms[WDG_STAGE_COUNT];
+
+void watchdog_guard_init(void) {
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    for (int i = 0; i < WDG_STAGE_COUNT; i++) s_last_checkin_ms[i] = now;
+    // pause_on_debug keeps breakpoint sessions from rebooting under us
+    watchdog_enable(WDG_TIMEOUT_MS, true);
+}
+
+void watchdog_stage_checkin(WatchdogStage stage) {
+    s_last_checkin_ms[stage] = to_ms_since_boot(get_absolute_time());
+}
+
+void watchdog_stage_checkin_all(void) {
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    for (int i = 0; i < WDG_STAGE_COUNT; i++) s_last_checkin_ms[i] = now;
+}
+
+void watchdog_guard_poll(void) {
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    // Stalest entry by deadline excess: with per-stage deadlines, raw
+    // age alone would blame a slow-cadence stage over a fast one.
+    int guilty = -1;
+    uint32_t guilty_age = 0, worst_over = 0;
+    for (int i = 0; i < WDG_STAGE_COUNT; i++) {
+        uint32_t age = now - s_last_checkin_ms[i];
+        if (age > WDG_STAGE_DEADLINE_MS[i] &&
+            age - WDG_STAGE_DEADLINE_MS[i] >= worst_over) {
+            worst_over = age - WDG_STAGE_DEADLINE_MS[i];
+            guilty_age = age;
+            guilty = i;
+        }
+    }
+    if (guilty >= 0) {
+        // Name the hang before the bite: every blocked poll rewrites
+        // the record, so the value that survives the reset carries the
+        // final silence age.
+        uint32_t age_s = guilty_age / 1000u;
+        if (age_s > 0xFF) age_s = 0xFF;
+        watchdog_hw->scratch[1] = (watchdog_hw->scratch[1] & 0x0000FFFFu) |
+                                  (WDG_CULPRIT_MARK << 28) | (age_s << 20) |
+                                  ((uint32_t)guilty << 16);
+        return;  // let it bite
+    }
+    // All live: a leftover attribution from a recovered stall would
+    // misdirect the next unrelated reset, so clear it with the feed.
+    if ((watchdog_hw->scratch[1] >> 28) == WDG_CULPRIT_MARK)
+        watchdog_hw->scratch[1] &= 0x0000FFFFu;
+    watchdog_update();
+}
+
+void watchdog_monitor_task(void*) {
+    while (true) {
+        watchdog_guard_poll();
+        vTaskDelay(pdMS_TO_TICKS(WDG_MONITOR_PERIOD_MS));
+    }
+}
+
+bool watchdog_guard_fast_boot(void) {
+    return watchdog_enable_caused_reboot();
+}
+
+int watchdog_guard_culprit(uint32_t* age_s) {
+    uint32_t v = watchdog_hw->scratch[1];
+    if ((v >> 28) != WDG_CULPRIT_MARK) return -1;
+    watchdog_hw->scratch[1] = v & 0x0000FFFFu;  // one-shot: read is consumption
+    if (age_s != NULL) *age_s = (v >> 20) & 0xFF;
+    int stage = (int)((v >> 16) & 0xF);
+    return stage < WDG_STAGE_COUNT ? stage : -1;
+}
+
+const char* watchdog_stage_name(int stage) {
+    static const char* const kNames[WDG_STAGE_COUNT] = {
+        "sensor", "infer", "report", "drain",
+    };
+    return (stage >= 0 && stage < WDG_STAGE_COUNT) ? kNames[stage] : "?";
+}
+
+void watchdog_save_levels(int fan_level, const int* pump_levels, int num_zones) {
+    uint32_t packed = (uint32_t)(fan_level & 0xF);
+    for (int z = 0; z < num_zones && z < 3; z++)
+        packed |= (uint32_t)(pump_levels[z] & 0xF) << (4 * (z + 1));
+    watchdog_hw->scratch[1] = (watchdog_hw->scratch[1] & 0xFFFF0000u) | packed;
+    watchdog_hw->scratch[0] = WDG_SCRATCH_MAGIC;
+}
+
+bool watchdog_restore_levels(int* fan_level, int* pump_levels, int num_zones) {
+    if (watchdog_hw->scratch[0] != WDG_SCRATCH_MAGIC) return false;
+    uint32_t packed = watchdog_hw->scratch[1];
+    *fan_level = (int)(packed & 0xF);
+    for (int z = 0; z < num_zones && z < 3; z++)
+        pump_levels[z] = (int)((packed >> (4 * (z + 1))) & 0xF);
+    return true;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file watchdog_guard.h
+ *
+ * @brief Hardware watchdog supervision of the control pipeline
+ *
+ * Each pipeline stage checks in against its own deadline in the stage
+ * table; a dedicated high-priority monitor task validates the table
+ * and only feeds the hardware watchdog while every entry is live. A
+ * wedged DHT11 line, a stuck queue or a hung stdio therefore ends in
+ * a hardware reset after at most the watchdog timeout - and because
+ * the monitor names the stalest entry into a scratch register on
+ * every blocked feed, the boot after the reset can say WHICH stage
+ * hung instead of just that something did. The fast-boot path (skip
+ * the USB wait, restore the last actuator levels from the scratch
+ * registers) puts the controller back in its previous state well
+ * under a second after the reset fires.
+ */
+
+#ifndef WATCHDOG_GUARD_H
+#define WATCHDOG_GUARD_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Pipeline stages the guard expects heartbeats from.
+ */
+enum WatchdogStage {
+    WDG_STAGE_SENSOR = 0,
+    WDG_STAGE_INFER,
+    WDG_STAGE_REPORT,
+    WDG_STAGE_DRAIN,
+    WDG_STAGE_COUNT,
+};
+
+/**
+ * @brief Hardware watchdog timeout. Two missed control cycles plus slack.
+ */
+const uint32_t WDG_TIMEOUT_MS = 8000;
+
+/**
+ * @brief Cycle-paced stage deadline: a checkin older than this blocks
+ * feeding the watchdog.
+ */
+const uint32_t WDG_STAGE_STALE_MS = 7000;
+
+/**
+ * @brief Drain-slot deadline: the housekeeping slot runs every 10 ms,
+ * so a far tighter bound attributes a hung stdio without any risk of
+ * a false trip.
+ */
+const uint32_t WDG_DRAIN_STALE_MS = 3000;
+
+/**
+ * @brief Per-stage deadlines, indexed by WatchdogStage.
+ */
+const uint32_t WDG_STAGE_DEADLINE_MS[WDG_STAGE_COUNT] = {
+    WDG_STAGE_STALE_MS,  // sensor
+    WDG_STAGE_STALE_MS,  // infer
+    WDG_STAGE_STALE_MS,  // report
+    WDG_DRAIN_STALE_MS,  // drain
+};
+
+/**
+ * @brief Arm the hardware watchdog. Call once tasks are created.
+ */
+void watchdog_guard_init(void);
+
+/**
+ * @brief Record that @p stage made progress this cycle.
+ */
+void watchdog_stage_checkin(WatchdogStage stage);
+
+/**
+ * @brief Refresh every stage at once (cycles that idle downstream by design).
+ */
+void watchdog_stage_checkin_all(void);
+
+/**
+ * @brief Feed the hardware watchdog if all stages are fresh.
+ *
+ * When any entry is overdue the feed is withheld and the stalest
+ * stage's ID and silence age are recorded into watchdog scratch, so
+ * the reset that follows carries its own attribution.
+ */
+void watchdog_guard_poll(void);
+
+/**
+ * @brief Monitor task body: polls the guard on a fixed short cadence.
+ *
+ * Create above every pipeline priority - the feed must stay
+ * schedulable even when a runaway pipeline task is exactly what hung,
+ * so the starved victim's entry goes stale and gets named rather than
+ * the monitor itself being the one starved.
+ */
+void watchdog_monitor_task(void* params);
+
+/**
+ * @brief True when this boot was caused by the watchdog firing.
+ */
+bool watchdog_guard_fast_boot(void);
+
+/**
+ * @brief Guilty stage recorded before the last watchdog reset.
+ *
+ * Reads and clears the attribution scratch. @p age_s (optional)
+ * receives how long the stage had been silent when the monitor last
+ * withheld the feed.
+ *
+ * @return WatchdogStage ID, or -1 if no attribution was recorded.
+ */
+int watchdog_guard_culprit(uint32_t* age_s);
+
+/**
+ * @brief Short printable name for a WatchdogStage ID.
+ */
+const char* watchdog_stage_name(int stage);
+
+/**
+ * @brief Stash actuator levels in watchdog scratch (survives the reset).
+ */
+void watchdog_save_levels(int fan_level, const int* pump_levels, int num_zones);
+
+/**
+ * @brief Recover levels stashed before a watchdog reset.
+ *
+ * @return true if valid saved levels were present.
+ */
+bool watchdog_restore_levels(int* fan_level, int* pump_levels, int num_zones);
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file ws2812_status.cpp
+ *
+ * @brief WS2812 status strip implementation
+ *
+ * Shadow buffer of left-aligned GRB words in RAM; setters rewrite one
+ * word and mark the frame dirty, the commit arms one DMA transfer into
+ * the serializer's TX FIFO. Nothing here blocks: a commit during an
+ * in-flight refresh simply leaves the dirty flag set. The WS2812 reset
+ * gap (>50 us of idle line) falls out of the once-per-cycle commit
+ * cadence for free.
+ */
+
+#include "ws2812_status.h"
+
+#include <string.h>
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+#include "app_log.h"
+#include "resource_map.h"
+#include "ws2812_status.pio.h"
+
+// Dim palette: these run steady in a field enclosure, and full-white
+// WS2812 pixels pull ~60 mA each - a whole strip at 0x10 stays under
+// a few mA and remains readable in daylight.
+#define GRB(g, r, b) ((uint32_t)(((g) << 16) | ((r) << 8) | (b)) << 8)
+
+// Levels 0..4 ramp the channel brightness; level colors are blue for
+// pumps / green for the fan so a glance separates air from water.
+static const uint8_t kLevelBright[5] = {0x00, 0x04, 0x08, 0x10, 0x20};
+
+static const uint32_t kSystemColor[] = {
+    GRB(0x08, 0x00, 0x00),  // WS2812_SYS_OK: dim green
+    GRB(0x10, 0x18, 0x00),  // WS2812_SYS_DHT_FAULT: amber
+    GRB(0x00, 0x14, 0x14),  // WS2812_SYS_ANOMALY: magenta
+    GRB(0x00, 0x20, 0x00),  // WS2812_SYS_DISARMED: red
+};
+
+static PIO s_pio;
+static int s_sm = -1;
+static int s_dma = -1;
+static uint32_t s_px[WS2812_STATUS_LEDS];  // DMA source; word writes only
+static volatile bool s_dirty;
+
+static void set_pixel(int idx, uint32_t grb) {
+    if (s_sm < 0 || s_px[idx] == grb) return;
+    s_px[idx] = grb;  // one aligned word: atomic against the DMA read
+    s_dirty = true;
+}
+
+void ws2812_status_init(void) {
+    int sm = res_claim_pio_sm("ws2812", &s_pio);
+    if (sm < 0) {
+        LogWarn(("ws2812: no free state machine, status strip disabled"));
+        return;
+    }
+    int dma = res_claim_dma("ws2812", false);
+    if (dma < 0) {
+        res_release_pio_sm(s_pio, sm);
+        LogWarn(("ws2812: no free DMA channel, status strip disabled"));
+        return;
+    }
+
+    uint offset = pio_add_program(s_pio, &ws2812_status_program);
+    ws2812_status_program_init(s_pio, (uint)sm, offset, WS2812_STATUS_PIN);
+
+    dma_channel_config c = dma_channel_get_default_config(dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(s_pio, (uint)sm, true));
+    dma_channel_configure(dma, &c, &s_pio->txf[sm], s_px,
+                          WS2812_STATUS_LEDS, false);
+
+    s_sm = sm;
+    s_dma = dma;
+
+    // First frame blanks whatever the strip held across the reset.
+    memset(s_px, 0, sizeof(s_px));
+    s_px[WS2812_PIXEL_SYSTEM] = kSystemColor[WS2812_SYS_OK];
+    s_dirty = true;
+    ws2812_status_commit();
+    LogInfo(("ws2812: %d-pixel status strip on GPIO %d",
+             WS2812_STATUS_LEDS, WS2812_STATUS_PIN));
+}
+
+void ws2812_status_system(uint8_t state) {
+    if (state >= sizeof(kSystemColor) / sizeof(kSystemColor[0])) return;
+    set_pixel(WS2812_PIXEL_SYSTEM, kSystemColor[state]);
+}
+
+void ws2812_status_fan(int level) {
+    if (level < 0) level = 0;
+    if (level > 4) level = 4;
+    set_pixel(WS2812_PIXEL_FAN, GRB(kLevelBright[level], 0, 0));
+}
+
+void ws2812_status_zone(int zone, int level, bool stale) {
+    if (zone < 0 || zone >= BOARD_MAX_ZONES) return;
+    if (level < 0) level = 0;
+    if (level > 4) level = 4;
+    uint8_t v = kLevelBright[level];
+    // Stale tint: fold some red in so a zone acting on substituted
+    // soil values reads amber-blue instead of clean blue.
+    set_pixel(WS2812_PIXEL_ZONE0 + zone,
+              stale ? GRB(v / 2, v / 2, v) : GRB(0, 0, v));
+}
+
+void ws2812_status_commit(void) {
+    if (s_sm < 0 || !s_dirty) return;
+    if (dma_channel_is_busy(s_dma)) return;  // coalesce into next cycle
+    s_dirty = false;
+    dma_channel_set_read_addr(s_dma, s_px, false);
+    dma_channel_set_trans_count(s_dma, WS2812_STATUS_LEDS, true);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file ws2812_status.h
+ *
+ * @brief WS2812 status strip: fleet diagnostics on one pin, zero CPU
+ *
+ * Field diagnosis used to read one error LED; anything richer meant
+ * more discrete pins (the bar-graph banks already eat four per
+ * actuator) and more gpio_put calls in the hot path. One WS2812 strip
+ * replaces that with a single data pin: pixel 0 carries the system
+ * state (OK / DHT fault / disarmed / anomaly), pixel 1 the fan level,
+ * and one pixel per zone the pump level with staleness tinting - the
+ * whole unit readable at a glance from across a greenhouse.
+ *
+ * The control loop pays O(1) per state change: setters rewrite one
+ * word in a RAM shadow buffer and set a dirty flag. The refresh is
+ * PIO + DMA end to end - the serializer state machine clocks the 800
+ * kHz stream from its FIFO, the DMA channel refills the FIFO from the
+ * shadow - so shipping a frame costs one DMA trigger in the report
+ * task's commit and no CPU afterwards. A commit landing while the
+ * previous frame is still draining coalesces into the next one.
+ *
+ * Enabled with QDNN_WS2812_STATUS; the strip's data pin comes from
+ * the build (WS2812_STATUS_PIN).
+ */
+
+#ifndef WS2812_STATUS_H
+#define WS2812_STATUS_H
+
+#include "pico/stdlib.h"
+
+#include "board_profile.h"
+
+/** @brief Strip data-in GPIO; override from the build per board. */
+#ifndef WS2812_STATUS_PIN
+#define WS2812_STATUS_PIN 2
+#endif
+
+/** @brief Pixel layout: system, fan, then one per zone. */
+#define WS2812_PIXEL_SYSTEM 0
+#define WS2812_PIXEL_FAN    1
+#define WS2812_PIXEL_ZONE0  2
+#define WS2812_STATUS_LEDS  (2 + BOARD_MAX_ZONES)
+
+/** @brief System pixel states, in ascending display priority. */
+enum Ws2812SystemState {
+    WS2812_SYS_OK = 0,     ///< steady dim green
+    WS2812_SYS_DHT_FAULT,  ///< amber: air sensor failing, values held
+    WS2812_SYS_ANOMALY,    ///< magenta: anomaly score over threshold
+    WS2812_SYS_DISARMED,   ///< red: actuation disarmed (model CRC)
+};
+
+/**
+ * @brief Claim a state machine + DMA channel and blank the strip.
+ *
+ * Call once at boot after the GPIO bring-up; safe to call on builds
+ * whose PIO blocks are crowded - a failed claim logs and leaves every
+ * setter a no-op.
+ */
+void ws2812_status_init(void);
+
+/** @brief Set the system pixel. O(1), any task. */
+void ws2812_status_system(uint8_t state);
+
+/** @brief Set the fan pixel from the committed level (0..4). */
+void ws2812_status_fan(int level);
+
+/**
+ * @brief Set a zone pixel from the committed pump level (0..4).
+ *
+ * @param stale True tints the pixel amber: the level is acting on a
+ *              substituted (stale) soil value.
+ */
+void ws2812_status_zone(int zone, int level, bool stale);
+
+/**
+ * @brief Ship the shadow buffer if anything changed. Report task,
+ *        once per cycle; a refresh still in flight defers to the next.
+ */
+void ws2812_status_commit(void);
+
+#endif
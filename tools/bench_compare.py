@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Compare a benchmark run against its checked-in golden timings.
+
+Parses the console output of the on-target benchmark (qdnn_benchmark.uf2)
+or the host simulator's --bench mode and compares every metric against a
+golden file, flagging regressions beyond tolerance. A kernel or SDK bump
+that slows an invoke shows up here before any unit is flashed.
+
+Recognized metric lines (inside "--- profile: NAME ---" sections):
+
+    fan: 100 invokes, 123456 ticks total, 1234 ticks/invoke (...)
+    quantize: 10000000 iters, ... ns total, 4.20 ns/iter
+    FULLY_CONNECTED, 4567          (MicroProfiler per-op CSV)
+
+Workflow:
+
+    # record / refresh the baseline (on the bench rig or CI runner)
+    ./qdnn_sim --bench | tools/bench_compare.py tools/bench_golden_host.txt - --update
+
+    # gate a change (exit 1 on regression beyond tolerance)
+    ./qdnn_sim --bench | tools/bench_compare.py tools/bench_golden_host.txt -
+
+On-target runs are captured from the USB console to a file first and
+compared the same way against tools/bench_golden_rp2040.txt. Host
+timings wobble with machine load; use a generous --tolerance there
+(the sim's bench_check target uses 50). A golden file with no metrics
+recorded yet compares clean with a warning, so the gate can be wired
+into CI before the first baseline exists.
+
+Host absolute nanoseconds are a property of whatever CPU recorded
+them, so a golden captured on one machine reads as a phantom
+regression on a slower one. --normalize KEY divides every metric -
+golden and run alike - by the named metric from its own dataset
+before comparing, gating on ratios between kernels measured in the
+same run instead. The reference kernel itself always compares as 1.0
+and is effectively ungated; pick a steady, loop-heavy one. The golden
+file stays in absolute units, so --update is unaffected. On-target
+tick counts are deterministic per binary and are compared absolute.
+"""
+
+import argparse
+import re
+import sys
+
+E2E_RE = re.compile(
+    r"^(\w+): \d+ (?:invokes|iters), [\d.]+ (?:ticks|ns) total, "
+    r"([\d.]+) (?:ticks/invoke|ns/iter)")
+PROFILE_RE = re.compile(r"^--- profile: (.+?) ---")
+OP_RE = re.compile(r"^([A-Z][A-Z_0-9]*), ([\d.]+)\s*$")
+
+
+def parse_metrics(lines):
+    """-> dict of 'profile/model/e2e' or 'profile/model/op/TAG' to float."""
+    metrics = {}
+    profile = "default"
+    model = None
+    for line in lines:
+        line = line.strip()
+        m = PROFILE_RE.match(line)
+        if m:
+            profile = m.group(1).replace(" ", "_")
+            continue
+        m = E2E_RE.match(line)
+        if m:
+            model = m.group(1)
+            metrics["%s/%s/e2e" % (profile, model)] = float(m.group(2))
+            continue
+        m = OP_RE.match(line)
+        if m and model is not None:
+            metrics["%s/%s/op/%s" % (profile, model, m.group(1))] = float(m.group(2))
+    return metrics
+
+
+def load_golden(path):
+    metrics = {}
+    try:
+        with open(path) as f:
+            for line in f:
+                line = line.strip()
+                if not line or line.startswith("#"):
+                    continue
+                key, value = line.split()
+                metrics[key] = float(value)
+    except FileNotFoundError:
+        pass
+    return metrics
+
+
+def save_golden(path, metrics):
+    with open(path, "w") as f:
+        f.write("# Golden benchmark timings - recorded with:\n")
+        f.write("#   <benchmark output> | tools/bench_compare.py %s - --update\n" % path)
+        f.write("# Units: ticks/invoke (target) or ns/iter (host); per-op keys are\n")
+        f.write("# MicroProfiler tick totals over the timed batch.\n")
+        for key in sorted(metrics):
+            f.write("%s %s\n" % (key, metrics[key]))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("golden", help="golden timings file (checked in)")
+    ap.add_argument("run", help="captured benchmark output, or - for stdin")
+    ap.add_argument("--tolerance", type=float, default=15.0,
+                    help="allowed slowdown in percent (default 15)")
+    ap.add_argument("--update", action="store_true",
+                    help="rewrite the golden file from this run")
+    ap.add_argument("--normalize", metavar="KEY",
+                    help="divide all metrics by KEY from the same dataset "
+                         "before comparing (host-speed-invariant ratios)")
+    args = ap.parse_args()
+
+    lines = sys.stdin if args.run == "-" else open(args.run)
+    current = parse_metrics(lines)
+    if not current:
+        print("bench_compare: no metrics found in run output", file=sys.stderr)
+        return 2
+
+    if args.update:
+        save_golden(args.golden, current)
+        print("bench_compare: recorded %d metrics to %s" % (len(current), args.golden))
+        return 0
+
+    golden = load_golden(args.golden)
+    if not golden:
+        print("bench_compare: WARNING: %s has no recorded baseline; "
+              "run with --update on the bench rig first" % args.golden)
+        return 0
+
+    if args.normalize:
+        for name, metrics in (("golden", golden), ("run", current)):
+            ref = metrics.get(args.normalize)
+            if not ref:
+                print("bench_compare: reference metric %s missing from %s"
+                      % (args.normalize, name), file=sys.stderr)
+                return 2
+            for key in metrics:
+                metrics[key] /= ref
+
+    regressions = []
+    for key, value in sorted(current.items()):
+        if key not in golden:
+            print("  new     %-40s %10.2f (not in golden)" % (key, value))
+            continue
+        base = golden[key]
+        delta = (value - base) / base * 100.0 if base else 0.0
+        marker = " "
+        if delta > args.tolerance:
+            marker = "!"
+            regressions.append((key, base, value, delta))
+        print("  %s %+6.1f%% %-40s %10.2f (golden %.2f)"
+              % (marker, delta, key, value, base))
+    for key in sorted(set(golden) - set(current)):
+        print("  missing %-40s (in golden, not in run)" % key)
+
+    if regressions:
+        print("\nbench_compare: %d regression(s) beyond %.0f%% tolerance:"
+              % (len(regressions), args.tolerance))
+        for key, base, value, delta in regressions:
+            print("  %s: %.2f -> %.2f (%+.1f%%)" % (key, base, value, delta))
+        return 1
+    print("\nbench_compare: OK (%d metrics within %.0f%%)"
+          % (len(current), args.tolerance))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
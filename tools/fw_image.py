@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Wrap an application .bin into an A/B slot image (see src/fw_update.h).
+
+Prepends the 256-byte FwSlotHeader (magic, len, payload CRC-32, slot
+index, version stamp, confirmed = 0xFFFFFFFF) to the raw binary the
+build produced for that slot, then prints the "fwload <len> <crc32>"
+line the device shell expects - the announced CRC covers the whole
+stream, header included; the header's own CRC field covers the image.
+
+The sequence field is left zero: the device stamps the next monotonic
+sequence when it commits the header sector, so the host never has to
+know which slot is newest.
+
+Usage: fw_image.py APP_BIN --slot {0,1} [--version N] [--out SLOT_BIN]
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+HEADER_BYTES = 256
+MAGIC = 0x51465730  # "QFW0", matches FW_SLOT_MAGIC
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("app_bin", help="application .bin built for this slot")
+    ap.add_argument("--slot", type=int, required=True, choices=(0, 1),
+                    help="slot the binary was linked for (QDNN_FW_SLOT)")
+    ap.add_argument("--version", type=int, default=0,
+                    help="build stamp stored in the header (informational)")
+    ap.add_argument("--out", help="output path (default: APP_BIN.slotN)")
+    args = ap.parse_args()
+
+    with open(args.app_bin, "rb") as f:
+        image = f.read()
+    if not image:
+        sys.exit("fw_image: empty input")
+
+    header = struct.pack(
+        "<8I",
+        MAGIC,
+        0,                        # seq: stamped by the device
+        len(image),
+        zlib.crc32(image) & 0xFFFFFFFF,
+        args.slot,
+        args.version,
+        0xFFFFFFFF,               # confirmed: trial until proven healthy
+        0xFFFFFFFF,               # reserved
+    )
+    blob = header + b"\xFF" * (HEADER_BYTES - len(header)) + image
+
+    out = args.out or "%s.slot%d" % (args.app_bin, args.slot)
+    with open(out, "wb") as f:
+        f.write(blob)
+
+    print("wrote %s (%d bytes, slot %d)" % (out, len(blob), args.slot))
+    print("device command: fwload %d %08x" %
+          (len(blob), zlib.crc32(blob) & 0xFFFFFFFF))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Generate constexpr tensor descriptors from the model headers.
+
+Walks the flatbuffer byte arrays embedded in the given model/*.h files
+and emits one QdnnModelDesc per model: input/output dims, element type
+and quantization parameters as constexpr data. The firmware pins its
+structural assumptions (feature count, int8 quantization) against these
+with static_asserts, so a model export that changes shape or type fails
+the build with the mismatch named - instead of misbehaving at runtime
+behind a tensor->type branch. Multi-output models (the combo head pair)
+are described by their first output.
+
+Usage: gen_model_desc.py OUTPUT_HEADER MODEL_HEADER [MODEL_HEADER...]
+"""
+
+import re
+import struct
+import sys
+
+# tflite TensorType code -> TfLiteType enumerator. Extend as the
+# training pipeline grows new dtypes; keep codes in sync with
+# tensorflow/lite/schema/schema_generated.h.
+TENSOR_TYPES = {
+    0: "kTfLiteFloat32",
+    2: "kTfLiteInt32",
+    3: "kTfLiteUInt8",
+    4: "kTfLiteInt64",
+    7: "kTfLiteInt16",
+    9: "kTfLiteInt8",
+}
+
+MAX_DIMS = 4
+
+
+def u32(buf, off):
+    return struct.unpack_from("<I", buf, off)[0]
+
+
+def i32(buf, off):
+    return struct.unpack_from("<i", buf, off)[0]
+
+
+def u16(buf, off):
+    return struct.unpack_from("<H", buf, off)[0]
+
+
+def f32(buf, off):
+    return struct.unpack_from("<f", buf, off)[0]
+
+
+def i64(buf, off):
+    return struct.unpack_from("<q", buf, off)[0]
+
+
+def table_field(buf, table, field_id):
+    """Return the absolute position of a table field, or None if absent."""
+    vtable = table - i32(buf, table)
+    entry = 4 + 2 * field_id
+    if entry >= u16(buf, vtable):
+        return None
+    rel = u16(buf, vtable + entry)
+    return table + rel if rel else None
+
+
+def vector_at(buf, field_pos):
+    """Absolute position of a vector's length word."""
+    return field_pos + u32(buf, field_pos)
+
+
+def tensor_desc(buf, tensor):
+    """(dims, type_code, scale, zero_point) for one Tensor table."""
+    dims = []
+    shape = table_field(buf, tensor, 0)
+    if shape is not None:
+        vec = vector_at(buf, shape)
+        dims = [i32(buf, vec + 4 + 4 * i) for i in range(u32(buf, vec))]
+    type_pos = table_field(buf, tensor, 1)
+    type_code = buf[type_pos] if type_pos is not None else 0
+    scale, zero_point = 0.0, 0
+    quant = table_field(buf, tensor, 4)
+    if quant is not None:
+        qtable = quant + u32(buf, quant)
+        spos = table_field(buf, qtable, 2)
+        if spos is not None:
+            vec = vector_at(buf, spos)
+            if u32(buf, vec):
+                scale = f32(buf, vec + 4)
+        zpos = table_field(buf, qtable, 3)
+        if zpos is not None:
+            vec = vector_at(buf, zpos)
+            if u32(buf, vec):
+                zero_point = i64(buf, vec + 4)
+    return dims, type_code, scale, zero_point
+
+
+def model_io_descs(buf):
+    """(input_desc, output_desc) of subgraph 0."""
+    root = u32(buf, 0)
+    subgraphs = table_field(buf, root, 2)  # Model.subgraphs
+    if subgraphs is None:
+        sys.exit("gen_model_desc: model has no subgraphs")
+    vec = vector_at(buf, subgraphs)
+    sg = (vec + 4) + u32(buf, vec + 4)
+    tensors = vector_at(buf, table_field(buf, sg, 0))
+
+    def tensor_at(idx):
+        elem = tensors + 4 + 4 * idx
+        return elem + u32(buf, elem)
+
+    inputs = vector_at(buf, table_field(buf, sg, 1))
+    outputs = vector_at(buf, table_field(buf, sg, 2))
+    in_desc = tensor_desc(buf, tensor_at(i32(buf, inputs + 4)))
+    out_desc = tensor_desc(buf, tensor_at(i32(buf, outputs + 4)))
+    return in_desc, out_desc
+
+
+def header_bytes(path):
+    """Extract the embedded C byte array from a model header."""
+    with open(path) as f:
+        text = f.read()
+    hex_bytes = re.findall(r"0x([0-9a-fA-F]{2})", text)
+    if not hex_bytes:
+        sys.exit(f"gen_model_desc: no byte array found in {path}")
+    return bytes(int(h, 16) for h in hex_bytes)
+
+
+def desc_name(path):
+    """qdnn_fan_model.h -> kQdnnFanModelDesc"""
+    stem = path.split("/")[-1].rsplit(".", 1)[0]
+    return "k" + "".join(p.capitalize() for p in stem.split("_")) + "Desc"
+
+
+def emit_tensor(desc):
+    dims, type_code, scale, zero_point = desc
+    if type_code not in TENSOR_TYPES:
+        sys.exit(
+            f"gen_model_desc: tensor type code {type_code} has no "
+            f"TfLiteType mapping - extend TENSOR_TYPES in {sys.argv[0]}"
+        )
+    if len(dims) > MAX_DIMS:
+        sys.exit(f"gen_model_desc: rank {len(dims)} exceeds MAX_DIMS")
+    padded = dims + [0] * (MAX_DIMS - len(dims))
+    dims_s = ", ".join(str(d) for d in padded)
+    return (
+        f"{{ {TENSOR_TYPES[type_code]}, {len(dims)}, {{{dims_s}}}, "
+        f"{scale!r}f, {zero_point} }}"
+    )
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    out_path = sys.argv[1]
+    model_paths = sys.argv[2:]
+
+    lines = []
+    lines.append("// Auto-generated by tools/gen_model_desc.py - do not edit.")
+    lines.append("#ifndef QDNN_MODEL_DESC_H")
+    lines.append("#define QDNN_MODEL_DESC_H")
+    lines.append("")
+    lines.append('#include "tensorflow/lite/c/common.h"')
+    lines.append("")
+    lines.append(f"#define QDNN_DESC_MAX_DIMS {MAX_DIMS}")
+    lines.append("")
+    lines.append("struct QdnnTensorDesc {")
+    lines.append("    TfLiteType type;")
+    lines.append("    int rank;")
+    lines.append("    int dims[QDNN_DESC_MAX_DIMS];")
+    lines.append("    float scale;")
+    lines.append("    int zero_point;")
+    lines.append("};")
+    lines.append("")
+    lines.append("struct QdnnModelDesc {")
+    lines.append("    QdnnTensorDesc input;")
+    lines.append("    QdnnTensorDesc output;")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Innermost dimension: feature count for inputs, class")
+    lines.append("// count for outputs.")
+    lines.append("constexpr int qdnn_desc_last_dim(const QdnnTensorDesc& t) {")
+    lines.append("    return t.dims[t.rank - 1];")
+    lines.append("}")
+    for path in model_paths:
+        in_desc, out_desc = model_io_descs(header_bytes(path))
+        lines.append("")
+        lines.append(f"// {path.split('/')[-1]}")
+        lines.append(f"inline constexpr QdnnModelDesc {desc_name(path)} = {{")
+        lines.append(f"    {emit_tensor(in_desc)},")
+        lines.append(f"    {emit_tensor(out_desc)},")
+        lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Generate an exact-size MicroMutableOpResolver from the model headers.
+
+Scans the flatbuffer byte arrays embedded in the given model/*.h files,
+extracts the operator codes each model actually uses, and emits a header
+defining QdnnOpResolver (sized to the union of the ops) plus
+qdnn_register_ops(). A model update that introduces an op this script
+does not know about fails the build here, with the op named - instead of
+failing at AllocateTensors() time on hardware.
+
+Usage: gen_op_resolver.py OUTPUT_HEADER MODEL_HEADER [MODEL_HEADER...]
+"""
+
+import re
+import struct
+import sys
+
+# tflite BuiltinOperator code -> MicroMutableOpResolver registration.
+# Extend as the training pipeline grows new layers; keep codes in sync
+# with tensorflow/lite/schema/schema_generated.h.
+BUILTIN_OPS = {
+    0: ("ADD", "AddAdd"),
+    1: ("AVERAGE_POOL_2D", "AddAveragePool2D"),
+    2: ("CONCATENATION", "AddConcatenation"),
+    3: ("CONV_2D", "AddConv2D"),
+    4: ("DEPTHWISE_CONV_2D", "AddDepthwiseConv2D"),
+    6: ("DEQUANTIZE", "AddDequantize"),
+    9: ("FULLY_CONNECTED", "AddFullyConnected"),
+    14: ("LOGISTIC", "AddLogistic"),
+    17: ("MAX_POOL_2D", "AddMaxPool2D"),
+    18: ("MUL", "AddMul"),
+    19: ("RELU", "AddRelu"),
+    21: ("RELU6", "AddRelu6"),
+    22: ("RESHAPE", "AddReshape"),
+    25: ("SOFTMAX", "AddSoftmax"),
+    28: ("TANH", "AddTanh"),
+    34: ("PAD", "AddPad"),
+    40: ("MEAN", "AddMean"),
+    45: ("STRIDED_SLICE", "AddStridedSlice"),
+    114: ("QUANTIZE", "AddQuantize"),
+}
+
+
+def u32(buf, off):
+    return struct.unpack_from("<I", buf, off)[0]
+
+
+def i32(buf, off):
+    return struct.unpack_from("<i", buf, off)[0]
+
+
+def u16(buf, off):
+    return struct.unpack_from("<H", buf, off)[0]
+
+
+def i8(buf, off):
+    return struct.unpack_from("<b", buf, off)[0]
+
+
+def table_field(buf, table, field_id):
+    """Return the absolute position of a table field, or None if absent."""
+    vtable = table - i32(buf, table)
+    entry = 4 + 2 * field_id
+    if entry >= u16(buf, vtable):
+        return None
+    rel = u16(buf, vtable + entry)
+    return table + rel if rel else None
+
+
+def model_op_codes(buf):
+    """Builtin operator codes used by one .tflite flatbuffer."""
+    root = u32(buf, 0)
+    vec_field = table_field(buf, root, 1)  # Model.operator_codes
+    if vec_field is None:
+        return set()
+    vec = vec_field + u32(buf, vec_field)
+    count = u32(buf, vec)
+    codes = set()
+    for i in range(count):
+        elem = vec + 4 + 4 * i
+        opcode_table = elem + u32(buf, elem)
+        # Pre-2.4 exports put the code in the deprecated int8 field;
+        # newer ones use the int32 field. The effective code is the max.
+        dep_pos = table_field(buf, opcode_table, 0)
+        new_pos = table_field(buf, opcode_table, 3)
+        deprecated = i8(buf, dep_pos) if dep_pos is not None else 0
+        builtin = i32(buf, new_pos) if new_pos is not None else 0
+        codes.add(max(deprecated, builtin))
+    return codes
+
+
+def header_bytes(path):
+    """Extract the embedded C byte array from a model header."""
+    with open(path) as f:
+        text = f.read()
+    hex_bytes = re.findall(r"0x([0-9a-fA-F]{2})", text)
+    if not hex_bytes:
+        sys.exit(f"gen_op_resolver: no byte array found in {path}")
+    return bytes(int(h, 16) for h in hex_bytes)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    out_path = sys.argv[1]
+    model_paths = sys.argv[2:]
+
+    all_codes = set()
+    per_model = []
+    for path in model_paths:
+        codes = model_op_codes(header_bytes(path))
+        unknown = sorted(c for c in codes if c not in BUILTIN_OPS)
+        if unknown:
+            sys.exit(
+                f"gen_op_resolver: {path} uses builtin op code(s) "
+                f"{unknown} with no registration mapping - extend "
+                f"BUILTIN_OPS in {sys.argv[0]}"
+            )
+        per_model.append((path, sorted(codes)))
+        all_codes |= codes
+
+    ops = sorted(all_codes)
+    lines = []
+    lines.append("// Auto-generated by tools/gen_op_resolver.py - do not edit.")
+    for path, codes in per_model:
+        names = ", ".join(BUILTIN_OPS[c][0] for c in codes)
+        lines.append(f"//   {path.split('/')[-1]}: {names}")
+    lines.append("#ifndef QDNN_OP_RESOLVER_H")
+    lines.append("#define QDNN_OP_RESOLVER_H")
+    lines.append("")
+    lines.append('#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"')
+    lines.append("")
+    lines.append(f"#define QDNN_NUM_OPS {len(ops)}")
+    lines.append("")
+    lines.append("// Builtin op codes behind the registrations below, for the OTA")
+    lines.append("// upload preflight (model_preflight.cpp): an uploaded flatbuffer")
+    lines.append("// using anything outside this set cannot run on this image.")
+    codes_s = ", ".join(str(c) for c in ops)
+    lines.append(f"inline constexpr int32_t kQdnnOpWhitelist[QDNN_NUM_OPS] = {{{codes_s}}};")
+    lines.append("")
+    lines.append("using QdnnOpResolver = tflite::MicroMutableOpResolver<QDNN_NUM_OPS>;")
+    lines.append("")
+    lines.append("inline void qdnn_register_ops(QdnnOpResolver& resolver) {")
+    for c in ops:
+        lines.append(f"    resolver.{BUILTIN_OPS[c][1]}();")
+    lines.append("}")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
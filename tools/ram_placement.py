@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Rank __not_in_flash placement candidates by measured value per KB.
+
+Blanket copy-to-ram costs 100+ KB of SRAM; the right subset of
+functions to pin should come from data. This tool joins two inputs:
+
+  * a benchmark console capture (qdnn_benchmark.uf2 output: the
+    MicroProfiler per-op CSV plus the scoped-timer / quantize lines),
+    which says where the cycles go, and
+  * the GNU ld link map of the firmware image, which says what each
+    candidate's .text would cost in SRAM,
+
+then scores every annotated QDNN_HOT_FUNC_RANK site as cycles-in-flash
+per KB of SRAM spent and prints the ranking alongside the current rank
+assignments in src/ram_code.h. Given --budget it also prints the
+largest QDNN_RAM_TOPK whose cumulative size fits, so the build setting
+follows the measurement instead of the other way round.
+
+Workflow:
+
+    # capture a benchmark run from the USB console, then:
+    tools/ram_placement.py bench.txt build/QDNN_AIOT.elf.map --budget 8192
+
+Vendored TFLM/CMSIS-NN kernels (FULLY_CONNECTED and friends) are
+reported in a separate section: they usually dominate cycles but
+pinning them means patching the vendored lib, so they are measured
+here and excluded from the rank list on purpose.
+"""
+
+import argparse
+import re
+import sys
+
+# Annotated sites: (site, current rank, map-symbol regex, capture hook).
+# The capture hook maps a metric key from the benchmark output to this
+# site; scoped-timer sites use the shell "timing" line names.
+CANDIDATES = [
+    # Symbol regexes match the demangled-or-mangled .text section name
+    # (static C++ functions mangle to _ZL<len><name>...).
+    ("dht_decode", 1, r"_ZN5Dht11(4read|8pollRead)E", "dht"),
+    ("prepare_input_values", 2, r"prepare_input_values", "quantize"),
+    ("run_model_batch", 2, r"run_model_batch", "infer"),
+    ("argmax_output", 3, r"argmax_output", "infer"),
+    ("invoke_guarded", 4, r"invoke_guarded", "infer"),
+    ("run_model_safe", 4, r"run_model_safe", "infer"),
+]
+
+# Library kernels: measured and reported, never ranked (vendored code).
+LIB_OPS = ["FULLY_CONNECTED", "SOFTMAX", "RESHAPE", "LOGISTIC"]
+
+MAP_TEXT_RE = re.compile(
+    r"^\s\.text\.?(\S*)\s*\n?\s*0x[0-9a-f]+\s+0x([0-9a-f]+)", re.M)
+OP_RE = re.compile(r"^([A-Z][A-Z_0-9]*), ([\d.]+)\s*$")
+TIMING_RE = re.compile(r"^(\w+)\s+n=(\d+) max=\d+us mean=(\d+)us")
+E2E_RE = re.compile(r"^(\w+): \d+ invokes, \d+ ticks total, (\d+) ticks/invoke")
+
+
+def parse_map_sizes(text):
+    """-> dict of .text section suffix to size in bytes."""
+    sizes = {}
+    # ld wraps long section names onto their own line; normalize first.
+    text = re.sub(r"(\.text\.\S+)\n\s+(0x)", r"\1 \2", text)
+    for m in re.finditer(r"\.text\.(\S+)\s+0x[0-9a-f]+\s+0x([0-9a-f]+)", text):
+        sizes[m.group(1)] = sizes.get(m.group(1), 0) + int(m.group(2), 16)
+    return sizes
+
+
+def parse_capture(lines):
+    """-> (per-op ticks, per-site mean us) from a benchmark capture."""
+    ops = {}
+    sites = {}
+    for line in lines:
+        line = line.strip()
+        m = OP_RE.match(line)
+        if m:
+            ops[m.group(1)] = ops.get(m.group(1), 0.0) + float(m.group(2))
+            continue
+        m = TIMING_RE.match(line)
+        if m:
+            sites[m.group(1)] = float(m.group(3))
+            continue
+        m = E2E_RE.match(line)
+        if m:
+            sites.setdefault("infer", float(m.group(2)))
+    return ops, sites
+
+
+def candidate_size(sizes, pattern):
+    rx = re.compile(pattern)
+    return sum(sz for name, sz in sizes.items() if rx.search(name))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("capture", help="benchmark console capture ('-' = stdin)")
+    ap.add_argument("mapfile", help="GNU ld link map of the firmware image")
+    ap.add_argument("--budget", type=int, default=0,
+                    help="SRAM bytes available; prints the QDNN_RAM_TOPK "
+                         "that fits")
+    args = ap.parse_args()
+
+    lines = (sys.stdin if args.capture == "-"
+             else open(args.capture)).readlines()
+    ops, sites = parse_capture(lines)
+    sizes = parse_map_sizes(open(args.mapfile).read())
+
+    rows = []
+    for site, rank, sym_rx, hook in CANDIDATES:
+        size = candidate_size(sizes, sym_rx)
+        cycles = sites.get(hook, 0.0)
+        score = cycles * 1024.0 / size if size else 0.0
+        rows.append((score, site, rank, size, cycles))
+    rows.sort(reverse=True)
+
+    print("%-22s %5s %7s %10s %12s" %
+          ("site", "rank", "bytes", "us/cycle", "score(us/KB)"))
+    spent = 0
+    fit_topk = 0
+    for i, (score, site, rank, size, cycles) in enumerate(rows):
+        spent += size
+        if args.budget and spent <= args.budget:
+            fit_topk = max(fit_topk, rank)
+        marker = ""
+        if rank != i + 1 and size:
+            marker = "  <- measured order disagrees with rank %d" % rank
+        print("%-22s %5d %7d %10.1f %12.1f%s" %
+              (site, rank, size, cycles, score, marker))
+
+    lib_total = sum(ops.get(op, 0.0) for op in LIB_OPS)
+    if lib_total:
+        print("\nvendored kernels (not rankable without lib patches):")
+        for op in LIB_OPS:
+            if op in ops:
+                print("  %-20s %10.1f ticks" % (op, ops[op]))
+        print("  %-20s %10.1f ticks total" % ("", lib_total))
+
+    if args.budget:
+        print("\nbudget %d bytes -> -DQDNN_RAM_TOPK=%d" %
+              (args.budget, fit_topk))
+
+
+if __name__ == "__main__":
+    main()
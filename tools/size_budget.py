@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Per-subsystem flash/SRAM budget report from the GNU ld link map.
+
+Flash and SRAM budgets are invisible until a build stops fitting: the
+model flatbuffers, the tflmicro kernels, the FreeRTOS heap and the SDK
+all grow independently and nobody sees the sum move. This tool parses
+the link map the SDK build already emits (build/QDNN_AIOT.elf.map)
+into per-subsystem totals per memory region and enforces ceilings, so
+memory is a number that moves per commit instead of a cliff found at
+integration.
+
+Buckets (by input-object path, with the model arrays pulled out by
+their dedicated .flashdata.qdnn_models section):
+
+    models     the flatbuffer arrays (and model bank staging)
+    tflm       pico-tflmicro + CMSIS-NN kernels
+    freertos   kernel + port
+    sdk        pico-sdk (boot2, stdio, hardware_* drivers)
+    telemetry  wire encode, log rings, datalog, uplink, UART DMA
+    app        everything else built from src/
+    toolchain  libgcc / newlib
+    other      anything unclassified (should stay near zero)
+
+Ceilings are "bucket:region=size" (size takes k/M suffixes); "total"
+is a bucket. The RP2040 hardware totals are always enforced. A build
+over any ceiling exits nonzero, which fails the POST_BUILD step.
+
+Wired into the firmware build behind QDNN_SIZE_REPORT; standalone:
+
+    tools/size_budget.py build/QDNN_AIOT.elf.map \\
+        --ceiling models:flash=64k --ceiling total:ram=200k
+"""
+
+import argparse
+import re
+import sys
+
+# Input-section lines: one-line and wrapped two-line forms both occur
+# (ld wraps when the section name is long).
+SEC_RE = re.compile(
+    r"^ (\.[^\s]+)\s*\n?\s+0x([0-9a-f]{8,16})\s+0x([0-9a-f]+)\s+(\S+)$",
+    re.M)
+
+FLASH_BASE, FLASH_SIZE = 0x10000000, 2 * 1024 * 1024
+RAM_BASE, RAM_SIZE = 0x20000000, 264 * 1024
+
+BUCKETS = ["models", "tflm", "freertos", "sdk", "telemetry", "app",
+           "toolchain", "other"]
+
+# App objects whose job is getting data off the board, reported as
+# their own line: the telemetry path has its own growth dynamics.
+TELEMETRY_OBJS = ("telemetry", "log_ring", "log_fmt", "datalog",
+                  "net_uplink", "uart_dma_tx")
+
+
+def classify(section, obj):
+    if section.startswith(".flashdata.qdnn_models"):
+        return "models"
+    o = obj.lower()
+    if "tflmicro" in o or "tflite" in o or "tensorflow" in o or "cmsis" in o:
+        return "tflm"
+    if "freertos" in o:
+        return "freertos"
+    if "pico-sdk" in o or "pico_sdk" in o:
+        return "sdk"
+    if "libgcc" in o or "libc" in o or "libm" in o or "crt" in o:
+        return "toolchain"
+    if "/src/" in o.replace("\\", "/") or o.endswith((".cpp.obj", ".c.obj")):
+        name = o.replace("\\", "/").rsplit("/", 1)[-1]
+        if name.startswith(TELEMETRY_OBJS):
+            return "telemetry"
+        return "app"
+    return "other"
+
+
+def region_of(addr):
+    if FLASH_BASE <= addr < FLASH_BASE + FLASH_SIZE:
+        return "flash"
+    if RAM_BASE <= addr < RAM_BASE + RAM_SIZE:
+        return "ram"
+    return None  # debug / discarded
+
+
+def parse_map(text):
+    """-> {bucket: {region: bytes}} over all allocated input sections."""
+    totals = {b: {"flash": 0, "ram": 0} for b in BUCKETS}
+    for m in SEC_RE.finditer(text):
+        section, addr, size, obj = m.group(1), int(m.group(2), 16), \
+            int(m.group(3), 16), m.group(4)
+        region = region_of(addr)
+        if region is None or size == 0:
+            continue
+        totals[classify(section, obj)][region] += size
+    return totals
+
+
+def parse_size(s):
+    m = re.fullmatch(r"(\d+)([kKmM]?)", s)
+    if not m:
+        raise argparse.ArgumentTypeError("bad size %r" % s)
+    n = int(m.group(1))
+    return n * {"": 1, "k": 1024, "m": 1024 * 1024}[m.group(2).lower()]
+
+
+def parse_ceiling(s):
+    m = re.fullmatch(r"(\w+):(flash|ram)=(\S+)", s)
+    if not m or (m.group(1) not in BUCKETS and m.group(1) != "total"):
+        raise argparse.ArgumentTypeError("bad ceiling %r" % s)
+    return m.group(1), m.group(2), parse_size(m.group(3))
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description="per-subsystem size budget report from a link map")
+    ap.add_argument("mapfile", help="GNU ld map (QDNN_AIOT.elf.map)")
+    ap.add_argument("--ceiling", action="append", default=[],
+                    type=parse_ceiling, metavar="BUCKET:REGION=SIZE",
+                    help="budget ceiling, repeatable (bucket 'total' allowed)")
+    args = ap.parse_args()
+
+    with open(args.mapfile) as f:
+        totals = parse_map(f.read())
+
+    total = {r: sum(totals[b][r] for b in BUCKETS) for r in ("flash", "ram")}
+
+    print("[size],header,bucket,flash_bytes,ram_bytes")
+    for b in BUCKETS:
+        if totals[b]["flash"] or totals[b]["ram"]:
+            print("[size],%s,%d,%d" % (b, totals[b]["flash"], totals[b]["ram"]))
+    print("[size],total,%d,%d  (flash %.1f%% of %dk, ram %.1f%% of %dk)" % (
+        total["flash"], total["ram"],
+        100.0 * total["flash"] / FLASH_SIZE, FLASH_SIZE // 1024,
+        100.0 * total["ram"] / RAM_SIZE, RAM_SIZE // 1024))
+
+    ceilings = list(args.ceiling)
+    ceilings.append(("total", "flash", FLASH_SIZE))
+    ceilings.append(("total", "ram", RAM_SIZE))
+
+    failures = 0
+    for bucket, region, limit in ceilings:
+        used = total[region] if bucket == "total" else totals[bucket][region]
+        if used > limit:
+            print("[size],FAIL,%s %s %d bytes over its %d-byte ceiling"
+                  % (bucket, region, used - limit, limit), file=sys.stderr)
+            failures += 1
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())